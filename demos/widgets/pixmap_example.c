@@ -6,6 +6,7 @@
 
  */
 
+#include <inttypes.h>
 #include <gfxprim.h>
 
 static void *uids;
@@ -71,7 +72,7 @@ int pixmap_on_event(gp_widget_event *ev)
 static void set_color(gp_pixel *col, const char *val, const char *name)
 {
 	*col = strtol(val, NULL, 16);
-	printf("%s = 0x%x\n", name, *col);
+	printf("%s = 0x%"PRIx64"\n", name, *col);
 }
 
 int set_fg_color(gp_widget_event *ev)
@@ -25,6 +25,15 @@
 @         return 8
 @ end
 @
+@ # Pixel types the conversions go through, 16 bits per channel types are
+@ # converted via RGB161616 so that the precision is not lost.
+@ def conv_type(*pts):
+@     for pt in pts:
+@         if max([c.size for c in pt.chanslist]) > 8:
+@             return pixeltypes_dict['RGB161616']
+@     return pixeltypes_dict['RGB888']
+@ end
+@
 @ def fetch_gamma_tables(pt, ctx, pref="", suff=""):
 /* prepare Gamma tables */
 @     for c in pt.chanslist:
@@ -15,6 +15,7 @@
 from pixeltype import PixelType
 from pixelsize import PixelSize, LE, BE
 from gfxprimconfig import GfxPrimConfig
+from simdtarget import SIMDTarget
 
 # Declared pixel sizes:
 PS_1BPP_LE = PixelSize(1, bit_endian=LE)
@@ -27,21 +28,35 @@ PS_8BPP = PixelSize(8)
 PS_16BPP = PixelSize(16)
 PS_24BPP = PixelSize(24)
 PS_32BPP = PixelSize(32)
+PS_48BPP = PixelSize(48)
+PS_64BPP = PixelSize(64)
 # Experimental:
 PS_18BPP_LE = PixelSize(18, bit_endian=LE)
 
+# SIMD targets, ordered from the least to the most preferred:
+X86 = "defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))"
+ARM = "defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)"
+
+SIMD_SSE2 = SIMDTarget('sse2', 'sse2', X86, 'GP_CPU_SSE2')
+SIMD_AVX2 = SIMDTarget('avx2', 'avx2', X86, 'GP_CPU_AVX2')
+SIMD_NEON = SIMDTarget('neon', 'fpu=neon', ARM, 'GP_CPU_NEON')
+
 config = GfxPrimConfig(
 
     # C name and bit-size of the GP_pixel type
-    pixel_type = "uint32_t",
-    pixel_size = 32,
+    pixel_type = "uint64_t",
+    pixel_size = 64,
 
     # List of pixel sizes (bpp), explicit on purpose
     pixelsizes = [PS_1BPP_LE, PS_1BPP_BE, PS_2BPP_LE, PS_2BPP_BE, PS_4BPP_LE, PS_4BPP_BE,
-                  PS_8BPP, PS_16BPP, PS_24BPP, PS_32BPP,
+                  PS_8BPP, PS_16BPP, PS_24BPP, PS_32BPP, PS_48BPP, PS_64BPP,
                   PS_18BPP_LE,
                  ],
 
+    # List of SIMD variants generated for kernels, the best one supported by
+    # the CPU is selected at runtime. Note that aarch64 has NEON in baseline.
+    simd_targets = [SIMD_SSE2, SIMD_AVX2, SIMD_NEON],
+
     # List of PixelTypes, order defines the numbering.
     # The "Undefined" type is added automatically.
     pixeltypes = [
@@ -132,5 +147,28 @@ config = GfxPrimConfig(
 
       PixelType(name='G16', pixelsize=PS_16BPP, chanslist=[
 	  ('V', 0, 16)]),
+
+      #
+      # RGB with premultiplied alpha
+      #
+      PixelType(name='RGBA8888_PM', pixelsize=PS_32BPP, chanslist=[
+	  ('R', 24, 8),
+	  ('G', 16, 8),
+	  ('B', 8, 8),
+	  ('A', 0, 8)], premultiplied=True),
+
+      #
+      # High precision RGB, 16 bits per channel
+      #
+      PixelType(name='RGB161616', pixelsize=PS_48BPP, chanslist=[
+	  ('R', 32, 16),
+	  ('G', 16, 16),
+	  ('B', 0, 16)]),
+
+      PixelType(name='RGBA16161616', pixelsize=PS_64BPP, chanslist=[
+	  ('R', 48, 16),
+	  ('G', 32, 16),
+	  ('B', 16, 16),
+	  ('A', 0, 16)]),
       ]
     )
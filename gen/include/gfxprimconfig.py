@@ -11,7 +11,7 @@ from pixelsize import PixelSize
 
 class GfxPrimConfig(object):
   def __init__(self, pixel_type = None, pixel_size=None, pixelsizes=None,
-	       pixeltypes=None):
+	       pixeltypes=None, simd_targets=None):
     """Initialize GfxPrim code generation config
 
     pixel_type: name of C type for a pixel value
@@ -19,6 +19,7 @@ class GfxPrimConfig(object):
     pixelsizes: list of generated and allowed PixelSizes
     pixelsizes_by_bpp: dictionary of bitendians by BPP
     pixeltypes: list of generated PixelTypes, not incl. UNKNOWN
+    simd_targets: list of SIMDTargets, the later ones are preferred
     """
 
     self.pixel_type = pixel_type
@@ -53,6 +54,9 @@ class GfxPrimConfig(object):
     # List of all PixelTypes in order. "Unknown" MUST be first.
     self.pixeltypes = []
 
+    # List of SIMD variants of generated kernels
+    self.simd_targets = simd_targets or []
+
     self.add_pixeltype(PixelType("UNKNOWN", PixelSize(0), []))
     if pixeltypes:
       for t in pixeltypes:
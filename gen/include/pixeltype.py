@@ -35,16 +35,18 @@ class PixelChannel(list):
 class PixelType(object):
   """Representation of one gp_pixel_type"""
 
-  def __init__(self, name, pixelsize, chanslist):
+  def __init__(self, name, pixelsize, chanslist, premultiplied=False):
     """`name` must be a valid C identifier
     `pixelsize` is an instance of PixelSize
     `chanslist` is a list of triplets describing individual channels as
       [ (`chan_name`, `bit_offset`, `bit_size`) ]
       where `chan_name` is usually one of: R, G, B,
       V (value, used for grayscale), A (opacity)
+    `premultiplied` is set for types with color channels premultiplied by A
     """
     assert re.match('\A[A-Za-z][A-Za-z0-9_]*\Z', name)
     self.name = name
+    self.premultiplied = premultiplied
     # Create channel list with convinience variables
     new_chanslist = []
     self.chan_names = []
@@ -102,3 +104,6 @@ class PixelType(object):
   def is_alpha(self):
     return ('A' in self.chans)
 
+  def is_premultiplied(self):
+    return self.premultiplied
+
@@ -0,0 +1,71 @@
+@ #
+@ # Generator for row reversal kernels, licenced under LGPLv2+
+@ #
+@ # Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # The reverse_row_functions() generates reverse_row_{ps.suffix}(dst, src, w)
+@ # for byte aligned pixel sizes that writes w pixels from src into dst in
+@ # reversed order.
+@ #
+@ include simd.t
+@
+@ def reverse_row_functions():
+@     for ps in pixelsizes:
+@         if ps.size in [8, 16]:
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * {{ 64 // ps.size }} pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_{{ ps.suffix }}(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + {{ 64 // ps.size }} <= n; x += {{ 64 // ps.size }}) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - {{ 64 // ps.size }}) * {{ ps.size // 8 }}, 8);
+		v = __builtin_bswap64(v);
+@             if ps.size == 16:
+		v = ((v >> 8) & 0x00ff00ff00ff00ffull) | ((v & 0x00ff00ff00ff00ffull) << 8);
+@             end
+		memcpy(dst + x * {{ ps.size // 8 }}, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * {{ ps.size // 8 }}, src + (n - x - 1) * {{ ps.size // 8 }}, {{ ps.size // 8 }});
+}
+
+@         elif ps.size in [32, 64]:
+GP_SIMD_BODY void reverse_row_{{ ps.suffix }}_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint{{ ps.size }}_t *d = (void*)dst;
+	const uint{{ ps.size }}_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+{@ simd_function('void', 'reverse_row_' + ps.suffix, [('uint8_t *restrict', 'dst'), ('const uint8_t *restrict', 'src'), ('gp_size', 'w')]) @}
+
+@         elif not ps.needs_bit_endian():
+static void reverse_row_{{ ps.suffix }}(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * {{ ps.size // 8 }};
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, {{ ps.size // 8 }});
+		dst += {{ ps.size // 8 }};
+		src -= {{ ps.size // 8 }};
+	}
+}
+
+@         end
+@     end
+@ end
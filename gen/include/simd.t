@@ -0,0 +1,68 @@
+@ #
+@ # Runtime dispatched SIMD variants of a function.
+@ #
+@ # The kernel is written once as {name}_body() static inline function marked
+@ # with GP_SIMD_BODY, then simd_function() generates {name}() that calls the
+@ # body compiled for the best SIMD target supported by the CPU. The variant
+@ # is selected on the first call, since the first call may happen in several
+@ # threads at once the function pointer is accessed atomically.
+@ #
+@ # The params is a list of (C type, name) tuples.
+@ #
+@ def simd_param(p):
+@     if p[0].endswith('*'):
+@         return p[0] + p[1]
+@     return p[0] + ' ' + p[1]
+@ end
+@
+@ def simd_function(ret, name, params):
+@     decl = ', '.join([simd_param(p) for p in params])
+@     args = ', '.join([p[1] for p in params])
+@     retstmt = '' if ret == 'void' else 'return '
+GP_SIMD_VARIANT
+static {{ ret }} {{ name }}_generic({{ decl }})
+{
+	{{ retstmt }}{{ name }}_body({{ args }});
+}
+
+@     for t in config.simd_targets:
+#if {{ t.cpp_cond }}
+GP_SIMD_VARIANT __attribute__((target("{{ t.target }}")))
+static {{ ret }} {{ name }}_{{ t.name }}({{ decl }})
+{
+	{{ retstmt }}{{ name }}_body({{ args }});
+}
+#endif
+
+@     end
+static {{ ret }} {{ name }}_resolve({{ decl }});
+
+static {{ ret }} (*{{ name }}_fn)({{ decl }}) = {{ name }}_resolve;
+
+static {{ ret }} {{ name }}_resolve({{ decl }})
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	{{ ret }} (*fn)({{ decl }}) = {{ name }}_generic;
+	const char *variant = "generic";
+
+@     for t in config.simd_targets:
+#if {{ t.cpp_cond }}
+	if (flags & {{ t.cpu_flag }}) {
+		fn = {{ name }}_{{ t.name }};
+		variant = "{{ t.name }}";
+	}
+#endif
+@     end
+
+	GP_DEBUG(1, "Using %s variant of {{ name }}()", variant);
+
+	__atomic_store_n(&{{ name }}_fn, fn, __ATOMIC_RELAXED);
+
+	{{ retstmt }}fn({{ args }});
+}
+
+static inline {{ ret }} {{ name }}({{ decl }})
+{
+	{{ retstmt }}__atomic_load_n(&{{ name }}_fn, __ATOMIC_RELAXED)({{ args }});
+}
+@ end
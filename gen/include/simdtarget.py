@@ -0,0 +1,25 @@
+#
+#  gfxprim.simdtarget - Module with SIMD target description class
+#
+# 2026 - Cyril Hrubis <metan@ucw.cz>
+#
+
+import re
+
+class SIMDTarget(object):
+  """Representation of a SIMD instruction set variant"""
+
+  def __init__(self, name, target, cpp_cond, cpu_flag):
+    """`name` is used as a suffix for generated function variants
+    `target` is a string passed to __attribute__((target(...)))
+    `cpp_cond` is a preprocessor condition for the compiler support
+    `cpu_flag` is a runtime flag as returned by gp_cpu_flags()
+    """
+    assert re.match('\A[a-z][a-z0-9_]*\Z', name)
+    self.name = name
+    self.target = target
+    self.cpp_cond = cpp_cond
+    self.cpu_flag = cpu_flag
+
+  def __str__(self):
+    return "<SIMDTarget " + self.name + ">"
@@ -0,0 +1,65 @@
+@ #
+@ # Generator for in register transposition of pixel blocks, licenced under
+@ # LGPLv2+
+@ #
+@ # Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # The transpose_functions() generates transpose_{ps.suffix}() for pixel sizes
+@ # for which n pixels fit into a 16 byte vector, i.e. is_vec(ps) is true.
+@ #
+@ # The n x n block is loaded by rows and transposed in registers by log2(n)
+@ # rounds of interleaves, which compile into unpack instructions on SSE2 and
+@ # zip instructions on NEON.
+@ #
+@ def is_vec(ps):
+@     return ps.size in [8, 16, 32, 64]
+@ end
+@
+@ def transpose(ps):
+@     n = 128 // ps.size
+@     lo = ', '.join([str(i) for k in range(n // 2) for i in [k, n + k]])
+@     hi = ', '.join([str(i) for k in range(n // 2) for i in [n // 2 + k, n + n // 2 + k]])
+@     rounds = n.bit_length() - 1
+typedef uint{{ ps.size }}_t v_{{ ps.suffix }} __attribute__((vector_size(16)));
+
+/*
+ * Transposes {{ n }}x{{ n }} block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_{{ ps.suffix }}(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_{{ ps.suffix }} r[{{ n }}], t[{{ n }}];
+
+@     for i in range(n):
+	memcpy(&r[{{ i }}], src + {{ i }} * src_step, 16);
+@     end
+
+@     for j in range(rounds):
+@         a = 'r' if j % 2 == 0 else 't'
+@         b = 't' if j % 2 == 0 else 'r'
+@         for i in range(n // 2):
+	{{ b }}[{{ 2 * i }}] = SHUFFLE({{ a }}[{{ i }}], {{ a }}[{{ i + n // 2 }}], {{ lo }});
+	{{ b }}[{{ 2 * i + 1 }}] = SHUFFLE({{ a }}[{{ i }}], {{ a }}[{{ i + n // 2 }}], {{ hi }});
+@         end
+
+@     end
+@     for i in range(n):
+	memcpy(dst + {{ i }} * dst_step, &{{ 'r' if rounds % 2 == 0 else 't' }}[{{ i }}], 16);
+@     end
+}
+
+@ end
+@
+@ def transpose_functions():
+#ifdef __clang__
+# define SHUFFLE(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+# define SHUFFLE(a, b, ...) __builtin_shuffle(a, b, (__typeof__(a)){__VA_ARGS__})
+#endif
+
+@     for ps in pixelsizes:
+@         if is_vec(ps):
+{@ transpose(ps) @}
+@         end
+@     end
+@ end
@@ -156,6 +156,15 @@ static inline void gp_backend_update_rect_xywh(gp_backend *self,
 	gp_backend_update_rect_xyxy(self, x, y, x + w - 1, y + h - 1);
 }
 
+/*
+ * Updates rectangles modified since the last update and clears the damage.
+ *
+ * The damage tracking has to be enabled on the backend pixmap with
+ * gp_pixmap_damage_enable() first, otherwise the whole pixmap is flipped.
+ * Resized pixmap is damaged as a whole and the tracking stays enabled.
+ */
+void gp_backend_update_damage(gp_backend *self);
+
 static inline void gp_backend_exit(gp_backend *self)
 {
 	if (self)
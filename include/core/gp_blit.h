@@ -74,21 +74,65 @@ static inline void gp_blit_clipped(const gp_pixmap *src,
 }
 
 /*
- * Same as gp_blit_xyxy but doesn't respect rotations. Faster (for now).
+ * Blits rectangle from src defined by x0, y0, w0, h0 to dst starting on x1,
+ * y1 skipping source pixels equal to the key. The key is a src pixel value.
+ *
+ * The rectangles are clipped the same way as in gp_blit_xywh_clipped().
+ */
+void gp_blit_colorkey(const gp_pixmap *src,
+                      gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                      gp_pixmap *dst, gp_coord x1, gp_coord y1, gp_pixel key);
+
+/*
+ * Blits rectangle from src defined by x0, y0, w0, h0 to dst starting on x1,
+ * y1 copying only pixels that are set in the G1 mask. The mask is addressed
+ * by the source coordinates and has to be at least as large as src.
+ *
+ * The rectangles are clipped the same way as in gp_blit_xywh_clipped().
+ */
+void gp_blit_masked(const gp_pixmap *src,
+                    gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                    gp_pixmap *dst, gp_coord x1, gp_coord y1,
+                    const gp_pixmap *mask);
+
+enum gp_blit_scale_type {
+	/* Nearest neighbour */
+	GP_BLIT_SCALE_NN,
+	/* Bilinear interpolation */
+	GP_BLIT_SCALE_LINEAR,
+};
+
+/*
+ * Blits rectangle from src defined by x0, y0, w0, h0 scaled to w1 x h1
+ * rectangle in dst starting on x1, y1.
+ *
+ * The source rectangle must be inside of the src pixmap, the destination
+ * rectangle is clipped to fit the dst pixmap.
+ *
+ * Returns zero on success, non-zero on allocation failure.
+ */
+int gp_blit_scaled(const gp_pixmap *src,
+                   gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                   gp_pixmap *dst,
+                   gp_coord x1, gp_coord y1, gp_size w1, gp_size h1,
+                   enum gp_blit_scale_type type);
+
+/*
+ * Same as gp_blit_xyxy but doesn't respect rotations.
  */
 void gp_blit_xyxy_raw(const gp_pixmap *src,
                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
 		      gp_pixmap *dst, gp_coord x2, gp_coord y2);
 
 /*
- * Same as gp_blit_xywh but doesn't respect rotations. Faster (for now).
+ * Same as gp_blit_xywh but doesn't respect rotations.
  */
 void gp_blit_xywh_raw(const gp_pixmap *src,
                       gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
 		      gp_pixmap *dst, gp_coord x2, gp_coord y2);
 
 /*
- * Same as gp_blit but doesn't respect rotations. Faster (for now).
+ * Same as gp_blit but doesn't respect rotations.
  */
 static inline void gp_blit_raw(const gp_pixmap *src,
                                gp_coord x0, gp_coord y0,
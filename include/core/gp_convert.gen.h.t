@@ -27,6 +27,24 @@
 	GP_SET_BITS({{ K.off }}+o2, {{ K.size }}, p2, GP_SCALE_VAL_{{ max_size }}_{{ K.size }}({{ max_val }} - _K)); \
 @ end
 @
+@ # Straight alpha <-> premultiplied alpha requires special handling
+@ def alpha_premultiply(in_pix, out_pix):
+@     A1 = in_pix.chans['A']
+@     A2 = out_pix.chans['A']
+	gp_pixel _A = GP_GET_BITS({{ A1.off }}+o1, {{ A1.size }}, p1); \
+	GP_SET_BITS({{ A2.off }}+o2, {{ A2.size }}, p2, GP_SCALE_VAL_{{ A1.size }}_{{ A2.size }}(_A)); \
+@     for c2 in out_pix.chanslist:
+@         if c2.name != 'A':
+@             c1 = in_pix.chans[c2.name]
+@             if out_pix.is_premultiplied():
+	/* {{ c2.name }}:={{ c1.name }}*A */ GP_SET_BITS({{ c2.off }}+o2, {{ c2.size }}, p2, \
+		GP_SCALE_VAL_{{ c1.size }}_{{ c2.size }}((GP_GET_BITS({{ c1.off }}+o1, {{ c1.size }}, p1) * _A + {{ A1.max // 2 }}) / {{ A1.C_max }})); \
+@             else:
+	/* {{ c2.name }}:={{ c1.name }}/A */ gp_pixel _{{ c2.name }} = _A ? (GP_GET_BITS({{ c1.off }}+o1, {{ c1.size }}, p1) * {{ A1.C_max }} + _A/2) / _A : 0; \
+	GP_SET_BITS({{ c2.off }}+o2, {{ c2.size }}, p2, \
+		GP_SCALE_VAL_{{ c1.size }}_{{ c2.size }}(_{{ c2.name }} > {{ c1.C_max }} ? {{ c1.C_max }} : _{{ c2.name }})); \
+@ end
+@
 @ def pixel_type_to_type(pt1, pt2):
 /*** {{ pt1.name }} -> {{ pt2.name }} ***
  * macro reads p1 ({{ pt1.name }} at bit-offset o1)
@@ -36,6 +54,10 @@
 @     # special cases
 @     if pt1.is_rgb() and pt2.is_cmyk():
 @         rgb_to_cmyk(pt1, pt2)
+@     elif (pt1.is_premultiplied() != pt2.is_premultiplied() and
+@           pt1.is_alpha() and pt2.is_alpha() and
+@           sorted(pt1.chan_names) == sorted(pt2.chan_names)):
+@         alpha_premultiply(pt1, pt2)
 @     else:
 @         for c2 in pt2.chanslist:
 @             # case 1: just copy a channel
@@ -90,11 +112,13 @@
 @
 @ # Loop around "central" pixel types
 @
-@ for pt in [pixeltypes_dict['RGB888'], pixeltypes_dict['RGBA8888']]:
+@ central_types = ['RGB888', 'RGBA8888', 'RGB161616', 'RGBA16161616']
+@
+@ for pt in [pixeltypes_dict[n] for n in central_types]:
 @     for i in pixeltypes:
 @         if not i.is_unknown() and not i.is_palette():
 @             pixel_type_to_type(pt, i)
-@             if i.name not in ['RGB888', 'RGBA8888']:
+@             if i.name not in central_types:
 @                 pixel_type_to_type(i, pt)
 @     end
 
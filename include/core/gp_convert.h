@@ -100,4 +100,38 @@ static inline gp_pixel gp_convert_pixmap_pixel(gp_pixel pixel,
 	                            to->pixel_type);
 }
 
+/*
+ * Converts a row of w pixels, the src and dst point to the first pixel.
+ */
+typedef void (*gp_convert_row_fn)(void *dst, const void *src, gp_size w);
+
+/*
+ * Returns vectorized row converter between a pair of byte aligned pixel types
+ * or NULL if there is none. Types with alpha channel are not converted since
+ * blits blend these instead.
+ */
+gp_convert_row_fn gp_convert_row_get(gp_pixel_type src, gp_pixel_type dst);
+
+/*
+ * Returns vectorized row compositor that blends a row of src pixels with
+ * alpha channel onto a row of dst pixels or NULL if there is none. The
+ * result is the same as with gp_mix_pixels_{src}_{dst}().
+ */
+gp_convert_row_fn gp_blend_row_get(gp_pixel_type src, gp_pixel_type dst);
+
+/*
+ * Converts a row of w RGBA8888 pixels into the dst pixmap starting at x, y
+ * with ordered dithering. The dither pattern is aligned to the dst pixmap
+ * coordinates so that neighbouring rows and tiles fit together.
+ */
+typedef void (*gp_dither_row_fn)(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w);
+
+/*
+ * Returns row converter with ordered dithering for pixel types with less than
+ * 8 bits per channel or NULL if there is none. The alpha channel of the
+ * RGBA8888 source row is ignored.
+ */
+gp_dither_row_fn gp_dither_row_get(gp_pixel_type dst);
+
 #endif /* CORE_GP_CONVERT_H */
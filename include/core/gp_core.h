@@ -27,6 +27,18 @@
 /* ... and it's trasformations */
 #include <core/gp_transform.h>
 
+/* File backed pixmaps */
+#include <core/gp_pixmap_mmap.h>
+
+/* Pixmap pool */
+#include <core/gp_pixmap_pool.h>
+
+/* Pixmap damage tracking */
+#include <core/gp_damage.h>
+
+/* Tiled pixmaps */
+#include <core/gp_tiled_pixmap.h>
+
 /* Gamma */
 #include <core/gp_gamma.h>
 
@@ -42,6 +54,15 @@
 /* Writing pixel blocks */
 #include <core/gp_write_pixel.h>
 
+/* Bulk row access */
+#include <core/gp_pixel_row.h>
+
+/* Linear light conversions */
+#include <core/gp_gamma_linear.h>
+
+/* YUV frames */
+#include <core/gp_yuv.h>
+
 /* Blitting */
 #include <core/gp_blit.h>
 
@@ -53,6 +74,7 @@
 
 /* Threads utils */
 #include <core/gp_threads.h>
+#include <core/gp_cpu.h>
 
 /* Mix Pixel */
 #include <core/gp_mix_pixels.h>
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Runtime CPU features detection used to select SIMD variants of generated
+   kernels.
+
+  */
+
+#ifndef CORE_GP_CPU_H
+#define CORE_GP_CPU_H
+
+enum gp_cpu_flags {
+	GP_CPU_SSE2 = 0x01,
+	GP_CPU_AVX2 = 0x02,
+	GP_CPU_NEON = 0x04,
+};
+
+/*
+ * Returns a bitmask of enum gp_cpu_flags supported by the CPU.
+ *
+ * The detection is done once on the first call. If GP_SIMD enviroment
+ * variable is set to 0 no flags are reported and only generic variants of the
+ * kernels are used. The GP_SIMD may also be set to a comma separated list of
+ * flag names, e.g. 'sse2', to force a particular variant.
+ */
+unsigned int gp_cpu_flags(void);
+
+/*
+ * Marks the body of a kernel that is compiled for several SIMD targets, see
+ * simd.t in the code generator.
+ */
+#define GP_SIMD_BODY static inline __attribute__((always_inline))
+
+/*
+ * Attributes for the generated variants, the default -O2 cost model does not
+ * vectorize loops with unknown trip count so we ask for the dynamic one.
+ */
+#ifdef __clang__
+# define GP_SIMD_VARIANT
+#else
+# define GP_SIMD_VARIANT \
+	__attribute__((optimize("tree-vectorize", "vect-cost-model=dynamic")))
+#endif
+
+#endif /* CORE_GP_CPU_H */
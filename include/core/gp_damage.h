@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Pixmap damage tracking.
+
+  When enabled the drawing functions record the rectangles they have modified
+  so that the backends can update only the parts of the screen that have
+  changed. The damage is a short list of rectangles, overlapping and adjacent
+  rectangles are merged and once the list is full the new rectangle is merged
+  with the one it enlarges the least.
+
+  The rectangles are in raw coordinates, i.e. rotation flags are already
+  applied, and include both corners, which is what the backend update_rect()
+  expects.
+
+ */
+
+#ifndef CORE_GP_DAMAGE_H
+#define CORE_GP_DAMAGE_H
+
+#include <core/gp_pixmap.h>
+#include <core/gp_transform.h>
+
+#define GP_DAMAGE_MAX_RECTS 8
+
+typedef struct gp_damage_rect {
+	gp_coord x0, y0;
+	gp_coord x1, y1;
+} gp_damage_rect;
+
+struct gp_damage {
+	/* Pixmap the damage belongs to, subpixmaps share it */
+	const gp_pixmap *pixmap;
+
+	unsigned int rect_cnt;
+	gp_damage_rect rects[GP_DAMAGE_MAX_RECTS];
+};
+
+/*
+ * Enables damage tracking, subpixmaps created afterwards record the damage
+ * into the parent pixmap. Calling this on a pixmap with damage tracking
+ * enabled is no-op.
+ *
+ * Returns zero on success, non-zero and errno on allocation failure.
+ */
+int gp_pixmap_damage_enable(gp_pixmap *self);
+
+/*
+ * Disables damage tracking and frees the damage list.
+ *
+ * Subpixmaps share the damage list with the parent, hence the tracking cannot
+ * be disabled once subpixmaps were created from the pixmap, the list is freed
+ * by gp_pixmap_free() in that case.
+ */
+void gp_pixmap_damage_disable(gp_pixmap *self);
+
+/*
+ * Frees the damage list regardless of subpixmaps, used by gp_pixmap_free().
+ */
+void gp_pixmap_damage_free(gp_pixmap *self);
+
+/*
+ * Empties the damage list, the backends call this once the damaged
+ * rectangles were updated.
+ */
+static inline void gp_pixmap_damage_clear(gp_pixmap *self)
+{
+	if (self->damage)
+		self->damage->rect_cnt = 0;
+}
+
+/*
+ * Returns non-zero if damage tracking is enabled and the pixmap was modified.
+ */
+static inline int gp_pixmap_damaged(const gp_pixmap *self)
+{
+	return self->damage && self->damage->rect_cnt;
+}
+
+/*
+ * Adds a rectangle to the damage, use gp_pixmap_damage_xyxy_raw() instead.
+ */
+void gp_pixmap_damage_add(gp_pixmap *self, gp_coord x0, gp_coord y0,
+                          gp_coord x1, gp_coord y1);
+
+/*
+ * Marks a rectangle as modified, the rectangle is clipped to the pixmap.
+ *
+ * All library functions that modify pixels call this. The _raw pixel access
+ * functions do not, code that writes the pixels directly has to call it.
+ */
+static inline void gp_pixmap_damage_xyxy_raw(gp_pixmap *self,
+                                             gp_coord x0, gp_coord y0,
+                                             gp_coord x1, gp_coord y1)
+{
+	if (likely(!self->damage))
+		return;
+
+	gp_pixmap_damage_add(self, x0, y0, x1, y1);
+}
+
+static inline void gp_pixmap_damage_xyxy(gp_pixmap *self,
+                                         gp_coord x0, gp_coord y0,
+                                         gp_coord x1, gp_coord y1)
+{
+	if (likely(!self->damage))
+		return;
+
+	GP_TRANSFORM_POINT(self, x0, y0);
+	GP_TRANSFORM_POINT(self, x1, y1);
+
+	gp_pixmap_damage_add(self, x0, y0, x1, y1);
+}
+
+static inline void gp_pixmap_damage_xywh_raw(gp_pixmap *self,
+                                             gp_coord x, gp_coord y,
+                                             gp_size w, gp_size h)
+{
+	if (w == 0 || h == 0)
+		return;
+
+	gp_pixmap_damage_xyxy_raw(self, x, y, x + w - 1, y + h - 1);
+}
+
+/*
+ * Marks the whole pixmap as modified.
+ */
+static inline void gp_pixmap_damage_all(gp_pixmap *self)
+{
+	gp_pixmap_damage_xywh_raw(self, 0, 0, self->w, self->h);
+}
+
+#endif /* CORE_GP_DAMAGE_H */
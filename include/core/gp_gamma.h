@@ -48,7 +48,8 @@
    table for particular gamma value and bit depth in memory at a time.
 
    Also the table output, for linear values, has two more bits than original in
-   order not to loose precision.
+   order not to loose precision, but no more than 16 bits. The alpha channel is
+   not gamma corrected, the tables for alpha are linear.
 
    The pointers to gamma tables are storied in gp_gamma structure and are
    organized in the same order as channels. First N tables for each channel and
@@ -120,6 +121,14 @@ typedef struct gp_gamma_table {
 	unsigned int ref_count;
 	struct gp_gamma_table *next;
 
+	/*
+	 * The table values expanded to 32 bits for vectorized lookups, the
+	 * tables for conversion to linear space have 16 bit output here and
+	 * the reverse tables have at least 12 bit input.
+	 */
+	uint32_t *lut32;
+	uint8_t lut32_bits;
+
 	/* The table itself */
 	union {
 		uint8_t u8[0];
@@ -154,6 +163,8 @@ gp_gamma *gp_gamma_acquire(gp_pixel_type pixel_type, float gamma);
 
 /*
  * Returns pointer to the sRGB translation table.
+ *
+ * May fail, in case malloc() has failed.
  */
 gp_gamma *gp_sRGB_acquire(gp_pixel_type pixel_type);
 
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Conversion between gamma encoded pixmaps and linear light.
+
+  The pixel channels are converted to 16 bit linear values by the gamma
+  tables, see gp_gamma.h, and stored in per-channel arrays, i.e. in the same
+  layout as the bulk row access in gp_pixel_row.h uses. Filters that want to
+  work in linear light convert the rows they process in their inner loop, or
+  the whole pixmap is converted into a linear buffer, processed and converted
+  back.
+
+  Pixmaps without gamma tables are expected to be sRGB encoded.
+
+ */
+
+#ifndef CORE_GP_GAMMA_LINEAR_H
+#define CORE_GP_GAMMA_LINEAR_H
+
+#include <stdint.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_gamma.h>
+#include <core/gp_progress_callback.h>
+
+/*
+ * Converts w pixels starting at x, y to linear light.
+ *
+ * The chans is an array of 16 bit buffers, one for each pixel channel in the
+ * order the channels are listed in the pixel type description, each buffer
+ * has to be at least w long.
+ *
+ * The gamma has to match the src pixel type. The coordinates are raw, i.e.
+ * rotation flags are ignored, and the span must fit into the pixmap.
+ */
+void gp_gamma_row_to_linear(const gp_gamma *gamma, const gp_pixmap *src,
+                            gp_coord x, gp_coord y, gp_size w,
+                            uint16_t *const chans[]);
+
+/*
+ * Converts w pixels from linear light and writes them starting at x, y.
+ */
+void gp_gamma_row_from_linear(const gp_gamma *gamma, gp_pixmap *dst,
+                              gp_coord x, gp_coord y, gp_size w,
+                              uint16_t *const chans[]);
+
+/*
+ * Whole pixmap in linear light.
+ */
+typedef struct gp_linear_pixmap {
+	gp_size w;
+	gp_size h;
+
+	/* Pixel type of the pixmap the buffer is converted from and to */
+	gp_pixel_type pixel_type;
+
+	/* Per-channel planes, w * h values each */
+	unsigned int chan_cnt;
+	uint16_t *chans[GP_PIXELTYPE_MAX_CHANNELS];
+} gp_linear_pixmap;
+
+/*
+ * Allocates linear buffer for pixmap of size w x h and pixel type.
+ *
+ * Returns NULL on allocation failure.
+ */
+gp_linear_pixmap *gp_linear_pixmap_alloc(gp_size w, gp_size h,
+                                         gp_pixel_type pixel_type);
+
+/*
+ * Frees linear buffer.
+ */
+void gp_linear_pixmap_free(gp_linear_pixmap *self);
+
+/*
+ * Returns pointer to a buffer row.
+ */
+static inline uint16_t *gp_linear_pixmap_row(const gp_linear_pixmap *self,
+                                             unsigned int chan, gp_coord y)
+{
+	return self->chans[chan] + (size_t)y * self->w;
+}
+
+/*
+ * Converts a pixmap into linear light, the conversion runs in parallel.
+ *
+ * The dst has to have the same size and pixel type as the src pixmap.
+ *
+ * Returns zero on success, non-zero on failure or abort from the callback.
+ */
+int gp_pixmap_to_linear(const gp_pixmap *src, gp_linear_pixmap *dst,
+                        gp_progress_cb *callback);
+
+/*
+ * Allocates linear buffer and converts the src pixmap into it.
+ *
+ * Returns NULL on failure or abort from the callback.
+ */
+gp_linear_pixmap *gp_pixmap_to_linear_alloc(const gp_pixmap *src,
+                                            gp_progress_cb *callback);
+
+/*
+ * Converts linear buffer back into the dst pixmap, the gamma tables of the dst
+ * pixmap are used.
+ *
+ * The dst has to have the same size and pixel type as the src buffer.
+ *
+ * Returns zero on success, non-zero on failure or abort from the callback.
+ */
+int gp_pixmap_from_linear(const gp_linear_pixmap *src, gp_pixmap *dst,
+                          gp_progress_cb *callback);
+
+#endif /* CORE_GP_GAMMA_LINEAR_H */
@@ -82,7 +82,19 @@
  */
 static inline gp_pixel gp_getpixel_raw_{{ ps.suffix }}(const gp_pixmap *c, gp_coord x, gp_coord y)
 {
-@     if ps.size == 32:
+@     if ps.size == 64:
+	/*
+	 * 64 BPP is expected to have aligned pixels
+	 */
+	return *((uint64_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y));
+@     elif ps.size == 48:
+	/*
+	 * 48 BPP is aligned to 16 bits
+	 */
+	const uint16_t *addr = (uint16_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y);
+
+	return addr[0] | ((gp_pixel)addr[1]<<16) | ((gp_pixel)addr[2]<<32);
+@     elif ps.size == 32:
 	/*
 	 * 32 BPP is expected to have aligned pixels
 	 */
@@ -103,6 +115,8 @@ static inline gp_pixel gp_getpixel_raw_{{ ps.suffix }}(const gp_pixmap *c, gp_co
 	 *
 	 * The full list = {1, 2, 4, 8}
 	 */
+	x += c->offset / {{ ps.size }};
+
 	return GP_GET_BITS1_ALIGNED(GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x), {{ ps.size }},
 		*(GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y)));
 @     elif ps.size <= 10 or ps.size == 12 or ps.size == 16:
@@ -157,7 +171,21 @@ static inline gp_pixel gp_getpixel_raw_{{ ps.suffix }}(const gp_pixmap *c, gp_co
  */
 static inline void gp_putpixel_raw_{{ ps.suffix }}(gp_pixmap *c, gp_coord x, gp_coord y, gp_pixel p)
 {
-@     if ps.size == 32:
+@     if ps.size == 64:
+	/*
+	 * 64 BPP is expected to have aligned pixels
+	 */
+	*((uint64_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y)) = p;
+@     elif ps.size == 48:
+	/*
+	 * 48 BPP is aligned to 16 bits
+	 */
+	uint16_t *addr = (uint16_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y);
+
+	addr[0] = p;
+	addr[1] = p>>16;
+	addr[2] = p>>32;
+@     elif ps.size == 32:
 	/*
 	 * 32 BPP is expected to have aligned pixels
 	 */
@@ -178,6 +206,8 @@ static inline void gp_putpixel_raw_{{ ps.suffix }}(gp_pixmap *c, gp_coord x, gp_
 	 *
 	 * The full list = {1, 2, 4, 8}
 	 */
+	x += c->offset / {{ ps.size }};
+
 	GP_SET_BITS1_ALIGNED(GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x), {{ ps.size }},
 	                     GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y), p);
 @     elif ps.size <= 10 or ps.size == 12 or ps.size == 16:
@@ -86,7 +86,7 @@
 #define GP_CLEAR_BITS(offset, len, dest) \
        ((dest) &= ~(((((typeof(dest))1) << (len)) - 1) << (offset)))
 
-#define GP_SET_BITS_OR(offset, dest, val) ((dest) |= ((val)<<(offset)))
+#define GP_SET_BITS_OR(offset, dest, val) ((dest) |= (((typeof(dest))(val))<<(offset)))
 
 #define GP_SET_BITS(offset, len, dest, val) do {  \
                GP_CLEAR_BITS(offset, len, dest);  \
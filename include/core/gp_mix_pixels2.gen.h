@@ -0,0 +1,2654 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_mix_pixels2.gen.h
+ *
+ * GENERATED on 2026 10 17 00:27:14 from gp_mix_pixels2.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_MIX_PIXELS2_GEN_H
+#define GP_MIX_PIXELS2_GEN_H
+
+/*
+ * Macros to mix two pixels. The source must have alpha channel.
+ *
+ * Sources with premultiplied alpha are composited with the cheaper over
+ * operator, i.e. dst = src + dst * (1 - alpha).
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_gamma_correction.h>
+#include <core/gp_pixel.h>
+
+//TODO: Fix blit where both source and destination have alpha channel
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_xRGB8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_xRGB8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGBA8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_BGR888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_BGR888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_BGR888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB555(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB555_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB555(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB565(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB565_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB565(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB666(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB666_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB666(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB332(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB332_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB332(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_CMYK8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_CMYK8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_G1(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G1_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G1(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_G2(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G2_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G2(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_G4(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G4_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G4(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_G8(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G8_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G8(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_GA88(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_GA88_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_GA88(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_G16(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G16_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G16(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGBA8888_PM(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888_PM(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGB161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_RGBA16161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA16161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA16161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_xRGB8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_xRGB8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGBA8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_BGR888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_BGR888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_BGR888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB555(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB555_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB555(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB565(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB565_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB565(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB666(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB666_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB666(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB332(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB332_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB332(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_CMYK8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_CMYK8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_G1(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G1_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G1(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_G2(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G2_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G2(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_G4(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G4_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G4(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_G8(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G8_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G8(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_GA88(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_GA88_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_GA88(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_G16(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G16_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G16(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGBA8888_PM(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888_PM(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGB161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_GA88_RGBA16161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_GA88(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_GA88_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA16161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (255 - alpha) + sr * alpha + 127) / 255;
+	dg = (dg * (255 - alpha) + sg * alpha + 127) / 255;
+	db = (db * (255 - alpha) + sb * alpha + 127) / 255;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA16161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_xRGB8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_xRGB8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_xRGB8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGBA8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_BGR888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_BGR888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_BGR888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB555(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB555_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB555(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB565(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB565_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB565(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB666(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB666_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB666(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB332(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGB332_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGB332(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_CMYK8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_CMYK8888_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_CMYK8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_G1(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G1_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G1(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_G2(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G2_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G2(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_G4(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G4_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G4(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_G8(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_G8_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_G8(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_GA88(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_GA88_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_GA88(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_G16(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G16_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xffff ? 0xffff : dr;
+	dg = dg > 0xffff ? 0xffff : dg;
+	db = db > 0xffff ? 0xffff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G16(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGBA8888_PM(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB888, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(src, src_rgb);
+	GP_PIXEL_RGBA8888_PM_TO_RGB888(dst, dst_rgb);
+
+	int sr, sg, sb;
+	int dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xff ? 0xff : dr;
+	dg = dg > 0xff ? 0xff : dg;
+	db = db > 0xff ? 0xff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+
+	GP_PIXEL_RGB888_TO_RGBA8888_PM(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGB161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xffff ? 0xffff : dr;
+	dg = dg > 0xffff ? 0xffff : dg;
+	db = db > 0xffff ? 0xffff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA8888_PM_RGBA16161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA8888_PM(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA8888_PM_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA16161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * (255 - alpha) + 127) / 255;
+	dg = sg + (dg * (255 - alpha) + 127) / 255;
+	db = sb + (db * (255 - alpha) + 127) / 255;
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > 0xffff ? 0xffff : dr;
+	dg = dg > 0xffff ? 0xffff : dg;
+	db = db > 0xffff ? 0xffff : db;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA16161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_xRGB8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_xRGB8888_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_xRGB8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGBA8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA8888_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB888_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_BGR888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_BGR888_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_BGR888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB555(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB555_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB555(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB565(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB565_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB565(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB666(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB666_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB666(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB332(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB332_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB332(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_CMYK8888(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_CMYK8888_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_CMYK8888(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_G1(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G1_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G1(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_G2(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G2_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G2(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_G4(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G4_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G4(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_G8(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G8_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G8(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_GA88(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_GA88_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_GA88(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_G16(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_G16_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_G16(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGBA8888_PM(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA8888_PM_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA8888_PM(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGB161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGB161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGB161616(dst_rgb, res);
+
+	return res;
+}
+
+
+static inline gp_pixel gp_mix_pixels_RGBA16161616_RGBA16161616(gp_pixel src, gp_pixel dst)
+{
+	/* Extract the alpha channel */
+	unsigned int alpha = GP_PIXEL_GET_A_RGBA16161616(src);
+
+	/* Convert the pixel to RGB161616, mix the values */
+	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
+
+	GP_PIXEL_RGBA16161616_TO_RGB161616(src, src_rgb);
+	GP_PIXEL_RGBA16161616_TO_RGB161616(dst, dst_rgb);
+
+	uint32_t sr, sg, sb;
+	uint32_t dr, dg, db;
+
+	sr = GP_PIXEL_GET_R_RGB161616(src_rgb);
+	sg = GP_PIXEL_GET_G_RGB161616(src_rgb);
+	sb = GP_PIXEL_GET_B_RGB161616(src_rgb);
+
+	dr = GP_PIXEL_GET_R_RGB161616(dst_rgb);
+	dg = GP_PIXEL_GET_G_RGB161616(dst_rgb);
+	db = GP_PIXEL_GET_B_RGB161616(dst_rgb);
+
+
+	dr = (dr * (65535 - alpha) + sr * alpha + 32767) / 65535;
+	dg = (dg * (65535 - alpha) + sg * alpha + 32767) / 65535;
+	db = (db * (65535 - alpha) + sb * alpha + 32767) / 65535;
+
+	dst_rgb = GP_PIXEL_CREATE_RGB161616(dr, dg, db);
+
+	GP_PIXEL_RGB161616_TO_RGBA16161616(dst_rgb, res);
+
+	return res;
+}
+
+#endif /* GP_MIX_PIXELS2_GEN_H */
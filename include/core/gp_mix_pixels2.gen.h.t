@@ -2,6 +2,9 @@
 /*
  * Macros to mix two pixels. The source must have alpha channel.
  *
+ * Sources with premultiplied alpha are composited with the cheaper over
+ * operator, i.e. dst = src + dst * (1 - alpha).
+ *
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
@@ -18,35 +21,50 @@
 
 static inline gp_pixel gp_mix_pixels_{{ src.name }}_{{ dst.name }}(gp_pixel src, gp_pixel dst)
 {
+@                     conv = conv_type(src, dst)
+@                     c_max = conv.chans['R'].C_max
+@                     var_type = 'uint32_t' if conv.name == 'RGB161616' else 'int'
 	/* Extract the alpha channel */
 	unsigned int alpha = GP_PIXEL_GET_A_{{ src.name }}(src);
 
-	/* Convert the pixel to RGB888, mix the values */
+	/* Convert the pixel to {{ conv.name }}, mix the values */
 	gp_pixel src_rgb = 0, dst_rgb = 0, res = 0;
 
-	GP_PIXEL_{{ src.name }}_TO_RGB888(src, src_rgb);
-	GP_PIXEL_{{ dst.name }}_TO_RGB888(dst, dst_rgb);
+	GP_PIXEL_{{ src.name }}_TO_{{ conv.name }}(src, src_rgb);
+	GP_PIXEL_{{ dst.name }}_TO_{{ conv.name }}(dst, dst_rgb);
 
-	int sr, sg, sb;
-	int dr, dg, db;
+	{{ var_type }} sr, sg, sb;
+	{{ var_type }} dr, dg, db;
 
-	sr = GP_PIXEL_GET_R_RGB888(src_rgb);
-	sg = GP_PIXEL_GET_G_RGB888(src_rgb);
-	sb = GP_PIXEL_GET_B_RGB888(src_rgb);
+	sr = GP_PIXEL_GET_R_{{ conv.name }}(src_rgb);
+	sg = GP_PIXEL_GET_G_{{ conv.name }}(src_rgb);
+	sb = GP_PIXEL_GET_B_{{ conv.name }}(src_rgb);
 
-	dr = GP_PIXEL_GET_R_RGB888(dst_rgb);
-	dg = GP_PIXEL_GET_G_RGB888(dst_rgb);
-	db = GP_PIXEL_GET_B_RGB888(dst_rgb);
+	dr = GP_PIXEL_GET_R_{{ conv.name }}(dst_rgb);
+	dg = GP_PIXEL_GET_G_{{ conv.name }}(dst_rgb);
+	db = GP_PIXEL_GET_B_{{ conv.name }}(dst_rgb);
 
 @                     a_max = 2 ** src.chans['A'][2] - 1
 
+@                     if src.is_premultiplied():
+	/* Source is already multiplied by alpha, the over operator is just an add */
+	dr = sr + (dr * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }};
+	dg = sg + (dg * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }};
+	db = sb + (db * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }};
+
+	/* Clamp values for invalid pixels i.e. color > alpha */
+	dr = dr > {{ c_max }} ? {{ c_max }} : dr;
+	dg = dg > {{ c_max }} ? {{ c_max }} : dg;
+	db = db > {{ c_max }} ? {{ c_max }} : db;
+@                     else:
 	dr = (dr * ({{ a_max }} - alpha) + sr * alpha + {{ a_max // 2 }}) / {{ a_max }};
 	dg = (dg * ({{ a_max }} - alpha) + sg * alpha + {{ a_max // 2 }}) / {{ a_max }};
 	db = (db * ({{ a_max }} - alpha) + sb * alpha + {{ a_max // 2 }}) / {{ a_max }};
+@                     end
 
-	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
+	dst_rgb = GP_PIXEL_CREATE_{{ conv.name }}(dr, dg, db);
 
-	GP_PIXEL_RGB888_TO_{{ dst.name }}(dst_rgb, res);
+	GP_PIXEL_{{ conv.name }}_TO_{{ dst.name }}(dst_rgb, res);
 
 	return res;
 }
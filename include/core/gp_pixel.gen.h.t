@@ -38,7 +38,7 @@ typedef enum gp_pixel_type {
  * macros to get channels of pixel type {{ pt.name }}
  */
 @         for c in pt.chanslist:
-#define GP_PIXEL_GET_{{ c[0] }}_{{ pt.name }}(p) (GP_GET_BITS({{ c[1] }}, {{ c[2] }}, (p)))
+#define GP_PIXEL_GET_{{ c[0] }}_{{ pt.name }}(p) ((unsigned int)GP_GET_BITS({{ c[1] }}, {{ c[2] }}, (p)))
 @         end
 
 /*
@@ -53,7 +53,11 @@ typedef enum gp_pixel_type {
  */
 #define GP_PIXEL_CREATE_{{ pt.name }}({{ ', '.join(pt.chan_names) }}) (0\
 @         for c in pt.chanslist:
+@             if c[1] + c[2] > 31:
+	+ (((gp_pixel)({{ c[0] }})) << {{ c[1] }}) \
+@             else:
 	+ (({{ c[0] }}) << {{ c[1] }}) \
+@             end
 @         end
 	)
 
@@ -75,6 +75,7 @@ typedef enum gp_pixel_flags {
 	GP_PIXEL_IS_PALETTE = 0x04,
 	GP_PIXEL_IS_CMYK = 0x08,
 	GP_PIXEL_IS_GRAYSCALE = 0x10,
+	GP_PIXEL_IS_PREMULTIPLIED = 0x20,
 } gp_pixel_flags;
 
 /*
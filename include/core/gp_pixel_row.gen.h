@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_pixel_row.gen.h
+ *
+ * GENERATED on 2026 10 17 00:27:14 from gp_pixel_row.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_PIXEL_ROW_GEN_H
+#define GP_PIXEL_ROW_GEN_H
+
+/*
+ * Bulk row unpack and pack functions for each pixel type.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+void gp_pixel_row_unpack_xRGB8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_xRGB8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGBA8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGBA8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_BGR888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_BGR888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB555(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB555(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB565(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB565(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB666(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB666(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB332(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB332(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_CMYK8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_CMYK8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_P2(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_P2(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_P4(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_P4(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_P8(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_P8(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_G1(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_G1(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_G2(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_G2(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_G4(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_G4(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_G8(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_G8(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_GA88(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_GA88(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_G16(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_G16(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGBA8888_PM(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGBA8888_PM(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGB161616(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGB161616(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+void gp_pixel_row_unpack_RGBA16161616(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_RGBA16161616(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+#endif /* GP_PIXEL_ROW_GEN_H */
@@ -0,0 +1,18 @@
+@ include header.t
+/*
+ * Bulk row unpack and pack functions for each pixel type.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+@ for pt in pixeltypes:
+@     if not pt.is_unknown():
+void gp_pixel_row_unpack_{{ pt.name }}(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[]);
+
+void gp_pixel_row_pack_{{ pt.name }}(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[]);
+
+@ end
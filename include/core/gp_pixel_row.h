@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Bulk row access.
+
+  A span of pixels is unpacked into per-channel int arrays and packed back
+  after processing. Filters that work with channel arrays have tight inner
+  loops that can be vectorized and the pixel access and channel shifts are
+  done once per row instead of once per pixel and channel.
+
+ */
+
+#ifndef CORE_GP_PIXEL_ROW_H
+#define CORE_GP_PIXEL_ROW_H
+
+#include <core/gp_pixmap.h>
+
+typedef void (gp_pixel_row_unpack_fn)(const gp_pixmap *src,
+                                      gp_coord x, gp_coord y, gp_size w,
+                                      int *const chans[]);
+
+typedef void (gp_pixel_row_pack_fn)(gp_pixmap *dst,
+                                    gp_coord x, gp_coord y, gp_size w,
+                                    int *const chans[]);
+
+#include <core/gp_pixel_row.gen.h>
+
+/*
+ * Unpacks w pixels starting at x, y into per-channel arrays.
+ *
+ * The chans is an array of channel buffers, one for each pixel channel in the
+ * order the channels are listed in the pixel type description, each buffer
+ * has to be at least w long.
+ *
+ * The coordinates are raw, i.e. rotation flags are ignored, and the span must
+ * fit into the pixmap.
+ */
+void gp_pixel_row_unpack(const gp_pixmap *src, gp_coord x, gp_coord y,
+                         gp_size w, int *const chans[]);
+
+/*
+ * Packs w pixels from per-channel arrays and writes them starting at x, y.
+ *
+ * The channel values are not clamped, they must be within the channel range.
+ */
+void gp_pixel_row_pack(gp_pixmap *dst, gp_coord x, gp_coord y,
+                       gp_size w, int *const chans[]);
+
+#endif /* CORE_GP_PIXEL_ROW_H */
@@ -27,6 +27,11 @@ struct gp_pixmap {
 	 * Row bit offset. The offset is ignored for byte aligned pixels.
 	 * Basically it's used for non aligned pixels with combination
 	 * with subpixmapes.
+	 *
+	 * For pixels smaller than byte it's the number of bits that precede
+	 * the first pixel in a row counted in the pixel order, i.e. from the
+	 * most significant bit for big bit endian. It's always multiple of
+	 * the pixel size.
 	 */
 	uint8_t offset;
 
@@ -53,6 +58,30 @@ struct gp_pixmap {
 	uint8_t y_swap:1;	/* swap direction on y */
 	uint8_t bit_endian:1;	/* GP_BIT_ENDIAN */
 	uint8_t free_pixels:1;  /* If set pixels are freed on gp_pixmap_free */
+	uint8_t mmap_pixels:1;  /* If set pixels were allocated by mmap() */
+	uint8_t file_pixels:1;  /* If set pixels are mmap()ed from a file */
+	uint8_t sub_pixmaps:1;  /* If set subpixmaps may point to the pixels */
+
+	/*
+	 * Reference counter for pixels shared copy-on-write between pixmaps
+	 * created by gp_pixmap_copy() with GP_COPY_SHARE_PIXELS. NULL if
+	 * the pixels are not shared.
+	 */
+	unsigned int *pixels_refs;
+
+	/*
+	 * Pool the pixmap was allocated from, it's returned there on
+	 * gp_pixmap_free(). NULL if not allocated from a pool.
+	 */
+	struct gp_pixmap_pool *pool;
+
+	/*
+	 * List of modified rectangles, NULL if damage tracking is disabled.
+	 * Subpixmaps share the damage with the parent pixmap.
+	 *
+	 * See gp_damage.h.
+	 */
+	struct gp_damage *damage;
 };
 
 /* Determines the address of a pixel within the pixmap's image.
@@ -70,10 +99,19 @@ struct gp_pixmap {
 /* Performs a series of sanity checks on pixmap, aborting if any fails. */
 #define GP_CHECK_PIXMAP(pixmap) do { \
 	GP_CHECK(pixmap, "NULL passed as pixmap"); \
-	GP_CHECK(pixmap->bpp <= 32, "invalid pixmap: unsupported bits-per-pixel count"); \
+	GP_CHECK(pixmap->bpp <= 64, "invalid pixmap: unsupported bits-per-pixel count"); \
 	GP_CHECK(pixmap->pixels || pixmap->w == 0 || pixmap->h == 0, "invalid pixmap: pixels NULL on nonzero w h"); \
 } while (0)
 
+/*
+ * Same as GP_CHECK_PIXMAP() but for a pixmap that is going to be modified,
+ * shared pixels are forked before the first write.
+ */
+#define GP_CHECK_PIXMAP_WR(pixmap) do { \
+	GP_CHECK_PIXMAP(pixmap); \
+	GP_PIXMAP_UNSHARE(pixmap); \
+} while (0)
+
 /*
  * Is true, when pixel is clipped out of pixmap.
  */
@@ -90,6 +128,39 @@ struct gp_pixmap {
  */
 gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type);
 
+enum gp_pixmap_alloc_flags {
+	/*
+	 * Aligns start of each row to GP_PIXMAP_ROW_ALIGNMENT bytes so that
+	 * rows can be processed by aligned SIMD loads and stores.
+	 */
+	GP_PIXMAP_ALIGN_ROWS = 0x01,
+	/*
+	 * Implies GP_PIXMAP_ALIGN_ROWS and pads the rows so that the stride is
+	 * not a multiple of GP_PIXMAP_CRITICAL_STRIDE. Otherwise pixels in a
+	 * column map into a single cache set, which slows down vertical passes.
+	 */
+	GP_PIXMAP_PAD_ROWS = 0x02,
+	/*
+	 * Pixel buffers bigger than GP_PIXMAP_HUGE_PAGES_MIN are allocated by
+	 * mmap() and the kernel is advised to back them by huge pages.
+	 */
+	GP_PIXMAP_HUGE_PAGES = 0x04,
+};
+
+#define GP_PIXMAP_ROW_ALIGNMENT 64
+#define GP_PIXMAP_CRITICAL_STRIDE 4096
+#define GP_PIXMAP_HUGE_PAGES_MIN (4 * 1024 * 1024)
+
+/*
+ * Allocate pixmap with a different pixel buffer layout and/or allocator.
+ *
+ * The flags are bitwise or of enum gp_pixmap_alloc_flags, with flags set to
+ * zero it's equivalent to gp_pixmap_alloc(). Note that the bytes_per_row may
+ * be bigger than the size of pixels in a row.
+ */
+gp_pixmap *gp_pixmap_alloc_ex(gp_size w, gp_size h, gp_pixel_type type,
+                              int flags);
+
 /*
  * Sets gamma for the pixmap.
  */
@@ -114,7 +185,9 @@ gp_pixmap *gp_pixmap_init(gp_pixmap *pixmap, gp_size w, gp_size h,
 /*
  * Resizes pixmap->pixels array and changes metadata to match the new size.
  *
- * Returns non-zero on failure (malloc() has failed).
+ * Returns non-zero on failure (malloc() has failed), the pixmap is left
+ * unchanged in that case. Pixmaps mapped from a file by gp_pixmap_mmap()
+ * cannot be resized and errno is set to ENOTSUP.
  *
  * This call only resizes the pixel array. The pixel values, after resizing,
  * are __UNINITALIZED__ use resampling filters to resize image data.
@@ -126,6 +199,15 @@ enum gp_pixmap_copy_flags {
 	GP_COPY_WITH_PIXELS   = 0x01,
 	/* Copy image rotation flags. If not set flags are set to (0, 0, 0) */
 	GP_COPY_WITH_ROTATION = 0x02,
+	/*
+	 * Share the pixels copy-on-write, implies GP_COPY_WITH_PIXELS.
+	 *
+	 * The copy is O(1), the pixels are duplicated on the first write into
+	 * either of the pixmaps. Pixmaps that do not own their pixels, e.g.
+	 * subpixmaps, pixmaps with mmap()ed pixels and pixmaps that subpixmaps
+	 * were created from are copied instead.
+	 */
+	GP_COPY_SHARE_PIXELS  = 0x04,
 };
 
 /*
@@ -133,8 +215,40 @@ enum gp_pixmap_copy_flags {
  */
 gp_pixmap *gp_pixmap_copy(const gp_pixmap *src, int flags);
 
+/*
+ * Forks pixels shared copy-on-write, use gp_pixmap_unshare() instead.
+ */
+int gp_pixmap_fork_pixels(gp_pixmap *self);
+
+/*
+ * Makes sure that the pixmap pixels are not shared with any other pixmap.
+ *
+ * All library functions that modify pixels call this on the destination. The
+ * _raw pixel access functions do not, code that writes the pixels directly
+ * has to call it before the first write.
+ *
+ * Returns zero on success, non-zero and errno on allocation failure.
+ */
+static inline int gp_pixmap_unshare(gp_pixmap *self)
+{
+	if (likely(!self->pixels_refs))
+		return 0;
+
+	return gp_pixmap_fork_pixels(self);
+}
+
+/*
+ * Used by functions that modify pixels and cannot return an error.
+ */
+#define GP_PIXMAP_UNSHARE(pixmap) \
+	GP_CHECK(!gp_pixmap_unshare(pixmap), "failed to unshare pixels")
+
 /*
  * Initalize subpixmap. The returned pointer points to passed subpixmap.
+ *
+ * If the pixmap pixels are shared they are forked first, so that writes into
+ * the subpixmap do not change the other copies. Since the subpixmap points
+ * into the pixmap pixels, the pixmap pixels are never shared afterwards.
  */
 gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
                          gp_coord x, gp_coord y, gp_size w, gp_size h);
@@ -148,24 +262,54 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 gp_pixmap *gp_sub_pixmap_alloc(const gp_pixmap *pixmap,
                                gp_coord x, gp_coord y, gp_size w, gp_size h);
 
+enum gp_pixmap_convert_flags {
+	/*
+	 * Apply ordered dithering when the destination has less than 8 bits
+	 * per channel, i.e. for RGB565, RGB555, RGB332, RGB666, G1, G2 and G4.
+	 * Conversions to other pixel types are not affected.
+	 */
+	GP_CONVERT_DITHER = 0x01,
+};
+
 /*
  * Converts pixmap to a different pixel type.
  * Returns a newly allocated pixmap.
  *
- * This is naive implementation that doesn't do any ditherings or error
- * diffusions.
+ * The conversion is done in parallel over tiles, common pixel type pairs are
+ * converted by whole rows with vectorized functions. Without dithering the
+ * channel values are truncated.
+ *
+ * Returns NULL on a failure.
  */
 gp_pixmap *gp_pixmap_convert_alloc(const gp_pixmap *src,
                                    gp_pixel_type dst_pixel_type);
 
+/*
+ * Same as gp_pixmap_convert_alloc() with flags, which is bitwise or of enum
+ * gp_pixmap_convert_flags.
+ */
+gp_pixmap *gp_pixmap_convert_alloc_ex(const gp_pixmap *src,
+                                      gp_pixel_type dst_pixel_type, int flags);
+
 /*
  * Converts pixmap to a different pixel type.
  *
- * This is naive implementation that doesn't do any ditherings or error
- * diffusions.
+ * The dst has to be at least as big as the src, see gp_pixmap_convert_alloc()
+ * for details.
+ *
+ * Returns dst, or NULL if the dithered conversion failed to allocate temporary
+ * buffers, in that case the dst is converted only partially. NULL is returned
+ * with errno set to ENOMEM as well when shared dst pixels could not be forked.
  */
 gp_pixmap *gp_pixmap_convert(const gp_pixmap *src, gp_pixmap *dst);
 
+/*
+ * Same as gp_pixmap_convert() with flags, which is bitwise or of enum
+ * gp_pixmap_convert_flags.
+ */
+gp_pixmap *gp_pixmap_convert_ex(const gp_pixmap *src, gp_pixmap *dst,
+                                int flags);
+
 /*
  * Prints pixmap information into stdout.
  */
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  File backed pixmaps.
+
+  The pixel buffer is mapped from a file so that images bigger than the
+  available memory can be processed, the paging is left to the page cache.
+
+  The files start with a header that describes the pixmap, the pixels start
+  at a page aligned offset right after the header so that the file can be
+  reopened without any copying. Headerless raw pixel files can be mapped as
+  well.
+
+ */
+
+#ifndef CORE_GP_PIXMAP_MMAP_H
+#define CORE_GP_PIXMAP_MMAP_H
+
+#include <core/gp_pixmap.h>
+
+enum gp_pixmap_mmap_flags {
+	/*
+	 * Creates the file, or truncates existing one, with a header for the
+	 * w, h and pixel type passed to the gp_pixmap_mmap().
+	 */
+	GP_PIXMAP_MMAP_CREATE = 0x01,
+	/*
+	 * Maps the file read only, writes into the pixmap crash the program.
+	 */
+	GP_PIXMAP_MMAP_RDONLY = 0x02,
+	/*
+	 * The file has no header, just rows of pixels without any padding. The
+	 * w, h and pixel type must be passed to the gp_pixmap_mmap().
+	 */
+	GP_PIXMAP_MMAP_RAW = 0x04,
+};
+
+/*
+ * Creates or opens file backed pixmap.
+ *
+ * When existing file with a header is opened the w, h and type are either
+ * zero and GP_PIXEL_UNKNOWN or have to match the values from the header.
+ *
+ * The pixels are unmapped on gp_pixmap_free(), changes are written to the file
+ * unless the file was mapped read only.
+ *
+ * Returns NULL and sets errno on a failure.
+ */
+gp_pixmap *gp_pixmap_mmap(const char *path, gp_size w, gp_size h,
+                          gp_pixel_type type, int flags);
+
+#endif /* CORE_GP_PIXMAP_MMAP_H */
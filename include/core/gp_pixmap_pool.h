@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Pixmap pool.
+
+  Recycles pixmaps together with their pixel buffers, freed pixmaps are kept
+  in the pool and handed out again for an allocation with the same width,
+  height, pixel type and row layout. This avoids malloc(), free() and page
+  faults in pipelines that allocate same sized images over and over, e.g.
+  for each video frame.
+
+  The pool can be passed explicitly to gp_pixmap_pool_alloc() or set as a
+  per-thread default. While a default pool is set all pixmaps allocated by
+  the thread, including the ones allocated by the filter _alloc variants,
+  loaders, gp_pixmap_copy() etc., are taken from the pool.
+
+  The pixmaps are returned to the pool by gp_pixmap_free(), the call can be
+  done from any thread.
+
+ */
+
+#ifndef CORE_GP_PIXMAP_POOL_H
+#define CORE_GP_PIXMAP_POOL_H
+
+#include <pthread.h>
+#include <core/gp_pixmap.h>
+
+typedef struct gp_pixmap_pool {
+	pthread_mutex_t lock;
+
+	/* Freed pixmaps, least recently used first */
+	gp_pixmap **cached;
+	unsigned int cached_cnt;
+	unsigned int cached_max;
+
+	/* Size of the cached pixel buffers and its limit in bytes */
+	size_t size;
+	size_t max_size;
+
+	/* Number of pixmaps allocated from the pool and not freed yet */
+	unsigned int pixmaps;
+	/* Number of threads that have the pool set as a default */
+	unsigned int defaults;
+	/* Set by gp_pixmap_pool_destroy() */
+	int destroyed;
+
+	/* Statistics */
+	unsigned long hits;
+	unsigned long misses;
+} gp_pixmap_pool;
+
+/*
+ * Creates a pixmap pool.
+ *
+ * The max_size is the maximal size of the pixel buffers cached in the pool
+ * in bytes, least recently freed pixmaps are released when the limit is
+ * reached.
+ *
+ * Returns NULL on allocation failure.
+ */
+gp_pixmap_pool *gp_pixmap_pool_create(size_t max_size);
+
+/*
+ * Releases all cached pixmaps and the pool.
+ *
+ * Pixmaps that were allocated from the pool and were not freed yet stay valid,
+ * the pool memory is released once the last of them is freed and once all
+ * threads that have the pool set as a default unset it. Such threads no longer
+ * reuse pixmaps after the pool has been destroyed.
+ */
+void gp_pixmap_pool_destroy(gp_pixmap_pool *self);
+
+/*
+ * Releases all pixmaps cached in the pool.
+ */
+void gp_pixmap_pool_flush(gp_pixmap_pool *self);
+
+/*
+ * Allocates a pixmap from the pool, the parameters are the same as for
+ * gp_pixmap_alloc_ex(). The pixel values are undefined.
+ */
+gp_pixmap *gp_pixmap_pool_alloc(gp_pixmap_pool *self, gp_size w, gp_size h,
+                                gp_pixel_type type, int flags);
+
+/*
+ * Sets a default pool for the calling thread, pass NULL to unset it.
+ *
+ * Returns the previous default pool or NULL if the previous pool was destroyed
+ * and freed by this call.
+ */
+gp_pixmap_pool *gp_pixmap_pool_set_default(gp_pixmap_pool *self);
+
+/*
+ * Returns the default pool for the calling thread or NULL if not set.
+ */
+gp_pixmap_pool *gp_pixmap_pool_get_default(void);
+
+/*
+ * Following functions are used by the gp_pixmap allocator.
+ *
+ * Returns a cached pixmap with matching parameters or NULL.
+ */
+gp_pixmap *gp_pixmap_pool_get(gp_pixmap_pool *self, gp_size w, gp_size h,
+                              gp_pixel_type type, uint32_t bytes_per_row,
+                              int flags);
+
+/*
+ * Marks a newly allocated pixmap as allocated from the pool.
+ */
+void gp_pixmap_pool_attach(gp_pixmap_pool *self, gp_pixmap *pixmap);
+
+/*
+ * Returns a freed pixmap into its pool.
+ *
+ * Returns zero if the pixmap was taken by the pool, non-zero if it has to be
+ * freed by the caller.
+ */
+int gp_pixmap_pool_put(gp_pixmap *pixmap);
+
+#endif /* CORE_GP_PIXMAP_POOL_H */
@@ -8,7 +8,7 @@
   Temporary block allocator implementation.
 
   Creates pool for block allocation (small ones are done on the stack, bigger
-  using malloc).
+  are borrowed from a per-thread scratch arena).
 
   The usage is:
 
@@ -47,8 +47,34 @@ struct gp_temp_alloc {
 	size_t size;
 };
 
-#define GP_TEMP_ALLOC(size) ({                                        \
-	((size) > GP_ALLOCA_THRESHOLD) ? malloc(size) : alloca(size); \
+/*
+ * Per-thread scratch arena.
+ *
+ * Each thread has its own growable arena, the buffers are borrowed and
+ * returned in LIFO order, which is the case for the scoped temp allocations
+ * below. The arena is kept between the calls so that steady-state filter
+ * calls do not allocate any memory. It's allocated by mmap() and released
+ * when the thread exits.
+ *
+ * If the request does not fit into an arena that is in use the buffer is
+ * malloc()ed and the arena grows on the next use.
+ */
+void *gp_temp_arena_get(size_t size);
+
+void gp_temp_arena_put(void *ptr, size_t size);
+
+/*
+ * Releases the calling thread arena, e.g. after an unusually big request.
+ */
+void gp_temp_arena_release(void);
+
+/*
+ * Returns the size of the calling thread arena.
+ */
+size_t gp_temp_arena_size(void);
+
+#define GP_TEMP_ALLOC(size) ({                                                 \
+	((size) > GP_ALLOCA_THRESHOLD) ? gp_temp_arena_get(size) : alloca(size); \
 })
 
 #define gp_temp_alloc_create(name, bsize)                              \
@@ -65,9 +91,9 @@ struct gp_temp_alloc {
 #define gp_temp_alloc_arr(self, type, len) \
 	gp_temp_alloc_get(self, sizeof(type) * len)
 
-#define gp_temp_alloc_free(self) do {          \
-	if (self.size > GP_ALLOCA_THRESHOLD) \
-		free(self.buffer);           \
+#define gp_temp_alloc_free(self) do {                      \
+	if (self.size > GP_ALLOCA_THRESHOLD)             \
+		gp_temp_arena_put(self.buffer, self.size); \
 } while (0)
 
 #define gp_temp_alloc(size) GP_TEMP_ALLOC(size)
@@ -75,7 +101,7 @@ struct gp_temp_alloc {
 static inline void gp_temp_free(size_t size, void *ptr)
 {
 	if (size > GP_ALLOCA_THRESHOLD)
-		free(ptr);
+		gp_temp_arena_put(ptr, size);
 }
 
 #endif /* CORE_GP_TEMP_ALLOC_H */
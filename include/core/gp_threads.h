@@ -16,6 +16,7 @@
 
 #include <core/gp_progress_callback.h>
 #include <core/gp_types.h>
+#include <core/gp_pixel.h>
 
 /*
  * Sets default number of threads the library uses
@@ -45,13 +46,182 @@ void gp_nr_threads_set(unsigned int nr);
 unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback);
 
 /*
- * Multithreaded progress callback priv data guarded by a mutex.
+ * A job to be executed by the library thread pool.
+ */
+typedef struct gp_thread_job {
+	/*
+	 * Job function, non-zero return value is treated as failure and errno
+	 * is saved and reported back by gp_thread_pool_wait().
+	 */
+	int (*fn)(void *arg);
+	void *arg;
+
+	/* Private, used by the thread pool */
+	struct gp_thread_job *next;
+	struct gp_thread_batch *batch;
+} gp_thread_job;
+
+/*
+ * A set of jobs submitted together, used to wait for their completion.
+ */
+typedef struct gp_thread_batch {
+	unsigned int pending;
+	int err;
+} gp_thread_batch;
+
+#define GP_THREAD_BATCH_INIT {.pending = 0, .err = 0}
+
+/*
+ * Queues nr jobs into the library thread pool.
+ *
+ * The pool is started lazily on first use and grows up to the number of jobs
+ * submitted at once minus one, since the calling thread executes jobs as well
+ * while it waits in gp_thread_pool_wait(). The number of pool threads is
+ * capped by the gp_nr_threads_set() and GP_THREADS settings, superfluous
+ * threads exit when the number of threads is lowered. Jobs above the number
+ * of threads are queued.
+ */
+void gp_thread_pool_submit(gp_thread_batch *batch,
+                           gp_thread_job *jobs, unsigned int nr);
+
+/*
+ * Waits for all jobs in the batch to finish.
+ *
+ * The calling thread helps to process queued jobs while waiting, so it's safe
+ * to call this from within a job function.
+ *
+ * Returns 0 on success, otherwise -1 and errno is set to the errno of a
+ * failed job.
+ */
+int gp_thread_pool_wait(gp_thread_batch *batch);
+
+/*
+ * Shorthand for submit and wait.
+ */
+int gp_thread_pool_run(gp_thread_job *jobs, unsigned int nr);
+
+/*
+ * A rectangular part of the region passed to gp_tiles_run().
+ */
+typedef struct gp_tile {
+	gp_coord x;
+	gp_coord y;
+	gp_size w;
+	gp_size h;
+} gp_tile;
+
+/*
+ * Describes a region to be processed in parallel by tiles.
+ */
+typedef struct gp_tiles {
+	/* Region size */
+	gp_size w;
+	gp_size h;
+	/* Pixel size in bits, used to compute cache friendly tile size */
+	uint8_t bpp;
+
+	/*
+	 * Operation name and pixel type used as a key for the autotuner,
+	 * the name is optional and autotuning is disabled if it's NULL.
+	 */
+	const char *name;
+	gp_pixel_type pixel_type;
+	/*
+	 * Minimal tile size, 0 == no limit. Useful to limit the overlap of
+	 * neighbouring tiles for filters that read pixels around the tile.
+	 */
+	gp_size min_w;
+	gp_size min_h;
+
+	/*
+	 * Called for each tile, when running in more than one thread the
+	 * progress is reported by the scheduler and callback is NULL.
+	 */
+	int (*fn)(const gp_tile *tile, void *priv, gp_progress_cb *callback);
+	void *priv;
+
+	gp_progress_cb *callback;
+} gp_tiles;
+
+/*
+ * Splits the region into cache sized 2D tiles and processes them in the
+ * thread pool.
+ *
+ * Each thread starts with a contiguous range of tiles and once it's done it
+ * steals half of the remaining tiles from the busiest thread, which keeps all
+ * threads busy till the end regardless of the image shape.
+ *
+ * Returns 0 on success, otherwise -1 and errno is set, ECANCELED is used when
+ * the operation was aborted from the progress callback.
+ */
+int gp_tiles_run(const gp_tiles *tiles);
+
+/*
+ * Enables or disables thread count autotuning, disabled by default.
+ *
+ * When enabled gp_tiles_run() measures per-pixel cost for each operation name
+ * and pixel type and picks the number of threads and the tile size so that
+ * each thread and each tile does a reasonable amount of work, i.e. cheap
+ * operations on small images run in a single thread while expensive ones
+ * are split even for small images.
+ *
+ * This value may also be enabled by the GP_AUTOTUNE enviroment variable.
+ */
+void gp_autotune_set(int enable);
+
+/*
+ * Saves the learned per-pixel costs into a file.
+ *
+ * Returns 0 on success, otherwise -1 and errno is set.
+ */
+int gp_autotune_save(const char *path);
+
+/*
+ * Loads per-pixel costs previously saved by gp_autotune_save(), the entries
+ * are merged into the current table.
+ *
+ * Returns 0 on success, otherwise -1 and errno is set.
+ */
+int gp_autotune_load(const char *path);
+
+/*
+ * The original callback is called at most once per this many miliseconds.
+ */
+#define GP_PROGRESS_MP_INTERVAL 20
+
+/*
+ * Per worker progress counter, aligned to a cache line so that workers do not
+ * share the cache line when updating the counters.
+ */
+typedef struct gp_progress_cb_mp_counter {
+	unsigned int val;
+} __attribute__((aligned(64))) gp_progress_cb_mp_counter;
+
+/*
+ * Multithreaded progress callback priv data.
+ *
+ * The data are accessed lock-free, workers either update their own counter by
+ * gp_progress_cb_mp_report() or pass the percentage in gp_progress_cb_mp()
+ * and whichever thread reports first after GP_PROGRESS_MP_INTERVAL aggregates
+ * the progress and calls the original callback. Non-zero return value from the
+ * original callback is sticky, i.e. all subsequent reports return 1 so that
+ * all workers abort.
  */
 struct gp_progress_cb_mp_priv {
-	float max;
-	int abort;
-	pthread_mutex_t mutex;
 	gp_progress_cb *orig_callback;
+
+	/* Per worker counters, NULL if percentage is passed in callback */
+	gp_progress_cb_mp_counter *counters;
+	unsigned int nr_counters;
+	/* Sum of the counters when all work is done */
+	unsigned int max;
+
+	/* Maximal reported percentage in hundredths of percent */
+	unsigned int percentage;
+	/* Time for next report in miliseconds */
+	uint64_t next_report;
+	int busy;
+	int abort;
 };
 
 /*
@@ -68,9 +238,6 @@ struct gp_progress_cb_mp_priv {
  */
 #define GP_PROGRESS_CALLBACK_MP(name, callback)                        \
 	struct gp_progress_cb_mp_priv name_priv = {                 \
-		.max = 0,                                              \
-		.abort = 0,                                            \
-		.mutex = PTHREAD_MUTEX_INITIALIZER,                    \
 		.orig_callback = callback,                             \
 	};                                                             \
 	GP_PROGRESS_CALLBACK(name, gp_progress_cb_mp, &name_priv);
@@ -80,4 +247,14 @@ struct gp_progress_cb_mp_priv {
  */
 int gp_progress_cb_mp(gp_progress_cb *self);
 
+/*
+ * Sets the worker counter to val and possibly calls the original callback.
+ *
+ * The priv has to be initialized with counters, nr_counters and max.
+ *
+ * Returns non-zero if the operation should be aborted.
+ */
+int gp_progress_cb_mp_report(struct gp_progress_cb_mp_priv *priv,
+                             unsigned int worker, unsigned int val);
+
 #endif /* CORE_GP_THREADS_H */
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Tiled pixmap.
+
+  The pixels are stored in square tiles instead of rows, which gives much
+  better locality for passes that go across rows, e.g. vertical convolution or
+  rotations, on wide images.
+
+  The tiles are loaded into memory on demand and kept in a LRU cache, when the
+  cache is full least recently used tiles are paged out into a swap file. This
+  allows for processing images that does not fit into the memory.
+
+  Each tile can be accessed as a gp_pixmap so that all the _raw functions work
+  on tiles as well.
+
+ */
+
+#ifndef CORE_GP_TILED_PIXMAP_H
+#define CORE_GP_TILED_PIXMAP_H
+
+#include <core/gp_pixmap.h>
+
+/*
+ * Tile size in pixels, tiles are GP_TILE_SIZE x GP_TILE_SIZE pixels, the
+ * tiles on the right and bottom edge may be only partially used.
+ */
+#define GP_TILE_SIZE 64
+
+#define GP_TILE_NONE UINT32_MAX
+
+struct gp_pixmap_tile {
+	/* NULL if tile is not loaded */
+	uint8_t *pixels;
+	/* LRU list of loaded tiles */
+	uint32_t prev;
+	uint32_t next;
+	/* Tile was modified since it was loaded */
+	uint8_t dirty:1;
+	/* Tile has a copy in the swap file */
+	uint8_t swapped:1;
+};
+
+typedef struct gp_tiled_pixmap {
+	uint32_t w;
+	uint32_t h;
+	enum gp_pixel_type pixel_type;
+	uint8_t bpp;
+	uint8_t bit_endian:1;
+
+	/* Number of tiles in each direction */
+	uint32_t tiles_w;
+	uint32_t tiles_h;
+
+	uint32_t tile_bytes_per_row;
+	size_t tile_size;
+
+	/* Maximal number of loaded tiles, zero for unlimited */
+	uint32_t cache_tiles;
+	uint32_t loaded_tiles;
+
+	/* Most and least recently used tiles */
+	uint32_t lru_head;
+	uint32_t lru_tail;
+
+	/* Swap file, created on a first page out */
+	int swap_fd;
+
+	struct gp_pixmap_tile tiles[];
+} gp_tiled_pixmap;
+
+/*
+ * Allocates a tiled pixmap, the pixels are undefined.
+ *
+ * The cache_tiles is the maximal number of tiles kept in memory, if set to
+ * zero all tiles are kept in the memory.
+ *
+ * Returns NULL and sets errno on a failure.
+ */
+gp_tiled_pixmap *gp_tiled_pixmap_alloc(gp_size w, gp_size h,
+                                       gp_pixel_type type,
+                                       uint32_t cache_tiles);
+
+/*
+ * Frees the tiled pixmap, closes the swap file.
+ */
+void gp_tiled_pixmap_free(gp_tiled_pixmap *self);
+
+enum gp_tile_access {
+	/* The tile is going to be read */
+	GP_TILE_RD = 0x01,
+	/* The tile is going to be written, marks the tile dirty */
+	GP_TILE_WR = 0x02,
+	GP_TILE_RDWR = GP_TILE_RD | GP_TILE_WR,
+};
+
+/*
+ * Loads a tile into memory and initializes the tile pixmap to point to it.
+ *
+ * The tile pixmap is valid until another tile is loaded, which may page the
+ * tile out when the cache is full.
+ *
+ * Tiles on the right and bottom edge are cropped to the tiled pixmap size.
+ *
+ * Returns NULL and sets errno if tile could not be paged in.
+ */
+gp_pixmap *gp_tiled_pixmap_tile(gp_tiled_pixmap *self, uint32_t tx,
+                                uint32_t ty, enum gp_tile_access access,
+                                gp_pixmap *tile);
+
+/*
+ * Copies a rectangle from the tiled pixmap into a pixmap and vice versa.
+ *
+ * The pixmap must have the same pixel type and the rectangles must fit both
+ * pixmaps.
+ *
+ * Returns zero on success, non-zero and errno on I/O failure.
+ */
+int gp_tiled_pixmap_get_rect(gp_tiled_pixmap *self,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             gp_pixmap *dst, gp_coord x_dst, gp_coord y_dst);
+
+int gp_tiled_pixmap_put_rect(gp_tiled_pixmap *self,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             const gp_pixmap *src,
+                             gp_coord x_src, gp_coord y_src);
+
+/*
+ * Pixel access, out of pixmap reads return 0 and writes are ignored.
+ *
+ * These are slow, process whole tiles if possible.
+ */
+gp_pixel gp_tiled_getpixel(gp_tiled_pixmap *self, gp_coord x, gp_coord y);
+
+void gp_tiled_putpixel(gp_tiled_pixmap *self, gp_coord x, gp_coord y,
+                       gp_pixel p);
+
+/*
+ * Converts a linear pixmap into a tiled one and back.
+ *
+ * Returns NULL and sets errno on a failure.
+ */
+gp_tiled_pixmap *gp_tiled_pixmap_from_pixmap(const gp_pixmap *src,
+                                             uint32_t cache_tiles);
+
+gp_pixmap *gp_tiled_pixmap_to_pixmap(gp_tiled_pixmap *self);
+
+#endif /* CORE_GP_TILED_PIXMAP_H */
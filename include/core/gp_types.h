@@ -14,8 +14,14 @@ typedef int gp_coord;
 /* Integer type for sizes i.e. w, h, ... */
 typedef unsigned int gp_size;
 
-/* Pixel integer value packed accordingly to gp_pixel_type */
-typedef uint32_t gp_pixel;
+/*
+ * Pixel integer value packed accordingly to gp_pixel_type, 64 bits so that
+ * pixel types with 16 bits per channel fit in.
+ *
+ * Changing the size of the type breaks the ABI, the library major version
+ * has to be bumped in libver.mk.
+ */
+typedef uint64_t gp_pixel;
 
 /* Pixel type description */
 typedef struct gp_pixel_type_desc gp_pixel_type_desc;
@@ -29,6 +35,12 @@ typedef struct gp_gamma gp_gamma;
 /* Progress callback */
 typedef struct gp_progress_cb gp_progress_cb;
 
+/* Pixmap damage tracking */
+typedef struct gp_damage gp_damage;
+
+/* YUV frame */
+typedef struct gp_yuv_frame gp_yuv_frame;
+
 #include <core/gp_seek.h>
 
 #endif /* CORE_GP_TYPES_H */
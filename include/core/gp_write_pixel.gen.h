@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_write_pixel.gen.h
+ *
+ * GENERATED on 2026 10 17 00:27:14 from gp_write_pixel.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_WRITE_PIXEL_GEN_H
+#define GP_WRITE_PIXEL_GEN_H
+
+/*
+ * Write Pixels generated header
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * These functions writes cnt pixels using value val starting at start address
+ * and additionally (for pixel sizes that are not aligned to the whole bytes)
+ * at off offset in the first byte (i.e. byte at the start address).
+ */
+
+void gp_write_pixels_1BPP_LE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_1BPP_BE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_2BPP_LE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_2BPP_BE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_4BPP_LE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_4BPP_BE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+void gp_write_pixels_8BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_16BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_24BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_32BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_48BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_64BPP(void *start, size_t cnt, unsigned int val);
+
+void gp_write_pixels_18BPP_LE(void *start, uint8_t off,
+                            size_t cnt, unsigned int val);
+
+#endif /* GP_WRITE_PIXEL_GEN_H */
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  YUV frames.
+
+  The YUV formats share chroma samples between neighbouring pixels, hence
+  they cannot be described by a gp_pixel_type, instead the frame is described
+  by a separate multi-plane descriptor. Frames are typically produced by
+  grabbers and kept in YUV until they are converted, and possibly scaled, into
+  a pixmap at display time.
+
+  The conversions use full range BT.601 coefficients, i.e. the same as JPEG.
+
+ */
+
+#ifndef CORE_GP_YUV_H
+#define CORE_GP_YUV_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_progress_callback.h>
+
+enum gp_yuv_format {
+	/* Packed 4:2:2, Y0 U Y1 V */
+	GP_YUV_YUYV,
+	/* Packed 4:2:2, U Y0 V Y1 */
+	GP_YUV_UYVY,
+	/* Planar 4:2:0, Y plane followed by interleaved UV plane */
+	GP_YUV_NV12,
+	/* Planar 4:2:0, Y plane followed by U and V planes */
+	GP_YUV_I420,
+	GP_YUV_MAX,
+};
+
+#define GP_YUV_MAX_PLANES 3
+
+typedef struct gp_yuv_plane {
+	uint8_t *pixels;
+	uint32_t bytes_per_row;
+} gp_yuv_plane;
+
+struct gp_yuv_frame {
+	gp_size w;
+	gp_size h;
+
+	enum gp_yuv_format format;
+
+	unsigned int plane_cnt;
+	gp_yuv_plane planes[GP_YUV_MAX_PLANES];
+
+	uint8_t free_pixels:1;
+};
+
+/*
+ * Returns format name.
+ */
+const char *gp_yuv_format_name(enum gp_yuv_format format);
+
+/*
+ * Returns size of a contiguous buffer for a frame, the planes are stored one
+ * after another as V4L2 does. If bytes_per_row is 0 the rows are not padded.
+ */
+size_t gp_yuv_frame_size(gp_size w, gp_size h, enum gp_yuv_format format,
+                         uint32_t bytes_per_row);
+
+/*
+ * Initializes frame from a contiguous buffer, the frame does not own the
+ * buffer, which is useful for wrapping memory mapped grabber buffers.
+ *
+ * The bytes_per_row is the row size of the first plane, if it's 0 the rows
+ * are not padded. The chroma planes for I420 have half of the row size.
+ *
+ * Returns the frame or NULL if the format or the row size is not valid and
+ * errno is set.
+ */
+gp_yuv_frame *gp_yuv_frame_init(gp_yuv_frame *self, gp_size w, gp_size h,
+                                enum gp_yuv_format format, void *pixels,
+                                uint32_t bytes_per_row);
+
+/*
+ * Allocates a frame with a contiguous buffer.
+ *
+ * Returns NULL on failure and errno is set.
+ */
+gp_yuv_frame *gp_yuv_frame_alloc(gp_size w, gp_size h,
+                                 enum gp_yuv_format format);
+
+/*
+ * Frees frame allocated by gp_yuv_frame_alloc().
+ */
+void gp_yuv_frame_free(gp_yuv_frame *self);
+
+/*
+ * Converts the frame into a rectangle in the dst pixmap, the frame is scaled
+ * with nearest neighbour interpolation if the sizes differ. The coordinates
+ * are raw, i.e. rotation flags are ignored, and the rectangle must fit into
+ * the pixmap.
+ *
+ * The conversion runs in parallel and the 8 bit RGB pixel types are written
+ * by SIMD code, other types are converted from RGB888.
+ *
+ * Returns zero on success, non-zero on failure or abort from the callback.
+ */
+int gp_yuv_frame_blit_scaled(const gp_yuv_frame *src, gp_pixmap *dst,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             gp_progress_cb *callback);
+
+/*
+ * Converts the frame into dst pixmap, the frame is scaled to the pixmap size.
+ */
+static inline int gp_yuv_frame_to_pixmap(const gp_yuv_frame *src,
+                                         gp_pixmap *dst,
+                                         gp_progress_cb *callback)
+{
+	return gp_yuv_frame_blit_scaled(src, dst, 0, 0, dst->w, dst->h, callback);
+}
+
+/*
+ * Allocates a pixmap of the frame size and converts the frame into it.
+ *
+ * Returns NULL on failure or abort from the callback.
+ */
+gp_pixmap *gp_yuv_frame_to_pixmap_alloc(const gp_yuv_frame *src,
+                                        gp_pixel_type pixel_type,
+                                        gp_progress_cb *callback);
+
+/*
+ * Converts pixmap into a frame of the same size, the chroma is averaged over
+ * the pixels that share it.
+ *
+ * Returns zero on success, non-zero on failure or abort from the callback.
+ */
+int gp_pixmap_to_yuv_frame(const gp_pixmap *src, gp_yuv_frame *dst,
+                           gp_progress_cb *callback);
+
+#endif /* CORE_GP_YUV_H */
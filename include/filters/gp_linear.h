@@ -12,6 +12,7 @@
 #ifndef FILTERS_GP_LINEAR_H
 #define FILTERS_GP_LINEAR_H
 
+#include <core/gp_tiled_pixmap.h>
 #include <filters/gp_filter.h>
 
 /*
@@ -71,6 +72,18 @@ int gp_filter_vlinear_convolution_raw(const gp_pixmap *src,
                                     float kernel[], uint32_t kh, float kern_div,
                                     gp_progress_cb *callback);
 
+/*
+ * Vertical convolution on tiled pixmaps.
+ *
+ * The src and dst must have the same size and pixel type, the filter does not
+ * work in-place.
+ *
+ * Returns zero on success, non-zero on I/O failure or if operation was aborted.
+ */
+int gp_filter_tiled_vconvolution(gp_tiled_pixmap *src, gp_tiled_pixmap *dst,
+                                 float kernel[], uint32_t kh, float kern_div,
+                                 gp_progress_cb *callback);
+
 /*
  * Applies both horizontal and vertical convolution and takes care of the
  * correct progress callback (both horizontal and vertical kernels are expected
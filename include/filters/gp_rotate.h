@@ -13,6 +13,7 @@
 #define FILTERS_GP_ROTATE_H
 
 #include <core/gp_types.h>
+#include <core/gp_tiled_pixmap.h>
 #include <filters/gp_filter.h>
 
 /*
@@ -122,4 +123,20 @@ gp_pixmap *gp_filter_symmetry_alloc(const gp_pixmap *src,
                                     gp_filter_symmetries symmetry,
                                     gp_progress_cb *callback);
 
+/*
+ * Symmetry filters on tiled pixmaps, the tiles are processed one by one so
+ * that only a few of them have to be loaded at a time.
+ *
+ * The source tiled pixmap is not modified, but the tiles are paged in.
+ *
+ * The filters do not work in-place.
+ */
+int gp_filter_tiled_symmetry(gp_tiled_pixmap *src, gp_tiled_pixmap *dst,
+                             gp_filter_symmetries symmetry,
+                             gp_progress_cb *callback);
+
+gp_tiled_pixmap *gp_filter_tiled_symmetry_alloc(gp_tiled_pixmap *src,
+                                                gp_filter_symmetries symmetry,
+                                                gp_progress_cb *callback);
+
 #endif /* FILTERS_GP_ROTATE_H */
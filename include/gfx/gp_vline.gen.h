@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_vline.gen.h
+ *
+ * GENERATED on 2026 10 17 00:27:13 from gp_vline.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_VLINE_GEN_H
+#define GP_VLINE_GEN_H
+
+/*
+ * VLine generated header
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+void gp_vline_raw_1BPP_LE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_1BPP_LE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_1BPP_BE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_1BPP_BE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_2BPP_LE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_2BPP_LE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_2BPP_BE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_2BPP_BE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_4BPP_LE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_4BPP_LE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_4BPP_BE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_4BPP_BE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_8BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_8BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_16BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_16BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_24BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_24BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_32BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_32BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_48BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_48BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_64BPP(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_64BPP_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+void gp_vline_raw_18BPP_LE(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+
+void gp_vline_raw_18BPP_LE_clip(gp_pixmap *pixmap, gp_coord x,
+			gp_coord y0, gp_coord y1, gp_pixel pixel);
+#endif /* GP_VLINE_GEN_H */
@@ -16,6 +16,18 @@ struct gp_grabber {
 	 */
 	struct gp_pixmap *frame;
 
+	/*
+	 * Current frame in YUV, NULL if the grabber does not produce YUV.
+	 * Updated on poll only when yuv_only is set.
+	 */
+	gp_yuv_frame *yuv_frame;
+
+	/*
+	 * If set the frame pixmap is not updated on poll and the application
+	 * converts the yuv_frame once when and where it's displayed.
+	 */
+	uint8_t yuv_only:1;
+
 	/*
 	 * Returns 0 if there are no images in queue and 1 otherwise.
 	 */
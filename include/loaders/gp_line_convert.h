@@ -9,7 +9,8 @@
   buffer B.
 
   Supports only trivial conversions i.e. RGB888 to BGR888 and G1_LE to G1_BE,
-  etc.
+  etc. and RGBA8888 to RGBA8888_PM alpha premultiplication, which can be done
+  in place as well.
 
   The code is mainly used in image loaders when saving image from memory buffer
   that has exactly same channels (in size and names) but placed differently in
@@ -185,4 +185,20 @@ int gp_loader_save_image(const gp_loader *self, const gp_pixmap *src,
  */
 void gp_loaders_lists(void);
 
+/*
+ * Enables or disables alpha premultiplication in loaders.
+ *
+ * When enabled, loaders that support it (PNG, WebP) return images with alpha
+ * channel as GP_PIXEL_RGBA8888_PM instead of GP_PIXEL_RGBA8888, which saves
+ * applications that composite the images over and over the conversion.
+ *
+ * Disabled by default.
+ */
+void gp_loader_premultiply_set(int enable);
+
+/*
+ * Returns non-zero if loaders should produce premultiplied alpha.
+ */
+int gp_loader_premultiply_get(void);
+
 #endif /* LOADERS_GP_LOADER_H */
@@ -9,6 +9,7 @@
 #include "core/gp_common.h"
 #include <core/gp_transform.h>
 #include "core/gp_pixmap.h"
+#include <core/gp_damage.h>
 #include <core/gp_debug.h>
 
 #include <input/gp_event_queue.h>
@@ -59,6 +60,28 @@ void gp_backend_update_rect_xyxy(gp_backend *self,
 	self->update_rect(self, x0, y0, x1, y1);
 }
 
+void gp_backend_update_damage(gp_backend *self)
+{
+	gp_damage *damage = self->pixmap->damage;
+	unsigned int i;
+
+	if (!damage || !self->update_rect) {
+		gp_backend_flip(self);
+		gp_pixmap_damage_clear(self->pixmap);
+		return;
+	}
+
+	GP_DEBUG(3, "Updating %u damaged rectangles", damage->rect_cnt);
+
+	for (i = 0; i < damage->rect_cnt; i++) {
+		gp_damage_rect *r = &damage->rects[i];
+
+		self->update_rect(self, r->x0, r->y0, r->x1, r->y1);
+	}
+
+	damage->rect_cnt = 0;
+}
+
 int gp_backend_resize(gp_backend *self, uint32_t w, uint32_t h)
 {
 	if (!self->set_attr)
@@ -80,12 +103,29 @@ int gp_backend_resize(gp_backend *self, uint32_t w, uint32_t h)
 
 int gp_backend_resize_ack(gp_backend *self)
 {
+	gp_damage *damage = self->pixmap->damage;
+	int ret = 0;
+
 	GP_DEBUG(2, "Calling backend %s resize_ack()", self->name);
 
+	/*
+	 * Backends may reinitialize or reallocate the pixmap, the damage
+	 * tracking is moved over to the resized pixmap. The damage list is
+	 * kept since subpixmaps of the old pixmap may still point to it.
+	 */
+	self->pixmap->damage = NULL;
+
 	if (self->resize_ack)
-		return self->resize_ack(self);
+		ret = self->resize_ack(self);
 
-	return 0;
+	if (damage) {
+		damage->pixmap = self->pixmap;
+		damage->rect_cnt = 0;
+		self->pixmap->damage = damage;
+		gp_pixmap_damage_all(self->pixmap);
+	}
+
+	return ret;
 }
 
 static uint32_t pushevent_callback(gp_timer *self)
@@ -364,19 +364,15 @@ gp_backend *gp_linux_fb_init(const char *path, int flags)
 	strcpy(fb->path, path);
 	fb->flags = flags;
 
-	if (!(flags & GP_FB_SHADOW))
-		fb->pixmap.pixels = fb->fb_mem;
-
-	fb->pixmap.w = vscri.xres;
-	fb->pixmap.h = vscri.yres;
-
-	fb->pixmap.axes_swap = 0;
-	fb->pixmap.x_swap    = 0;
-	fb->pixmap.y_swap    = 0;
+	/*
+	 * The pixmap does not own the pixels, which also means that it's
+	 * never shared copy-on-write with pixmap copies.
+	 */
+	gp_pixmap_init(&fb->pixmap, vscri.xres, vscri.yres, pixel_type,
+	               (flags & GP_FB_SHADOW) ? fb->pixmap.pixels : fb->fb_mem);
 
 	fb->pixmap.bpp = vscri.bits_per_pixel;
 	fb->pixmap.bytes_per_row  = fscri.line_length;
-	fb->pixmap.pixel_type = pixel_type;
 
 	int shadow = flags & GP_FB_SHADOW;
 	int kbd = flags & GP_FB_INPUT_KBD;
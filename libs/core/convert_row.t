@@ -0,0 +1,58 @@
+@ # Pixel types with byte aligned pixels that have whole row converters.
+@ convert_row_types = ['RGB888', 'BGR888', 'xRGB8888', 'RGBA8888', 'RGB565', 'RGB555',
+@                      'RGB332', 'G8', 'RGBA8888_PM']
+@
+@ # Pixel types with alpha are blended by the blits and are not converted,
+@ # with the exception of straight <-> premultiplied alpha conversions.
+@ def is_alpha_premultiply(src, dst):
+@     return (src.is_alpha() and dst.is_alpha() and
+@             src.is_premultiplied() != dst.is_premultiplied())
+@ end
+@
+@ def has_convert_row(src, dst):
+@     return (src.name != dst.name and
+@             (not src.is_alpha() or is_alpha_premultiply(src, dst)) and
+@             src.name in convert_row_types and dst.name in convert_row_types)
+@ end
+@
+@ # Alpha sources that are blended by rows onto the convert row types.
+@ def has_blend_row(src, dst):
+@     return (src.name in ['RGBA8888', 'RGBA8888_PM'] and not dst.is_alpha() and
+@             dst.name in convert_row_types)
+@ end
+@
+@ # Pixel types with less than 8 bits per channel that can be converted from
+@ # RGBA8888 rows with ordered dithering.
+@ def has_dither_row(pt):
+@     return ((pt.is_rgb() or pt.is_gray()) and not pt.is_alpha() and
+@             max([c.size for c in pt.chanslist]) < 8)
+@ end
+@
+@ # Access to rows of byte aligned pixels, the row pointer is stepped by
+@ # row_step() and the pixels are loaded and stored in the gp_pixel layout.
+@ def has_byte_row(pt):
+@     return pt.pixelsize.size in [8, 16, 24, 32]
+@ end
+@
+@ def row_type(pt):
+@     return {8: 'uint8_t', 16: 'uint16_t', 24: 'uint8_t', 32: 'uint32_t'}[pt.pixelsize.size]
+@ end
+@
+@ def row_step(pt):
+@     return 3 if pt.pixelsize.size == 24 else 1
+@ end
+@
+@ def load_pixel(pt, p='s'):
+@     if pt.pixelsize.size == 24:
+@         return '(%s[0] | %s[1]<<8 | %s[2]<<16)' % (p, p, p)
+@     return p + '[0]'
+@ end
+@
+@ def store_pixel(pt, p):
+@     if pt.pixelsize.size == 24:
+		d[0] = {{ p }} & 0xff;
+		d[1] = ({{ p }} >> 8) & 0xff;
+		d[2] = ({{ p }} >> 16) & 0xff;
+@     else:
+		d[0] = {{ p }};
+@ end
@@ -44,24 +44,28 @@ void gp_blit_xyxy(const gp_pixmap *src,
 	gp_blit_xyxy_fast(src, x0, y0, x1, y1, dst, x2, y2);
 }
 
-void gp_blit_xyxy_clipped(const gp_pixmap *src,
-                          gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
-                          gp_pixmap *dst, gp_coord x2, gp_coord y2)
+/*
+ * Clips the rectangles for the clipped blits, returns non-zero if there is
+ * nothing to blit.
+ */
+int gp_blit_xyxy_clip(const gp_pixmap *src,
+                      gp_coord *x0, gp_coord *y0, gp_coord *x1, gp_coord *y1,
+                      const gp_pixmap *dst, gp_coord *x2, gp_coord *y2)
 {
 	/* Normalize source rectangle */
-	if (x1 < x0)
-		GP_SWAP(x0, x1);
+	if (*x1 < *x0)
+		GP_SWAP(*x0, *x1);
 
-	if (y1 < y0)
-		GP_SWAP(y0, y1);
+	if (*y1 < *y0)
+		GP_SWAP(*y0, *y1);
 
 	/*
 	 * Handle all cases where at least one of dest coordinates are out of
 	 * the dest in positive direction -> src is out of dst completly.
 	 */
-	if (x2 >= (gp_coord) gp_pixmap_w(dst) ||
-	    y2 >= (gp_coord) gp_pixmap_h(dst))
-		return;
+	if (*x2 >= (gp_coord) gp_pixmap_w(dst) ||
+	    *y2 >= (gp_coord) gp_pixmap_h(dst))
+		return 1;
 
 	/*
 	 * The coordinates in dest are negative.
@@ -71,41 +75,55 @@ void gp_blit_xyxy_clipped(const gp_pixmap *src,
 	 * Notice that x2 and y2 are inside the dst rectangle now.
 	 * (>= 0 and < w, < h)
 	 */
-	if (x2 < 0) {
-		x0 -= x2;
-		x2 = 0;
+	if (*x2 < 0) {
+		*x0 -= *x2;
+		*x2 = 0;
 	}
 
-	if (y2 < 0) {
-		y0 -= y2;
-		y2 = 0;
+	if (*y2 < 0) {
+		*y0 -= *y2;
+		*y2 = 0;
 	}
 
 	/* Make sure souce coordinates are inside of the src */
-	x0 = GP_MAX(x0, 0);
-	y0 = GP_MAX(y0, 0);
-	x1 = GP_MIN(x1, (gp_coord) gp_pixmap_w(src) - 1);
-	y1 = GP_MIN(y1, (gp_coord) gp_pixmap_h(src) - 1);
+	*x0 = GP_MAX(*x0, 0);
+	*y0 = GP_MAX(*y0, 0);
+	*x1 = GP_MIN(*x1, (gp_coord) gp_pixmap_w(src) - 1);
+	*y1 = GP_MIN(*y1, (gp_coord) gp_pixmap_h(src) - 1);
 
 	/* And source rectangle fits inside of the destination */
-	gp_coord src_w = x1 - x0 + 1;
-	gp_coord src_h = y1 - y0 + 1;
+	gp_coord src_w = *x1 - *x0 + 1;
+	gp_coord src_h = *y1 - *y0 + 1;
 
-	gp_coord dst_w = gp_pixmap_w(dst) - x2;
-	gp_coord dst_h = gp_pixmap_h(dst) - y2;
+	gp_coord dst_w = gp_pixmap_w(dst) - *x2;
+	gp_coord dst_h = gp_pixmap_h(dst) - *y2;
 
 	GP_DEBUG(2, "Blitting %ix%i, available %ix%i",
 	         src_w, src_h, dst_w, dst_h);
 
 	if (src_w > dst_w)
-		x1 -= src_w - dst_w;
+		*x1 -= src_w - dst_w;
 
 	if (src_h > dst_h)
-		y1 -= src_h - dst_h;
+		*y1 -= src_h - dst_h;
+
+	/* Nothing left after clipping */
+	if (*x1 < *x0 || *y1 < *y0)
+		return 1;
 
 	GP_DEBUG(2, "Blitting %ix%i->%ix%i in %ux%u to %ix%i in %ux%u",
-	         x0, y0, x1, y1, gp_pixmap_w(src), gp_pixmap_h(src),
-	         x2, y2, gp_pixmap_w(dst), gp_pixmap_h(dst));
+	         *x0, *y0, *x1, *y1, gp_pixmap_w(src), gp_pixmap_h(src),
+	         *x2, *y2, gp_pixmap_w(dst), gp_pixmap_h(dst));
+
+	return 0;
+}
+
+void gp_blit_xyxy_clipped(const gp_pixmap *src,
+                          gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                          gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	if (gp_blit_xyxy_clip(src, &x0, &y0, &x1, &y1, dst, &x2, &y2))
+		return;
 
 	gp_blit_xyxy_fast(src, x0, y0, x1, y1, dst, x2, y2);
 }
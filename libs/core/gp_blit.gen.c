@@ -0,0 +1,8305 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_blit.gen.c
+ *
+ * GENERATED on 2026 10 17 02:36:50 from gp_blit.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Specialized blit functions and macros.
+ *
+ * Copyright (C) 2011      Tomas Gavenciak <gavento@ucw.cz>
+ * Copyright (C) 2011-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include "core/gp_pixmap.h"
+#include <core/gp_blit.h>
+#include <core/gp_debug.h>
+#include <core/gp_convert.h>
+#include <core/gp_convert.gen.h>
+#include <core/gp_convert_scale.gen.h>
+#include <core/gp_mix_pixels2.gen.h>
+#include <core/gp_cpu.h>
+#include <core/gp_threads.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_transform.h>
+#include <core/gp_damage.h>
+
+
+/*
+ * Used for same pixel types that are not byte aligned and bigger than byte.
+ */
+static void blit_xyxy_naive_raw(const gp_pixmap *src,
+                                gp_coord x0, gp_coord y0,
+				gp_coord x1, gp_coord y1,
+                                gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (src->pixel_type != dst->pixel_type)
+				p = gp_convert_pixmap_pixel(p, src, dst);
+
+			gp_putpixel_raw(dst, x2 + (x - x0), y2 + (y - y0), p);
+		}
+
+	}
+}
+
+/*
+ * Returns len <= 8 bits starting at bit in the LE pixel order.
+ */
+static inline unsigned int get_bits_LE(const uint8_t *src, unsigned int bit,
+                                       unsigned int len)
+{
+	unsigned int sh = bit % 8;
+	unsigned int v;
+
+	src += bit / 8;
+
+	v = src[0];
+
+	if (sh + len > 8)
+		v |= src[1] << 8;
+
+	return (v >> sh) & ((1u << len) - 1);
+}
+
+/*
+ * Merges len bits into a byte starting at bit in the LE pixel order.
+ */
+static inline void put_bits_LE(uint8_t *dst, unsigned int bit,
+                                unsigned int len, unsigned int val)
+{
+	unsigned int sh = bit;
+	unsigned int mask = ((1u << len) - 1) << sh;
+
+	*dst = (*dst & ~mask) | (val << sh);
+}
+
+/*
+ * Shifts bytes by sh bits, the src has to have one more byte.
+ */
+GP_SIMD_BODY void shift_merge_LE_body(uint8_t *restrict dst,
+                                      const uint8_t *restrict src,
+                                      unsigned int sh, gp_size bytes)
+{
+	gp_size i;
+
+	for (i = 0; i < bytes; i++)
+		dst[i] = (src[i] >> sh) | (src[i+1] << (8 - sh));
+}
+
+GP_SIMD_VARIANT
+static void shift_merge_LE_generic(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_LE_body(dst, src, sh, bytes);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void shift_merge_LE_sse2(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_LE_body(dst, src, sh, bytes);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void shift_merge_LE_avx2(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_LE_body(dst, src, sh, bytes);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void shift_merge_LE_neon(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_LE_body(dst, src, sh, bytes);
+}
+#endif
+
+static void shift_merge_LE_resolve(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes);
+
+static void (*shift_merge_LE_fn)(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes) = shift_merge_LE_resolve;
+
+static void shift_merge_LE_resolve(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes) = shift_merge_LE_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = shift_merge_LE_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = shift_merge_LE_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = shift_merge_LE_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of shift_merge_LE()", variant);
+
+	__atomic_store_n(&shift_merge_LE_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, sh, bytes);
+}
+
+static inline void shift_merge_LE(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	__atomic_load_n(&shift_merge_LE_fn, __ATOMIC_RELAXED)(dst, src, sh, bytes);
+}
+
+/*
+ * Copies len bits from src_bit to dst_bit, the bits are counted in the LE
+ * pixel order from the start of the buffers. The source and destination
+ * alignments may differ, whole destination bytes are written by shifting and
+ * merging pairs of the source bytes, the partial ones are masked.
+ */
+static void copy_bits_LE(uint8_t *dst, unsigned int dst_bit,
+                          const uint8_t *src, unsigned int src_bit,
+                          unsigned int len)
+{
+	unsigned int sh;
+	gp_size bytes;
+
+	dst += dst_bit / 8;
+	dst_bit %= 8;
+
+	if (dst_bit) {
+		unsigned int cnt = GP_MIN(8 - dst_bit, len);
+
+		put_bits_LE(dst, dst_bit, cnt, get_bits_LE(src, src_bit, cnt));
+
+		src_bit += cnt;
+		len -= cnt;
+		dst++;
+	}
+
+	src += src_bit / 8;
+	sh = src_bit % 8;
+	bytes = len / 8;
+
+	if (sh)
+		shift_merge_LE(dst, src, sh, bytes);
+	else
+		memcpy(dst, src, bytes);
+
+	if (len % 8) {
+		put_bits_LE(dst + bytes, 0, len % 8,
+		             get_bits_LE(src + bytes, sh, len % 8));
+	}
+}
+
+/*
+ * Returns len <= 8 bits starting at bit in the BE pixel order.
+ */
+static inline unsigned int get_bits_BE(const uint8_t *src, unsigned int bit,
+                                       unsigned int len)
+{
+	unsigned int sh = bit % 8;
+	unsigned int v;
+
+	src += bit / 8;
+
+	v = src[0] << 8;
+
+	if (sh + len > 8)
+		v |= src[1];
+
+	return (v >> (16 - sh - len)) & ((1u << len) - 1);
+}
+
+/*
+ * Merges len bits into a byte starting at bit in the BE pixel order.
+ */
+static inline void put_bits_BE(uint8_t *dst, unsigned int bit,
+                                unsigned int len, unsigned int val)
+{
+	unsigned int sh = 8 - bit - len;
+	unsigned int mask = ((1u << len) - 1) << sh;
+
+	*dst = (*dst & ~mask) | (val << sh);
+}
+
+/*
+ * Shifts bytes by sh bits, the src has to have one more byte.
+ */
+GP_SIMD_BODY void shift_merge_BE_body(uint8_t *restrict dst,
+                                      const uint8_t *restrict src,
+                                      unsigned int sh, gp_size bytes)
+{
+	gp_size i;
+
+	for (i = 0; i < bytes; i++)
+		dst[i] = (src[i] << sh) | (src[i+1] >> (8 - sh));
+}
+
+GP_SIMD_VARIANT
+static void shift_merge_BE_generic(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_BE_body(dst, src, sh, bytes);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void shift_merge_BE_sse2(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_BE_body(dst, src, sh, bytes);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void shift_merge_BE_avx2(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_BE_body(dst, src, sh, bytes);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void shift_merge_BE_neon(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	shift_merge_BE_body(dst, src, sh, bytes);
+}
+#endif
+
+static void shift_merge_BE_resolve(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes);
+
+static void (*shift_merge_BE_fn)(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes) = shift_merge_BE_resolve;
+
+static void shift_merge_BE_resolve(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes) = shift_merge_BE_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = shift_merge_BE_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = shift_merge_BE_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = shift_merge_BE_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of shift_merge_BE()", variant);
+
+	__atomic_store_n(&shift_merge_BE_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, sh, bytes);
+}
+
+static inline void shift_merge_BE(uint8_t *restrict dst, const uint8_t *restrict src, unsigned int sh, gp_size bytes)
+{
+	__atomic_load_n(&shift_merge_BE_fn, __ATOMIC_RELAXED)(dst, src, sh, bytes);
+}
+
+/*
+ * Copies len bits from src_bit to dst_bit, the bits are counted in the BE
+ * pixel order from the start of the buffers. The source and destination
+ * alignments may differ, whole destination bytes are written by shifting and
+ * merging pairs of the source bytes, the partial ones are masked.
+ */
+static void copy_bits_BE(uint8_t *dst, unsigned int dst_bit,
+                          const uint8_t *src, unsigned int src_bit,
+                          unsigned int len)
+{
+	unsigned int sh;
+	gp_size bytes;
+
+	dst += dst_bit / 8;
+	dst_bit %= 8;
+
+	if (dst_bit) {
+		unsigned int cnt = GP_MIN(8 - dst_bit, len);
+
+		put_bits_BE(dst, dst_bit, cnt, get_bits_BE(src, src_bit, cnt));
+
+		src_bit += cnt;
+		len -= cnt;
+		dst++;
+	}
+
+	src += src_bit / 8;
+	sh = src_bit % 8;
+	bytes = len / 8;
+
+	if (sh)
+		shift_merge_BE(dst, src, sh, bytes);
+	else
+		memcpy(dst, src, bytes);
+
+	if (len % 8) {
+		put_bits_BE(dst + bytes, 0, len % 8,
+		             get_bits_BE(src + bytes, sh, len % 8));
+	}
+}
+
+/*
+ * Blit for equal pixel types 1BPP_LE
+ */
+static void blitXYXY_Raw_1BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 1 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 1 * x0;
+	unsigned int dst_bit = dst->offset + 1 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_LE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 1BPP_BE
+ */
+static void blitXYXY_Raw_1BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 1 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 1 * x0;
+	unsigned int dst_bit = dst->offset + 1 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_BE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 2BPP_LE
+ */
+static void blitXYXY_Raw_2BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 2 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 2 * x0;
+	unsigned int dst_bit = dst->offset + 2 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_LE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 2BPP_BE
+ */
+static void blitXYXY_Raw_2BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 2 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 2 * x0;
+	unsigned int dst_bit = dst->offset + 2 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_BE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 4BPP_LE
+ */
+static void blitXYXY_Raw_4BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 4 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 4 * x0;
+	unsigned int dst_bit = dst->offset + 4 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_LE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 4BPP_BE
+ */
+static void blitXYXY_Raw_4BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rectangles may not be bit-aligned in the same way! */
+	gp_coord y;
+	unsigned int len = 4 * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + 4 * x0;
+	unsigned int dst_bit = dst->offset + 4 * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_BE(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+}
+
+/*
+ * Blit for equal pixel types 8BPP
+ */
+static void blitXYXY_Raw_8BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_8BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_8BPP(src, x0, y0 + y),
+		       1 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 16BPP
+ */
+static void blitXYXY_Raw_16BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_16BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_16BPP(src, x0, y0 + y),
+		       2 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 24BPP
+ */
+static void blitXYXY_Raw_24BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_24BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_24BPP(src, x0, y0 + y),
+		       3 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 32BPP
+ */
+static void blitXYXY_Raw_32BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_32BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_32BPP(src, x0, y0 + y),
+		       4 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 48BPP
+ */
+static void blitXYXY_Raw_48BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_48BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_48BPP(src, x0, y0 + y),
+		       6 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 64BPP
+ */
+static void blitXYXY_Raw_64BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_64BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_64BPP(src, x0, y0 + y),
+		       8 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 18BPP_LE
+ */
+static void blitXYXY_Raw_18BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Large areas are split into tiles and blitted in parallel, common pixel type
+ * pairs are converted or blended by whole rows with vectorized functions,
+ * the rest is blitted per pixel.
+ */
+#define BLIT_ROWS_MP_PIXELS (256 * 256)
+
+typedef void (*blit_raw_fn)(const gp_pixmap *src,
+                            gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                            gp_pixmap *dst, gp_coord x2, gp_coord y2);
+
+struct blit_rows {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	gp_coord x0, y0;
+	gp_coord x2, y2;
+	gp_convert_row_fn row_fn;
+	blit_raw_fn blit_fn;
+};
+
+static int blit_rows_tile(const gp_tile *tile, void *priv,
+                          gp_progress_cb *callback)
+{
+	struct blit_rows *rows = priv;
+	const gp_pixmap *src = rows->src;
+	gp_pixmap *dst = rows->dst;
+	gp_coord x0 = rows->x0 + tile->x, y0 = rows->y0 + tile->y;
+	gp_coord x2 = rows->x2 + tile->x, y2 = rows->y2 + tile->y;
+	gp_size y;
+
+	(void) callback;
+
+	if (!rows->row_fn) {
+		rows->blit_fn(src, x0, y0, x0 + tile->w - 1, y0 + tile->h - 1,
+		              dst, x2, y2);
+		return 0;
+	}
+
+	const uint8_t *s = src->pixels + y0 * src->bytes_per_row + x0 * (src->bpp / 8);
+	uint8_t *d = dst->pixels + y2 * dst->bytes_per_row + x2 * (dst->bpp / 8);
+
+	for (y = 0; y < tile->h; y++) {
+		rows->row_fn(d, s, tile->w);
+		s += src->bytes_per_row;
+		d += dst->bytes_per_row;
+	}
+
+	return 0;
+}
+
+static void blit_xyxy_rows_raw(const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0,
+                               gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                               gp_convert_row_fn row_fn, blit_raw_fn blit_fn)
+{
+	struct blit_rows rows = {
+		.src = src, .dst = dst,
+		.x0 = x0, .y0 = y0,
+		.x2 = x2, .y2 = y2,
+		.row_fn = row_fn,
+		.blit_fn = blit_fn,
+	};
+	gp_tiles tiles = {
+		.w = x1 - x0 + 1,
+		.h = y1 - y0 + 1,
+		.bpp = dst->bpp,
+		.name = row_fn ? "blit_rows" : "blit_pixels",
+		.pixel_type = dst->pixel_type,
+		.fn = blit_rows_tile,
+		.priv = &rows,
+	};
+
+	if ((size_t)tiles.w * tiles.h < BLIT_ROWS_MP_PIXELS) {
+		gp_tile tile = {.w = tiles.w, .h = tiles.h};
+
+		GP_CHECK(!blit_rows_tile(&tile, &rows, NULL), "failed to blit");
+		return;
+	}
+
+	/* Pixels smaller than byte may share bytes, split only rows */
+	if (dst->bpp % 8)
+		tiles.min_w = tiles.w;
+
+	GP_CHECK(!gp_tiles_run(&tiles), "failed to blit");
+}
+
+/*
+ * Generate Blits, I know this is n^2 variants but the gain is in speed is
+ * more than 50% and the size footprint for two for cycles is really small.
+ */
+/*
+ * Blits xRGB8888 to RGB666
+ */
+static void blitXYXY_Raw_xRGB8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to CMYK8888
+ */
+static void blitXYXY_Raw_xRGB8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G1
+ */
+static void blitXYXY_Raw_xRGB8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G2
+ */
+static void blitXYXY_Raw_xRGB8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G4
+ */
+static void blitXYXY_Raw_xRGB8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to GA88
+ */
+static void blitXYXY_Raw_xRGB8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G16
+ */
+static void blitXYXY_Raw_xRGB8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB161616
+ */
+static void blitXYXY_Raw_xRGB8888_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGBA16161616
+ */
+static void blitXYXY_Raw_xRGB8888_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB666
+ */
+static void blitXYXY_Raw_RGBA8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G1
+ */
+static void blitXYXY_Raw_RGBA8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G1(p1, p2);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G2
+ */
+static void blitXYXY_Raw_RGBA8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G2(p1, p2);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G4
+ */
+static void blitXYXY_Raw_RGBA8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G4(p1, p2);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to GA88
+ */
+static void blitXYXY_Raw_RGBA8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_GA88(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G16
+ */
+static void blitXYXY_Raw_RGBA8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB161616
+ */
+static void blitXYXY_Raw_RGBA8888_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_48BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGB161616(p1, p2);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGBA8888_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_64BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_RGBA16161616(p1, p2);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB666
+ */
+static void blitXYXY_Raw_RGB888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G1
+ */
+static void blitXYXY_Raw_RGB888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G2
+ */
+static void blitXYXY_Raw_RGB888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G4
+ */
+static void blitXYXY_Raw_RGB888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to GA88
+ */
+static void blitXYXY_Raw_RGB888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G16
+ */
+static void blitXYXY_Raw_RGB888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB161616
+ */
+static void blitXYXY_Raw_RGB888_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB888_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB666
+ */
+static void blitXYXY_Raw_BGR888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to CMYK8888
+ */
+static void blitXYXY_Raw_BGR888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G1
+ */
+static void blitXYXY_Raw_BGR888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G2
+ */
+static void blitXYXY_Raw_BGR888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G4
+ */
+static void blitXYXY_Raw_BGR888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to GA88
+ */
+static void blitXYXY_Raw_BGR888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G16
+ */
+static void blitXYXY_Raw_BGR888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB161616
+ */
+static void blitXYXY_Raw_BGR888_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGBA16161616
+ */
+static void blitXYXY_Raw_BGR888_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB666
+ */
+static void blitXYXY_Raw_RGB555_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB555_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G1
+ */
+static void blitXYXY_Raw_RGB555_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G2
+ */
+static void blitXYXY_Raw_RGB555_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G4
+ */
+static void blitXYXY_Raw_RGB555_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to GA88
+ */
+static void blitXYXY_Raw_RGB555_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G16
+ */
+static void blitXYXY_Raw_RGB555_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB161616
+ */
+static void blitXYXY_Raw_RGB555_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB555_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB666
+ */
+static void blitXYXY_Raw_RGB565_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB565_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G1
+ */
+static void blitXYXY_Raw_RGB565_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G2
+ */
+static void blitXYXY_Raw_RGB565_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G4
+ */
+static void blitXYXY_Raw_RGB565_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to GA88
+ */
+static void blitXYXY_Raw_RGB565_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G16
+ */
+static void blitXYXY_Raw_RGB565_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB161616
+ */
+static void blitXYXY_Raw_RGB565_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB565_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB666_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB666_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB888
+ */
+static void blitXYXY_Raw_RGB666_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to BGR888
+ */
+static void blitXYXY_Raw_RGB666_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB555
+ */
+static void blitXYXY_Raw_RGB666_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB565
+ */
+static void blitXYXY_Raw_RGB666_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB332
+ */
+static void blitXYXY_Raw_RGB666_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB666_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G1
+ */
+static void blitXYXY_Raw_RGB666_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G2
+ */
+static void blitXYXY_Raw_RGB666_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G4
+ */
+static void blitXYXY_Raw_RGB666_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G8
+ */
+static void blitXYXY_Raw_RGB666_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to GA88
+ */
+static void blitXYXY_Raw_RGB666_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G16
+ */
+static void blitXYXY_Raw_RGB666_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB666_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB161616
+ */
+static void blitXYXY_Raw_RGB666_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB666_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB666
+ */
+static void blitXYXY_Raw_RGB332_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB332_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G1
+ */
+static void blitXYXY_Raw_RGB332_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G2
+ */
+static void blitXYXY_Raw_RGB332_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G4
+ */
+static void blitXYXY_Raw_RGB332_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to GA88
+ */
+static void blitXYXY_Raw_RGB332_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G16
+ */
+static void blitXYXY_Raw_RGB332_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB161616
+ */
+static void blitXYXY_Raw_RGB332_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB332_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to xRGB8888
+ */
+static void blitXYXY_Raw_CMYK8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB888
+ */
+static void blitXYXY_Raw_CMYK8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to BGR888
+ */
+static void blitXYXY_Raw_CMYK8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB555
+ */
+static void blitXYXY_Raw_CMYK8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB565
+ */
+static void blitXYXY_Raw_CMYK8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB666
+ */
+static void blitXYXY_Raw_CMYK8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB332
+ */
+static void blitXYXY_Raw_CMYK8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G1
+ */
+static void blitXYXY_Raw_CMYK8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G2
+ */
+static void blitXYXY_Raw_CMYK8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G4
+ */
+static void blitXYXY_Raw_CMYK8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G8
+ */
+static void blitXYXY_Raw_CMYK8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to GA88
+ */
+static void blitXYXY_Raw_CMYK8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G16
+ */
+static void blitXYXY_Raw_CMYK8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB161616
+ */
+static void blitXYXY_Raw_CMYK8888_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA16161616
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to xRGB8888
+ */
+static void blitXYXY_Raw_G1_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGBA8888
+ */
+static void blitXYXY_Raw_G1_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB888
+ */
+static void blitXYXY_Raw_G1_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to BGR888
+ */
+static void blitXYXY_Raw_G1_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB555
+ */
+static void blitXYXY_Raw_G1_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB565
+ */
+static void blitXYXY_Raw_G1_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB666
+ */
+static void blitXYXY_Raw_G1_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB332
+ */
+static void blitXYXY_Raw_G1_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to CMYK8888
+ */
+static void blitXYXY_Raw_G1_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G2
+ */
+static void blitXYXY_Raw_G1_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G4
+ */
+static void blitXYXY_Raw_G1_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G8
+ */
+static void blitXYXY_Raw_G1_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to GA88
+ */
+static void blitXYXY_Raw_G1_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G16
+ */
+static void blitXYXY_Raw_G1_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G1_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB161616
+ */
+static void blitXYXY_Raw_G1_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGBA16161616
+ */
+static void blitXYXY_Raw_G1_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to xRGB8888
+ */
+static void blitXYXY_Raw_G2_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGBA8888
+ */
+static void blitXYXY_Raw_G2_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB888
+ */
+static void blitXYXY_Raw_G2_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to BGR888
+ */
+static void blitXYXY_Raw_G2_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB555
+ */
+static void blitXYXY_Raw_G2_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB565
+ */
+static void blitXYXY_Raw_G2_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB666
+ */
+static void blitXYXY_Raw_G2_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB332
+ */
+static void blitXYXY_Raw_G2_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to CMYK8888
+ */
+static void blitXYXY_Raw_G2_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G1
+ */
+static void blitXYXY_Raw_G2_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G4
+ */
+static void blitXYXY_Raw_G2_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G8
+ */
+static void blitXYXY_Raw_G2_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to GA88
+ */
+static void blitXYXY_Raw_G2_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G16
+ */
+static void blitXYXY_Raw_G2_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G2_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB161616
+ */
+static void blitXYXY_Raw_G2_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGBA16161616
+ */
+static void blitXYXY_Raw_G2_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to xRGB8888
+ */
+static void blitXYXY_Raw_G4_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGBA8888
+ */
+static void blitXYXY_Raw_G4_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB888
+ */
+static void blitXYXY_Raw_G4_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to BGR888
+ */
+static void blitXYXY_Raw_G4_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB555
+ */
+static void blitXYXY_Raw_G4_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB565
+ */
+static void blitXYXY_Raw_G4_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB666
+ */
+static void blitXYXY_Raw_G4_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB332
+ */
+static void blitXYXY_Raw_G4_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to CMYK8888
+ */
+static void blitXYXY_Raw_G4_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G1
+ */
+static void blitXYXY_Raw_G4_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G2
+ */
+static void blitXYXY_Raw_G4_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G8
+ */
+static void blitXYXY_Raw_G4_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to GA88
+ */
+static void blitXYXY_Raw_G4_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G16
+ */
+static void blitXYXY_Raw_G4_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G4_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB161616
+ */
+static void blitXYXY_Raw_G4_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGBA16161616
+ */
+static void blitXYXY_Raw_G4_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB666
+ */
+static void blitXYXY_Raw_G8_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to CMYK8888
+ */
+static void blitXYXY_Raw_G8_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G1
+ */
+static void blitXYXY_Raw_G8_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G2
+ */
+static void blitXYXY_Raw_G8_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G4
+ */
+static void blitXYXY_Raw_G8_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to GA88
+ */
+static void blitXYXY_Raw_G8_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G16
+ */
+static void blitXYXY_Raw_G8_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB161616
+ */
+static void blitXYXY_Raw_G8_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGBA16161616
+ */
+static void blitXYXY_Raw_G8_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to xRGB8888
+ */
+static void blitXYXY_Raw_GA88_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_xRGB8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA8888
+ */
+static void blitXYXY_Raw_GA88_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGBA8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB888
+ */
+static void blitXYXY_Raw_GA88_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to BGR888
+ */
+static void blitXYXY_Raw_GA88_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_BGR888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB555
+ */
+static void blitXYXY_Raw_GA88_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB555(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB565
+ */
+static void blitXYXY_Raw_GA88_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB565(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB666
+ */
+static void blitXYXY_Raw_GA88_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB332
+ */
+static void blitXYXY_Raw_GA88_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB332(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to CMYK8888
+ */
+static void blitXYXY_Raw_GA88_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G1
+ */
+static void blitXYXY_Raw_GA88_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G1(p1, p2);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G2
+ */
+static void blitXYXY_Raw_GA88_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G2(p1, p2);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G4
+ */
+static void blitXYXY_Raw_GA88_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G4(p1, p2);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G8
+ */
+static void blitXYXY_Raw_GA88_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G8(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G16
+ */
+static void blitXYXY_Raw_GA88_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_GA88_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGBA8888_PM(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB161616
+ */
+static void blitXYXY_Raw_GA88_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_48BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGB161616(p1, p2);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA16161616
+ */
+static void blitXYXY_Raw_GA88_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			p2 = gp_getpixel_raw_64BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_GA88_RGBA16161616(p1, p2);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to xRGB8888
+ */
+static void blitXYXY_Raw_G16_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA8888
+ */
+static void blitXYXY_Raw_G16_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB888
+ */
+static void blitXYXY_Raw_G16_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to BGR888
+ */
+static void blitXYXY_Raw_G16_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB555
+ */
+static void blitXYXY_Raw_G16_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB565
+ */
+static void blitXYXY_Raw_G16_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB666
+ */
+static void blitXYXY_Raw_G16_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB332
+ */
+static void blitXYXY_Raw_G16_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to CMYK8888
+ */
+static void blitXYXY_Raw_G16_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G1
+ */
+static void blitXYXY_Raw_G16_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G2
+ */
+static void blitXYXY_Raw_G16_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G4
+ */
+static void blitXYXY_Raw_G16_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G8
+ */
+static void blitXYXY_Raw_G16_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to GA88
+ */
+static void blitXYXY_Raw_G16_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G16_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB161616
+ */
+static void blitXYXY_Raw_G16_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB161616(p2, p3);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA16161616
+ */
+static void blitXYXY_Raw_G16_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB666
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G1
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_G1(p1, p2);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G2
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_G2(p1, p2);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G4
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_G4(p1, p2);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to GA88
+ */
+static void blitXYXY_Raw_RGBA8888_PM_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_GA88(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G16
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB161616
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_48BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_RGB161616(p1, p2);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGBA16161616
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			p2 = gp_getpixel_raw_64BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA8888_PM_RGBA16161616(p1, p2);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB161616_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB161616_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGB888
+ */
+static void blitXYXY_Raw_RGB161616_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to BGR888
+ */
+static void blitXYXY_Raw_RGB161616_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGB555
+ */
+static void blitXYXY_Raw_RGB161616_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGB565
+ */
+static void blitXYXY_Raw_RGB161616_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGB666
+ */
+static void blitXYXY_Raw_RGB161616_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGB332
+ */
+static void blitXYXY_Raw_RGB161616_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB161616_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to G1
+ */
+static void blitXYXY_Raw_RGB161616_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to G2
+ */
+static void blitXYXY_Raw_RGB161616_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to G4
+ */
+static void blitXYXY_Raw_RGB161616_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to G8
+ */
+static void blitXYXY_Raw_RGB161616_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to GA88
+ */
+static void blitXYXY_Raw_RGB161616_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to G16
+ */
+static void blitXYXY_Raw_RGB161616_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB161616_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB161616 to RGBA16161616
+ */
+static void blitXYXY_Raw_RGB161616_RGBA16161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_48BPP(src, x, y);
+			GP_PIXEL_RGB161616_TO_RGB161616(p1, p2);
+			GP_PIXEL_RGB161616_TO_RGBA16161616(p2, p3);
+			gp_putpixel_raw_64BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to xRGB8888
+ */
+static void blitXYXY_Raw_RGBA16161616_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_xRGB8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGBA8888
+ */
+static void blitXYXY_Raw_RGBA16161616_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGBA8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB888
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to BGR888
+ */
+static void blitXYXY_Raw_RGBA16161616_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_BGR888(p1, p2);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB555
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB555(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB565
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB565(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB666
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB666(p1, p2);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB332
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB332(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA16161616_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_CMYK8888(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to G1
+ */
+static void blitXYXY_Raw_RGBA16161616_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_G1(p1, p2);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to G2
+ */
+static void blitXYXY_Raw_RGBA16161616_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_G2(p1, p2);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to G4
+ */
+static void blitXYXY_Raw_RGBA16161616_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_G4(p1, p2);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to G8
+ */
+static void blitXYXY_Raw_RGBA16161616_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_G8(p1, p2);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to GA88
+ */
+static void blitXYXY_Raw_RGBA16161616_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_GA88(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to G16
+ */
+static void blitXYXY_Raw_RGBA16161616_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_G16(p1, p2);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGBA16161616_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGBA8888_PM(p1, p2);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA16161616 to RGB161616
+ */
+static void blitXYXY_Raw_RGBA16161616_RGB161616(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_64BPP(src, x, y);
+			p2 = gp_getpixel_raw_48BPP(dst, dx, dy);
+			p3 = gp_mix_pixels_RGBA16161616_RGB161616(p1, p2);
+			gp_putpixel_raw_48BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+
+static void blit_xyxy_same_raw(const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0,
+                               gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	GP_FN_PER_BPP(blitXYXY_Raw, src->bpp, src->bit_endian,
+	              src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+static blit_raw_fn blit_raw_fn_get(gp_pixel_type src_type, gp_pixel_type dst_type)
+{
+	switch (src_type) {
+	case GP_PIXEL_xRGB8888:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_xRGB8888_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_xRGB8888_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_xRGB8888_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_xRGB8888_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_xRGB8888_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_xRGB8888_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_xRGB8888_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_xRGB8888_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_xRGB8888_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGBA8888_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGBA8888_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGBA8888_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGBA8888_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGBA8888_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGBA8888_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGBA8888_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGBA8888_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGBA8888_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGB888_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB888_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB888_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB888_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB888_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB888_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB888_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGB888_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB888_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_BGR888_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_BGR888_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_BGR888_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_BGR888_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_BGR888_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_BGR888_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_BGR888_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_BGR888_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_BGR888_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGB555_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB555_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB555_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB555_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB555_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB555_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB555_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGB555_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB555_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGB565_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB565_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB565_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB565_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB565_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB565_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB565_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGB565_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB565_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB666:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_RGB666_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_RGB666_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_RGB666_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_RGB666_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_RGB666_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_RGB666_RGB565;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_RGB666_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB666_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB666_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB666_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB666_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_RGB666_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB666_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB666_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_RGB666_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGB666_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB666_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGB332_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB332_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB332_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB332_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB332_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB332_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB332_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGB332_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB332_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_CMYK8888:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_CMYK8888_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_CMYK8888_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_CMYK8888_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_CMYK8888_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_CMYK8888_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_CMYK8888_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_CMYK8888_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_CMYK8888_RGB332;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_CMYK8888_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_CMYK8888_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_CMYK8888_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_CMYK8888_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_CMYK8888_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_CMYK8888_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_CMYK8888_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_CMYK8888_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_CMYK8888_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_G1:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_G1_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_G1_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_G1_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_G1_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_G1_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_G1_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_G1_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_G1_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_G1_CMYK8888;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_G1_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_G1_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_G1_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_G1_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_G1_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_G1_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_G1_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_G1_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_G2:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_G2_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_G2_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_G2_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_G2_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_G2_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_G2_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_G2_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_G2_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_G2_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_G2_G1;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_G2_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_G2_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_G2_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_G2_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_G2_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_G2_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_G2_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_G4:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_G4_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_G4_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_G4_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_G4_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_G4_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_G4_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_G4_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_G4_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_G4_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_G4_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_G4_G2;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_G4_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_G4_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_G4_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_G4_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_G4_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_G4_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_G8_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_G8_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_G8_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_G8_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_G8_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_G8_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_G8_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_G8_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_G8_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_GA88_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_GA88_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_GA88_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_GA88_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_GA88_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_GA88_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_GA88_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_GA88_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_GA88_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_GA88_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_GA88_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_GA88_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_GA88_G8;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_GA88_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_GA88_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_GA88_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_GA88_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_G16:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_G16_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_G16_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_G16_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_G16_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_G16_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_G16_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_G16_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_G16_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_G16_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_G16_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_G16_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_G16_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_G16_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_G16_GA88;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_G16_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_G16_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_G16_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst_type) {
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGBA8888_PM_RGB666;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGBA8888_PM_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGBA8888_PM_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGBA8888_PM_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGBA8888_PM_G4;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGBA8888_PM_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGBA8888_PM_G16;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGBA8888_PM_RGB161616;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGBA8888_PM_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGB161616:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_RGB161616_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_RGB161616_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_RGB161616_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_RGB161616_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_RGB161616_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_RGB161616_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGB161616_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_RGB161616_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGB161616_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGB161616_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGB161616_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGB161616_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_RGB161616_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGB161616_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGB161616_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_RGB161616_RGBA8888_PM;
+		case GP_PIXEL_RGBA16161616:
+			return blitXYXY_Raw_RGB161616_RGBA16161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	case GP_PIXEL_RGBA16161616:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return blitXYXY_Raw_RGBA16161616_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return blitXYXY_Raw_RGBA16161616_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return blitXYXY_Raw_RGBA16161616_RGB888;
+		case GP_PIXEL_BGR888:
+			return blitXYXY_Raw_RGBA16161616_BGR888;
+		case GP_PIXEL_RGB555:
+			return blitXYXY_Raw_RGBA16161616_RGB555;
+		case GP_PIXEL_RGB565:
+			return blitXYXY_Raw_RGBA16161616_RGB565;
+		case GP_PIXEL_RGB666:
+			return blitXYXY_Raw_RGBA16161616_RGB666;
+		case GP_PIXEL_RGB332:
+			return blitXYXY_Raw_RGBA16161616_RGB332;
+		case GP_PIXEL_CMYK8888:
+			return blitXYXY_Raw_RGBA16161616_CMYK8888;
+		case GP_PIXEL_G1:
+			return blitXYXY_Raw_RGBA16161616_G1;
+		case GP_PIXEL_G2:
+			return blitXYXY_Raw_RGBA16161616_G2;
+		case GP_PIXEL_G4:
+			return blitXYXY_Raw_RGBA16161616_G4;
+		case GP_PIXEL_G8:
+			return blitXYXY_Raw_RGBA16161616_G8;
+		case GP_PIXEL_GA88:
+			return blitXYXY_Raw_RGBA16161616_GA88;
+		case GP_PIXEL_G16:
+			return blitXYXY_Raw_RGBA16161616_G16;
+		case GP_PIXEL_RGBA8888_PM:
+			return blitXYXY_Raw_RGBA16161616_RGBA8888_PM;
+		case GP_PIXEL_RGB161616:
+			return blitXYXY_Raw_RGBA16161616_RGB161616;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst_type));
+		}
+	break;
+	default:
+		GP_ABORT("Invalid source pixel %s",
+		         gp_pixel_type_name(src_type));
+	}
+}
+
+void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_convert_row_fn row_fn = NULL;
+	blit_raw_fn blit_fn;
+
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy_raw(dst, x2, y2, x2 + x1 - x0, y2 + y1 - y0);
+
+	/* Same pixel type, could be (mostly) optimized to memcpy() */
+	if (src->pixel_type == dst->pixel_type) {
+		blit_xyxy_rows_raw(src, x0, y0, x1, y1, dst, x2, y2,
+		                   NULL, blit_xyxy_same_raw);
+		return;
+	}
+
+	/* Whole row converters and compositors for common pixel type pairs */
+	row_fn = gp_convert_row_get(src->pixel_type, dst->pixel_type);
+	if (!row_fn)
+		row_fn = gp_blend_row_get(src->pixel_type, dst->pixel_type);
+
+	/* Specialized per pixel functions for the rest */
+	blit_fn = row_fn ? NULL : blit_raw_fn_get(src->pixel_type, dst->pixel_type);
+
+	blit_xyxy_rows_raw(src, x0, y0, x1, y1, dst, x2, y2, row_fn, blit_fn);
+}
+
+/*
+ * Blits between pixmaps with different rotation flags.
+ *
+ * The rectangles are converted into raw coordinates and the rest of the
+ * rotation is described relatively to the source, i.e. raw source pixel
+ * (i, j) in the rectangle is swapped to (j, i) if swap is set and then
+ * mirrored in the destination rectangle. Rows are then either copied or
+ * reversed, or if the axes are swapped, transposed in blocks, hence the cost
+ * is close to the unrotated blit.
+ */
+struct transform {
+	uint8_t swap;
+	uint8_t x_swap;
+	uint8_t y_swap;
+};
+
+#define TRANSFORM_BLOCK_W 64
+
+#ifdef __clang__
+# define SHUFFLE(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+# define SHUFFLE(a, b, ...) __builtin_shuffle(a, b, (__typeof__(a)){__VA_ARGS__})
+#endif
+
+typedef uint8_t v_8BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 16x16 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_8BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_8BPP r[16], t[16];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+	memcpy(&r[4], src + 4 * src_step, 16);
+	memcpy(&r[5], src + 5 * src_step, 16);
+	memcpy(&r[6], src + 6 * src_step, 16);
+	memcpy(&r[7], src + 7 * src_step, 16);
+	memcpy(&r[8], src + 8 * src_step, 16);
+	memcpy(&r[9], src + 9 * src_step, 16);
+	memcpy(&r[10], src + 10 * src_step, 16);
+	memcpy(&r[11], src + 11 * src_step, 16);
+	memcpy(&r[12], src + 12 * src_step, 16);
+	memcpy(&r[13], src + 13 * src_step, 16);
+	memcpy(&r[14], src + 14 * src_step, 16);
+	memcpy(&r[15], src + 15 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[1] = SHUFFLE(r[0], r[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[2] = SHUFFLE(r[1], r[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[3] = SHUFFLE(r[1], r[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[4] = SHUFFLE(r[2], r[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[5] = SHUFFLE(r[2], r[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[6] = SHUFFLE(r[3], r[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[7] = SHUFFLE(r[3], r[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[8] = SHUFFLE(r[4], r[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[9] = SHUFFLE(r[4], r[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[10] = SHUFFLE(r[5], r[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[11] = SHUFFLE(r[5], r[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[12] = SHUFFLE(r[6], r[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[13] = SHUFFLE(r[6], r[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[14] = SHUFFLE(r[7], r[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[15] = SHUFFLE(r[7], r[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	r[0] = SHUFFLE(t[0], t[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[1] = SHUFFLE(t[0], t[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[2] = SHUFFLE(t[1], t[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[3] = SHUFFLE(t[1], t[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[4] = SHUFFLE(t[2], t[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[5] = SHUFFLE(t[2], t[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[6] = SHUFFLE(t[3], t[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[7] = SHUFFLE(t[3], t[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[8] = SHUFFLE(t[4], t[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[9] = SHUFFLE(t[4], t[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[10] = SHUFFLE(t[5], t[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[11] = SHUFFLE(t[5], t[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[12] = SHUFFLE(t[6], t[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[13] = SHUFFLE(t[6], t[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[14] = SHUFFLE(t[7], t[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[15] = SHUFFLE(t[7], t[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	t[0] = SHUFFLE(r[0], r[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[1] = SHUFFLE(r[0], r[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[2] = SHUFFLE(r[1], r[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[3] = SHUFFLE(r[1], r[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[4] = SHUFFLE(r[2], r[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[5] = SHUFFLE(r[2], r[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[6] = SHUFFLE(r[3], r[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[7] = SHUFFLE(r[3], r[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[8] = SHUFFLE(r[4], r[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[9] = SHUFFLE(r[4], r[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[10] = SHUFFLE(r[5], r[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[11] = SHUFFLE(r[5], r[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[12] = SHUFFLE(r[6], r[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[13] = SHUFFLE(r[6], r[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[14] = SHUFFLE(r[7], r[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[15] = SHUFFLE(r[7], r[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	r[0] = SHUFFLE(t[0], t[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[1] = SHUFFLE(t[0], t[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[2] = SHUFFLE(t[1], t[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[3] = SHUFFLE(t[1], t[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[4] = SHUFFLE(t[2], t[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[5] = SHUFFLE(t[2], t[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[6] = SHUFFLE(t[3], t[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[7] = SHUFFLE(t[3], t[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[8] = SHUFFLE(t[4], t[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[9] = SHUFFLE(t[4], t[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[10] = SHUFFLE(t[5], t[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[11] = SHUFFLE(t[5], t[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[12] = SHUFFLE(t[6], t[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[13] = SHUFFLE(t[6], t[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[14] = SHUFFLE(t[7], t[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[15] = SHUFFLE(t[7], t[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	memcpy(dst + 0 * dst_step, &r[0], 16);
+	memcpy(dst + 1 * dst_step, &r[1], 16);
+	memcpy(dst + 2 * dst_step, &r[2], 16);
+	memcpy(dst + 3 * dst_step, &r[3], 16);
+	memcpy(dst + 4 * dst_step, &r[4], 16);
+	memcpy(dst + 5 * dst_step, &r[5], 16);
+	memcpy(dst + 6 * dst_step, &r[6], 16);
+	memcpy(dst + 7 * dst_step, &r[7], 16);
+	memcpy(dst + 8 * dst_step, &r[8], 16);
+	memcpy(dst + 9 * dst_step, &r[9], 16);
+	memcpy(dst + 10 * dst_step, &r[10], 16);
+	memcpy(dst + 11 * dst_step, &r[11], 16);
+	memcpy(dst + 12 * dst_step, &r[12], 16);
+	memcpy(dst + 13 * dst_step, &r[13], 16);
+	memcpy(dst + 14 * dst_step, &r[14], 16);
+	memcpy(dst + 15 * dst_step, &r[15], 16);
+}
+
+typedef uint16_t v_16BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 8x8 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_16BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_16BPP r[8], t[8];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+	memcpy(&r[4], src + 4 * src_step, 16);
+	memcpy(&r[5], src + 5 * src_step, 16);
+	memcpy(&r[6], src + 6 * src_step, 16);
+	memcpy(&r[7], src + 7 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[1] = SHUFFLE(r[0], r[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[2] = SHUFFLE(r[1], r[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[3] = SHUFFLE(r[1], r[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[4] = SHUFFLE(r[2], r[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[5] = SHUFFLE(r[2], r[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[6] = SHUFFLE(r[3], r[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[7] = SHUFFLE(r[3], r[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	r[0] = SHUFFLE(t[0], t[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[1] = SHUFFLE(t[0], t[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[2] = SHUFFLE(t[1], t[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[3] = SHUFFLE(t[1], t[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[4] = SHUFFLE(t[2], t[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[5] = SHUFFLE(t[2], t[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[6] = SHUFFLE(t[3], t[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[7] = SHUFFLE(t[3], t[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	t[0] = SHUFFLE(r[0], r[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[1] = SHUFFLE(r[0], r[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[2] = SHUFFLE(r[1], r[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[3] = SHUFFLE(r[1], r[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[4] = SHUFFLE(r[2], r[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[5] = SHUFFLE(r[2], r[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[6] = SHUFFLE(r[3], r[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[7] = SHUFFLE(r[3], r[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	memcpy(dst + 0 * dst_step, &t[0], 16);
+	memcpy(dst + 1 * dst_step, &t[1], 16);
+	memcpy(dst + 2 * dst_step, &t[2], 16);
+	memcpy(dst + 3 * dst_step, &t[3], 16);
+	memcpy(dst + 4 * dst_step, &t[4], 16);
+	memcpy(dst + 5 * dst_step, &t[5], 16);
+	memcpy(dst + 6 * dst_step, &t[6], 16);
+	memcpy(dst + 7 * dst_step, &t[7], 16);
+}
+
+typedef uint32_t v_32BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 4x4 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_32BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_32BPP r[4], t[4];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[2], 0, 4, 1, 5);
+	t[1] = SHUFFLE(r[0], r[2], 2, 6, 3, 7);
+	t[2] = SHUFFLE(r[1], r[3], 0, 4, 1, 5);
+	t[3] = SHUFFLE(r[1], r[3], 2, 6, 3, 7);
+
+	r[0] = SHUFFLE(t[0], t[2], 0, 4, 1, 5);
+	r[1] = SHUFFLE(t[0], t[2], 2, 6, 3, 7);
+	r[2] = SHUFFLE(t[1], t[3], 0, 4, 1, 5);
+	r[3] = SHUFFLE(t[1], t[3], 2, 6, 3, 7);
+
+	memcpy(dst + 0 * dst_step, &r[0], 16);
+	memcpy(dst + 1 * dst_step, &r[1], 16);
+	memcpy(dst + 2 * dst_step, &r[2], 16);
+	memcpy(dst + 3 * dst_step, &r[3], 16);
+}
+
+typedef uint64_t v_64BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 2x2 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_64BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_64BPP r[2], t[2];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[1], 0, 2);
+	t[1] = SHUFFLE(r[0], r[1], 1, 3);
+
+	memcpy(dst + 0 * dst_step, &t[0], 16);
+	memcpy(dst + 1 * dst_step, &t[1], 16);
+}
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 8 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_8BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 8 <= n; x += 8) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 8) * 1, 8);
+		v = __builtin_bswap64(v);
+		memcpy(dst + x * 1, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 1, src + (n - x - 1) * 1, 1);
+}
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 4 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_16BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 4 <= n; x += 4) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 4) * 2, 8);
+		v = __builtin_bswap64(v);
+		v = ((v >> 8) & 0x00ff00ff00ff00ffull) | ((v & 0x00ff00ff00ff00ffull) << 8);
+		memcpy(dst + x * 2, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 2, src + (n - x - 1) * 2, 2);
+}
+
+static void reverse_row_24BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 3;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 3);
+		dst += 3;
+		src -= 3;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_32BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint32_t *d = (void*)dst;
+	const uint32_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_32BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_32BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_32BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_32BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_32BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_resolve;
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_32BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_32BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_32BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_32BPP()", variant);
+
+	__atomic_store_n(&reverse_row_32BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_32BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_32BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+static void reverse_row_48BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 6;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 6);
+		dst += 6;
+		src -= 6;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_64BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint64_t *d = (void*)dst;
+	const uint64_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_64BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_64BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_64BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_64BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_64BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_resolve;
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_64BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_64BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_64BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_64BPP()", variant);
+
+	__atomic_store_n(&reverse_row_64BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_64BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_64BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+static void blit_transform_1BPP_LE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_1BPP_LE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_1BPP_LE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform_1BPP_BE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_1BPP_BE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_1BPP_BE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform_2BPP_LE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_2BPP_LE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_2BPP_LE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform_2BPP_BE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_2BPP_BE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_2BPP_BE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform_4BPP_LE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_4BPP_LE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_4BPP_LE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform_4BPP_BE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_4BPP_BE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_4BPP_BE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_8BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 1 || di == -1) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 1);
+			else
+				reverse_row_8BPP(d + j * dj - ((ptrdiff_t)w - 1) * 1, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j + 16 <= (ptrdiff_t)h; j += 16) {
+			for (i = bi; i + 16 <= i1; i += 16) {
+				if (dj > 0) {
+					transpose_8BPP(d + i * di + j * dj, di,
+					               s + j * s_bpr + i * 1, s_bpr);
+				} else {
+					transpose_8BPP(d + i * di + (j + 15) * dj, di,
+					               s + (j + 15) * s_bpr + i * 1, -s_bpr);
+				}
+			}
+
+			for (; i < i1; i++) {
+				ptrdiff_t k;
+
+				for (k = j; k < j + 16; k++)
+					memcpy(d + i * di + k * dj, s + k * s_bpr + i * 1, 1);
+			}
+		}
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 1, 1);
+		}
+	}
+}
+
+static void blit_transform_8BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -1 : 1;
+	} else {
+		di = t->x_swap ? -1 : 1;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_8BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_8BPP((const uint8_t*)GP_PIXEL_ADDR_8BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_16BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 2 || di == -2) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 2);
+			else
+				reverse_row_16BPP(d + j * dj - ((ptrdiff_t)w - 1) * 2, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j + 8 <= (ptrdiff_t)h; j += 8) {
+			for (i = bi; i + 8 <= i1; i += 8) {
+				if (dj > 0) {
+					transpose_16BPP(d + i * di + j * dj, di,
+					               s + j * s_bpr + i * 2, s_bpr);
+				} else {
+					transpose_16BPP(d + i * di + (j + 7) * dj, di,
+					               s + (j + 7) * s_bpr + i * 2, -s_bpr);
+				}
+			}
+
+			for (; i < i1; i++) {
+				ptrdiff_t k;
+
+				for (k = j; k < j + 8; k++)
+					memcpy(d + i * di + k * dj, s + k * s_bpr + i * 2, 2);
+			}
+		}
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 2, 2);
+		}
+	}
+}
+
+static void blit_transform_16BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -2 : 2;
+	} else {
+		di = t->x_swap ? -2 : 2;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_16BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_16BPP((const uint8_t*)GP_PIXEL_ADDR_16BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_24BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 3 || di == -3) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 3);
+			else
+				reverse_row_24BPP(d + j * dj - ((ptrdiff_t)w - 1) * 3, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 3, 3);
+		}
+	}
+}
+
+static void blit_transform_24BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -3 : 3;
+	} else {
+		di = t->x_swap ? -3 : 3;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_24BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_24BPP((const uint8_t*)GP_PIXEL_ADDR_24BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_32BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 4 || di == -4) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 4);
+			else
+				reverse_row_32BPP(d + j * dj - ((ptrdiff_t)w - 1) * 4, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j + 4 <= (ptrdiff_t)h; j += 4) {
+			for (i = bi; i + 4 <= i1; i += 4) {
+				if (dj > 0) {
+					transpose_32BPP(d + i * di + j * dj, di,
+					               s + j * s_bpr + i * 4, s_bpr);
+				} else {
+					transpose_32BPP(d + i * di + (j + 3) * dj, di,
+					               s + (j + 3) * s_bpr + i * 4, -s_bpr);
+				}
+			}
+
+			for (; i < i1; i++) {
+				ptrdiff_t k;
+
+				for (k = j; k < j + 4; k++)
+					memcpy(d + i * di + k * dj, s + k * s_bpr + i * 4, 4);
+			}
+		}
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 4, 4);
+		}
+	}
+}
+
+static void blit_transform_32BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -4 : 4;
+	} else {
+		di = t->x_swap ? -4 : 4;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_32BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_32BPP((const uint8_t*)GP_PIXEL_ADDR_32BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_48BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 6 || di == -6) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 6);
+			else
+				reverse_row_48BPP(d + j * dj - ((ptrdiff_t)w - 1) * 6, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 6, 6);
+		}
+	}
+}
+
+static void blit_transform_48BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -6 : 6;
+	} else {
+		di = t->x_swap ? -6 : 6;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_48BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_48BPP((const uint8_t*)GP_PIXEL_ADDR_48BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+/*
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
+ */
+static void transform_64BPP(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
+{
+	ptrdiff_t i, j, bi, i1;
+
+	/* Rows stay rows, copy or reverse them */
+	if (di == 8 || di == -8) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * 8);
+			else
+				reverse_row_64BPP(d + j * dj - ((ptrdiff_t)w - 1) * 8, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+
+		for (; j + 2 <= (ptrdiff_t)h; j += 2) {
+			for (i = bi; i + 2 <= i1; i += 2) {
+				if (dj > 0) {
+					transpose_64BPP(d + i * di + j * dj, di,
+					               s + j * s_bpr + i * 8, s_bpr);
+				} else {
+					transpose_64BPP(d + i * di + (j + 1) * dj, di,
+					               s + (j + 1) * s_bpr + i * 8, -s_bpr);
+				}
+			}
+
+			for (; i < i1; i++) {
+				ptrdiff_t k;
+
+				for (k = j; k < j + 2; k++)
+					memcpy(d + i * di + k * dj, s + k * s_bpr + i * 8, 8);
+			}
+		}
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * 8, 8);
+		}
+	}
+}
+
+static void blit_transform_64BPP(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -8 : 8;
+	} else {
+		di = t->x_swap ? -8 : 8;
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_64BPP(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_64BPP((const uint8_t*)GP_PIXEL_ADDR_64BPP(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+}
+
+static void blit_transform_18BPP_LE(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_18BPP_LE(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_18BPP_LE(src, x0 + i, y0 + j));
+		}
+	}
+}
+
+static void blit_transform(const gp_pixmap *src, gp_coord x0, gp_coord y0,
+                           gp_size w, gp_size h,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                           const struct transform *t)
+{
+	GP_FN_PER_BPP_PIXMAP(blit_transform, src, src, x0, y0, w, h,
+	                     dst, x2, y2, t);
+}
+
+/*
+ * Returns upper left corner of a w x h subrectangle at i, j of the source
+ * rectangle in the destination rectangle.
+ */
+static void transform_sub_rect(const struct transform *t, gp_size w, gp_size h,
+                               gp_coord i, gp_coord j, gp_size sw, gp_size sh,
+                               gp_coord *a, gp_coord *b)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+
+	*a = t->swap ? j : i;
+	*b = t->swap ? i : j;
+
+	if (t->x_swap)
+		*a = dw - *a - (t->swap ? sh : sw);
+
+	if (t->y_swap)
+		*b = dh - *b - (t->swap ? sw : sh);
+}
+
+/*
+ * Maps destination back to the source, i.e. mirrors first and swaps then.
+ */
+static struct transform transform_inverse(const struct transform *t)
+{
+	struct transform ret = {
+		.swap = t->swap,
+		.x_swap = t->swap ? t->y_swap : t->x_swap,
+		.y_swap = t->swap ? t->x_swap : t->y_swap,
+	};
+
+	return ret;
+}
+
+struct blit_transform_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	/* Source raw rectangle */
+	gp_coord x0, y0;
+	gp_size w, h;
+	/* Destination raw rectangle upper left corner */
+	gp_coord x2, y2;
+	struct transform t;
+	/* Pixel type conversion, both NULL for the same pixel types */
+	gp_convert_row_fn row_fn;
+	blit_raw_fn blit_fn;
+	/* Conversion reads destination pixels */
+	int blend;
+};
+
+/*
+ * Converted strips of source rows are transformed into the destination.
+ */
+#define TRANSFORM_STRIP 16
+
+static int blit_transform_convert(const struct blit_transform_priv *bt,
+                                  const gp_tile *tile)
+{
+	const gp_pixmap *src = bt->src;
+	gp_pixel_type type = bt->dst->pixel_type;
+	struct transform inv = transform_inverse(&bt->t);
+	size_t size = (size_t)GP_CALC_ROW_SIZE(type, tile->w) * TRANSFORM_STRIP;
+	gp_coord sx = bt->x0 + tile->x;
+	gp_size j, y, sh;
+	gp_coord a, b;
+	gp_pixmap tmp;
+	void *buf;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		return 1;
+	}
+
+	for (j = 0; j < tile->h; j += sh) {
+		gp_coord sy = bt->y0 + tile->y + j;
+
+		sh = GP_MIN((gp_size)TRANSFORM_STRIP, tile->h - j);
+
+		gp_pixmap_init(&tmp, tile->w, sh, type, buf);
+		tmp.bit_endian = bt->dst->bit_endian;
+
+		transform_sub_rect(&bt->t, bt->w, bt->h, tile->x, tile->y + j,
+		                   tile->w, sh, &a, &b);
+		a += bt->x2;
+		b += bt->y2;
+
+		if (bt->blend) {
+			blit_transform(bt->dst, a, b,
+			               bt->t.swap ? sh : tile->w,
+			               bt->t.swap ? tile->w : sh,
+			               &tmp, 0, 0, &inv);
+		}
+
+		if (bt->row_fn) {
+			const uint8_t *s = src->pixels + sy * src->bytes_per_row + sx * (src->bpp / 8);
+
+			for (y = 0; y < sh; y++) {
+				bt->row_fn(tmp.pixels + y * tmp.bytes_per_row, s, tile->w);
+				s += src->bytes_per_row;
+			}
+		} else {
+			bt->blit_fn(src, sx, sy, sx + tile->w - 1, sy + sh - 1,
+			            &tmp, 0, 0);
+		}
+
+		blit_transform(&tmp, 0, 0, tile->w, sh, bt->dst, a, b, &bt->t);
+	}
+
+	gp_temp_free(size, buf);
+	return 0;
+}
+
+static int blit_transform_tile(const gp_tile *tile, void *priv,
+                               gp_progress_cb *callback)
+{
+	const struct blit_transform_priv *bt = priv;
+	gp_coord a, b;
+
+	(void) callback;
+
+	if (bt->row_fn || bt->blit_fn)
+		return blit_transform_convert(bt, tile);
+
+	transform_sub_rect(&bt->t, bt->w, bt->h, tile->x, tile->y,
+	                   tile->w, tile->h, &a, &b);
+
+	blit_transform(bt->src, bt->x0 + tile->x, bt->y0 + tile->y,
+	               tile->w, tile->h, bt->dst, bt->x2 + a, bt->y2 + b, &bt->t);
+
+	return 0;
+}
+
+static void blit_xyxy_transform_raw(const gp_pixmap *src,
+                                    gp_coord x0, gp_coord y0,
+                                    gp_size w, gp_size h,
+                                    gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                    const struct transform *t)
+{
+	struct blit_transform_priv bt = {
+		.src = src, .dst = dst,
+		.x0 = x0, .y0 = y0,
+		.w = w, .h = h,
+		.x2 = x2, .y2 = y2,
+		.t = *t,
+	};
+	gp_tiles tiles = {
+		.w = w,
+		.h = h,
+		.bpp = dst->bpp,
+		.name = "blit_transform",
+		.pixel_type = dst->pixel_type,
+		.fn = blit_transform_tile,
+		.priv = &bt,
+	};
+
+	if (src->pixel_type != dst->pixel_type) {
+		bt.row_fn = gp_convert_row_get(src->pixel_type, dst->pixel_type);
+
+		if (!bt.row_fn) {
+			bt.row_fn = gp_blend_row_get(src->pixel_type, dst->pixel_type);
+			bt.blend = !!bt.row_fn;
+		}
+
+		if (!bt.row_fn) {
+			bt.blit_fn = blit_raw_fn_get(src->pixel_type, dst->pixel_type);
+			bt.blend = gp_pixel_has_flags(src->pixel_type, GP_PIXEL_HAS_ALPHA);
+		}
+	}
+
+	if ((size_t)w * h < BLIT_ROWS_MP_PIXELS) {
+		gp_tile tile = {.w = w, .h = h};
+
+		GP_CHECK(!blit_transform_tile(&tile, &bt, NULL), "failed to blit");
+		return;
+	}
+
+	/*
+	 * Pixels smaller than byte may share bytes, split only the source
+	 * rectangle in the direction of the destination rows.
+	 */
+	if (dst->bpp % 8) {
+		if (t->swap)
+			tiles.min_h = h;
+		else
+			tiles.min_w = w;
+	}
+
+	GP_CHECK(!gp_tiles_run(&tiles), "failed to blit");
+}
+
+void gp_blit_xyxy_fast(const gp_pixmap *src,
+                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_size w = x1 - x0 + 1, h = y1 - y0 + 1;
+	struct transform t;
+
+	GP_DEBUG(2, "Blitting %s -> %s",
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy(dst, x2, y2, x2 + x1 - x0, y2 + y1 - y0);
+
+	/* The macro expects the rectangle size in variables named w and h */
+	{
+		gp_size sw = w, sh = h;
+
+		GP_TRANSFORM_RECT(dst, x2, y2, w, h);
+		w = sw;
+		h = sh;
+	}
+
+	GP_TRANSFORM_RECT(src, x0, y0, w, h);
+
+	t.swap = src->axes_swap ^ dst->axes_swap;
+	t.x_swap = dst->x_swap ^ (t.swap ? src->y_swap : src->x_swap);
+	t.y_swap = dst->y_swap ^ (t.swap ? src->x_swap : src->y_swap);
+
+	/* The rotations cancel out, blit the raw rectangles */
+	if (!t.swap && !t.x_swap && !t.y_swap) {
+		gp_blit_xyxy_raw_fast(src, x0, y0, x0 + w - 1, y0 + h - 1,
+		                      dst, x2, y2);
+		return;
+	}
+
+	blit_xyxy_transform_raw(src, x0, y0, w, h, dst, x2, y2, &t);
+}
@@ -1,4 +1,5 @@
 @ include source.t
+@ include convert_row.t
 /*
  * Specialized blit functions and macros.
  *
@@ -17,9 +18,16 @@
 #include <core/gp_convert.gen.h>
 #include <core/gp_convert_scale.gen.h>
 #include <core/gp_mix_pixels2.gen.h>
+#include <core/gp_cpu.h>
+#include <core/gp_threads.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_transform.h>
+#include <core/gp_damage.h>
+
+@ include simd.t
 
 /*
- * TODO: this is used for same pixel but different offset, could still be optimized
+ * Used for same pixel types that are not byte aligned and bigger than byte.
  */
 static void blit_xyxy_naive_raw(const gp_pixmap *src,
                                 gp_coord x0, gp_coord y0,
@@ -41,6 +49,113 @@ static void blit_xyxy_naive_raw(const gp_pixmap *src,
 	}
 }
 
+@ for e in ['LE', 'BE']:
+@     if e == 'LE':
+@         merge = '(src[i] >> sh) | (src[i+1] << (8 - sh))'
+@     else:
+@         merge = '(src[i] << sh) | (src[i+1] >> (8 - sh))'
+@     end
+/*
+ * Returns len <= 8 bits starting at bit in the {{ e }} pixel order.
+ */
+static inline unsigned int get_bits_{{ e }}(const uint8_t *src, unsigned int bit,
+                                       unsigned int len)
+{
+	unsigned int sh = bit % 8;
+	unsigned int v;
+
+	src += bit / 8;
+
+@     if e == 'LE':
+	v = src[0];
+
+	if (sh + len > 8)
+		v |= src[1] << 8;
+
+	return (v >> sh) & ((1u << len) - 1);
+@     else:
+	v = src[0] << 8;
+
+	if (sh + len > 8)
+		v |= src[1];
+
+	return (v >> (16 - sh - len)) & ((1u << len) - 1);
+@     end
+}
+
+/*
+ * Merges len bits into a byte starting at bit in the {{ e }} pixel order.
+ */
+static inline void put_bits_{{ e }}(uint8_t *dst, unsigned int bit,
+                                unsigned int len, unsigned int val)
+{
+@     if e == 'LE':
+	unsigned int sh = bit;
+@     else:
+	unsigned int sh = 8 - bit - len;
+@     end
+	unsigned int mask = ((1u << len) - 1) << sh;
+
+	*dst = (*dst & ~mask) | (val << sh);
+}
+
+/*
+ * Shifts bytes by sh bits, the src has to have one more byte.
+ */
+GP_SIMD_BODY void shift_merge_{{ e }}_body(uint8_t *restrict dst,
+                                      const uint8_t *restrict src,
+                                      unsigned int sh, gp_size bytes)
+{
+	gp_size i;
+
+	for (i = 0; i < bytes; i++)
+		dst[i] = {{ merge }};
+}
+
+{@ simd_function('void', 'shift_merge_' + e, [('uint8_t *restrict', 'dst'), ('const uint8_t *restrict', 'src'), ('unsigned int', 'sh'), ('gp_size', 'bytes')]) @}
+
+/*
+ * Copies len bits from src_bit to dst_bit, the bits are counted in the {{ e }}
+ * pixel order from the start of the buffers. The source and destination
+ * alignments may differ, whole destination bytes are written by shifting and
+ * merging pairs of the source bytes, the partial ones are masked.
+ */
+static void copy_bits_{{ e }}(uint8_t *dst, unsigned int dst_bit,
+                          const uint8_t *src, unsigned int src_bit,
+                          unsigned int len)
+{
+	unsigned int sh;
+	gp_size bytes;
+
+	dst += dst_bit / 8;
+	dst_bit %= 8;
+
+	if (dst_bit) {
+		unsigned int cnt = GP_MIN(8 - dst_bit, len);
+
+		put_bits_{{ e }}(dst, dst_bit, cnt, get_bits_{{ e }}(src, src_bit, cnt));
+
+		src_bit += cnt;
+		len -= cnt;
+		dst++;
+	}
+
+	src += src_bit / 8;
+	sh = src_bit % 8;
+	bytes = len / 8;
+
+	if (sh)
+		shift_merge_{{ e }}(dst, src, sh, bytes);
+	else
+		memcpy(dst, src, bytes);
+
+	if (len % 8) {
+		put_bits_{{ e }}(dst + bytes, 0, len % 8,
+		             get_bits_{{ e }}(src + bytes, sh, len % 8));
+	}
+}
+
+@ end
 @ for ps in pixelsizes:
 /*
  * Blit for equal pixel types {{ ps.suffix }}
@@ -57,46 +172,111 @@ static void blitXYXY_Raw_{{ ps.suffix }}(const gp_pixmap *src,
 		memcpy(GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2 + y),
 		       GP_PIXEL_ADDR_{{ ps.suffix }}(src, x0, y0 + y),
 		       {{ int(ps.size/8) }} * (x1 - x0 + 1));
-@     else:
-# if 0
+@     elif ps.size < 8:
 	/* Rectangles may not be bit-aligned in the same way! */
-	/* Alignment (index) of first bits in the first byte */
-	//TODO: This is wrong for subpixmaps where the offset
-	//      needs to be summed with pixmap->offset and moduled
-	int al1 = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x0);
-	int al2 = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x2);
-	/* Special case of the same alignment and width >=2 bytes */
-	if ((al1 == al2) && ((x1 - x0 + 1) * {{ ps.size }} >= 16)) {
-		/* Number of bits in the last partial byte */
-		int end_al = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x1);
-		GP_ASSERT(({{ ps.size }} * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
-		int copy_size = ({{ ps.size }} * (x1 - x0 + 1) - al1 - end_al) / 8;
-		/* First and last byte incident to the line */
-		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(src, x1, y1);
-		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2);
-		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(src, x1, y0);
-		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2);
-
-		gp_coord i;
-
-		for (i = 0; i < (y1 - y0 + 1); i++) {
-			if (al1 != 0)
-				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
-			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
-			if (end_al != 0)
-				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
-			p1 += src->bytes_per_row;
-			end_p1 += src->bytes_per_row;
-			p2 += dst->bytes_per_row;
-			end_p2 += dst->bytes_per_row;
-		}
-	} else /* Different bit-alignment, can't use memcpy() */
-#endif
-		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+	gp_coord y;
+	unsigned int len = {{ ps.size }} * (x1 - x0 + 1);
+	unsigned int src_bit = src->offset + {{ ps.size }} * x0;
+	unsigned int dst_bit = dst->offset + {{ ps.size }} * x2;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		copy_bits_{{ ps.bit_endian }}(dst->pixels + (y2 + y) * dst->bytes_per_row, dst_bit,
+		                src->pixels + (y0 + y) * src->bytes_per_row, src_bit,
+		                len);
+	}
+@     else:
+	blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
 @     end
 }
 
 @ end
+/*
+ * Large areas are split into tiles and blitted in parallel, common pixel type
+ * pairs are converted or blended by whole rows with vectorized functions,
+ * the rest is blitted per pixel.
+ */
+#define BLIT_ROWS_MP_PIXELS (256 * 256)
+
+typedef void (*blit_raw_fn)(const gp_pixmap *src,
+                            gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                            gp_pixmap *dst, gp_coord x2, gp_coord y2);
+
+struct blit_rows {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	gp_coord x0, y0;
+	gp_coord x2, y2;
+	gp_convert_row_fn row_fn;
+	blit_raw_fn blit_fn;
+};
+
+static int blit_rows_tile(const gp_tile *tile, void *priv,
+                          gp_progress_cb *callback)
+{
+	struct blit_rows *rows = priv;
+	const gp_pixmap *src = rows->src;
+	gp_pixmap *dst = rows->dst;
+	gp_coord x0 = rows->x0 + tile->x, y0 = rows->y0 + tile->y;
+	gp_coord x2 = rows->x2 + tile->x, y2 = rows->y2 + tile->y;
+	gp_size y;
+
+	(void) callback;
+
+	if (!rows->row_fn) {
+		rows->blit_fn(src, x0, y0, x0 + tile->w - 1, y0 + tile->h - 1,
+		              dst, x2, y2);
+		return 0;
+	}
+
+	const uint8_t *s = src->pixels + y0 * src->bytes_per_row + x0 * (src->bpp / 8);
+	uint8_t *d = dst->pixels + y2 * dst->bytes_per_row + x2 * (dst->bpp / 8);
+
+	for (y = 0; y < tile->h; y++) {
+		rows->row_fn(d, s, tile->w);
+		s += src->bytes_per_row;
+		d += dst->bytes_per_row;
+	}
+
+	return 0;
+}
+
+static void blit_xyxy_rows_raw(const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0,
+                               gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                               gp_convert_row_fn row_fn, blit_raw_fn blit_fn)
+{
+	struct blit_rows rows = {
+		.src = src, .dst = dst,
+		.x0 = x0, .y0 = y0,
+		.x2 = x2, .y2 = y2,
+		.row_fn = row_fn,
+		.blit_fn = blit_fn,
+	};
+	gp_tiles tiles = {
+		.w = x1 - x0 + 1,
+		.h = y1 - y0 + 1,
+		.bpp = dst->bpp,
+		.name = row_fn ? "blit_rows" : "blit_pixels",
+		.pixel_type = dst->pixel_type,
+		.fn = blit_rows_tile,
+		.priv = &rows,
+	};
+
+	if ((size_t)tiles.w * tiles.h < BLIT_ROWS_MP_PIXELS) {
+		gp_tile tile = {.w = tiles.w, .h = tiles.h};
+
+		GP_CHECK(!blit_rows_tile(&tile, &rows, NULL), "failed to blit");
+		return;
+	}
+
+	/* Pixels smaller than byte may share bytes, split only rows */
+	if (dst->bpp % 8)
+		tiles.min_w = tiles.w;
+
+	GP_CHECK(!gp_tiles_run(&tiles), "failed to blit");
+}
+
 /*
  * Generate Blits, I know this is n^2 variants but the gain is in speed is
  * more than 50% and the size footprint for two for cycles is really small.
@@ -105,7 +285,7 @@ static void blitXYXY_Raw_{{ ps.suffix }}(const gp_pixmap *src,
 @     if not src.is_unknown() and not src.is_palette():
 @         for dst in pixeltypes:
 @             if not dst.is_unknown() and not dst.is_palette():
-@                 if dst.name != src.name:
+@                 if dst.name != src.name and not has_convert_row(src, dst) and not has_blend_row(src, dst):
 /*
  * Blits {{ src.name }} to {{ dst.name }}
  */
@@ -127,8 +307,8 @@ static void blitXYXY_Raw_{{ src.name }}_{{ dst.name }}(const gp_pixmap *src,
 			p2 = gp_getpixel_raw_{{ dst.pixelsize.suffix }}(dst, dx, dy);
 			p3 = gp_mix_pixels_{{ src.name }}_{{ dst.name }}(p1, p2);
 @                     else:
-			GP_PIXEL_{{ src.name }}_TO_RGB888(p1, p2);
-			GP_PIXEL_RGB888_TO_{{ dst.name }}(p2, p3);
+			GP_PIXEL_{{ src.name }}_TO_{{ conv_type(src, dst).name }}(p1, p2);
+			GP_PIXEL_{{ conv_type(src, dst).name }}_TO_{{ dst.name }}(p2, p3);
 @                     end
 			gp_putpixel_raw_{{ dst.pixelsize.suffix }}(dst, dx, dy, p3);
 		}
@@ -137,144 +317,436 @@ static void blitXYXY_Raw_{{ src.name }}_{{ dst.name }}(const gp_pixmap *src,
 
 @ end
 
-void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
-                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
-                           gp_pixmap *dst, gp_coord x2, gp_coord y2)
+static void blit_xyxy_same_raw(const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0,
+                               gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2)
 {
-	/* Same pixel type, could be (mostly) optimized to memcpy() */
-	if (src->pixel_type == dst->pixel_type) {
-		GP_FN_PER_BPP(blitXYXY_Raw, src->bpp, src->bit_endian,
-		              src, x0, y0, x1, y1, dst, x2, y2);
-		return;
-	}
+	GP_FN_PER_BPP(blitXYXY_Raw, src->bpp, src->bit_endian,
+	              src, x0, y0, x1, y1, dst, x2, y2);
+}
 
-	/* Specialized functions */
-	switch (src->pixel_type) {
+static blit_raw_fn blit_raw_fn_get(gp_pixel_type src_type, gp_pixel_type dst_type)
+{
+	switch (src_type) {
 @ for src in pixeltypes:
 @     if not src.is_unknown() and not src.is_palette():
 	case GP_PIXEL_{{ src.name }}:
-		switch (dst->pixel_type) {
+		switch (dst_type) {
 @         for dst in pixeltypes:
 @             if not dst.is_unknown() and not dst.is_palette():
-@                 if dst.name != src.name:
+@                 if dst.name != src.name and not has_convert_row(src, dst) and not has_blend_row(src, dst):
 		case GP_PIXEL_{{ dst.name }}:
-			blitXYXY_Raw_{{ src.name }}_{{ dst.name }}(src, x0, y0, x1, y1, dst, x2, y2);
-		break;
+			return blitXYXY_Raw_{{ src.name }}_{{ dst.name }};
 @         end
 		default:
 			GP_ABORT("Invalid destination pixel %s",
-			         gp_pixel_type_name(dst->pixel_type));
+			         gp_pixel_type_name(dst_type));
 		}
 	break;
 @ end
 	default:
 		GP_ABORT("Invalid source pixel %s",
-		         gp_pixel_type_name(src->pixel_type));
+		         gp_pixel_type_name(src_type));
 	}
 }
 
+void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_convert_row_fn row_fn = NULL;
+	blit_raw_fn blit_fn;
+
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy_raw(dst, x2, y2, x2 + x1 - x0, y2 + y1 - y0);
+
+	/* Same pixel type, could be (mostly) optimized to memcpy() */
+	if (src->pixel_type == dst->pixel_type) {
+		blit_xyxy_rows_raw(src, x0, y0, x1, y1, dst, x2, y2,
+		                   NULL, blit_xyxy_same_raw);
+		return;
+	}
+
+	/* Whole row converters and compositors for common pixel type pairs */
+	row_fn = gp_convert_row_get(src->pixel_type, dst->pixel_type);
+	if (!row_fn)
+		row_fn = gp_blend_row_get(src->pixel_type, dst->pixel_type);
+
+	/* Specialized per pixel functions for the rest */
+	blit_fn = row_fn ? NULL : blit_raw_fn_get(src->pixel_type, dst->pixel_type);
+
+	blit_xyxy_rows_raw(src, x0, y0, x1, y1, dst, x2, y2, row_fn, blit_fn);
+}
+
 /*
- * And the same for non-raw variants.
+ * Blits between pixmaps with different rotation flags.
+ *
+ * The rectangles are converted into raw coordinates and the rest of the
+ * rotation is described relatively to the source, i.e. raw source pixel
+ * (i, j) in the rectangle is swapped to (j, i) if swap is set and then
+ * mirrored in the destination rectangle. Rows are then either copied or
+ * reversed, or if the axes are swapped, transposed in blocks, hence the cost
+ * is close to the unrotated blit.
  */
-@ for src in pixeltypes:
-@     if not src.is_unknown() and not src.is_palette():
-@         for dst in pixeltypes:
-@             if not dst.is_unknown() and not dst.is_palette():
-@                 if dst.name != src.name:
+struct transform {
+	uint8_t swap;
+	uint8_t x_swap;
+	uint8_t y_swap;
+};
+
+#define TRANSFORM_BLOCK_W 64
+
+@ include transpose.t
+{@ transpose_functions() @}
+@ include reverse_row.t
+{@ reverse_row_functions() @}
+@ for ps in pixelsizes:
+@     if not ps.needs_bit_endian():
+@         bpp = ps.size // 8
 /*
- * Blits {{ src.name }} to {{ dst.name }}
+ * Copies w x h source pixels, the source pixel (i, j) is written to
+ * d + i * di + j * dj. One of the steps is the pixel size and the other one is
+ * the destination row size, both may be negative.
  */
-static void blitXYXY_{{ src.name }}_{{ dst.name }}(const gp_pixmap *src,
-	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
-	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+static void transform_{{ ps.suffix }}(const uint8_t *s, ptrdiff_t s_bpr,
+                              gp_size w, gp_size h,
+                              uint8_t *d, ptrdiff_t di, ptrdiff_t dj)
 {
-	gp_coord x, y, xt, yt;
+	ptrdiff_t i, j, bi, i1;
 
-	for (y = y0; y <= y1; y++)
-		for (x = x0; x <= x1; x++) {
-			gp_pixel p1, p2 = 0;
-			xt = x; yt = y;
-			GP_TRANSFORM_POINT(src, xt, yt);
-			p1 = gp_getpixel_raw_{{ src.pixelsize.suffix }}(src, xt, yt);
-			GP_PIXEL_{{ src.name }}_TO_RGB888(p1, p2);
-			GP_PIXEL_RGB888_TO_{{ dst.name }}(p2, p1);
-			xt = x2 + (x - x0);
-			yt = y2 + (y - y0);
-			GP_TRANSFORM_POINT(dst, xt, yt);
-			gp_putpixel_raw_{{ dst.pixelsize.suffix }}(dst, xt, yt, p1);
+	/* Rows stay rows, copy or reverse them */
+	if (di == {{ bpp }} || di == -{{ bpp }}) {
+		for (j = 0; j < (ptrdiff_t)h; j++) {
+			if (di > 0)
+				memcpy(d + j * dj, s, (size_t)w * {{ bpp }});
+			else
+				reverse_row_{{ ps.suffix }}(d + j * dj - ((ptrdiff_t)w - 1) * {{ bpp }}, s, w);
+
+			s += s_bpr;
+		}
+		return;
+	}
+
+	/* Rows become columns, transpose in cache sized blocks */
+	for (bi = 0; bi < (ptrdiff_t)w; bi += TRANSFORM_BLOCK_W) {
+		i1 = GP_MIN(bi + TRANSFORM_BLOCK_W, (ptrdiff_t)w);
+		j = 0;
+@         if is_vec(ps):
+@             n = 128 // ps.size
+
+		for (; j + {{ n }} <= (ptrdiff_t)h; j += {{ n }}) {
+			for (i = bi; i + {{ n }} <= i1; i += {{ n }}) {
+				if (dj > 0) {
+					transpose_{{ ps.suffix }}(d + i * di + j * dj, di,
+					               s + j * s_bpr + i * {{ bpp }}, s_bpr);
+				} else {
+					transpose_{{ ps.suffix }}(d + i * di + (j + {{ n - 1 }}) * dj, di,
+					               s + (j + {{ n - 1 }}) * s_bpr + i * {{ bpp }}, -s_bpr);
+				}
+			}
+
+			for (; i < i1; i++) {
+				ptrdiff_t k;
+
+				for (k = j; k < j + {{ n }}; k++)
+					memcpy(d + i * di + k * dj, s + k * s_bpr + i * {{ bpp }}, {{ bpp }});
+			}
 		}
+@         end
+
+		for (; j < (ptrdiff_t)h; j++) {
+			for (i = bi; i < i1; i++)
+				memcpy(d + i * di + j * dj, s + j * s_bpr + i * {{ bpp }}, {{ bpp }});
+		}
+	}
+}
+
+@     end
+static void blit_transform_{{ ps.suffix }}(const gp_pixmap *src,
+                                   gp_coord x0, gp_coord y0,
+                                   gp_size w, gp_size h,
+                                   gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                   const struct transform *t)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+@     if not ps.needs_bit_endian():
+	ptrdiff_t bpr = dst->bytes_per_row;
+	ptrdiff_t di, dj;
+	uint8_t *d;
+
+	if (t->swap) {
+		di = t->y_swap ? -bpr : bpr;
+		dj = t->x_swap ? -{{ bpp }} : {{ bpp }};
+	} else {
+		di = t->x_swap ? -{{ bpp }} : {{ bpp }};
+		dj = t->y_swap ? -bpr : bpr;
+	}
+
+	d = (uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2 + (t->x_swap ? dw - 1 : 0),
+	                                        y2 + (t->y_swap ? dh - 1 : 0));
+
+	transform_{{ ps.suffix }}((const uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(src, x0, y0),
+	                  src->bytes_per_row, w, h, d, di, dj);
+@     else:
+	gp_coord i, j, a, b;
+
+	for (j = 0; j < (gp_coord)h; j++) {
+		for (i = 0; i < (gp_coord)w; i++) {
+			a = t->swap ? j : i;
+			b = t->swap ? i : j;
+
+			if (t->x_swap)
+				a = dw - a - 1;
+
+			if (t->y_swap)
+				b = dh - b - 1;
+
+			gp_putpixel_raw_{{ ps.suffix }}(dst, x2 + a, y2 + b,
+				gp_getpixel_raw_{{ ps.suffix }}(src, x0 + i, y0 + j));
+		}
+	}
+@     end
 }
 
 @ end
+static void blit_transform(const gp_pixmap *src, gp_coord x0, gp_coord y0,
+                           gp_size w, gp_size h,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                           const struct transform *t)
+{
+	GP_FN_PER_BPP_PIXMAP(blit_transform, src, src, x0, y0, w, h,
+	                     dst, x2, y2, t);
+}
 
 /*
- * Same pixel type but with rotation.
+ * Returns upper left corner of a w x h subrectangle at i, j of the source
+ * rectangle in the destination rectangle.
  */
-@ for ps in pixelsizes:
+static void transform_sub_rect(const struct transform *t, gp_size w, gp_size h,
+                               gp_coord i, gp_coord j, gp_size sw, gp_size sh,
+                               gp_coord *a, gp_coord *b)
+{
+	gp_size dw = t->swap ? h : w;
+	gp_size dh = t->swap ? w : h;
+
+	*a = t->swap ? j : i;
+	*b = t->swap ? i : j;
+
+	if (t->x_swap)
+		*a = dw - *a - (t->swap ? sh : sw);
+
+	if (t->y_swap)
+		*b = dh - *b - (t->swap ? sw : sh);
+}
+
 /*
- * Blits for same pixel type and bpp {{ ps.suffix }}
+ * Maps destination back to the source, i.e. mirrors first and swaps then.
  */
-static void blitXYXY_{{ ps.suffix }}(const gp_pixmap *src,
-	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
-	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+static struct transform transform_inverse(const struct transform *t)
 {
-	gp_coord x, y, xt, yt;
+	struct transform ret = {
+		.swap = t->swap,
+		.x_swap = t->swap ? t->y_swap : t->x_swap,
+		.y_swap = t->swap ? t->x_swap : t->y_swap,
+	};
 
-	for (y = y0; y <= y1; y++)
-		for (x = x0; x <= x1; x++) {
-			gp_pixel p;
-			xt = x; yt = y;
-			GP_TRANSFORM_POINT(src, xt, yt);
-			p = gp_getpixel_raw_{{ ps.suffix }}(src, xt, yt);
-			xt = x2 + (x - x0);
-			yt = y2 + (y - y0);
-			GP_TRANSFORM_POINT(dst, xt, yt);
-			gp_putpixel_raw_{{ ps.suffix }}(dst, xt, yt, p);
+	return ret;
+}
+
+struct blit_transform_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	/* Source raw rectangle */
+	gp_coord x0, y0;
+	gp_size w, h;
+	/* Destination raw rectangle upper left corner */
+	gp_coord x2, y2;
+	struct transform t;
+	/* Pixel type conversion, both NULL for the same pixel types */
+	gp_convert_row_fn row_fn;
+	blit_raw_fn blit_fn;
+	/* Conversion reads destination pixels */
+	int blend;
+};
+
+/*
+ * Converted strips of source rows are transformed into the destination.
+ */
+#define TRANSFORM_STRIP 16
+
+static int blit_transform_convert(const struct blit_transform_priv *bt,
+                                  const gp_tile *tile)
+{
+	const gp_pixmap *src = bt->src;
+	gp_pixel_type type = bt->dst->pixel_type;
+	struct transform inv = transform_inverse(&bt->t);
+	size_t size = (size_t)GP_CALC_ROW_SIZE(type, tile->w) * TRANSFORM_STRIP;
+	gp_coord sx = bt->x0 + tile->x;
+	gp_size j, y, sh;
+	gp_coord a, b;
+	gp_pixmap tmp;
+	void *buf;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		return 1;
+	}
+
+	for (j = 0; j < tile->h; j += sh) {
+		gp_coord sy = bt->y0 + tile->y + j;
+
+		sh = GP_MIN((gp_size)TRANSFORM_STRIP, tile->h - j);
+
+		gp_pixmap_init(&tmp, tile->w, sh, type, buf);
+		tmp.bit_endian = bt->dst->bit_endian;
+
+		transform_sub_rect(&bt->t, bt->w, bt->h, tile->x, tile->y + j,
+		                   tile->w, sh, &a, &b);
+		a += bt->x2;
+		b += bt->y2;
+
+		if (bt->blend) {
+			blit_transform(bt->dst, a, b,
+			               bt->t.swap ? sh : tile->w,
+			               bt->t.swap ? tile->w : sh,
+			               &tmp, 0, 0, &inv);
 		}
+
+		if (bt->row_fn) {
+			const uint8_t *s = src->pixels + sy * src->bytes_per_row + sx * (src->bpp / 8);
+
+			for (y = 0; y < sh; y++) {
+				bt->row_fn(tmp.pixels + y * tmp.bytes_per_row, s, tile->w);
+				s += src->bytes_per_row;
+			}
+		} else {
+			bt->blit_fn(src, sx, sy, sx + tile->w - 1, sy + sh - 1,
+			            &tmp, 0, 0);
+		}
+
+		blit_transform(&tmp, 0, 0, tile->w, sh, bt->dst, a, b, &bt->t);
+	}
+
+	gp_temp_free(size, buf);
+	return 0;
+}
+
+static int blit_transform_tile(const gp_tile *tile, void *priv,
+                               gp_progress_cb *callback)
+{
+	const struct blit_transform_priv *bt = priv;
+	gp_coord a, b;
+
+	(void) callback;
+
+	if (bt->row_fn || bt->blit_fn)
+		return blit_transform_convert(bt, tile);
+
+	transform_sub_rect(&bt->t, bt->w, bt->h, tile->x, tile->y,
+	                   tile->w, tile->h, &a, &b);
+
+	blit_transform(bt->src, bt->x0 + tile->x, bt->y0 + tile->y,
+	               tile->w, tile->h, bt->dst, bt->x2 + a, bt->y2 + b, &bt->t);
+
+	return 0;
+}
+
+static void blit_xyxy_transform_raw(const gp_pixmap *src,
+                                    gp_coord x0, gp_coord y0,
+                                    gp_size w, gp_size h,
+                                    gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                                    const struct transform *t)
+{
+	struct blit_transform_priv bt = {
+		.src = src, .dst = dst,
+		.x0 = x0, .y0 = y0,
+		.w = w, .h = h,
+		.x2 = x2, .y2 = y2,
+		.t = *t,
+	};
+	gp_tiles tiles = {
+		.w = w,
+		.h = h,
+		.bpp = dst->bpp,
+		.name = "blit_transform",
+		.pixel_type = dst->pixel_type,
+		.fn = blit_transform_tile,
+		.priv = &bt,
+	};
+
+	if (src->pixel_type != dst->pixel_type) {
+		bt.row_fn = gp_convert_row_get(src->pixel_type, dst->pixel_type);
+
+		if (!bt.row_fn) {
+			bt.row_fn = gp_blend_row_get(src->pixel_type, dst->pixel_type);
+			bt.blend = !!bt.row_fn;
+		}
+
+		if (!bt.row_fn) {
+			bt.blit_fn = blit_raw_fn_get(src->pixel_type, dst->pixel_type);
+			bt.blend = gp_pixel_has_flags(src->pixel_type, GP_PIXEL_HAS_ALPHA);
+		}
+	}
+
+	if ((size_t)w * h < BLIT_ROWS_MP_PIXELS) {
+		gp_tile tile = {.w = w, .h = h};
+
+		GP_CHECK(!blit_transform_tile(&tile, &bt, NULL), "failed to blit");
+		return;
+	}
+
+	/*
+	 * Pixels smaller than byte may share bytes, split only the source
+	 * rectangle in the direction of the destination rows.
+	 */
+	if (dst->bpp % 8) {
+		if (t->swap)
+			tiles.min_h = h;
+		else
+			tiles.min_w = w;
+	}
+
+	GP_CHECK(!gp_tiles_run(&tiles), "failed to blit");
 }
-@ end
 
 void gp_blit_xyxy_fast(const gp_pixmap *src,
                        gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
                        gp_pixmap *dst, gp_coord x2, gp_coord y2)
 {
+	gp_size w = x1 - x0 + 1, h = y1 - y0 + 1;
+	struct transform t;
+
 	GP_DEBUG(2, "Blitting %s -> %s",
 	         gp_pixel_type_name(src->pixel_type),
 	         gp_pixel_type_name(dst->pixel_type));
 
-	/* Same pixel type */
-	if (src->pixel_type == dst->pixel_type) {
-		GP_FN_PER_BPP(blitXYXY, src->bpp, src->bit_endian,
-		              src, x0, y0, x1, y1, dst, x2, y2);
-		return;
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy(dst, x2, y2, x2 + x1 - x0, y2 + y1 - y0);
+
+	/* The macro expects the rectangle size in variables named w and h */
+	{
+		gp_size sw = w, sh = h;
+
+		GP_TRANSFORM_RECT(dst, x2, y2, w, h);
+		w = sw;
+		h = sh;
 	}
 
-	if (gp_pixmap_rotation_equal(src, dst)) {
-		gp_blit_xyxy_raw_fast(src, x0, y0, x1, y1, dst, x2, y2);
+	GP_TRANSFORM_RECT(src, x0, y0, w, h);
+
+	t.swap = src->axes_swap ^ dst->axes_swap;
+	t.x_swap = dst->x_swap ^ (t.swap ? src->y_swap : src->x_swap);
+	t.y_swap = dst->y_swap ^ (t.swap ? src->x_swap : src->y_swap);
+
+	/* The rotations cancel out, blit the raw rectangles */
+	if (!t.swap && !t.x_swap && !t.y_swap) {
+		gp_blit_xyxy_raw_fast(src, x0, y0, x0 + w - 1, y0 + h - 1,
+		                      dst, x2, y2);
 		return;
 	}
 
-	/* Specialized functions */
-	switch (src->pixel_type) {
-@ for src in pixeltypes:
-@     if not src.is_unknown() and not src.is_palette():
-	case GP_PIXEL_{{ src.name }}:
-		switch (dst->pixel_type) {
-@         for dst in pixeltypes:
-@             if not dst.is_unknown() and not dst.is_palette():
-@                 if dst.name != src.name:
-		case GP_PIXEL_{{ dst.name }}:
-			blitXYXY_{{ src.name }}_{{ dst.name }}(src, x0, y0, x1, y1, dst, x2, y2);
-		break;
-@         end
-		default:
-			GP_ABORT("Invalid destination pixel %s",
-			         gp_pixel_type_name(dst->pixel_type));
-		}
-	break;
-@ end
-	default:
-		GP_ABORT("Invalid source pixel %s",
-		         gp_pixel_type_name(src->pixel_type));
-	}
+	blit_xyxy_transform_raw(src, x0, y0, w, h, dst, x2, y2, &t);
 }
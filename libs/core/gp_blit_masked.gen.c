@@ -0,0 +1,885 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_blit_masked.gen.c
+ *
+ * GENERATED on 2026 10 17 02:42:34 from gp_blit_masked.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Color keyed and masked blits.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_transform.h>
+#include <core/gp_damage.h>
+#include <core/gp_blit.h>
+
+/* Shared with gp_blit.c */
+int gp_blit_xyxy_clip(const gp_pixmap *src,
+                      gp_coord *x0, gp_coord *y0, gp_coord *x1, gp_coord *y1,
+                      const gp_pixmap *dst, gp_coord *x2, gp_coord *y2);
+
+/*
+ * Pixmaps with the same pixel type and rotation flags with 8, 16 and 32 bit
+ * pixels are blitted by rows with vectorized kernels that select either the
+ * source or the destination pixel. The 24 bit pixels are blitted by rows with
+ * scalar kernels, the three byte loads do not vectorize. The rest is blitted
+ * pixel by pixel.
+ *
+ * The G1 mask is expanded into a byte per pixel in chunks first so that the
+ * selection vectorizes the same way as the color key comparsion.
+ */
+#define MASK_CHUNK 256
+
+GP_SIMD_BODY void colorkey_row_8BPP_body(uint8_t *restrict dst,
+                                              const uint8_t *restrict src,
+                                              uint8_t key, gp_size w)
+{
+	uint8_t *d = (void*)dst;
+	const uint8_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[x] == key ? d[x] : s[x];
+}
+
+GP_SIMD_VARIANT
+static void colorkey_row_8BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	colorkey_row_8BPP_body(dst, src, key, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void colorkey_row_8BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	colorkey_row_8BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void colorkey_row_8BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	colorkey_row_8BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void colorkey_row_8BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	colorkey_row_8BPP_body(dst, src, key, w);
+}
+#endif
+
+static void colorkey_row_8BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w);
+
+static void (*colorkey_row_8BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w) = colorkey_row_8BPP_resolve;
+
+static void colorkey_row_8BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w) = colorkey_row_8BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = colorkey_row_8BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = colorkey_row_8BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = colorkey_row_8BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of colorkey_row_8BPP()", variant);
+
+	__atomic_store_n(&colorkey_row_8BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, key, w);
+}
+
+static inline void colorkey_row_8BPP(uint8_t *restrict dst, const uint8_t *restrict src, uint8_t key, gp_size w)
+{
+	__atomic_load_n(&colorkey_row_8BPP_fn, __ATOMIC_RELAXED)(dst, src, key, w);
+}
+
+GP_SIMD_BODY void masked_row_8BPP_body(uint8_t *restrict dst,
+                                            const uint8_t *restrict src,
+                                            const uint8_t *restrict mask,
+                                            gp_size w)
+{
+	uint8_t *d = (void*)dst;
+	const uint8_t *s = (const void*)src;
+	gp_size x;
+
+	/* Bitwise select, conditional loads would not vectorize */
+	for (x = 0; x < w; x++) {
+		uint8_t m = -(uint8_t)mask[x];
+
+		d[x] = (s[x] & m) | (d[x] & ~m);
+	}
+}
+
+GP_SIMD_VARIANT
+static void masked_row_8BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_8BPP_body(dst, src, mask, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void masked_row_8BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_8BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void masked_row_8BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_8BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void masked_row_8BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_8BPP_body(dst, src, mask, w);
+}
+#endif
+
+static void masked_row_8BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w);
+
+static void (*masked_row_8BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_8BPP_resolve;
+
+static void masked_row_8BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_8BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = masked_row_8BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = masked_row_8BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = masked_row_8BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of masked_row_8BPP()", variant);
+
+	__atomic_store_n(&masked_row_8BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, mask, w);
+}
+
+static inline void masked_row_8BPP(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	__atomic_load_n(&masked_row_8BPP_fn, __ATOMIC_RELAXED)(dst, src, mask, w);
+}
+
+GP_SIMD_BODY void colorkey_row_16BPP_body(uint8_t *restrict dst,
+                                              const uint8_t *restrict src,
+                                              uint16_t key, gp_size w)
+{
+	uint16_t *d = (void*)dst;
+	const uint16_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[x] == key ? d[x] : s[x];
+}
+
+GP_SIMD_VARIANT
+static void colorkey_row_16BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	colorkey_row_16BPP_body(dst, src, key, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void colorkey_row_16BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	colorkey_row_16BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void colorkey_row_16BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	colorkey_row_16BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void colorkey_row_16BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	colorkey_row_16BPP_body(dst, src, key, w);
+}
+#endif
+
+static void colorkey_row_16BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w);
+
+static void (*colorkey_row_16BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w) = colorkey_row_16BPP_resolve;
+
+static void colorkey_row_16BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w) = colorkey_row_16BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = colorkey_row_16BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = colorkey_row_16BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = colorkey_row_16BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of colorkey_row_16BPP()", variant);
+
+	__atomic_store_n(&colorkey_row_16BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, key, w);
+}
+
+static inline void colorkey_row_16BPP(uint8_t *restrict dst, const uint8_t *restrict src, uint16_t key, gp_size w)
+{
+	__atomic_load_n(&colorkey_row_16BPP_fn, __ATOMIC_RELAXED)(dst, src, key, w);
+}
+
+GP_SIMD_BODY void masked_row_16BPP_body(uint8_t *restrict dst,
+                                            const uint8_t *restrict src,
+                                            const uint8_t *restrict mask,
+                                            gp_size w)
+{
+	uint16_t *d = (void*)dst;
+	const uint16_t *s = (const void*)src;
+	gp_size x;
+
+	/* Bitwise select, conditional loads would not vectorize */
+	for (x = 0; x < w; x++) {
+		uint16_t m = -(uint16_t)mask[x];
+
+		d[x] = (s[x] & m) | (d[x] & ~m);
+	}
+}
+
+GP_SIMD_VARIANT
+static void masked_row_16BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_16BPP_body(dst, src, mask, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void masked_row_16BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_16BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void masked_row_16BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_16BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void masked_row_16BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_16BPP_body(dst, src, mask, w);
+}
+#endif
+
+static void masked_row_16BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w);
+
+static void (*masked_row_16BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_16BPP_resolve;
+
+static void masked_row_16BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_16BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = masked_row_16BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = masked_row_16BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = masked_row_16BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of masked_row_16BPP()", variant);
+
+	__atomic_store_n(&masked_row_16BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, mask, w);
+}
+
+static inline void masked_row_16BPP(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	__atomic_load_n(&masked_row_16BPP_fn, __ATOMIC_RELAXED)(dst, src, mask, w);
+}
+
+GP_SIMD_BODY void colorkey_row_32BPP_body(uint8_t *restrict dst,
+                                              const uint8_t *restrict src,
+                                              uint32_t key, gp_size w)
+{
+	uint32_t *d = (void*)dst;
+	const uint32_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[x] == key ? d[x] : s[x];
+}
+
+GP_SIMD_VARIANT
+static void colorkey_row_32BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	colorkey_row_32BPP_body(dst, src, key, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void colorkey_row_32BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	colorkey_row_32BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void colorkey_row_32BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	colorkey_row_32BPP_body(dst, src, key, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void colorkey_row_32BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	colorkey_row_32BPP_body(dst, src, key, w);
+}
+#endif
+
+static void colorkey_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w);
+
+static void (*colorkey_row_32BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w) = colorkey_row_32BPP_resolve;
+
+static void colorkey_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w) = colorkey_row_32BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = colorkey_row_32BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = colorkey_row_32BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = colorkey_row_32BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of colorkey_row_32BPP()", variant);
+
+	__atomic_store_n(&colorkey_row_32BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, key, w);
+}
+
+static inline void colorkey_row_32BPP(uint8_t *restrict dst, const uint8_t *restrict src, uint32_t key, gp_size w)
+{
+	__atomic_load_n(&colorkey_row_32BPP_fn, __ATOMIC_RELAXED)(dst, src, key, w);
+}
+
+GP_SIMD_BODY void masked_row_32BPP_body(uint8_t *restrict dst,
+                                            const uint8_t *restrict src,
+                                            const uint8_t *restrict mask,
+                                            gp_size w)
+{
+	uint32_t *d = (void*)dst;
+	const uint32_t *s = (const void*)src;
+	gp_size x;
+
+	/* Bitwise select, conditional loads would not vectorize */
+	for (x = 0; x < w; x++) {
+		uint32_t m = -(uint32_t)mask[x];
+
+		d[x] = (s[x] & m) | (d[x] & ~m);
+	}
+}
+
+GP_SIMD_VARIANT
+static void masked_row_32BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_32BPP_body(dst, src, mask, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void masked_row_32BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_32BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void masked_row_32BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_32BPP_body(dst, src, mask, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void masked_row_32BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	masked_row_32BPP_body(dst, src, mask, w);
+}
+#endif
+
+static void masked_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w);
+
+static void (*masked_row_32BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_32BPP_resolve;
+
+static void masked_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w) = masked_row_32BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = masked_row_32BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = masked_row_32BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = masked_row_32BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of masked_row_32BPP()", variant);
+
+	__atomic_store_n(&masked_row_32BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, mask, w);
+}
+
+static inline void masked_row_32BPP(uint8_t *restrict dst, const uint8_t *restrict src, const uint8_t *restrict mask, gp_size w)
+{
+	__atomic_load_n(&masked_row_32BPP_fn, __ATOMIC_RELAXED)(dst, src, mask, w);
+}
+
+/* The 24 bit pixels are stored with the least significant byte first */
+static void colorkey_row_24BPP(uint8_t *restrict dst,
+                               const uint8_t *restrict src,
+                               uint32_t key, gp_size w)
+{
+	uint8_t k0 = key, k1 = key >> 8, k2 = key >> 16;
+	gp_size x;
+
+	for (x = 0; x < w; x++, dst += 3, src += 3) {
+		if (src[0] == k0 && src[1] == k1 && src[2] == k2)
+			continue;
+
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+	}
+}
+
+static void masked_row_24BPP(uint8_t *restrict dst,
+                             const uint8_t *restrict src,
+                             const uint8_t *restrict mask, gp_size w)
+{
+	gp_size x;
+
+	for (x = 0; x < w; x++, dst += 3, src += 3) {
+		if (!mask[x])
+			continue;
+
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+	}
+}
+
+/*
+ * Expands eight mask bits into eight bytes, the first pixel is stored into
+ * the first byte.
+ */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# define MASK_BITS_LE 0x8040201008040201ull
+# define MASK_BITS_BE 0x0102040810204080ull
+#else
+# define MASK_BITS_LE 0x0102040810204080ull
+# define MASK_BITS_BE 0x8040201008040201ull
+#endif
+
+static inline uint64_t mask_expand(uint8_t bits, uint64_t order)
+{
+	uint64_t x = (bits * 0x0101010101010101ull) & order;
+
+	return ((x + 0x7f7f7f7f7f7f7f7full) >> 7) & 0x0101010101010101ull;
+}
+
+/*
+ * Expands w mask pixels starting at x, y into buf, returns pointer to the
+ * first pixel in the buffer, the buffer has to have space for w + 16 bytes.
+ */
+static const uint8_t *mask_row(const gp_pixmap *mask, gp_coord x, gp_coord y,
+                               gp_size w, uint8_t *buf)
+{
+	uint64_t order = mask->bit_endian == GP_BIT_ENDIAN_BE ?
+	                 MASK_BITS_BE : MASK_BITS_LE;
+	size_t bit = (size_t)x + mask->offset;
+	const uint8_t *m = mask->pixels + (size_t)y * mask->bytes_per_row + bit / 8;
+	size_t i, bytes = (bit % 8 + w + 7) / 8;
+
+	for (i = 0; i < bytes; i++) {
+		uint64_t v = mask_expand(m[i], order);
+
+		memcpy(buf + 8 * i, &v, 8);
+	}
+
+	return buf + bit % 8;
+}
+
+static void transform_rect(const gp_pixmap *pixmap, gp_coord *px, gp_coord *py,
+                           gp_size w, gp_size h)
+{
+	gp_coord x = *px, y = *py;
+
+	GP_TRANSFORM_RECT(pixmap, x, y, w, h);
+
+	*px = x;
+	*py = y;
+}
+
+static int same_rotation(const gp_pixmap *a, const gp_pixmap *b)
+{
+	return a->axes_swap == b->axes_swap &&
+	       a->x_swap == b->x_swap &&
+	       a->y_swap == b->y_swap;
+}
+
+static int has_row_fn(const gp_pixmap *src, const gp_pixmap *dst)
+{
+	if (src->pixel_type != dst->pixel_type || !same_rotation(src, dst))
+		return 0;
+
+	switch (src->bpp) {
+	case 8:
+	case 16:
+	case 24:
+	case 32:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Pixel position in the pixels buffer for pixmaps with different rotation.
+ *
+ * The start of the rectangle is transformed once, moving by one pixel in the
+ * user x or y direction moves by one pixel in one of the directions in the
+ * buffer depending on the rotation flags.
+ */
+struct raw_pos {
+	gp_coord x, y;
+	/* Buffer steps for the user x direction */
+	gp_coord xx, xy;
+	/* Buffer steps for the user y direction */
+	gp_coord yx, yy;
+};
+
+static void raw_pos_init(struct raw_pos *pos, const gp_pixmap *pixmap,
+                         gp_coord x, gp_coord y)
+{
+	gp_coord sx = pixmap->x_swap ? -1 : 1;
+	gp_coord sy = pixmap->y_swap ? -1 : 1;
+
+	GP_TRANSFORM_POINT(pixmap, x, y);
+
+	pos->x = x;
+	pos->y = y;
+
+	if (pixmap->axes_swap) {
+		pos->xx = 0;
+		pos->xy = sy;
+		pos->yx = sx;
+		pos->yy = 0;
+	} else {
+		pos->xx = sx;
+		pos->xy = 0;
+		pos->yx = 0;
+		pos->yy = sy;
+	}
+}
+
+static inline gp_coord raw_x(const struct raw_pos *pos, gp_coord x, gp_coord y)
+{
+	return pos->x + x * pos->xx + y * pos->yx;
+}
+
+static inline gp_coord raw_y(const struct raw_pos *pos, gp_coord x, gp_coord y)
+{
+	return pos->y + x * pos->xy + y * pos->yy;
+}
+
+static void colorkey_row(const gp_pixmap *src, gp_coord x0, gp_coord y0,
+                         gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                         gp_size w, gp_pixel key)
+{
+	const uint8_t *s = src->pixels + (size_t)y0 * src->bytes_per_row + (size_t)x0 * (src->bpp / 8);
+	uint8_t *d = dst->pixels + (size_t)y2 * dst->bytes_per_row + (size_t)x2 * (dst->bpp / 8);
+
+	switch (src->bpp) {
+	case 8:
+		colorkey_row_8BPP(d, s, key, w);
+	break;
+	case 16:
+		colorkey_row_16BPP(d, s, key, w);
+	break;
+	case 24:
+		colorkey_row_24BPP(d, s, key, w);
+	break;
+	case 32:
+		colorkey_row_32BPP(d, s, key, w);
+	break;
+	}
+}
+
+static void masked_row(const gp_pixmap *src, gp_coord x0, gp_coord y0,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2,
+                       gp_size w, const uint8_t *m)
+{
+	const uint8_t *s = src->pixels + (size_t)y0 * src->bytes_per_row + (size_t)x0 * (src->bpp / 8);
+	uint8_t *d = dst->pixels + (size_t)y2 * dst->bytes_per_row + (size_t)x2 * (dst->bpp / 8);
+
+	switch (src->bpp) {
+	case 8:
+		masked_row_8BPP(d, s, m, w);
+	break;
+	case 16:
+		masked_row_16BPP(d, s, m, w);
+	break;
+	case 24:
+		masked_row_24BPP(d, s, m, w);
+	break;
+	case 32:
+		masked_row_32BPP(d, s, m, w);
+	break;
+	}
+}
+
+void gp_blit_colorkey(const gp_pixmap *src,
+                      gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                      gp_pixmap *dst, gp_coord x1, gp_coord y1, gp_pixel key)
+{
+	gp_coord sx1 = x0 + w0 - 1, sy1 = y0 + h0 - 1;
+	gp_coord x, y;
+	gp_size w, h;
+
+	if (!w0 || !h0)
+		return;
+
+	if (gp_blit_xyxy_clip(src, &x0, &y0, &sx1, &sy1, dst, &x1, &y1))
+		return;
+
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy(dst, x1, y1, x1 + sx1 - x0, y1 + sy1 - y0);
+
+	w = sx1 - x0 + 1;
+	h = sy1 - y0 + 1;
+
+	if (!has_row_fn(src, dst)) {
+		struct raw_pos spos, dpos;
+
+		raw_pos_init(&spos, src, x0, y0);
+		raw_pos_init(&dpos, dst, x1, y1);
+
+		for (y = 0; y < (gp_coord)h; y++) {
+			for (x = 0; x < (gp_coord)w; x++) {
+				gp_pixel p = gp_getpixel_raw(src, raw_x(&spos, x, y),
+				                             raw_y(&spos, x, y));
+
+				if (p == key)
+					continue;
+
+				if (src->pixel_type != dst->pixel_type)
+					p = gp_convert_pixel(p, src->pixel_type, dst->pixel_type);
+
+				gp_putpixel_raw(dst, raw_x(&dpos, x, y),
+				                raw_y(&dpos, x, y), p);
+			}
+		}
+		return;
+	}
+
+	transform_rect(src, &x0, &y0, w, h);
+	transform_rect(dst, &x1, &y1, w, h);
+	GP_TRANSFORM_SWAP(src, w, h);
+
+	for (y = 0; y < (gp_coord)h; y++)
+		colorkey_row(src, x0, y0 + y, dst, x1, y1 + y, w, key);
+}
+
+void gp_blit_masked(const gp_pixmap *src,
+                    gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                    gp_pixmap *dst, gp_coord x1, gp_coord y1,
+                    const gp_pixmap *mask)
+{
+	gp_coord sx1 = x0 + w0 - 1, sy1 = y0 + h0 - 1;
+	uint8_t buf[MASK_CHUNK + 16];
+	gp_coord x, y;
+	gp_size w, h;
+
+	GP_CHECK(mask->pixel_type == GP_PIXEL_G1, "Mask must be G1");
+	GP_CHECK(gp_pixmap_w(mask) >= gp_pixmap_w(src) &&
+	         gp_pixmap_h(mask) >= gp_pixmap_h(src),
+	         "Mask must be at least as large as the source");
+
+	if (!w0 || !h0)
+		return;
+
+	if (gp_blit_xyxy_clip(src, &x0, &y0, &sx1, &sy1, dst, &x1, &y1))
+		return;
+
+	GP_PIXMAP_UNSHARE(dst);
+	gp_pixmap_damage_xyxy(dst, x1, y1, x1 + sx1 - x0, y1 + sy1 - y0);
+
+	w = sx1 - x0 + 1;
+	h = sy1 - y0 + 1;
+
+	if (!has_row_fn(src, dst) || !same_rotation(src, mask)) {
+		struct raw_pos spos, dpos, mpos;
+
+		raw_pos_init(&spos, src, x0, y0);
+		raw_pos_init(&dpos, dst, x1, y1);
+		raw_pos_init(&mpos, mask, x0, y0);
+
+		for (y = 0; y < (gp_coord)h; y++) {
+			for (x = 0; x < (gp_coord)w; x++) {
+				gp_pixel p;
+
+				if (!gp_getpixel_raw(mask, raw_x(&mpos, x, y),
+				                     raw_y(&mpos, x, y)))
+					continue;
+
+				p = gp_getpixel_raw(src, raw_x(&spos, x, y),
+				                    raw_y(&spos, x, y));
+
+				if (src->pixel_type != dst->pixel_type)
+					p = gp_convert_pixel(p, src->pixel_type, dst->pixel_type);
+
+				gp_putpixel_raw(dst, raw_x(&dpos, x, y),
+				                raw_y(&dpos, x, y), p);
+			}
+		}
+		return;
+	}
+
+	/*
+	 * The mask is addressed by the source coordinates, since the mask may
+	 * be larger than the source it has to be transformed separately.
+	 */
+	gp_coord mx = x0, my = y0;
+
+	transform_rect(mask, &mx, &my, w, h);
+	transform_rect(src, &x0, &y0, w, h);
+	transform_rect(dst, &x1, &y1, w, h);
+	GP_TRANSFORM_SWAP(src, w, h);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x += MASK_CHUNK) {
+			gp_size n = GP_MIN((gp_size)MASK_CHUNK, w - x);
+			const uint8_t *m = mask_row(mask, mx + x, my + y, n, buf);
+
+			masked_row(src, x0 + x, y0 + y, dst, x1 + x, y1 + y, n, m);
+		}
+	}
+}
@@ -0,0 +1,2144 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_blit_scaled.gen.c
+ *
+ * GENERATED on 2026 10 17 03:29:50 from gp_blit_scaled.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Scaled blits.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_damage.h>
+#include <core/gp_blit.h>
+
+/* Generated functions */
+void gp_blit_xyxy_fast(const gp_pixmap *src,
+                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2);
+
+/*
+ * The source rectangle is scaled in the source orientation, i.e. the scaled
+ * image has the same rotation flags as the source and its raw pixels are
+ * interpolated from the source raw rectangle. The mapping samples the pixel
+ * centers so it's symmetric and does not depend on the mirroring.
+ *
+ * If the destination has the same pixel type and rotation the scaled pixels
+ * are written directly into it, otherwise the scaled image is produced in
+ * strips and blitted with the regular blit that converts the pixel type and
+ * rotation.
+ */
+#define SCALE_STRIP 16
+
+struct scale {
+	const gp_pixmap *src;
+	/* Source raw rectangle */
+	gp_coord sx, sy;
+	gp_size sw, sh;
+	/* Scaled image raw size */
+	gp_size fw, fh;
+	/* Raw rectangle of the scaled image that is being written */
+	gp_coord rx, ry;
+	gp_size rw, rh;
+
+	/* Source pixel per column, in bytes for byte aligned nearest neighbour */
+	uint32_t *xmap;
+	/* Right pixel offset and weight for bilinear interpolation */
+	uint32_t *xmap1;
+	uint8_t *xw;
+	/* Integer upscale factor or 0 */
+	unsigned int x_up;
+	/* Source is exactly two times larger */
+	int x_half;
+
+	/* Cached horizontally interpolated rows for bilinear interpolation */
+	uint32_t *rows[2];
+	gp_coord rows_y[2];
+};
+
+static uint32_t nn_map(gp_coord i, gp_size from, gp_size to)
+{
+	return ((2 * (uint64_t)i + 1) * from) / (2 * (uint64_t)to);
+}
+
+static void linear_map(gp_coord i, gp_size from, gp_size to,
+                       uint32_t *a, uint32_t *b, uint8_t *w)
+{
+	int64_t pos = (((2 * (int64_t)i + 1) * from)<<16) / (2 * (int64_t)to) - (1<<15);
+
+	if (pos < 0)
+		pos = 0;
+
+	*a = pos>>16;
+	*w = (pos>>8) & 0xff;
+
+	if (*a >= from - 1) {
+		*a = from - 1;
+		*w = 0;
+	}
+
+	*b = *w ? *a + 1 : *a;
+}
+
+static void scale_nn_1BPP_LE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_1BPP_LE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_1BPP_LE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_1BPP_BE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_1BPP_BE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_1BPP_BE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_2BPP_LE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_2BPP_LE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_2BPP_LE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_2BPP_BE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_2BPP_BE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_2BPP_BE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_4BPP_LE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_4BPP_LE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_4BPP_LE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_4BPP_BE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_4BPP_BE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_4BPP_BE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn_8BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_8BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_8BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 1);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 1;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 1);
+				dp += 1;
+				if (++k == s->x_up) {
+					sp += 1;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 1;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 1);
+				dp += 1;
+				sp += 2 * 1;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 1, sp + s->xmap[i], 1);
+		}
+	}
+}
+
+static void scale_nn_16BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_16BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_16BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 2);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 2;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 2);
+				dp += 2;
+				if (++k == s->x_up) {
+					sp += 2;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 2;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 2);
+				dp += 2;
+				sp += 2 * 2;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 2, sp + s->xmap[i], 2);
+		}
+	}
+}
+
+static void scale_nn_24BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_24BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_24BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 3);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 3;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 3);
+				dp += 3;
+				if (++k == s->x_up) {
+					sp += 3;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 3;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 3);
+				dp += 3;
+				sp += 2 * 3;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 3, sp + s->xmap[i], 3);
+		}
+	}
+}
+
+static void scale_nn_32BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_32BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_32BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 4);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 4;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 4);
+				dp += 4;
+				if (++k == s->x_up) {
+					sp += 4;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 4;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 4);
+				dp += 4;
+				sp += 2 * 4;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 4, sp + s->xmap[i], 4);
+		}
+	}
+}
+
+static void scale_nn_48BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_48BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_48BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 6);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 6;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 6);
+				dp += 6;
+				if (++k == s->x_up) {
+					sp += 6;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 6;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 6);
+				dp += 6;
+				sp += 2 * 6;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 6, sp + s->xmap[i], 6);
+		}
+	}
+}
+
+static void scale_nn_64BPP(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+	gp_coord prev = -1;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_64BPP(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_64BPP(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * 8);
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * 8;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 8);
+				dp += 8;
+				if (++k == s->x_up) {
+					sp += 8;
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * 8;
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, 8);
+				dp += 8;
+				sp += 2 * 8;
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * 8, sp + s->xmap[i], 8);
+		}
+	}
+}
+
+static void scale_nn_18BPP_LE(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_18BPP_LE(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_18BPP_LE(out, px + i, py + j, p);
+		}
+	}
+}
+
+static void scale_nn(const struct scale *s, gp_coord r0, gp_size rows,
+                     gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	GP_FN_PER_BPP_PIXMAP(scale_nn, s->src, s, r0, rows, out, px, py);
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_xRGB8888(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_xRGB8888(p0) +
+			                  GP_PIXEL_GET_R_xRGB8888(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_xRGB8888(p0) +
+			                  GP_PIXEL_GET_G_xRGB8888(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_xRGB8888(p0) +
+			                  GP_PIXEL_GET_B_xRGB8888(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_xRGB8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_xRGB8888(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_xRGB8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_xRGB8888(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_xRGB8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_xRGB8888(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_xRGB8888(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_xRGB8888(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_32BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_xRGB8888(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGBA8888(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGBA8888(p0) +
+			                  GP_PIXEL_GET_R_RGBA8888(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGBA8888(p0) +
+			                  GP_PIXEL_GET_G_RGBA8888(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGBA8888(p0) +
+			                  GP_PIXEL_GET_B_RGBA8888(p1))<<7;
+			row[3 * s->rw + i] = (GP_PIXEL_GET_A_RGBA8888(p0) +
+			                  GP_PIXEL_GET_A_RGBA8888(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGBA8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGBA8888(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGBA8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGBA8888(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGBA8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGBA8888(p1) * w;
+			row[3 * s->rw + i] = GP_PIXEL_GET_A_RGBA8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_A_RGBA8888(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGBA8888(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGBA8888(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t A = (row[0][3 * s->rw + i] * (256 - w) +
+			             row[1][3 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_32BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGBA8888(R, G, B, A));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB888(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_24BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_24BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB888(p0) +
+			                  GP_PIXEL_GET_R_RGB888(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB888(p0) +
+			                  GP_PIXEL_GET_G_RGB888(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB888(p0) +
+			                  GP_PIXEL_GET_B_RGB888(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB888(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB888(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB888(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB888(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB888(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_24BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB888(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_BGR888(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_24BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_24BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_B_BGR888(p0) +
+			                  GP_PIXEL_GET_B_BGR888(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_BGR888(p0) +
+			                  GP_PIXEL_GET_G_BGR888(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_R_BGR888(p0) +
+			                  GP_PIXEL_GET_R_BGR888(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_B_BGR888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_BGR888(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_BGR888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_BGR888(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_R_BGR888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_BGR888(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_BGR888(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_BGR888(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t B = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t R = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_24BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_BGR888(B, G, R));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB555(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB555(p0) +
+			                  GP_PIXEL_GET_R_RGB555(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB555(p0) +
+			                  GP_PIXEL_GET_G_RGB555(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB555(p0) +
+			                  GP_PIXEL_GET_B_RGB555(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB555(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB555(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB555(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB555(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB555(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB555(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB555(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB555(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_16BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB555(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB565(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB565(p0) +
+			                  GP_PIXEL_GET_R_RGB565(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB565(p0) +
+			                  GP_PIXEL_GET_G_RGB565(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB565(p0) +
+			                  GP_PIXEL_GET_B_RGB565(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB565(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB565(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB565(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB565(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB565(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB565(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB565(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB565(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_16BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB565(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB666(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_18BPP_LE(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_18BPP_LE(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB666(p0) +
+			                  GP_PIXEL_GET_R_RGB666(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB666(p0) +
+			                  GP_PIXEL_GET_G_RGB666(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB666(p0) +
+			                  GP_PIXEL_GET_B_RGB666(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB666(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB666(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB666(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB666(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB666(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB666(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB666(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB666(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_18BPP_LE(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB666(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB332(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_8BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_8BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB332(p0) +
+			                  GP_PIXEL_GET_R_RGB332(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB332(p0) +
+			                  GP_PIXEL_GET_G_RGB332(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB332(p0) +
+			                  GP_PIXEL_GET_B_RGB332(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB332(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB332(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB332(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB332(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB332(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB332(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB332(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB332(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_8BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB332(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_CMYK8888(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_K_CMYK8888(p0) +
+			                  GP_PIXEL_GET_K_CMYK8888(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_Y_CMYK8888(p0) +
+			                  GP_PIXEL_GET_Y_CMYK8888(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_M_CMYK8888(p0) +
+			                  GP_PIXEL_GET_M_CMYK8888(p1))<<7;
+			row[3 * s->rw + i] = (GP_PIXEL_GET_C_CMYK8888(p0) +
+			                  GP_PIXEL_GET_C_CMYK8888(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_K_CMYK8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_K_CMYK8888(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_Y_CMYK8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_Y_CMYK8888(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_M_CMYK8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_M_CMYK8888(p1) * w;
+			row[3 * s->rw + i] = GP_PIXEL_GET_C_CMYK8888(p0) * (256 - w) +
+			                  GP_PIXEL_GET_C_CMYK8888(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_CMYK8888(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_CMYK8888(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t K = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t Y = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t M = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t C = (row[0][3 * s->rw + i] * (256 - w) +
+			             row[1][3 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_32BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_CMYK8888(K, Y, M, C));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_G1(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_1BPP_LE(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_1BPP_LE(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_G1(p0) +
+			                  GP_PIXEL_GET_V_G1(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_G1(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_G1(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_G1(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_G1(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_1BPP_LE(out, px + i, py + j,
+				GP_PIXEL_CREATE_G1(V));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_G2(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_2BPP_LE(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_2BPP_LE(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_G2(p0) +
+			                  GP_PIXEL_GET_V_G2(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_G2(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_G2(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_G2(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_G2(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_2BPP_LE(out, px + i, py + j,
+				GP_PIXEL_CREATE_G2(V));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_G4(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_4BPP_LE(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_4BPP_LE(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_G4(p0) +
+			                  GP_PIXEL_GET_V_G4(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_G4(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_G4(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_G4(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_G4(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_4BPP_LE(out, px + i, py + j,
+				GP_PIXEL_CREATE_G4(V));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_G8(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_8BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_8BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_G8(p0) +
+			                  GP_PIXEL_GET_V_G8(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_G8(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_G8(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_G8(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_G8(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_8BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_G8(V));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_GA88(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_GA88(p0) +
+			                  GP_PIXEL_GET_V_GA88(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_A_GA88(p0) +
+			                  GP_PIXEL_GET_A_GA88(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_GA88(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_GA88(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_A_GA88(p0) * (256 - w) +
+			                  GP_PIXEL_GET_A_GA88(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_GA88(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_GA88(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t A = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_16BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_GA88(V, A));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_G16(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_16BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_V_G16(p0) +
+			                  GP_PIXEL_GET_V_G16(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_V_G16(p0) * (256 - w) +
+			                  GP_PIXEL_GET_V_G16(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_G16(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_G16(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t V = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_16BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_G16(V));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGBA8888_PM(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_32BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGBA8888_PM(p0) +
+			                  GP_PIXEL_GET_R_RGBA8888_PM(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGBA8888_PM(p0) +
+			                  GP_PIXEL_GET_G_RGBA8888_PM(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGBA8888_PM(p0) +
+			                  GP_PIXEL_GET_B_RGBA8888_PM(p1))<<7;
+			row[3 * s->rw + i] = (GP_PIXEL_GET_A_RGBA8888_PM(p0) +
+			                  GP_PIXEL_GET_A_RGBA8888_PM(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGBA8888_PM(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGBA8888_PM(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGBA8888_PM(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGBA8888_PM(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGBA8888_PM(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGBA8888_PM(p1) * w;
+			row[3 * s->rw + i] = GP_PIXEL_GET_A_RGBA8888_PM(p0) * (256 - w) +
+			                  GP_PIXEL_GET_A_RGBA8888_PM(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGBA8888_PM(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGBA8888_PM(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t A = (row[0][3 * s->rw + i] * (256 - w) +
+			             row[1][3 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_32BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGBA8888_PM(R, G, B, A));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGB161616(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_48BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_48BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGB161616(p0) +
+			                  GP_PIXEL_GET_R_RGB161616(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGB161616(p0) +
+			                  GP_PIXEL_GET_G_RGB161616(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGB161616(p0) +
+			                  GP_PIXEL_GET_B_RGB161616(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGB161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGB161616(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGB161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGB161616(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGB161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGB161616(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGB161616(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGB161616(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_48BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGB161616(R, G, B));
+		}
+	}
+}
+
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_RGBA16161616(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_64BPP(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_64BPP(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+			row[0 * s->rw + i] = (GP_PIXEL_GET_R_RGBA16161616(p0) +
+			                  GP_PIXEL_GET_R_RGBA16161616(p1))<<7;
+			row[1 * s->rw + i] = (GP_PIXEL_GET_G_RGBA16161616(p0) +
+			                  GP_PIXEL_GET_G_RGBA16161616(p1))<<7;
+			row[2 * s->rw + i] = (GP_PIXEL_GET_B_RGBA16161616(p0) +
+			                  GP_PIXEL_GET_B_RGBA16161616(p1))<<7;
+			row[3 * s->rw + i] = (GP_PIXEL_GET_A_RGBA16161616(p0) +
+			                  GP_PIXEL_GET_A_RGBA16161616(p1))<<7;
+		} else {
+			uint32_t w = s->xw[i];
+
+			row[0 * s->rw + i] = GP_PIXEL_GET_R_RGBA16161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_R_RGBA16161616(p1) * w;
+			row[1 * s->rw + i] = GP_PIXEL_GET_G_RGBA16161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_G_RGBA16161616(p1) * w;
+			row[2 * s->rw + i] = GP_PIXEL_GET_B_RGBA16161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_B_RGBA16161616(p1) * w;
+			row[3 * s->rw + i] = GP_PIXEL_GET_A_RGBA16161616(p0) * (256 - w) +
+			                  GP_PIXEL_GET_A_RGBA16161616(p1) * w;
+		}
+	}
+}
+
+static void scale_linear_RGBA16161616(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_RGBA16161616(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			uint32_t R = (row[0][0 * s->rw + i] * (256 - w) +
+			             row[1][0 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t G = (row[0][1 * s->rw + i] * (256 - w) +
+			             row[1][1 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t B = (row[0][2 * s->rw + i] * (256 - w) +
+			             row[1][2 * s->rw + i] * w + (1<<15))>>16;
+			uint32_t A = (row[0][3 * s->rw + i] * (256 - w) +
+			             row[1][3 * s->rw + i] * w + (1<<15))>>16;
+
+			gp_putpixel_raw_64BPP(out, px + i, py + j,
+				GP_PIXEL_CREATE_RGBA16161616(R, G, B, A));
+		}
+	}
+}
+
+static void scale_linear(struct scale *s, gp_coord r0, gp_size rows,
+                         gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	switch (s->src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		scale_linear_xRGB8888(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGBA8888:
+		scale_linear_RGBA8888(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB888:
+		scale_linear_RGB888(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_BGR888:
+		scale_linear_BGR888(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB555:
+		scale_linear_RGB555(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB565:
+		scale_linear_RGB565(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB666:
+		scale_linear_RGB666(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB332:
+		scale_linear_RGB332(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_CMYK8888:
+		scale_linear_CMYK8888(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_G1:
+		scale_linear_G1(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_G2:
+		scale_linear_G2(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_G4:
+		scale_linear_G4(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_G8:
+		scale_linear_G8(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_GA88:
+		scale_linear_GA88(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_G16:
+		scale_linear_G16(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		scale_linear_RGBA8888_PM(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGB161616:
+		scale_linear_RGB161616(s, r0, rows, out, px, py);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		scale_linear_RGBA16161616(s, r0, rows, out, px, py);
+	break;
+	default:
+	break;
+	}
+}
+
+static unsigned int linear_chans(gp_pixel_type type)
+{
+	switch (type) {
+	case GP_PIXEL_xRGB8888:
+		return 3;
+	case GP_PIXEL_RGBA8888:
+		return 4;
+	case GP_PIXEL_RGB888:
+		return 3;
+	case GP_PIXEL_BGR888:
+		return 3;
+	case GP_PIXEL_RGB555:
+		return 3;
+	case GP_PIXEL_RGB565:
+		return 3;
+	case GP_PIXEL_RGB666:
+		return 3;
+	case GP_PIXEL_RGB332:
+		return 3;
+	case GP_PIXEL_CMYK8888:
+		return 4;
+	case GP_PIXEL_G1:
+		return 1;
+	case GP_PIXEL_G2:
+		return 1;
+	case GP_PIXEL_G4:
+		return 1;
+	case GP_PIXEL_G8:
+		return 1;
+	case GP_PIXEL_GA88:
+		return 2;
+	case GP_PIXEL_G16:
+		return 1;
+	case GP_PIXEL_RGBA8888_PM:
+		return 4;
+	case GP_PIXEL_RGB161616:
+		return 3;
+	case GP_PIXEL_RGBA16161616:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+static void scale_rows(struct scale *s, enum gp_blit_scale_type type,
+                       gp_coord r0, gp_size rows,
+                       gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	if (type == GP_BLIT_SCALE_LINEAR)
+		scale_linear(s, r0, rows, out, px, py);
+	else
+		scale_nn(s, r0, rows, out, px, py);
+}
+
+/*
+ * Converts a rectangle in the user coordinates of a w x h image with the
+ * pixmap rotation flags into raw coordinates and back.
+ */
+static void rect_to_raw(const gp_pixmap *p, gp_size w, gp_size h,
+                        gp_coord *x, gp_coord *y, gp_size *rw, gp_size *rh)
+{
+	if (p->axes_swap) {
+		GP_SWAP(*x, *y);
+		GP_SWAP(*rw, *rh);
+		GP_SWAP(w, h);
+	}
+
+	if (p->x_swap)
+		*x = w - *x - *rw;
+
+	if (p->y_swap)
+		*y = h - *y - *rh;
+}
+
+static void rect_from_raw(const gp_pixmap *p, gp_size w, gp_size h,
+                          gp_coord *x, gp_coord *y, gp_size *rw, gp_size *rh)
+{
+	if (p->axes_swap)
+		GP_SWAP(w, h);
+
+	if (p->x_swap)
+		*x = w - *x - *rw;
+
+	if (p->y_swap)
+		*y = h - *y - *rh;
+
+	if (p->axes_swap) {
+		GP_SWAP(*x, *y);
+		GP_SWAP(*rw, *rh);
+	}
+}
+
+static int same_rotation(const gp_pixmap *a, const gp_pixmap *b)
+{
+	return a->axes_swap == b->axes_swap &&
+	       a->x_swap == b->x_swap &&
+	       a->y_swap == b->y_swap;
+}
+
+/*
+ * Blits the scaled image in strips, the strips have the source pixel type and
+ * rotation flags.
+ */
+static int scale_strips(struct scale *s, enum gp_blit_scale_type type,
+                        gp_pixmap *dst, gp_coord x1, gp_coord y1)
+{
+	const gp_pixmap *src = s->src;
+	size_t size = (size_t)GP_CALC_ROW_SIZE(src->pixel_type, s->rw) * SCALE_STRIP;
+	gp_pixmap strip;
+	gp_size j, rows;
+	void *buf;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (j = 0; j < s->rh; j += rows) {
+		gp_coord x = s->rx, y = s->ry + j;
+		gp_size w, h;
+
+		rows = GP_MIN((gp_size)SCALE_STRIP, s->rh - j);
+
+		gp_pixmap_init(&strip, s->rw, rows, src->pixel_type, buf);
+		strip.bit_endian = src->bit_endian;
+		gp_pixmap_set_rotation(&strip, src->axes_swap,
+		                       src->x_swap, src->y_swap);
+
+		scale_rows(s, type, y, rows, &strip, 0, 0);
+
+		w = s->rw;
+		h = rows;
+		rect_from_raw(src, s->fw, s->fh, &x, &y, &w, &h);
+
+		gp_blit_xyxy_fast(&strip, 0, 0, w - 1, h - 1,
+		                  dst, x1 + x, y1 + y);
+	}
+
+	gp_temp_free(size, buf);
+	return 0;
+}
+
+int gp_blit_scaled(const gp_pixmap *src,
+                   gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                   gp_pixmap *dst,
+                   gp_coord x1, gp_coord y1, gp_size w1, gp_size h1,
+                   enum gp_blit_scale_type type)
+{
+	struct scale s = {
+		.src = src,
+		.rows_y = {-1, -1},
+	};
+	gp_coord cx, cy, i;
+	gp_size cw, ch;
+	unsigned int chans;
+	size_t size;
+	uint8_t *buf;
+	int ret = 0;
+
+	if (!w0 || !h0 || !w1 || !h1)
+		return 0;
+
+	/* Source rectangle is inside of the source pixmap */
+	GP_CHECK(x0 >= 0 && y0 >= 0);
+	GP_CHECK(x0 + w0 <= gp_pixmap_w(src));
+	GP_CHECK(y0 + h0 <= gp_pixmap_h(src));
+
+	if (type == GP_BLIT_SCALE_LINEAR && !linear_chans(src->pixel_type)) {
+		GP_DEBUG(1, "Bilinear scaling not supported for %s, using nearest",
+		         gp_pixel_type_name(src->pixel_type));
+		type = GP_BLIT_SCALE_NN;
+	}
+
+	/* Clip the destination rectangle */
+	cx = GP_MAX(x1, 0);
+	cy = GP_MAX(y1, 0);
+
+	if (x1 + (gp_coord)w1 <= cx || y1 + (gp_coord)h1 <= cy ||
+	    cx >= (gp_coord)gp_pixmap_w(dst) || cy >= (gp_coord)gp_pixmap_h(dst))
+		return 0;
+
+	cw = GP_MIN(x1 + (gp_coord)w1, (gp_coord)gp_pixmap_w(dst)) - cx;
+	ch = GP_MIN(y1 + (gp_coord)h1, (gp_coord)gp_pixmap_h(dst)) - cy;
+
+	GP_DEBUG(2, "Scaling %s %ux%u -> %s %ux%u clipped to %ix%i-%ux%u",
+	         gp_pixel_type_name(src->pixel_type), w0, h0,
+	         gp_pixel_type_name(dst->pixel_type), w1, h1, cx, cy, cw, ch);
+
+	/* Raw source rectangle and the written part of the scaled image */
+	s.sx = x0;
+	s.sy = y0;
+	s.sw = w0;
+	s.sh = h0;
+	rect_to_raw(src, gp_pixmap_w(src), gp_pixmap_h(src),
+	            &s.sx, &s.sy, &s.sw, &s.sh);
+
+	s.fw = src->axes_swap ? h1 : w1;
+	s.fh = src->axes_swap ? w1 : h1;
+	s.rx = cx - x1;
+	s.ry = cy - y1;
+	s.rw = cw;
+	s.rh = ch;
+	rect_to_raw(src, w1, h1, &s.rx, &s.ry, &s.rw, &s.rh);
+
+	if (s.sw == 2 * s.fw)
+		s.x_half = 1;
+
+	if (type == GP_BLIT_SCALE_NN && s.fw % s.sw == 0)
+		s.x_up = s.fw / s.sw;
+
+	chans = type == GP_BLIT_SCALE_LINEAR ? linear_chans(src->pixel_type) : 0;
+	size = (2 + 2 * chans) * sizeof(uint32_t) * s.rw + s.rw;
+
+	/* Both the direct and the strip blit write into dst */
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	s.xmap = (uint32_t*)buf;
+	s.xmap1 = s.xmap + s.rw;
+	s.rows[0] = s.xmap1 + s.rw;
+	s.rows[1] = s.rows[0] + s.rw * chans;
+	s.xw = (uint8_t*)(s.rows[1] + s.rw * chans);
+
+	for (i = 0; i < (gp_coord)s.rw; i++) {
+		if (type == GP_BLIT_SCALE_LINEAR) {
+			linear_map(s.rx + i, s.sw, s.fw,
+			           &s.xmap[i], &s.xmap1[i], &s.xw[i]);
+			continue;
+		}
+
+		s.xmap[i] = nn_map(s.rx + i, s.sw, s.fw);
+
+		if (!(src->bpp % 8))
+			s.xmap[i] *= src->bpp / 8;
+	}
+
+	if (src->pixel_type == dst->pixel_type && same_rotation(src, dst)) {
+		gp_coord px = cx, py = cy;
+		gp_size pw = cw, ph = ch;
+
+		gp_pixmap_damage_xyxy(dst, cx, cy, cx + cw - 1, cy + ch - 1);
+
+		rect_to_raw(dst, gp_pixmap_w(dst), gp_pixmap_h(dst),
+		            &px, &py, &pw, &ph);
+
+		scale_rows(&s, type, s.ry, s.rh, dst, px, py);
+	} else {
+		ret = scale_strips(&s, type, dst, x1, y1);
+	}
+
+	gp_temp_free(size, buf);
+	return ret;
+}
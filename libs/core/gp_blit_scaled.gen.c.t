@@ -0,0 +1,473 @@
+@ include source.t
+/*
+ * Scaled blits.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_damage.h>
+#include <core/gp_blit.h>
+
+/* Generated functions */
+void gp_blit_xyxy_fast(const gp_pixmap *src,
+                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2);
+
+/*
+ * The source rectangle is scaled in the source orientation, i.e. the scaled
+ * image has the same rotation flags as the source and its raw pixels are
+ * interpolated from the source raw rectangle. The mapping samples the pixel
+ * centers so it's symmetric and does not depend on the mirroring.
+ *
+ * If the destination has the same pixel type and rotation the scaled pixels
+ * are written directly into it, otherwise the scaled image is produced in
+ * strips and blitted with the regular blit that converts the pixel type and
+ * rotation.
+ */
+#define SCALE_STRIP 16
+
+struct scale {
+	const gp_pixmap *src;
+	/* Source raw rectangle */
+	gp_coord sx, sy;
+	gp_size sw, sh;
+	/* Scaled image raw size */
+	gp_size fw, fh;
+	/* Raw rectangle of the scaled image that is being written */
+	gp_coord rx, ry;
+	gp_size rw, rh;
+
+	/* Source pixel per column, in bytes for byte aligned nearest neighbour */
+	uint32_t *xmap;
+	/* Right pixel offset and weight for bilinear interpolation */
+	uint32_t *xmap1;
+	uint8_t *xw;
+	/* Integer upscale factor or 0 */
+	unsigned int x_up;
+	/* Source is exactly two times larger */
+	int x_half;
+
+	/* Cached horizontally interpolated rows for bilinear interpolation */
+	uint32_t *rows[2];
+	gp_coord rows_y[2];
+};
+
+static uint32_t nn_map(gp_coord i, gp_size from, gp_size to)
+{
+	return ((2 * (uint64_t)i + 1) * from) / (2 * (uint64_t)to);
+}
+
+static void linear_map(gp_coord i, gp_size from, gp_size to,
+                       uint32_t *a, uint32_t *b, uint8_t *w)
+{
+	int64_t pos = (((2 * (int64_t)i + 1) * from)<<16) / (2 * (int64_t)to) - (1<<15);
+
+	if (pos < 0)
+		pos = 0;
+
+	*a = pos>>16;
+	*w = (pos>>8) & 0xff;
+
+	if (*a >= from - 1) {
+		*a = from - 1;
+		*w = 0;
+	}
+
+	*b = *w ? *a + 1 : *a;
+}
+
+@ for ps in pixelsizes:
+static void scale_nn_{{ ps.suffix }}(const struct scale *s, gp_coord r0, gp_size rows,
+                            gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i, j;
+@     if not ps.needs_bit_endian():
+	gp_coord prev = -1;
+@     end
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		gp_coord y = s->sy + nn_map(r0 + j, s->sh, s->fh);
+@     if ps.needs_bit_endian():
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+			gp_pixel p = gp_getpixel_raw_{{ ps.suffix }}(src, s->sx + s->xmap[i], y);
+
+			gp_putpixel_raw_{{ ps.suffix }}(out, px + i, py + j, p);
+		}
+@     else:
+@         bpp = ps.size // 8
+		const uint8_t *sp = (const uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(src, s->sx, y);
+		uint8_t *dp = (uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(out, px, py + j);
+
+		/* Upscaled rows repeat, copy the previous one */
+		if (y == prev) {
+			memcpy(dp, dp - out->bytes_per_row, (size_t)s->rw * {{ bpp }});
+			continue;
+		}
+
+		prev = y;
+
+		if (s->x_up) {
+			gp_coord x = s->rx;
+			unsigned int k = x % s->x_up;
+
+			sp += (x / s->x_up) * {{ bpp }};
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, {{ bpp }});
+				dp += {{ bpp }};
+				if (++k == s->x_up) {
+					sp += {{ bpp }};
+					k = 0;
+				}
+			}
+		} else if (s->x_half) {
+			sp += (2 * s->rx + 1) * {{ bpp }};
+
+			for (i = 0; i < (gp_coord)s->rw; i++) {
+				memcpy(dp, sp, {{ bpp }});
+				dp += {{ bpp }};
+				sp += 2 * {{ bpp }};
+			}
+		} else {
+			for (i = 0; i < (gp_coord)s->rw; i++)
+				memcpy(dp + i * {{ bpp }}, sp + s->xmap[i], {{ bpp }});
+		}
+@     end
+	}
+}
+
+@ end
+static void scale_nn(const struct scale *s, gp_coord r0, gp_size rows,
+                     gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	GP_FN_PER_BPP_PIXMAP(scale_nn, s->src, s, r0, rows, out, px, py);
+}
+
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+/*
+ * Interpolates source row horizontally, the channels are stored in blocks of
+ * rw values multiplied by 256.
+ */
+static void linear_row_{{ pt.name }}(const struct scale *s, gp_coord y, uint32_t *row)
+{
+	const gp_pixmap *src = s->src;
+	gp_coord i;
+
+	for (i = 0; i < (gp_coord)s->rw; i++) {
+		gp_pixel p0 = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, s->sx + s->xmap[i], y);
+		gp_pixel p1 = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, s->sx + s->xmap1[i], y);
+
+		if (s->x_half) {
+@         for j, c in enumerate(pt.chanslist):
+			row[{{ j }} * s->rw + i] = (GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p0) +
+			                  GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p1))<<7;
+@         end
+		} else {
+			uint32_t w = s->xw[i];
+
+@         for j, c in enumerate(pt.chanslist):
+			row[{{ j }} * s->rw + i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p0) * (256 - w) +
+			                  GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p1) * w;
+@         end
+		}
+	}
+}
+
+static void scale_linear_{{ pt.name }}(struct scale *s, gp_coord r0, gp_size rows,
+                                 gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	gp_coord i, j, k;
+
+	for (j = 0; j < (gp_coord)rows; j++) {
+		uint32_t y[2], *row[2];
+		uint8_t w;
+
+		linear_map(r0 + j, s->sh, s->fh, &y[0], &y[1], &w);
+
+		/* Reuse the cached rows, upscaled images share them */
+		for (k = 0; k < 2; k++) {
+			gp_coord sy = s->sy + y[k];
+
+			if (s->rows_y[k] != sy && s->rows_y[!k] == sy) {
+				GP_SWAP(s->rows[0], s->rows[1]);
+				GP_SWAP(s->rows_y[0], s->rows_y[1]);
+			}
+
+			if (s->rows_y[k] != sy) {
+				linear_row_{{ pt.name }}(s, sy, s->rows[k]);
+				s->rows_y[k] = sy;
+			}
+
+			row[k] = s->rows[k];
+		}
+
+		for (i = 0; i < (gp_coord)s->rw; i++) {
+@         for j, c in enumerate(pt.chanslist):
+			uint32_t {{ c.name }} = (row[0][{{ j }} * s->rw + i] * (256 - w) +
+			             row[1][{{ j }} * s->rw + i] * w + (1<<15))>>16;
+@         end
+
+			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(out, px + i, py + j,
+				GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }}));
+		}
+	}
+}
+
+@ end
+@
+static void scale_linear(struct scale *s, gp_coord r0, gp_size rows,
+                         gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	switch (s->src->pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		scale_linear_{{ pt.name }}(s, r0, rows, out, px, py);
+	break;
+@ end
+	default:
+	break;
+	}
+}
+
+static unsigned int linear_chans(gp_pixel_type type)
+{
+	switch (type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		return {{ len(pt.chanslist) }};
+@ end
+	default:
+		return 0;
+	}
+}
+
+static void scale_rows(struct scale *s, enum gp_blit_scale_type type,
+                       gp_coord r0, gp_size rows,
+                       gp_pixmap *out, gp_coord px, gp_coord py)
+{
+	if (type == GP_BLIT_SCALE_LINEAR)
+		scale_linear(s, r0, rows, out, px, py);
+	else
+		scale_nn(s, r0, rows, out, px, py);
+}
+
+/*
+ * Converts a rectangle in the user coordinates of a w x h image with the
+ * pixmap rotation flags into raw coordinates and back.
+ */
+static void rect_to_raw(const gp_pixmap *p, gp_size w, gp_size h,
+                        gp_coord *x, gp_coord *y, gp_size *rw, gp_size *rh)
+{
+	if (p->axes_swap) {
+		GP_SWAP(*x, *y);
+		GP_SWAP(*rw, *rh);
+		GP_SWAP(w, h);
+	}
+
+	if (p->x_swap)
+		*x = w - *x - *rw;
+
+	if (p->y_swap)
+		*y = h - *y - *rh;
+}
+
+static void rect_from_raw(const gp_pixmap *p, gp_size w, gp_size h,
+                          gp_coord *x, gp_coord *y, gp_size *rw, gp_size *rh)
+{
+	if (p->axes_swap)
+		GP_SWAP(w, h);
+
+	if (p->x_swap)
+		*x = w - *x - *rw;
+
+	if (p->y_swap)
+		*y = h - *y - *rh;
+
+	if (p->axes_swap) {
+		GP_SWAP(*x, *y);
+		GP_SWAP(*rw, *rh);
+	}
+}
+
+static int same_rotation(const gp_pixmap *a, const gp_pixmap *b)
+{
+	return a->axes_swap == b->axes_swap &&
+	       a->x_swap == b->x_swap &&
+	       a->y_swap == b->y_swap;
+}
+
+/*
+ * Blits the scaled image in strips, the strips have the source pixel type and
+ * rotation flags.
+ */
+static int scale_strips(struct scale *s, enum gp_blit_scale_type type,
+                        gp_pixmap *dst, gp_coord x1, gp_coord y1)
+{
+	const gp_pixmap *src = s->src;
+	size_t size = (size_t)GP_CALC_ROW_SIZE(src->pixel_type, s->rw) * SCALE_STRIP;
+	gp_pixmap strip;
+	gp_size j, rows;
+	void *buf;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (j = 0; j < s->rh; j += rows) {
+		gp_coord x = s->rx, y = s->ry + j;
+		gp_size w, h;
+
+		rows = GP_MIN((gp_size)SCALE_STRIP, s->rh - j);
+
+		gp_pixmap_init(&strip, s->rw, rows, src->pixel_type, buf);
+		strip.bit_endian = src->bit_endian;
+		gp_pixmap_set_rotation(&strip, src->axes_swap,
+		                       src->x_swap, src->y_swap);
+
+		scale_rows(s, type, y, rows, &strip, 0, 0);
+
+		w = s->rw;
+		h = rows;
+		rect_from_raw(src, s->fw, s->fh, &x, &y, &w, &h);
+
+		gp_blit_xyxy_fast(&strip, 0, 0, w - 1, h - 1,
+		                  dst, x1 + x, y1 + y);
+	}
+
+	gp_temp_free(size, buf);
+	return 0;
+}
+
+int gp_blit_scaled(const gp_pixmap *src,
+                   gp_coord x0, gp_coord y0, gp_size w0, gp_size h0,
+                   gp_pixmap *dst,
+                   gp_coord x1, gp_coord y1, gp_size w1, gp_size h1,
+                   enum gp_blit_scale_type type)
+{
+	struct scale s = {
+		.src = src,
+		.rows_y = {-1, -1},
+	};
+	gp_coord cx, cy, i;
+	gp_size cw, ch;
+	unsigned int chans;
+	size_t size;
+	uint8_t *buf;
+	int ret = 0;
+
+	if (!w0 || !h0 || !w1 || !h1)
+		return 0;
+
+	/* Source rectangle is inside of the source pixmap */
+	GP_CHECK(x0 >= 0 && y0 >= 0);
+	GP_CHECK(x0 + w0 <= gp_pixmap_w(src));
+	GP_CHECK(y0 + h0 <= gp_pixmap_h(src));
+
+	if (type == GP_BLIT_SCALE_LINEAR && !linear_chans(src->pixel_type)) {
+		GP_DEBUG(1, "Bilinear scaling not supported for %s, using nearest",
+		         gp_pixel_type_name(src->pixel_type));
+		type = GP_BLIT_SCALE_NN;
+	}
+
+	/* Clip the destination rectangle */
+	cx = GP_MAX(x1, 0);
+	cy = GP_MAX(y1, 0);
+
+	if (x1 + (gp_coord)w1 <= cx || y1 + (gp_coord)h1 <= cy ||
+	    cx >= (gp_coord)gp_pixmap_w(dst) || cy >= (gp_coord)gp_pixmap_h(dst))
+		return 0;
+
+	cw = GP_MIN(x1 + (gp_coord)w1, (gp_coord)gp_pixmap_w(dst)) - cx;
+	ch = GP_MIN(y1 + (gp_coord)h1, (gp_coord)gp_pixmap_h(dst)) - cy;
+
+	GP_DEBUG(2, "Scaling %s %ux%u -> %s %ux%u clipped to %ix%i-%ux%u",
+	         gp_pixel_type_name(src->pixel_type), w0, h0,
+	         gp_pixel_type_name(dst->pixel_type), w1, h1, cx, cy, cw, ch);
+
+	/* Raw source rectangle and the written part of the scaled image */
+	s.sx = x0;
+	s.sy = y0;
+	s.sw = w0;
+	s.sh = h0;
+	rect_to_raw(src, gp_pixmap_w(src), gp_pixmap_h(src),
+	            &s.sx, &s.sy, &s.sw, &s.sh);
+
+	s.fw = src->axes_swap ? h1 : w1;
+	s.fh = src->axes_swap ? w1 : h1;
+	s.rx = cx - x1;
+	s.ry = cy - y1;
+	s.rw = cw;
+	s.rh = ch;
+	rect_to_raw(src, w1, h1, &s.rx, &s.ry, &s.rw, &s.rh);
+
+	if (s.sw == 2 * s.fw)
+		s.x_half = 1;
+
+	if (type == GP_BLIT_SCALE_NN && s.fw % s.sw == 0)
+		s.x_up = s.fw / s.sw;
+
+	chans = type == GP_BLIT_SCALE_LINEAR ? linear_chans(src->pixel_type) : 0;
+	size = (2 + 2 * chans) * sizeof(uint32_t) * s.rw + s.rw;
+
+	/* Both the direct and the strip blit write into dst */
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	buf = gp_temp_alloc(size);
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	s.xmap = (uint32_t*)buf;
+	s.xmap1 = s.xmap + s.rw;
+	s.rows[0] = s.xmap1 + s.rw;
+	s.rows[1] = s.rows[0] + s.rw * chans;
+	s.xw = (uint8_t*)(s.rows[1] + s.rw * chans);
+
+	for (i = 0; i < (gp_coord)s.rw; i++) {
+		if (type == GP_BLIT_SCALE_LINEAR) {
+			linear_map(s.rx + i, s.sw, s.fw,
+			           &s.xmap[i], &s.xmap1[i], &s.xw[i]);
+			continue;
+		}
+
+		s.xmap[i] = nn_map(s.rx + i, s.sw, s.fw);
+
+		if (!(src->bpp % 8))
+			s.xmap[i] *= src->bpp / 8;
+	}
+
+	if (src->pixel_type == dst->pixel_type && same_rotation(src, dst)) {
+		gp_coord px = cx, py = cy;
+		gp_size pw = cw, ph = ch;
+
+		gp_pixmap_damage_xyxy(dst, cx, cy, cx + cw - 1, cy + ch - 1);
+
+		rect_to_raw(dst, gp_pixmap_w(dst), gp_pixmap_h(dst),
+		            &px, &py, &pw, &ph);
+
+		scale_rows(&s, type, s.ry, s.rh, dst, px, py);
+	} else {
+		ret = scale_strips(&s, type, dst, x1, y1);
+	}
+
+	gp_temp_free(size, buf);
+	return ret;
+}
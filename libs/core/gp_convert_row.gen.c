@@ -0,0 +1,7356 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_convert_row.gen.c
+ *
+ * GENERATED on 2026 10 17 03:51:00 from gp_convert_row.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Whole row pixel type converters and alpha compositors.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+#include <core/gp_convert.h>
+#include <core/gp_mix_pixels2.gen.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+/*
+ * Converts a row of xRGB8888 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGBA8888_resolve;
+
+static void convert_row_xRGB8888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB888_resolve;
+
+static void convert_row_xRGB8888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_BGR888_resolve;
+
+static void convert_row_xRGB8888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB555_resolve;
+
+static void convert_row_xRGB8888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB565_resolve;
+
+static void convert_row_xRGB8888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB332_resolve;
+
+static void convert_row_xRGB8888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_G8_resolve;
+
+static void convert_row_xRGB8888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_G8()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of xRGB8888 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_xRGB8888_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_xRGB8888_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_xRGB8888_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_xRGB8888_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_xRGB8888_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_xRGB8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_xRGB8888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_xRGB8888_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGBA8888_PM_resolve;
+
+static void convert_row_xRGB8888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_xRGB8888_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_xRGB8888_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_xRGB8888_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_xRGB8888_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_xRGB8888_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_xRGB8888_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_xRGB8888_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_xRGB8888_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGBA8888 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_RGBA8888_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		GP_PIXEL_RGBA8888_TO_RGBA8888_PM(p1, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGBA8888_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGBA8888_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGBA8888_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGBA8888_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGBA8888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGBA8888_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGBA8888_RGBA8888_PM_resolve;
+
+static void convert_row_RGBA8888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGBA8888_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGBA8888_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGBA8888_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGBA8888_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGBA8888_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_RGBA8888_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGBA8888_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGBA8888_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_RGB888_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_xRGB8888_resolve;
+
+static void convert_row_RGB888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_RGB888_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGBA8888_resolve;
+
+static void convert_row_RGB888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_RGB888_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 3) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_BGR888_resolve;
+
+static void convert_row_RGB888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_RGB888_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB555_resolve;
+
+static void convert_row_RGB888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_RGB888_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB565_resolve;
+
+static void convert_row_RGB888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_RGB888_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB332_resolve;
+
+static void convert_row_RGB888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_RGB888_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_G8_resolve;
+
+static void convert_row_RGB888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_G8()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB888 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_RGB888_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB888_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB888_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB888_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB888_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB888_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGBA8888_PM_resolve;
+
+static void convert_row_RGB888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB888_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB888_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB888_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB888_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB888_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_RGB888_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB888_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB888_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_BGR888_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_xRGB8888_resolve;
+
+static void convert_row_BGR888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGBA8888_resolve;
+
+static void convert_row_BGR888_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 3) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB888_resolve;
+
+static void convert_row_BGR888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB555_resolve;
+
+static void convert_row_BGR888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB565_resolve;
+
+static void convert_row_BGR888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB332_resolve;
+
+static void convert_row_BGR888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_BGR888_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_G8_resolve;
+
+static void convert_row_BGR888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_G8()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of BGR888 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_BGR888_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3, d += 1) {
+		gp_pixel p1 = (s[0] | s[1]<<8 | s[2]<<16);
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_BGR888_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_BGR888_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_BGR888_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_BGR888_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_BGR888_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_BGR888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_BGR888_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGBA8888_PM_resolve;
+
+static void convert_row_BGR888_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_BGR888_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_BGR888_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_BGR888_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_BGR888_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_BGR888_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_BGR888_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_BGR888_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_BGR888_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_RGB555_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_xRGB8888_resolve;
+
+static void convert_row_RGB555_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_RGB555_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGBA8888_resolve;
+
+static void convert_row_RGB555_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_RGB555_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB888_resolve;
+
+static void convert_row_RGB555_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_RGB555_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_BGR888_resolve;
+
+static void convert_row_RGB555_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_RGB555_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB565_resolve;
+
+static void convert_row_RGB555_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_RGB555_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB332_resolve;
+
+static void convert_row_RGB555_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_RGB555_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_G8_resolve;
+
+static void convert_row_RGB555_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_G8()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB555 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_RGB555_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB555_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB555_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB555_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB555_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB555_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB555_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB555_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGBA8888_PM_resolve;
+
+static void convert_row_RGB555_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB555_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB555_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB555_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB555_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB555_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_RGB555_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB555_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB555_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_RGB565_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_xRGB8888_resolve;
+
+static void convert_row_RGB565_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_RGB565_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGBA8888_resolve;
+
+static void convert_row_RGB565_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_RGB565_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB888_resolve;
+
+static void convert_row_RGB565_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_RGB565_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_BGR888_resolve;
+
+static void convert_row_RGB565_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_RGB565_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB555_resolve;
+
+static void convert_row_RGB565_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_RGB565_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB332_resolve;
+
+static void convert_row_RGB565_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_RGB565_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_G8_resolve;
+
+static void convert_row_RGB565_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_G8()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB565 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_RGB565_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint16_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB565_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB565_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB565_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB565_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB565_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB565_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB565_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGBA8888_PM_resolve;
+
+static void convert_row_RGB565_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB565_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB565_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB565_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB565_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB565_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_RGB565_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB565_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB565_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_RGB332_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_xRGB8888_resolve;
+
+static void convert_row_RGB332_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_RGB332_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGBA8888_resolve;
+
+static void convert_row_RGB332_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_RGB332_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB888_resolve;
+
+static void convert_row_RGB332_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_RGB332_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_BGR888_resolve;
+
+static void convert_row_RGB332_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_RGB332_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB555_resolve;
+
+static void convert_row_RGB332_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_RGB332_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB565_resolve;
+
+static void convert_row_RGB332_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to G8.
+ */
+GP_SIMD_BODY void convert_row_RGB332_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_G8(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_G8_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_G8_resolve;
+
+static void convert_row_RGB332_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_G8()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGB332 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_RGB332_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGB332_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGB332_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGB332_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGB332_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGB332_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGB332_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGB332_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGBA8888_PM_resolve;
+
+static void convert_row_RGB332_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGB332_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGB332_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGB332_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGB332_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGB332_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_RGB332_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGB332_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGB332_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to xRGB8888.
+ */
+GP_SIMD_BODY void convert_row_G8_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_xRGB8888_resolve;
+
+static void convert_row_G8_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_xRGB8888()", variant);
+
+	__atomic_store_n(&convert_row_G8_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_G8_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGBA8888_resolve;
+
+static void convert_row_G8_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGB888.
+ */
+GP_SIMD_BODY void convert_row_G8_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB888_resolve;
+
+static void convert_row_G8_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGB888()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to BGR888.
+ */
+GP_SIMD_BODY void convert_row_G8_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+		d[0] = p3 & 0xff;
+		d[1] = (p3 >> 8) & 0xff;
+		d[2] = (p3 >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_BGR888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_BGR888_resolve;
+
+static void convert_row_G8_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_BGR888()", variant);
+
+	__atomic_store_n(&convert_row_G8_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGB555.
+ */
+GP_SIMD_BODY void convert_row_G8_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB555_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB555_resolve;
+
+static void convert_row_G8_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGB555()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGB565.
+ */
+GP_SIMD_BODY void convert_row_G8_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB565_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB565_resolve;
+
+static void convert_row_G8_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGB565()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGB332.
+ */
+GP_SIMD_BODY void convert_row_G8_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGB332_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB332_resolve;
+
+static void convert_row_G8_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGB332()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of G8 pixels to RGBA8888_PM.
+ */
+GP_SIMD_BODY void convert_row_G8_RGBA8888_PM_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint8_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_G8_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_G8_RGBA8888_PM_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_PM_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_G8_RGBA8888_PM_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_G8_RGBA8888_PM_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_G8_RGBA8888_PM_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_G8_RGBA8888_PM_body(dst, src, w);
+}
+#endif
+
+static void convert_row_G8_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_G8_RGBA8888_PM_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGBA8888_PM_resolve;
+
+static void convert_row_G8_RGBA8888_PM_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_G8_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_G8_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_G8_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_G8_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_G8_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&convert_row_G8_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_G8_RGBA8888_PM(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_G8_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Converts a row of RGBA8888_PM pixels to RGBA8888.
+ */
+GP_SIMD_BODY void convert_row_RGBA8888_PM_RGBA8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p1 = s[0];
+		gp_pixel p3 = 0;
+
+		GP_PIXEL_RGBA8888_PM_TO_RGBA8888(p1, p3);
+		d[0] = p3;
+	}
+}
+
+GP_SIMD_VARIANT
+static void convert_row_RGBA8888_PM_RGBA8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_PM_RGBA8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void convert_row_RGBA8888_PM_RGBA8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_PM_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void convert_row_RGBA8888_PM_RGBA8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_PM_RGBA8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void convert_row_RGBA8888_PM_RGBA8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	convert_row_RGBA8888_PM_RGBA8888_body(dst, src, w);
+}
+#endif
+
+static void convert_row_RGBA8888_PM_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*convert_row_RGBA8888_PM_RGBA8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGBA8888_PM_RGBA8888_resolve;
+
+static void convert_row_RGBA8888_PM_RGBA8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = convert_row_RGBA8888_PM_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = convert_row_RGBA8888_PM_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = convert_row_RGBA8888_PM_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = convert_row_RGBA8888_PM_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of convert_row_RGBA8888_PM_RGBA8888()", variant);
+
+	__atomic_store_n(&convert_row_RGBA8888_PM_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void convert_row_RGBA8888_PM_RGBA8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&convert_row_RGBA8888_PM_RGBA8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+
+/*
+ * Blends a row of RGBA8888 pixels onto xRGB8888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_xRGB8888(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_xRGB8888_resolve;
+
+static void blend_row_RGBA8888_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_xRGB8888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto RGB888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_RGB888(s[0], (d[0] | d[1]<<8 | d[2]<<16));
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB888_resolve;
+
+static void blend_row_RGBA8888_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_RGB888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto BGR888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_BGR888(s[0], (d[0] | d[1]<<8 | d[2]<<16));
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_BGR888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_BGR888_resolve;
+
+static void blend_row_RGBA8888_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_BGR888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto RGB555.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_RGB555(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB555_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB555_resolve;
+
+static void blend_row_RGBA8888_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_RGB555()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto RGB565.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_RGB565(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB565_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB565_resolve;
+
+static void blend_row_RGBA8888_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_RGB565()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto RGB332.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_RGB332(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_RGB332_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB332_resolve;
+
+static void blend_row_RGBA8888_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_RGB332()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888 pixels onto G8.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_G8(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_G8_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_G8_resolve;
+
+static void blend_row_RGBA8888_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_G8()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto xRGB8888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_xRGB8888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_xRGB8888(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_xRGB8888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_xRGB8888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_xRGB8888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_xRGB8888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_xRGB8888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_xRGB8888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_xRGB8888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_xRGB8888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_xRGB8888_resolve;
+
+static void blend_row_RGBA8888_PM_xRGB8888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_xRGB8888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_xRGB8888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_xRGB8888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto RGB888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_RGB888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_RGB888(s[0], (d[0] | d[1]<<8 | d[2]<<16));
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_RGB888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_RGB888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_RGB888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_RGB888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_RGB888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB888_resolve;
+
+static void blend_row_RGBA8888_PM_RGB888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_RGB888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_RGB888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_RGB888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto BGR888.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_BGR888_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 3) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_BGR888(s[0], (d[0] | d[1]<<8 | d[2]<<16));
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_BGR888_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_BGR888_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_BGR888_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_BGR888_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_BGR888_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_BGR888_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_BGR888_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_BGR888_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_BGR888_resolve;
+
+static void blend_row_RGBA8888_PM_BGR888_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_BGR888()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_BGR888(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_BGR888_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto RGB555.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_RGB555_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_RGB555(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_RGB555_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB555_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_RGB555_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_RGB555_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB555_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_RGB555_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB555_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_RGB555_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB555_resolve;
+
+static void blend_row_RGBA8888_PM_RGB555_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_RGB555()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_RGB555(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_RGB555_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto RGB565.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_RGB565_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_RGB565(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_RGB565_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB565_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_RGB565_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_RGB565_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB565_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_RGB565_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB565_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_RGB565_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB565_resolve;
+
+static void blend_row_RGBA8888_PM_RGB565_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_RGB565()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_RGB565(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_RGB565_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto RGB332.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_RGB332_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_RGB332(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_RGB332_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB332_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_RGB332_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_RGB332_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB332_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_RGB332_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_RGB332_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_RGB332_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB332_resolve;
+
+static void blend_row_RGBA8888_PM_RGB332_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_RGB332()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_RGB332(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_RGB332_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Blends a row of RGBA8888_PM pixels onto G8.
+ */
+GP_SIMD_BODY void blend_row_RGBA8888_PM_G8_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const uint32_t *restrict s = src;
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1, d += 1) {
+		gp_pixel p = gp_mix_pixels_RGBA8888_PM_G8(s[0], d[0]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void blend_row_RGBA8888_PM_G8_generic(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_G8_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void blend_row_RGBA8888_PM_G8_sse2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void blend_row_RGBA8888_PM_G8_avx2(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_G8_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void blend_row_RGBA8888_PM_G8_neon(void *restrict dst, const void *restrict src, gp_size w)
+{
+	blend_row_RGBA8888_PM_G8_body(dst, src, w);
+}
+#endif
+
+static void blend_row_RGBA8888_PM_G8_resolve(void *restrict dst, const void *restrict src, gp_size w);
+
+static void (*blend_row_RGBA8888_PM_G8_fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_G8_resolve;
+
+static void blend_row_RGBA8888_PM_G8_resolve(void *restrict dst, const void *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const void *restrict src, gp_size w) = blend_row_RGBA8888_PM_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = blend_row_RGBA8888_PM_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = blend_row_RGBA8888_PM_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = blend_row_RGBA8888_PM_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of blend_row_RGBA8888_PM_G8()", variant);
+
+	__atomic_store_n(&blend_row_RGBA8888_PM_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void blend_row_RGBA8888_PM_G8(void *restrict dst, const void *restrict src, gp_size w)
+{
+	__atomic_load_n(&blend_row_RGBA8888_PM_G8_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+/*
+ * Ordered dithering thresholds, 8x8 Bayer matrix scaled to 2 - 254.
+ */
+static const uint8_t dither_thresholds[8][8] = {
+	{  2, 130,  34, 162,  10, 138,  42, 170},
+	{194,  66, 226,  98, 202,  74, 234, 106},
+	{ 50, 178,  18, 146,  58, 186,  26, 154},
+	{242, 114, 210,  82, 250, 122, 218,  90},
+	{ 14, 142,  46, 174,   6, 134,  38, 166},
+	{206,  78, 238, 110, 198,  70, 230, 102},
+	{ 62, 190,  30, 158,  54, 182,  22, 150},
+	{254, 126, 222,  94, 246, 118, 214,  86},
+};
+
+/*
+ * Quantizes 8 bit value to 0 - max, the t is the dither threshold.
+ *
+ * Computes (v * max + t) / 255, the division is exact for the whole range.
+ */
+static inline unsigned int dither_val(unsigned int v, unsigned int max,
+                                      unsigned int t)
+{
+	unsigned int x = v * max + t;
+
+	return (x + 1 + (x >> 8)) >> 8;
+}
+
+/*
+ * The thresholds are repeated for a chunk of a row so that the vectorized
+ * functions can load them as a vector, has to be multiple of 8.
+ */
+#define DITHER_CHUNK 64
+
+/*
+ * Converts a row of RGBA8888 pixels to RGB555 with ordered dithering.
+ */
+GP_SIMD_BODY void dither_pixels_RGB555_body(void *restrict dst,
+                                     const uint32_t *restrict src,
+                                     const uint8_t *restrict thr, gp_size w)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i];
+		gp_pixel p = dither_val((s >> 24) & 0xff, 0x1f, t) << 10 |
+		             dither_val((s >> 16) & 0xff, 0x1f, t) << 5 |
+		             dither_val((s >> 8) & 0xff, 0x1f, t) << 0;
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void dither_pixels_RGB555_generic(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB555_body(dst, src, thr, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void dither_pixels_RGB555_sse2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB555_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void dither_pixels_RGB555_avx2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB555_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void dither_pixels_RGB555_neon(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB555_body(dst, src, thr, w);
+}
+#endif
+
+static void dither_pixels_RGB555_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w);
+
+static void (*dither_pixels_RGB555_fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB555_resolve;
+
+static void dither_pixels_RGB555_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = dither_pixels_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = dither_pixels_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = dither_pixels_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of dither_pixels_RGB555()", variant);
+
+	__atomic_store_n(&dither_pixels_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, thr, w);
+}
+
+static inline void dither_pixels_RGB555(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	__atomic_load_n(&dither_pixels_RGB555_fn, __ATOMIC_RELAXED)(dst, src, thr, w);
+}
+
+static void dither_row_RGB555(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	gp_size n;
+
+	for (i = 0; i < w; i += n) {
+		n = GP_MIN(w - i, (gp_size)DITHER_CHUNK);
+		dither_pixels_RGB555(GP_PIXEL_ADDR(dst, x + i, y), src + i, thr, n);
+	}
+}
+
+/*
+ * Converts a row of RGBA8888 pixels to RGB565 with ordered dithering.
+ */
+GP_SIMD_BODY void dither_pixels_RGB565_body(void *restrict dst,
+                                     const uint32_t *restrict src,
+                                     const uint8_t *restrict thr, gp_size w)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i];
+		gp_pixel p = dither_val((s >> 24) & 0xff, 0x1f, t) << 11 |
+		             dither_val((s >> 16) & 0xff, 0x3f, t) << 5 |
+		             dither_val((s >> 8) & 0xff, 0x1f, t) << 0;
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void dither_pixels_RGB565_generic(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB565_body(dst, src, thr, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void dither_pixels_RGB565_sse2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB565_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void dither_pixels_RGB565_avx2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB565_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void dither_pixels_RGB565_neon(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB565_body(dst, src, thr, w);
+}
+#endif
+
+static void dither_pixels_RGB565_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w);
+
+static void (*dither_pixels_RGB565_fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB565_resolve;
+
+static void dither_pixels_RGB565_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = dither_pixels_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = dither_pixels_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = dither_pixels_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of dither_pixels_RGB565()", variant);
+
+	__atomic_store_n(&dither_pixels_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, thr, w);
+}
+
+static inline void dither_pixels_RGB565(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	__atomic_load_n(&dither_pixels_RGB565_fn, __ATOMIC_RELAXED)(dst, src, thr, w);
+}
+
+static void dither_row_RGB565(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	gp_size n;
+
+	for (i = 0; i < w; i += n) {
+		n = GP_MIN(w - i, (gp_size)DITHER_CHUNK);
+		dither_pixels_RGB565(GP_PIXEL_ADDR(dst, x + i, y), src + i, thr, n);
+	}
+}
+
+static void dither_row_RGB666(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	for (i = 0; i < w; i++) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i % DITHER_CHUNK];
+		gp_pixel p = dither_val((s >> 24) & 0xff, 0x3f, t) << 12 |
+		             dither_val((s >> 16) & 0xff, 0x3f, t) << 6 |
+		             dither_val((s >> 8) & 0xff, 0x3f, t) << 0;
+		gp_putpixel_raw_18BPP_LE(dst, x + i, y, p);
+	}
+}
+
+/*
+ * Converts a row of RGBA8888 pixels to RGB332 with ordered dithering.
+ */
+GP_SIMD_BODY void dither_pixels_RGB332_body(void *restrict dst,
+                                     const uint32_t *restrict src,
+                                     const uint8_t *restrict thr, gp_size w)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i];
+		gp_pixel p = dither_val((s >> 24) & 0xff, 0x7, t) << 5 |
+		             dither_val((s >> 16) & 0xff, 0x7, t) << 2 |
+		             dither_val((s >> 8) & 0xff, 0x3, t) << 0;
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void dither_pixels_RGB332_generic(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB332_body(dst, src, thr, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void dither_pixels_RGB332_sse2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB332_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void dither_pixels_RGB332_avx2(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB332_body(dst, src, thr, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void dither_pixels_RGB332_neon(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	dither_pixels_RGB332_body(dst, src, thr, w);
+}
+#endif
+
+static void dither_pixels_RGB332_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w);
+
+static void (*dither_pixels_RGB332_fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB332_resolve;
+
+static void dither_pixels_RGB332_resolve(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w) = dither_pixels_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = dither_pixels_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = dither_pixels_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = dither_pixels_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of dither_pixels_RGB332()", variant);
+
+	__atomic_store_n(&dither_pixels_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, thr, w);
+}
+
+static inline void dither_pixels_RGB332(void *restrict dst, const uint32_t *restrict src, const uint8_t *restrict thr, gp_size w)
+{
+	__atomic_load_n(&dither_pixels_RGB332_fn, __ATOMIC_RELAXED)(dst, src, thr, w);
+}
+
+static void dither_row_RGB332(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	gp_size n;
+
+	for (i = 0; i < w; i += n) {
+		n = GP_MIN(w - i, (gp_size)DITHER_CHUNK);
+		dither_pixels_RGB332(GP_PIXEL_ADDR(dst, x + i, y), src + i, thr, n);
+	}
+}
+
+static void dither_row_G1(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	for (i = 0; i < w; i++) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i % DITHER_CHUNK];
+		unsigned int v = (((s >> 24) & 0xff) + ((s >> 16) & 0xff) + ((s >> 8) & 0xff)) / 3;
+		gp_pixel p = dither_val(v, 0x1, t) << 0;
+		gp_putpixel_raw_1BPP_LE(dst, x + i, y, p);
+	}
+}
+
+static void dither_row_G2(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	for (i = 0; i < w; i++) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i % DITHER_CHUNK];
+		unsigned int v = (((s >> 24) & 0xff) + ((s >> 16) & 0xff) + ((s >> 8) & 0xff)) / 3;
+		gp_pixel p = dither_val(v, 0x3, t) << 0;
+		gp_putpixel_raw_2BPP_LE(dst, x + i, y, p);
+	}
+}
+
+static void dither_row_G4(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+	for (i = 0; i < w; i++) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i % DITHER_CHUNK];
+		unsigned int v = (((s >> 24) & 0xff) + ((s >> 16) & 0xff) + ((s >> 8) & 0xff)) / 3;
+		gp_pixel p = dither_val(v, 0xf, t) << 0;
+		gp_putpixel_raw_4BPP_LE(dst, x + i, y, p);
+	}
+}
+
+gp_dither_row_fn gp_dither_row_get(gp_pixel_type dst)
+{
+	switch (dst) {
+	case GP_PIXEL_RGB555:
+		return dither_row_RGB555;
+	case GP_PIXEL_RGB565:
+		return dither_row_RGB565;
+	case GP_PIXEL_RGB666:
+		return dither_row_RGB666;
+	case GP_PIXEL_RGB332:
+		return dither_row_RGB332;
+	case GP_PIXEL_G1:
+		return dither_row_G1;
+	case GP_PIXEL_G2:
+		return dither_row_G2;
+	case GP_PIXEL_G4:
+		return dither_row_G4;
+	default:
+		return NULL;
+	}
+}
+
+gp_convert_row_fn gp_blend_row_get(gp_pixel_type src, gp_pixel_type dst)
+{
+	switch (src) {
+	case GP_PIXEL_RGBA8888:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return blend_row_RGBA8888_xRGB8888;
+		case GP_PIXEL_RGB888:
+			return blend_row_RGBA8888_RGB888;
+		case GP_PIXEL_BGR888:
+			return blend_row_RGBA8888_BGR888;
+		case GP_PIXEL_RGB555:
+			return blend_row_RGBA8888_RGB555;
+		case GP_PIXEL_RGB565:
+			return blend_row_RGBA8888_RGB565;
+		case GP_PIXEL_RGB332:
+			return blend_row_RGBA8888_RGB332;
+		case GP_PIXEL_G8:
+			return blend_row_RGBA8888_G8;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return blend_row_RGBA8888_PM_xRGB8888;
+		case GP_PIXEL_RGB888:
+			return blend_row_RGBA8888_PM_RGB888;
+		case GP_PIXEL_BGR888:
+			return blend_row_RGBA8888_PM_BGR888;
+		case GP_PIXEL_RGB555:
+			return blend_row_RGBA8888_PM_RGB555;
+		case GP_PIXEL_RGB565:
+			return blend_row_RGBA8888_PM_RGB565;
+		case GP_PIXEL_RGB332:
+			return blend_row_RGBA8888_PM_RGB332;
+		case GP_PIXEL_G8:
+			return blend_row_RGBA8888_PM_G8;
+		default:
+		break;
+		}
+	break;
+	default:
+	break;
+	}
+
+	return NULL;
+}
+
+gp_convert_row_fn gp_convert_row_get(gp_pixel_type src, gp_pixel_type dst)
+{
+	switch (src) {
+	case GP_PIXEL_xRGB8888:
+		switch (dst) {
+		case GP_PIXEL_RGBA8888:
+			return convert_row_xRGB8888_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_xRGB8888_RGB888;
+		case GP_PIXEL_BGR888:
+			return convert_row_xRGB8888_BGR888;
+		case GP_PIXEL_RGB555:
+			return convert_row_xRGB8888_RGB555;
+		case GP_PIXEL_RGB565:
+			return convert_row_xRGB8888_RGB565;
+		case GP_PIXEL_RGB332:
+			return convert_row_xRGB8888_RGB332;
+		case GP_PIXEL_G8:
+			return convert_row_xRGB8888_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_xRGB8888_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst) {
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_RGBA8888_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_RGB888_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_RGB888_RGBA8888;
+		case GP_PIXEL_BGR888:
+			return convert_row_RGB888_BGR888;
+		case GP_PIXEL_RGB555:
+			return convert_row_RGB888_RGB555;
+		case GP_PIXEL_RGB565:
+			return convert_row_RGB888_RGB565;
+		case GP_PIXEL_RGB332:
+			return convert_row_RGB888_RGB332;
+		case GP_PIXEL_G8:
+			return convert_row_RGB888_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_RGB888_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_BGR888_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_BGR888_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_BGR888_RGB888;
+		case GP_PIXEL_RGB555:
+			return convert_row_BGR888_RGB555;
+		case GP_PIXEL_RGB565:
+			return convert_row_BGR888_RGB565;
+		case GP_PIXEL_RGB332:
+			return convert_row_BGR888_RGB332;
+		case GP_PIXEL_G8:
+			return convert_row_BGR888_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_BGR888_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_RGB555_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_RGB555_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_RGB555_RGB888;
+		case GP_PIXEL_BGR888:
+			return convert_row_RGB555_BGR888;
+		case GP_PIXEL_RGB565:
+			return convert_row_RGB555_RGB565;
+		case GP_PIXEL_RGB332:
+			return convert_row_RGB555_RGB332;
+		case GP_PIXEL_G8:
+			return convert_row_RGB555_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_RGB555_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_RGB565_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_RGB565_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_RGB565_RGB888;
+		case GP_PIXEL_BGR888:
+			return convert_row_RGB565_BGR888;
+		case GP_PIXEL_RGB555:
+			return convert_row_RGB565_RGB555;
+		case GP_PIXEL_RGB332:
+			return convert_row_RGB565_RGB332;
+		case GP_PIXEL_G8:
+			return convert_row_RGB565_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_RGB565_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_RGB332_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_RGB332_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_RGB332_RGB888;
+		case GP_PIXEL_BGR888:
+			return convert_row_RGB332_BGR888;
+		case GP_PIXEL_RGB555:
+			return convert_row_RGB332_RGB555;
+		case GP_PIXEL_RGB565:
+			return convert_row_RGB332_RGB565;
+		case GP_PIXEL_G8:
+			return convert_row_RGB332_G8;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_RGB332_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst) {
+		case GP_PIXEL_xRGB8888:
+			return convert_row_G8_xRGB8888;
+		case GP_PIXEL_RGBA8888:
+			return convert_row_G8_RGBA8888;
+		case GP_PIXEL_RGB888:
+			return convert_row_G8_RGB888;
+		case GP_PIXEL_BGR888:
+			return convert_row_G8_BGR888;
+		case GP_PIXEL_RGB555:
+			return convert_row_G8_RGB555;
+		case GP_PIXEL_RGB565:
+			return convert_row_G8_RGB565;
+		case GP_PIXEL_RGB332:
+			return convert_row_G8_RGB332;
+		case GP_PIXEL_RGBA8888_PM:
+			return convert_row_G8_RGBA8888_PM;
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst) {
+		case GP_PIXEL_RGBA8888:
+			return convert_row_RGBA8888_PM_RGBA8888;
+		default:
+		break;
+		}
+	break;
+	default:
+	break;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,233 @@
+@ include source.t
+/*
+ * Whole row pixel type converters and alpha compositors.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+#include <core/gp_convert.h>
+#include <core/gp_mix_pixels2.gen.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+@ include simd.t
+@ include convert_row.t
+@
+@ for src in pixeltypes:
+@     for dst in pixeltypes:
+@         if has_convert_row(src, dst):
+/*
+ * Converts a row of {{ src.name }} pixels to {{ dst.name }}.
+ */
+GP_SIMD_BODY void convert_row_{{ src.name }}_{{ dst.name }}_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const {{ row_type(src) }} *restrict s = src;
+	{{ row_type(dst) }} *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += {{ row_step(src) }}, d += {{ row_step(dst) }}) {
+		gp_pixel p1 = {{ load_pixel(src) }};
+		gp_pixel p3 = 0;
+
+@             if is_alpha_premultiply(src, dst):
+		GP_PIXEL_{{ src.name }}_TO_{{ dst.name }}(p1, p3);
+@             else:
+		gp_pixel p2 = 0;
+
+		GP_PIXEL_{{ src.name }}_TO_RGB888(p1, p2);
+		GP_PIXEL_RGB888_TO_{{ dst.name }}(p2, p3);
+@             end
+{@ store_pixel(dst, 'p3') @}
+	}
+}
+
+{@ simd_function('void', 'convert_row_' + src.name + '_' + dst.name, [('void *restrict', 'dst'), ('const void *restrict', 'src'), ('gp_size', 'w')]) @}
+
+@ end
+
+@ for src in pixeltypes:
+@     for dst in pixeltypes:
+@         if has_blend_row(src, dst):
+/*
+ * Blends a row of {{ src.name }} pixels onto {{ dst.name }}.
+ */
+GP_SIMD_BODY void blend_row_{{ src.name }}_{{ dst.name }}_body(void *restrict dst,
+                                  const void *restrict src, gp_size w)
+{
+	const {{ row_type(src) }} *restrict s = src;
+	{{ row_type(dst) }} *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += {{ row_step(src) }}, d += {{ row_step(dst) }}) {
+		gp_pixel p = gp_mix_pixels_{{ src.name }}_{{ dst.name }}({{ load_pixel(src) }}, {{ load_pixel(dst, 'd') }});
+
+{@ store_pixel(dst, 'p') @}
+	}
+}
+
+{@ simd_function('void', 'blend_row_' + src.name + '_' + dst.name, [('void *restrict', 'dst'), ('const void *restrict', 'src'), ('gp_size', 'w')]) @}
+
+@ end
+@ # 8x8 Bayer matrix
+@ bayer = [[0]]
+@ while len(bayer) < 8:
+@     n = len(bayer)
+@     bayer = [[4 * bayer[y % n][x % n] + [[0, 2], [3, 1]][y // n][x // n] for x in range(2 * n)] for y in range(2 * n)]
+@ end
+/*
+ * Ordered dithering thresholds, 8x8 Bayer matrix scaled to 2 - 254.
+ */
+static const uint8_t dither_thresholds[8][8] = {
+@ for row in bayer:
+	{{ '{' + ', '.join(['%3i' % (4 * v + 2) for v in row]) + '}' }},
+@ end
+};
+
+/*
+ * Quantizes 8 bit value to 0 - max, the t is the dither threshold.
+ *
+ * Computes (v * max + t) / 255, the division is exact for the whole range.
+ */
+static inline unsigned int dither_val(unsigned int v, unsigned int max,
+                                      unsigned int t)
+{
+	unsigned int x = v * max + t;
+
+	return (x + 1 + (x >> 8)) >> 8;
+}
+
+/*
+ * The thresholds are repeated for a chunk of a row so that the vectorized
+ * functions can load them as a vector, has to be multiple of 8.
+ */
+#define DITHER_CHUNK 64
+
+@ def dither_pixel(pt):
+@     if pt.is_gray():
+@         V = pt.chans['V']
+		unsigned int v = (((s >> 24) & 0xff) + ((s >> 16) & 0xff) + ((s >> 8) & 0xff)) / 3;
+		gp_pixel p = dither_val(v, {{ V.C_max }}, t) << {{ V.off }};
+@     else:
+@         R = pt.chans['R']
+@         G = pt.chans['G']
+@         B = pt.chans['B']
+		gp_pixel p = dither_val((s >> 24) & 0xff, {{ R.C_max }}, t) << {{ R.off }} |
+		             dither_val((s >> 16) & 0xff, {{ G.C_max }}, t) << {{ G.off }} |
+		             dither_val((s >> 8) & 0xff, {{ B.C_max }}, t) << {{ B.off }};
+@ end
+@
+@ for dst in pixeltypes:
+@     if has_dither_row(dst):
+@         if has_byte_row(dst):
+/*
+ * Converts a row of RGBA8888 pixels to {{ dst.name }} with ordered dithering.
+ */
+GP_SIMD_BODY void dither_pixels_{{ dst.name }}_body(void *restrict dst,
+                                     const uint32_t *restrict src,
+                                     const uint8_t *restrict thr, gp_size w)
+{
+	{{ row_type(dst) }} *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += {{ row_step(dst) }}) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i];
+{@ dither_pixel(dst) @}
+{@ store_pixel(dst, 'p') @}
+	}
+}
+
+{@ simd_function('void', 'dither_pixels_' + dst.name, [('void *restrict', 'dst'), ('const uint32_t *restrict', 'src'), ('const uint8_t *restrict', 'thr'), ('gp_size', 'w')]) @}
+
+@         end
+static void dither_row_{{ dst.name }}(gp_pixmap *dst, gp_coord x, gp_coord y,
+                                 const uint32_t *src, gp_size w)
+{
+	uint8_t thr[DITHER_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < DITHER_CHUNK; i++)
+		thr[i] = dither_thresholds[y % 8][(x + i) % 8];
+
+@         if has_byte_row(dst):
+	gp_size n;
+
+	for (i = 0; i < w; i += n) {
+		n = GP_MIN(w - i, (gp_size)DITHER_CHUNK);
+		dither_pixels_{{ dst.name }}(GP_PIXEL_ADDR(dst, x + i, y), src + i, thr, n);
+	}
+@         else:
+	for (i = 0; i < w; i++) {
+		uint32_t s = src[i];
+		unsigned int t = thr[i % DITHER_CHUNK];
+{@ dither_pixel(dst) @}
+		gp_putpixel_raw_{{ dst.pixelsize.suffix }}(dst, x + i, y, p);
+	}
+@         end
+}
+
+@ end
+gp_dither_row_fn gp_dither_row_get(gp_pixel_type dst)
+{
+	switch (dst) {
+@ for dst in pixeltypes:
+@     if has_dither_row(dst):
+	case GP_PIXEL_{{ dst.name }}:
+		return dither_row_{{ dst.name }};
+@ end
+	default:
+		return NULL;
+	}
+}
+
+gp_convert_row_fn gp_blend_row_get(gp_pixel_type src, gp_pixel_type dst)
+{
+	switch (src) {
+@ for src in pixeltypes:
+@     dsts = [dst for dst in pixeltypes if has_blend_row(src, dst)]
+@     if dsts:
+	case GP_PIXEL_{{ src.name }}:
+		switch (dst) {
+@         for dst in dsts:
+		case GP_PIXEL_{{ dst.name }}:
+			return blend_row_{{ src.name }}_{{ dst.name }};
+@         end
+		default:
+		break;
+		}
+	break;
+@ end
+	default:
+	break;
+	}
+
+	return NULL;
+}
+
+gp_convert_row_fn gp_convert_row_get(gp_pixel_type src, gp_pixel_type dst)
+{
+	switch (src) {
+@ for src in pixeltypes:
+@     dsts = [dst for dst in pixeltypes if has_convert_row(src, dst)]
+@     if dsts:
+	case GP_PIXEL_{{ src.name }}:
+		switch (dst) {
+@         for dst in dsts:
+		case GP_PIXEL_{{ dst.name }}:
+			return convert_row_{{ src.name }}_{{ dst.name }};
+@         end
+		default:
+		break;
+		}
+	break;
+@ end
+	default:
+	break;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#if defined(__arm__) && !defined(__aarch64__)
+# include <sys/auxv.h>
+# include <asm/hwcap.h>
+#endif
+
+#include <core/gp_common.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+static unsigned int detect_flags(void)
+{
+	unsigned int flags = 0;
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("sse2"))
+		flags |= GP_CPU_SSE2;
+
+	if (__builtin_cpu_supports("avx2"))
+		flags |= GP_CPU_AVX2;
+#elif defined(__aarch64__)
+	flags |= GP_CPU_NEON;
+#elif defined(__arm__) && defined(HWCAP_NEON)
+	if (getauxval(AT_HWCAP) & HWCAP_NEON)
+		flags |= GP_CPU_NEON;
+#endif
+
+	return flags;
+}
+
+static const struct cpu_flag_name {
+	const char *name;
+	unsigned int flag;
+} flag_names[] = {
+	{"sse2", GP_CPU_SSE2},
+	{"avx2", GP_CPU_AVX2},
+	{"neon", GP_CPU_NEON},
+};
+
+/*
+ * Parses the GP_SIMD value, number enables (non-zero) or disables (zero) all
+ * flags, otherwise it's a comma separated list of flag names to keep.
+ */
+static unsigned int env_flags(const char *env)
+{
+	unsigned int i, flags = 0;
+	size_t len;
+
+	if (isdigit(*env))
+		return atoi(env) ? ~0u : 0;
+
+	while (*env) {
+		len = strcspn(env, ",");
+
+		for (i = 0; i < GP_ARRAY_SIZE(flag_names); i++) {
+			if (strlen(flag_names[i].name) == len &&
+			    !strncmp(flag_names[i].name, env, len)) {
+				flags |= flag_names[i].flag;
+				break;
+			}
+		}
+
+		if (i == GP_ARRAY_SIZE(flag_names))
+			GP_WARN("Invalid GP_SIMD flag '%.*s'", (int)len, env);
+
+		env += len;
+
+		if (*env == ',')
+			env++;
+	}
+
+	return flags;
+}
+
+/* Set in the cached flags once the detection is done */
+#define FLAGS_DETECTED 0x80000000
+
+unsigned int gp_cpu_flags(void)
+{
+	static unsigned int cached;
+	unsigned int flags;
+	char *env;
+
+	/*
+	 * The first call may happen in several threads at once, the detection
+	 * gives the same result so we only make sure that the flags are
+	 * published at once.
+	 */
+	flags = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+	if (flags & FLAGS_DETECTED)
+		return flags & ~FLAGS_DETECTED;
+
+	flags = detect_flags();
+
+	env = getenv("GP_SIMD");
+	if (env) {
+		GP_DEBUG(1, "SIMD limited by GP_SIMD=%s", env);
+		flags &= env_flags(env);
+	}
+
+	GP_DEBUG(1, "CPU flags%s%s%s",
+	         flags & GP_CPU_SSE2 ? " SSE2" : "",
+	         flags & GP_CPU_AVX2 ? " AVX2" : "",
+	         flags & GP_CPU_NEON ? " NEON" : "");
+
+	__atomic_store_n(&cached, flags | FLAGS_DETECTED, __ATOMIC_RELAXED);
+
+	return flags;
+}
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_damage.h>
+
+int gp_pixmap_damage_enable(gp_pixmap *self)
+{
+	gp_damage *damage;
+
+	if (self->damage)
+		return 0;
+
+	damage = malloc(sizeof(*damage));
+	if (!damage) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	damage->pixmap = self;
+	damage->rect_cnt = 0;
+
+	self->damage = damage;
+
+	return 0;
+}
+
+void gp_pixmap_damage_free(gp_pixmap *self)
+{
+	if (!self->damage)
+		return;
+
+	if (self->damage->pixmap == self)
+		free(self->damage);
+
+	self->damage = NULL;
+}
+
+void gp_pixmap_damage_disable(gp_pixmap *self)
+{
+	if (!self->damage)
+		return;
+
+	/* Subpixmaps point to the damage and we cannot tell if they still exist */
+	if (self->damage->pixmap == self && self->sub_pixmaps) {
+		GP_WARN("Pixmap %p has subpixmaps, keeping damage tracking enabled",
+		        self);
+		return;
+	}
+
+	gp_pixmap_damage_free(self);
+}
+
+static uint64_t rect_area(const gp_damage_rect *r)
+{
+	return (uint64_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static int rect_contains(const gp_damage_rect *a, const gp_damage_rect *b)
+{
+	return a->x0 <= b->x0 && a->y0 <= b->y0 &&
+	       a->x1 >= b->x1 && a->y1 >= b->y1;
+}
+
+static gp_damage_rect rect_union(const gp_damage_rect *a,
+                                 const gp_damage_rect *b)
+{
+	gp_damage_rect ret = {
+		.x0 = GP_MIN(a->x0, b->x0),
+		.y0 = GP_MIN(a->y0, b->y0),
+		.x1 = GP_MAX(a->x1, b->x1),
+		.y1 = GP_MAX(a->y1, b->y1),
+	};
+
+	return ret;
+}
+
+static void rect_remove(gp_damage *self, unsigned int i)
+{
+	self->rects[i] = self->rects[--self->rect_cnt];
+}
+
+static void damage_add(gp_damage *self, gp_damage_rect r)
+{
+	unsigned int i, best = 0;
+	uint64_t best_growth = UINT64_MAX;
+
+restart:
+	for (i = 0; i < self->rect_cnt; i++) {
+		gp_damage_rect *d = &self->rects[i];
+		gp_damage_rect u;
+
+		if (rect_contains(d, &r))
+			return;
+
+		u = rect_union(d, &r);
+
+		/*
+		 * Merge if the bounding box is not bigger than the two
+		 * rectangles, that is the case for adjacent rectangles and
+		 * for rectangles that mostly overlap.
+		 */
+		if (rect_area(&u) <= rect_area(d) + rect_area(&r)) {
+			rect_remove(self, i);
+			r = u;
+			goto restart;
+		}
+	}
+
+	if (self->rect_cnt < GP_DAMAGE_MAX_RECTS) {
+		self->rects[self->rect_cnt++] = r;
+		return;
+	}
+
+	for (i = 0; i < self->rect_cnt; i++) {
+		gp_damage_rect u = rect_union(&self->rects[i], &r);
+		uint64_t growth = rect_area(&u) - rect_area(&self->rects[i]);
+
+		if (growth < best_growth) {
+			best_growth = growth;
+			best = i;
+		}
+	}
+
+	/* The merged rectangle may now overlap the rest */
+	r = rect_union(&self->rects[best], &r);
+	rect_remove(self, best);
+	goto restart;
+}
+
+/*
+ * Subpixmaps point into the parent pixels, the position in the parent is
+ * computed from the pixel address.
+ */
+static int sub_pixmap_pos(const gp_pixmap *self, const gp_pixmap *parent,
+                          gp_coord *x, gp_coord *y)
+{
+	ptrdiff_t off = self->pixels - parent->pixels;
+	size_t bits;
+
+	if (off < 0 || (size_t)off >= (size_t)parent->bytes_per_row * parent->h)
+		return 1;
+
+	bits = (off % parent->bytes_per_row) * 8 + self->offset - parent->offset;
+
+	*x = bits / parent->bpp;
+	*y = off / parent->bytes_per_row;
+
+	return 0;
+}
+
+void gp_pixmap_damage_add(gp_pixmap *self, gp_coord x0, gp_coord y0,
+                          gp_coord x1, gp_coord y1)
+{
+	gp_damage *damage = self->damage;
+	const gp_pixmap *parent = damage->pixmap;
+	gp_damage_rect r;
+
+	if (x1 < x0)
+		GP_SWAP(x0, x1);
+
+	if (y1 < y0)
+		GP_SWAP(y0, y1);
+
+	if (x1 < 0 || y1 < 0 || x0 >= (gp_coord)self->w || y0 >= (gp_coord)self->h)
+		return;
+
+	r.x0 = GP_MAX(x0, 0);
+	r.y0 = GP_MAX(y0, 0);
+	r.x1 = GP_MIN(x1, (gp_coord)self->w - 1);
+	r.y1 = GP_MIN(y1, (gp_coord)self->h - 1);
+
+	if (parent != self) {
+		gp_coord x, y;
+
+		/* Pixels were reallocated, damage the whole parent */
+		if (sub_pixmap_pos(self, parent, &x, &y)) {
+			r.x0 = 0;
+			r.y0 = 0;
+			r.x1 = parent->w - 1;
+			r.y1 = parent->h - 1;
+		} else {
+			r.x0 += x;
+			r.y0 += y;
+			r.x1 = GP_MIN(r.x1 + x, (gp_coord)parent->w - 1);
+			r.y1 = GP_MIN(r.y1 + y, (gp_coord)parent->h - 1);
+		}
+	}
+
+	damage_add(damage, r);
+}
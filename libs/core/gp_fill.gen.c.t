@@ -11,6 +11,7 @@
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
 #include "core/gp_fill.h"
+#include <core/gp_damage.h>
 
 @ for ps in pixelsizes:
 static void fill_{{ ps.suffix }}(gp_pixmap *ctx, gp_pixel val)
@@ -21,7 +22,7 @@ static void fill_{{ ps.suffix }}(gp_pixmap *ctx, gp_pixel val)
 @     if ps.suffix in optimized_writepixels:
 		void *start = GP_PIXEL_ADDR(ctx, 0, y);
 @         if ps.needs_bit_endian():
-		gp_write_pixels_{{ ps.suffix }}(start, 0, ctx->w, val);
+		gp_write_pixels_{{ ps.suffix }}(start, ctx->offset, ctx->w, val);
 @         else:
 		gp_write_pixels_{{ ps.suffix }}(start, ctx->w, val);
 @     else:
@@ -37,5 +38,8 @@ static void fill_{{ ps.suffix }}(gp_pixmap *ctx, gp_pixel val)
 
 void gp_fill(gp_pixmap *ctx, gp_pixel val)
 {
+	GP_PIXMAP_UNSHARE(ctx);
+	gp_pixmap_damage_all(ctx);
+
 	GP_FN_PER_BPP_PIXMAP(fill, ctx, ctx, val);
 }
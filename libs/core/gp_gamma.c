@@ -4,6 +4,7 @@
  */
 
 #include <math.h>
+#include <string.h>
 
 #include <core/gp_pixel.h>
 #include <core/gp_debug.h>
@@ -12,39 +13,83 @@
 
 static gp_gamma_table *tables = NULL;
 
-static void fill_table8(gp_gamma_table *table, float gamma,
-                        uint8_t in_bits, uint8_t out_bits)
+/*
+ * Returns the correction function value for x in [0, 1].
+ *
+ * The sRGB tables for the decoding (to linear) are stored with gamma 2.4 and
+ * the encoding ones with 1/2.4.
+ */
+static double correct(gp_correction_type type, float gamma, double x)
+{
+	if (type == GP_CORRECTION_GAMMA)
+		return pow(x, gamma);
+
+	if (gamma > 1) {
+		if (x <= 0.04045)
+			return x / 12.92;
+
+		return pow((x + 0.055) / 1.055, 2.4);
+	}
+
+	if (x <= 0.0031308)
+		return x * 12.92;
+
+	return 1.055 * pow(x, 1 / 2.4) - 0.055;
+}
+
+static void fill_table8(gp_gamma_table *table, uint8_t in_bits, uint8_t out_bits)
 {
 	unsigned int i;
 	unsigned int in_max = (1<<in_bits) - 1;
 	unsigned int out_max = (1<<out_bits) - 1;
 
-	GP_DEBUG(3, "Initalizing gamma table %f", gamma);
+	GP_DEBUG(3, "Initalizing gamma table %f", table->gamma);
 
 	for (i = 0; i < (1U<<in_bits); i++)
-		table->u8[i] = pow((float)i / in_max, gamma) * out_max + 0.5;
+		table->u8[i] = correct(table->type, table->gamma, (double)i / in_max) * out_max + 0.5;
 }
 
-static void fill_table16(gp_gamma_table *table, float gamma,
-                         uint8_t in_bits, uint8_t out_bits)
+static void fill_table16(gp_gamma_table *table, uint8_t in_bits, uint8_t out_bits)
 {
 	unsigned int i;
 	unsigned int in_max = (1<<in_bits) - 1;
 	unsigned int out_max = (1<<out_bits) - 1;
 
-	GP_DEBUG(3, "Initalizing gamma table %f", gamma);
+	GP_DEBUG(3, "Initalizing gamma table %f", table->gamma);
 
 	for (i = 0; i < (1U<<in_bits); i++)
-		table->u16[i] = pow((float)i / in_max, gamma) * out_max + 0.5;
+		table->u16[i] = correct(table->type, table->gamma, (double)i / in_max) * out_max + 0.5;
 }
 
-static gp_gamma_table *get_table(float gamma, uint8_t in_bits, uint8_t out_bits)
+/*
+ * The 32 bit tables for the conversion to linear have 16 bit output, the ones
+ * for the conversion from linear have at least LUT32_MIN_BITS input bits so
+ * that values from 16 bit linear buffers are converted back without loss.
+ */
+#define LUT32_MIN_BITS 12
+
+static void fill_lut32(gp_gamma_table *table, int to_linear)
+{
+	unsigned int i;
+	unsigned int in_max = (1<<table->lut32_bits) - 1;
+	unsigned int out_max = to_linear ? 0xffff : (1U<<table->out_bits) - 1;
+
+	for (i = 0; i <= in_max; i++)
+		table->lut32[i] = correct(table->type, table->gamma, (double)i / in_max) * out_max + 0.5;
+}
+
+static gp_gamma_table *get_table(gp_correction_type type, float gamma,
+                                 uint8_t in_bits, uint8_t out_bits,
+                                 int to_linear)
 {
 	gp_gamma_table *i;
+	uint8_t lut32_bits = to_linear ? in_bits : GP_MAX(in_bits, LUT32_MIN_BITS);
+	size_t size;
 
 	for (i = tables; i != NULL; i = i->next)
-		if (gamma == i->gamma && in_bits == i->in_bits &&
-		    out_bits == i->out_bits)
+		if (type == i->type && gamma == i->gamma &&
+		    in_bits == i->in_bits && out_bits == i->out_bits &&
+		    lut32_bits == i->lut32_bits)
 			break;
 
 	if (i != NULL) {
@@ -58,7 +103,11 @@ static gp_gamma_table *get_table(float gamma, uint8_t in_bits, uint8_t out_bits)
 	GP_DEBUG(2, "Creating Gamma table Gamma %f, in_bits %u, out_bits %u",
 	         gamma, in_bits, out_bits);
 
-	i = malloc(sizeof(gp_gamma_table) + (1U<<in_bits) * (out_bits > 8 ? 2 : 1));
+	/* The 32 bit table follows the original one */
+	size = (1U<<in_bits) * (out_bits > 8 ? 2 : 1);
+	size = (size + 3) & ~3;
+
+	i = malloc(sizeof(gp_gamma_table) + size + (1U<<lut32_bits) * sizeof(uint32_t));
 
 	if (i == NULL) {
 		GP_WARN("Malloc failed :(");
@@ -69,12 +118,16 @@ static gp_gamma_table *get_table(float gamma, uint8_t in_bits, uint8_t out_bits)
 	i->in_bits = in_bits;
 	i->out_bits = out_bits;
 	i->ref_count = 1;
-	i->type = GP_CORRECTION_GAMMA;
+	i->type = type;
+	i->lut32 = (uint32_t*)(i->u8 + size);
+	i->lut32_bits = lut32_bits;
 
 	if (out_bits > 8)
-		fill_table16(i, gamma, in_bits, out_bits);
+		fill_table16(i, in_bits, out_bits);
 	else
-		fill_table8(i, gamma, in_bits, out_bits);
+		fill_table8(i, in_bits, out_bits);
+
+	fill_lut32(i, to_linear);
 
 	/* Insert it into link list */
 	i->next = tables;
@@ -115,12 +168,15 @@ static void put_table(gp_gamma_table *table)
 	}
 }
 
-gp_gamma *gp_gamma_acquire(gp_pixel_type pixel_type, float gamma)
+static gp_gamma *gamma_acquire(gp_pixel_type pixel_type,
+                               gp_correction_type type, float gamma)
 {
 	GP_CHECK_VALID_PIXELTYPE(pixel_type);
 	int channels = gp_pixel_types[pixel_type].numchannels, i;
 
-	GP_DEBUG(1, "Acquiring Gamma table %s gamma %f", gp_pixel_type_name(pixel_type), gamma);
+	GP_DEBUG(1, "Acquiring %s table %s gamma %f",
+	         type == GP_CORRECTION_sRGB ? "sRGB" : "Gamma",
+	         gp_pixel_type_name(pixel_type), gamma);
 
 	gp_gamma *res = malloc(sizeof(struct gp_gamma) + 2 * channels * sizeof(void*));
 
@@ -136,23 +192,29 @@ gp_gamma *gp_gamma_acquire(gp_pixel_type pixel_type, float gamma)
 	res->pixel_type = pixel_type;
 	res->ref_count = 1;
 
-	/* Gamma to linear tables n bits -> n + 2 bits */
+	/*
+	 * Gamma to linear tables n bits -> n + 2 bits and reverse tables,
+	 * n + 2 bits -> n bits. The linear values are limited to 16 bits.
+	 *
+	 * Alpha channel is linear.
+	 */
 	for (i = 0; i < channels; i++) {
-		unsigned int chan_size = gp_pixel_types[pixel_type].channels[i].size;
-		res->tables[i] = get_table(gamma, chan_size, chan_size + 2);
-
-		if (res->tables[i] == NULL) {
-			gp_gamma_release(res);
-			return NULL;
+		const gp_pixel_channel *chan = &gp_pixel_types[pixel_type].channels[i];
+		unsigned int lin_size = GP_MIN(chan->size + 2, 16);
+		gp_correction_type chan_type = type;
+		float chan_gamma = gamma;
+
+		if (!strcmp(chan->name, "A")) {
+			chan_type = GP_CORRECTION_GAMMA;
+			chan_gamma = 1;
 		}
-	}
 
-	/* And reverse tables, n + 2 bits -> n bits */
-	for (i = 0; i < channels; i++) {
-		unsigned int chan_size = gp_pixel_types[pixel_type].channels[i].size;
-		res->tables[i + channels] = get_table(1/gamma, chan_size + 2, chan_size);
+		res->tables[i] = get_table(chan_type, chan_gamma,
+		                           chan->size, lin_size, 1);
+		res->tables[i + channels] = get_table(chan_type, 1/chan_gamma,
+		                                      lin_size, chan->size, 0);
 
-		if (res->tables[i] == NULL) {
+		if (!res->tables[i] || !res->tables[i + channels]) {
 			gp_gamma_release(res);
 			return NULL;
 		}
@@ -161,6 +223,16 @@ gp_gamma *gp_gamma_acquire(gp_pixel_type pixel_type, float gamma)
 	return res;
 }
 
+gp_gamma *gp_gamma_acquire(gp_pixel_type pixel_type, float gamma)
+{
+	return gamma_acquire(pixel_type, GP_CORRECTION_GAMMA, gamma);
+}
+
+gp_gamma *gp_sRGB_acquire(gp_pixel_type pixel_type)
+{
+	return gamma_acquire(pixel_type, GP_CORRECTION_sRGB, 2.4);
+}
+
 gp_gamma *gp_gamma_copy(gp_gamma *self)
 {
 	self->ref_count++;
@@ -174,17 +246,19 @@ void gp_gamma_release(gp_gamma *self)
 	if (!self)
 		return;
 
-	channels = gp_pixel_types[self->pixel_type].numchannels;
+	GP_DEBUG(1, "Releasing Gamma table %s gamma %f", gp_pixel_type_name(self->pixel_type), self->tables[0] ? self->tables[0]->gamma : 0);
+
+	if (--self->ref_count)
+		return;
+
+	GP_DEBUG(2, "Gamma ref_count == 0, releasing...");
 
-	GP_DEBUG(1, "Releasing Gamma table %s gamma %f", gp_pixel_type_name(self->pixel_type), self->tables[0]->gamma);
+	channels = gp_pixel_types[self->pixel_type].numchannels;
 
-	for (i = 0; i < channels; i++)
+	for (i = 0; i < 2 * channels; i++)
 		put_table(self->tables[i]);
 
-	if (--self->ref_count == 0) {
-		GP_DEBUG(2, "Gamma ref_count == 0, releasing...");
-		free(self);
-	}
+	free(self);
 }
 
 static const char *correction_type_names[] = {
@@ -0,0 +1,449 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_gamma_linear.gen.c
+ *
+ * GENERATED on 2026 10 17 03:04:03 from gp_gamma_linear.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Conversion between gamma encoded pixmaps and linear light.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+#include <core/gp_threads.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_gamma_linear.h>
+#include <core/gp_damage.h>
+
+/*
+ * The rows are converted in chunks so that the unpacked channels fit into the
+ * L1 cache.
+ */
+#define LINEAR_CHUNK 256
+
+/*
+ * The lookups are done in the 32 bit tables, which are gathered by a single
+ * instruction on CPUs that support it.
+ */
+GP_SIMD_BODY void lut_to_linear_body(uint16_t *restrict dst, const int *restrict src,
+                                     const uint32_t *restrict lut, gp_size w)
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++)
+		dst[i] = lut[src[i]];
+}
+
+GP_SIMD_VARIANT
+static void lut_to_linear_generic(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	lut_to_linear_body(dst, src, lut, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void lut_to_linear_sse2(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	lut_to_linear_body(dst, src, lut, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void lut_to_linear_avx2(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	lut_to_linear_body(dst, src, lut, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void lut_to_linear_neon(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	lut_to_linear_body(dst, src, lut, w);
+}
+#endif
+
+static void lut_to_linear_resolve(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w);
+
+static void (*lut_to_linear_fn)(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w) = lut_to_linear_resolve;
+
+static void lut_to_linear_resolve(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w) = lut_to_linear_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = lut_to_linear_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = lut_to_linear_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = lut_to_linear_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of lut_to_linear()", variant);
+
+	__atomic_store_n(&lut_to_linear_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, lut, w);
+}
+
+static inline void lut_to_linear(uint16_t *restrict dst, const int *restrict src, const uint32_t *restrict lut, gp_size w)
+{
+	__atomic_load_n(&lut_to_linear_fn, __ATOMIC_RELAXED)(dst, src, lut, w);
+}
+
+/*
+ * The linear values are rounded to the reverse table size, the max is the
+ * table index maximum i.e. (1<<lut32_bits) - 1 and the product fits into 32
+ * bits even for 16 bit tables.
+ */
+GP_SIMD_BODY void lut_from_linear_body(int *restrict dst, const uint16_t *restrict src,
+                                       const uint32_t *restrict lut,
+                                       uint32_t max, gp_size w)
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++)
+		dst[i] = lut[(src[i] * max + 0x8000) >> 16];
+}
+
+GP_SIMD_VARIANT
+static void lut_from_linear_generic(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	lut_from_linear_body(dst, src, lut, max, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void lut_from_linear_sse2(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	lut_from_linear_body(dst, src, lut, max, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void lut_from_linear_avx2(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	lut_from_linear_body(dst, src, lut, max, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void lut_from_linear_neon(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	lut_from_linear_body(dst, src, lut, max, w);
+}
+#endif
+
+static void lut_from_linear_resolve(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w);
+
+static void (*lut_from_linear_fn)(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w) = lut_from_linear_resolve;
+
+static void lut_from_linear_resolve(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w) = lut_from_linear_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = lut_from_linear_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = lut_from_linear_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = lut_from_linear_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of lut_from_linear()", variant);
+
+	__atomic_store_n(&lut_from_linear_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, lut, max, w);
+}
+
+static inline void lut_from_linear(int *restrict dst, const uint16_t *restrict src, const uint32_t *restrict lut, uint32_t max, gp_size w)
+{
+	__atomic_load_n(&lut_from_linear_fn, __ATOMIC_RELAXED)(dst, src, lut, max, w);
+}
+
+static unsigned int chan_cnt(gp_pixel_type pixel_type)
+{
+	return gp_pixel_types[pixel_type].numchannels;
+}
+
+void gp_gamma_row_to_linear(const gp_gamma *gamma, const gp_pixmap *src,
+                            gp_coord x, gp_coord y, gp_size w,
+                            uint16_t *const chans[])
+{
+	unsigned int c, cnt = chan_cnt(src->pixel_type);
+	int buf[GP_PIXELTYPE_MAX_CHANNELS][LINEAR_CHUNK];
+	int *bufs[GP_PIXELTYPE_MAX_CHANNELS];
+	gp_size i;
+
+	GP_CHECK(gamma->pixel_type == src->pixel_type,
+	         "Gamma pixel type does not match the pixmap");
+
+	for (c = 0; c < cnt; c++)
+		bufs[c] = buf[c];
+
+	for (i = 0; i < w; i += LINEAR_CHUNK) {
+		gp_size len = GP_MIN(w - i, (gp_size)LINEAR_CHUNK);
+
+		gp_pixel_row_unpack(src, x + i, y, len, bufs);
+
+		for (c = 0; c < cnt; c++)
+			lut_to_linear(chans[c] + i, buf[c], gamma->tables[c]->lut32, len);
+	}
+}
+
+void gp_gamma_row_from_linear(const gp_gamma *gamma, gp_pixmap *dst,
+                              gp_coord x, gp_coord y, gp_size w,
+                              uint16_t *const chans[])
+{
+	unsigned int c, cnt = chan_cnt(dst->pixel_type);
+	int buf[GP_PIXELTYPE_MAX_CHANNELS][LINEAR_CHUNK];
+	int *bufs[GP_PIXELTYPE_MAX_CHANNELS];
+	gp_size i;
+
+	GP_CHECK(gamma->pixel_type == dst->pixel_type,
+	         "Gamma pixel type does not match the pixmap");
+
+	for (c = 0; c < cnt; c++)
+		bufs[c] = buf[c];
+
+	for (i = 0; i < w; i += LINEAR_CHUNK) {
+		gp_size len = GP_MIN(w - i, (gp_size)LINEAR_CHUNK);
+
+		for (c = 0; c < cnt; c++) {
+			const gp_gamma_table *table = gamma->tables[cnt + c];
+
+			lut_from_linear(buf[c], chans[c] + i, table->lut32,
+			                (1U<<table->lut32_bits) - 1, len);
+		}
+
+		gp_pixel_row_pack(dst, x + i, y, len, bufs);
+	}
+}
+
+gp_linear_pixmap *gp_linear_pixmap_alloc(gp_size w, gp_size h,
+                                         gp_pixel_type pixel_type)
+{
+	gp_linear_pixmap *self;
+	unsigned int c, cnt;
+	size_t plane_size = (size_t)w * h;
+	uint16_t *planes;
+
+	GP_CHECK_VALID_PIXELTYPE(pixel_type);
+
+	cnt = chan_cnt(pixel_type);
+
+	self = malloc(sizeof(*self));
+	planes = malloc(cnt * plane_size * sizeof(uint16_t));
+
+	if (!self || !planes) {
+		GP_WARN("Malloc failed :(");
+		free(self);
+		free(planes);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->w = w;
+	self->h = h;
+	self->pixel_type = pixel_type;
+	self->chan_cnt = cnt;
+
+	for (c = 0; c < GP_PIXELTYPE_MAX_CHANNELS; c++)
+		self->chans[c] = c < cnt ? planes + c * plane_size : NULL;
+
+	GP_DEBUG(1, "Allocated linear buffer %ux%u %s",
+	         w, h, gp_pixel_type_name(pixel_type));
+
+	return self;
+}
+
+void gp_linear_pixmap_free(gp_linear_pixmap *self)
+{
+	if (!self)
+		return;
+
+	/* The planes are allocated in one chunk */
+	free(self->chans[0]);
+	free(self);
+}
+
+struct linear_priv {
+	const gp_gamma *gamma;
+	gp_pixmap *pixmap;
+	const gp_linear_pixmap *buf;
+	int to_linear;
+};
+
+static int linear_tile(const gp_tile *tile, void *ppriv, gp_progress_cb *callback)
+{
+	struct linear_priv *priv = ppriv;
+	const gp_linear_pixmap *buf = priv->buf;
+	uint16_t *chans[GP_PIXELTYPE_MAX_CHANNELS];
+	unsigned int c;
+	gp_size y;
+
+	for (y = 0; y < tile->h; y++) {
+		gp_coord yr = tile->y + y;
+
+		for (c = 0; c < buf->chan_cnt; c++)
+			chans[c] = gp_linear_pixmap_row(buf, c, yr) + tile->x;
+
+		if (priv->to_linear) {
+			gp_gamma_row_to_linear(priv->gamma, priv->pixmap,
+			                       tile->x, yr, tile->w, chans);
+		} else {
+			gp_gamma_row_from_linear(priv->gamma, priv->pixmap,
+			                         tile->x, yr, tile->w, chans);
+		}
+
+		if (gp_progress_cb_report(callback, y, tile->h, tile->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int linear_run(gp_pixmap *pixmap, const gp_linear_pixmap *buf,
+                      int to_linear, gp_progress_cb *callback)
+{
+	struct linear_priv priv = {
+		.pixmap = pixmap,
+		.buf = buf,
+		.to_linear = to_linear,
+	};
+	gp_gamma *srgb = NULL;
+	int ret;
+
+	if (pixmap->w != buf->w || pixmap->h != buf->h ||
+	    pixmap->pixel_type != buf->pixel_type) {
+		GP_WARN("Pixmap and linear buffer size or pixel type mismatch");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (gp_pixel_has_flags(pixmap->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_WARN("Palette pixmaps are not supported");
+		errno = EINVAL;
+		return 1;
+	}
+
+	/* Writes into pixels shared copy-on-write must not change the copies */
+	if (!to_linear && gp_pixmap_unshare(pixmap))
+		return 1;
+
+	priv.gamma = pixmap->gamma;
+
+	if (!priv.gamma) {
+		srgb = gp_sRGB_acquire(pixmap->pixel_type);
+		if (!srgb) {
+			errno = ENOMEM;
+			return 1;
+		}
+
+		priv.gamma = srgb;
+	}
+
+	gp_tiles tiles = {
+		.w = pixmap->w,
+		.h = pixmap->h,
+		.bpp = pixmap->bpp,
+		.name = to_linear ? "to_linear" : "from_linear",
+		.pixel_type = pixmap->pixel_type,
+		.fn = linear_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	/* Pixels smaller than byte may share bytes, split only rows */
+	if (!to_linear && pixmap->bpp % 8)
+		tiles.min_w = tiles.w;
+
+	ret = gp_tiles_run(&tiles);
+
+	/* Aborted conversion may have written part of the pixmap as well */
+	if (!to_linear)
+		gp_pixmap_damage_all(pixmap);
+
+	gp_gamma_release(srgb);
+
+	return ret ? 1 : 0;
+}
+
+int gp_pixmap_to_linear(const gp_pixmap *src, gp_linear_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Converting %ux%u %s to linear", src->w, src->h,
+	         gp_pixel_type_name(src->pixel_type));
+
+	/* The src pixmap is only read */
+	return linear_run((gp_pixmap *)src, dst, 1, callback);
+}
+
+gp_linear_pixmap *gp_pixmap_to_linear_alloc(const gp_pixmap *src,
+                                            gp_progress_cb *callback)
+{
+	gp_linear_pixmap *ret;
+	int err;
+
+	ret = gp_linear_pixmap_alloc(src->w, src->h, src->pixel_type);
+	if (!ret)
+		return NULL;
+
+	if (gp_pixmap_to_linear(src, ret, callback)) {
+		err = errno;
+		gp_linear_pixmap_free(ret);
+		errno = err;
+		return NULL;
+	}
+
+	return ret;
+}
+
+int gp_pixmap_from_linear(const gp_linear_pixmap *src, gp_pixmap *dst,
+                          gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Converting %ux%u %s from linear", dst->w, dst->h,
+	         gp_pixel_type_name(dst->pixel_type));
+
+	return linear_run(dst, src, 0, callback);
+}
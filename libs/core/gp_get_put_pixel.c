@@ -6,6 +6,7 @@
 
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_transform.h>
+#include <core/gp_damage.h>
 
 gp_pixel gp_getpixel(const gp_pixmap *pixmap, gp_coord x, gp_coord y)
 {
@@ -17,9 +18,13 @@ gp_pixel gp_getpixel(const gp_pixmap *pixmap, gp_coord x, gp_coord y)
 
 void gp_putpixel(gp_pixmap *pixmap, gp_coord x, gp_coord y, gp_pixel p)
 {
+	GP_PIXMAP_UNSHARE(pixmap);
 	GP_TRANSFORM_POINT(pixmap, x, y);
-	if (!GP_PIXEL_IS_CLIPPED(pixmap, x, y))
-		gp_putpixel_raw(pixmap, x, y, p);
+	if (GP_PIXEL_IS_CLIPPED(pixmap, x, y))
+		return;
+
+	gp_putpixel_raw(pixmap, x, y, p);
+	gp_pixmap_damage_xyxy_raw(pixmap, x, y, x, y);
 }
 
 uint8_t gp_pixel_addr_offset(gp_coord x, gp_pixel_type pixel_type)
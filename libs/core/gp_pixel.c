@@ -7,6 +7,7 @@
  */
 
 #include <string.h>
+#include <inttypes.h>
 
 #include <core/gp_debug.h>
 #include <core/gp_pixel.h>
@@ -26,7 +27,7 @@ get_channel(const gp_pixel_type_desc *desc, const char *name)
 static int match(const gp_pixel_channel *channel, gp_pixel mask)
 {
 	if (channel == NULL) {
-		GP_DEBUG(3, "%s gen %08x pass %08x", channel->name, 0, mask);
+		GP_DEBUG(3, "%s gen %08x pass %08"PRIx64, channel->name, 0, mask);
 		return !mask;
 	}
 
@@ -34,7 +35,7 @@ static int match(const gp_pixel_channel *channel, gp_pixel mask)
 
 	chmask >>= (GP_PIXEL_BITS - channel->size);
 	chmask <<= channel->offset;
-	GP_DEBUG(3, "%s gen %08x pass %08x", channel->name, chmask, mask);
+	GP_DEBUG(3, "%s gen %08"PRIx64" pass %08"PRIx64, channel->name, chmask, mask);
 
 	return (chmask == mask);
 }
@@ -56,7 +57,8 @@ gp_pixel_type gp_pixel_rgb_match(gp_pixel rmask, gp_pixel gmask,
 {
 	unsigned int i;
 
-	GP_DEBUG(1, "Matching Pixel R %08x G %08x B %08x A %08x size %u",
+	GP_DEBUG(1, "Matching Pixel R %08"PRIx64" G %08"PRIx64" B %08"PRIx64
+	            " A %08"PRIx64" size %u",
 	            rmask, gmask, bmask, amask, bits_per_pixel);
 
 	for (i = 0; i < GP_PIXEL_MAX; i++) {
@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <inttypes.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_set_bits.h>
 @
@@ -22,6 +23,8 @@
 @         flags.append('GP_PIXEL_IS_GRAYSCALE')
 @     if pt.is_cmyk():
 @         flags.append('GP_PIXEL_IS_CMYK')
+@     if pt.is_premultiplied():
+@         flags.append('GP_PIXEL_IS_PREMULTIPLIED')
 @     if flags:
 @         return ' | '.join(flags)
 @     else:
@@ -57,7 +60,7 @@ const gp_pixel_type_desc gp_pixel_types[GP_PIXEL_MAX] = {
  */
 static void pixel_snprint_{{ pt.name }}(char *buf, size_t len, gp_pixel p)
 {
-	snprintf(buf, len, "{{ pt.name }} 0x%0{{ (pt.pixelsize.size+3)//4 }}x {{ '=%d '.join(pt.chan_names) + '=%d' }}",
+	snprintf(buf, len, "{{ pt.name }} 0x%0{{ (pt.pixelsize.size+3)//4 }}"PRIx64" {{ '=%d '.join(pt.chan_names) + '=%d' }}",
 		GP_GET_BITS(0, {{ pt.pixelsize.size }}, p),
 		{{ arr_to_params(pt.chan_names, 'GP_PIXEL_GET_', '_' + pt.name + '(p)') }});
 }
@@ -0,0 +1,2772 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_pixel_row.gen.c
+ *
+ * GENERATED on 2026 10 17 02:02:05 from gp_pixel_row.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Bulk row unpack and pack functions.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+GP_SIMD_BODY void row_unpack_xRGB8888_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B)
+{
+	const uint32_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_xRGB8888(p);
+		G[i] = GP_PIXEL_GET_G_xRGB8888(p);
+		B[i] = GP_PIXEL_GET_B_xRGB8888(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_xRGB8888_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_xRGB8888_body(src, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_xRGB8888_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_xRGB8888_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_xRGB8888_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_xRGB8888_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_xRGB8888_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_xRGB8888_body(src, w, R, G, B);
+}
+#endif
+
+static void row_unpack_xRGB8888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B);
+
+static void (*row_unpack_xRGB8888_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_xRGB8888_resolve;
+
+static void row_unpack_xRGB8888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_xRGB8888()", variant);
+
+	__atomic_store_n(&row_unpack_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B);
+}
+
+static inline void row_unpack_xRGB8888(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	__atomic_load_n(&row_unpack_xRGB8888_fn, __ATOMIC_RELAXED)(src, w, R, G, B);
+}
+
+GP_SIMD_BODY void row_pack_xRGB8888_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_xRGB8888(R[i], G[i], B[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_xRGB8888_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_xRGB8888_body(dst, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_xRGB8888_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_xRGB8888_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_xRGB8888_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_xRGB8888_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_xRGB8888_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_xRGB8888_body(dst, w, R, G, B);
+}
+#endif
+
+static void row_pack_xRGB8888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B);
+
+static void (*row_pack_xRGB8888_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_xRGB8888_resolve;
+
+static void row_pack_xRGB8888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_xRGB8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_xRGB8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_xRGB8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_xRGB8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_xRGB8888()", variant);
+
+	__atomic_store_n(&row_pack_xRGB8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B);
+}
+
+static inline void row_pack_xRGB8888(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	__atomic_load_n(&row_pack_xRGB8888_fn, __ATOMIC_RELAXED)(dst, w, R, G, B);
+}
+
+void gp_pixel_row_unpack_xRGB8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_xRGB8888(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_xRGB8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_xRGB8888(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+GP_SIMD_BODY void row_unpack_RGBA8888_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	const uint32_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_RGBA8888(p);
+		G[i] = GP_PIXEL_GET_G_RGBA8888(p);
+		B[i] = GP_PIXEL_GET_B_RGBA8888(p);
+		A[i] = GP_PIXEL_GET_A_RGBA8888(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGBA8888_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_body(src, w, R, G, B, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGBA8888_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_body(src, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGBA8888_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_body(src, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGBA8888_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_body(src, w, R, G, B, A);
+}
+#endif
+
+static void row_unpack_RGBA8888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A);
+
+static void (*row_unpack_RGBA8888_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A) = row_unpack_RGBA8888_resolve;
+
+static void row_unpack_RGBA8888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A) = row_unpack_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGBA8888()", variant);
+
+	__atomic_store_n(&row_unpack_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B, A);
+}
+
+static inline void row_unpack_RGBA8888(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	__atomic_load_n(&row_unpack_RGBA8888_fn, __ATOMIC_RELAXED)(src, w, R, G, B, A);
+}
+
+GP_SIMD_BODY void row_pack_RGBA8888_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_RGBA8888(R[i], G[i], B[i], A[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGBA8888_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_body(dst, w, R, G, B, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGBA8888_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_body(dst, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGBA8888_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_body(dst, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGBA8888_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_body(dst, w, R, G, B, A);
+}
+#endif
+
+static void row_pack_RGBA8888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A);
+
+static void (*row_pack_RGBA8888_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A) = row_pack_RGBA8888_resolve;
+
+static void row_pack_RGBA8888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A) = row_pack_RGBA8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGBA8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGBA8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGBA8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGBA8888()", variant);
+
+	__atomic_store_n(&row_pack_RGBA8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B, A);
+}
+
+static inline void row_pack_RGBA8888(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	__atomic_load_n(&row_pack_RGBA8888_fn, __ATOMIC_RELAXED)(dst, w, R, G, B, A);
+}
+
+void gp_pixel_row_unpack_RGBA8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGBA8888(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+void gp_pixel_row_pack_RGBA8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGBA8888(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+GP_SIMD_BODY void row_unpack_RGB888_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B)
+{
+	const uint8_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3) {
+		gp_pixel p = (s[0] | s[1]<<8 | s[2]<<16);
+
+		R[i] = GP_PIXEL_GET_R_RGB888(p);
+		G[i] = GP_PIXEL_GET_G_RGB888(p);
+		B[i] = GP_PIXEL_GET_B_RGB888(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGB888_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB888_body(src, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGB888_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB888_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGB888_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB888_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGB888_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB888_body(src, w, R, G, B);
+}
+#endif
+
+static void row_unpack_RGB888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B);
+
+static void (*row_unpack_RGB888_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB888_resolve;
+
+static void row_unpack_RGB888_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGB888()", variant);
+
+	__atomic_store_n(&row_unpack_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B);
+}
+
+static inline void row_unpack_RGB888(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	__atomic_load_n(&row_unpack_RGB888_fn, __ATOMIC_RELAXED)(src, w, R, G, B);
+}
+
+GP_SIMD_BODY void row_pack_RGB888_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 3) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB888(R[i], G[i], B[i]);
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGB888_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB888_body(dst, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGB888_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB888_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGB888_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB888_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGB888_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB888_body(dst, w, R, G, B);
+}
+#endif
+
+static void row_pack_RGB888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B);
+
+static void (*row_pack_RGB888_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB888_resolve;
+
+static void row_pack_RGB888_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGB888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGB888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGB888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGB888()", variant);
+
+	__atomic_store_n(&row_pack_RGB888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B);
+}
+
+static inline void row_pack_RGB888(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	__atomic_load_n(&row_pack_RGB888_fn, __ATOMIC_RELAXED)(dst, w, R, G, B);
+}
+
+void gp_pixel_row_unpack_RGB888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGB888(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_RGB888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGB888(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+GP_SIMD_BODY void row_unpack_BGR888_body(const void *restrict src, gp_size w,
+                                 int *restrict B, int *restrict G, int *restrict R)
+{
+	const uint8_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 3) {
+		gp_pixel p = (s[0] | s[1]<<8 | s[2]<<16);
+
+		B[i] = GP_PIXEL_GET_B_BGR888(p);
+		G[i] = GP_PIXEL_GET_G_BGR888(p);
+		R[i] = GP_PIXEL_GET_R_BGR888(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_BGR888_generic(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	row_unpack_BGR888_body(src, w, B, G, R);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_BGR888_sse2(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	row_unpack_BGR888_body(src, w, B, G, R);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_BGR888_avx2(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	row_unpack_BGR888_body(src, w, B, G, R);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_BGR888_neon(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	row_unpack_BGR888_body(src, w, B, G, R);
+}
+#endif
+
+static void row_unpack_BGR888_resolve(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R);
+
+static void (*row_unpack_BGR888_fn)(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R) = row_unpack_BGR888_resolve;
+
+static void row_unpack_BGR888_resolve(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R) = row_unpack_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_BGR888()", variant);
+
+	__atomic_store_n(&row_unpack_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, B, G, R);
+}
+
+static inline void row_unpack_BGR888(const void *restrict src, gp_size w, int *restrict B, int *restrict G, int *restrict R)
+{
+	__atomic_load_n(&row_unpack_BGR888_fn, __ATOMIC_RELAXED)(src, w, B, G, R);
+}
+
+GP_SIMD_BODY void row_pack_BGR888_body(void *restrict dst, gp_size w,
+                               const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 3) {
+		gp_pixel p = GP_PIXEL_CREATE_BGR888(B[i], G[i], R[i]);
+
+		d[0] = p & 0xff;
+		d[1] = (p >> 8) & 0xff;
+		d[2] = (p >> 16) & 0xff;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_BGR888_generic(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	row_pack_BGR888_body(dst, w, B, G, R);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_BGR888_sse2(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	row_pack_BGR888_body(dst, w, B, G, R);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_BGR888_avx2(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	row_pack_BGR888_body(dst, w, B, G, R);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_BGR888_neon(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	row_pack_BGR888_body(dst, w, B, G, R);
+}
+#endif
+
+static void row_pack_BGR888_resolve(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R);
+
+static void (*row_pack_BGR888_fn)(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R) = row_pack_BGR888_resolve;
+
+static void row_pack_BGR888_resolve(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R) = row_pack_BGR888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_BGR888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_BGR888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_BGR888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_BGR888()", variant);
+
+	__atomic_store_n(&row_pack_BGR888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, B, G, R);
+}
+
+static inline void row_pack_BGR888(void *restrict dst, gp_size w, const int *restrict B, const int *restrict G, const int *restrict R)
+{
+	__atomic_load_n(&row_pack_BGR888_fn, __ATOMIC_RELAXED)(dst, w, B, G, R);
+}
+
+void gp_pixel_row_unpack_BGR888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_BGR888(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_BGR888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_BGR888(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+GP_SIMD_BODY void row_unpack_RGB555_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B)
+{
+	const uint16_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_RGB555(p);
+		G[i] = GP_PIXEL_GET_G_RGB555(p);
+		B[i] = GP_PIXEL_GET_B_RGB555(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGB555_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB555_body(src, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGB555_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB555_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGB555_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB555_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGB555_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB555_body(src, w, R, G, B);
+}
+#endif
+
+static void row_unpack_RGB555_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B);
+
+static void (*row_unpack_RGB555_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB555_resolve;
+
+static void row_unpack_RGB555_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGB555()", variant);
+
+	__atomic_store_n(&row_unpack_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B);
+}
+
+static inline void row_unpack_RGB555(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	__atomic_load_n(&row_unpack_RGB555_fn, __ATOMIC_RELAXED)(src, w, R, G, B);
+}
+
+GP_SIMD_BODY void row_pack_RGB555_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB555(R[i], G[i], B[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGB555_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB555_body(dst, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGB555_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB555_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGB555_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB555_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGB555_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB555_body(dst, w, R, G, B);
+}
+#endif
+
+static void row_pack_RGB555_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B);
+
+static void (*row_pack_RGB555_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB555_resolve;
+
+static void row_pack_RGB555_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB555_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGB555_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGB555_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGB555_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGB555()", variant);
+
+	__atomic_store_n(&row_pack_RGB555_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B);
+}
+
+static inline void row_pack_RGB555(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	__atomic_load_n(&row_pack_RGB555_fn, __ATOMIC_RELAXED)(dst, w, R, G, B);
+}
+
+void gp_pixel_row_unpack_RGB555(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGB555(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_RGB555(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGB555(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+GP_SIMD_BODY void row_unpack_RGB565_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B)
+{
+	const uint16_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_RGB565(p);
+		G[i] = GP_PIXEL_GET_G_RGB565(p);
+		B[i] = GP_PIXEL_GET_B_RGB565(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGB565_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB565_body(src, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGB565_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB565_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGB565_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB565_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGB565_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB565_body(src, w, R, G, B);
+}
+#endif
+
+static void row_unpack_RGB565_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B);
+
+static void (*row_unpack_RGB565_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB565_resolve;
+
+static void row_unpack_RGB565_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGB565()", variant);
+
+	__atomic_store_n(&row_unpack_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B);
+}
+
+static inline void row_unpack_RGB565(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	__atomic_load_n(&row_unpack_RGB565_fn, __ATOMIC_RELAXED)(src, w, R, G, B);
+}
+
+GP_SIMD_BODY void row_pack_RGB565_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB565(R[i], G[i], B[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGB565_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB565_body(dst, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGB565_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB565_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGB565_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB565_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGB565_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB565_body(dst, w, R, G, B);
+}
+#endif
+
+static void row_pack_RGB565_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B);
+
+static void (*row_pack_RGB565_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB565_resolve;
+
+static void row_pack_RGB565_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB565_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGB565_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGB565_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGB565_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGB565()", variant);
+
+	__atomic_store_n(&row_pack_RGB565_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B);
+}
+
+static inline void row_pack_RGB565(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	__atomic_load_n(&row_pack_RGB565_fn, __ATOMIC_RELAXED)(dst, w, R, G, B);
+}
+
+void gp_pixel_row_unpack_RGB565(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGB565(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_RGB565(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGB565(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_RGB666(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_R_RGB666(p);
+		chans[1][i] = GP_PIXEL_GET_G_RGB666(p);
+		chans[2][i] = GP_PIXEL_GET_B_RGB666(p);
+	}
+}
+
+void gp_pixel_row_pack_RGB666(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB666(chans[0][i], chans[1][i], chans[2][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+GP_SIMD_BODY void row_unpack_RGB332_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B)
+{
+	const uint8_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_RGB332(p);
+		G[i] = GP_PIXEL_GET_G_RGB332(p);
+		B[i] = GP_PIXEL_GET_B_RGB332(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGB332_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB332_body(src, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGB332_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB332_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGB332_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB332_body(src, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGB332_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	row_unpack_RGB332_body(src, w, R, G, B);
+}
+#endif
+
+static void row_unpack_RGB332_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B);
+
+static void (*row_unpack_RGB332_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB332_resolve;
+
+static void row_unpack_RGB332_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B) = row_unpack_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGB332()", variant);
+
+	__atomic_store_n(&row_unpack_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B);
+}
+
+static inline void row_unpack_RGB332(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B)
+{
+	__atomic_load_n(&row_unpack_RGB332_fn, __ATOMIC_RELAXED)(src, w, R, G, B);
+}
+
+GP_SIMD_BODY void row_pack_RGB332_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB332(R[i], G[i], B[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGB332_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB332_body(dst, w, R, G, B);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGB332_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB332_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGB332_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB332_body(dst, w, R, G, B);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGB332_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	row_pack_RGB332_body(dst, w, R, G, B);
+}
+#endif
+
+static void row_pack_RGB332_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B);
+
+static void (*row_pack_RGB332_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB332_resolve;
+
+static void row_pack_RGB332_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B) = row_pack_RGB332_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGB332_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGB332_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGB332_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGB332()", variant);
+
+	__atomic_store_n(&row_pack_RGB332_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B);
+}
+
+static inline void row_pack_RGB332(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B)
+{
+	__atomic_load_n(&row_pack_RGB332_fn, __ATOMIC_RELAXED)(dst, w, R, G, B);
+}
+
+void gp_pixel_row_unpack_RGB332(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGB332(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+void gp_pixel_row_pack_RGB332(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGB332(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2]);
+}
+
+GP_SIMD_BODY void row_unpack_CMYK8888_body(const void *restrict src, gp_size w,
+                                 int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	const uint32_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		K[i] = GP_PIXEL_GET_K_CMYK8888(p);
+		Y[i] = GP_PIXEL_GET_Y_CMYK8888(p);
+		M[i] = GP_PIXEL_GET_M_CMYK8888(p);
+		C[i] = GP_PIXEL_GET_C_CMYK8888(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_CMYK8888_generic(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	row_unpack_CMYK8888_body(src, w, K, Y, M, C);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_CMYK8888_sse2(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	row_unpack_CMYK8888_body(src, w, K, Y, M, C);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_CMYK8888_avx2(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	row_unpack_CMYK8888_body(src, w, K, Y, M, C);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_CMYK8888_neon(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	row_unpack_CMYK8888_body(src, w, K, Y, M, C);
+}
+#endif
+
+static void row_unpack_CMYK8888_resolve(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C);
+
+static void (*row_unpack_CMYK8888_fn)(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C) = row_unpack_CMYK8888_resolve;
+
+static void row_unpack_CMYK8888_resolve(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C) = row_unpack_CMYK8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_CMYK8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_CMYK8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_CMYK8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_CMYK8888()", variant);
+
+	__atomic_store_n(&row_unpack_CMYK8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, K, Y, M, C);
+}
+
+static inline void row_unpack_CMYK8888(const void *restrict src, gp_size w, int *restrict K, int *restrict Y, int *restrict M, int *restrict C)
+{
+	__atomic_load_n(&row_unpack_CMYK8888_fn, __ATOMIC_RELAXED)(src, w, K, Y, M, C);
+}
+
+GP_SIMD_BODY void row_pack_CMYK8888_body(void *restrict dst, gp_size w,
+                               const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_CMYK8888(K[i], Y[i], M[i], C[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_CMYK8888_generic(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	row_pack_CMYK8888_body(dst, w, K, Y, M, C);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_CMYK8888_sse2(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	row_pack_CMYK8888_body(dst, w, K, Y, M, C);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_CMYK8888_avx2(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	row_pack_CMYK8888_body(dst, w, K, Y, M, C);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_CMYK8888_neon(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	row_pack_CMYK8888_body(dst, w, K, Y, M, C);
+}
+#endif
+
+static void row_pack_CMYK8888_resolve(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C);
+
+static void (*row_pack_CMYK8888_fn)(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C) = row_pack_CMYK8888_resolve;
+
+static void row_pack_CMYK8888_resolve(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C) = row_pack_CMYK8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_CMYK8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_CMYK8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_CMYK8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_CMYK8888()", variant);
+
+	__atomic_store_n(&row_pack_CMYK8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, K, Y, M, C);
+}
+
+static inline void row_pack_CMYK8888(void *restrict dst, gp_size w, const int *restrict K, const int *restrict Y, const int *restrict M, const int *restrict C)
+{
+	__atomic_load_n(&row_pack_CMYK8888_fn, __ATOMIC_RELAXED)(dst, w, K, Y, M, C);
+}
+
+void gp_pixel_row_unpack_CMYK8888(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_CMYK8888(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+void gp_pixel_row_pack_CMYK8888(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_CMYK8888(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_P2(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_P_P2(p);
+	}
+}
+
+void gp_pixel_row_pack_P2(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_P2(chans[0][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_P4(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_P_P4(p);
+	}
+}
+
+void gp_pixel_row_pack_P4(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_P4(chans[0][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+GP_SIMD_BODY void row_unpack_P8_body(const void *restrict src, gp_size w,
+                                 int *restrict P)
+{
+	const uint8_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		P[i] = GP_PIXEL_GET_P_P8(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_P8_generic(const void *restrict src, gp_size w, int *restrict P)
+{
+	row_unpack_P8_body(src, w, P);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_P8_sse2(const void *restrict src, gp_size w, int *restrict P)
+{
+	row_unpack_P8_body(src, w, P);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_P8_avx2(const void *restrict src, gp_size w, int *restrict P)
+{
+	row_unpack_P8_body(src, w, P);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_P8_neon(const void *restrict src, gp_size w, int *restrict P)
+{
+	row_unpack_P8_body(src, w, P);
+}
+#endif
+
+static void row_unpack_P8_resolve(const void *restrict src, gp_size w, int *restrict P);
+
+static void (*row_unpack_P8_fn)(const void *restrict src, gp_size w, int *restrict P) = row_unpack_P8_resolve;
+
+static void row_unpack_P8_resolve(const void *restrict src, gp_size w, int *restrict P)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict P) = row_unpack_P8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_P8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_P8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_P8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_P8()", variant);
+
+	__atomic_store_n(&row_unpack_P8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, P);
+}
+
+static inline void row_unpack_P8(const void *restrict src, gp_size w, int *restrict P)
+{
+	__atomic_load_n(&row_unpack_P8_fn, __ATOMIC_RELAXED)(src, w, P);
+}
+
+GP_SIMD_BODY void row_pack_P8_body(void *restrict dst, gp_size w,
+                               const int *restrict P)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_P8(P[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_P8_generic(void *restrict dst, gp_size w, const int *restrict P)
+{
+	row_pack_P8_body(dst, w, P);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_P8_sse2(void *restrict dst, gp_size w, const int *restrict P)
+{
+	row_pack_P8_body(dst, w, P);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_P8_avx2(void *restrict dst, gp_size w, const int *restrict P)
+{
+	row_pack_P8_body(dst, w, P);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_P8_neon(void *restrict dst, gp_size w, const int *restrict P)
+{
+	row_pack_P8_body(dst, w, P);
+}
+#endif
+
+static void row_pack_P8_resolve(void *restrict dst, gp_size w, const int *restrict P);
+
+static void (*row_pack_P8_fn)(void *restrict dst, gp_size w, const int *restrict P) = row_pack_P8_resolve;
+
+static void row_pack_P8_resolve(void *restrict dst, gp_size w, const int *restrict P)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict P) = row_pack_P8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_P8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_P8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_P8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_P8()", variant);
+
+	__atomic_store_n(&row_pack_P8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, P);
+}
+
+static inline void row_pack_P8(void *restrict dst, gp_size w, const int *restrict P)
+{
+	__atomic_load_n(&row_pack_P8_fn, __ATOMIC_RELAXED)(dst, w, P);
+}
+
+void gp_pixel_row_unpack_P8(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_P8(GP_PIXEL_ADDR(src, x, y), w, chans[0]);
+}
+
+void gp_pixel_row_pack_P8(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_P8(GP_PIXEL_ADDR(dst, x, y), w, chans[0]);
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_G1(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_V_G1(p);
+	}
+}
+
+void gp_pixel_row_pack_G1(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_G1(chans[0][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_G2(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_V_G2(p);
+	}
+}
+
+void gp_pixel_row_pack_G2(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_G2(chans[0][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_G4(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_V_G4(p);
+	}
+}
+
+void gp_pixel_row_pack_G4(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_G4(chans[0][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+GP_SIMD_BODY void row_unpack_G8_body(const void *restrict src, gp_size w,
+                                 int *restrict V)
+{
+	const uint8_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		V[i] = GP_PIXEL_GET_V_G8(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_G8_generic(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G8_body(src, w, V);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_G8_sse2(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G8_body(src, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_G8_avx2(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G8_body(src, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_G8_neon(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G8_body(src, w, V);
+}
+#endif
+
+static void row_unpack_G8_resolve(const void *restrict src, gp_size w, int *restrict V);
+
+static void (*row_unpack_G8_fn)(const void *restrict src, gp_size w, int *restrict V) = row_unpack_G8_resolve;
+
+static void row_unpack_G8_resolve(const void *restrict src, gp_size w, int *restrict V)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict V) = row_unpack_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_G8()", variant);
+
+	__atomic_store_n(&row_unpack_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, V);
+}
+
+static inline void row_unpack_G8(const void *restrict src, gp_size w, int *restrict V)
+{
+	__atomic_load_n(&row_unpack_G8_fn, __ATOMIC_RELAXED)(src, w, V);
+}
+
+GP_SIMD_BODY void row_pack_G8_body(void *restrict dst, gp_size w,
+                               const int *restrict V)
+{
+	uint8_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_G8(V[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_G8_generic(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G8_body(dst, w, V);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_G8_sse2(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G8_body(dst, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_G8_avx2(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G8_body(dst, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_G8_neon(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G8_body(dst, w, V);
+}
+#endif
+
+static void row_pack_G8_resolve(void *restrict dst, gp_size w, const int *restrict V);
+
+static void (*row_pack_G8_fn)(void *restrict dst, gp_size w, const int *restrict V) = row_pack_G8_resolve;
+
+static void row_pack_G8_resolve(void *restrict dst, gp_size w, const int *restrict V)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict V) = row_pack_G8_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_G8_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_G8_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_G8_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_G8()", variant);
+
+	__atomic_store_n(&row_pack_G8_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, V);
+}
+
+static inline void row_pack_G8(void *restrict dst, gp_size w, const int *restrict V)
+{
+	__atomic_load_n(&row_pack_G8_fn, __ATOMIC_RELAXED)(dst, w, V);
+}
+
+void gp_pixel_row_unpack_G8(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_G8(GP_PIXEL_ADDR(src, x, y), w, chans[0]);
+}
+
+void gp_pixel_row_pack_G8(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_G8(GP_PIXEL_ADDR(dst, x, y), w, chans[0]);
+}
+
+GP_SIMD_BODY void row_unpack_GA88_body(const void *restrict src, gp_size w,
+                                 int *restrict V, int *restrict A)
+{
+	const uint16_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		V[i] = GP_PIXEL_GET_V_GA88(p);
+		A[i] = GP_PIXEL_GET_A_GA88(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_GA88_generic(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	row_unpack_GA88_body(src, w, V, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_GA88_sse2(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	row_unpack_GA88_body(src, w, V, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_GA88_avx2(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	row_unpack_GA88_body(src, w, V, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_GA88_neon(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	row_unpack_GA88_body(src, w, V, A);
+}
+#endif
+
+static void row_unpack_GA88_resolve(const void *restrict src, gp_size w, int *restrict V, int *restrict A);
+
+static void (*row_unpack_GA88_fn)(const void *restrict src, gp_size w, int *restrict V, int *restrict A) = row_unpack_GA88_resolve;
+
+static void row_unpack_GA88_resolve(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict V, int *restrict A) = row_unpack_GA88_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_GA88_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_GA88_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_GA88_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_GA88()", variant);
+
+	__atomic_store_n(&row_unpack_GA88_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, V, A);
+}
+
+static inline void row_unpack_GA88(const void *restrict src, gp_size w, int *restrict V, int *restrict A)
+{
+	__atomic_load_n(&row_unpack_GA88_fn, __ATOMIC_RELAXED)(src, w, V, A);
+}
+
+GP_SIMD_BODY void row_pack_GA88_body(void *restrict dst, gp_size w,
+                               const int *restrict V, const int *restrict A)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_GA88(V[i], A[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_GA88_generic(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	row_pack_GA88_body(dst, w, V, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_GA88_sse2(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	row_pack_GA88_body(dst, w, V, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_GA88_avx2(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	row_pack_GA88_body(dst, w, V, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_GA88_neon(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	row_pack_GA88_body(dst, w, V, A);
+}
+#endif
+
+static void row_pack_GA88_resolve(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A);
+
+static void (*row_pack_GA88_fn)(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A) = row_pack_GA88_resolve;
+
+static void row_pack_GA88_resolve(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A) = row_pack_GA88_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_GA88_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_GA88_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_GA88_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_GA88()", variant);
+
+	__atomic_store_n(&row_pack_GA88_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, V, A);
+}
+
+static inline void row_pack_GA88(void *restrict dst, gp_size w, const int *restrict V, const int *restrict A)
+{
+	__atomic_load_n(&row_pack_GA88_fn, __ATOMIC_RELAXED)(dst, w, V, A);
+}
+
+void gp_pixel_row_unpack_GA88(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_GA88(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1]);
+}
+
+void gp_pixel_row_pack_GA88(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_GA88(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1]);
+}
+
+GP_SIMD_BODY void row_unpack_G16_body(const void *restrict src, gp_size w,
+                                 int *restrict V)
+{
+	const uint16_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		V[i] = GP_PIXEL_GET_V_G16(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_G16_generic(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G16_body(src, w, V);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_G16_sse2(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G16_body(src, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_G16_avx2(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G16_body(src, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_G16_neon(const void *restrict src, gp_size w, int *restrict V)
+{
+	row_unpack_G16_body(src, w, V);
+}
+#endif
+
+static void row_unpack_G16_resolve(const void *restrict src, gp_size w, int *restrict V);
+
+static void (*row_unpack_G16_fn)(const void *restrict src, gp_size w, int *restrict V) = row_unpack_G16_resolve;
+
+static void row_unpack_G16_resolve(const void *restrict src, gp_size w, int *restrict V)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict V) = row_unpack_G16_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_G16_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_G16_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_G16_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_G16()", variant);
+
+	__atomic_store_n(&row_unpack_G16_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, V);
+}
+
+static inline void row_unpack_G16(const void *restrict src, gp_size w, int *restrict V)
+{
+	__atomic_load_n(&row_unpack_G16_fn, __ATOMIC_RELAXED)(src, w, V);
+}
+
+GP_SIMD_BODY void row_pack_G16_body(void *restrict dst, gp_size w,
+                               const int *restrict V)
+{
+	uint16_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_G16(V[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_G16_generic(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G16_body(dst, w, V);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_G16_sse2(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G16_body(dst, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_G16_avx2(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G16_body(dst, w, V);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_G16_neon(void *restrict dst, gp_size w, const int *restrict V)
+{
+	row_pack_G16_body(dst, w, V);
+}
+#endif
+
+static void row_pack_G16_resolve(void *restrict dst, gp_size w, const int *restrict V);
+
+static void (*row_pack_G16_fn)(void *restrict dst, gp_size w, const int *restrict V) = row_pack_G16_resolve;
+
+static void row_pack_G16_resolve(void *restrict dst, gp_size w, const int *restrict V)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict V) = row_pack_G16_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_G16_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_G16_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_G16_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_G16()", variant);
+
+	__atomic_store_n(&row_pack_G16_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, V);
+}
+
+static inline void row_pack_G16(void *restrict dst, gp_size w, const int *restrict V)
+{
+	__atomic_load_n(&row_pack_G16_fn, __ATOMIC_RELAXED)(dst, w, V);
+}
+
+void gp_pixel_row_unpack_G16(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_G16(GP_PIXEL_ADDR(src, x, y), w, chans[0]);
+}
+
+void gp_pixel_row_pack_G16(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_G16(GP_PIXEL_ADDR(dst, x, y), w, chans[0]);
+}
+
+GP_SIMD_BODY void row_unpack_RGBA8888_PM_body(const void *restrict src, gp_size w,
+                                 int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	const uint32_t *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += 1) {
+		gp_pixel p = s[0];
+
+		R[i] = GP_PIXEL_GET_R_RGBA8888_PM(p);
+		G[i] = GP_PIXEL_GET_G_RGBA8888_PM(p);
+		B[i] = GP_PIXEL_GET_B_RGBA8888_PM(p);
+		A[i] = GP_PIXEL_GET_A_RGBA8888_PM(p);
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_unpack_RGBA8888_PM_generic(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_PM_body(src, w, R, G, B, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_unpack_RGBA8888_PM_sse2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_PM_body(src, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_unpack_RGBA8888_PM_avx2(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_PM_body(src, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_unpack_RGBA8888_PM_neon(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	row_unpack_RGBA8888_PM_body(src, w, R, G, B, A);
+}
+#endif
+
+static void row_unpack_RGBA8888_PM_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A);
+
+static void (*row_unpack_RGBA8888_PM_fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A) = row_unpack_RGBA8888_PM_resolve;
+
+static void row_unpack_RGBA8888_PM_resolve(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A) = row_unpack_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_unpack_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_unpack_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_unpack_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_unpack_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&row_unpack_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(src, w, R, G, B, A);
+}
+
+static inline void row_unpack_RGBA8888_PM(const void *restrict src, gp_size w, int *restrict R, int *restrict G, int *restrict B, int *restrict A)
+{
+	__atomic_load_n(&row_unpack_RGBA8888_PM_fn, __ATOMIC_RELAXED)(src, w, R, G, B, A);
+}
+
+GP_SIMD_BODY void row_pack_RGBA8888_PM_body(void *restrict dst, gp_size w,
+                               const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	uint32_t *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += 1) {
+		gp_pixel p = GP_PIXEL_CREATE_RGBA8888_PM(R[i], G[i], B[i], A[i]);
+
+		d[0] = p;
+	}
+}
+
+GP_SIMD_VARIANT
+static void row_pack_RGBA8888_PM_generic(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_PM_body(dst, w, R, G, B, A);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void row_pack_RGBA8888_PM_sse2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_PM_body(dst, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void row_pack_RGBA8888_PM_avx2(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_PM_body(dst, w, R, G, B, A);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void row_pack_RGBA8888_PM_neon(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	row_pack_RGBA8888_PM_body(dst, w, R, G, B, A);
+}
+#endif
+
+static void row_pack_RGBA8888_PM_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A);
+
+static void (*row_pack_RGBA8888_PM_fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A) = row_pack_RGBA8888_PM_resolve;
+
+static void row_pack_RGBA8888_PM_resolve(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A) = row_pack_RGBA8888_PM_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = row_pack_RGBA8888_PM_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = row_pack_RGBA8888_PM_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = row_pack_RGBA8888_PM_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of row_pack_RGBA8888_PM()", variant);
+
+	__atomic_store_n(&row_pack_RGBA8888_PM_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, w, R, G, B, A);
+}
+
+static inline void row_pack_RGBA8888_PM(void *restrict dst, gp_size w, const int *restrict R, const int *restrict G, const int *restrict B, const int *restrict A)
+{
+	__atomic_load_n(&row_pack_RGBA8888_PM_fn, __ATOMIC_RELAXED)(dst, w, R, G, B, A);
+}
+
+void gp_pixel_row_unpack_RGBA8888_PM(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_RGBA8888_PM(GP_PIXEL_ADDR(src, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+void gp_pixel_row_pack_RGBA8888_PM(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_RGBA8888_PM(GP_PIXEL_ADDR(dst, x, y), w, chans[0], chans[1], chans[2], chans[3]);
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_RGB161616(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_R_RGB161616(p);
+		chans[1][i] = GP_PIXEL_GET_G_RGB161616(p);
+		chans[2][i] = GP_PIXEL_GET_B_RGB161616(p);
+	}
+}
+
+void gp_pixel_row_pack_RGB161616(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_RGB161616(chans[0][i], chans[1][i], chans[2][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_RGBA16161616(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		chans[0][i] = GP_PIXEL_GET_R_RGBA16161616(p);
+		chans[1][i] = GP_PIXEL_GET_G_RGBA16161616(p);
+		chans[2][i] = GP_PIXEL_GET_B_RGBA16161616(p);
+		chans[3][i] = GP_PIXEL_GET_A_RGBA16161616(p);
+	}
+}
+
+void gp_pixel_row_pack_RGBA16161616(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_RGBA16161616(chans[0][i], chans[1][i], chans[2][i], chans[3][i]);
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+static gp_pixel_row_unpack_fn *row_unpack_fn(gp_pixel_type type)
+{
+	switch (type) {
+	case GP_PIXEL_xRGB8888:
+		return gp_pixel_row_unpack_xRGB8888;
+	case GP_PIXEL_RGBA8888:
+		return gp_pixel_row_unpack_RGBA8888;
+	case GP_PIXEL_RGB888:
+		return gp_pixel_row_unpack_RGB888;
+	case GP_PIXEL_BGR888:
+		return gp_pixel_row_unpack_BGR888;
+	case GP_PIXEL_RGB555:
+		return gp_pixel_row_unpack_RGB555;
+	case GP_PIXEL_RGB565:
+		return gp_pixel_row_unpack_RGB565;
+	case GP_PIXEL_RGB666:
+		return gp_pixel_row_unpack_RGB666;
+	case GP_PIXEL_RGB332:
+		return gp_pixel_row_unpack_RGB332;
+	case GP_PIXEL_CMYK8888:
+		return gp_pixel_row_unpack_CMYK8888;
+	case GP_PIXEL_P2:
+		return gp_pixel_row_unpack_P2;
+	case GP_PIXEL_P4:
+		return gp_pixel_row_unpack_P4;
+	case GP_PIXEL_P8:
+		return gp_pixel_row_unpack_P8;
+	case GP_PIXEL_G1:
+		return gp_pixel_row_unpack_G1;
+	case GP_PIXEL_G2:
+		return gp_pixel_row_unpack_G2;
+	case GP_PIXEL_G4:
+		return gp_pixel_row_unpack_G4;
+	case GP_PIXEL_G8:
+		return gp_pixel_row_unpack_G8;
+	case GP_PIXEL_GA88:
+		return gp_pixel_row_unpack_GA88;
+	case GP_PIXEL_G16:
+		return gp_pixel_row_unpack_G16;
+	case GP_PIXEL_RGBA8888_PM:
+		return gp_pixel_row_unpack_RGBA8888_PM;
+	case GP_PIXEL_RGB161616:
+		return gp_pixel_row_unpack_RGB161616;
+	case GP_PIXEL_RGBA16161616:
+		return gp_pixel_row_unpack_RGBA16161616;
+	default:
+		GP_ABORT("Invalid pixel type %u", type);
+	}
+}
+
+static gp_pixel_row_pack_fn *row_pack_fn(gp_pixel_type type)
+{
+	switch (type) {
+	case GP_PIXEL_xRGB8888:
+		return gp_pixel_row_pack_xRGB8888;
+	case GP_PIXEL_RGBA8888:
+		return gp_pixel_row_pack_RGBA8888;
+	case GP_PIXEL_RGB888:
+		return gp_pixel_row_pack_RGB888;
+	case GP_PIXEL_BGR888:
+		return gp_pixel_row_pack_BGR888;
+	case GP_PIXEL_RGB555:
+		return gp_pixel_row_pack_RGB555;
+	case GP_PIXEL_RGB565:
+		return gp_pixel_row_pack_RGB565;
+	case GP_PIXEL_RGB666:
+		return gp_pixel_row_pack_RGB666;
+	case GP_PIXEL_RGB332:
+		return gp_pixel_row_pack_RGB332;
+	case GP_PIXEL_CMYK8888:
+		return gp_pixel_row_pack_CMYK8888;
+	case GP_PIXEL_P2:
+		return gp_pixel_row_pack_P2;
+	case GP_PIXEL_P4:
+		return gp_pixel_row_pack_P4;
+	case GP_PIXEL_P8:
+		return gp_pixel_row_pack_P8;
+	case GP_PIXEL_G1:
+		return gp_pixel_row_pack_G1;
+	case GP_PIXEL_G2:
+		return gp_pixel_row_pack_G2;
+	case GP_PIXEL_G4:
+		return gp_pixel_row_pack_G4;
+	case GP_PIXEL_G8:
+		return gp_pixel_row_pack_G8;
+	case GP_PIXEL_GA88:
+		return gp_pixel_row_pack_GA88;
+	case GP_PIXEL_G16:
+		return gp_pixel_row_pack_G16;
+	case GP_PIXEL_RGBA8888_PM:
+		return gp_pixel_row_pack_RGBA8888_PM;
+	case GP_PIXEL_RGB161616:
+		return gp_pixel_row_pack_RGB161616;
+	case GP_PIXEL_RGBA16161616:
+		return gp_pixel_row_pack_RGBA16161616;
+	default:
+		GP_ABORT("Invalid pixel type %u", type);
+	}
+}
+
+void gp_pixel_row_unpack(const gp_pixmap *src, gp_coord x, gp_coord y,
+                         gp_size w, int *const chans[])
+{
+	row_unpack_fn(src->pixel_type)(src, x, y, w, chans);
+}
+
+void gp_pixel_row_pack(gp_pixmap *dst, gp_coord x, gp_coord y,
+                       gp_size w, int *const chans[])
+{
+	row_pack_fn(dst->pixel_type)(dst, x, y, w, chans);
+}
@@ -0,0 +1,146 @@
+@ include source.t
+/*
+ * Bulk row unpack and pack functions.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+@ include simd.t
+@ include convert_row.t
+@
+@ def chan_params(pt, const=''):
+@     return [(const + 'int *restrict', c.name) for c in pt.chanslist]
+@ end
+@
+@ def chan_args(pt):
+@     return ', '.join(['chans[%i]' % i for i in range(len(pt.chanslist))])
+@ end
+@
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and has_byte_row(pt):
+GP_SIMD_BODY void row_unpack_{{ pt.name }}_body(const void *restrict src, gp_size w,
+                                 {{ ', '.join([simd_param(p) for p in chan_params(pt)]) }})
+{
+	const {{ row_type(pt) }} *restrict s = src;
+	gp_size i;
+
+	for (i = 0; i < w; i++, s += {{ row_step(pt) }}) {
+		gp_pixel p = {{ load_pixel(pt) }};
+
+@         for c in pt.chanslist:
+		{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p);
+@         end
+	}
+}
+
+{@ simd_function('void', 'row_unpack_' + pt.name, [('const void *restrict', 'src'), ('gp_size', 'w')] + chan_params(pt)) @}
+
+GP_SIMD_BODY void row_pack_{{ pt.name }}_body(void *restrict dst, gp_size w,
+                               {{ ', '.join([simd_param(p) for p in chan_params(pt, 'const ')]) }})
+{
+	{{ row_type(pt) }} *restrict d = dst;
+	gp_size i;
+
+	for (i = 0; i < w; i++, d += {{ row_step(pt) }}) {
+		gp_pixel p = GP_PIXEL_CREATE_{{ pt.name }}({{ ', '.join([c.name + '[i]' for c in pt.chanslist]) }});
+
+{@ store_pixel(pt, 'p') @}
+	}
+}
+
+{@ simd_function('void', 'row_pack_' + pt.name, [('void *restrict', 'dst'), ('gp_size', 'w')] + chan_params(pt, 'const ')) @}
+
+void gp_pixel_row_unpack_{{ pt.name }}(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	row_unpack_{{ pt.name }}(GP_PIXEL_ADDR(src, x, y), w, {{ chan_args(pt) }});
+}
+
+void gp_pixel_row_pack_{{ pt.name }}(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	row_pack_{{ pt.name }}(GP_PIXEL_ADDR(dst, x, y), w, {{ chan_args(pt) }});
+}
+
+@     elif not pt.is_unknown():
+/*
+ * Pixels are not byte aligned, the bit offset and bit endian are handled by
+ * the generic pixel access.
+ */
+void gp_pixel_row_unpack_{{ pt.name }}(const gp_pixmap *src,
+                                       gp_coord x, gp_coord y, gp_size w,
+                                       int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+@         for i, c in enumerate(pt.chanslist):
+		chans[{{ i }}][i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p);
+@         end
+	}
+}
+
+void gp_pixel_row_pack_{{ pt.name }}(gp_pixmap *dst,
+                                     gp_coord x, gp_coord y, gp_size w,
+                                     int *const chans[])
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		gp_pixel p = GP_PIXEL_CREATE_{{ pt.name }}({{ ', '.join(['chans[%i][i]' % i for i in range(len(pt.chanslist))]) }});
+
+		gp_putpixel_raw(dst, x + i, y, p);
+	}
+}
+
+@ end
+@
+static gp_pixel_row_unpack_fn *row_unpack_fn(gp_pixel_type type)
+{
+	switch (type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown():
+	case GP_PIXEL_{{ pt.name }}:
+		return gp_pixel_row_unpack_{{ pt.name }};
+@ end
+	default:
+		GP_ABORT("Invalid pixel type %u", type);
+	}
+}
+
+static gp_pixel_row_pack_fn *row_pack_fn(gp_pixel_type type)
+{
+	switch (type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown():
+	case GP_PIXEL_{{ pt.name }}:
+		return gp_pixel_row_pack_{{ pt.name }};
+@ end
+	default:
+		GP_ABORT("Invalid pixel type %u", type);
+	}
+}
+
+void gp_pixel_row_unpack(const gp_pixmap *src, gp_coord x, gp_coord y,
+                         gp_size w, int *const chans[])
+{
+	row_unpack_fn(src->pixel_type)(src, x, y, w, chans);
+}
+
+void gp_pixel_row_pack(gp_pixmap *dst, gp_coord x, gp_coord y,
+                       gp_size w, int *const chans[])
+{
+	row_pack_fn(dst->pixel_type)(dst, x, y, w, chans);
+}
@@ -8,6 +8,7 @@
 
 #include <errno.h>
 #include <string.h>
+#include <sys/mman.h>
 
 #include <core/gp_debug.h>
 #include <core/gp_transform.h>
@@ -15,7 +16,12 @@
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_gamma.h>
 #include "core/gp_pixmap.h"
+#include <core/gp_pixmap_pool.h>
+#include <core/gp_damage.h>
 #include <core/gp_blit.h>
+#include <core/gp_convert.h>
+#include <core/gp_threads.h>
+#include <core/gp_temp_alloc.h>
 
 static uint32_t get_bpr(uint32_t bpp, uint32_t w)
 {
@@ -30,12 +36,204 @@ static uint32_t get_bpr(uint32_t bpp, uint32_t w)
 	return bits_per_row / 8 + padd;
 }
 
-gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
+static uint32_t get_bpr_ex(uint32_t bpp, uint32_t w, int flags)
+{
+	uint64_t bpr = get_bpr(bpp, w);
+
+	if (!(flags & (GP_PIXMAP_ALIGN_ROWS | GP_PIXMAP_PAD_ROWS)))
+		return bpr;
+
+	bpr = (bpr + GP_PIXMAP_ROW_ALIGNMENT - 1) & ~(uint64_t)(GP_PIXMAP_ROW_ALIGNMENT - 1);
+
+	if ((flags & GP_PIXMAP_PAD_ROWS) && !(bpr % GP_PIXMAP_CRITICAL_STRIDE))
+		bpr += GP_PIXMAP_ROW_ALIGNMENT;
+
+	if (bpr > UINT32_MAX) {
+		GP_WARN("Pixmap too wide %u (overflow detected)", w);
+		return 0;
+	}
+
+	return bpr;
+}
+
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+/*
+ * Maps the buffer aligned to the huge page size, the kernel can back only
+ * aligned huge page sized blocks by huge pages.
+ */
+static void *mmap_pixels(size_t size)
+{
+	size_t map_size = size + HUGE_PAGE_SIZE;
+	uint8_t *map, *pixels;
+
+	if (map_size < size)
+		return NULL;
+
+	map = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+	           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (map == MAP_FAILED) {
+		GP_DEBUG(1, "mmap() failed: %s", strerror(errno));
+		return NULL;
+	}
+
+	pixels = (uint8_t*)(((uintptr_t)map + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+	size = (size + getpagesize() - 1) & ~(size_t)(getpagesize() - 1);
+
+	if (pixels != map)
+		munmap(map, pixels - map);
+
+	if (map + map_size > pixels + size)
+		munmap(pixels + size, map + map_size - pixels - size);
+
+#ifdef MADV_HUGEPAGE
+	if (madvise(pixels, size, MADV_HUGEPAGE))
+		GP_DEBUG(1, "madvise(MADV_HUGEPAGE) failed: %s", strerror(errno));
+#endif
+
+	return pixels;
+}
+
+static void *alloc_pixels(gp_pixmap *pixmap, size_t size, int flags)
+{
+	void *pixels;
+
+	pixmap->mmap_pixels = 0;
+	pixmap->file_pixels = 0;
+
+	if ((flags & GP_PIXMAP_HUGE_PAGES) && size >= GP_PIXMAP_HUGE_PAGES_MIN) {
+		pixels = mmap_pixels(size);
+
+		if (pixels) {
+			pixmap->mmap_pixels = 1;
+			return pixels;
+		}
+
+		GP_DEBUG(1, "Falling back to malloc()");
+	}
+
+	if (!(flags & (GP_PIXMAP_ALIGN_ROWS | GP_PIXMAP_PAD_ROWS)))
+		return malloc(size);
+
+	if (posix_memalign(&pixels, GP_PIXMAP_ROW_ALIGNMENT, size))
+		return NULL;
+
+	return pixels;
+}
+
+static void free_pixels(gp_pixmap *pixmap)
+{
+	if (pixmap->mmap_pixels)
+		munmap(pixmap->pixels, (size_t)pixmap->bytes_per_row * pixmap->h);
+	else
+		free(pixmap->pixels);
+}
+
+/*
+ * Drops a reference to the pixels, the last one frees them.
+ */
+static void release_pixels(gp_pixmap *pixmap)
+{
+	unsigned int *refs = pixmap->pixels_refs;
+
+	pixmap->pixels_refs = NULL;
+
+	if (!refs) {
+		free_pixels(pixmap);
+		return;
+	}
+
+	if (__atomic_sub_fetch(refs, 1, __ATOMIC_ACQ_REL))
+		return;
+
+	free(refs);
+	free_pixels(pixmap);
+}
+
+static int pixels_aligned(const gp_pixmap *pixmap)
+{
+	return !((uintptr_t)pixmap->pixels % GP_PIXMAP_ROW_ALIGNMENT);
+}
+
+int gp_pixmap_fork_pixels(gp_pixmap *self)
+{
+	size_t size = (size_t)self->bytes_per_row * self->h;
+	uint8_t *pixels;
+
+	/* All other copies were freed or forked already */
+	if (__atomic_load_n(self->pixels_refs, __ATOMIC_ACQUIRE) == 1) {
+		free(self->pixels_refs);
+		self->pixels_refs = NULL;
+		return 0;
+	}
+
+	GP_DEBUG(1, "Forking shared pixels of pixmap (%p)", self);
+
+	pixels = alloc_pixels(self, size,
+	                      pixels_aligned(self) ? GP_PIXMAP_ALIGN_ROWS : 0);
+	if (!pixels) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	memcpy(pixels, self->pixels, size);
+
+	release_pixels(self);
+
+	self->pixels = pixels;
+
+	return 0;
+}
+
+/*
+ * Allocates the pixmap structure and pixels or takes them from the thread
+ * default pool, the rest of the pixmap is initialized by the caller.
+ */
+static gp_pixmap *pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type,
+                               uint32_t bpr, int flags)
+{
+	gp_pixmap_pool *pool = gp_pixmap_pool_get_default();
+	gp_pixmap *pixmap;
+
+	if (pool) {
+		pixmap = gp_pixmap_pool_get(pool, w, h, type, bpr, flags);
+		if (pixmap)
+			return pixmap;
+	}
+
+	pixmap = malloc(sizeof(gp_pixmap));
+
+	if (pixmap == NULL) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	pixmap->pixels = alloc_pixels(pixmap, (size_t)bpr * h, flags);
+
+	if (pixmap->pixels == NULL) {
+		free(pixmap);
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	pixmap->pool = NULL;
+
+	if (pool)
+		gp_pixmap_pool_attach(pool, pixmap);
+
+	return pixmap;
+}
+
+gp_pixmap *gp_pixmap_alloc_ex(gp_size w, gp_size h, gp_pixel_type type,
+                              int flags)
 {
 	gp_pixmap *pixmap;
 	uint32_t bpp;
 	size_t bpr;
-	void *pixels;
 
 	if (!GP_VALID_PIXELTYPE(type)) {
 		GP_WARN("Invalid pixel type %u", type);
@@ -49,12 +247,12 @@ gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
 		return NULL;
 	}
 
-	GP_DEBUG(1, "Allocating pixmap %u x %u - %s",
-	         w, h, gp_pixel_type_name(type));
+	GP_DEBUG(1, "Allocating pixmap %u x %u - %s flags 0x%02x",
+	         w, h, gp_pixel_type_name(type), flags);
 
 	bpp = gp_pixel_size(type);
 
-	if (!(bpr = get_bpr(bpp, w)))
+	if (!(bpr = get_bpr_ex(bpp, w, flags)))
 		return NULL;
 
 	size_t size = bpr * h;
@@ -64,18 +262,10 @@ gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
 		return NULL;
 	}
 
-	pixels = malloc(size);
-	pixmap = malloc(sizeof(gp_pixmap));
-
-	if (pixels == NULL || pixmap == NULL) {
-		free(pixels);
-		free(pixmap);
-		GP_WARN("Malloc failed :(");
-		errno = ENOMEM;
+	pixmap = pixmap_alloc(w, h, type, bpr, flags);
+	if (!pixmap)
 		return NULL;
-	}
 
-	pixmap->pixels        = pixels;
 	pixmap->bpp           = bpp;
 	pixmap->bytes_per_row = bpr;
 	pixmap->offset        = 0;
@@ -93,10 +283,18 @@ gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
 	gp_pixmap_set_rotation(pixmap, 0, 0, 0);
 
 	pixmap->free_pixels = 1;
+	pixmap->sub_pixmaps = 0;
+	pixmap->pixels_refs = NULL;
+	pixmap->damage = NULL;
 
 	return pixmap;
 }
 
+gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
+{
+	return gp_pixmap_alloc_ex(w, h, type, 0);
+}
+
 int gp_pixmap_set_gamma(gp_pixmap *self, float gamma)
 {
 	gp_gamma_release(self->gamma);
@@ -113,11 +311,18 @@ void gp_pixmap_free(gp_pixmap *pixmap)
 	if (pixmap == NULL)
 		return;
 
-	if (pixmap->free_pixels)
-		free(pixmap->pixels);
-
-	if (pixmap->gamma)
+	if (pixmap->gamma) {
 		gp_gamma_release(pixmap->gamma);
+		pixmap->gamma = NULL;
+	}
+
+	gp_pixmap_damage_free(pixmap);
+
+	if (pixmap->pool && !gp_pixmap_pool_put(pixmap))
+		return;
+
+	if (pixmap->free_pixels)
+		release_pixels(pixmap);
 
 	free(pixmap);
 }
@@ -145,6 +350,12 @@ gp_pixmap *gp_pixmap_init(gp_pixmap *pixmap, gp_size w, gp_size h,
 	gp_pixmap_set_rotation(pixmap, 0, 0, 0);
 
 	pixmap->free_pixels = 0;
+	pixmap->mmap_pixels = 0;
+	pixmap->file_pixels = 0;
+	pixmap->sub_pixmaps = 0;
+	pixmap->pixels_refs = NULL;
+	pixmap->pool = NULL;
+	pixmap->damage = NULL;
 
 	return pixmap;
 }
@@ -154,7 +365,31 @@ int gp_pixmap_resize(gp_pixmap *pixmap, gp_size w, gp_size h)
 	uint32_t bpr = get_bpr(pixmap->bpp, w);
 	void *pixels;
 
-	pixels = realloc(pixmap->pixels, bpr * h);
+	if (pixmap->file_pixels) {
+		GP_WARN("Cannot resize pixmap mapped from a file");
+		errno = ENOTSUP;
+		return 1;
+	}
+
+	if (!bpr)
+		return 1;
+
+	/* The pixel values are not preserved, no need to copy them */
+	if (pixmap->mmap_pixels || pixmap->pixels_refs) {
+		int flags = pixmap->mmap_pixels ? GP_PIXMAP_HUGE_PAGES : 0;
+		gp_pixmap old = *pixmap;
+
+		pixels = alloc_pixels(pixmap, (size_t)bpr * h, flags);
+		if (!pixels) {
+			pixmap->mmap_pixels = old.mmap_pixels;
+			return 1;
+		}
+
+		release_pixels(&old);
+		pixmap->pixels_refs = NULL;
+	} else {
+		pixels = realloc(pixmap->pixels, (size_t)bpr * h);
+	}
 
 	if (pixels == NULL)
 		return 1;
@@ -164,32 +399,91 @@ int gp_pixmap_resize(gp_pixmap *pixmap, gp_size w, gp_size h)
 	pixmap->bytes_per_row = bpr;
 	pixmap->pixels = pixels;
 
+	/* The content is not preserved, the old damage is meaningless */
+	gp_pixmap_damage_clear(pixmap);
+	gp_pixmap_damage_all(pixmap);
+
 	return 0;
 }
 
+/*
+ * Only pixels allocated by the library can be shared, mmap()ed pixels may be
+ * backed by a file that has to see the writes.
+ */
+static int can_share_pixels(const gp_pixmap *src)
+{
+	return src->free_pixels && !src->mmap_pixels && !src->sub_pixmaps;
+}
+
+/*
+ * Returns the reference counter with the reference for the new copy.
+ *
+ * The source is const, so it may be shared from several threads at once,
+ * hence the counter is allocated and published with compare and exchange.
+ */
+static unsigned int *share_pixels(const gp_pixmap *src)
+{
+	/* The reference counter is not part of the pixmap value */
+	gp_pixmap *self = (gp_pixmap *)src;
+	unsigned int *refs, *new_refs;
+
+	refs = __atomic_load_n(&self->pixels_refs, __ATOMIC_ACQUIRE);
+
+	if (!refs) {
+		new_refs = malloc(sizeof(*new_refs));
+		if (!new_refs)
+			return NULL;
+
+		*new_refs = 1;
+
+		if (__atomic_compare_exchange_n(&self->pixels_refs, &refs,
+		                                new_refs, 0, __ATOMIC_ACQ_REL,
+		                                __ATOMIC_ACQUIRE))
+			refs = new_refs;
+		else
+			free(new_refs);
+	}
+
+	__atomic_add_fetch(refs, 1, __ATOMIC_RELAXED);
+
+	return refs;
+}
+
 gp_pixmap *gp_pixmap_copy(const gp_pixmap *src, int flags)
 {
 	gp_pixmap *new;
-	uint8_t *pixels;
+	int share;
 
 	if (src == NULL)
 		return NULL;
 
-	new = malloc(sizeof(gp_pixmap));
-	pixels = malloc(src->bytes_per_row * src->h);
-
-	if (pixels == NULL || new == NULL) {
-		free(pixels);
-		free(new);
-		GP_WARN("Malloc failed :(");
-		errno = ENOMEM;
-		return NULL;
+	share = (flags & GP_COPY_SHARE_PIXELS) && can_share_pixels(src);
+
+	if (share) {
+		new = malloc(sizeof(gp_pixmap));
+		if (!new || !(new->pixels_refs = share_pixels(src))) {
+			free(new);
+			GP_WARN("Malloc failed :(");
+			errno = ENOMEM;
+			return NULL;
+		}
+
+		new->pixels = src->pixels;
+		new->mmap_pixels = 0;
+		new->file_pixels = 0;
+		new->pool = NULL;
+	} else {
+		new = pixmap_alloc(src->w, src->h, src->pixel_type,
+		                   src->bytes_per_row,
+		                   src->mmap_pixels ? GP_PIXMAP_HUGE_PAGES : 0);
+		if (!new)
+			return NULL;
+
+		new->pixels_refs = NULL;
 	}
 
-	new->pixels = pixels;
-
-	if (flags & GP_COPY_WITH_PIXELS)
-		memcpy(pixels, src->pixels, src->bytes_per_row * src->h);
+	if (!share && (flags & (GP_COPY_WITH_PIXELS | GP_COPY_SHARE_PIXELS)))
+		memcpy(new->pixels, src->pixels, src->bytes_per_row * src->h);
 
 	new->bpp           = src->bpp;
 	new->bytes_per_row = src->bytes_per_row;
@@ -210,57 +504,256 @@ gp_pixmap *gp_pixmap_copy(const gp_pixmap *src, int flags)
 	new->gamma = NULL;
 
 	new->free_pixels = 1;
+	new->sub_pixmaps = 0;
+	new->damage = NULL;
 
 	return new;
 }
 
 
-gp_pixmap *gp_pixmap_convert_alloc(const gp_pixmap *src,
-                                   gp_pixel_type dst_pixel_type)
+/*
+ * Conversion with ordered dithering, the source rows are converted to RGBA8888
+ * first and then quantized to the destination pixel type.
+ */
+#define CONVERT_MP_PIXELS (256 * 256)
+
+struct convert_dither {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	gp_convert_row_fn row_fn;
+	gp_dither_row_fn dither_fn;
+};
+
+static int pixmap_rotated(const gp_pixmap *pixmap)
 {
-	int w = gp_pixmap_w(src);
-	int h = gp_pixmap_h(src);
+	return pixmap->axes_swap || pixmap->x_swap || pixmap->y_swap;
+}
 
-	gp_pixmap *ret = gp_pixmap_alloc(w, h, dst_pixel_type);
+static void convert_src_row(struct convert_dither *conv, gp_coord x, gp_coord y,
+                            gp_size w, uint32_t *buf)
+{
+	const gp_pixmap *src = conv->src;
+	gp_size i;
+
+	if (pixmap_rotated(src)) {
+		for (i = 0; i < w; i++) {
+			gp_pixel p = gp_getpixel(src, x + i, y);
+
+			buf[i] = gp_pixel_to_RGBA8888(p, src->pixel_type);
+		}
+	} else if (conv->row_fn) {
+		conv->row_fn(buf, GP_PIXEL_ADDR(src, x, y), w);
+	} else if (src->pixel_type == GP_PIXEL_RGBA8888) {
+		memcpy(buf, GP_PIXEL_ADDR(src, x, y), w * sizeof(uint32_t));
+	} else {
+		for (i = 0; i < w; i++) {
+			gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+			buf[i] = gp_pixel_to_RGBA8888(p, src->pixel_type);
+		}
+	}
 
-	if (ret == NULL)
+	if (!gp_pixel_has_flags(src->pixel_type, GP_PIXEL_HAS_ALPHA))
+		return;
+
+	/* Composite onto black, same as blitting onto zeroed pixmap */
+	for (i = 0; i < w; i++) {
+		uint32_t p = buf[i];
+		unsigned int a = p & 0xff;
+
+		buf[i] = GP_PIXEL_CREATE_RGBA8888(
+			(GP_PIXEL_GET_R_RGBA8888(p) * a + 127) / 255,
+			(GP_PIXEL_GET_G_RGBA8888(p) * a + 127) / 255,
+			(GP_PIXEL_GET_B_RGBA8888(p) * a + 127) / 255, 0xff);
+	}
+}
+
+static int convert_dither_tile(const gp_tile *tile, void *priv,
+                               gp_progress_cb *callback)
+{
+	struct convert_dither *conv = priv;
+	gp_pixmap *dst = conv->dst;
+	gp_size y, i;
+
+	(void) callback;
+
+	gp_temp_alloc_create(tmp, tile->w * sizeof(uint32_t));
+
+	if (!tmp.buffer) {
+		GP_WARN("Malloc failed :(");
+		return 1;
+	}
+
+	uint32_t *buf = gp_temp_alloc_arr(tmp, uint32_t, tile->w);
+
+	for (y = 0; y < tile->h; y++) {
+		gp_coord yr = tile->y + y;
+
+		convert_src_row(conv, tile->x, yr, tile->w, buf);
+
+		if (!pixmap_rotated(dst)) {
+			conv->dither_fn(dst, tile->x, yr, buf, tile->w);
+			continue;
+		}
+
+		for (i = 0; i < tile->w; i++) {
+			gp_coord xt = tile->x + i, yt = yr;
+
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			conv->dither_fn(dst, xt, yt, buf + i, 1);
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+
+	return 0;
+}
+
+static int convert_dither(const gp_pixmap *src, gp_pixmap *dst,
+                          gp_dither_row_fn dither_fn)
+{
+	struct convert_dither conv = {
+		.src = src,
+		.dst = dst,
+		.row_fn = gp_convert_row_get(src->pixel_type, GP_PIXEL_RGBA8888),
+		.dither_fn = dither_fn,
+	};
+	gp_tiles tiles = {
+		.w = gp_pixmap_w(src),
+		.h = gp_pixmap_h(src),
+		.bpp = dst->bpp,
+		.name = "convert_dither",
+		.pixel_type = dst->pixel_type,
+		.fn = convert_dither_tile,
+		.priv = &conv,
+	};
+
+	GP_DEBUG(2, "Converting %s -> %s with dithering",
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	/* Pixels smaller than byte may share bytes, split only rows */
+	if (dst->bpp % 8) {
+		if (dst->axes_swap)
+			tiles.w = tiles.h = 0;
+		else
+			tiles.min_w = tiles.w;
+	}
+
+	if (!tiles.w || (size_t)tiles.w * tiles.h < CONVERT_MP_PIXELS) {
+		gp_tile tile = {.w = gp_pixmap_w(src), .h = gp_pixmap_h(src)};
+
+		return convert_dither_tile(&tile, &conv, NULL);
+	}
+
+	return gp_tiles_run(&tiles);
+}
+
+/*
+ * Dithering makes sense only if the source has more bits per channel.
+ */
+static gp_dither_row_fn dither_row_get(gp_pixel_type src, gp_pixel_type dst)
+{
+	const gp_pixel_type_desc *src_desc = gp_pixel_desc(src);
+	const gp_pixel_type_desc *dst_desc = gp_pixel_desc(dst);
+	unsigned int i, src_bits = 0, dst_bits = 8;
+
+	if (src_desc->flags & GP_PIXEL_IS_PALETTE)
+		return NULL;
+
+	for (i = 0; i < src_desc->numchannels; i++) {
+		if (src_desc->channels[i].name[0] != 'A')
+			src_bits = GP_MAX(src_bits, src_desc->channels[i].size);
+	}
+
+	for (i = 0; i < dst_desc->numchannels; i++)
+		dst_bits = GP_MIN(dst_bits, dst_desc->channels[i].size);
+
+	if (src_bits <= dst_bits)
 		return NULL;
 
+	return gp_dither_row_get(dst);
+}
+
+/*
+ * Returns non-zero on a failure, the destination is partially converted.
+ */
+static int convert(const gp_pixmap *src, gp_pixmap *dst, int flags)
+{
+	gp_dither_row_fn dither_fn = NULL;
+
+	if (flags & GP_CONVERT_DITHER)
+		dither_fn = dither_row_get(src->pixel_type, dst->pixel_type);
+
+	if (dither_fn)
+		return convert_dither(src, dst, dither_fn);
+
 	/*
 	 * Fill the buffer with zeroes, otherwise it will
 	 * contain random data which will generate mess
 	 * when converting image with alpha channel.
 	 */
-	memset(ret->pixels, 0, ret->bytes_per_row * ret->h);
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_HAS_ALPHA))
+		memset(dst->pixels, 0, dst->bytes_per_row * dst->h);
 
-	gp_blit(src, 0, 0, w, h, ret, 0, 0);
+	gp_blit(src, 0, 0, gp_pixmap_w(src), gp_pixmap_h(src), dst, 0, 0);
 
-	return ret;
+	return 0;
 }
 
-gp_pixmap *gp_pixmap_convert(const gp_pixmap *src, gp_pixmap *dst)
+gp_pixmap *gp_pixmap_convert_alloc_ex(const gp_pixmap *src,
+                                      gp_pixel_type dst_pixel_type, int flags)
 {
-	//TODO: Asserts
 	int w = gp_pixmap_w(src);
 	int h = gp_pixmap_h(src);
 
-	/*
-	 * Fill the buffer with zeroes, otherwise it will
-	 * contain random data which will generate mess
-	 * when converting image with alpha channel.
-	 */
-	memset(dst->pixels, 0, dst->bytes_per_row * dst->h);
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, dst_pixel_type);
+
+	if (ret == NULL)
+		return NULL;
+
+	if (convert(src, ret, flags)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+
+gp_pixmap *gp_pixmap_convert_alloc(const gp_pixmap *src,
+                                   gp_pixel_type dst_pixel_type)
+{
+	return gp_pixmap_convert_alloc_ex(src, dst_pixel_type, 0);
+}
 
-	gp_blit(src, 0, 0, w, h, dst, 0, 0);
+gp_pixmap *gp_pixmap_convert_ex(const gp_pixmap *src, gp_pixmap *dst,
+                                int flags)
+{
+	//TODO: Asserts
+	if (gp_pixmap_unshare(dst))
+		return NULL;
+
+	if (convert(src, dst, flags))
+		return NULL;
 
 	return dst;
 }
 
+gp_pixmap *gp_pixmap_convert(const gp_pixmap *src, gp_pixmap *dst)
+{
+	return gp_pixmap_convert_ex(src, dst, 0);
+}
+
 gp_pixmap *gp_sub_pixmap_alloc(const gp_pixmap *pixmap,
                                gp_coord x, gp_coord y, gp_size w, gp_size h)
 {
-	gp_pixmap *res = malloc(sizeof(gp_pixmap));
+	gp_pixmap *res;
+
+	/* Unshare here so that gp_sub_pixmap() does not abort on failure */
+	if (gp_pixmap_unshare((gp_pixmap *)pixmap))
+		return NULL;
 
+	res = malloc(sizeof(gp_pixmap));
 	if (res == NULL) {
 		GP_WARN("Malloc failed :(");
 		errno = ENOMEM;
@@ -275,6 +768,14 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 {
 	GP_CHECK(pixmap, "NULL pixmap");
 
+	/*
+	 * Writes into the subpixmap must not change other copies and since
+	 * the subpixmap does not know when the pixmap pixels are forked, the
+	 * pixmap must not be shared while the subpixmap exists.
+	 */
+	GP_PIXMAP_UNSHARE((gp_pixmap *)pixmap);
+	((gp_pixmap *)pixmap)->sub_pixmaps = 1;
+
 	GP_TRANSFORM_RECT(pixmap, x, y, w, h);
 
 	GP_CHECK(pixmap->w >= x + w, "Subpixmap w out of original pixmap.");
@@ -282,8 +783,6 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 
 	subpixmap->bpp           = pixmap->bpp;
 	subpixmap->bytes_per_row = pixmap->bytes_per_row;
-	subpixmap->offset        = (pixmap->offset +
-	                            gp_pixel_addr_offset(x, pixmap->pixel_type)) % 8;
 
 	subpixmap->w = w;
 	subpixmap->h = h;
@@ -297,9 +796,24 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 	/* rotation and mirroring */
 	gp_pixmap_copy_rotation(pixmap, subpixmap);
 
-	subpixmap->pixels = GP_PIXEL_ADDR(pixmap, x, y);
+	if (pixmap->bpp < 8) {
+		unsigned int bits = pixmap->offset + x * pixmap->bpp;
+
+		subpixmap->pixels = pixmap->pixels + y * pixmap->bytes_per_row
+		                    + bits / 8;
+		subpixmap->offset = bits % 8;
+	} else {
+		subpixmap->pixels = GP_PIXEL_ADDR(pixmap, x, y);
+		subpixmap->offset = 0;
+	}
 
 	subpixmap->free_pixels = 0;
+	subpixmap->mmap_pixels = 0;
+	subpixmap->file_pixels = 0;
+	subpixmap->sub_pixmaps = 0;
+	subpixmap->pixels_refs = NULL;
+	subpixmap->pool = NULL;
+	subpixmap->damage = pixmap->damage;
 
 	return subpixmap;
 }
@@ -314,8 +828,9 @@ void gp_pixmap_print_info(const gp_pixmap *self)
 	printf("Pixel\t%s (%u)\n", gp_pixel_type_name(self->pixel_type),
 	       self->pixel_type);
 	printf("Offset\t%u (only unaligned pixel types)\n", self->offset);
-	printf("Flags\taxes_swap=%u x_swap=%u y_swap=%u free_pixels=%u\n",
-	       self->axes_swap, self->x_swap, self->y_swap, self->free_pixels);
+	printf("Flags\taxes_swap=%u x_swap=%u y_swap=%u free_pixels=%u mmap_pixels=%u shared=%u\n",
+	       self->axes_swap, self->x_swap, self->y_swap, self->free_pixels,
+	       self->mmap_pixels, !!self->pixels_refs);
 
 	if (self->gamma)
 		gp_gamma_print(self->gamma);
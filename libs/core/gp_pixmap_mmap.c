@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_pixmap_mmap.h>
+
+#define GP_PIXMAP_MMAP_MAGIC "GPPIXMAP"
+#define GP_PIXMAP_MMAP_BYTE_ORDER 0x01020304
+#define GP_PIXMAP_MMAP_VERSION 1
+
+/*
+ * The header is stored in the host byte order, the byte_order field is used to
+ * detect files written on machines with different endianity.
+ */
+struct gp_pixmap_mmap_header {
+	char magic[8];
+	uint32_t byte_order;
+	uint32_t version;
+	uint32_t w;
+	uint32_t h;
+	uint32_t bytes_per_row;
+	uint32_t pixels_offset;
+	uint32_t bit_endian;
+	char pixel_type[20];
+};
+
+static int read_header(int fd, struct gp_pixmap_mmap_header *header)
+{
+	ssize_t ret = pread(fd, header, sizeof(*header), 0);
+
+	if (ret < 0)
+		return 1;
+
+	if (ret != sizeof(*header) ||
+	    memcmp(header->magic, GP_PIXMAP_MMAP_MAGIC, sizeof(header->magic))) {
+		GP_DEBUG(1, "Invalid pixmap header");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (header->byte_order != GP_PIXMAP_MMAP_BYTE_ORDER) {
+		GP_DEBUG(1, "Pixmap header byte order mismatch");
+		errno = ENOSYS;
+		return 1;
+	}
+
+	if (header->version != GP_PIXMAP_MMAP_VERSION) {
+		GP_DEBUG(1, "Unsupported pixmap header version %u",
+		         header->version);
+		errno = ENOSYS;
+		return 1;
+	}
+
+	header->pixel_type[sizeof(header->pixel_type) - 1] = 0;
+
+	return 0;
+}
+
+static int write_header(int fd, gp_size w, gp_size h, uint32_t bpr,
+                        gp_pixel_type type, uint32_t pixels_offset)
+{
+	struct gp_pixmap_mmap_header header = {
+		.magic = GP_PIXMAP_MMAP_MAGIC,
+		.byte_order = GP_PIXMAP_MMAP_BYTE_ORDER,
+		.version = GP_PIXMAP_MMAP_VERSION,
+		.w = w,
+		.h = h,
+		.bytes_per_row = bpr,
+		.pixels_offset = pixels_offset,
+		.bit_endian = gp_pixel_types[type].bit_endian,
+	};
+	ssize_t ret;
+
+	strncpy(header.pixel_type, gp_pixel_type_name(type),
+	        sizeof(header.pixel_type) - 1);
+
+	ret = pwrite(fd, &header, sizeof(header), 0);
+
+	if (ret < 0)
+		return 1;
+
+	if (ret != sizeof(header)) {
+		errno = EIO;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Returns the row size in bytes, or 0 if it does not fit into 32 bits.
+ */
+static uint32_t row_size(gp_pixel_type type, gp_size w)
+{
+	uint64_t bits = (uint64_t)gp_pixel_size(type) * w;
+
+	if ((bits + 7) / 8 > UINT32_MAX) {
+		GP_WARN("Pixmap too wide %u (overflow detected)", w);
+		errno = EOVERFLOW;
+		return 0;
+	}
+
+	return (bits + 7) / 8;
+}
+
+static int check_params(gp_size w, gp_size h, gp_pixel_type type)
+{
+	if (!w || !h || !GP_VALID_PIXELTYPE(type)) {
+		GP_WARN("Invalid pixmap %ux%u type %i", w, h, type);
+		errno = EINVAL;
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_pixmap_mmap(const char *path, gp_size w, gp_size h,
+                          gp_pixel_type type, int flags)
+{
+	struct gp_pixmap_mmap_header header;
+	gp_pixmap *pixmap;
+	uint32_t bpr;
+	off_t pixels_offset = 0;
+	size_t size;
+	int fd, oflags, prot, mflags, err;
+	void *pixels;
+	struct stat st;
+
+	if (flags & GP_PIXMAP_MMAP_CREATE) {
+		if (flags & GP_PIXMAP_MMAP_RDONLY) {
+			GP_WARN("Cannot create read only pixmap");
+			errno = EINVAL;
+			return NULL;
+		}
+
+		oflags = O_RDWR | O_CREAT | O_TRUNC;
+	} else {
+		oflags = (flags & GP_PIXMAP_MMAP_RDONLY) ? O_RDONLY : O_RDWR;
+	}
+
+	if ((flags & (GP_PIXMAP_MMAP_CREATE | GP_PIXMAP_MMAP_RAW)) &&
+	    check_params(w, h, type))
+		return NULL;
+
+	fd = open(path, oflags | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		err = errno;
+		GP_DEBUG(1, "Failed to open '%s': %s", path, strerror(errno));
+		errno = err;
+		return NULL;
+	}
+
+	if (!(flags & GP_PIXMAP_MMAP_RAW)) {
+		pixels_offset = getpagesize();
+
+		if (flags & GP_PIXMAP_MMAP_CREATE) {
+			bpr = row_size(type, w);
+			if (!bpr || write_header(fd, w, h, bpr, type, pixels_offset))
+				goto err0;
+		} else {
+			gp_pixel_type htype;
+			uint32_t min_bpr;
+
+			if (read_header(fd, &header))
+				goto err0;
+
+			htype = gp_pixel_type_by_name(header.pixel_type);
+
+			if (htype == GP_PIXEL_UNKNOWN) {
+				GP_DEBUG(1, "Unknown pixel type '%s'",
+				         header.pixel_type);
+				errno = EINVAL;
+				goto err0;
+			}
+
+			if ((w && w != header.w) || (h && h != header.h) ||
+			    (type != GP_PIXEL_UNKNOWN && type != htype)) {
+				GP_DEBUG(1, "Pixmap %ux%u %s does not match %ux%u %s",
+				         header.w, header.h, header.pixel_type,
+				         w, h, gp_pixel_type_name(type));
+				errno = EINVAL;
+				goto err0;
+			}
+
+			w = header.w;
+			h = header.h;
+			type = htype;
+			bpr = header.bytes_per_row;
+			pixels_offset = header.pixels_offset;
+
+			if (check_params(w, h, type))
+				goto err0;
+
+			min_bpr = row_size(type, w);
+			if (!min_bpr)
+				goto err0;
+
+			if (bpr < min_bpr ||
+			    header.bit_endian != gp_pixel_types[type].bit_endian ||
+			    pixels_offset % getpagesize()) {
+				GP_DEBUG(1, "Invalid pixmap header");
+				errno = EINVAL;
+				goto err0;
+			}
+		}
+	} else {
+		bpr = row_size(type, w);
+		if (!bpr)
+			goto err0;
+	}
+
+	if (h > (SIZE_MAX - pixels_offset) / bpr) {
+		GP_DEBUG(1, "Pixmap too big (overflow detected)");
+		errno = EOVERFLOW;
+		goto err0;
+	}
+
+	size = (size_t)bpr * h;
+
+	if (flags & GP_PIXMAP_MMAP_CREATE) {
+		/* Sparse file, the blocks are allocated on first write */
+		if (ftruncate(fd, pixels_offset + size))
+			goto err0;
+	} else {
+		if (fstat(fd, &st))
+			goto err0;
+
+		if ((size_t)st.st_size < pixels_offset + size) {
+			GP_DEBUG(1, "File '%s' too short, expected %zu bytes",
+			         path, (size_t)pixels_offset + size);
+			errno = EINVAL;
+			goto err0;
+		}
+	}
+
+	pixmap = malloc(sizeof(gp_pixmap));
+	if (!pixmap) {
+		GP_DEBUG(1, "Malloc failed :(");
+		errno = ENOMEM;
+		goto err0;
+	}
+
+	if (flags & GP_PIXMAP_MMAP_RDONLY) {
+		prot = PROT_READ;
+		mflags = MAP_PRIVATE;
+	} else {
+		prot = PROT_READ | PROT_WRITE;
+		mflags = MAP_SHARED;
+	}
+
+	pixels = mmap(NULL, size, prot, mflags, fd, pixels_offset);
+	if (pixels == MAP_FAILED) {
+		GP_DEBUG(1, "mmap() failed: %s", strerror(errno));
+		goto err1;
+	}
+
+	/* The mapping holds a reference to the file */
+	close(fd);
+
+	gp_pixmap_init(pixmap, w, h, type, pixels);
+
+	pixmap->bytes_per_row = bpr;
+	pixmap->bit_endian = gp_pixel_types[type].bit_endian;
+	pixmap->free_pixels = 1;
+	pixmap->mmap_pixels = 1;
+	pixmap->file_pixels = 1;
+
+	return pixmap;
+err1:
+	err = errno;
+	free(pixmap);
+	errno = err;
+err0:
+	err = errno;
+	close(fd);
+	errno = err;
+	return NULL;
+}
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap_pool.h>
+
+static __thread gp_pixmap_pool *default_pool;
+
+gp_pixmap_pool *gp_pixmap_pool_create(size_t max_size)
+{
+	gp_pixmap_pool *self = malloc(sizeof(*self));
+
+	if (!self) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	pthread_mutex_init(&self->lock, NULL);
+
+	self->cached = NULL;
+	self->cached_cnt = 0;
+	self->cached_max = 0;
+
+	self->size = 0;
+	self->max_size = max_size;
+
+	self->pixmaps = 0;
+	self->defaults = 0;
+	self->destroyed = 0;
+
+	self->hits = 0;
+	self->misses = 0;
+
+	GP_DEBUG(1, "Created pixmap pool (%p) max size %zu", self, max_size);
+
+	return self;
+}
+
+static size_t pixmap_size(const gp_pixmap *pixmap)
+{
+	return (size_t)pixmap->bytes_per_row * pixmap->h;
+}
+
+/*
+ * Frees cnt least recently used pixmaps, called with the pool lock held.
+ */
+static void evict(gp_pixmap_pool *self, unsigned int cnt)
+{
+	unsigned int i;
+
+	for (i = 0; i < cnt; i++) {
+		gp_pixmap *pixmap = self->cached[i];
+
+		self->size -= pixmap_size(pixmap);
+		pixmap->pool = NULL;
+		gp_pixmap_free(pixmap);
+	}
+
+	self->cached_cnt -= cnt;
+	memmove(self->cached, self->cached + cnt,
+	        self->cached_cnt * sizeof(*self->cached));
+}
+
+static void pool_free(gp_pixmap_pool *self)
+{
+	GP_DEBUG(1, "Freeing pixmap pool (%p) hits %lu misses %lu",
+	         self, self->hits, self->misses);
+
+	pthread_mutex_destroy(&self->lock);
+	free(self->cached);
+	free(self);
+}
+
+/*
+ * The pool is freed once it's destroyed and no longer referenced by pixmaps or
+ * threads, called with the pool lock held.
+ */
+static int pool_unused(gp_pixmap_pool *self)
+{
+	return self->destroyed && !self->pixmaps && !self->defaults;
+}
+
+void gp_pixmap_pool_destroy(gp_pixmap_pool *self)
+{
+	int free_pool;
+
+	if (!self)
+		return;
+
+	if (default_pool == self)
+		gp_pixmap_pool_set_default(NULL);
+
+	pthread_mutex_lock(&self->lock);
+	evict(self, self->cached_cnt);
+	self->destroyed = 1;
+	free_pool = pool_unused(self);
+	if (!free_pool) {
+		GP_DEBUG(1, "Pixmap pool (%p) in use by %u pixmaps %u threads",
+		         self, self->pixmaps, self->defaults);
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	if (free_pool)
+		pool_free(self);
+}
+
+void gp_pixmap_pool_flush(gp_pixmap_pool *self)
+{
+	pthread_mutex_lock(&self->lock);
+	evict(self, self->cached_cnt);
+	pthread_mutex_unlock(&self->lock);
+}
+
+gp_pixmap *gp_pixmap_pool_alloc(gp_pixmap_pool *self, gp_size w, gp_size h,
+                                gp_pixel_type type, int flags)
+{
+	gp_pixmap_pool *prev = gp_pixmap_pool_set_default(self);
+	gp_pixmap *ret = gp_pixmap_alloc_ex(w, h, type, flags);
+
+	gp_pixmap_pool_set_default(prev);
+
+	return ret;
+}
+
+gp_pixmap_pool *gp_pixmap_pool_set_default(gp_pixmap_pool *self)
+{
+	gp_pixmap_pool *prev = default_pool;
+	int free_pool = 0;
+
+	if (prev == self)
+		return prev;
+
+	if (self) {
+		pthread_mutex_lock(&self->lock);
+		self->defaults++;
+		pthread_mutex_unlock(&self->lock);
+	}
+
+	default_pool = self;
+
+	if (prev) {
+		pthread_mutex_lock(&prev->lock);
+		prev->defaults--;
+		free_pool = pool_unused(prev);
+		pthread_mutex_unlock(&prev->lock);
+	}
+
+	/* The pool was destroyed while it was set as a default */
+	if (free_pool) {
+		pool_free(prev);
+		return NULL;
+	}
+
+	return prev;
+}
+
+gp_pixmap_pool *gp_pixmap_pool_get_default(void)
+{
+	return default_pool;
+}
+
+static int pixels_match(const gp_pixmap *pixmap, int flags, size_t size)
+{
+	int huge_pages = (flags & GP_PIXMAP_HUGE_PAGES) &&
+	                 size >= GP_PIXMAP_HUGE_PAGES_MIN;
+
+	if (pixmap->mmap_pixels != huge_pages)
+		return 0;
+
+	if (!(flags & (GP_PIXMAP_ALIGN_ROWS | GP_PIXMAP_PAD_ROWS)))
+		return 1;
+
+	return !((uintptr_t)pixmap->pixels % GP_PIXMAP_ROW_ALIGNMENT);
+}
+
+gp_pixmap *gp_pixmap_pool_get(gp_pixmap_pool *self, gp_size w, gp_size h,
+                              gp_pixel_type type, uint32_t bytes_per_row,
+                              int flags)
+{
+	size_t size = (size_t)bytes_per_row * h;
+	unsigned int i;
+
+	pthread_mutex_lock(&self->lock);
+
+	/* Most recently freed first, these are likely still in CPU caches */
+	for (i = self->cached_cnt; i-- > 0;) {
+		gp_pixmap *pixmap = self->cached[i];
+
+		if (pixmap->w != w || pixmap->h != h ||
+		    pixmap->pixel_type != type ||
+		    pixmap->bytes_per_row != bytes_per_row ||
+		    !pixels_match(pixmap, flags, size))
+			continue;
+
+		self->cached_cnt--;
+		memmove(self->cached + i, self->cached + i + 1,
+		        (self->cached_cnt - i) * sizeof(*self->cached));
+
+		self->size -= size;
+		self->pixmaps++;
+		self->hits++;
+
+		pthread_mutex_unlock(&self->lock);
+
+		return pixmap;
+	}
+
+	self->misses++;
+
+	pthread_mutex_unlock(&self->lock);
+
+	return NULL;
+}
+
+void gp_pixmap_pool_attach(gp_pixmap_pool *self, gp_pixmap *pixmap)
+{
+	pthread_mutex_lock(&self->lock);
+	self->pixmaps++;
+	pthread_mutex_unlock(&self->lock);
+
+	pixmap->pool = self;
+}
+
+static int cache_pixmap(gp_pixmap_pool *self, gp_pixmap *pixmap)
+{
+	size_t size = pixmap_size(pixmap);
+	unsigned int cnt = 0;
+	size_t freed = 0;
+
+	if (self->destroyed)
+		return 1;
+
+	/* Shared pixels are released by the last user */
+	if (!pixmap->free_pixels || pixmap->pixels_refs)
+		return 1;
+
+	if (size > self->max_size)
+		return 1;
+
+	while (self->size - freed + size > self->max_size)
+		freed += pixmap_size(self->cached[cnt++]);
+
+	evict(self, cnt);
+
+	if (self->cached_cnt >= self->cached_max) {
+		unsigned int max = self->cached_max ? 2 * self->cached_max : 8;
+		gp_pixmap **cached = realloc(self->cached, max * sizeof(*cached));
+
+		if (!cached)
+			return 1;
+
+		self->cached = cached;
+		self->cached_max = max;
+	}
+
+	self->cached[self->cached_cnt++] = pixmap;
+	self->size += size;
+
+	return 0;
+}
+
+int gp_pixmap_pool_put(gp_pixmap *pixmap)
+{
+	gp_pixmap_pool *self = pixmap->pool;
+	int ret, free_pool;
+
+	pthread_mutex_lock(&self->lock);
+
+	self->pixmaps--;
+
+	ret = cache_pixmap(self, pixmap);
+	if (ret)
+		pixmap->pool = NULL;
+
+	free_pool = pool_unused(self);
+
+	pthread_mutex_unlock(&self->lock);
+
+	if (free_pool)
+		pool_free(self);
+
+	return ret;
+}
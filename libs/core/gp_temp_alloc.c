@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_temp_alloc.h>
+
+/* Buffers are cache line aligned */
+#define ARENA_ALIGN 64
+
+struct temp_arena {
+	uint8_t *buf;
+	size_t size;
+	size_t pos;
+	/* Peak size requested, the arena grows to it once it's not used */
+	size_t need;
+	unsigned int users;
+};
+
+static __thread struct temp_arena arena;
+
+static pthread_key_t arena_key;
+static pthread_once_t arena_once = PTHREAD_ONCE_INIT;
+
+static void arena_unmap(struct temp_arena *self)
+{
+	if (!self->buf)
+		return;
+
+	GP_DEBUG(2, "Releasing temp arena size %zu", self->size);
+
+	munmap(self->buf, self->size);
+
+	self->buf = NULL;
+	self->size = 0;
+	self->pos = 0;
+}
+
+static void arena_destroy(void *self)
+{
+	arena_unmap(self);
+}
+
+static void arena_key_create(void)
+{
+	if (pthread_key_create(&arena_key, arena_destroy))
+		GP_WARN("Failed to create temp arena key");
+}
+
+static void arena_grow(struct temp_arena *self)
+{
+	size_t page_size = getpagesize();
+	size_t size = (self->need + page_size - 1) & ~(page_size - 1);
+	void *buf;
+
+	arena_unmap(self);
+
+	buf = mmap(NULL, size, PROT_READ | PROT_WRITE,
+	           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (buf == MAP_FAILED) {
+		GP_DEBUG(1, "mmap() failed: %s", strerror(errno));
+		return;
+	}
+
+	GP_DEBUG(2, "Growing temp arena to %zu", size);
+
+	pthread_once(&arena_once, arena_key_create);
+	pthread_setspecific(arena_key, self);
+
+	self->buf = buf;
+	self->size = size;
+}
+
+void *gp_temp_arena_get(size_t size)
+{
+	void *ret;
+
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+	if (arena.pos + size > arena.need)
+		arena.need = arena.pos + size;
+
+	/* The arena can be resized only when nobody is using it */
+	if (!arena.users && arena.need > arena.size)
+		arena_grow(&arena);
+
+	if (arena.pos + size > arena.size)
+		return malloc(size);
+
+	ret = arena.buf + arena.pos;
+
+	arena.pos += size;
+	arena.users++;
+
+	return ret;
+}
+
+void gp_temp_arena_put(void *ptr, size_t size)
+{
+	uint8_t *p = ptr;
+
+	if (p < arena.buf || p >= arena.buf + arena.size) {
+		free(ptr);
+		return;
+	}
+
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+	if (p + size == arena.buf + arena.pos)
+		arena.pos = p - arena.buf;
+
+	if (!--arena.users)
+		arena.pos = 0;
+}
+
+void gp_temp_arena_release(void)
+{
+	if (arena.users) {
+		GP_WARN("Temp arena is in use");
+		return;
+	}
+
+	arena_unmap(&arena);
+	/* Start over, otherwise the peak size would be mapped again */
+	arena.need = 0;
+}
+
+size_t gp_temp_arena_size(void)
+{
+	return arena.size;
+}
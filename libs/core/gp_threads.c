@@ -5,6 +5,10 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
 
 #include "gp_common.h"
 #include <core/gp_debug.h>
@@ -13,9 +17,32 @@
 
 static unsigned int nr_threads = 0;
 
-unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
+/*
+ * Upper limit for the number of pool threads.
+ */
+#define GP_THREAD_POOL_MAX 256
+
+static struct gp_thread_pool {
+	pthread_mutex_t lock;
+	/* signalled when new jobs are queued */
+	pthread_cond_t work;
+	/* signalled when a batch has been finished */
+	pthread_cond_t done;
+	/* FIFO of queued jobs */
+	gp_thread_job *head;
+	gp_thread_job *tail;
+	unsigned int nr_workers;
+	/* workers above the limit exit once they wake up */
+	unsigned int max_workers;
+} pool = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.work = PTHREAD_COND_INITIALIZER,
+	.done = PTHREAD_COND_INITIALIZER,
+};
+
+static int threads_max(gp_progress_cb *callback)
 {
-	int count, threads;
+	int count;
 	char *env;
 
 	/* Try to override nr_threads from the callback first */
@@ -42,11 +69,20 @@ unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
 		GP_DEBUG(1, "Using nr_threads=%i", count);
 	}
 
-	threads = GP_MIN(count, (int)(w * h / 1024) + 1);
-
 	/* Call to the sysconf may return -1 if unsupported */
-	if (threads < -1)
-		threads = 1;
+	if (count < 1)
+		count = 1;
+
+	return count;
+}
+
+unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	int count, threads;
+
+	count = threads_max(callback);
+
+	threads = GP_MIN(count, (int)(w * h / 1024) + 1);
 
 	GP_DEBUG(1, "Max threads %i image size %ux%u runnig %u threads",
 	         count, w, h, threads);
@@ -54,40 +90,829 @@ unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
 	return threads;
 }
 
+/*
+ * Sets the maximal number of pool workers, the superfluous workers exit once
+ * they are done with their current job.
+ *
+ * Has to be called with the pool lock held.
+ */
+static void pool_limit(unsigned int max_workers)
+{
+	pool.max_workers = GP_MIN(max_workers, (unsigned int)GP_THREAD_POOL_MAX);
+
+	if (pool.nr_workers > pool.max_workers)
+		pthread_cond_broadcast(&pool.work);
+}
+
 void gp_nr_threads_set(unsigned int nr)
 {
+	unsigned int max_workers;
+
 	nr_threads = nr;
 
 	GP_DEBUG(1, "Setting default number of threads to %u", nr);
+
+	max_workers = threads_max(NULL) - 1;
+
+	pthread_mutex_lock(&pool.lock);
+	pool_limit(max_workers);
+	pthread_mutex_unlock(&pool.lock);
 }
 
-int gp_progress_cb_mp(gp_progress_cb *self)
+static uint64_t time_ms(void)
 {
-	struct gp_progress_cb_mp_priv *priv = self->priv;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
-	/*
-	 * If any thread got non-zero return value from a callback abort all.
-	 */
-	if (priv->abort)
+static float progress_mp_percentage(struct gp_progress_cb_mp_priv *priv)
+{
+	unsigned int i;
+	uint64_t sum = 0;
+
+	if (!priv->counters) {
+		return __atomic_load_n(&priv->percentage,
+		                       __ATOMIC_RELAXED) / 100.00;
+	}
+
+	for (i = 0; i < priv->nr_counters; i++)
+		sum += __atomic_load_n(&priv->counters[i].val, __ATOMIC_RELAXED);
+
+	return 100.00 * sum / priv->max;
+}
+
+/*
+ * Calls the original callback unless other thread is doing so or the last
+ * call was less than GP_PROGRESS_MP_INTERVAL ago.
+ */
+static int progress_mp_aggregate(struct gp_progress_cb_mp_priv *priv)
+{
+	uint64_t now;
+	int ret;
+
+	if (__atomic_load_n(&priv->abort, __ATOMIC_RELAXED))
 		return 1;
 
-	if (pthread_mutex_trylock(&priv->mutex)) {
-		GP_DEBUG(1, "Mutex locked, skipping calllback.");
+	now = time_ms();
+
+	if (now < __atomic_load_n(&priv->next_report, __ATOMIC_RELAXED))
+		return 0;
+
+	if (__atomic_exchange_n(&priv->busy, 1, __ATOMIC_ACQUIRE))
 		return 0;
-	}
 
-	/* Compute max value for the percentage */
-	priv->orig_callback->percentage = GP_MAX(self->percentage, priv->max);
-	priv->max = priv->orig_callback->percentage;
+	__atomic_store_n(&priv->next_report, now + GP_PROGRESS_MP_INTERVAL,
+	                 __ATOMIC_RELAXED);
 
-	/* Call the original callback */
-	int ret = priv->orig_callback->callback(priv->orig_callback);
+	priv->orig_callback->percentage = progress_mp_percentage(priv);
+
+	ret = priv->orig_callback->callback(priv->orig_callback);
 
 	/* Turn on abort flag if callback returned nonzero */
 	if (ret)
-		priv->abort = 1;
+		__atomic_store_n(&priv->abort, 1, __ATOMIC_RELAXED);
 
-	pthread_mutex_unlock(&priv->mutex);
+	__atomic_store_n(&priv->busy, 0, __ATOMIC_RELEASE);
 
 	return ret;
 }
+
+int gp_progress_cb_mp(gp_progress_cb *self)
+{
+	struct gp_progress_cb_mp_priv *priv = self->priv;
+	unsigned int cur, val = self->percentage * 100;
+
+	/* Keep the maximal value for the percentage */
+	cur = __atomic_load_n(&priv->percentage, __ATOMIC_RELAXED);
+
+	while (cur < val) {
+		if (__atomic_compare_exchange_n(&priv->percentage, &cur, val, 1,
+		                                __ATOMIC_RELAXED,
+		                                __ATOMIC_RELAXED))
+			break;
+	}
+
+	return progress_mp_aggregate(priv);
+}
+
+int gp_progress_cb_mp_report(struct gp_progress_cb_mp_priv *priv,
+                             unsigned int worker, unsigned int val)
+{
+	__atomic_store_n(&priv->counters[worker].val, val, __ATOMIC_RELAXED);
+
+	return progress_mp_aggregate(priv);
+}
+
+/* Has to be called with the pool lock held */
+static gp_thread_job *pool_pop(void)
+{
+	gp_thread_job *job = pool.head;
+
+	if (!job)
+		return NULL;
+
+	pool.head = job->next;
+
+	if (!pool.head)
+		pool.tail = NULL;
+
+	return job;
+}
+
+/* Has to be called with the pool lock held, the lock is dropped for fn() */
+static void pool_exec(gp_thread_job *job)
+{
+	gp_thread_batch *batch = job->batch;
+	int ret, err = 0;
+
+	pthread_mutex_unlock(&pool.lock);
+
+	errno = 0;
+	ret = job->fn(job->arg);
+	if (ret)
+		err = errno ? errno : EINVAL;
+
+	pthread_mutex_lock(&pool.lock);
+
+	if (err)
+		batch->err = err;
+
+	if (--batch->pending == 0)
+		pthread_cond_broadcast(&pool.done);
+}
+
+static void *pool_worker(void *arg __attribute__((unused)))
+{
+	gp_thread_job *job;
+
+	pthread_mutex_lock(&pool.lock);
+
+	for (;;) {
+		if (pool.nr_workers > pool.max_workers)
+			break;
+
+		if ((job = pool_pop()))
+			pool_exec(job);
+		else
+			pthread_cond_wait(&pool.work, &pool.lock);
+	}
+
+	pool.nr_workers--;
+
+	GP_DEBUG(1, "Thread pool worker exiting, running %u workers",
+	         pool.nr_workers);
+
+	pthread_mutex_unlock(&pool.lock);
+
+	return NULL;
+}
+
+/* Has to be called with the pool lock held */
+static void pool_grow(unsigned int nr_workers)
+{
+	pthread_attr_t attr;
+	pthread_t thread;
+
+	nr_workers = GP_MIN(nr_workers, pool.max_workers);
+
+	if (pool.nr_workers >= nr_workers)
+		return;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	while (pool.nr_workers < nr_workers) {
+		if (pthread_create(&thread, &attr, pool_worker, NULL)) {
+			GP_WARN("Failed to start pool thread, running %u",
+			        pool.nr_workers);
+			break;
+		}
+
+		pool.nr_workers++;
+	}
+
+	GP_DEBUG(1, "Thread pool running %u workers", pool.nr_workers);
+
+	pthread_attr_destroy(&attr);
+}
+
+void gp_thread_pool_submit(gp_thread_batch *batch,
+                           gp_thread_job *jobs, unsigned int nr)
+{
+	unsigned int i, max_workers;
+
+	if (!nr)
+		return;
+
+	/* The calling thread processes jobs as well */
+	max_workers = threads_max(NULL) - 1;
+
+	pthread_mutex_lock(&pool.lock);
+
+	pool_limit(max_workers);
+	pool_grow(nr - 1);
+
+	for (i = 0; i < nr; i++) {
+		jobs[i].batch = batch;
+		jobs[i].next = NULL;
+
+		if (pool.tail)
+			pool.tail->next = &jobs[i];
+		else
+			pool.head = &jobs[i];
+
+		pool.tail = &jobs[i];
+	}
+
+	batch->pending += nr;
+
+	pthread_cond_broadcast(&pool.work);
+	pthread_mutex_unlock(&pool.lock);
+}
+
+int gp_thread_pool_wait(gp_thread_batch *batch)
+{
+	gp_thread_job *job;
+	int err;
+
+	pthread_mutex_lock(&pool.lock);
+
+	while (batch->pending) {
+		if ((job = pool_pop()))
+			pool_exec(job);
+		else
+			pthread_cond_wait(&pool.done, &pool.lock);
+	}
+
+	err = batch->err;
+	batch->err = 0;
+
+	pthread_mutex_unlock(&pool.lock);
+
+	if (err) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
+
+int gp_thread_pool_run(gp_thread_job *jobs, unsigned int nr)
+{
+	gp_thread_batch batch = GP_THREAD_BATCH_INIT;
+
+	gp_thread_pool_submit(&batch, jobs, nr);
+
+	return gp_thread_pool_wait(&batch);
+}
+
+static uint64_t time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*
+ * Autotuner table, the table is static so that we do not allocate any memory.
+ */
+#define GP_AUTOTUNE_MAX 256
+#define GP_AUTOTUNE_NAME 32
+
+/* Minimal amount of work per thread and per tile in nanoseconds */
+#define GP_AUTOTUNE_THREAD_NS 100000
+#define GP_AUTOTUNE_TILE_NS 50000
+
+static struct autotune_entry {
+	char name[GP_AUTOTUNE_NAME];
+	gp_pixel_type pixel_type;
+	/* Time per pixel in nanoseconds when running in a single thread */
+	float cost;
+	unsigned int samples;
+} autotune_table[GP_AUTOTUNE_MAX];
+
+static unsigned int autotune_entries;
+static int autotune = -1;
+static pthread_mutex_t autotune_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void gp_autotune_set(int enable)
+{
+	autotune = !!enable;
+
+	GP_DEBUG(1, "Setting thread autotuning to %i", autotune);
+}
+
+static int autotune_enabled(void)
+{
+	char *env;
+
+	if (autotune >= 0)
+		return autotune;
+
+	env = getenv("GP_AUTOTUNE");
+
+	autotune = env ? !!atoi(env) : 0;
+
+	GP_DEBUG(1, "Thread autotuning %s", autotune ? "enabled" : "disabled");
+
+	return autotune;
+}
+
+/* Has to be called with the autotune lock held */
+static struct autotune_entry *autotune_lookup(const char *name,
+                                              gp_pixel_type pixel_type,
+                                              int create)
+{
+	struct autotune_entry *entry;
+	unsigned int i;
+
+	for (i = 0; i < autotune_entries; i++) {
+		entry = &autotune_table[i];
+
+		if (entry->pixel_type == pixel_type &&
+		    !strncmp(entry->name, name, GP_AUTOTUNE_NAME - 1))
+			return entry;
+	}
+
+	if (!create)
+		return NULL;
+
+	if (autotune_entries >= GP_AUTOTUNE_MAX) {
+		GP_DEBUG(1, "Autotune table full, ignoring '%s'", name);
+		return NULL;
+	}
+
+	entry = &autotune_table[autotune_entries++];
+
+	strncpy(entry->name, name, GP_AUTOTUNE_NAME - 1);
+	entry->pixel_type = pixel_type;
+	entry->cost = 0;
+	entry->samples = 0;
+
+	return entry;
+}
+
+static float autotune_cost(const char *name, gp_pixel_type pixel_type)
+{
+	struct autotune_entry *entry;
+	float cost = 0;
+
+	pthread_mutex_lock(&autotune_lock);
+
+	entry = autotune_lookup(name, pixel_type, 0);
+	if (entry)
+		cost = entry->cost;
+
+	pthread_mutex_unlock(&autotune_lock);
+
+	return cost;
+}
+
+static void autotune_update(const char *name, gp_pixel_type pixel_type,
+                            uint64_t ns, uint64_t pixels)
+{
+	struct autotune_entry *entry;
+	float cost;
+
+	if (!pixels)
+		return;
+
+	cost = (float)ns / pixels;
+
+	pthread_mutex_lock(&autotune_lock);
+
+	entry = autotune_lookup(name, pixel_type, 1);
+
+	if (entry) {
+		/* Exponential moving average to smooth out the noise */
+		if (entry->samples)
+			entry->cost = (3 * entry->cost + cost) / 4;
+		else
+			entry->cost = cost;
+
+		entry->samples++;
+
+		GP_DEBUG(2, "Autotune '%s' %s cost %.3fns/pixel (%u samples)",
+		         name, gp_pixel_type_name(pixel_type),
+		         entry->cost, entry->samples);
+	}
+
+	pthread_mutex_unlock(&autotune_lock);
+}
+
+int gp_autotune_save(const char *path)
+{
+	unsigned int i;
+	FILE *f;
+	int err;
+
+	f = fopen(path, "w");
+	if (!f)
+		return -1;
+
+	fprintf(f, "# name pixel_type cost_ns_per_pixel samples\n");
+
+	pthread_mutex_lock(&autotune_lock);
+
+	for (i = 0; i < autotune_entries; i++) {
+		struct autotune_entry *entry = &autotune_table[i];
+
+		fprintf(f, "%s %s %f %u\n", entry->name,
+		        gp_pixel_type_name(entry->pixel_type),
+		        entry->cost, entry->samples);
+	}
+
+	pthread_mutex_unlock(&autotune_lock);
+
+	if (fclose(f)) {
+		err = errno;
+		unlink(path);
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
+
+int gp_autotune_load(const char *path)
+{
+	char line[128], name[GP_AUTOTUNE_NAME], pixel_type[32];
+	struct autotune_entry *entry;
+	gp_pixel_type type;
+	unsigned int samples;
+	float cost;
+	FILE *f;
+
+	f = fopen(path, "r");
+	if (!f)
+		return -1;
+
+	pthread_mutex_lock(&autotune_lock);
+
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#')
+			continue;
+
+		if (sscanf(line, "%31s %31s %f %u",
+		           name, pixel_type, &cost, &samples) != 4) {
+			GP_WARN("Invalid autotune line '%s'", line);
+			continue;
+		}
+
+		type = gp_pixel_type_by_name(pixel_type);
+
+		if (type == GP_PIXEL_UNKNOWN || cost <= 0) {
+			GP_WARN("Invalid autotune entry '%s'", line);
+			continue;
+		}
+
+		entry = autotune_lookup(name, type, 1);
+		if (!entry)
+			break;
+
+		entry->cost = cost;
+		entry->samples = samples;
+	}
+
+	pthread_mutex_unlock(&autotune_lock);
+
+	fclose(f);
+
+	return 0;
+}
+
+/*
+ * Picks number of threads so that each thread does at least
+ * GP_AUTOTUNE_THREAD_NS worth of work. Unknown operations run with the
+ * default number of threads until first measurement is done.
+ */
+static unsigned int autotune_threads(const gp_tiles *tiles, float cost)
+{
+	uint64_t work;
+	unsigned int t, max = threads_max(tiles->callback);
+
+	if (!cost)
+		return gp_nr_threads(tiles->w, tiles->h, tiles->callback);
+
+	work = cost * tiles->w * tiles->h;
+	t = GP_MIN(work / GP_AUTOTUNE_THREAD_NS, (uint64_t)max);
+	t = GP_MAX(t, 1u);
+
+	GP_DEBUG(1, "Autotune '%s' %s %ux%u cost %.3fns/pixel running %u threads",
+	         tiles->name, gp_pixel_type_name(tiles->pixel_type),
+	         tiles->w, tiles->h, cost, t);
+
+	return t;
+}
+
+/*
+ * Tiles are sized so that the source and destination fit into L2 cache with
+ * rows short enough to keep the hardware prefetcher happy.
+ */
+#define GP_TILE_BYTES (64 * 1024)
+#define GP_TILE_ROW_BYTES (16 * 1024)
+
+/* Aim for at least this many tiles per thread for a good load balance */
+#define GP_TILES_PER_THREAD 4
+
+struct tiles_sched {
+	const gp_tiles *tiles;
+	gp_size tile_w;
+	gp_size tile_h;
+	unsigned int tiles_x;
+	unsigned int nr_tiles;
+	unsigned int nr_threads;
+	/* Per thread ranges of tiles, begin in upper 32 bits, end in lower */
+	uint64_t *ranges;
+	int abort;
+	int tune;
+	struct gp_progress_cb_mp_priv *progress;
+};
+
+struct tiles_worker {
+	struct tiles_sched *sched;
+	unsigned int idx;
+	/* Time spent in tiles and pixels processed, used for autotuning */
+	uint64_t ns;
+	uint64_t pixels;
+};
+
+#define RANGE(b, e) (((uint64_t)(b) << 32) | (e))
+#define RANGE_B(r) ((unsigned int)((r) >> 32))
+#define RANGE_E(r) ((unsigned int)((r) & 0xffffffff))
+
+static void tiles_size(const gp_tiles *tiles, unsigned int threads,
+                       size_t max_pixels, gp_size *tile_w, gp_size *tile_h)
+{
+	unsigned int bpp = GP_MAX(tiles->bpp, (uint8_t)1);
+	gp_size tw, th, row_bytes;
+
+	tw = tiles->w;
+
+	if (((size_t)tw * bpp + 7) / 8 > GP_TILE_ROW_BYTES)
+		tw = GP_TILE_ROW_BYTES * 8 / bpp;
+
+	tw = GP_MAX(tw, tiles->min_w);
+	tw = GP_MIN(tw, tiles->w);
+
+	row_bytes = GP_MAX(((size_t)tw * bpp + 7) / 8, (size_t)1);
+	th = GP_MAX(GP_TILE_BYTES / row_bytes, (gp_size)1);
+	th = GP_MAX(th, tiles->min_h);
+	th = GP_MIN(th, tiles->h);
+
+	/* Limit the time spent in a single tile for expensive operations */
+	if (max_pixels && (size_t)tw * th > max_pixels) {
+		th = GP_MAX(max_pixels / tw, (size_t)GP_MAX(tiles->min_h, 1u));
+		th = GP_MIN(th, tiles->h);
+
+		if ((size_t)tw * th > max_pixels)
+			tw = GP_MAX(max_pixels / th, (size_t)GP_MAX(tiles->min_w, 1u));
+
+		tw = GP_MIN(tw, tiles->w);
+	}
+
+	/* Shrink tiles for small images so that all threads have work */
+	for (;;) {
+		size_t nr = (size_t)((tiles->w + tw - 1) / tw) *
+		            ((tiles->h + th - 1) / th);
+
+		if (nr >= GP_TILES_PER_THREAD * threads)
+			break;
+
+		if (th > 1 && th / 2 >= tiles->min_h)
+			th = (th + 1) / 2;
+		else if (tw > 1 && tw / 2 >= tiles->min_w)
+			tw = (tw + 1) / 2;
+		else
+			break;
+	}
+
+	*tile_w = tw;
+	*tile_h = th;
+}
+
+static int tile_pop(uint64_t *range, unsigned int *tile)
+{
+	uint64_t r = __atomic_load_n(range, __ATOMIC_ACQUIRE);
+
+	for (;;) {
+		unsigned int b = RANGE_B(r), e = RANGE_E(r);
+
+		if (b >= e)
+			return 0;
+
+		if (__atomic_compare_exchange_n(range, &r, RANGE(b + 1, e), 0,
+		                                __ATOMIC_ACQ_REL,
+		                                __ATOMIC_ACQUIRE)) {
+			*tile = b;
+			return 1;
+		}
+	}
+}
+
+/*
+ * Steals upper half of the tiles from the thread with most tiles left, the
+ * first stolen tile is returned and the rest is stored into our range.
+ */
+static int tile_steal(struct tiles_sched *sched, unsigned int idx,
+                      unsigned int *tile)
+{
+	unsigned int i, victim, max_left;
+	uint64_t r;
+
+	for (;;) {
+		max_left = 0;
+		victim = 0;
+
+		for (i = 0; i < sched->nr_threads; i++) {
+			if (i == idx)
+				continue;
+
+			r = __atomic_load_n(&sched->ranges[i], __ATOMIC_ACQUIRE);
+
+			if (RANGE_E(r) > RANGE_B(r) &&
+			    RANGE_E(r) - RANGE_B(r) > max_left) {
+				max_left = RANGE_E(r) - RANGE_B(r);
+				victim = i;
+			}
+		}
+
+		if (!max_left)
+			return 0;
+
+		r = __atomic_load_n(&sched->ranges[victim], __ATOMIC_ACQUIRE);
+
+		unsigned int b = RANGE_B(r), e = RANGE_E(r);
+
+		if (b >= e)
+			continue;
+
+		unsigned int n = (e - b + 1) / 2;
+
+		if (__atomic_compare_exchange_n(&sched->ranges[victim], &r,
+		                                RANGE(b, e - n), 0,
+		                                __ATOMIC_ACQ_REL,
+		                                __ATOMIC_ACQUIRE)) {
+			__atomic_store_n(&sched->ranges[idx],
+			                 RANGE(e - n + 1, e), __ATOMIC_RELEASE);
+			*tile = e - n;
+			return 1;
+		}
+	}
+}
+
+static int tiles_worker(void *arg)
+{
+	struct tiles_worker *worker = arg;
+	struct tiles_sched *sched = worker->sched;
+	const gp_tiles *tiles = sched->tiles;
+	unsigned int t, done = 0;
+	gp_tile tile;
+
+	while (tile_pop(&sched->ranges[worker->idx], &t) ||
+	       tile_steal(sched, worker->idx, &t)) {
+
+		if (__atomic_load_n(&sched->abort, __ATOMIC_RELAXED))
+			break;
+
+		tile.x = (t % sched->tiles_x) * sched->tile_w;
+		tile.y = (t / sched->tiles_x) * sched->tile_h;
+		tile.w = GP_MIN(sched->tile_w, tiles->w - tile.x);
+		tile.h = GP_MIN(sched->tile_h, tiles->h - tile.y);
+
+		uint64_t start = sched->tune ? time_ns() : 0;
+
+		if (tiles->fn(&tile, tiles->priv, NULL)) {
+			__atomic_store_n(&sched->abort, 1, __ATOMIC_RELAXED);
+			return 1;
+		}
+
+		if (sched->tune) {
+			worker->ns += time_ns() - start;
+			worker->pixels += (uint64_t)tile.w * tile.h;
+		}
+
+		done++;
+
+		if (sched->progress &&
+		    gp_progress_cb_mp_report(sched->progress, worker->idx, done)) {
+			__atomic_store_n(&sched->abort, 1, __ATOMIC_RELAXED);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int gp_tiles_run(const gp_tiles *tiles)
+{
+	unsigned int i, t, tiles_y;
+	gp_size tile_w, tile_h;
+	size_t max_pixels = 0;
+	uint64_t ns = 0, pixels = 0;
+	float cost = 0;
+	int tune;
+
+	if (!tiles->w || !tiles->h)
+		return 0;
+
+	/* Explicitly set number of threads takes precedence */
+	tune = tiles->name && autotune_enabled() &&
+	       !(tiles->callback && tiles->callback->threads);
+
+	if (tune) {
+		cost = autotune_cost(tiles->name, tiles->pixel_type);
+		t = autotune_threads(tiles, cost);
+	} else {
+		t = gp_nr_threads(tiles->w, tiles->h, tiles->callback);
+	}
+
+	if (t <= 1) {
+		gp_tile tile = {.x = 0, .y = 0, .w = tiles->w, .h = tiles->h};
+		uint64_t start = tune ? time_ns() : 0;
+		int ret;
+
+		ret = tiles->fn(&tile, tiles->priv, tiles->callback);
+		if (ret)
+			return ret;
+
+		if (tune) {
+			autotune_update(tiles->name, tiles->pixel_type,
+			                time_ns() - start,
+			                (uint64_t)tiles->w * tiles->h);
+		}
+
+		return 0;
+	}
+
+	if (cost)
+		max_pixels = GP_MAX(GP_AUTOTUNE_TILE_NS / cost, 1.0f);
+
+	tiles_size(tiles, t, max_pixels, &tile_w, &tile_h);
+
+	struct tiles_sched sched = {
+		.tiles = tiles,
+		.tile_w = tile_w,
+		.tile_h = tile_h,
+		.tiles_x = (tiles->w + tile_w - 1) / tile_w,
+		.tune = tune,
+	};
+
+	tiles_y = (tiles->h + tile_h - 1) / tile_h;
+	sched.nr_tiles = sched.tiles_x * tiles_y;
+	sched.nr_threads = t = GP_MIN(t, sched.nr_tiles);
+
+	GP_DEBUG(1, "Running %ux%u region in %u threads, %u tiles %ux%u",
+	         tiles->w, tiles->h, t, sched.nr_tiles, tile_w, tile_h);
+
+	gp_progress_cb_mp_counter counters[t];
+	struct gp_progress_cb_mp_priv progress = {
+		.orig_callback = tiles->callback,
+		.counters = counters,
+		.nr_counters = t,
+		.max = sched.nr_tiles,
+	};
+
+	if (tiles->callback)
+		sched.progress = &progress;
+
+	uint64_t ranges[t];
+	struct tiles_worker workers[t];
+	gp_thread_job jobs[t];
+
+	for (i = 0; i < t; i++) {
+		ranges[i] = RANGE((uint64_t)sched.nr_tiles * i / t,
+		                  (uint64_t)sched.nr_tiles * (i + 1) / t);
+		counters[i].val = 0;
+		workers[i].sched = &sched;
+		workers[i].idx = i;
+		workers[i].ns = 0;
+		workers[i].pixels = 0;
+		jobs[i].fn = tiles_worker;
+		jobs[i].arg = &workers[i];
+	}
+
+	sched.ranges = ranges;
+
+	if (gp_thread_pool_run(jobs, t))
+		return -1;
+
+	if (tune) {
+		for (i = 0; i < t; i++) {
+			ns += workers[i].ns;
+			pixels += workers[i].pixels;
+		}
+
+		autotune_update(tiles->name, tiles->pixel_type, ns, pixels);
+	}
+
+	gp_progress_cb_done(tiles->callback);
+
+	return 0;
+}
@@ -0,0 +1,395 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_tiled_pixmap.h>
+
+gp_tiled_pixmap *gp_tiled_pixmap_alloc(gp_size w, gp_size h,
+                                       gp_pixel_type type,
+                                       uint32_t cache_tiles)
+{
+	gp_tiled_pixmap *self;
+	uint32_t tiles_w, tiles_h, i;
+
+	if (!GP_VALID_PIXELTYPE(type)) {
+		GP_WARN("Invalid pixel type %u", type);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (w == 0 || h == 0) {
+		GP_WARN("Trying to allocate tiled pixmap with zero width and/or height");
+		errno = EINVAL;
+		return NULL;
+	}
+
+	tiles_w = (w + GP_TILE_SIZE - 1) / GP_TILE_SIZE;
+	tiles_h = (h + GP_TILE_SIZE - 1) / GP_TILE_SIZE;
+
+	self = malloc(sizeof(gp_tiled_pixmap) +
+	              (size_t)tiles_w * tiles_h * sizeof(struct gp_pixmap_tile));
+	if (!self) {
+		GP_DEBUG(1, "Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->w = w;
+	self->h = h;
+	self->pixel_type = type;
+	self->bpp = gp_pixel_size(type);
+	self->bit_endian = 0;
+	self->tiles_w = tiles_w;
+	self->tiles_h = tiles_h;
+	self->tile_bytes_per_row = GP_CALC_ROW_SIZE(type, GP_TILE_SIZE);
+	self->tile_size = (size_t)self->tile_bytes_per_row * GP_TILE_SIZE;
+	self->cache_tiles = cache_tiles;
+	self->loaded_tiles = 0;
+	self->lru_head = GP_TILE_NONE;
+	self->lru_tail = GP_TILE_NONE;
+	self->swap_fd = -1;
+
+	for (i = 0; i < tiles_w * tiles_h; i++) {
+		self->tiles[i].pixels = NULL;
+		self->tiles[i].prev = GP_TILE_NONE;
+		self->tiles[i].next = GP_TILE_NONE;
+		self->tiles[i].dirty = 0;
+		self->tiles[i].swapped = 0;
+	}
+
+	return self;
+}
+
+void gp_tiled_pixmap_free(gp_tiled_pixmap *self)
+{
+	uint32_t i;
+
+	if (!self)
+		return;
+
+	for (i = 0; i < self->tiles_w * self->tiles_h; i++)
+		free(self->tiles[i].pixels);
+
+	if (self->swap_fd >= 0)
+		close(self->swap_fd);
+
+	free(self);
+}
+
+static void lru_remove(gp_tiled_pixmap *self, uint32_t idx)
+{
+	struct gp_pixmap_tile *tile = &self->tiles[idx];
+
+	if (tile->prev != GP_TILE_NONE)
+		self->tiles[tile->prev].next = tile->next;
+	else
+		self->lru_head = tile->next;
+
+	if (tile->next != GP_TILE_NONE)
+		self->tiles[tile->next].prev = tile->prev;
+	else
+		self->lru_tail = tile->prev;
+
+	tile->prev = GP_TILE_NONE;
+	tile->next = GP_TILE_NONE;
+}
+
+static void lru_add(gp_tiled_pixmap *self, uint32_t idx)
+{
+	struct gp_pixmap_tile *tile = &self->tiles[idx];
+
+	tile->prev = GP_TILE_NONE;
+	tile->next = self->lru_head;
+
+	if (self->lru_head != GP_TILE_NONE)
+		self->tiles[self->lru_head].prev = idx;
+	else
+		self->lru_tail = idx;
+
+	self->lru_head = idx;
+}
+
+static int swap_open(gp_tiled_pixmap *self)
+{
+	const char *tmpdir = getenv("TMPDIR");
+	char path[1024];
+
+	if (!tmpdir)
+		tmpdir = "/tmp";
+
+	snprintf(path, sizeof(path), "%s/gp_tiles_XXXXXX", tmpdir);
+
+	self->swap_fd = mkstemp(path);
+	if (self->swap_fd < 0) {
+		GP_WARN("Failed to create swap file '%s': %s",
+		        path, strerror(errno));
+		return 1;
+	}
+
+	/* The file is removed once the fd is closed */
+	unlink(path);
+
+	GP_DEBUG(1, "Created tile swap file '%s'", path);
+
+	return 0;
+}
+
+static int swap_io(gp_tiled_pixmap *self, uint32_t idx, uint8_t *buf, int wr)
+{
+	off_t off = (off_t)idx * self->tile_size;
+	size_t pos = 0;
+	ssize_t ret;
+
+	while (pos < self->tile_size) {
+		if (wr)
+			ret = pwrite(self->swap_fd, buf + pos, self->tile_size - pos, off + pos);
+		else
+			ret = pread(self->swap_fd, buf + pos, self->tile_size - pos, off + pos);
+
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			GP_WARN("Tile %u swap %s failed: %s", idx,
+			        wr ? "write" : "read", strerror(errno));
+			return 1;
+		}
+
+		if (ret == 0) {
+			GP_WARN("Tile %u swap read past end of file", idx);
+			errno = EIO;
+			return 1;
+		}
+
+		pos += ret;
+	}
+
+	return 0;
+}
+
+/*
+ * Pages out the least recently used tile and returns its buffer.
+ */
+static uint8_t *tile_evict(gp_tiled_pixmap *self)
+{
+	uint32_t idx = self->lru_tail;
+	struct gp_pixmap_tile *tile = &self->tiles[idx];
+	uint8_t *pixels = tile->pixels;
+
+	if (tile->dirty) {
+		if (self->swap_fd < 0 && swap_open(self))
+			return NULL;
+
+		if (swap_io(self, idx, pixels, 1))
+			return NULL;
+
+		tile->swapped = 1;
+		tile->dirty = 0;
+	}
+
+	lru_remove(self, idx);
+	tile->pixels = NULL;
+	self->loaded_tiles--;
+
+	return pixels;
+}
+
+static uint8_t *tile_load(gp_tiled_pixmap *self, uint32_t idx)
+{
+	struct gp_pixmap_tile *tile = &self->tiles[idx];
+	uint8_t *pixels;
+
+	if (tile->pixels) {
+		if (self->lru_head != idx) {
+			lru_remove(self, idx);
+			lru_add(self, idx);
+		}
+		return tile->pixels;
+	}
+
+	if (self->cache_tiles && self->loaded_tiles >= self->cache_tiles) {
+		pixels = tile_evict(self);
+	} else {
+		pixels = malloc(self->tile_size);
+		if (!pixels)
+			errno = ENOMEM;
+	}
+
+	if (!pixels)
+		return NULL;
+
+	if (tile->swapped && swap_io(self, idx, pixels, 0)) {
+		free(pixels);
+		return NULL;
+	}
+
+	tile->pixels = pixels;
+	tile->dirty = 0;
+	self->loaded_tiles++;
+	lru_add(self, idx);
+
+	return pixels;
+}
+
+gp_pixmap *gp_tiled_pixmap_tile(gp_tiled_pixmap *self, uint32_t tx,
+                                uint32_t ty, enum gp_tile_access access,
+                                gp_pixmap *tile)
+{
+	uint32_t idx = ty * self->tiles_w + tx;
+	uint8_t *pixels;
+
+	GP_ASSERT(tx < self->tiles_w && ty < self->tiles_h,
+	          "Tile %ux%u out of %ux%u", tx, ty,
+	          self->tiles_w, self->tiles_h);
+
+	pixels = tile_load(self, idx);
+	if (!pixels)
+		return NULL;
+
+	if (access & GP_TILE_WR)
+		self->tiles[idx].dirty = 1;
+
+	gp_pixmap_init(tile, GP_MIN((uint32_t)GP_TILE_SIZE, self->w - tx * GP_TILE_SIZE),
+	               GP_MIN((uint32_t)GP_TILE_SIZE, self->h - ty * GP_TILE_SIZE),
+	               self->pixel_type, pixels);
+
+	tile->bytes_per_row = self->tile_bytes_per_row;
+	tile->bit_endian = self->bit_endian;
+
+	return tile;
+}
+
+static int copy_rect(gp_tiled_pixmap *self,
+                     gp_coord x, gp_coord y, gp_size w, gp_size h,
+                     gp_pixmap *pixmap, gp_coord px, gp_coord py, int wr)
+{
+	gp_coord tx, ty;
+	gp_pixmap tile;
+
+	GP_ASSERT(pixmap->pixel_type == self->pixel_type,
+	          "The pixel types must match");
+
+	if (!w || !h)
+		return 0;
+
+	GP_ASSERT(x >= 0 && y >= 0 && x + w <= self->w && y + h <= self->h,
+	          "Rectangle out of the tiled pixmap");
+
+	for (ty = y / GP_TILE_SIZE; ty <= (gp_coord)(y + h - 1) / GP_TILE_SIZE; ty++) {
+		gp_coord y0 = GP_MAX(y, ty * GP_TILE_SIZE);
+		gp_coord y1 = GP_MIN(y + (gp_coord)h, (ty + 1) * GP_TILE_SIZE);
+
+		for (tx = x / GP_TILE_SIZE; tx <= (gp_coord)(x + w - 1) / GP_TILE_SIZE; tx++) {
+			gp_coord x0 = GP_MAX(x, tx * GP_TILE_SIZE);
+			gp_coord x1 = GP_MIN(x + (gp_coord)w, (tx + 1) * GP_TILE_SIZE);
+
+			if (!gp_tiled_pixmap_tile(self, tx, ty, wr ? GP_TILE_WR : GP_TILE_RD, &tile))
+				return 1;
+
+			if (wr) {
+				gp_blit_xywh_raw(pixmap, px + x0 - x, py + y0 - y,
+				                 x1 - x0, y1 - y0, &tile,
+				                 x0 - tx * GP_TILE_SIZE,
+				                 y0 - ty * GP_TILE_SIZE);
+			} else {
+				gp_blit_xywh_raw(&tile, x0 - tx * GP_TILE_SIZE,
+				                 y0 - ty * GP_TILE_SIZE,
+				                 x1 - x0, y1 - y0, pixmap,
+				                 px + x0 - x, py + y0 - y);
+			}
+		}
+	}
+
+	return 0;
+}
+
+int gp_tiled_pixmap_get_rect(gp_tiled_pixmap *self,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             gp_pixmap *dst, gp_coord x_dst, gp_coord y_dst)
+{
+	return copy_rect(self, x, y, w, h, dst, x_dst, y_dst, 0);
+}
+
+int gp_tiled_pixmap_put_rect(gp_tiled_pixmap *self,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             const gp_pixmap *src,
+                             gp_coord x_src, gp_coord y_src)
+{
+	return copy_rect(self, x, y, w, h, (gp_pixmap *)src, x_src, y_src, 1);
+}
+
+gp_pixel gp_tiled_getpixel(gp_tiled_pixmap *self, gp_coord x, gp_coord y)
+{
+	gp_pixmap tile;
+
+	if (x < 0 || y < 0 || x >= (gp_coord)self->w || y >= (gp_coord)self->h)
+		return 0;
+
+	if (!gp_tiled_pixmap_tile(self, x / GP_TILE_SIZE, y / GP_TILE_SIZE,
+	                          GP_TILE_RD, &tile))
+		return 0;
+
+	return gp_getpixel_raw(&tile, x % GP_TILE_SIZE, y % GP_TILE_SIZE);
+}
+
+void gp_tiled_putpixel(gp_tiled_pixmap *self, gp_coord x, gp_coord y,
+                       gp_pixel p)
+{
+	gp_pixmap tile;
+
+	if (x < 0 || y < 0 || x >= (gp_coord)self->w || y >= (gp_coord)self->h)
+		return;
+
+	if (!gp_tiled_pixmap_tile(self, x / GP_TILE_SIZE, y / GP_TILE_SIZE,
+	                          GP_TILE_WR, &tile))
+		return;
+
+	gp_putpixel_raw(&tile, x % GP_TILE_SIZE, y % GP_TILE_SIZE, p);
+}
+
+gp_tiled_pixmap *gp_tiled_pixmap_from_pixmap(const gp_pixmap *src,
+                                             uint32_t cache_tiles)
+{
+	gp_tiled_pixmap *ret;
+
+	ret = gp_tiled_pixmap_alloc(src->w, src->h, src->pixel_type, cache_tiles);
+	if (!ret)
+		return NULL;
+
+	ret->bit_endian = src->bit_endian;
+
+	if (gp_tiled_pixmap_put_rect(ret, 0, 0, src->w, src->h, src, 0, 0)) {
+		gp_tiled_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+
+gp_pixmap *gp_tiled_pixmap_to_pixmap(gp_tiled_pixmap *self)
+{
+	gp_pixmap *ret;
+
+	ret = gp_pixmap_alloc(self->w, self->h, self->pixel_type);
+	if (!ret)
+		return NULL;
+
+	ret->bit_endian = self->bit_endian;
+
+	if (gp_tiled_pixmap_get_rect(self, 0, 0, self->w, self->h, ret, 0, 0)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
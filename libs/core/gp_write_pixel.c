@@ -218,17 +218,17 @@ void gp_write_pixels_2BPP_BE(void *start, uint8_t off,
 	case 0:
 	break;
 	case 2:
-		GP_SET_BITS1_ALIGNED(6, 2, start, val);
+		GP_SET_BITS1_ALIGNED(4, 2, start, val);
 
 		if (--len == 0)
 			return;
 	case 4:
-		GP_SET_BITS1_ALIGNED(4, 2, start, val);
+		GP_SET_BITS1_ALIGNED(2, 2, start, val);
 
 		if (--len == 0)
 			return;
 	case 6:
-		GP_SET_BITS1_ALIGNED(2, 2, start, val);
+		GP_SET_BITS1_ALIGNED(0, 2, start, val);
 
 		if (--len == 0)
 			return;
@@ -245,11 +245,11 @@ void gp_write_pixels_2BPP_BE(void *start, uint8_t off,
 	/* And the rest */
 	switch (len%4) {
 	case 3:
-		GP_SET_BITS1_ALIGNED(0, 2, start, val);
-	case 2:
 		GP_SET_BITS1_ALIGNED(2, 2, start, val);
-	case 1:
+	case 2:
 		GP_SET_BITS1_ALIGNED(4, 2, start, val);
+	case 1:
+		GP_SET_BITS1_ALIGNED(6, 2, start, val);
 	break;
 	}
 }
@@ -0,0 +1,1031 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_yuv.gen.c
+ *
+ * GENERATED on 2026 10 17 03:29:50 from gp_yuv.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * YUV frames and conversions from and to pixmaps.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+#include <core/gp_threads.h>
+#include <core/gp_convert.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_yuv.h>
+#include <core/gp_damage.h>
+
+/*
+ * The rows are converted in chunks that fit into the L1 cache, the chunk size
+ * has to be even so that the chunks do not split the chroma pairs.
+ */
+#define YUV_CHUNK 256
+
+/* Fixed point BT.601 full range coefficients */
+#define YUV_BITS 14
+#define YUV_ROUND (1<<(YUV_BITS-1))
+
+#define CLAMP_8(x) ((x) < 0 ? 0 : ((x) > 255 ? 255 : (x)))
+
+#define YUV_TO_RGB(y, u, v, r, g, b) do { \
+	int32_t y_ = ((int32_t)(y)<<YUV_BITS) + YUV_ROUND; \
+	int32_t u_ = (int32_t)(u) - 128; \
+	int32_t v_ = (int32_t)(v) - 128; \
+	int32_t r_ = (y_ + 22970 * v_)>>YUV_BITS; \
+	int32_t g_ = (y_ - 5638 * u_ - 11700 * v_)>>YUV_BITS; \
+	int32_t b_ = (y_ + 29032 * u_)>>YUV_BITS; \
+	r = CLAMP_8(r_); \
+	g = CLAMP_8(g_); \
+	b = CLAMP_8(b_); \
+} while (0)
+
+/*
+ * The index is size_t so that the 3*i cannot wrap around, otherwise the
+ * interleaved stores are not vectorized.
+ */
+GP_SIMD_BODY void yuv_to_rgb888_body(uint8_t *restrict dst,
+                                     const uint8_t *restrict y,
+                                     const uint8_t *restrict u,
+                                     const uint8_t *restrict v, gp_size w)
+{
+	size_t i;
+
+	for (i = 0; i < w; i++) {
+		uint8_t r, g, b;
+
+		YUV_TO_RGB(y[i], u[i], v[i], r, g, b);
+
+		dst[3*i] = b;
+		dst[3*i+1] = g;
+		dst[3*i+2] = r;
+	}
+}
+
+GP_SIMD_VARIANT
+static void yuv_to_rgb888_generic(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb888_body(dst, y, u, v, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void yuv_to_rgb888_sse2(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void yuv_to_rgb888_avx2(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void yuv_to_rgb888_neon(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb888_body(dst, y, u, v, w);
+}
+#endif
+
+static void yuv_to_rgb888_resolve(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w);
+
+static void (*yuv_to_rgb888_fn)(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_rgb888_resolve;
+
+static void yuv_to_rgb888_resolve(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_rgb888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = yuv_to_rgb888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = yuv_to_rgb888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = yuv_to_rgb888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of yuv_to_rgb888()", variant);
+
+	__atomic_store_n(&yuv_to_rgb888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, y, u, v, w);
+}
+
+static inline void yuv_to_rgb888(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	__atomic_load_n(&yuv_to_rgb888_fn, __ATOMIC_RELAXED)(dst, y, u, v, w);
+}
+
+GP_SIMD_BODY void yuv_to_bgr888_body(uint8_t *restrict dst,
+                                     const uint8_t *restrict y,
+                                     const uint8_t *restrict u,
+                                     const uint8_t *restrict v, gp_size w)
+{
+	size_t i;
+
+	for (i = 0; i < w; i++) {
+		uint8_t r, g, b;
+
+		YUV_TO_RGB(y[i], u[i], v[i], r, g, b);
+
+		dst[3*i] = r;
+		dst[3*i+1] = g;
+		dst[3*i+2] = b;
+	}
+}
+
+GP_SIMD_VARIANT
+static void yuv_to_bgr888_generic(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_bgr888_body(dst, y, u, v, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void yuv_to_bgr888_sse2(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_bgr888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void yuv_to_bgr888_avx2(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_bgr888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void yuv_to_bgr888_neon(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_bgr888_body(dst, y, u, v, w);
+}
+#endif
+
+static void yuv_to_bgr888_resolve(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w);
+
+static void (*yuv_to_bgr888_fn)(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_bgr888_resolve;
+
+static void yuv_to_bgr888_resolve(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_bgr888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = yuv_to_bgr888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = yuv_to_bgr888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = yuv_to_bgr888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of yuv_to_bgr888()", variant);
+
+	__atomic_store_n(&yuv_to_bgr888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, y, u, v, w);
+}
+
+static inline void yuv_to_bgr888(uint8_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	__atomic_load_n(&yuv_to_bgr888_fn, __ATOMIC_RELAXED)(dst, y, u, v, w);
+}
+
+GP_SIMD_BODY void yuv_to_xrgb8888_body(uint32_t *restrict dst,
+                                       const uint8_t *restrict y,
+                                       const uint8_t *restrict u,
+                                       const uint8_t *restrict v, gp_size w)
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		uint32_t r, g, b;
+
+		YUV_TO_RGB(y[i], u[i], v[i], r, g, b);
+
+		dst[i] = (r<<16) | (g<<8) | b;
+	}
+}
+
+GP_SIMD_VARIANT
+static void yuv_to_xrgb8888_generic(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_xrgb8888_body(dst, y, u, v, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void yuv_to_xrgb8888_sse2(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_xrgb8888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void yuv_to_xrgb8888_avx2(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_xrgb8888_body(dst, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void yuv_to_xrgb8888_neon(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_xrgb8888_body(dst, y, u, v, w);
+}
+#endif
+
+static void yuv_to_xrgb8888_resolve(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w);
+
+static void (*yuv_to_xrgb8888_fn)(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_xrgb8888_resolve;
+
+static void yuv_to_xrgb8888_resolve(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_xrgb8888_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = yuv_to_xrgb8888_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = yuv_to_xrgb8888_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = yuv_to_xrgb8888_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of yuv_to_xrgb8888()", variant);
+
+	__atomic_store_n(&yuv_to_xrgb8888_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, y, u, v, w);
+}
+
+static inline void yuv_to_xrgb8888(uint32_t *restrict dst, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	__atomic_load_n(&yuv_to_xrgb8888_fn, __ATOMIC_RELAXED)(dst, y, u, v, w);
+}
+
+GP_SIMD_BODY void yuv_to_rgb_body(uint8_t *restrict r, uint8_t *restrict g,
+                                  uint8_t *restrict b,
+                                  const uint8_t *restrict y,
+                                  const uint8_t *restrict u,
+                                  const uint8_t *restrict v, gp_size w)
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++)
+		YUV_TO_RGB(y[i], u[i], v[i], r[i], g[i], b[i]);
+}
+
+GP_SIMD_VARIANT
+static void yuv_to_rgb_generic(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb_body(r, g, b, y, u, v, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void yuv_to_rgb_sse2(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb_body(r, g, b, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void yuv_to_rgb_avx2(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb_body(r, g, b, y, u, v, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void yuv_to_rgb_neon(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	yuv_to_rgb_body(r, g, b, y, u, v, w);
+}
+#endif
+
+static void yuv_to_rgb_resolve(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w);
+
+static void (*yuv_to_rgb_fn)(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_rgb_resolve;
+
+static void yuv_to_rgb_resolve(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w) = yuv_to_rgb_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = yuv_to_rgb_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = yuv_to_rgb_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = yuv_to_rgb_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of yuv_to_rgb()", variant);
+
+	__atomic_store_n(&yuv_to_rgb_fn, fn, __ATOMIC_RELAXED);
+
+	fn(r, g, b, y, u, v, w);
+}
+
+static inline void yuv_to_rgb(uint8_t *restrict r, uint8_t *restrict g, uint8_t *restrict b, const uint8_t *restrict y, const uint8_t *restrict u, const uint8_t *restrict v, gp_size w)
+{
+	__atomic_load_n(&yuv_to_rgb_fn, __ATOMIC_RELAXED)(r, g, b, y, u, v, w);
+}
+
+GP_SIMD_BODY void rgb_to_yuv_body(uint8_t *restrict y, uint8_t *restrict u,
+                                  uint8_t *restrict v,
+                                  const uint8_t *restrict r,
+                                  const uint8_t *restrict g,
+                                  const uint8_t *restrict b, gp_size w)
+{
+	gp_size i;
+
+	for (i = 0; i < w; i++) {
+		int32_t r_ = r[i], g_ = g[i], b_ = b[i];
+		int32_t y_ = (4899 * r_ + 9617 * g_ + 1868 * b_ + YUV_ROUND)>>YUV_BITS;
+		int32_t u_ = ((-2765 * r_ - 5427 * g_ + 8192 * b_ + YUV_ROUND)>>YUV_BITS) + 128;
+		int32_t v_ = ((8192 * r_ - 6860 * g_ - 1332 * b_ + YUV_ROUND)>>YUV_BITS) + 128;
+
+		y[i] = y_;
+		u[i] = CLAMP_8(u_);
+		v[i] = CLAMP_8(v_);
+	}
+}
+
+GP_SIMD_VARIANT
+static void rgb_to_yuv_generic(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	rgb_to_yuv_body(y, u, v, r, g, b, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void rgb_to_yuv_sse2(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	rgb_to_yuv_body(y, u, v, r, g, b, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void rgb_to_yuv_avx2(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	rgb_to_yuv_body(y, u, v, r, g, b, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void rgb_to_yuv_neon(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	rgb_to_yuv_body(y, u, v, r, g, b, w);
+}
+#endif
+
+static void rgb_to_yuv_resolve(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w);
+
+static void (*rgb_to_yuv_fn)(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w) = rgb_to_yuv_resolve;
+
+static void rgb_to_yuv_resolve(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w) = rgb_to_yuv_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = rgb_to_yuv_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = rgb_to_yuv_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = rgb_to_yuv_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of rgb_to_yuv()", variant);
+
+	__atomic_store_n(&rgb_to_yuv_fn, fn, __ATOMIC_RELAXED);
+
+	fn(y, u, v, r, g, b, w);
+}
+
+static inline void rgb_to_yuv(uint8_t *restrict y, uint8_t *restrict u, uint8_t *restrict v, const uint8_t *restrict r, const uint8_t *restrict g, const uint8_t *restrict b, gp_size w)
+{
+	__atomic_load_n(&rgb_to_yuv_fn, __ATOMIC_RELAXED)(y, u, v, r, g, b, w);
+}
+
+static const char *yuv_format_names[] = {
+	[GP_YUV_YUYV] = "YUYV",
+	[GP_YUV_UYVY] = "UYVY",
+	[GP_YUV_NV12] = "NV12",
+	[GP_YUV_I420] = "I420",
+};
+
+const char *gp_yuv_format_name(enum gp_yuv_format format)
+{
+	if (format >= GP_YUV_MAX)
+		return "Invalid";
+
+	return yuv_format_names[format];
+}
+
+static int is_packed(enum gp_yuv_format format)
+{
+	return format == GP_YUV_YUYV || format == GP_YUV_UYVY;
+}
+
+/* Byte offsets of Y0, U and V in a packed Y0 U Y1 V macropixel */
+static void packed_offsets(enum gp_yuv_format format,
+                           unsigned int *yo, unsigned int *uo, unsigned int *vo)
+{
+	if (format == GP_YUV_YUYV) {
+		*yo = 0;
+		*uo = 1;
+		*vo = 3;
+	} else {
+		*yo = 1;
+		*uo = 0;
+		*vo = 2;
+	}
+}
+
+static uint32_t min_bytes_per_row(gp_size w, enum gp_yuv_format format)
+{
+	/* Chroma is shared by pairs, odd sizes are rounded up */
+	gp_size cw = (w + 1) / 2;
+
+	return is_packed(format) ? 4 * cw : 2 * cw;
+}
+
+size_t gp_yuv_frame_size(gp_size w, gp_size h, enum gp_yuv_format format,
+                         uint32_t bytes_per_row)
+{
+	size_t ch = (h + 1) / 2;
+
+	if (!bytes_per_row)
+		bytes_per_row = min_bytes_per_row(w, format);
+
+	switch (format) {
+	case GP_YUV_YUYV:
+	case GP_YUV_UYVY:
+		return (size_t)bytes_per_row * h;
+	case GP_YUV_NV12:
+		return (size_t)bytes_per_row * (h + ch);
+	case GP_YUV_I420:
+		return (size_t)bytes_per_row * h + 2 * (size_t)(bytes_per_row / 2) * ch;
+	default:
+		return 0;
+	}
+}
+
+gp_yuv_frame *gp_yuv_frame_init(gp_yuv_frame *self, gp_size w, gp_size h,
+                                enum gp_yuv_format format, void *pixels,
+                                uint32_t bytes_per_row)
+{
+	uint8_t *buf = pixels;
+
+	if (format >= GP_YUV_MAX) {
+		GP_WARN("Invalid YUV format %i", format);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (!bytes_per_row)
+		bytes_per_row = min_bytes_per_row(w, format);
+
+	if (bytes_per_row < min_bytes_per_row(w, format)) {
+		GP_WARN("Row size %u too small for %s width %u",
+		        bytes_per_row, gp_yuv_format_name(format), w);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	self->w = w;
+	self->h = h;
+	self->format = format;
+	self->free_pixels = 0;
+
+	self->planes[0].pixels = buf;
+	self->planes[0].bytes_per_row = bytes_per_row;
+
+	switch (format) {
+	case GP_YUV_YUYV:
+	case GP_YUV_UYVY:
+		self->plane_cnt = 1;
+	break;
+	case GP_YUV_NV12:
+		self->plane_cnt = 2;
+		self->planes[1].pixels = buf + (size_t)bytes_per_row * h;
+		self->planes[1].bytes_per_row = bytes_per_row;
+	break;
+	case GP_YUV_I420:
+		self->plane_cnt = 3;
+		self->planes[1].pixels = buf + (size_t)bytes_per_row * h;
+		self->planes[1].bytes_per_row = bytes_per_row / 2;
+		self->planes[2].pixels = self->planes[1].pixels +
+		                         (size_t)(bytes_per_row / 2) * ((h + 1) / 2);
+		self->planes[2].bytes_per_row = bytes_per_row / 2;
+	break;
+	default:
+	break;
+	}
+
+	return self;
+}
+
+gp_yuv_frame *gp_yuv_frame_alloc(gp_size w, gp_size h,
+                                 enum gp_yuv_format format)
+{
+	gp_yuv_frame *self;
+	void *pixels;
+
+	if (format >= GP_YUV_MAX) {
+		GP_WARN("Invalid YUV format %i", format);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self));
+	pixels = malloc(gp_yuv_frame_size(w, h, format, 0));
+
+	if (!self || !pixels) {
+		GP_WARN("Malloc failed :(");
+		free(self);
+		free(pixels);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	gp_yuv_frame_init(self, w, h, format, pixels, 0);
+	self->free_pixels = 1;
+
+	GP_DEBUG(1, "Allocated YUV frame %ux%u %s",
+	         w, h, gp_yuv_format_name(format));
+
+	return self;
+}
+
+void gp_yuv_frame_free(gp_yuv_frame *self)
+{
+	if (!self)
+		return;
+
+	/* The planes are allocated in one chunk */
+	if (self->free_pixels)
+		free(self->planes[0].pixels);
+
+	free(self);
+}
+
+/*
+ * Fetches Y, U and V for pixels at sx[] coordinates from row sy.
+ */
+static void yuv_row_unpack(const gp_yuv_frame *src, gp_coord sy,
+                           const uint32_t *sx, gp_size len,
+                           uint8_t *y, uint8_t *u, uint8_t *v)
+{
+	const gp_yuv_plane *p = src->planes;
+	const uint8_t *row = p[0].pixels + (size_t)sy * p[0].bytes_per_row;
+	const uint8_t *crow, *vrow;
+	unsigned int yo, uo, vo;
+	gp_size i;
+
+	switch (src->format) {
+	case GP_YUV_YUYV:
+	case GP_YUV_UYVY:
+		packed_offsets(src->format, &yo, &uo, &vo);
+
+		for (i = 0; i < len; i++) {
+			y[i] = row[2 * sx[i] + yo];
+			u[i] = row[4 * (sx[i]/2) + uo];
+			v[i] = row[4 * (sx[i]/2) + vo];
+		}
+	break;
+	case GP_YUV_NV12:
+		crow = p[1].pixels + (size_t)(sy/2) * p[1].bytes_per_row;
+
+		for (i = 0; i < len; i++) {
+			y[i] = row[sx[i]];
+			u[i] = crow[2 * (sx[i]/2)];
+			v[i] = crow[2 * (sx[i]/2) + 1];
+		}
+	break;
+	case GP_YUV_I420:
+		crow = p[1].pixels + (size_t)(sy/2) * p[1].bytes_per_row;
+		vrow = p[2].pixels + (size_t)(sy/2) * p[2].bytes_per_row;
+
+		for (i = 0; i < len; i++) {
+			y[i] = row[sx[i]];
+			u[i] = crow[sx[i]/2];
+			v[i] = vrow[sx[i]/2];
+		}
+	break;
+	default:
+	break;
+	}
+}
+
+static void rgb_row_pack(gp_pixmap *dst, gp_coord x, gp_coord y, gp_size len,
+                         const uint8_t *yc, const uint8_t *uc, const uint8_t *vc)
+{
+	uint8_t r[YUV_CHUNK], g[YUV_CHUNK], b[YUV_CHUNK];
+	void *addr = GP_PIXEL_ADDR(dst, x, y);
+	gp_size i;
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB888:
+		yuv_to_rgb888(addr, yc, uc, vc, len);
+	break;
+	case GP_PIXEL_BGR888:
+		yuv_to_bgr888(addr, yc, uc, vc, len);
+	break;
+	case GP_PIXEL_xRGB8888:
+		yuv_to_xrgb8888(addr, yc, uc, vc, len);
+	break;
+	default:
+		yuv_to_rgb(r, g, b, yc, uc, vc, len);
+
+		for (i = 0; i < len; i++) {
+			gp_pixel p = GP_PIXEL_CREATE_RGB888(r[i], g[i], b[i]);
+
+			gp_putpixel_raw(dst, x + i, y,
+			                gp_RGB888_to_pixel(p, dst->pixel_type));
+		}
+	break;
+	}
+}
+
+struct yuv_blit_priv {
+	const gp_yuv_frame *src;
+	gp_pixmap *dst;
+	gp_coord x;
+	gp_coord y;
+	gp_size w;
+	gp_size h;
+};
+
+static int yuv_blit_tile(const gp_tile *tile, void *ppriv, gp_progress_cb *callback)
+{
+	struct yuv_blit_priv *priv = ppriv;
+	const gp_yuv_frame *src = priv->src;
+	uint8_t yc[YUV_CHUNK], uc[YUV_CHUNK], vc[YUV_CHUNK];
+	uint32_t sx[YUV_CHUNK];
+	gp_size i, j, k;
+
+	for (j = 0; j < tile->h; j++) {
+		gp_coord yr = tile->y + j;
+		gp_coord sy = ((uint64_t)yr * src->h) / priv->h;
+
+		for (i = 0; i < tile->w; i += YUV_CHUNK) {
+			gp_size len = GP_MIN(tile->w - i, (gp_size)YUV_CHUNK);
+			gp_coord xr = tile->x + i;
+
+			for (k = 0; k < len; k++)
+				sx[k] = ((uint64_t)(xr + k) * src->w) / priv->w;
+
+			yuv_row_unpack(src, sy, sx, len, yc, uc, vc);
+			rgb_row_pack(priv->dst, priv->x + xr, priv->y + yr, len, yc, uc, vc);
+		}
+
+		if (gp_progress_cb_report(callback, j, tile->h, tile->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int gp_yuv_frame_blit_scaled(const gp_yuv_frame *src, gp_pixmap *dst,
+                             gp_coord x, gp_coord y, gp_size w, gp_size h,
+                             gp_progress_cb *callback)
+{
+	struct yuv_blit_priv priv = {
+		.src = src,
+		.dst = dst,
+		.x = x,
+		.y = y,
+		.w = w,
+		.h = h,
+	};
+
+	GP_CHECK(x >= 0 && y >= 0 && x + w <= dst->w && y + h <= dst->h,
+	         "Destination rectangle does not fit into pixmap");
+
+	if (gp_pixel_has_flags(dst->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_WARN("Palette pixmaps are not supported");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!w || !h || !src->w || !src->h)
+		return 0;
+
+	GP_DEBUG(1, "Converting %ux%u %s to %ux%u %s", src->w, src->h,
+	         gp_yuv_format_name(src->format), w, h,
+	         gp_pixel_type_name(dst->pixel_type));
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	gp_pixmap_damage_xywh_raw(dst, x, y, w, h);
+
+	gp_tiles tiles = {
+		.w = w,
+		.h = h,
+		.bpp = dst->bpp,
+		.name = "yuv_blit",
+		.pixel_type = dst->pixel_type,
+		.fn = yuv_blit_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	/* Pixels smaller than byte may share bytes, split only rows */
+	if (dst->bpp % 8)
+		tiles.min_w = tiles.w;
+
+	return gp_tiles_run(&tiles) ? 1 : 0;
+}
+
+gp_pixmap *gp_yuv_frame_to_pixmap_alloc(const gp_yuv_frame *src,
+                                        gp_pixel_type pixel_type,
+                                        gp_progress_cb *callback)
+{
+	gp_pixmap *ret;
+	int err;
+
+	ret = gp_pixmap_alloc(src->w, src->h, pixel_type);
+	if (!ret)
+		return NULL;
+
+	if (gp_yuv_frame_to_pixmap(src, ret, callback)) {
+		err = errno;
+		gp_pixmap_free(ret);
+		errno = err;
+		return NULL;
+	}
+
+	return ret;
+}
+
+static void pixmap_row_to_yuv(const gp_pixmap *src, gp_coord x, gp_coord y,
+                              gp_size len, uint8_t *yc, uint8_t *uc, uint8_t *vc)
+{
+	uint8_t r[YUV_CHUNK], g[YUV_CHUNK], b[YUV_CHUNK];
+	gp_size i;
+
+	for (i = 0; i < len; i++) {
+		gp_pixel p = gp_getpixel_raw(src, x + i, y);
+
+		p = gp_pixel_to_RGB888(p, src->pixel_type);
+
+		r[i] = GP_PIXEL_GET_R_RGB888(p);
+		g[i] = GP_PIXEL_GET_G_RGB888(p);
+		b[i] = GP_PIXEL_GET_B_RGB888(p);
+	}
+
+	rgb_to_yuv(yc, uc, vc, r, g, b, len);
+}
+
+/*
+ * Averages the chroma over horizontal pairs in place, odd sized rows have
+ * the last sample on its own.
+ */
+static void chroma_pairs(uint8_t *c, gp_size len)
+{
+	gp_size i;
+
+	for (i = 0; i + 1 < len; i += 2)
+		c[i/2] = (c[i] + c[i+1] + 1) / 2;
+
+	if (len % 2)
+		c[len/2] = c[len-1];
+}
+
+struct to_yuv_priv {
+	const gp_pixmap *src;
+	gp_yuv_frame *dst;
+};
+
+static void to_yuv_chunk(const gp_pixmap *src, gp_yuv_frame *dst,
+                         gp_coord x, gp_coord y, gp_size len)
+{
+	uint8_t yc[YUV_CHUNK], uc[YUV_CHUNK], vc[YUV_CHUNK];
+	uint8_t uc2[YUV_CHUNK], vc2[YUV_CHUNK], yc2[YUV_CHUNK];
+	gp_yuv_plane *p = dst->planes;
+	uint8_t *row = p[0].pixels + (size_t)y * p[0].bytes_per_row;
+	gp_size i, clen = (len + 1) / 2;
+	unsigned int yo, uo, vo;
+	uint8_t *crow, *vrow;
+
+	pixmap_row_to_yuv(src, x, y, len, yc, uc, vc);
+
+	if (is_packed(dst->format)) {
+		packed_offsets(dst->format, &yo, &uo, &vo);
+
+		chroma_pairs(uc, len);
+		chroma_pairs(vc, len);
+
+		row += 2 * x;
+
+		for (i = 0; i < len; i++)
+			row[2 * i + yo] = yc[i];
+
+		for (i = 0; i < clen; i++) {
+			row[4 * i + uo] = uc[i];
+			row[4 * i + vo] = vc[i];
+		}
+
+		/* Odd width, the second luma of the last pair is padding */
+		if ((gp_size)x + len == dst->w && len % 2)
+			row[2 * len + yo] = yc[len-1];
+
+		return;
+	}
+
+	for (i = 0; i < len; i++)
+		row[x + i] = yc[i];
+
+	/* Odd width, the row is padded to the chroma pairs */
+	if ((gp_size)x + len == dst->w && len % 2)
+		row[x + len] = yc[len-1];
+
+	/* The 4:2:0 chroma is computed from pairs of rows */
+	if (y % 2)
+		return;
+
+	if ((gp_size)y + 1 < dst->h) {
+		pixmap_row_to_yuv(src, x, y + 1, len, yc2, uc2, vc2);
+
+		for (i = 0; i < len; i++) {
+			uc[i] = (uc[i] + uc2[i] + 1) / 2;
+			vc[i] = (vc[i] + vc2[i] + 1) / 2;
+		}
+	}
+
+	chroma_pairs(uc, len);
+	chroma_pairs(vc, len);
+
+	crow = p[1].pixels + (size_t)(y/2) * p[1].bytes_per_row;
+
+	if (dst->format == GP_YUV_NV12) {
+		crow += x;
+
+		for (i = 0; i < clen; i++) {
+			crow[2 * i] = uc[i];
+			crow[2 * i + 1] = vc[i];
+		}
+
+		return;
+	}
+
+	vrow = p[2].pixels + (size_t)(y/2) * p[2].bytes_per_row;
+
+	for (i = 0; i < clen; i++) {
+		crow[x/2 + i] = uc[i];
+		vrow[x/2 + i] = vc[i];
+	}
+}
+
+static int to_yuv_tile(const gp_tile *tile, void *ppriv, gp_progress_cb *callback)
+{
+	struct to_yuv_priv *priv = ppriv;
+	gp_size i, j;
+
+	for (j = 0; j < tile->h; j++) {
+		for (i = 0; i < tile->w; i += YUV_CHUNK) {
+			gp_size len = GP_MIN(tile->w - i, (gp_size)YUV_CHUNK);
+
+			to_yuv_chunk(priv->src, priv->dst, tile->x + i,
+			             tile->y + j, len);
+		}
+
+		if (gp_progress_cb_report(callback, j, tile->h, tile->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int gp_pixmap_to_yuv_frame(const gp_pixmap *src, gp_yuv_frame *dst,
+                           gp_progress_cb *callback)
+{
+	struct to_yuv_priv priv = {
+		.src = src,
+		.dst = dst,
+	};
+
+	if (src->w != dst->w || src->h != dst->h) {
+		GP_WARN("Pixmap and YUV frame size mismatch");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_WARN("Palette pixmaps are not supported");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!src->w || !src->h)
+		return 0;
+
+	GP_DEBUG(1, "Converting %ux%u %s to %s", src->w, src->h,
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_yuv_format_name(dst->format));
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = src->h,
+		.bpp = src->bpp,
+		.name = "to_yuv",
+		.pixel_type = src->pixel_type,
+		.fn = to_yuv_tile,
+		.priv = &priv,
+		.callback = callback,
+		/* The chroma pairs must not be split between tiles */
+		.min_w = src->w,
+	};
+
+	return gp_tiles_run(&tiles) ? 1 : 0;
+}
@@ -1,7 +1,8 @@
 @ def filter_arithmetic(name, filter_op, opts='', params=''):
 #include <core/gp_pixmap.h>
 #include <core/gp_pixel.h>
-#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_temp_alloc.h>
 #include <core/gp_debug.h>
 #include <filters/gp_filter.h>
 #include <filters/gp_arithmetic.h>
@@ -16,31 +17,43 @@ static int filter_{{ name }}_{{ pt.name }}(const gp_pixmap *src_a, const gp_pixm
 	w = GP_MIN(src_a->w, src_b->w);
 	h = GP_MIN(src_a->h, src_b->h);
 
-	for (y = 0; y < h; y++) {
-		for (x = 0; x < w; x++) {
-			gp_pixel pix_a = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src_a, x, y);
-			gp_pixel pix_b = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src_b, x, y);
+	gp_temp_alloc_create(temp, {{ 2 * len(pt.chanslist) }} * w * sizeof(int));
 
+	int *const row_a[] = {
 @             for c in pt.chanslist:
-			int32_t {{ c.name }}_A = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix_a);
-			int32_t {{ c.name }}_B = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix_b);
+		gp_temp_alloc_get(temp, w * sizeof(int)),
 @             end
+	};
 
+	int *const row_b[] = {
 @             for c in pt.chanslist:
-			int32_t {{ c.name }};
-			{@ filter_op(c.name, c.size) @}
+		gp_temp_alloc_get(temp, w * sizeof(int)),
 @             end
+	};
 
-			gp_pixel pix;
-			pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }});
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_{{ pt.name }}(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_{{ pt.name }}(src_b, 0, y, w, row_b);
 
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y, pix);
+@             for i, c in enumerate(pt.chanslist):
+		for (x = 0; x < w; x++) {
+			int32_t {{ c.name }}_A = row_a[{{ i }}][x];
+			int32_t {{ c.name }}_B = row_b[{{ i }}][x];
+			int32_t {{ c.name }};
+			{@ filter_op(c.name, c.size) @}
+			row_a[{{ i }}][x] = {{ c.name }};
 		}
 
-		if (gp_progress_cb_report(callback, y, h, w))
+@             end
+		gp_pixel_row_pack_{{ pt.name }}(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
 			return 1;
+		}
 	}
 
+	gp_temp_alloc_free(temp);
 	gp_progress_cb_done(callback);
 	return 0;
 }
@@ -52,6 +65,9 @@ int gp_filter_{{ name }}_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
 {
 	GP_DEBUG(1, "Running filter {{ name }}");
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src_a->pixel_type) {
 @     for pt in pixeltypes:
 @         if not pt.is_unknown():
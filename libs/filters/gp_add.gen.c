@@ -0,0 +1,1372 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_add.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:26 from gp_add.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Addition of two bitmaps.
+ *
+ * Copyright (C) 2012-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_clamp.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_arithmetic.h>
+
+static int filter_add_xRGB8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_xRGB8888(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_xRGB8888(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_xRGB8888(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGBA8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 8 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGBA8888(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGBA8888(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			row_a[2][x] = B;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t A_A = row_a[3][x];
+			int32_t A_B = row_b[3][x];
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+			row_a[3][x] = A;
+		}
+
+		gp_pixel_row_pack_RGBA8888(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB888(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB888(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB888(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_BGR888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_BGR888(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_BGR888(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[0][x];
+			int32_t B_B = row_b[0][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			row_a[0][x] = B;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[2][x];
+			int32_t R_B = row_b[2][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			row_a[2][x] = R;
+		}
+
+		gp_pixel_row_pack_BGR888(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB555(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB555(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB555(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 31);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 31);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 31);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB555(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB565(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB565(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB565(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 31);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 63);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 31);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB565(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB666(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB666(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB666(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 63);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 63);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 63);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB666(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB332(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB332(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB332(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 7);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 7);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 3);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB332(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_CMYK8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 8 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_CMYK8888(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_CMYK8888(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t K_A = row_a[0][x];
+			int32_t K_B = row_b[0][x];
+			int32_t K;
+			K = K_A + K_B;
+			GP_CLAMP_GENERIC(K, 0, 255);
+			row_a[0][x] = K;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t Y_A = row_a[1][x];
+			int32_t Y_B = row_b[1][x];
+			int32_t Y;
+			Y = Y_A + Y_B;
+			GP_CLAMP_GENERIC(Y, 0, 255);
+			row_a[1][x] = Y;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t M_A = row_a[2][x];
+			int32_t M_B = row_b[2][x];
+			int32_t M;
+			M = M_A + M_B;
+			GP_CLAMP_GENERIC(M, 0, 255);
+			row_a[2][x] = M;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t C_A = row_a[3][x];
+			int32_t C_B = row_b[3][x];
+			int32_t C;
+			C = C_A + C_B;
+			GP_CLAMP_GENERIC(C, 0, 255);
+			row_a[3][x] = C;
+		}
+
+		gp_pixel_row_pack_CMYK8888(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P2(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_P2(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_P2(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t P_A = row_a[0][x];
+			int32_t P_B = row_b[0][x];
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 3);
+			row_a[0][x] = P;
+		}
+
+		gp_pixel_row_pack_P2(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P4(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_P4(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_P4(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t P_A = row_a[0][x];
+			int32_t P_B = row_b[0][x];
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 15);
+			row_a[0][x] = P;
+		}
+
+		gp_pixel_row_pack_P4(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P8(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_P8(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_P8(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t P_A = row_a[0][x];
+			int32_t P_B = row_b[0][x];
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 255);
+			row_a[0][x] = P;
+		}
+
+		gp_pixel_row_pack_P8(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G1(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_G1(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_G1(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 1);
+			row_a[0][x] = V;
+		}
+
+		gp_pixel_row_pack_G1(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G2(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_G2(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_G2(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 3);
+			row_a[0][x] = V;
+		}
+
+		gp_pixel_row_pack_G2(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G4(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_G4(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_G4(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 15);
+			row_a[0][x] = V;
+		}
+
+		gp_pixel_row_pack_G4(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G8(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_G8(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_G8(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 255);
+			row_a[0][x] = V;
+		}
+
+		gp_pixel_row_pack_G8(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_GA88(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 4 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_GA88(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_GA88(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 255);
+			row_a[0][x] = V;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t A_A = row_a[1][x];
+			int32_t A_B = row_b[1][x];
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+			row_a[1][x] = A;
+		}
+
+		gp_pixel_row_pack_GA88(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G16(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 2 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_G16(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_G16(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t V_A = row_a[0][x];
+			int32_t V_B = row_b[0][x];
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 65535);
+			row_a[0][x] = V;
+		}
+
+		gp_pixel_row_pack_G16(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGBA8888_PM(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 8 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGBA8888_PM(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGBA8888_PM(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			row_a[2][x] = B;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t A_A = row_a[3][x];
+			int32_t A_B = row_b[3][x];
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+			row_a[3][x] = A;
+		}
+
+		gp_pixel_row_pack_RGBA8888_PM(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB161616(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 6 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGB161616(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGB161616(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 65535);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 65535);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 65535);
+			row_a[2][x] = B;
+		}
+
+		gp_pixel_row_pack_RGB161616(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGBA16161616(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	uint32_t x, y, w, h;
+
+	w = GP_MIN(src_a->w, src_b->w);
+	h = GP_MIN(src_a->h, src_b->h);
+
+	gp_temp_alloc_create(temp, 8 * w * sizeof(int));
+
+	int *const row_a[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	int *const row_b[] = {
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+		gp_temp_alloc_get(temp, w * sizeof(int)),
+	};
+
+	for (y = 0; y < h; y++) {
+		gp_pixel_row_unpack_RGBA16161616(src_a, 0, y, w, row_a);
+		gp_pixel_row_unpack_RGBA16161616(src_b, 0, y, w, row_b);
+
+		for (x = 0; x < w; x++) {
+			int32_t R_A = row_a[0][x];
+			int32_t R_B = row_b[0][x];
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 65535);
+			row_a[0][x] = R;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t G_A = row_a[1][x];
+			int32_t G_B = row_b[1][x];
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 65535);
+			row_a[1][x] = G;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t B_A = row_a[2][x];
+			int32_t B_B = row_b[2][x];
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 65535);
+			row_a[2][x] = B;
+		}
+
+		for (x = 0; x < w; x++) {
+			int32_t A_A = row_a[3][x];
+			int32_t A_B = row_b[3][x];
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 65535);
+			row_a[3][x] = A;
+		}
+
+		gp_pixel_row_pack_RGBA16161616(dst, 0, y, w, row_a);
+
+		if (gp_progress_cb_report(callback, y, h, w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+int gp_filter_add_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Running filter add");
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src_a->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return filter_add_xRGB8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGBA8888:
+		return filter_add_RGBA8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB888:
+		return filter_add_RGB888(src_a, src_b, dst, callback);
+	case GP_PIXEL_BGR888:
+		return filter_add_BGR888(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB555:
+		return filter_add_RGB555(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB565:
+		return filter_add_RGB565(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB666:
+		return filter_add_RGB666(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB332:
+		return filter_add_RGB332(src_a, src_b, dst, callback);
+	case GP_PIXEL_CMYK8888:
+		return filter_add_CMYK8888(src_a, src_b, dst, callback);
+	case GP_PIXEL_P2:
+		return filter_add_P2(src_a, src_b, dst, callback);
+	case GP_PIXEL_P4:
+		return filter_add_P4(src_a, src_b, dst, callback);
+	case GP_PIXEL_P8:
+		return filter_add_P8(src_a, src_b, dst, callback);
+	case GP_PIXEL_G1:
+		return filter_add_G1(src_a, src_b, dst, callback);
+	case GP_PIXEL_G2:
+		return filter_add_G2(src_a, src_b, dst, callback);
+	case GP_PIXEL_G4:
+		return filter_add_G4(src_a, src_b, dst, callback);
+	case GP_PIXEL_G8:
+		return filter_add_G8(src_a, src_b, dst, callback);
+	case GP_PIXEL_GA88:
+		return filter_add_GA88(src_a, src_b, dst, callback);
+	case GP_PIXEL_G16:
+		return filter_add_G16(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGBA8888_PM:
+		return filter_add_RGBA8888_PM(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGB161616:
+		return filter_add_RGB161616(src_a, src_b, dst, callback);
+	case GP_PIXEL_RGBA16161616:
+		return filter_add_RGBA16161616(src_a, src_b, dst, callback);
+	default:
+	break;
+	}
+
+	return 1;
+}
+
+int gp_filter_add(const gp_pixmap *src_a, const gp_pixmap *src_b,
+                         gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	GP_ASSERT(src_a->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(w <= dst->w && h <= dst->h,
+	          "Destination is not big enough");
+
+	if (gp_filter_add_raw(src_a, src_b, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+
+gp_pixmap *gp_filter_add_alloc(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	                              gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	GP_ASSERT(src_a->pixel_type == src_b->pixel_type,
+	          "Pixel types for sources must match.");
+
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	res = gp_pixmap_alloc(w, h, src_a->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_add_raw(src_a, src_b, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+
+		gp_pixmap_free(res);
+
+		return NULL;
+	}
+
+	return res;
+}
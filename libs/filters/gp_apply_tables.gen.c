@@ -0,0 +1,1052 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_apply_tables.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:29 from gp_apply_tables.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Generic Point filer
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_debug.h>
+#include <core/gp_threads.h>
+
+#include <filters/gp_apply_tables.h>
+
+static int apply_tables_xRGB8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_xRGB8888(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_xRGB8888(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGBA8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 4 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGBA8888(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[3][x] = tables->table[3][row[3][x]];
+
+		gp_pixel_row_pack_RGBA8888(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB888(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB888(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_BGR888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_BGR888(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_BGR888(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB555(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB555(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB555(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB565(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB565(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB565(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB666(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB666(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB666(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB332(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB332(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB332(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_CMYK8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 4 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_CMYK8888(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[3][x] = tables->table[3][row[3][x]];
+
+		gp_pixel_row_pack_CMYK8888(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G1(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 1 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_G1(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		gp_pixel_row_pack_G1(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G2(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 1 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_G2(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		gp_pixel_row_pack_G2(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G4(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 1 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_G4(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		gp_pixel_row_pack_G4(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G8(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 1 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_G8(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		gp_pixel_row_pack_G8(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_GA88(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 2 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_GA88(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		gp_pixel_row_pack_GA88(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G16(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 1 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_G16(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		gp_pixel_row_pack_G16(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGBA8888_PM(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 4 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGBA8888_PM(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[3][x] = tables->table[3][row[3][x]];
+
+		gp_pixel_row_pack_RGBA8888_PM(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB161616(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 3 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGB161616(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		gp_pixel_row_pack_RGB161616(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGBA16161616(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_temp_alloc_create(temp, 4 * w_src * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	for (y = 0; y < h_src; y++) {
+		gp_pixel_row_unpack_RGBA16161616(src, x_src, y_src + y, w_src, row);
+
+		for (x = 0; x < w_src; x++)
+			row[0][x] = tables->table[0][row[0][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[1][x] = tables->table[1][row[1][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[2][x] = tables->table[2][row[2][x]];
+
+		for (x = 0; x < w_src; x++)
+			row[3][x] = tables->table[3][row[3][x]];
+
+		gp_pixel_row_pack_RGBA16161616(dst, x_dst, y_dst + y, w_src, row);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_raw(const gp_pixmap *const src,
+                            gp_coord x_src, gp_coord y_src,
+                            gp_size w_src, gp_size h_src,
+                            gp_pixmap *dst,
+                            gp_coord x_dst, gp_coord y_dst,
+                            const gp_filter_tables *const tables,
+                            gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return apply_tables_xRGB8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return apply_tables_RGBA8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return apply_tables_RGB888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return apply_tables_BGR888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return apply_tables_RGB555(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return apply_tables_RGB565(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return apply_tables_RGB666(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return apply_tables_RGB332(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return apply_tables_CMYK8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G1:
+		return apply_tables_G1(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G2:
+		return apply_tables_G2(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G4:
+		return apply_tables_G4(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G8:
+		return apply_tables_G8(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return apply_tables_GA88(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G16:
+		return apply_tables_G16(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return apply_tables_RGBA8888_PM(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return apply_tables_RGB161616(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return apply_tables_RGBA16161616(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+struct apply_tables_priv {
+	const gp_pixmap *src;
+	gp_coord x_src;
+	gp_coord y_src;
+	gp_pixmap *dst;
+	gp_coord x_dst;
+	gp_coord y_dst;
+	const gp_filter_tables *tables;
+};
+
+static int apply_tables_tile(const gp_tile *tile, void *ppriv,
+                           gp_progress_cb *callback)
+{
+	struct apply_tables_priv *priv = ppriv;
+
+	return apply_tables_raw(priv->src, priv->x_src + tile->x,
+	                      priv->y_src + tile->y, tile->w, tile->h,
+	                      priv->dst, priv->x_dst + tile->x,
+	                      priv->y_dst + tile->y, priv->tables, callback);
+}
+
+static int apply_tables_mp(const gp_pixmap *src,
+                         gp_coord x_src, gp_coord y_src,
+                         gp_size w_src, gp_size h_src,
+                         gp_pixmap *dst,
+                         gp_coord x_dst, gp_coord y_dst, const gp_filter_tables *tables,
+                         gp_progress_cb *callback)
+{
+	struct apply_tables_priv priv = {
+		.src = src,
+		.x_src = x_src,
+		.y_src = y_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+		.tables = tables,
+	};
+
+	gp_tiles tiles = {
+		.w = w_src,
+		.h = h_src,
+		.bpp = gp_pixel_size(src->pixel_type),
+		.name = "apply_tables",
+		.pixel_type = src->pixel_type,
+		.fn = apply_tables_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	return gp_tiles_run(&tiles);
+}
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return apply_tables_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, tables, callback);
+}
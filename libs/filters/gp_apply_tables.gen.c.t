@@ -8,10 +8,13 @@
 #include <errno.h>
 
 #include <core/gp_pixmap.h>
-#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_temp_alloc.h>
 #include <core/gp_debug.h>
+#include <core/gp_threads.h>
 
 #include <filters/gp_apply_tables.h>
+@ include thread_dispatcher.t
 
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -27,34 +30,33 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 	unsigned int x, y;
 
+	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * w_src * sizeof(int));
+
+	int *const row[] = {
 @         for c in pt.chanslist:
-	gp_pixel {{ c.name }};
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
 @         end
+	};
 
 	for (y = 0; y < h_src; y++) {
-		for (x = 0; x < w_src; x++) {
-			unsigned int src_x = x_src + x;
-			unsigned int src_y = y_src + y;
-			unsigned int dst_x = x_dst + x;
-			unsigned int dst_y = y_dst + y;
+		gp_pixel_row_unpack_{{ pt.name }}(src, x_src, y_src + y, w_src, row);
 
-			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, src_x, src_y);
+@         for i, c in enumerate(pt.chanslist):
+		for (x = 0; x < w_src; x++)
+			row[{{ i }}][x] = tables->table[{{ c.idx }}][row[{{ i }}][x]];
 
-@         for c in pt.chanslist:
-			{{ c.name }} = GP_PIXEL_GET_{{ c[0] }}_{{ pt.name }}(pix);
-			{{ c.name }} = tables->table[{{ c.idx }}][{{ c.name }}];
 @         end
-
-			pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }});
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, dst_x, dst_y, pix);
-		}
+		gp_pixel_row_pack_{{ pt.name }}(dst, x_dst, y_dst + y, w_src, row);
 
 		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
 			errno = ECANCELED;
 			return 1;
 		}
 	}
 
+	gp_temp_alloc_free(temp);
+
 	gp_progress_cb_done(callback);
 
 	return 0;
@@ -62,17 +64,14 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 @ end
 @
-int gp_filter_tables_apply(const gp_pixmap *const src,
-                           gp_coord x_src, gp_coord y_src,
-                           gp_size w_src, gp_size h_src,
-                           gp_pixmap *dst,
-                           gp_coord x_dst, gp_coord y_dst,
-                           const gp_filter_tables *const tables,
-                           gp_progress_cb *callback)
+static int apply_tables_raw(const gp_pixmap *const src,
+                            gp_coord x_src, gp_coord y_src,
+                            gp_size w_src, gp_size h_src,
+                            gp_pixmap *dst,
+                            gp_coord x_dst, gp_coord y_dst,
+                            const gp_filter_tables *const tables,
+                            gp_progress_cb *callback)
 {
-	GP_ASSERT(src->pixel_type == dst->pixel_type);
-	//TODO: Assert size
-
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -88,3 +87,23 @@ int gp_filter_tables_apply(const gp_pixmap *const src,
 		return -1;
 	}
 }
+
+{@ dispatcher('apply_tables', [('const gp_filter_tables *', 'tables')]) @}
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return apply_tables_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, tables, callback);
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_contrast.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:32 from gp_contrast.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Contrast Point filter
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_clamp.h>
+
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+
+#include <filters/gp_apply_tables.h>
+#include <filters/gp_point.h>
+
+int gp_filter_contrast_ex(const gp_pixmap *const src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               float p,
+                               gp_progress_cb *callback)
+{
+	const gp_pixel_type_desc *desc;
+	gp_filter_tables tables;
+	unsigned int i;
+	gp_pixel j;
+	int ret, err;
+
+	if (gp_filter_tables_init(&tables, src))
+		return 1;
+
+	desc = gp_pixel_desc(src->pixel_type);
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = tables.table[i];
+
+		for (j = 0; j < chan_max; j++)
+			table[j] = GP_CLAMP_GENERIC(((signed)j) * p + 0.5, 0, ((signed)chan_max - 1));
+	}
+
+	ret = gp_filter_tables_apply(src, x_src, y_src, w_src, h_src,
+	                             dst, x_dst, y_dst, &tables, callback);
+
+	err = errno;
+	gp_filter_tables_free(&tables);
+	errno = err;
+
+	return ret;
+}
+gp_pixmap *gp_filter_contrast_ex_alloc(const gp_pixmap *const src,
+                                            gp_coord x_src, gp_coord y_src,
+                                            gp_size w_src, gp_size h_src,
+                                            float p,
+                                            gp_progress_cb *callback)
+{
+	gp_pixmap *new = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (gp_filter_contrast_ex(src, x_src, y_src, w_src, h_src, new, 0, 0,
+	                               p,callback)) {
+		int err = errno;
+		gp_pixmap_free(new);
+		errno = err;
+		return NULL;
+	}
+
+	return new;
+}
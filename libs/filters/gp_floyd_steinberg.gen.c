@@ -0,0 +1,1347 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_floyd_steinberg.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:35 from gp_floyd_steinberg.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Floyd Steinberg dithering RGB888 -> any pixel
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include "core/gp_clamp.h"
+#include <filters/gp_filter.h>
+#include <filters/gp_dither.h>
+
+/*
+ * Floyd Steinberg to xRGB8888
+ */
+static int floyd_steinberg_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB888
+ */
+static int floyd_steinberg_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to BGR888
+ */
+static int floyd_steinberg_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_B[2][src->w];
+	float errors_G[2][src->w];
+	float errors_R[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB555
+ */
+static int floyd_steinberg_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB565
+ */
+static int floyd_steinberg_to_RGB565_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB666
+ */
+static int floyd_steinberg_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_LE(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB332
+ */
+static int floyd_steinberg_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G1
+ */
+static int floyd_steinberg_to_G1_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 1 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 1;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G2
+ */
+static int floyd_steinberg_to_G2_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 3 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 3;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G4
+ */
+static int floyd_steinberg_to_G4_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 15 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 15;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G8
+ */
+static int floyd_steinberg_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 255 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to GA88
+ */
+static int floyd_steinberg_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+	float errors_A[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+	memset(errors_A[0], 0, src->w * sizeof(float));
+	memset(errors_A[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 255 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			float val_A = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_A += errors_A[y%2][x];
+
+			float err_A = val_A;
+			gp_pixel res_A = 255 * val_A / (3 * 255);
+			err_A -= res_A * (3 * 255) / 255;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_A[y%2][x+1] += 7 * err_A / 16;
+
+			if (x > 1)
+				errors_A[!(y%2)][x-1] += 3 * err_A / 16;
+
+			errors_A[!(y%2)][x] += 5 * err_A / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_A[!(y%2)][x+1] += err_A / 16;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+		memset(errors_A[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to G16
+ */
+static int floyd_steinberg_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_V[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_V[0], 0, src->w * sizeof(float));
+	memset(errors_V[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                       GP_PIXEL_GET_G_RGB888(pix) +
+			                       GP_PIXEL_GET_B_RGB888(pix);
+			val_V += errors_V[y%2][x];
+
+			float err_V = val_V;
+			gp_pixel res_V = 65535 * val_V / (3 * 255);
+			err_V -= res_V * (3 * 255) / 65535;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[y%2][x+1] += 7 * err_V / 16;
+
+			if (x > 1)
+				errors_V[!(y%2)][x-1] += 3 * err_V / 16;
+
+			errors_V[!(y%2)][x] += 5 * err_V / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_V[!(y%2)][x+1] += err_V / 16;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x, y, res_V);
+		}
+
+		memset(errors_V[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Floyd Steinberg to RGB161616
+ */
+static int floyd_steinberg_to_RGB161616_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	float errors_R[2][src->w];
+	float errors_G[2][src->w];
+	float errors_B[2][src->w];
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB161616),
+		    src->w, src->h);
+
+	gp_coord x, y;
+
+	memset(errors_R[0], 0, src->w * sizeof(float));
+	memset(errors_R[1], 0, src->w * sizeof(float));
+	memset(errors_G[0], 0, src->w * sizeof(float));
+	memset(errors_G[1], 0, src->w * sizeof(float));
+	memset(errors_B[0], 0, src->w * sizeof(float));
+	memset(errors_B[1], 0, src->w * sizeof(float));
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			float val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += errors_R[y%2][x];
+
+			float err_R = val_R;
+			gp_pixel res_R = 65535 * val_R / 255;
+			err_R -= res_R * 255 / 65535;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[y%2][x+1] += 7 * err_R / 16;
+
+			if (x > 1)
+				errors_R[!(y%2)][x-1] += 3 * err_R / 16;
+
+			errors_R[!(y%2)][x] += 5 * err_R / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_R[!(y%2)][x+1] += err_R / 16;
+
+			GP_CLAMP_DOWN(res_R, 65535);
+			float val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += errors_G[y%2][x];
+
+			float err_G = val_G;
+			gp_pixel res_G = 65535 * val_G / 255;
+			err_G -= res_G * 255 / 65535;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[y%2][x+1] += 7 * err_G / 16;
+
+			if (x > 1)
+				errors_G[!(y%2)][x-1] += 3 * err_G / 16;
+
+			errors_G[!(y%2)][x] += 5 * err_G / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_G[!(y%2)][x+1] += err_G / 16;
+
+			GP_CLAMP_DOWN(res_G, 65535);
+			float val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += errors_B[y%2][x];
+
+			float err_B = val_B;
+			gp_pixel res_B = 65535 * val_B / 255;
+			err_B -= res_B * 255 / 65535;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[y%2][x+1] += 7 * err_B / 16;
+
+			if (x > 1)
+				errors_B[!(y%2)][x-1] += 3 * err_B / 16;
+
+			errors_B[!(y%2)][x] += 5 * err_B / 16;
+
+			if (x + 1 < (gp_coord)src->w)
+				errors_B[!(y%2)][x+1] += err_B / 16;
+
+			GP_CLAMP_DOWN(res_B, 65535);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB161616(res_R, res_G, res_B);
+
+			gp_putpixel_raw_48BPP(dst, x, y, res);
+		}
+
+		memset(errors_R[y%2], 0, src->w * sizeof(float));
+		memset(errors_G[y%2], 0, src->w * sizeof(float));
+		memset(errors_B[y%2], 0, src->w * sizeof(float));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                           gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return floyd_steinberg_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return floyd_steinberg_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return floyd_steinberg_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return floyd_steinberg_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return floyd_steinberg_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return floyd_steinberg_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return floyd_steinberg_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1:
+		return floyd_steinberg_to_G1_raw(src, dst, callback);
+	case GP_PIXEL_G2:
+		return floyd_steinberg_to_G2_raw(src, dst, callback);
+	case GP_PIXEL_G4:
+		return floyd_steinberg_to_G4_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return floyd_steinberg_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return floyd_steinberg_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return floyd_steinberg_to_G16_raw(src, dst, callback);
+	case GP_PIXEL_RGB161616:
+		return floyd_steinberg_to_RGB161616_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return floyd_steinberg(src, dst, callback);
+}
+
+
+gp_pixmap *gp_filter_floyd_steinberg_alloc(const gp_pixmap *src,
+                                           gp_pixel_type pixel_type,
+                                           gp_progress_cb *callback)
+{
+	gp_pixmap *ret;
+
+	ret = gp_pixmap_alloc(src->w, src->h, pixel_type);
+
+	if (ret == NULL)
+		return NULL;
+
+	if (floyd_steinberg(src, ret, callback)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
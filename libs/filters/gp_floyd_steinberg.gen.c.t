@@ -135,6 +135,9 @@ int gp_filter_floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
 	GP_CHECK(src->w <= dst->w);
 	GP_CHECK(src->h <= dst->h);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return floyd_steinberg(src, dst, callback);
 }
 
@@ -0,0 +1,1255 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_gaussian_noise.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:30 from gp_gaussian_noise.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Gaussian Noise
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_rand.h>
+#include <filters/gp_gaussian_noise.h>
+
+static int gaussian_noise_add_xRGB8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_xRGB8888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_xRGB8888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_xRGB8888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_xRGB8888(R[x], G[x], B[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGBA8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+	int sigma_A = 255 * sigma;
+	int mu_A = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+		gp_norm_int(A, size, sigma_A, mu_A);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGBA8888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_RGBA8888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_RGBA8888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+			A[x] += GP_PIXEL_GET_A_RGBA8888(pix);
+			A[x] = GP_CLAMP(A[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGBA8888(R[x], G[x], B[x], A[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_RGB888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_RGB888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGB888(R[x], G[x], B[x]);
+			gp_putpixel_raw_24BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_BGR888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(B, size, sigma_B, mu_B);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(R, size, sigma_R, mu_R);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x + x_src, y + y_src);
+
+			B[x] += GP_PIXEL_GET_B_BGR888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_BGR888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			R[x] += GP_PIXEL_GET_R_BGR888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_BGR888(B[x], G[x], R[x]);
+			gp_putpixel_raw_24BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB555(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 31 * sigma;
+	int mu_R = 31 * mu;
+	int sigma_G = 31 * sigma;
+	int mu_G = 31 * mu;
+	int sigma_B = 31 * sigma;
+	int mu_B = 31 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB555(pix);
+			R[x] = GP_CLAMP(R[x], 0, 31);
+			G[x] += GP_PIXEL_GET_G_RGB555(pix);
+			G[x] = GP_CLAMP(G[x], 0, 31);
+			B[x] += GP_PIXEL_GET_B_RGB555(pix);
+			B[x] = GP_CLAMP(B[x], 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB555(R[x], G[x], B[x]);
+			gp_putpixel_raw_16BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB565(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 31 * sigma;
+	int mu_R = 31 * mu;
+	int sigma_G = 63 * sigma;
+	int mu_G = 63 * mu;
+	int sigma_B = 31 * sigma;
+	int mu_B = 31 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB565(pix);
+			R[x] = GP_CLAMP(R[x], 0, 31);
+			G[x] += GP_PIXEL_GET_G_RGB565(pix);
+			G[x] = GP_CLAMP(G[x], 0, 63);
+			B[x] += GP_PIXEL_GET_B_RGB565(pix);
+			B[x] = GP_CLAMP(B[x], 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB565(R[x], G[x], B[x]);
+			gp_putpixel_raw_16BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB666(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 63 * sigma;
+	int mu_R = 63 * mu;
+	int sigma_G = 63 * sigma;
+	int mu_G = 63 * mu;
+	int sigma_B = 63 * sigma;
+	int mu_B = 63 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB666(pix);
+			R[x] = GP_CLAMP(R[x], 0, 63);
+			G[x] += GP_PIXEL_GET_G_RGB666(pix);
+			G[x] = GP_CLAMP(G[x], 0, 63);
+			B[x] += GP_PIXEL_GET_B_RGB666(pix);
+			B[x] = GP_CLAMP(B[x], 0, 63);
+
+			pix = GP_PIXEL_CREATE_RGB666(R[x], G[x], B[x]);
+			gp_putpixel_raw_18BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB332(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 7 * sigma;
+	int mu_R = 7 * mu;
+	int sigma_G = 7 * sigma;
+	int mu_G = 7 * mu;
+	int sigma_B = 3 * sigma;
+	int mu_B = 3 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB332(pix);
+			R[x] = GP_CLAMP(R[x], 0, 7);
+			G[x] += GP_PIXEL_GET_G_RGB332(pix);
+			G[x] = GP_CLAMP(G[x], 0, 7);
+			B[x] += GP_PIXEL_GET_B_RGB332(pix);
+			B[x] = GP_CLAMP(B[x], 0, 3);
+
+			pix = GP_PIXEL_CREATE_RGB332(R[x], G[x], B[x]);
+			gp_putpixel_raw_8BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_CMYK8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_K = 255 * sigma;
+	int mu_K = 255 * mu;
+	int sigma_Y = 255 * sigma;
+	int mu_Y = 255 * mu;
+	int sigma_M = 255 * sigma;
+	int mu_M = 255 * mu;
+	int sigma_C = 255 * sigma;
+	int mu_C = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *K = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *Y = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *M = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *C = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(K, size, sigma_K, mu_K);
+		gp_norm_int(Y, size, sigma_Y, mu_Y);
+		gp_norm_int(M, size, sigma_M, mu_M);
+		gp_norm_int(C, size, sigma_C, mu_C);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			K[x] += GP_PIXEL_GET_K_CMYK8888(pix);
+			K[x] = GP_CLAMP(K[x], 0, 255);
+			Y[x] += GP_PIXEL_GET_Y_CMYK8888(pix);
+			Y[x] = GP_CLAMP(Y[x], 0, 255);
+			M[x] += GP_PIXEL_GET_M_CMYK8888(pix);
+			M[x] = GP_CLAMP(M[x], 0, 255);
+			C[x] += GP_PIXEL_GET_C_CMYK8888(pix);
+			C[x] = GP_CLAMP(C[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_CMYK8888(K[x], Y[x], M[x], C[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G1(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 1 * sigma;
+	int mu_V = 1 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G1(pix);
+			V[x] = GP_CLAMP(V[x], 0, 1);
+
+			pix = GP_PIXEL_CREATE_G1(V[x]);
+			gp_putpixel_raw_1BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G2(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 3 * sigma;
+	int mu_V = 3 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G2(pix);
+			V[x] = GP_CLAMP(V[x], 0, 3);
+
+			pix = GP_PIXEL_CREATE_G2(V[x]);
+			gp_putpixel_raw_2BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G4(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 15 * sigma;
+	int mu_V = 15 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G4(pix);
+			V[x] = GP_CLAMP(V[x], 0, 15);
+
+			pix = GP_PIXEL_CREATE_G4(V[x]);
+			gp_putpixel_raw_4BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G8(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 255 * sigma;
+	int mu_V = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G8(pix);
+			V[x] = GP_CLAMP(V[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_G8(V[x]);
+			gp_putpixel_raw_8BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_GA88(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 255 * sigma;
+	int mu_V = 255 * mu;
+	int sigma_A = 255 * sigma;
+	int mu_A = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 2);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+		gp_norm_int(A, size, sigma_A, mu_A);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_GA88(pix);
+			V[x] = GP_CLAMP(V[x], 0, 255);
+			A[x] += GP_PIXEL_GET_A_GA88(pix);
+			A[x] = GP_CLAMP(A[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_GA88(V[x], A[x]);
+			gp_putpixel_raw_16BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G16(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_V = 65535 * sigma;
+	int mu_V = 65535 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(V, size, sigma_V, mu_V);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G16(pix);
+			V[x] = GP_CLAMP(V[x], 0, 65535);
+
+			pix = GP_PIXEL_CREATE_G16(V[x]);
+			gp_putpixel_raw_16BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGBA8888_PM(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+	int sigma_A = 255 * sigma;
+	int mu_A = 255 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+		gp_norm_int(A, size, sigma_A, mu_A);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGBA8888_PM(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_RGBA8888_PM(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_RGBA8888_PM(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+			A[x] += GP_PIXEL_GET_A_RGBA8888_PM(pix);
+			A[x] = GP_CLAMP(A[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGBA8888_PM(R[x], G[x], B[x], A[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB161616(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 65535 * sigma;
+	int mu_R = 65535 * mu;
+	int sigma_G = 65535 * sigma;
+	int mu_G = 65535 * mu;
+	int sigma_B = 65535 * sigma;
+	int mu_B = 65535 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_48BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB161616(pix);
+			R[x] = GP_CLAMP(R[x], 0, 65535);
+			G[x] += GP_PIXEL_GET_G_RGB161616(pix);
+			G[x] = GP_CLAMP(G[x], 0, 65535);
+			B[x] += GP_PIXEL_GET_B_RGB161616(pix);
+			B[x] = GP_CLAMP(B[x], 0, 65535);
+
+			pix = GP_PIXEL_CREATE_RGB161616(R[x], G[x], B[x]);
+			gp_putpixel_raw_48BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGBA16161616(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	int sigma_R = 65535 * sigma;
+	int mu_R = 65535 * mu;
+	int sigma_G = 65535 * sigma;
+	int mu_G = 65535 * mu;
+	int sigma_B = 65535 * sigma;
+	int mu_B = 65535 * mu;
+	int sigma_A = 65535 * sigma;
+	int mu_A = 65535 * mu;
+
+	unsigned int size = w_src + w_src%2;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		gp_norm_int(R, size, sigma_R, mu_R);
+		gp_norm_int(G, size, sigma_G, mu_G);
+		gp_norm_int(B, size, sigma_B, mu_B);
+		gp_norm_int(A, size, sigma_A, mu_A);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_64BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGBA16161616(pix);
+			R[x] = GP_CLAMP(R[x], 0, 65535);
+			G[x] += GP_PIXEL_GET_G_RGBA16161616(pix);
+			G[x] = GP_CLAMP(G[x], 0, 65535);
+			B[x] += GP_PIXEL_GET_B_RGBA16161616(pix);
+			B[x] = GP_CLAMP(B[x], 0, 65535);
+			A[x] += GP_PIXEL_GET_A_RGBA16161616(pix);
+			A[x] = GP_CLAMP(A[x], 0, 65535);
+
+			pix = GP_PIXEL_CREATE_RGBA16161616(R[x], G[x], B[x], A[x]);
+			gp_putpixel_raw_64BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float sigma, float mu,
+                                     gp_progress_cb *callback)
+{
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return gaussian_noise_add_xRGB8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return gaussian_noise_add_RGBA8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return gaussian_noise_add_RGB888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return gaussian_noise_add_BGR888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return gaussian_noise_add_RGB555(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return gaussian_noise_add_RGB565(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return gaussian_noise_add_RGB666(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return gaussian_noise_add_RGB332(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return gaussian_noise_add_CMYK8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_G1:
+		return gaussian_noise_add_G1(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_G2:
+		return gaussian_noise_add_G2(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_G4:
+		return gaussian_noise_add_G4(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_G8:
+		return gaussian_noise_add_G8(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return gaussian_noise_add_GA88(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_G16:
+		return gaussian_noise_add_G16(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return gaussian_noise_add_RGBA8888_PM(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return gaussian_noise_add_RGB161616(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return gaussian_noise_add_RGBA16161616(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+int gp_filter_gaussian_noise_add_ex(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float sigma, float mu,
+                                    gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	/* Source is large enough */
+	GP_CHECK(x_src + w_src <= src->w);
+	GP_CHECK(y_src + h_src <= src->h);
+
+	return gp_filter_gaussian_noise_add_raw(src, x_src, y_src, w_src, h_src,
+	                                        dst, x_dst, y_dst,
+	                                        sigma, mu, callback);
+}
+
+gp_pixmap *gp_filter_gaussian_noise_add_ex_alloc(const gp_pixmap *src,
+                                                 gp_coord x_src, gp_coord y_src,
+                                                 gp_size w_src, gp_size h_src,
+                                                 float sigma, float mu,
+                                                 gp_progress_cb *callback)
+{
+	int ret, err;
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = gp_filter_gaussian_noise_add_raw(src, x_src, y_src, w_src, h_src,
+	                                      dst, 0, 0, sigma, mu, callback);
+
+	if (ret) {
+		err = errno;
+		gp_pixmap_free(dst);
+		errno = err;
+		return NULL;
+	}
+
+	return dst;
+}
@@ -86,6 +86,9 @@ int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
                                      float sigma, float mu,
                                      gp_progress_cb *callback)
 {
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -0,0 +1,1062 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_hilbert_peano.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:35 from gp_hilbert_peano.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Hilbert Peano dithering RGB888 -> any pixel
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <filters/gp_hilbert_curve.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_dither.h>
+
+/*
+ * Returns closest greater square of two, used to determine the curve size.
+ */
+static unsigned int count_bits(unsigned int n)
+{
+	unsigned int i = 0, s = n;
+
+	do {
+		n>>=1;
+		i++;
+	} while (n);
+
+	i--;
+
+	return (i + (s != (1U<<i)));
+}
+
+/*
+ * Hilbert Peano to xRGB8888
+ */
+static int hilbert_peano_to_xRGB8888_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (255 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 255;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (255 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 255;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (255 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 255;
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB888
+ */
+static int hilbert_peano_to_RGB888_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (255 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 255;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (255 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 255;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (255 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 255;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to BGR888
+ */
+static int hilbert_peano_to_BGR888_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_B = 0;
+	int err_G = 0;
+	int err_R = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (255 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 255;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (255 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 255;
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (255 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 255;
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_B = 0;
+			err_G = 0;
+			err_R = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB555
+ */
+static int hilbert_peano_to_RGB555_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (31 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 31;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (31 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 31;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (31 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 31;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB565
+ */
+static int hilbert_peano_to_RGB565_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (31 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 31;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (63 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 63;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (31 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 31;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB666
+ */
+static int hilbert_peano_to_RGB666_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (63 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 63;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (63 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 63;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (63 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 63;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_LE(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB332
+ */
+static int hilbert_peano_to_RGB332_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (7 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 7;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (7 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 7;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (3 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 3;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to G1
+ */
+static int hilbert_peano_to_G1_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (1 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 1;
+
+			gp_putpixel_raw_1BPP_LE(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to G2
+ */
+static int hilbert_peano_to_G2_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (3 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 3;
+
+			gp_putpixel_raw_2BPP_LE(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to G4
+ */
+static int hilbert_peano_to_G4_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (15 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 15;
+
+			gp_putpixel_raw_4BPP_LE(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to G8
+ */
+static int hilbert_peano_to_G8_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (255 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 255;
+
+			gp_putpixel_raw_8BPP(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to GA88
+ */
+static int hilbert_peano_to_GA88_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+	int err_A = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (255 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 255;
+			int pix_A = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_A += err_A;
+
+			int res_A = (255 * pix_A + 382) / 765;
+			err_A = pix_A - 765 * res_A / 255;
+
+			gp_putpixel_raw_16BPP(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+			err_A = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to G16
+ */
+static int hilbert_peano_to_G16_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_V = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_V = GP_PIXEL_GET_R_RGB888(pix) +
+			                     GP_PIXEL_GET_G_RGB888(pix) +
+			                     GP_PIXEL_GET_B_RGB888(pix);
+			pix_V += err_V;
+
+			int res_V = (65535 * pix_V + 382) / 765;
+			err_V = pix_V - 765 * res_V / 65535;
+
+			gp_putpixel_raw_16BPP(dst, state.x, state.y, res_V);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_V = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Hilbert Peano to RGB161616
+ */
+static int hilbert_peano_to_RGB161616_raw(const gp_pixmap *src,
+                                              gp_pixmap *dst,
+                                              gp_progress_cb *callback)
+{
+	gp_curve_state state;
+	unsigned int n;
+
+	n = GP_MAX(count_bits(src->w), count_bits(src->h));
+
+	GP_DEBUG(1, "Hilbert Peano dithering %ux%u -> n = %u", src->w, src->h, n);
+
+	gp_hilbert_curve_init(&state, n);
+
+	/* processed pixels counter */
+	unsigned int cnt = 0;
+
+	/* error counters */
+	int err_R = 0;
+	int err_G = 0;
+	int err_B = 0;
+
+	while (gp_hilbert_curve_continues(&state)) {
+		if (state.x < src->w && state.y < src->h) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, state.x, state.y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			int pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R += err_R;
+
+			int res_R = (65535 * pix_R + 127) / 255;
+			err_R = pix_R - 255 * res_R / 65535;
+			int pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G += err_G;
+
+			int res_G = (65535 * pix_G + 127) / 255;
+			err_G = pix_G - 255 * res_G / 65535;
+			int pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B += err_B;
+
+			int res_B = (65535 * pix_B + 127) / 255;
+			err_B = pix_B - 255 * res_B / 65535;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB161616(res_R, res_G, res_B);
+
+			gp_putpixel_raw_48BPP(dst, state.x, state.y, res);
+			cnt++;
+
+			if (gp_progress_cb_report(callback, cnt/src->h, src->w, src->h))
+				return 1;
+
+			/* We are done, exit */
+			if (cnt == src->w * src->h - 1) {
+				gp_progress_cb_done(callback);
+				return 0;
+			}
+		} else {
+			err_R = 0;
+			err_G = 0;
+			err_B = 0;
+		}
+
+		gp_hilbert_curve_next(&state);
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int hilbert_peano(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return hilbert_peano_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return hilbert_peano_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return hilbert_peano_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return hilbert_peano_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565:
+		return hilbert_peano_to_RGB565_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return hilbert_peano_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return hilbert_peano_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1:
+		return hilbert_peano_to_G1_raw(src, dst, callback);
+	case GP_PIXEL_G2:
+		return hilbert_peano_to_G2_raw(src, dst, callback);
+	case GP_PIXEL_G4:
+		return hilbert_peano_to_G4_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return hilbert_peano_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return hilbert_peano_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return hilbert_peano_to_G16_raw(src, dst, callback);
+	case GP_PIXEL_RGB161616:
+		return hilbert_peano_to_RGB161616_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_hilbert_peano(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return hilbert_peano(src, dst, callback);
+}
+
+gp_pixmap *gp_filter_hilbert_peano_alloc(const gp_pixmap *src,
+                                         gp_pixel_type pixel_type,
+                                         gp_progress_cb *callback)
+{
+	gp_pixmap *ret;
+
+	ret = gp_pixmap_alloc(src->w, src->h, pixel_type);
+
+	if (ret == NULL)
+		return NULL;
+
+	if (hilbert_peano(src, ret, callback)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
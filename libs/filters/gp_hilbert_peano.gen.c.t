@@ -142,6 +142,9 @@ int gp_filter_hilbert_peano(const gp_pixmap *src, gp_pixmap *dst,
 	GP_CHECK(src->w <= dst->w);
 	GP_CHECK(src->h <= dst->h);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return hilbert_peano(src, dst, callback);
 }
 
@@ -0,0 +1,5273 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_linear_convolution.gen.c
+ *
+ * GENERATED on 2026 10 17 02:02:05 from gp_linear_convolution.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Linear Convolution
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+#include <filters/gp_linear.h>
+
+#define MUL 1024
+
+/*
+ * Computes one dimensional convolution of the src buffer with kw long kernel
+ * as dst[x] = MUL/2 + sum(src[x + i] * kernel[i]). The loops are ordered so
+ * that the inner loop runs over the whole row and vectorizes well.
+ */
+GP_SIMD_BODY void conv_row_body(int *restrict dst, const int *restrict src,
+                                const int *kernel, uint32_t kw, gp_size w)
+{
+	gp_size x;
+	uint32_t i;
+
+	for (x = 0; x < w; x++)
+		dst[x] = MUL/2;
+
+	for (i = 0; i < kw; i++) {
+		const int *s = src + i;
+		int k = kernel[i];
+
+		for (x = 0; x < w; x++)
+			dst[x] += s[x] * k;
+	}
+}
+
+GP_SIMD_VARIANT
+static void conv_row_generic(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	conv_row_body(dst, src, kernel, kw, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void conv_row_sse2(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	conv_row_body(dst, src, kernel, kw, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void conv_row_avx2(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	conv_row_body(dst, src, kernel, kw, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void conv_row_neon(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	conv_row_body(dst, src, kernel, kw, w);
+}
+#endif
+
+static void conv_row_resolve(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w);
+
+static void (*conv_row_fn)(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w) = conv_row_resolve;
+
+static void conv_row_resolve(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w) = conv_row_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = conv_row_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = conv_row_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = conv_row_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of conv_row()", variant);
+
+	__atomic_store_n(&conv_row_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, kernel, kw, w);
+}
+
+static inline void conv_row(int *restrict dst, const int *restrict src, const int *kernel, uint32_t kw, gp_size w)
+{
+	__atomic_load_n(&conv_row_fn, __ATOMIC_RELAXED)(dst, src, kernel, kw, w);
+}
+
+/*
+ * Multiply and accumulate, dst[x] += src[x] * k.
+ */
+GP_SIMD_BODY void mac_row_body(int *restrict dst, const int *restrict src,
+                               int k, gp_size w)
+{
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		dst[x] += src[x] * k;
+}
+
+GP_SIMD_VARIANT
+static void mac_row_generic(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	mac_row_body(dst, src, k, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void mac_row_sse2(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	mac_row_body(dst, src, k, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void mac_row_avx2(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	mac_row_body(dst, src, k, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void mac_row_neon(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	mac_row_body(dst, src, k, w);
+}
+#endif
+
+static void mac_row_resolve(int *restrict dst, const int *restrict src, int k, gp_size w);
+
+static void (*mac_row_fn)(int *restrict dst, const int *restrict src, int k, gp_size w) = mac_row_resolve;
+
+static void mac_row_resolve(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(int *restrict dst, const int *restrict src, int k, gp_size w) = mac_row_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = mac_row_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = mac_row_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = mac_row_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of mac_row()", variant);
+
+	__atomic_store_n(&mac_row_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, k, w);
+}
+
+static inline void mac_row(int *restrict dst, const int *restrict src, int k, gp_size w)
+{
+	__atomic_load_n(&mac_row_fn, __ATOMIC_RELAXED)(dst, src, k, w);
+}
+
+static void div_clamp(int *buf, int div, int max, gp_size w)
+{
+	gp_size x;
+
+	for (x = 0; x < w; x++) {
+		int val = buf[x] / div;
+
+		buf[x] = GP_CLAMP(val, 0, max);
+	}
+}
+
+/*
+ * Unpacks size pixels starting at x in row y, pixels outside of the source
+ * image are replaced by the nearest border pixel.
+ */
+static void unpack_border(gp_pixel_row_unpack_fn *unpack, unsigned int chans,
+                          const gp_pixmap *src, gp_coord x, gp_coord y,
+                          gp_size size, int *const bufs[])
+{
+	gp_coord l = GP_CLAMP(-x, 0, (gp_coord)size);
+	gp_coord r = GP_CLAMP(x + (gp_coord)size - (gp_coord)src->w, 0, (gp_coord)size);
+	gp_coord n = size - l - r;
+	int *shifted[GP_PIXELTYPE_MAX_CHANNELS];
+	unsigned int c;
+	gp_coord i;
+
+	if (n <= 0) {
+		unpack(src, x < 0 ? 0 : (gp_coord)src->w - 1, y, 1, bufs);
+
+		for (c = 0; c < chans; c++) {
+			for (i = 1; i < (gp_coord)size; i++)
+				bufs[c][i] = bufs[c][0];
+		}
+
+		return;
+	}
+
+	for (c = 0; c < chans; c++)
+		shifted[c] = bufs[c] + l;
+
+	unpack(src, x + l, y, n, shifted);
+
+	for (c = 0; c < chans; c++) {
+		for (i = 0; i < l; i++)
+			bufs[c][i] = bufs[c][l];
+
+		for (i = l + n; i < (gp_coord)size; i++)
+			bufs[c][i] = bufs[c][l + n - 1];
+	}
+}
+
+/* Width of the column strips for vertical convolution */
+#define V_STRIP 512
+
+
+static int h_lin_conv_xRGB8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_xRGB8888, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_xRGB8888(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGBA8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGBA8888, 4,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+		conv_row(sums[3], row[3], ikernel, kw, w_src);
+		div_clamp(sums[3], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_RGBA8888(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB888, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_RGB888(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_BGR888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_BGR888, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_BGR888(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB555, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 31, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 31, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 31, w_src);
+
+		gp_pixel_row_pack_RGB555(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB565, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 31, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 63, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 31, w_src);
+
+		gp_pixel_row_pack_RGB565(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB666, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 63, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 63, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 63, w_src);
+
+		gp_pixel_row_pack_RGB666(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB332, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 7, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 7, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 3, w_src);
+
+		gp_pixel_row_pack_RGB332(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_CMYK8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_CMYK8888, 4,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+		conv_row(sums[3], row[3], ikernel, kw, w_src);
+		div_clamp(sums[3], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_CMYK8888(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G1(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_G1, 1,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 1, w_src);
+
+		gp_pixel_row_pack_G1(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G2(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_G2, 1,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 3, w_src);
+
+		gp_pixel_row_pack_G2(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G4(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_G4, 1,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 15, w_src);
+
+		gp_pixel_row_pack_G4(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G8(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_G8, 1,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_G8(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_GA88(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 2 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_GA88, 2,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_GA88(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_G16, 1,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 65535, w_src);
+
+		gp_pixel_row_pack_G16(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGBA8888_PM(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGBA8888_PM, 4,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 255, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 255, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 255, w_src);
+		conv_row(sums[3], row[3], ikernel, kw, w_src);
+		div_clamp(sums[3], ikern_div, 255, w_src);
+
+		gp_pixel_row_pack_RGBA8888_PM(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB161616(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGB161616, 3,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 65535, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 65535, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 65535, w_src);
+
+		gp_pixel_row_pack_RGB161616(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGBA16161616(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * (size + w_src) * sizeof(int));
+
+	int *const row[] = {
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+		gp_temp_alloc_get(temp, size * sizeof(int)),
+	};
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_RGBA16161616, 4,
+		              src, x_src - kw/2, yi, size, row);
+
+		/* count the pixel values from neighbours weighted by kernel */
+		conv_row(sums[0], row[0], ikernel, kw, w_src);
+		div_clamp(sums[0], ikern_div, 65535, w_src);
+		conv_row(sums[1], row[1], ikernel, kw, w_src);
+		div_clamp(sums[1], ikern_div, 65535, w_src);
+		conv_row(sums[2], row[2], ikernel, kw, w_src);
+		div_clamp(sums[2], ikern_div, 65535, w_src);
+		conv_row(sums[3], row[3], ikernel, kw, w_src);
+		div_clamp(sums[3], ikern_div, 65535, w_src);
+
+		gp_pixel_row_pack_RGBA16161616(dst, x_dst, y_dst + y, w_src, sums);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_hlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kw, float kern_div,
+				      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Horizontal linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u",
+		    kw, x_src, y_src, w_src, h_src);
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return h_lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return h_lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return h_lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return h_lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return h_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return h_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return h_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return h_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return h_lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G1:
+		return h_lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return h_lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return h_lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return h_lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return h_lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return h_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return h_lin_conv_RGBA8888_PM(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return h_lin_conv_RGB161616(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return h_lin_conv_RGBA16161616(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int v_lin_conv_xRGB8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_xRGB8888, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_xRGB8888(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 4 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+				memcpy(rows[slot][3], rows[last_slot][3], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGBA8888, 4,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[3][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[3], rows[(yd + j) % kh][3], ikernel[j], sw);
+
+			div_clamp(sums[3], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_RGBA8888(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB888, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_RGB888(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_BGR888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_BGR888, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_BGR888(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB555, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 31, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 31, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 31, sw);
+
+			gp_pixel_row_pack_RGB555(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB565, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 31, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 63, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 31, sw);
+
+			gp_pixel_row_pack_RGB565(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB666, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 63, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 63, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 63, sw);
+
+			gp_pixel_row_pack_RGB666(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB332, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 7, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 7, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 3, sw);
+
+			gp_pixel_row_pack_RGB332(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_CMYK8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 4 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+				memcpy(rows[slot][3], rows[last_slot][3], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_CMYK8888, 4,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[3][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[3], rows[(yd + j) % kh][3], ikernel[j], sw);
+
+			div_clamp(sums[3], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_CMYK8888(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G1(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 1 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_G1, 1,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 1, sw);
+
+			gp_pixel_row_pack_G1(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G2(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 1 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_G2, 1,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 3, sw);
+
+			gp_pixel_row_pack_G2(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G4(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 1 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_G4, 1,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 15, sw);
+
+			gp_pixel_row_pack_G4(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G8(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 1 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_G8, 1,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_G8(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_GA88(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 2 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][2];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_GA88, 2,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_GA88(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 1 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_G16, 1,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 65535, sw);
+
+			gp_pixel_row_pack_G16(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA8888_PM(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 4 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+				memcpy(rows[slot][3], rows[last_slot][3], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGBA8888_PM, 4,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 255, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[3][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[3], rows[(yd + j) % kh][3], ikernel[j], sw);
+
+			div_clamp(sums[3], ikern_div, 255, sw);
+
+			gp_pixel_row_pack_RGBA8888_PM(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB161616(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 3 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGB161616, 3,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 65535, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 65535, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 65535, sw);
+
+			gp_pixel_row_pack_RGB161616(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA16161616(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i, j, cnt = 0;
+	int ikernel[kh], ikern_div;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, 4 * (kh + 1) * strip * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, strip * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, strip * sizeof(int));
+	}
+
+	int *const sums[] = {
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+				memcpy(rows[slot][0], rows[last_slot][0], sw * sizeof(int));
+				memcpy(rows[slot][1], rows[last_slot][1], sw * sizeof(int));
+				memcpy(rows[slot][2], rows[last_slot][2], sw * sizeof(int));
+				memcpy(rows[slot][3], rows[last_slot][3], sw * sizeof(int));
+			} else {
+				unpack_border(gp_pixel_row_unpack_RGBA16161616, 4,
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
+
+			last_yi = yi;
+			last_slot = slot;
+
+			if (y < (gp_coord)kh - 1)
+				continue;
+
+			gp_coord yd = y - kh + 1;
+
+			/* count the pixel values from neighbours weighted by kernel */
+			for (j = 0; j < sw; j++)
+				sums[0][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[0], rows[(yd + j) % kh][0], ikernel[j], sw);
+
+			div_clamp(sums[0], ikern_div, 65535, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[1][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[1], rows[(yd + j) % kh][1], ikernel[j], sw);
+
+			div_clamp(sums[1], ikern_div, 65535, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[2][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[2], rows[(yd + j) % kh][2], ikernel[j], sw);
+
+			div_clamp(sums[2], ikern_div, 65535, sw);
+
+			for (j = 0; j < sw; j++)
+				sums[3][j] = MUL/2;
+
+			for (j = 0; j < kh; j++)
+				mac_row(sums[3], rows[(yd + j) % kh][3], ikernel[j], sw);
+
+			div_clamp(sums[3], ikern_div, 65535, sw);
+
+			gp_pixel_row_pack_RGBA16161616(dst, x_dst + x, y_dst + yd, sw, sums);
+
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_vlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kh, float kern_div,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Vertical linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u",
+		    kh, x_src, y_src, w_src, h_src);
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return v_lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return v_lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return v_lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return v_lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return v_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return v_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return v_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return v_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return v_lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1:
+		return v_lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return v_lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return v_lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return v_lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return v_lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return v_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return v_lin_conv_RGBA8888_PM(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return v_lin_conv_RGB161616(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return v_lin_conv_RGBA16161616(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int lin_conv_xRGB8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_xRGB8888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_xRGB8888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_xRGB8888(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 4 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA8888, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA8888, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+					A_sum += row[3][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 255);
+			res[3][x] = GP_CLAMP((int)A_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGBA8888(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB888(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_BGR888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_BGR888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_BGR888, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float B_sum = 0;
+			float G_sum = 0;
+			float R_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					B_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					R_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			B_sum /= kern_div;
+			G_sum /= kern_div;
+			R_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)B_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)R_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_BGR888(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB555(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB555, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB555, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 31);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 31);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 31);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB555(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB565(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB565, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB565, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 31);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 63);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 31);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB565(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB666(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB666, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB666, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 63);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 63);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 63);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB666(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB332(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB332, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB332, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 7);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 7);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 3);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB332(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_CMYK8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 4 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_CMYK8888, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_CMYK8888, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float K_sum = 0;
+			float Y_sum = 0;
+			float M_sum = 0;
+			float C_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					K_sum += row[0][x + k] * kv;
+					Y_sum += row[1][x + k] * kv;
+					M_sum += row[2][x + k] * kv;
+					C_sum += row[3][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			K_sum /= kern_div;
+			Y_sum /= kern_div;
+			M_sum /= kern_div;
+			C_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)K_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)Y_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)M_sum, 0, 255);
+			res[3][x] = GP_CLAMP((int)C_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_CMYK8888(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G1(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 1 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G1, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G1, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 1);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_G1(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G2(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 1 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G2, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G2, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 3);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_G2(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G4(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 1 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G4, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G4, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 15);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_G4(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G8(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 1 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G8, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G8, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_G8(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_GA88(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 2 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][2];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_GA88, 2,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_GA88, 2,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+			float A_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+					A_sum += row[1][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)A_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_GA88(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G16(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 1 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][1];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G16, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_G16, 1,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					V_sum += row[0][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)V_sum, 0, 65535);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_G16(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA8888_PM(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 4 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA8888_PM, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA8888_PM, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+					A_sum += row[3][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 255);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 255);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 255);
+			res[3][x] = GP_CLAMP((int)A_sum, 0, 255);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGBA8888_PM(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB161616(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 3 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][3];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB161616, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGB161616, 3,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 65535);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 65535);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 65535);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGB161616(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA16161616(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
+
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, 4 * (kh * size + w_src) * sizeof(int));
+
+	int *rows[kh][4];
+
+	for (j = 0; j < kh; j++) {
+		rows[j][0] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][1] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][2] = gp_temp_alloc_get(temp, size * sizeof(int));
+		rows[j][3] = gp_temp_alloc_get(temp, size * sizeof(int));
+	}
+
+	int *const res[] = {
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
+	};
+
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA16161616, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
+
+		unpack_border(gp_pixel_row_unpack_RGBA16161616, 4,
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
+
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				for (j = 0; j < kh; j++) {
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+					R_sum += row[0][x + k] * kv;
+					G_sum += row[1][x + k] * kv;
+					B_sum += row[2][x + k] * kv;
+					A_sum += row[3][x + k] * kv;
+				}
+
+				if (++k >= kw)
+					k = 0;
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			res[0][x] = GP_CLAMP((int)R_sum, 0, 65535);
+			res[1][x] = GP_CLAMP((int)G_sum, 0, 65535);
+			res[2][x] = GP_CLAMP((int)B_sum, 0, 65535);
+			res[3][x] = GP_CLAMP((int)A_sum, 0, 65535);
+
+			k = k ? k - 1 : kw - 1;
+		}
+
+		gp_pixel_row_pack_RGBA16161616(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_linear_convolution_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float kernel[], uint32_t kw, uint32_t kh,
+                                     float kern_div, gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Linear convolution kernel %ix%i rectangle %ux%u",
+	            kw, kh, w_src, h_src);
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1:
+		return lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return lin_conv_RGBA8888_PM(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return lin_conv_RGB161616(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return lin_conv_RGBA16161616(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
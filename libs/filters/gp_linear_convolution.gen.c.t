@@ -6,17 +6,113 @@
  */
 
 #include <errno.h>
+#include <string.h>
 
 #include <core/gp_pixmap.h>
-#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
 #include <core/gp_temp_alloc.h>
 #include <core/gp_clamp.h>
 #include <core/gp_debug.h>
+#include <core/gp_cpu.h>
 
 #include <filters/gp_linear.h>
 
 #define MUL 1024
 
+@ include simd.t
+/*
+ * Computes one dimensional convolution of the src buffer with kw long kernel
+ * as dst[x] = MUL/2 + sum(src[x + i] * kernel[i]). The loops are ordered so
+ * that the inner loop runs over the whole row and vectorizes well.
+ */
+GP_SIMD_BODY void conv_row_body(int *restrict dst, const int *restrict src,
+                                const int *kernel, uint32_t kw, gp_size w)
+{
+	gp_size x;
+	uint32_t i;
+
+	for (x = 0; x < w; x++)
+		dst[x] = MUL/2;
+
+	for (i = 0; i < kw; i++) {
+		const int *s = src + i;
+		int k = kernel[i];
+
+		for (x = 0; x < w; x++)
+			dst[x] += s[x] * k;
+	}
+}
+
+{@ simd_function('void', 'conv_row', [('int *restrict', 'dst'), ('const int *restrict', 'src'), ('const int *', 'kernel'), ('uint32_t', 'kw'), ('gp_size', 'w')]) @}
+
+/*
+ * Multiply and accumulate, dst[x] += src[x] * k.
+ */
+GP_SIMD_BODY void mac_row_body(int *restrict dst, const int *restrict src,
+                               int k, gp_size w)
+{
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		dst[x] += src[x] * k;
+}
+
+{@ simd_function('void', 'mac_row', [('int *restrict', 'dst'), ('const int *restrict', 'src'), ('int', 'k'), ('gp_size', 'w')]) @}
+
+static void div_clamp(int *buf, int div, int max, gp_size w)
+{
+	gp_size x;
+
+	for (x = 0; x < w; x++) {
+		int val = buf[x] / div;
+
+		buf[x] = GP_CLAMP(val, 0, max);
+	}
+}
+
+/*
+ * Unpacks size pixels starting at x in row y, pixels outside of the source
+ * image are replaced by the nearest border pixel.
+ */
+static void unpack_border(gp_pixel_row_unpack_fn *unpack, unsigned int chans,
+                          const gp_pixmap *src, gp_coord x, gp_coord y,
+                          gp_size size, int *const bufs[])
+{
+	gp_coord l = GP_CLAMP(-x, 0, (gp_coord)size);
+	gp_coord r = GP_CLAMP(x + (gp_coord)size - (gp_coord)src->w, 0, (gp_coord)size);
+	gp_coord n = size - l - r;
+	int *shifted[GP_PIXELTYPE_MAX_CHANNELS];
+	unsigned int c;
+	gp_coord i;
+
+	if (n <= 0) {
+		unpack(src, x < 0 ? 0 : (gp_coord)src->w - 1, y, 1, bufs);
+
+		for (c = 0; c < chans; c++) {
+			for (i = 1; i < (gp_coord)size; i++)
+				bufs[c][i] = bufs[c][0];
+		}
+
+		return;
+	}
+
+	for (c = 0; c < chans; c++)
+		shifted[c] = bufs[c] + l;
+
+	unpack(src, x + l, y, n, shifted);
+
+	for (c = 0; c < chans; c++) {
+		for (i = 0; i < l; i++)
+			bufs[c][i] = bufs[c][l];
+
+		for (i = l + n; i < (gp_coord)size; i++)
+			bufs[c][i] = bufs[c][l + n - 1];
+	}
+}
+
+/* Width of the column strips for vertical convolution */
+#define V_STRIP 512
+
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 
@@ -28,7 +124,7 @@ static int h_lin_conv_{{ pt.name }}(const gp_pixmap *src,
 				    float kernel[], uint32_t kw, float kern_div,
 				    gp_progress_cb *callback)
 {
-	gp_coord x, y;
+	gp_coord y;
 	uint32_t i;
 	int ikernel[kw], ikern_div;
 	uint32_t size = w_src + kw - 1;
@@ -39,79 +135,35 @@ static int h_lin_conv_{{ pt.name }}(const gp_pixmap *src,
 	ikern_div = kern_div * MUL + 0.5;
 
 	/* Create temporary buffers */
-	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * size * sizeof(int));
-
-@         for c in pt.chanslist:
-	int *{{ c.name }} = gp_temp_alloc_get(temp, size * sizeof(int));
-@         end
-
-	/* Do horizontal linear convolution */
-	for (y = 0; y < (gp_coord)h_src; y++) {
-		int yi = GP_MIN(y_src + y, (int)src->h - 1);
-
-		/* Fetch the whole row */
-		gp_pixel pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, 0, yi);
-
-		int xi = x_src - kw/2;
-		i = 0;
+	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * (size + w_src) * sizeof(int));
 
-		/* Copy border pixel until the source image starts */
-		while (xi <= 0 && i < size) {
+	int *const row[] = {
 @         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+		gp_temp_alloc_get(temp, size * sizeof(int)),
 @         end
-			i++;
-			xi++;
-		}
-
-		/* Use as much source image pixels as possible */
-		while (xi < (int)src->w && i < size) {
-			pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, yi);
-
-@         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
-@         end
-
-			i++;
-			xi++;
-		}
+	};
 
-		/* Copy the rest the border pixel when we are out again */
-		while (i < size) {
+	int *const sums[] = {
 @         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
 @         end
+	};
 
-			i++;
-		}
-
-		for (x = 0; x < (gp_coord)w_src; x++) {
-@         for c in pt.chanslist:
-			int32_t {{ c.name }}_sum = MUL/2;
-			int *p{{ c.name }} = {{ c.name }} + x;
-@         end
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
 
-			/* count the pixel value from neighbours weighted by kernel */
-			for (i = 0; i < kw; i++) {
-@         for c in pt.chanslist:
-				{{ c.name }}_sum += (*p{{ c.name }}++) * ikernel[i];
-@         end
-			}
+		/* Fetch the row including the borders */
+		unpack_border(gp_pixel_row_unpack_{{ pt.name }}, {{ len(pt.chanslist) }},
+		              src, x_src - kw/2, yi, size, row);
 
-			/* divide the result */
-@         for c in pt.chanslist:
-			{{ c.name }}_sum /= ikern_div;
+		/* count the pixel values from neighbours weighted by kernel */
+@         for i, c in enumerate(pt.chanslist):
+		conv_row(sums[{{ i }}], row[{{ i }}], ikernel, kw, w_src);
+		div_clamp(sums[{{ i }}], ikern_div, {{ c.max }}, w_src);
 @         end
 
-			/* and clamp just to be extra sure */
-@         for c in pt.chanslist:
-			{{ c.name }}_sum = GP_CLAMP({{ c.name }}_sum, 0, {{ c.max }});
-@         end
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x_dst + x, y_dst + y,
-			                      GP_PIXEL_CREATE_{{ pt.name }}(
-					      {{ arr_to_params(pt.chan_names, "", "_sum") }}
-					      ));
-		}
+		gp_pixel_row_pack_{{ pt.name }}(dst, x_dst, y_dst + y, w_src, sums);
 
 		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
 			gp_temp_alloc_free(temp);
@@ -139,6 +191,9 @@ int gp_filter_hlinear_convolution_raw(const gp_pixmap *src,
 	            "offset %ix%i rectangle %ux%u",
 		    kw, x_src, y_src, w_src, h_src);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -166,95 +221,82 @@ static int v_lin_conv_{{ pt.name }}(const gp_pixmap *src,
                                     gp_progress_cb *callback)
 {
 	gp_coord x, y;
-	uint32_t i;
+	uint32_t i, j, cnt = 0;
 	int ikernel[kh], ikern_div;
-	uint32_t size = h_src + kh - 1;
+	gp_size strip = GP_MIN(w_src, (gp_size)V_STRIP);
+	gp_size strips = (w_src + strip - 1) / strip;
 
 	for (i = 0; i < kh; i++)
 		ikernel[i] = kernel[i] * MUL + 0.5;
 
 	ikern_div = kern_div * MUL + 0.5;
 
-	/* Create temporary buffers */
-	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * size * sizeof(int));
-
-@         for c in pt.chanslist:
-	int *{{ c.name }} = gp_temp_alloc_get(temp, size * sizeof(int));
-@         end
-
-	/* Do vertical linear convolution */
-	for (x = 0; x < (gp_coord)w_src; x++) {
-		int xi = GP_MIN(x_src + x, (int)src->w - 1);
-
-		/* Fetch the whole row */
-		gp_pixel pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, 0);
+	/* Create temporary buffers, kh source rows and a row of sums */
+	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * (kh + 1) * strip * sizeof(int));
 
-		int yi = y_src - kh/2;
-		i = 0;
+	int *rows[kh][{{ len(pt.chanslist) }}];
 
-		/* Copy border pixel until the source image starts */
-		while (yi <= 0 && i < size) {
-@         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+	for (j = 0; j < kh; j++) {
+@         for i, c in enumerate(pt.chanslist):
+		rows[j][{{ i }}] = gp_temp_alloc_get(temp, strip * sizeof(int));
 @         end
+	}
 
-			i++;
-			yi++;
-		}
-
-		/* Use as much source image pixels as possible */
-		while (yi < (int)src->h && i < size) {
-			pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, yi);
-
+	int *const sums[] = {
 @         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+		gp_temp_alloc_get(temp, strip * sizeof(int)),
 @         end
+	};
+
+	/*
+	 * Do vertical linear convolution in strips, the kh source rows for an
+	 * output row are kept in a ring buffer so that each source row is
+	 * unpacked only once per strip.
+	 */
+	for (x = 0; x < (gp_coord)w_src; x += strip) {
+		gp_size sw = GP_MIN(strip, w_src - x);
+		int last_yi = -1;
+		uint32_t last_slot = 0;
+
+		for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+			int yi = GP_CLAMP(y_src + y - (int)(kh/2), 0, (int)src->h - 1);
+			uint32_t slot = y % kh;
+
+			/* Fetch the next source row, the borders are repeated */
+			if (yi == last_yi) {
+@         for i, c in enumerate(pt.chanslist):
+				memcpy(rows[slot][{{ i }}], rows[last_slot][{{ i }}], sw * sizeof(int));
+@         end
+			} else {
+				unpack_border(gp_pixel_row_unpack_{{ pt.name }}, {{ len(pt.chanslist) }},
+				              src, x_src + x, yi, sw, rows[slot]);
+			}
 
-			i++;
-			yi++;
-		}
+			last_yi = yi;
+			last_slot = slot;
 
-		/* Copy the rest the border pixel when we are out again */
-		while (i < size) {
-@         for c in pt.chanslist:
-			{{ c.name }}[i] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
-@         end
+			if (y < (gp_coord)kh - 1)
+				continue;
 
-			i++;
-		}
+			gp_coord yd = y - kh + 1;
 
-		for (y = 0; y < (gp_coord)h_src; y++) {
-@         for c in pt.chanslist:
-			int32_t {{ c.name }}_sum = MUL/2;
-			int *p{{ c.name }} = {{ c.name }} + y;
-@         end
+			/* count the pixel values from neighbours weighted by kernel */
+@         for i, c in enumerate(pt.chanslist):
+			for (j = 0; j < sw; j++)
+				sums[{{ i }}][j] = MUL/2;
 
-			/* count the pixel value from neighbours weighted by kernel */
-			for (i = 0; i < kh; i++) {
-@         for c in pt.chanslist:
-				{{ c.name }}_sum += (*p{{ c.name }}++) * ikernel[i];
-@         end
-			}
+			for (j = 0; j < kh; j++)
+				mac_row(sums[{{ i }}], rows[(yd + j) % kh][{{ i }}], ikernel[j], sw);
 
-			/* divide the result */
-@         for c in pt.chanslist:
-			{{ c.name }}_sum /= ikern_div;
-@         end
+			div_clamp(sums[{{ i }}], ikern_div, {{ c.max }}, sw);
 
-			/* and clamp just to be extra sure */
-@         for c in pt.chanslist:
-			{{ c.name }}_sum = GP_CLAMP({{ c.name }}_sum, 0, {{ c.max }});
 @         end
+			gp_pixel_row_pack_{{ pt.name }}(dst, x_dst + x, y_dst + yd, sw, sums);
 
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x_dst + x, y_dst + y,
-			                      GP_PIXEL_CREATE_{{ pt.name }}(
-					      {{ arr_to_params(pt.chan_names, "", "_sum") }}
-					      ));
-		}
-
-		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
-			gp_temp_alloc_free(temp);
-			return 1;
+			if (gp_progress_cb_report(callback, cnt++, strips * h_src, sw)) {
+				gp_temp_alloc_free(temp);
+				return 1;
+			}
 		}
 	}
 
@@ -278,6 +320,9 @@ int gp_filter_vlinear_convolution_raw(const gp_pixmap *src,
 	            "offset %ix%i rectangle %ux%u",
 		    kh, x_src, y_src, w_src, h_src);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -305,67 +350,62 @@ static int lin_conv_{{ pt.name }}(const gp_pixmap *src,
                                   float kern_div, gp_progress_cb *callback)
 {
 	gp_coord x, y;
-	unsigned int i, j;
-
-	/* Do linear convolution */
-	for (y = 0; y < (gp_coord)h_src; y++) {
-@         for c in pt.chanslist:
-		uint32_t {{ c.name }}[kw][kh];
-@         end
-		gp_pixel pix;
+	unsigned int i, j, k;
+	uint32_t size = w_src + kw - 1;
 
-		/* Prefill the buffer on the start */
-		for (j = 0; j < kh; j++) {
-			for (i = 0; i < kw - 1; i++) {
-				int xi = x_src + i - kw/2;
-				int yi = y_src + y + j - kh/2;
+	/* Create temporary buffers, kh source rows and a row of results */
+	gp_temp_alloc_create(temp, {{ len(pt.chanslist) }} * (kh * size + w_src) * sizeof(int));
 
-				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
-				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+	int *rows[kh][{{ len(pt.chanslist) }}];
 
-				pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, yi);
+	for (j = 0; j < kh; j++) {
+@         for i, c in enumerate(pt.chanslist):
+		rows[j][{{ i }}] = gp_temp_alloc_get(temp, size * sizeof(int));
+@         end
+	}
 
+	int *const res[] = {
 @         for c in pt.chanslist:
-				{{ c.name }}[i][j] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+		gp_temp_alloc_get(temp, w_src * sizeof(int)),
 @         end
-			}
-		}
+	};
 
-		int idx = kw - 1;
+	/* Prefill the ring buffer with the first kh - 1 rows */
+	for (j = 0; j < kh - 1; j++) {
+		int yi = GP_CLAMP(y_src + (int)j - (int)(kh/2), 0, (int)src->h - 1);
 
-		for (x = 0; x < (gp_coord)w_src; x++) {
-@         for c in pt.chanslist:
-			float {{ c.name }}_sum = 0;
-@         end
+		unpack_border(gp_pixel_row_unpack_{{ pt.name }}, {{ len(pt.chanslist) }},
+		              src, x_src - (kw-1)/2, yi, size, rows[j]);
+	}
 
-			for (j = 0; j < kh; j++) {
-				int xi = x_src + x + kw/2;
-				int yi = y_src + y + j - kh/2;
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_CLAMP(y_src + y + (int)(kh - 1) - (int)(kh/2), 0, (int)src->h - 1);
 
-				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
-				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+		unpack_border(gp_pixel_row_unpack_{{ pt.name }}, {{ len(pt.chanslist) }},
+		              src, x_src - (kw-1)/2, yi, size, rows[(y + kh - 1) % kh]);
 
-				pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, yi);
+		/* The kernel columns are summed starting at (kw - x) % kw */
+		k = 0;
 
+		for (x = 0; x < (gp_coord)w_src; x++) {
 @         for c in pt.chanslist:
-				{{ c.name }}[idx][j] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+			float {{ c.name }}_sum = 0;
 @         end
-			}
 
 			/* Count the pixel value from neighbours weighted by kernel */
 			for (i = 0; i < kw; i++) {
-				int k;
-
-				if ((int)i < idx + 1)
-					k = kw - idx - 1 + i;
-				else
-					k = i - idx - 1;
-
 				for (j = 0; j < kh; j++) {
-@         for c in pt.chanslist:
-					{{ c.name }}_sum += {{ c.name }}[i][j] * kernel[k + j * kw];
+					int *const *row = rows[(y + j) % kh];
+					float kv = kernel[k + j * kw];
+
+@         for i, c in enumerate(pt.chanslist):
+					{{ c.name }}_sum += row[{{ i }}][x + k] * kv;
 @         end
 				}
+
+				if (++k >= kw)
+					k = 0;
 			}
 
 			/* divide the result */
@@ -374,24 +414,23 @@ static int lin_conv_{{ pt.name }}(const gp_pixmap *src,
 @         end
 
 			/* and clamp just to be extra sure */
-@         for c in pt.chanslist:
-			int {{ c.name }}_res = GP_CLAMP((int){{ c.name }}_sum, 0, {{ c.max }});
+@         for i, c in enumerate(pt.chanslist):
+			res[{{ i }}][x] = GP_CLAMP((int){{ c.name }}_sum, 0, {{ c.max }});
 @         end
 
-			pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, "", "_res") }});
-
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x_dst + x, y_dst + y, pix);
-
-			idx++;
-
-			if (idx >= (int)kw)
-				idx = 0;
+			k = k ? k - 1 : kw - 1;
 		}
 
-		if (gp_progress_cb_report(callback, y, h_src, w_src))
+		gp_pixel_row_pack_{{ pt.name }}(dst, x_dst, y_dst + y, w_src, res);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
 			return 1;
+		}
 	}
 
+	gp_temp_alloc_free(temp);
+
 	gp_progress_cb_done(callback);
 	return 0;
 }
@@ -409,6 +448,9 @@ int gp_filter_linear_convolution_raw(const gp_pixmap *src,
 	GP_DEBUG(1, "Linear convolution kernel %ix%i rectangle %ux%u",
 	            kw, kh, w_src, h_src);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -4,212 +4,94 @@
  */
 
 #include <unistd.h>
-#include <pthread.h>
+#include <stdio.h>
 #include <string.h>
 #include <errno.h>
 
 #include "core/gp_common.h"
 #include <core/gp_debug.h>
+#include <core/gp_pixel.h>
 #include <core/gp_threads.h>
 
 #include <filters/gp_linear.h>
 #include <filters/gp_linear_threads.h>
 
-static void *h_linear_convolution(void *arg)
-{
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
-
-	if (gp_filter_hconvolution_raw(params))
-		ret = errno;
+struct conv_tiles {
+	const gp_convolution_params *params;
+	int (*conv)(const gp_convolution_params *params);
+};
 
-	return (void*)ret;
-}
-
-static void *v_linear_convolution(void *arg)
+static int conv_tile(const gp_tile *tile, void *priv, gp_progress_cb *callback)
 {
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
-
-	if (gp_filter_vconvolution_raw(params))
-		ret = errno;
-
-	return (void*)ret;
+	struct conv_tiles *conv = priv;
+	gp_convolution_params params = *conv->params;
+
+	params.x_src += tile->x;
+	params.y_src += tile->y;
+	params.w_src = tile->w;
+	params.h_src = tile->h;
+	params.x_dst += tile->x;
+	params.y_dst += tile->y;
+	params.callback = callback;
+
+	return conv->conv(&params);
 }
 
-static void *linear_convolution(void *arg)
-{
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
-
-	if (gp_filter_convolution_raw(params))
-		ret = errno;
-
-	return (void*)ret;
-}
-
-int gp_filter_hconvolution_mp_raw(const gp_convolution_params *params)
+/*
+ * Runs the convolution on 2D tiles in the thread pool.
+ *
+ * The tiles are at least eight kernel sizes big in each direction so that
+ * the pixels read around each tile are a small fraction of the work.
+ */
+static int convolution_mp(const gp_convolution_params *params,
+                          int (*conv)(const gp_convolution_params *params),
+                          const char *op)
 {
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
+	char name[32];
 
-	if (t == 1)
-		return gp_filter_hconvolution_raw(params);
+	if (gp_pixmap_unshare(params->dst))
+		return 1;
 
 	if (params->src == params->dst) {
 		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_hconvolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-		pthread_create(&threads[i], NULL, h_linear_convolution, &convs[i]);
-	}
-
-	int err = 0;
-
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
+		return conv(params);
 	}
 
-	return 0;
+	struct conv_tiles priv = {
+		.params = params,
+		.conv = conv,
+	};
+
+	/* The cost depends on the kernel size, autotune each one separately */
+	snprintf(name, sizeof(name), "%s_%ux%u", op, params->kw, params->kh);
+
+	gp_tiles tiles = {
+		.w = params->w_src,
+		.h = params->h_src,
+		.bpp = gp_pixel_size(params->src->pixel_type),
+		.name = name,
+		.pixel_type = params->src->pixel_type,
+		.min_w = 8 * params->kw,
+		.min_h = 8 * params->kh,
+		.fn = conv_tile,
+		.priv = &priv,
+		.callback = params->callback,
+	};
+
+	return gp_tiles_run(&tiles);
 }
 
+int gp_filter_hconvolution_mp_raw(const gp_convolution_params *params)
+{
+	return convolution_mp(params, gp_filter_hconvolution_raw, "hconv");
+}
 
 int gp_filter_vconvolution_mp_raw(const gp_convolution_params *params)
 {
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
-
-	if (t == 1)
-		return gp_filter_vconvolution_raw(params);
-
-	if (params->src == params->dst) {
-		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_vconvolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-
-		pthread_create(&threads[i], NULL, v_linear_convolution, &convs[i]);
-	}
-
-	int err = 0;
-
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
-	}
-
-	return 0;
+	return convolution_mp(params, gp_filter_vconvolution_raw, "vconv");
 }
 
-
 int gp_filter_convolution_mp_raw(const gp_convolution_params *params)
 {
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
-
-	if (t == 1)
-		return gp_filter_convolution_raw(params);
-
-	if (params->src == params->dst) {
-		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_convolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-
-		pthread_create(&threads[i], NULL, linear_convolution, &convs[i]);
-	}
-
-	int err = 0;
-
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
-	}
-
-	return 0;
+	return convolution_mp(params, gp_filter_convolution_raw, "conv");
 }
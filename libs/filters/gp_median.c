@@ -281,6 +281,9 @@ int gp_filter_median_ex(const gp_pixmap *src,
 
 	GP_CHECK(xmed >= 0 && ymed >= 0);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
 	                            dst, x_dst, y_dst, xmed, ymed, callback);
 }
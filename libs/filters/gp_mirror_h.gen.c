@@ -0,0 +1,719 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_mirror_h.gen.c
+ *
+ * GENERATED on 2026 10 17 02:02:05 from gp_mirror_h.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Horizontal Mirror alogorithm
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
+#include <core/gp_cpu.h>
+#include <filters/gp_rotate.h>
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 8 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_8BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 8 <= n; x += 8) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 8) * 1, 8);
+		v = __builtin_bswap64(v);
+		memcpy(dst + x * 1, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 1, src + (n - x - 1) * 1, 1);
+}
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 4 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_16BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 4 <= n; x += 4) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 4) * 2, 8);
+		v = __builtin_bswap64(v);
+		v = ((v >> 8) & 0x00ff00ff00ff00ffull) | ((v & 0x00ff00ff00ff00ffull) << 8);
+		memcpy(dst + x * 2, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 2, src + (n - x - 1) * 2, 2);
+}
+
+static void reverse_row_24BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 3;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 3);
+		dst += 3;
+		src -= 3;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_32BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint32_t *d = (void*)dst;
+	const uint32_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_32BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_32BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_32BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_32BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_32BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_resolve;
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_32BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_32BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_32BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_32BPP()", variant);
+
+	__atomic_store_n(&reverse_row_32BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_32BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_32BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+static void reverse_row_48BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 6;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 6);
+		dst += 6;
+		src -= 6;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_64BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint64_t *d = (void*)dst;
+	const uint64_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_64BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_64BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_64BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_64BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_64BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_resolve;
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_64BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_64BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_64BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_64BPP()", variant);
+
+	__atomic_store_n(&reverse_row_64BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_64BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_64BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_1BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_1BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_1BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_1BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_1BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_1BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_1BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_1BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_1BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_1BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_1BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_1BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_1BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_1BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_1BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_1BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_2BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_2BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_2BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_2BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_2BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_2BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_2BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_2BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_2BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_2BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_2BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_2BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_2BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_2BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_2BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_2BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_4BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_4BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_4BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_4BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_4BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_4BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_4BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_4BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_4BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_4BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_4BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_4BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_4BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_4BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_4BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_4BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_8BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_8BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_8BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_8BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 1);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_16BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_16BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_16BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_16BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 2);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_24BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_24BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_24BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_24BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 3);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_32BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_32BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_32BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_32BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 4);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_48BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_48BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_48BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_48BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_48BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 6);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_64BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_64BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_64BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_64BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_64BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 8);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_18BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_18BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_18BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_18BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_18BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_18BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_18BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_18BPP_LE(dst, xr, b, pa);
+	}
+}
+
+static void reverse_rows(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	GP_FN_PER_BPP_PIXMAP(reverse_rows, src, src, dst, a, b, tmp);
+}
+
+struct reverse_rows_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	/* Pairs rows from the top and bottom, i.e. rotates by 180 */
+	int flip;
+};
+
+static int reverse_rows_tile(const gp_tile *tile, void *ppriv,
+                             gp_progress_cb *callback)
+{
+	struct reverse_rows_priv *priv = ppriv;
+	const gp_pixmap *src = priv->src;
+	size_t size = 0;
+	uint8_t *tmp = NULL;
+	gp_size i;
+
+	if (src == priv->dst && !(src->bpp % 8)) {
+		size = (size_t)src->w * (src->bpp / 8);
+		tmp = gp_temp_alloc(size);
+		if (!tmp) {
+			GP_WARN("Malloc failed :(");
+			errno = ENOMEM;
+			return 1;
+		}
+	}
+
+	for (i = 0; i < tile->h; i++) {
+		gp_coord a = tile->y + i;
+		gp_coord b = priv->flip ? (gp_coord)src->h - a - 1 : a;
+
+		reverse_rows(src, priv->dst, a, b, tmp);
+
+		if (gp_progress_cb_report(callback, i, tile->h, tile->w)) {
+			gp_temp_free(size, tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_free(size, tmp);
+	return 0;
+}
+
+static int reverse_rows_run(const gp_pixmap *src, gp_pixmap *dst, int flip,
+                            const char *name, gp_progress_cb *callback)
+{
+	struct reverse_rows_priv priv = {
+		.src = src,
+		.dst = dst,
+		.flip = flip,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = flip ? (src->h + 1) / 2 : src->h,
+		.bpp = src->bpp,
+		.name = name,
+		.pixel_type = src->pixel_type,
+		/* Split only rows, each tile reverses whole rows */
+		.min_w = src->w,
+		.fn = reverse_rows_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	return gp_tiles_run(&tiles);
+}
+
+static int gp_filter_mirror_h_raw(const gp_pixmap *src, gp_pixmap *dst,
+                                  gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	return reverse_rows_run(src, dst, 0, "mirror_h", callback);
+}
+
+int gp_filter_mirror_h(const gp_pixmap *src, gp_pixmap *dst,
+                       gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (gp_filter_mirror_h_raw(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_mirror_h_alloc(const gp_pixmap *src,
+                                    gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_mirror_h_raw(src, res, callback)) {
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
@@ -5,50 +5,26 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_debug.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
+#include <core/gp_cpu.h>
 #include <filters/gp_rotate.h>
 
-@ for ps in pixelsizes:
-static int mirror_h_raw_{{ ps.suffix }}(const gp_pixmap *src,
-                                        gp_pixmap *dst,
-                                        gp_progress_cb *callback)
-{
-	uint32_t x, y;
-	gp_pixel tmp;
-
-	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
-
-	for (x = 0; x < src->w/2; x++) {
-		uint32_t xm = src->w - x - 1;
-		for (y = 0; y < src->h; y++) {
-			tmp = gp_getpixel_raw_{{ ps.suffix }}(src, x, y);
-			gp_putpixel_raw_{{ ps.suffix }}(dst, x, y, gp_getpixel_raw_{{ ps.suffix }}(src, xm, y));
-			gp_putpixel_raw_{{ ps.suffix }}(dst, xm, y, tmp);
-		}
-
-		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
-			return 1;
-	}
-
-	/* Copy the middle odd line */
-	if (src != dst && src->w % 2) {
-		x = src->w / 2;
-		for (y = 0; y < src->h; y++)
-			gp_putpixel_raw_{{ ps.suffix }}(dst, x, y, gp_getpixel_raw_{{ ps.suffix }}(src, x, y));
-	}
-
-	gp_progress_cb_done(callback);
-	return 0;
-}
+@ include reverse_rows.t
+{@ reverse_rows() @}
 
-@ end
-@
 static int gp_filter_mirror_h_raw(const gp_pixmap *src, gp_pixmap *dst,
                                   gp_progress_cb *callback)
 {
-	GP_FN_RET_PER_BPP_PIXMAP(mirror_h_raw, src, src, dst, callback);
-	return 1;
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	return reverse_rows_run(src, dst, 0, "mirror_h", callback);
 }
 
 int gp_filter_mirror_h(const gp_pixmap *src, gp_pixmap *dst,
@@ -59,6 +35,9 @@ int gp_filter_mirror_h(const gp_pixmap *src, gp_pixmap *dst,
 	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
 	          "Destination is not large enough");
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	if (gp_filter_mirror_h_raw(src, dst, callback)) {
 		GP_DEBUG(1, "Operation aborted");
 		return 1;
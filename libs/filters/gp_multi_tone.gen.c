@@ -0,0 +1,972 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_multi_tone.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:29 from gp_multi_tone.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Generic Point filer
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include "core/gp_pixmap.h"
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_mix_pixels.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_multi_tone.h>
+
+static void init_table_xRGB8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_xRGB8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_xRGB8888);
+	}
+}
+
+static void init_table_RGBA8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGBA8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGBA8888);
+	}
+}
+
+static void init_table_RGB888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB888);
+	}
+}
+
+static void init_table_BGR888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_BGR888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_BGR888);
+	}
+}
+
+static void init_table_RGB555(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB555(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB555);
+	}
+}
+
+static void init_table_RGB565(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB565(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB565);
+	}
+}
+
+static void init_table_RGB666(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB666(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB666);
+	}
+}
+
+static void init_table_RGB332(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB332(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB332);
+	}
+}
+
+static void init_table_CMYK8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_CMYK8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_CMYK8888);
+	}
+}
+
+static void init_table_G1(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G1(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G1);
+	}
+}
+
+static void init_table_G2(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G2(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G2);
+	}
+}
+
+static void init_table_G4(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G4(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G4);
+	}
+}
+
+static void init_table_G8(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G8(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G8);
+	}
+}
+
+static void init_table_GA88(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_GA88(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_GA88);
+	}
+}
+
+static void init_table_G16(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G16(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G16);
+	}
+}
+
+static void init_table_RGBA8888_PM(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGBA8888_PM(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGBA8888_PM);
+	}
+}
+
+static void init_table_RGB161616(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB161616(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB161616);
+	}
+}
+
+static void init_table_RGBA16161616(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGBA16161616(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGBA16161616);
+	}
+}
+
+static void init_table(gp_pixel_type type,
+                       gp_pixel table[], gp_size table_size,
+                       gp_pixel pixels[], gp_size pixels_size)
+{
+	switch (type) {
+	case GP_PIXEL_xRGB8888:
+		init_table_xRGB8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGBA8888:
+		init_table_RGBA8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB888:
+		init_table_RGB888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_BGR888:
+		init_table_BGR888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB555:
+		init_table_RGB555(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB565:
+		init_table_RGB565(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB666:
+		init_table_RGB666(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB332:
+		init_table_RGB332(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_CMYK8888:
+		init_table_CMYK8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G1:
+		init_table_G1(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G2:
+		init_table_G2(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G4:
+		init_table_G4(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G8:
+		init_table_G8(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_GA88:
+		init_table_GA88(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G16:
+		init_table_G16(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		init_table_RGBA8888_PM(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB161616:
+		init_table_RGB161616(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		init_table_RGBA16161616(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	default:
+		GP_BUG("Should not be reached");
+	break;
+	}
+}
+
+#include <assert.h>
+
+static int multitone_G1(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 2 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 2 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u G1 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 2, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G2(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 4 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 4 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u G2 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 4, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G4(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 16 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 16 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u G4 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 16, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G8(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 256 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 256 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u G8 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 256, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_GA88(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 256 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 256 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u GA88 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 256, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G16(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   gp_pixel pixels[], gp_size pixels_size,
+                                   gp_progress_cb *callback)
+{
+	gp_temp_alloc_create(tmp, 65536 * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, 65536 * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Duotone filter %ux%u G16 -> %s",
+	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, 65536, pixels, pixels_size);
+
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(tmp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+int gp_filter_multitone_ex(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           gp_pixel pixels[], gp_size pixels_size,
+                           gp_progress_cb *callback)
+{
+	//CHECK DST IS NOT PALETTE PixelHasFlags
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_G1:
+		return multitone_G1(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	case GP_PIXEL_G2:
+		return multitone_G2(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	case GP_PIXEL_G4:
+		return multitone_G4(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	case GP_PIXEL_G8:
+		return multitone_G8(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	case GP_PIXEL_GA88:
+		return multitone_GA88(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	case GP_PIXEL_G16:
+		return multitone_G16(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               pixels, pixels_size,
+		                               callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+gp_pixmap *gp_filter_multitone_ex_alloc(const gp_pixmap *const src,
+                                        gp_coord x_src, gp_coord y_src,
+                                        gp_size w_src, gp_size h_src,
+                                        gp_pixel_type dst_pixel_type,
+                                        gp_pixel pixels[], gp_size pixels_size,
+                                        gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+	int err;
+
+	res = gp_pixmap_alloc(w_src, h_src, dst_pixel_type);
+
+	if (!res) {
+		GP_DEBUG(1, "Malloc failed :(");
+		return NULL;
+	}
+
+	if (gp_filter_multitone_ex(src, x_src, y_src, w_src, h_src, res, 0, 0,
+	                         pixels, pixels_size, callback)) {
+		err = errno;
+		gp_pixmap_free(res);
+		errno = err;
+		return NULL;
+	}
+
+	return res;
+}
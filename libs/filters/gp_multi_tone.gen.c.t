@@ -127,6 +127,9 @@ int gp_filter_multitone_ex(const gp_pixmap *const src,
 {
 	//CHECK DST IS NOT PALETTE PixelHasFlags
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if pt.is_gray():
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_posterize.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:31 from gp_posterize.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Posterize Point filter
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+
+#include <filters/gp_apply_tables.h>
+#include <filters/gp_point.h>
+
+int gp_filter_posterize_ex(const gp_pixmap *const src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               unsigned int steps,
+                               gp_progress_cb *callback)
+{
+	const gp_pixel_type_desc *desc;
+	gp_filter_tables tables;
+	unsigned int i;
+	gp_pixel j;
+	int ret, err;
+
+	if (gp_filter_tables_init(&tables, src))
+		return 1;
+
+	desc = gp_pixel_desc(src->pixel_type);
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = tables.table[i];
+
+		for (j = 0; j < chan_max; j++)
+			table[j] = ((((signed)j) + (((signed)chan_max - 1) / steps)/2) / (((signed)chan_max - 1) / steps)) * (((signed)chan_max - 1) / steps);;
+	}
+
+	ret = gp_filter_tables_apply(src, x_src, y_src, w_src, h_src,
+	                             dst, x_dst, y_dst, &tables, callback);
+
+	err = errno;
+	gp_filter_tables_free(&tables);
+	errno = err;
+
+	return ret;
+}
+gp_pixmap *gp_filter_posterize_ex_alloc(const gp_pixmap *const src,
+                                            gp_coord x_src, gp_coord y_src,
+                                            gp_size w_src, gp_size h_src,
+                                            unsigned int steps,
+                                            gp_progress_cb *callback)
+{
+	gp_pixmap *new = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (gp_filter_posterize_ex(src, x_src, y_src, w_src, h_src, new, 0, 0,
+	                               steps,callback)) {
+		int err = errno;
+		gp_pixmap_free(new);
+		errno = err;
+		return NULL;
+	}
+
+	return new;
+}
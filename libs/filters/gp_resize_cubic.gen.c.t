@@ -28,6 +28,14 @@
 #define SUM_I(a) \
 	((a)[0] + (a)[1] + (a)[2] + (a)[3])
 
+/*
+ * The rounded weights may not add up to MUL which shifts flat areas by one,
+ * the difference is added to the weight of the nearest pixel.
+ */
+#define NORM_I(a) ({ \
+	a[1] += MUL - SUM_I(a); \
+})
+
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
@@ -61,6 +69,7 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
 		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
 		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+		NORM_I(xmap_c[i]);
 
 		xmap[i][0] = GP_MAX(xmap[i][0], 0);
 		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
@@ -82,6 +91,7 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
 		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
 		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+		NORM_I(cvy);
 
 		yi[0] = GP_MAX(yi[0], 0);
 		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
@@ -124,11 +134,16 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 @         end
 		}
 
-		/* now interpolate column for new image */
+		/*
+		 * now interpolate column for new image
+		 *
+		 * The result is scaled by MUL * MUL which overflows 32 bits for
+		 * channels wider than 10 bits.
+		 */
 		for (j = 0; j < dst->w; j++) {
 @         for c in pt.chanslist:
-			int32_t {{ c.name }}v[4];
-			int32_t {{ c.name }};
+			int64_t {{ c.name }}v[4];
+			int64_t {{ c.name }};
 @         end
 
 @         for c in pt.chanslist:
@@ -143,7 +158,7 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 @         end
 
 @         for c in pt.chanslist:
-			{{ c.name }} = (SUM_I({{ c.name }}v) + MUL*MUL/2) / MUL / MUL;
+			{{ c.name }} = (SUM_I({{ c.name }}v) + MUL*MUL/2) / (MUL * MUL);
 @         end
 
 			if (src->gamma) {
@@ -159,7 +174,7 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 @         end
 			}
 
-			gp_pixel pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, "(uint8_t)") }});
+			gp_pixel pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }});
 			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, j, i, pix);
 		}
 
@@ -198,5 +213,8 @@ int gp_filter_resize_cubic_int(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return resize_cubic(src, dst, callback);
 }
@@ -70,6 +70,9 @@ int gp_filter_resize_cubic(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
 	            src->w, src->h, dst->w, dst->h,
 		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
@@ -0,0 +1,4625 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_resize_linear.gen.c
+ *
+ * GENERATED on 2026 10 17 02:32:44 from gp_resize_linear.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Linear resampling
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_gamma.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize.h>
+
+static int resize_lin_lf_xRGB8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_xRGB8888(pix);
+		G[x] = GP_PIXEL_GET_G_xRGB8888(pix);
+		B[x] = GP_PIXEL_GET_B_xRGB8888(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_xRGB8888(pix);
+				G[x] = GP_PIXEL_GET_G_xRGB8888(pix);
+				B[x] = GP_PIXEL_GET_B_xRGB8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_xRGB8888(pix);
+				G[x] = GP_PIXEL_GET_G_xRGB8888(pix);
+				B[x] = GP_PIXEL_GET_B_xRGB8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_xRGB8888(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGBA8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t A[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGBA8888(pix);
+		G[x] = GP_PIXEL_GET_G_RGBA8888(pix);
+		B[x] = GP_PIXEL_GET_B_RGBA8888(pix);
+		A[x] = GP_PIXEL_GET_A_RGBA8888(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+		uint32_t A_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint32_t A_middle = 0;
+			uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGBA8888(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA8888(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA8888(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGBA8888(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA8888(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA8888(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+			uint32_t A_p = ((uint64_t)A_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGBA8888(R_p, G_p, B_p, A_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB888(pix);
+		G[x] = GP_PIXEL_GET_G_RGB888(pix);
+		B[x] = GP_PIXEL_GET_B_RGB888(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB888(pix);
+				G[x] = GP_PIXEL_GET_G_RGB888(pix);
+				B[x] = GP_PIXEL_GET_B_RGB888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB888(pix);
+				G[x] = GP_PIXEL_GET_G_RGB888(pix);
+				B[x] = GP_PIXEL_GET_B_RGB888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_24BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB888(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_BGR888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t B[src->w];
+	uint32_t G[src->w];
+	uint32_t R[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, x, 0);
+		B[x] = GP_PIXEL_GET_B_BGR888(pix);
+		G[x] = GP_PIXEL_GET_G_BGR888(pix);
+		R[x] = GP_PIXEL_GET_R_BGR888(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t B_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t R_res[dst->w];
+
+		memset(B_res, 0, sizeof(B_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(R_res, 0, sizeof(R_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				B_middle += B[j];
+				G_middle += G[j];
+				R_middle += R[j];
+			}
+			/* Add it all together with last pixel on the right */
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, i);
+				B[x] = GP_PIXEL_GET_B_BGR888(pix);
+				G[x] = GP_PIXEL_GET_G_BGR888(pix);
+				R[x] = GP_PIXEL_GET_R_BGR888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					B_middle += B[j];
+					G_middle += G[j];
+					R_middle += R[j];
+				}
+				/* Add it all together with last pixel on the right */
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, x, ymap[y+1]);
+				B[x] = GP_PIXEL_GET_B_BGR888(pix);
+				G[x] = GP_PIXEL_GET_G_BGR888(pix);
+				R[x] = GP_PIXEL_GET_R_BGR888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					B_middle += B[j];
+					G_middle += G[j];
+					R_middle += R[j];
+				}
+				/* Add it all together with last pixel on the right */
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_24BPP(dst, x, y,
+				GP_PIXEL_CREATE_BGR888(B_p, G_p, R_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB555(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB555(pix);
+		G[x] = GP_PIXEL_GET_G_RGB555(pix);
+		B[x] = GP_PIXEL_GET_B_RGB555(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB555(pix);
+				G[x] = GP_PIXEL_GET_G_RGB555(pix);
+				B[x] = GP_PIXEL_GET_B_RGB555(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB555(pix);
+				G[x] = GP_PIXEL_GET_G_RGB555(pix);
+				B[x] = GP_PIXEL_GET_B_RGB555(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB555(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB565(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB565(pix);
+		G[x] = GP_PIXEL_GET_G_RGB565(pix);
+		B[x] = GP_PIXEL_GET_B_RGB565(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB565(pix);
+				G[x] = GP_PIXEL_GET_G_RGB565(pix);
+				B[x] = GP_PIXEL_GET_B_RGB565(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB565(pix);
+				G[x] = GP_PIXEL_GET_G_RGB565(pix);
+				B[x] = GP_PIXEL_GET_B_RGB565(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB565(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB666(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB666(pix);
+		G[x] = GP_PIXEL_GET_G_RGB666(pix);
+		B[x] = GP_PIXEL_GET_B_RGB666(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB666(pix);
+				G[x] = GP_PIXEL_GET_G_RGB666(pix);
+				B[x] = GP_PIXEL_GET_B_RGB666(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB666(pix);
+				G[x] = GP_PIXEL_GET_G_RGB666(pix);
+				B[x] = GP_PIXEL_GET_B_RGB666(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_18BPP_LE(dst, x, y,
+				GP_PIXEL_CREATE_RGB666(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB332(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB332(pix);
+		G[x] = GP_PIXEL_GET_G_RGB332(pix);
+		B[x] = GP_PIXEL_GET_B_RGB332(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB332(pix);
+				G[x] = GP_PIXEL_GET_G_RGB332(pix);
+				B[x] = GP_PIXEL_GET_B_RGB332(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB332(pix);
+				G[x] = GP_PIXEL_GET_G_RGB332(pix);
+				B[x] = GP_PIXEL_GET_B_RGB332(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_8BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB332(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_CMYK8888(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t K[src->w];
+	uint32_t Y[src->w];
+	uint32_t M[src->w];
+	uint32_t C[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		K[x] = GP_PIXEL_GET_K_CMYK8888(pix);
+		Y[x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+		M[x] = GP_PIXEL_GET_M_CMYK8888(pix);
+		C[x] = GP_PIXEL_GET_C_CMYK8888(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t K_res[dst->w];
+		uint32_t Y_res[dst->w];
+		uint32_t M_res[dst->w];
+		uint32_t C_res[dst->w];
+
+		memset(K_res, 0, sizeof(K_res));
+		memset(Y_res, 0, sizeof(Y_res));
+		memset(M_res, 0, sizeof(M_res));
+		memset(C_res, 0, sizeof(C_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t K_middle = 0;
+			uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+			uint32_t Y_middle = 0;
+			uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+			uint32_t M_middle = 0;
+			uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+			uint32_t C_middle = 0;
+			uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				K_middle += K[j];
+				Y_middle += Y[j];
+				M_middle += M[j];
+				C_middle += C[j];
+			}
+			/* Add it all together with last pixel on the right */
+			K_res[x] += (K_middle * (MULT / DIV) +
+			                        (K[xmap[x+1]] * xoff[x+1] +
+			                         K_first) / DIV) * (MULT-yoff[y]) / DIV;
+			Y_res[x] += (Y_middle * (MULT / DIV) +
+			                        (Y[xmap[x+1]] * xoff[x+1] +
+			                         Y_first) / DIV) * (MULT-yoff[y]) / DIV;
+			M_res[x] += (M_middle * (MULT / DIV) +
+			                        (M[xmap[x+1]] * xoff[x+1] +
+			                         M_first) / DIV) * (MULT-yoff[y]) / DIV;
+			C_res[x] += (C_middle * (MULT / DIV) +
+			                        (C[xmap[x+1]] * xoff[x+1] +
+			                         C_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				K[x] = GP_PIXEL_GET_K_CMYK8888(pix);
+				Y[x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+				M[x] = GP_PIXEL_GET_M_CMYK8888(pix);
+				C[x] = GP_PIXEL_GET_C_CMYK8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t K_middle = 0;
+				uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+				uint32_t Y_middle = 0;
+				uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+				uint32_t M_middle = 0;
+				uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+				uint32_t C_middle = 0;
+				uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					K_middle += K[j];
+					Y_middle += Y[j];
+					M_middle += M[j];
+					C_middle += C[j];
+				}
+				/* Add it all together with last pixel on the right */
+				K_res[x] += (K_middle * (MULT / DIV) +
+				                        (K[xmap[x+1]] * xoff[x+1] +
+				                         K_first) / DIV) * MULT / DIV;
+				Y_res[x] += (Y_middle * (MULT / DIV) +
+				                        (Y[xmap[x+1]] * xoff[x+1] +
+				                         Y_first) / DIV) * MULT / DIV;
+				M_res[x] += (M_middle * (MULT / DIV) +
+				                        (M[xmap[x+1]] * xoff[x+1] +
+				                         M_first) / DIV) * MULT / DIV;
+				C_res[x] += (C_middle * (MULT / DIV) +
+				                        (C[xmap[x+1]] * xoff[x+1] +
+				                         C_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				K[x] = GP_PIXEL_GET_K_CMYK8888(pix);
+				Y[x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+				M[x] = GP_PIXEL_GET_M_CMYK8888(pix);
+				C[x] = GP_PIXEL_GET_C_CMYK8888(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t K_middle = 0;
+				uint32_t K_first = K[xmap[x]] * (MULT - xoff[x]);
+				uint32_t Y_middle = 0;
+				uint32_t Y_first = Y[xmap[x]] * (MULT - xoff[x]);
+				uint32_t M_middle = 0;
+				uint32_t M_first = M[xmap[x]] * (MULT - xoff[x]);
+				uint32_t C_middle = 0;
+				uint32_t C_first = C[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					K_middle += K[j];
+					Y_middle += Y[j];
+					M_middle += M[j];
+					C_middle += C[j];
+				}
+				/* Add it all together with last pixel on the right */
+				K_res[x] += (K_middle * (MULT / DIV) +
+				                        (K[xmap[x+1]] * xoff[x+1] +
+				                         K_first) / DIV) * yoff[y+1] / DIV;
+				Y_res[x] += (Y_middle * (MULT / DIV) +
+				                        (Y[xmap[x+1]] * xoff[x+1] +
+				                         Y_first) / DIV) * yoff[y+1] / DIV;
+				M_res[x] += (M_middle * (MULT / DIV) +
+				                        (M[xmap[x+1]] * xoff[x+1] +
+				                         M_first) / DIV) * yoff[y+1] / DIV;
+				C_res[x] += (C_middle * (MULT / DIV) +
+				                        (C[xmap[x+1]] * xoff[x+1] +
+				                         C_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t K_p = ((uint64_t)K_res[x] * DIV * DIV + area/2) / area;
+			uint32_t Y_p = ((uint64_t)Y_res[x] * DIV * DIV + area/2) / area;
+			uint32_t M_p = ((uint64_t)M_res[x] * DIV * DIV + area/2) / area;
+			uint32_t C_p = ((uint64_t)C_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_CMYK8888(K_p, Y_p, M_p, C_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G1(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G1(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G1(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G1(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_1BPP_LE(dst, x, y,
+				GP_PIXEL_CREATE_G1(V_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G2(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G2(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G2(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G2(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_2BPP_LE(dst, x, y,
+				GP_PIXEL_CREATE_G2(V_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G4(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G4(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G4(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G4(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_4BPP_LE(dst, x, y,
+				GP_PIXEL_CREATE_G4(V_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G8(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G8(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G8(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G8(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_8BPP(dst, x, y,
+				GP_PIXEL_CREATE_G8(V_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_GA88(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t A[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_GA88(pix);
+		A[x] = GP_PIXEL_GET_A_GA88(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t V_res[dst->w];
+		uint32_t A_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t V_middle = 0;
+			uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			uint32_t A_middle = 0;
+			uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_GA88(pix);
+				A[x] = GP_PIXEL_GET_A_GA88(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_GA88(pix);
+				A[x] = GP_PIXEL_GET_A_GA88(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t V_middle = 0;
+				uint32_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+			uint32_t A_p = ((uint64_t)A_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_GA88(V_p, A_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_G16(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t V[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, x, 0);
+		V[x] = GP_PIXEL_GET_V_G16(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint64_t V_res[dst->w];
+
+		memset(V_res, 0, sizeof(V_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint64_t V_middle = 0;
+			uint64_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				V_middle += V[j];
+			}
+			/* Add it all together with last pixel on the right */
+			V_res[x] += (V_middle * (MULT / DIV) +
+			                        (V[xmap[x+1]] * xoff[x+1] +
+			                         V_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, i);
+				V[x] = GP_PIXEL_GET_V_G16(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t V_middle = 0;
+				uint64_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_16BPP(src, x, ymap[y+1]);
+				V[x] = GP_PIXEL_GET_V_G16(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t V_middle = 0;
+				uint64_t V_first = V[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					V_middle += V[j];
+				}
+				/* Add it all together with last pixel on the right */
+				V_res[x] += (V_middle * (MULT / DIV) +
+				                        (V[xmap[x+1]] * xoff[x+1] +
+				                         V_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t V_p = ((uint64_t)V_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_16BPP(dst, x, y,
+				GP_PIXEL_CREATE_G16(V_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGBA8888_PM(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t A[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+		G[x] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+		B[x] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+		A[x] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint32_t R_res[dst->w];
+		uint32_t G_res[dst->w];
+		uint32_t B_res[dst->w];
+		uint32_t A_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint32_t R_middle = 0;
+			uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint32_t G_middle = 0;
+			uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint32_t B_middle = 0;
+			uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint32_t A_middle = 0;
+			uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint32_t R_middle = 0;
+				uint32_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint32_t G_middle = 0;
+				uint32_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint32_t B_middle = 0;
+				uint32_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint32_t A_middle = 0;
+				uint32_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+			uint32_t A_p = ((uint64_t)A_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_32BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGBA8888_PM(R_p, G_p, B_p, A_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGB161616(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_48BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGB161616(pix);
+		G[x] = GP_PIXEL_GET_G_RGB161616(pix);
+		B[x] = GP_PIXEL_GET_B_RGB161616(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint64_t R_res[dst->w];
+		uint64_t G_res[dst->w];
+		uint64_t B_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint64_t R_middle = 0;
+			uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint64_t G_middle = 0;
+			uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint64_t B_middle = 0;
+			uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_48BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGB161616(pix);
+				G[x] = GP_PIXEL_GET_G_RGB161616(pix);
+				B[x] = GP_PIXEL_GET_B_RGB161616(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t R_middle = 0;
+				uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint64_t G_middle = 0;
+				uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint64_t B_middle = 0;
+				uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_48BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGB161616(pix);
+				G[x] = GP_PIXEL_GET_G_RGB161616(pix);
+				B[x] = GP_PIXEL_GET_B_RGB161616(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t R_middle = 0;
+				uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint64_t G_middle = 0;
+				uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint64_t B_middle = 0;
+				uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_48BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGB161616(R_p, G_p, B_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin_lf_RGBA16161616(const gp_pixmap *src, gp_pixmap *dst,
+                                       gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint32_t xoff[dst->w + 1];
+	uint32_t yoff[dst->h + 1];
+	uint32_t R[src->w];
+	uint32_t G[src->w];
+	uint32_t B[src->w];
+	uint32_t A[src->w];
+	uint32_t xarea[dst->w];
+	uint32_t x, y;
+	uint32_t i, j;
+	const int MULT=1<<14;
+	const int DIV=1<<9;
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i <= dst->w; i++) {
+		xmap[i] = ((uint64_t)i * src->w) / dst->w;
+		xoff[i] = ((uint64_t)MULT * (i * src->w))/dst->w - MULT * xmap[i];
+	}
+
+	for (i = 0; i <= dst->h; i++) {
+		ymap[i] = ((uint64_t)i * src->h) / dst->h;
+		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
+	}
+
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
+
+	/* Prefetch first row */
+	for (x = 0; x < src->w; x++) {
+		gp_pixel pix = gp_getpixel_raw_64BPP(src, x, 0);
+		R[x] = GP_PIXEL_GET_R_RGBA16161616(pix);
+		G[x] = GP_PIXEL_GET_G_RGBA16161616(pix);
+		B[x] = GP_PIXEL_GET_B_RGBA16161616(pix);
+		A[x] = GP_PIXEL_GET_A_RGBA16161616(pix);
+	}
+
+	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
+		uint64_t R_res[dst->w];
+		uint64_t G_res[dst->w];
+		uint64_t B_res[dst->w];
+		uint64_t A_res[dst->w];
+
+		memset(R_res, 0, sizeof(R_res));
+		memset(G_res, 0, sizeof(G_res));
+		memset(B_res, 0, sizeof(B_res));
+		memset(A_res, 0, sizeof(A_res));
+
+		/* Sum first row */
+		for (x = 0; x < dst->w; x++) {
+			/* Get first left pixel */
+			uint64_t R_middle = 0;
+			uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+			uint64_t G_middle = 0;
+			uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+			uint64_t B_middle = 0;
+			uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+			uint64_t A_middle = 0;
+			uint64_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+			/* Sum middle pixels */
+			for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+				R_middle += R[j];
+				G_middle += G[j];
+				B_middle += B[j];
+				A_middle += A[j];
+			}
+			/* Add it all together with last pixel on the right */
+			R_res[x] += (R_middle * (MULT / DIV) +
+			                        (R[xmap[x+1]] * xoff[x+1] +
+			                         R_first) / DIV) * (MULT-yoff[y]) / DIV;
+			G_res[x] += (G_middle * (MULT / DIV) +
+			                        (G[xmap[x+1]] * xoff[x+1] +
+			                         G_first) / DIV) * (MULT-yoff[y]) / DIV;
+			B_res[x] += (B_middle * (MULT / DIV) +
+			                        (B[xmap[x+1]] * xoff[x+1] +
+			                         B_first) / DIV) * (MULT-yoff[y]) / DIV;
+			A_res[x] += (A_middle * (MULT / DIV) +
+			                        (A[xmap[x+1]] * xoff[x+1] +
+			                         A_first) / DIV) * (MULT-yoff[y]) / DIV;
+					}
+
+		/* Sum middle */
+		for (i = ymap[y]+1; i < ymap[y+1]; i++) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_64BPP(src, x, i);
+				R[x] = GP_PIXEL_GET_R_RGBA16161616(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA16161616(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA16161616(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA16161616(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t R_middle = 0;
+				uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint64_t G_middle = 0;
+				uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint64_t B_middle = 0;
+				uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint64_t A_middle = 0;
+				uint64_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * MULT / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * MULT / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * MULT / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * MULT / DIV;
+						}
+		}
+
+		/* Sum last row */
+		if (yoff[y+1]) {
+			for (x = 0; x < src->w; x++) {
+				gp_pixel pix = gp_getpixel_raw_64BPP(src, x, ymap[y+1]);
+				R[x] = GP_PIXEL_GET_R_RGBA16161616(pix);
+				G[x] = GP_PIXEL_GET_G_RGBA16161616(pix);
+				B[x] = GP_PIXEL_GET_B_RGBA16161616(pix);
+				A[x] = GP_PIXEL_GET_A_RGBA16161616(pix);
+			}
+			for (x = 0; x < dst->w; x++) {
+				/* Get first left pixel */
+				uint64_t R_middle = 0;
+				uint64_t R_first = R[xmap[x]] * (MULT - xoff[x]);
+				uint64_t G_middle = 0;
+				uint64_t G_first = G[xmap[x]] * (MULT - xoff[x]);
+				uint64_t B_middle = 0;
+				uint64_t B_first = B[xmap[x]] * (MULT - xoff[x]);
+				uint64_t A_middle = 0;
+				uint64_t A_first = A[xmap[x]] * (MULT - xoff[x]);
+				/* Sum middle pixels */
+				for (j = xmap[x]+1; j < xmap[x+1]; j++) {
+					R_middle += R[j];
+					G_middle += G[j];
+					B_middle += B[j];
+					A_middle += A[j];
+				}
+				/* Add it all together with last pixel on the right */
+				R_res[x] += (R_middle * (MULT / DIV) +
+				                        (R[xmap[x+1]] * xoff[x+1] +
+				                         R_first) / DIV) * yoff[y+1] / DIV;
+				G_res[x] += (G_middle * (MULT / DIV) +
+				                        (G[xmap[x+1]] * xoff[x+1] +
+				                         G_first) / DIV) * yoff[y+1] / DIV;
+				B_res[x] += (B_middle * (MULT / DIV) +
+				                        (B[xmap[x+1]] * xoff[x+1] +
+				                         B_first) / DIV) * yoff[y+1] / DIV;
+				A_res[x] += (A_middle * (MULT / DIV) +
+				                        (A[xmap[x+1]] * xoff[x+1] +
+				                         A_first) / DIV) * yoff[y+1] / DIV;
+						}
+		}
+
+		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
+			uint32_t R_p = ((uint64_t)R_res[x] * DIV * DIV + area/2) / area;
+			uint32_t G_p = ((uint64_t)G_res[x] * DIV * DIV + area/2) / area;
+			uint32_t B_p = ((uint64_t)B_res[x] * DIV * DIV + area/2) / area;
+			uint32_t A_p = ((uint64_t)A_res[x] * DIV * DIV + area/2) / area;
+                        gp_putpixel_raw_64BPP(dst, x, y,
+				GP_PIXEL_CREATE_RGBA16161616(R_p, G_p, B_p, A_p));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linxRGB8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_xRGB8888(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_xRGB8888(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_xRGB8888(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_xRGB8888(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_xRGB8888(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_xRGB8888(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_xRGB8888(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_xRGB8888(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_xRGB8888(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_xRGB8888(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_xRGB8888(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_xRGB8888(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_xRGB8888(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGBA8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGBA8888(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGBA8888(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGBA8888(pix00) * (256 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_RGBA8888(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGBA8888(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGBA8888(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGBA8888(pix10) * xoff[x];
+			A0 += GP_PIXEL_GET_A_RGBA8888(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGBA8888(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGBA8888(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGBA8888(pix01) * (256 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_RGBA8888(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGBA8888(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGBA8888(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGBA8888(pix11) * xoff[x];
+			A1 += GP_PIXEL_GET_A_RGBA8888(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGBA8888(R, G, B, A));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_24BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_24BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_24BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_24BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB888(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB888(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB888(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB888(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB888(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB888(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB888(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB888(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB888(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB888(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB888(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB888(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_24BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB888(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linBGR888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t B, B0, B1;
+			uint32_t G, G0, G1;
+			uint32_t R, R0, R1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_24BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_24BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_24BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_24BPP(src, x1, y1);
+
+			B0 = GP_PIXEL_GET_B_BGR888(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_BGR888(pix00) * (256 - xoff[x]);
+			R0 = GP_PIXEL_GET_R_BGR888(pix00) * (256 - xoff[x]);
+
+			B0 += GP_PIXEL_GET_B_BGR888(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_BGR888(pix10) * xoff[x];
+			R0 += GP_PIXEL_GET_R_BGR888(pix10) * xoff[x];
+
+			B1 = GP_PIXEL_GET_B_BGR888(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_BGR888(pix01) * (256 - xoff[x]);
+			R1 = GP_PIXEL_GET_R_BGR888(pix01) * (256 - xoff[x]);
+
+			B1 += GP_PIXEL_GET_B_BGR888(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_BGR888(pix11) * xoff[x];
+			R1 += GP_PIXEL_GET_R_BGR888(pix11) * xoff[x];
+
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_24BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_BGR888(B, G, R));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB555(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB555(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB555(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB555(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB555(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB555(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB555(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB555(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB555(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB555(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB555(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB555(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB555(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB555(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB565(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB565(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB565(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB565(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB565(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB565(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB565(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB565(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB565(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB565(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB565(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB565(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB565(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB565(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB666(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_18BPP_LE(src, x0, y0);
+			pix10 = gp_getpixel_raw_18BPP_LE(src, x1, y0);
+			pix01 = gp_getpixel_raw_18BPP_LE(src, x0, y1);
+			pix11 = gp_getpixel_raw_18BPP_LE(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB666(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB666(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB666(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB666(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB666(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB666(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB666(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB666(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB666(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB666(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB666(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB666(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_18BPP_LE(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB666(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB332(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_8BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_8BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_8BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_8BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB332(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB332(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB332(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB332(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB332(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB332(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB332(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB332(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB332(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB332(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB332(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB332(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_8BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB332(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linCMYK8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t K, K0, K1;
+			uint32_t Y, Y0, Y1;
+			uint32_t M, M0, M1;
+			uint32_t C, C0, C1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			K0 = GP_PIXEL_GET_K_CMYK8888(pix00) * (256 - xoff[x]);
+			Y0 = GP_PIXEL_GET_Y_CMYK8888(pix00) * (256 - xoff[x]);
+			M0 = GP_PIXEL_GET_M_CMYK8888(pix00) * (256 - xoff[x]);
+			C0 = GP_PIXEL_GET_C_CMYK8888(pix00) * (256 - xoff[x]);
+
+			K0 += GP_PIXEL_GET_K_CMYK8888(pix10) * xoff[x];
+			Y0 += GP_PIXEL_GET_Y_CMYK8888(pix10) * xoff[x];
+			M0 += GP_PIXEL_GET_M_CMYK8888(pix10) * xoff[x];
+			C0 += GP_PIXEL_GET_C_CMYK8888(pix10) * xoff[x];
+
+			K1 = GP_PIXEL_GET_K_CMYK8888(pix01) * (256 - xoff[x]);
+			Y1 = GP_PIXEL_GET_Y_CMYK8888(pix01) * (256 - xoff[x]);
+			M1 = GP_PIXEL_GET_M_CMYK8888(pix01) * (256 - xoff[x]);
+			C1 = GP_PIXEL_GET_C_CMYK8888(pix01) * (256 - xoff[x]);
+
+			K1 += GP_PIXEL_GET_K_CMYK8888(pix11) * xoff[x];
+			Y1 += GP_PIXEL_GET_Y_CMYK8888(pix11) * xoff[x];
+			M1 += GP_PIXEL_GET_M_CMYK8888(pix11) * xoff[x];
+			C1 += GP_PIXEL_GET_C_CMYK8888(pix11) * xoff[x];
+
+			K = (K1 * yoff[y] + K0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			Y = (Y1 * yoff[y] + Y0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			M = (M1 * yoff[y] + M0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			C = (C1 * yoff[y] + C0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_CMYK8888(K, Y, M, C));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG1(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_1BPP_LE(src, x0, y0);
+			pix10 = gp_getpixel_raw_1BPP_LE(src, x1, y0);
+			pix01 = gp_getpixel_raw_1BPP_LE(src, x0, y1);
+			pix11 = gp_getpixel_raw_1BPP_LE(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G1(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G1(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G1(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G1(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_1BPP_LE(dst, x, y,
+			                      GP_PIXEL_CREATE_G1(V));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG2(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_2BPP_LE(src, x0, y0);
+			pix10 = gp_getpixel_raw_2BPP_LE(src, x1, y0);
+			pix01 = gp_getpixel_raw_2BPP_LE(src, x0, y1);
+			pix11 = gp_getpixel_raw_2BPP_LE(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G2(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G2(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G2(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G2(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_2BPP_LE(dst, x, y,
+			                      GP_PIXEL_CREATE_G2(V));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG4(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_4BPP_LE(src, x0, y0);
+			pix10 = gp_getpixel_raw_4BPP_LE(src, x1, y0);
+			pix01 = gp_getpixel_raw_4BPP_LE(src, x0, y1);
+			pix11 = gp_getpixel_raw_4BPP_LE(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G4(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G4(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G4(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G4(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_4BPP_LE(dst, x, y,
+			                      GP_PIXEL_CREATE_G4(V));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG8(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_8BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_8BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_8BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_8BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G8(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G8(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G8(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G8(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_8BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_G8(V));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linGA88(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_GA88(pix00) * (256 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_GA88(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_GA88(pix10) * xoff[x];
+			A0 += GP_PIXEL_GET_A_GA88(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_GA88(pix01) * (256 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_GA88(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_GA88(pix11) * xoff[x];
+			A1 += GP_PIXEL_GET_A_GA88(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_GA88(V, A));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linG16(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t V, V0, V1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_16BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_16BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_16BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_16BPP(src, x1, y1);
+
+			V0 = GP_PIXEL_GET_V_G16(pix00) * (256 - xoff[x]);
+
+			V0 += GP_PIXEL_GET_V_G16(pix10) * xoff[x];
+
+			V1 = GP_PIXEL_GET_V_G16(pix01) * (256 - xoff[x]);
+
+			V1 += GP_PIXEL_GET_V_G16(pix11) * xoff[x];
+
+			V = (V1 * yoff[y] + V0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_16BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_G16(V));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGBA8888_PM(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_32BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_32BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_32BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_32BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGBA8888_PM(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGBA8888_PM(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGBA8888_PM(pix00) * (256 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_RGBA8888_PM(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGBA8888_PM(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGBA8888_PM(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGBA8888_PM(pix10) * xoff[x];
+			A0 += GP_PIXEL_GET_A_RGBA8888_PM(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGBA8888_PM(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGBA8888_PM(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGBA8888_PM(pix01) * (256 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_RGBA8888_PM(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGBA8888_PM(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGBA8888_PM(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGBA8888_PM(pix11) * xoff[x];
+			A1 += GP_PIXEL_GET_A_RGBA8888_PM(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_32BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGBA8888_PM(R, G, B, A));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGB161616(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_48BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_48BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_48BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_48BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGB161616(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGB161616(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGB161616(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGB161616(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGB161616(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGB161616(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGB161616(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGB161616(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGB161616(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGB161616(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGB161616(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGB161616(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_48BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGB161616(R, G, B));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_linRGBA16161616(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w + 1];
+	uint32_t ymap[dst->h + 1];
+	uint8_t  xoff[dst->w + 1];
+	uint8_t  yoff[dst->h + 1];
+	uint32_t x, y, i;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	uint32_t xstep = ((src->w - 1) << 16) / (dst->w - 1);
+
+	for (i = 0; i < dst->w + 1; i++) {
+		uint32_t val = i * xstep;
+		xmap[i] = val >> 16;
+		xoff[i] = (val >> 8) & 0xff;
+	}
+
+	uint32_t ystep = ((src->h - 1) << 16) / (dst->h - 1);
+
+	for (i = 0; i < dst->h + 1; i++) {
+		uint32_t val = i * ystep;
+		ymap[i] = val >> 16;
+		yoff[i] = (val >> 8) & 0xff;
+	}
+
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
+	for (y = 0; y < dst->h; y++) {
+		for (x = 0; x < dst->w; x++) {
+			gp_pixel pix00, pix01, pix10, pix11;
+			gp_coord x0, x1, y0, y1;
+			uint32_t R, R0, R1;
+			uint32_t G, G0, G1;
+			uint32_t B, B0, B1;
+			uint32_t A, A0, A1;
+
+			x0 = xmap[x];
+			x1 = xmap[x] + 1;
+
+			if (x1 >= (gp_coord)src->w)
+				x1 = src->w - 1;
+
+			y0 = ymap[y];
+			y1 = ymap[y] + 1;
+
+			if (y1 >= (gp_coord)src->h)
+				y1 = src->h - 1;
+
+			pix00 = gp_getpixel_raw_64BPP(src, x0, y0);
+			pix10 = gp_getpixel_raw_64BPP(src, x1, y0);
+			pix01 = gp_getpixel_raw_64BPP(src, x0, y1);
+			pix11 = gp_getpixel_raw_64BPP(src, x1, y1);
+
+			R0 = GP_PIXEL_GET_R_RGBA16161616(pix00) * (256 - xoff[x]);
+			G0 = GP_PIXEL_GET_G_RGBA16161616(pix00) * (256 - xoff[x]);
+			B0 = GP_PIXEL_GET_B_RGBA16161616(pix00) * (256 - xoff[x]);
+			A0 = GP_PIXEL_GET_A_RGBA16161616(pix00) * (256 - xoff[x]);
+
+			R0 += GP_PIXEL_GET_R_RGBA16161616(pix10) * xoff[x];
+			G0 += GP_PIXEL_GET_G_RGBA16161616(pix10) * xoff[x];
+			B0 += GP_PIXEL_GET_B_RGBA16161616(pix10) * xoff[x];
+			A0 += GP_PIXEL_GET_A_RGBA16161616(pix10) * xoff[x];
+
+			R1 = GP_PIXEL_GET_R_RGBA16161616(pix01) * (256 - xoff[x]);
+			G1 = GP_PIXEL_GET_G_RGBA16161616(pix01) * (256 - xoff[x]);
+			B1 = GP_PIXEL_GET_B_RGBA16161616(pix01) * (256 - xoff[x]);
+			A1 = GP_PIXEL_GET_A_RGBA16161616(pix01) * (256 - xoff[x]);
+
+			R1 += GP_PIXEL_GET_R_RGBA16161616(pix11) * xoff[x];
+			G1 += GP_PIXEL_GET_G_RGBA16161616(pix11) * xoff[x];
+			B1 += GP_PIXEL_GET_B_RGBA16161616(pix11) * xoff[x];
+			A1 += GP_PIXEL_GET_A_RGBA16161616(pix11) * xoff[x];
+
+			R = (R1 * yoff[y] + R0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			G = (G1 * yoff[y] + G0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			B = (B1 * yoff[y] + B0 * (256 - yoff[y]) + (1<<15)) >> 16;
+			A = (A1 * yoff[y] + A0 * (256 - yoff[y]) + (1<<15)) >> 16;
+
+			gp_putpixel_raw_64BPP(dst, x, y,
+			                      GP_PIXEL_CREATE_RGBA16161616(R, G, B, A));
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_lin(const gp_pixmap *src, gp_pixmap *dst,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return resize_linxRGB8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return resize_linRGBA8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return resize_linRGB888(src, dst, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return resize_linBGR888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return resize_linRGB555(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return resize_linRGB565(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return resize_linRGB666(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return resize_linRGB332(src, dst, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return resize_linCMYK8888(src, dst, callback);
+	break;
+	case GP_PIXEL_G1:
+		return resize_linG1(src, dst, callback);
+	break;
+	case GP_PIXEL_G2:
+		return resize_linG2(src, dst, callback);
+	break;
+	case GP_PIXEL_G4:
+		return resize_linG4(src, dst, callback);
+	break;
+	case GP_PIXEL_G8:
+		return resize_linG8(src, dst, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return resize_linGA88(src, dst, callback);
+	break;
+	case GP_PIXEL_G16:
+		return resize_linG16(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return resize_linRGBA8888_PM(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB161616:
+		return resize_linRGB161616(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		return resize_linRGBA16161616(src, dst, callback);
+	break;
+	default:
+		GP_WARN("Invalid pixel type %s",
+		        gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+int gp_filter_resize_linear_int(const gp_pixmap *src, gp_pixmap *dst,
+                                gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return resize_lin(src, dst, callback);
+}
+
+static int resize_lin_lf(const gp_pixmap *src, gp_pixmap *dst,
+                          gp_progress_cb *callback)
+{
+	float x_rat = 1.00 * dst->w / src->w;
+	float y_rat = 1.00 * dst->h / src->h;
+
+	if (x_rat < 1.00 && y_rat < 1.00) {
+
+		GP_DEBUG(1, "Downscaling image %ux%u -> %ux%u %2.2f %2.2f",
+	                     src->w, src->h, dst->w, dst->h, x_rat, y_rat);
+
+		switch (src->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			return resize_lin_lf_xRGB8888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGBA8888:
+			return resize_lin_lf_RGBA8888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB888:
+			return resize_lin_lf_RGB888(src, dst, callback);
+		break;
+		case GP_PIXEL_BGR888:
+			return resize_lin_lf_BGR888(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB555:
+			return resize_lin_lf_RGB555(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB565:
+			return resize_lin_lf_RGB565(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB666:
+			return resize_lin_lf_RGB666(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB332:
+			return resize_lin_lf_RGB332(src, dst, callback);
+		break;
+		case GP_PIXEL_CMYK8888:
+			return resize_lin_lf_CMYK8888(src, dst, callback);
+		break;
+		case GP_PIXEL_G1:
+			return resize_lin_lf_G1(src, dst, callback);
+		break;
+		case GP_PIXEL_G2:
+			return resize_lin_lf_G2(src, dst, callback);
+		break;
+		case GP_PIXEL_G4:
+			return resize_lin_lf_G4(src, dst, callback);
+		break;
+		case GP_PIXEL_G8:
+			return resize_lin_lf_G8(src, dst, callback);
+		break;
+		case GP_PIXEL_GA88:
+			return resize_lin_lf_GA88(src, dst, callback);
+		break;
+		case GP_PIXEL_G16:
+			return resize_lin_lf_G16(src, dst, callback);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			return resize_lin_lf_RGBA8888_PM(src, dst, callback);
+		break;
+		case GP_PIXEL_RGB161616:
+			return resize_lin_lf_RGB161616(src, dst, callback);
+		break;
+		case GP_PIXEL_RGBA16161616:
+			return resize_lin_lf_RGBA16161616(src, dst, callback);
+		break;
+		default:
+			GP_WARN("Invalid pixel type %s",
+			        gp_pixel_type_name(src->pixel_type));
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	//TODO: x_rat > 1.00 && y_rat < 1.00
+	//TODO: x_rat < 1.00 && y_rat > 1.00
+
+	return resize_lin(src, dst, callback);
+}
+
+int gp_filter_resize_linear_lf_int(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	return resize_lin_lf(src, dst, callback);
+}
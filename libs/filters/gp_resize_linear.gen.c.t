@@ -23,12 +23,19 @@ for (x = 0; x < src->w; x++) {
 }
 @ end
 @
+@ # The sums overflow 32 bits for more than 8 bits per channel
+@ def sum_type(pt):
+@     if pt.chanslist[0].size > 8:
+@         return 'uint64_t'
+@     return 'uint32_t'
+@ end
+@
 @ def sum_rows(pt, mult):
 for (x = 0; x < dst->w; x++) {
 	/* Get first left pixel */
 @     for c in pt.chanslist:
-	uint32_t {{ c.name }}_middle = 0;
-	uint32_t {{ c.name }}_first = {{ c.name }}[xmap[x]] * (MULT - xoff[x]);
+	{{ sum_type(pt) }} {{ c.name }}_middle = 0;
+	{{ sum_type(pt) }} {{ c.name }}_first = {{ c.name }}[xmap[x]] * (MULT - xoff[x]);
 @     end
 	/* Sum middle pixels */
 	for (j = xmap[x]+1; j < xmap[x+1]; j++) {
@@ -57,16 +64,11 @@ static int resize_lin_lf_{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 @         for c in pt.chanslist:
 	uint32_t {{ c.name }}[src->w];
 @         end
+	uint32_t xarea[dst->w];
 	uint32_t x, y;
 	uint32_t i, j;
-@ # Reduce fixed point bits for > 8 bits per channel (fixed 16 bit Grayscale)
-@         if pt.chanslist[0].size > 8:
-	const int MULT=1<<10;
-	const int DIV=1<<6;
-@         else:
 	const int MULT=1<<14;
 	const int DIV=1<<9;
-@         end
 
 	/* Pre-compute mapping for interpolation */
 	for (i = 0; i <= dst->w; i++) {
@@ -79,15 +81,20 @@ static int resize_lin_lf_{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 		yoff[i] = ((uint64_t)MULT * (i * src->h))/dst->h - MULT * ymap[i];
 	}
 
-	/* Compute pixel area for the final normalization */
-	uint32_t div = (((uint64_t)(xmap[1] * MULT + xoff[1]) * ((uint64_t)ymap[1] * MULT + yoff[1]) + DIV/2) / DIV + DIV/2)/DIV;
+	/*
+	 * Compute pixel areas for the final normalization, these differ by the
+	 * rounding in the offsets, which is visible with 16 bits per channel.
+	 */
+	for (i = 0; i < dst->w; i++)
+		xarea[i] = (xmap[i+1] - xmap[i]) * MULT + xoff[i+1] - xoff[i];
 
 	/* Prefetch first row */
 	{@ fetch_rows(pt, 0) @}
 
 	for (y = 0; y < dst->h; y++) {
+		uint32_t yarea = (ymap[y+1] - ymap[y]) * MULT + yoff[y+1] - yoff[y];
 @         for c in pt.chanslist:
-		uint32_t {{ c.name }}_res[dst->w];
+		{{ sum_type(pt) }} {{ c.name }}_res[dst->w];
 @         end
 
 @         for c in pt.chanslist:
@@ -110,8 +117,9 @@ static int resize_lin_lf_{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 		}
 
 		for (x = 0; x < dst->w; x++) {
+			uint64_t area = (uint64_t)xarea[x] * yarea;
 @         for c in pt.chanslist:
-			uint32_t {{ c.name }}_p = ({{ c.name }}_res[x] + div/2) / div;
+			uint32_t {{ c.name }}_p = ((uint64_t){{ c.name }}_res[x] * DIV * DIV + area/2) / area;
 @         end
                         gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y,
 				GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, '', '_p') }}));
@@ -159,7 +167,11 @@ static int resize_lin{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 		yoff[i] = (val >> 8) & 0xff;
 	}
 
-	/* Interpolate */
+	/*
+	 * Interpolate, the weights add up to 256 in each direction so that the
+	 * result is exactly 16 bits shifted, the sum fits into 32 bits even for
+	 * 16 bits per channel.
+	 */
 	for (y = 0; y < dst->h; y++) {
 		for (x = 0; x < dst->w; x++) {
 			gp_pixel pix00, pix01, pix10, pix11;
@@ -186,7 +198,7 @@ static int resize_lin{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 			pix11 = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, x1, y1);
 
 @         for c in pt.chanslist:
-			{{ c.name }}0 = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix00) * (255 - xoff[x]);
+			{{ c.name }}0 = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix00) * (256 - xoff[x]);
 @         end
 
 @         for c in pt.chanslist:
@@ -194,7 +206,7 @@ static int resize_lin{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 @         end
 
 @         for c in pt.chanslist:
-			{{ c.name }}1 = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix01) * (255 - xoff[x]);
+			{{ c.name }}1 = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix01) * (256 - xoff[x]);
 @         end
 
 @         for c in pt.chanslist:
@@ -202,7 +214,7 @@ static int resize_lin{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 @         end
 
 @         for c in pt.chanslist:
-			{{ c.name }} = ({{ c.name }}1 * yoff[y] + {{ c.name }}0 * (255 - yoff[y]) + (1<<15)) >> 16;
+			{{ c.name }} = ({{ c.name }}1 * yoff[y] + {{ c.name }}0 * (256 - yoff[y]) + (1<<15)) >> 16;
 @         end
 
 			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y,
@@ -246,6 +258,9 @@ int gp_filter_resize_linear_int(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return resize_lin(src, dst, callback);
 }
 
@@ -290,5 +305,8 @@ int gp_filter_resize_linear_lf_int(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return resize_lin_lf(src, dst, callback);
 }
@@ -77,5 +77,8 @@ int gp_filter_resize_nn(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return resize_nn(src, dst, callback);
 }
@@ -9,48 +9,107 @@
 #include <core/gp_clamp.h>
 #include <core/gp_debug.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
 #include <filters/gp_rotate.h>
 
-int gp_filter_mirror_v_raw(const gp_pixmap *src, gp_pixmap *dst,
-                           gp_progress_cb *callback)
-{
-	uint32_t bpr = src->bytes_per_row;
-	uint8_t  buf[bpr];
-	unsigned int y;
-
-	GP_DEBUG(1, "Mirroring image %ux%u vertically", src->w, src->h);
+struct mirror_v_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	uint32_t bpr;
+};
 
-	#warning FIXME: non byte aligned pixels
+/*
+ * Swaps pairs of rows from the top and bottom, works both for src != dst and
+ * src == dst.
+ */
+static int mirror_v_tile(const gp_tile *tile, void *ppriv,
+                         gp_progress_cb *callback)
+{
+	struct mirror_v_priv *priv = ppriv;
+	const gp_pixmap *src = priv->src;
+	gp_pixmap *dst = priv->dst;
+	uint32_t bpr = priv->bpr;
+	uint8_t *buf = NULL;
+	gp_size i;
+
+	if (src == dst) {
+		buf = gp_temp_alloc(bpr);
+		if (!buf) {
+			GP_WARN("Malloc failed :(");
+			errno = ENOMEM;
+			return 1;
+		}
+	}
 
-	/* Note that this should work both for src != dst and src == dst */
-	for (y = 0; y < src->h/2; y++) {
+	for (i = 0; i < tile->h; i++) {
+		gp_coord y = tile->y + i;
+		gp_coord yr = src->h - y - 1;
 		uint8_t *sl1 = GP_PIXEL_ADDR(src, 0, y);
-		uint8_t *sl2 = GP_PIXEL_ADDR(src, 0, src->h - y - 1);
+		uint8_t *sl2 = GP_PIXEL_ADDR(src, 0, yr);
 		uint8_t *dl1 = GP_PIXEL_ADDR(dst, 0, y);
-		uint8_t *dl2 = GP_PIXEL_ADDR(dst, 0, src->h - y - 1);
-
-		memcpy(buf, sl1, bpr);
-		memcpy(dl1, sl2, bpr);
-		memcpy(dl2, buf, bpr);
+		uint8_t *dl2 = GP_PIXEL_ADDR(dst, 0, yr);
+
+		if (src == dst) {
+			/* The middle odd line stays in place */
+			if (y != yr) {
+				memcpy(buf, sl1, bpr);
+				memcpy(dl1, sl2, bpr);
+				memcpy(dl2, buf, bpr);
+			}
+		} else {
+			memcpy(dl1, sl2, bpr);
+			memcpy(dl2, sl1, bpr);
+		}
 
-		if (gp_progress_cb_report(callback, 2 * y, src->h, src->w)) {
-			GP_DEBUG(1, "Operation aborted");
+		if (gp_progress_cb_report(callback, i, tile->h, tile->w)) {
+			if (buf)
+				gp_temp_free(bpr, buf);
 			errno = ECANCELED;
 			return 1;
 		}
 	}
 
-	/* Copy the middle odd line */
-	if (src != dst && src->h % 2) {
-		y = src->h / 2;
+	if (buf)
+		gp_temp_free(bpr, buf);
+
+	return 0;
+}
+
+int gp_filter_mirror_v_raw(const gp_pixmap *src, gp_pixmap *dst,
+                           gp_progress_cb *callback)
+{
+	struct mirror_v_priv priv = {
+		.src = src,
+		.dst = dst,
+		.bpr = GP_CALC_ROW_SIZE(src->pixel_type, src->w),
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = (src->h + 1) / 2,
+		.bpp = src->bpp,
+		.name = "mirror_v",
+		.pixel_type = src->pixel_type,
+		/* Rows are copied as a whole */
+		.min_w = src->w,
+		.fn = mirror_v_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	GP_DEBUG(1, "Mirroring image %ux%u vertically", src->w, src->h);
 
-		uint8_t *sl = GP_PIXEL_ADDR(src, 0, y);
-		uint8_t *dl = GP_PIXEL_ADDR(dst, 0, y);
+	if (gp_pixmap_unshare(dst))
+		return 1;
 
-		memcpy(dl, sl, bpr);
+	#warning FIXME: non byte aligned pixels
+
+	if (gp_tiles_run(&tiles)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
 	}
 
-	gp_progress_cb_done(callback);
 	return 0;
 }
 
@@ -0,0 +1,1668 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_rotate.gen.c
+ *
+ * GENERATED on 2026 10 17 02:02:05 from gp_rotate.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Rotations by 90, 180 and 270 degrees
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
+#include <core/gp_cpu.h>
+#include <filters/gp_rotate.h>
+
+/*
+ * The 90 and 270 degree rotations are transpositions with one of the axes
+ * reversed. The source is split into tiles and each tile is processed in
+ * columns of BLOCK_W pixels so that the destination rows written by a column
+ * stay in cache.
+ *
+ * Byte aligned pixels that fit into a 16 byte vector n times are transposed
+ * in n x n blocks in SIMD registers.
+ */
+#define BLOCK_W 64
+
+#ifdef __clang__
+# define SHUFFLE(a, b, ...) __builtin_shufflevector(a, b, __VA_ARGS__)
+#else
+# define SHUFFLE(a, b, ...) __builtin_shuffle(a, b, (__typeof__(a)){__VA_ARGS__})
+#endif
+
+typedef uint8_t v_8BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 16x16 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_8BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_8BPP r[16], t[16];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+	memcpy(&r[4], src + 4 * src_step, 16);
+	memcpy(&r[5], src + 5 * src_step, 16);
+	memcpy(&r[6], src + 6 * src_step, 16);
+	memcpy(&r[7], src + 7 * src_step, 16);
+	memcpy(&r[8], src + 8 * src_step, 16);
+	memcpy(&r[9], src + 9 * src_step, 16);
+	memcpy(&r[10], src + 10 * src_step, 16);
+	memcpy(&r[11], src + 11 * src_step, 16);
+	memcpy(&r[12], src + 12 * src_step, 16);
+	memcpy(&r[13], src + 13 * src_step, 16);
+	memcpy(&r[14], src + 14 * src_step, 16);
+	memcpy(&r[15], src + 15 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[1] = SHUFFLE(r[0], r[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[2] = SHUFFLE(r[1], r[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[3] = SHUFFLE(r[1], r[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[4] = SHUFFLE(r[2], r[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[5] = SHUFFLE(r[2], r[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[6] = SHUFFLE(r[3], r[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[7] = SHUFFLE(r[3], r[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[8] = SHUFFLE(r[4], r[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[9] = SHUFFLE(r[4], r[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[10] = SHUFFLE(r[5], r[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[11] = SHUFFLE(r[5], r[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[12] = SHUFFLE(r[6], r[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[13] = SHUFFLE(r[6], r[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[14] = SHUFFLE(r[7], r[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[15] = SHUFFLE(r[7], r[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	r[0] = SHUFFLE(t[0], t[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[1] = SHUFFLE(t[0], t[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[2] = SHUFFLE(t[1], t[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[3] = SHUFFLE(t[1], t[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[4] = SHUFFLE(t[2], t[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[5] = SHUFFLE(t[2], t[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[6] = SHUFFLE(t[3], t[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[7] = SHUFFLE(t[3], t[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[8] = SHUFFLE(t[4], t[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[9] = SHUFFLE(t[4], t[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[10] = SHUFFLE(t[5], t[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[11] = SHUFFLE(t[5], t[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[12] = SHUFFLE(t[6], t[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[13] = SHUFFLE(t[6], t[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[14] = SHUFFLE(t[7], t[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[15] = SHUFFLE(t[7], t[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	t[0] = SHUFFLE(r[0], r[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[1] = SHUFFLE(r[0], r[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[2] = SHUFFLE(r[1], r[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[3] = SHUFFLE(r[1], r[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[4] = SHUFFLE(r[2], r[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[5] = SHUFFLE(r[2], r[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[6] = SHUFFLE(r[3], r[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[7] = SHUFFLE(r[3], r[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[8] = SHUFFLE(r[4], r[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[9] = SHUFFLE(r[4], r[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[10] = SHUFFLE(r[5], r[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[11] = SHUFFLE(r[5], r[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[12] = SHUFFLE(r[6], r[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[13] = SHUFFLE(r[6], r[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	t[14] = SHUFFLE(r[7], r[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	t[15] = SHUFFLE(r[7], r[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	r[0] = SHUFFLE(t[0], t[8], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[1] = SHUFFLE(t[0], t[8], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[2] = SHUFFLE(t[1], t[9], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[3] = SHUFFLE(t[1], t[9], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[4] = SHUFFLE(t[2], t[10], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[5] = SHUFFLE(t[2], t[10], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[6] = SHUFFLE(t[3], t[11], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[7] = SHUFFLE(t[3], t[11], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[8] = SHUFFLE(t[4], t[12], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[9] = SHUFFLE(t[4], t[12], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[10] = SHUFFLE(t[5], t[13], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[11] = SHUFFLE(t[5], t[13], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[12] = SHUFFLE(t[6], t[14], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[13] = SHUFFLE(t[6], t[14], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	r[14] = SHUFFLE(t[7], t[15], 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	r[15] = SHUFFLE(t[7], t[15], 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+
+	memcpy(dst + 0 * dst_step, &r[0], 16);
+	memcpy(dst + 1 * dst_step, &r[1], 16);
+	memcpy(dst + 2 * dst_step, &r[2], 16);
+	memcpy(dst + 3 * dst_step, &r[3], 16);
+	memcpy(dst + 4 * dst_step, &r[4], 16);
+	memcpy(dst + 5 * dst_step, &r[5], 16);
+	memcpy(dst + 6 * dst_step, &r[6], 16);
+	memcpy(dst + 7 * dst_step, &r[7], 16);
+	memcpy(dst + 8 * dst_step, &r[8], 16);
+	memcpy(dst + 9 * dst_step, &r[9], 16);
+	memcpy(dst + 10 * dst_step, &r[10], 16);
+	memcpy(dst + 11 * dst_step, &r[11], 16);
+	memcpy(dst + 12 * dst_step, &r[12], 16);
+	memcpy(dst + 13 * dst_step, &r[13], 16);
+	memcpy(dst + 14 * dst_step, &r[14], 16);
+	memcpy(dst + 15 * dst_step, &r[15], 16);
+}
+
+typedef uint16_t v_16BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 8x8 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_16BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_16BPP r[8], t[8];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+	memcpy(&r[4], src + 4 * src_step, 16);
+	memcpy(&r[5], src + 5 * src_step, 16);
+	memcpy(&r[6], src + 6 * src_step, 16);
+	memcpy(&r[7], src + 7 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[1] = SHUFFLE(r[0], r[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[2] = SHUFFLE(r[1], r[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[3] = SHUFFLE(r[1], r[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[4] = SHUFFLE(r[2], r[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[5] = SHUFFLE(r[2], r[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[6] = SHUFFLE(r[3], r[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[7] = SHUFFLE(r[3], r[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	r[0] = SHUFFLE(t[0], t[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[1] = SHUFFLE(t[0], t[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[2] = SHUFFLE(t[1], t[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[3] = SHUFFLE(t[1], t[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[4] = SHUFFLE(t[2], t[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[5] = SHUFFLE(t[2], t[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	r[6] = SHUFFLE(t[3], t[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	r[7] = SHUFFLE(t[3], t[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	t[0] = SHUFFLE(r[0], r[4], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[1] = SHUFFLE(r[0], r[4], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[2] = SHUFFLE(r[1], r[5], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[3] = SHUFFLE(r[1], r[5], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[4] = SHUFFLE(r[2], r[6], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[5] = SHUFFLE(r[2], r[6], 4, 12, 5, 13, 6, 14, 7, 15);
+	t[6] = SHUFFLE(r[3], r[7], 0, 8, 1, 9, 2, 10, 3, 11);
+	t[7] = SHUFFLE(r[3], r[7], 4, 12, 5, 13, 6, 14, 7, 15);
+
+	memcpy(dst + 0 * dst_step, &t[0], 16);
+	memcpy(dst + 1 * dst_step, &t[1], 16);
+	memcpy(dst + 2 * dst_step, &t[2], 16);
+	memcpy(dst + 3 * dst_step, &t[3], 16);
+	memcpy(dst + 4 * dst_step, &t[4], 16);
+	memcpy(dst + 5 * dst_step, &t[5], 16);
+	memcpy(dst + 6 * dst_step, &t[6], 16);
+	memcpy(dst + 7 * dst_step, &t[7], 16);
+}
+
+typedef uint32_t v_32BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 4x4 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_32BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_32BPP r[4], t[4];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+	memcpy(&r[2], src + 2 * src_step, 16);
+	memcpy(&r[3], src + 3 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[2], 0, 4, 1, 5);
+	t[1] = SHUFFLE(r[0], r[2], 2, 6, 3, 7);
+	t[2] = SHUFFLE(r[1], r[3], 0, 4, 1, 5);
+	t[3] = SHUFFLE(r[1], r[3], 2, 6, 3, 7);
+
+	r[0] = SHUFFLE(t[0], t[2], 0, 4, 1, 5);
+	r[1] = SHUFFLE(t[0], t[2], 2, 6, 3, 7);
+	r[2] = SHUFFLE(t[1], t[3], 0, 4, 1, 5);
+	r[3] = SHUFFLE(t[1], t[3], 2, 6, 3, 7);
+
+	memcpy(dst + 0 * dst_step, &r[0], 16);
+	memcpy(dst + 1 * dst_step, &r[1], 16);
+	memcpy(dst + 2 * dst_step, &r[2], 16);
+	memcpy(dst + 3 * dst_step, &r[3], 16);
+}
+
+typedef uint64_t v_64BPP __attribute__((vector_size(16)));
+
+/*
+ * Transposes 2x2 block, the steps are distances between rows in bytes.
+ */
+static inline void transpose_64BPP(uint8_t *dst, ptrdiff_t dst_step,
+                                        const uint8_t *src, ptrdiff_t src_step)
+{
+	v_64BPP r[2], t[2];
+
+	memcpy(&r[0], src + 0 * src_step, 16);
+	memcpy(&r[1], src + 1 * src_step, 16);
+
+	t[0] = SHUFFLE(r[0], r[1], 0, 2);
+	t[1] = SHUFFLE(r[0], r[1], 1, 3);
+
+	memcpy(dst + 0 * dst_step, &t[0], 16);
+	memcpy(dst + 1 * dst_step, &t[1], 16);
+}
+
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_1BPP_LE(dst, src->h - 1 - (y), x, gp_getpixel_raw_1BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_1BPP_BE(dst, src->h - 1 - (y), x, gp_getpixel_raw_1BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_2BPP_LE(dst, src->h - 1 - (y), x, gp_getpixel_raw_2BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_2BPP_BE(dst, src->h - 1 - (y), x, gp_getpixel_raw_2BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_4BPP_LE(dst, src->h - 1 - (y), x, gp_getpixel_raw_4BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_4BPP_BE(dst, src->h - 1 - (y), x, gp_getpixel_raw_4BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 16 <= y1; y += 16) {
+		for (x = x0; x + 16 <= x1; x += 16) {
+			transpose_8BPP((uint8_t*)GP_PIXEL_ADDR_8BPP(dst, src->h - y - 16, x),
+			                 dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_8BPP(src, x, y + 15),
+			                 -(ptrdiff_t)src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 16; i++)
+				memcpy(GP_PIXEL_ADDR_8BPP(dst, src->h - 1 - (y + i), x), GP_PIXEL_ADDR_8BPP(src, x, y + i), 1);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_8BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_8BPP(src, x, y), 1);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 8 <= y1; y += 8) {
+		for (x = x0; x + 8 <= x1; x += 8) {
+			transpose_16BPP((uint8_t*)GP_PIXEL_ADDR_16BPP(dst, src->h - y - 8, x),
+			                 dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_16BPP(src, x, y + 7),
+			                 -(ptrdiff_t)src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 8; i++)
+				memcpy(GP_PIXEL_ADDR_16BPP(dst, src->h - 1 - (y + i), x), GP_PIXEL_ADDR_16BPP(src, x, y + i), 2);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_16BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_16BPP(src, x, y), 2);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_24BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_24BPP(src, x, y), 3);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 4 <= y1; y += 4) {
+		for (x = x0; x + 4 <= x1; x += 4) {
+			transpose_32BPP((uint8_t*)GP_PIXEL_ADDR_32BPP(dst, src->h - y - 4, x),
+			                 dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_32BPP(src, x, y + 3),
+			                 -(ptrdiff_t)src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 4; i++)
+				memcpy(GP_PIXEL_ADDR_32BPP(dst, src->h - 1 - (y + i), x), GP_PIXEL_ADDR_32BPP(src, x, y + i), 4);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_32BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_32BPP(src, x, y), 4);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_48BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_48BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_48BPP(src, x, y), 6);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_64BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 2 <= y1; y += 2) {
+		for (x = x0; x + 2 <= x1; x += 2) {
+			transpose_64BPP((uint8_t*)GP_PIXEL_ADDR_64BPP(dst, src->h - y - 2, x),
+			                 dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_64BPP(src, x, y + 1),
+			                 -(ptrdiff_t)src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 2; i++)
+				memcpy(GP_PIXEL_ADDR_64BPP(dst, src->h - 1 - (y + i), x), GP_PIXEL_ADDR_64BPP(src, x, y + i), 8);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_64BPP(dst, src->h - 1 - (y), x), GP_PIXEL_ADDR_64BPP(src, x, y), 8);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_90_rect_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_18BPP_LE(dst, src->h - 1 - (y), x, gp_getpixel_raw_18BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_1BPP_LE(dst, y, src->w - 1 - (x), gp_getpixel_raw_1BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_1BPP_BE(dst, y, src->w - 1 - (x), gp_getpixel_raw_1BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_2BPP_LE(dst, y, src->w - 1 - (x), gp_getpixel_raw_2BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_2BPP_BE(dst, y, src->w - 1 - (x), gp_getpixel_raw_2BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_4BPP_LE(dst, y, src->w - 1 - (x), gp_getpixel_raw_4BPP_LE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_4BPP_BE(dst, y, src->w - 1 - (x), gp_getpixel_raw_4BPP_BE(src, x, y));
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 16 <= y1; y += 16) {
+		for (x = x0; x + 16 <= x1; x += 16) {
+			transpose_8BPP((uint8_t*)GP_PIXEL_ADDR_8BPP(dst, y, src->w - 1 - x),
+			                 -(ptrdiff_t)dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_8BPP(src, x, y),
+			                 src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 16; i++)
+				memcpy(GP_PIXEL_ADDR_8BPP(dst, y + i, src->w - 1 - (x)), GP_PIXEL_ADDR_8BPP(src, x, y + i), 1);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_8BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_8BPP(src, x, y), 1);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 8 <= y1; y += 8) {
+		for (x = x0; x + 8 <= x1; x += 8) {
+			transpose_16BPP((uint8_t*)GP_PIXEL_ADDR_16BPP(dst, y, src->w - 1 - x),
+			                 -(ptrdiff_t)dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_16BPP(src, x, y),
+			                 src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 8; i++)
+				memcpy(GP_PIXEL_ADDR_16BPP(dst, y + i, src->w - 1 - (x)), GP_PIXEL_ADDR_16BPP(src, x, y + i), 2);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_16BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_16BPP(src, x, y), 2);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_24BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_24BPP(src, x, y), 3);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 4 <= y1; y += 4) {
+		for (x = x0; x + 4 <= x1; x += 4) {
+			transpose_32BPP((uint8_t*)GP_PIXEL_ADDR_32BPP(dst, y, src->w - 1 - x),
+			                 -(ptrdiff_t)dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_32BPP(src, x, y),
+			                 src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 4; i++)
+				memcpy(GP_PIXEL_ADDR_32BPP(dst, y + i, src->w - 1 - (x)), GP_PIXEL_ADDR_32BPP(src, x, y + i), 4);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_32BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_32BPP(src, x, y), 4);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_48BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_48BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_48BPP(src, x, y), 6);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_64BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	gp_coord i;
+
+	for (y = y0; y + 2 <= y1; y += 2) {
+		for (x = x0; x + 2 <= x1; x += 2) {
+			transpose_64BPP((uint8_t*)GP_PIXEL_ADDR_64BPP(dst, y, src->w - 1 - x),
+			                 -(ptrdiff_t)dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_64BPP(src, x, y),
+			                 src->bytes_per_row);
+		}
+
+		for (; x < x1; x++) {
+			for (i = 0; i < 2; i++)
+				memcpy(GP_PIXEL_ADDR_64BPP(dst, y + i, src->w - 1 - (x)), GP_PIXEL_ADDR_64BPP(src, x, y + i), 8);
+		}
+	}
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			memcpy(GP_PIXEL_ADDR_64BPP(dst, y, src->w - 1 - (x)), GP_PIXEL_ADDR_64BPP(src, x, y), 8);
+	}
+}
+
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_270_rect_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	gp_coord x, y;
+	y = y0;
+
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			gp_putpixel_raw_18BPP_LE(dst, y, src->w - 1 - (x), gp_getpixel_raw_18BPP_LE(src, x, y));
+	}
+}
+
+struct rotate_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	void (*rect)(const gp_pixmap *src, gp_pixmap *dst,
+	             gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1);
+};
+
+static int rotate_tile(const gp_tile *tile, void *ppriv,
+                       gp_progress_cb *callback)
+{
+	struct rotate_priv *priv = ppriv;
+	gp_coord x, x1 = tile->x + tile->w;
+
+	for (x = tile->x; x < x1; x += BLOCK_W) {
+		priv->rect(priv->src, priv->dst, x, tile->y,
+		           GP_MIN(x + BLOCK_W, x1), tile->y + tile->h);
+
+		if (gp_progress_cb_report(callback, x - tile->x, tile->w, tile->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static void rotate_90_rect(const gp_pixmap *src, gp_pixmap *dst,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	GP_FN_PER_BPP_PIXMAP(rotate_90_rect, src, src, dst, x0, y0, x1, y1);
+}
+
+static int rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	struct rotate_priv priv = {
+		.src = src,
+		.dst = dst,
+		.rect = rotate_90_rect,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = src->h,
+		.bpp = src->bpp,
+		.name = "rotate_90",
+		.pixel_type = src->pixel_type,
+		.min_w = BLOCK_W,
+		.min_h = BLOCK_W,
+		.fn = rotate_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	/*
+	 * Source columns are destination rows, pixels smaller than byte may
+	 * share bytes, hence such destination rows must not be split.
+	 */
+	if (src->bpp % 8)
+		tiles.min_h = src->h;
+
+	return gp_tiles_run(&tiles);
+}
+
+int gp_filter_rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (rotate_90(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_90_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_90(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+static void rotate_270_rect(const gp_pixmap *src, gp_pixmap *dst,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	GP_FN_PER_BPP_PIXMAP(rotate_270_rect, src, src, dst, x0, y0, x1, y1);
+}
+
+static int rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	struct rotate_priv priv = {
+		.src = src,
+		.dst = dst,
+		.rect = rotate_270_rect,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = src->h,
+		.bpp = src->bpp,
+		.name = "rotate_270",
+		.pixel_type = src->pixel_type,
+		.min_w = BLOCK_W,
+		.min_h = BLOCK_W,
+		.fn = rotate_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	/*
+	 * Source columns are destination rows, pixels smaller than byte may
+	 * share bytes, hence such destination rows must not be split.
+	 */
+	if (src->bpp % 8)
+		tiles.min_h = src->h;
+
+	return gp_tiles_run(&tiles);
+}
+
+int gp_filter_rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (rotate_270(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_270_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_270(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 8 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_8BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 8 <= n; x += 8) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 8) * 1, 8);
+		v = __builtin_bswap64(v);
+		memcpy(dst + x * 1, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 1, src + (n - x - 1) * 1, 1);
+}
+
+/*
+ * The compilers do not vectorize reversal of small integers well, instead
+ * 4 pixels are reversed at a time by a 64 bit byte swap.
+ */
+static void reverse_row_16BPP(uint8_t *restrict dst,
+                                  const uint8_t *restrict src, gp_size w)
+{
+	size_t x, n = w;
+
+	for (x = 0; x + 4 <= n; x += 4) {
+		uint64_t v;
+
+		memcpy(&v, src + (n - x - 4) * 2, 8);
+		v = __builtin_bswap64(v);
+		v = ((v >> 8) & 0x00ff00ff00ff00ffull) | ((v & 0x00ff00ff00ff00ffull) << 8);
+		memcpy(dst + x * 2, &v, 8);
+	}
+
+	for (; x < n; x++)
+		memcpy(dst + x * 2, src + (n - x - 1) * 2, 2);
+}
+
+static void reverse_row_24BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 3;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 3);
+		dst += 3;
+		src -= 3;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_32BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint32_t *d = (void*)dst;
+	const uint32_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_32BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_32BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_32BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_32BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_32BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_32BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_resolve;
+
+static void reverse_row_32BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_32BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_32BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_32BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_32BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_32BPP()", variant);
+
+	__atomic_store_n(&reverse_row_32BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_32BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_32BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+static void reverse_row_48BPP(uint8_t *restrict dst,
+                                   const uint8_t *restrict src, gp_size w)
+{
+	gp_size x;
+
+	src += (size_t)(w - 1) * 6;
+
+	for (x = 0; x < w; x++) {
+		memcpy(dst, src, 6);
+		dst += 6;
+		src -= 6;
+	}
+}
+
+GP_SIMD_BODY void reverse_row_64BPP_body(uint8_t *restrict dst,
+                                             const uint8_t *restrict src,
+                                             gp_size w)
+{
+	uint64_t *d = (void*)dst;
+	const uint64_t *s = (const void*)src;
+	gp_size x;
+
+	for (x = 0; x < w; x++)
+		d[x] = s[w - 1 - x];
+}
+
+GP_SIMD_VARIANT
+static void reverse_row_64BPP_generic(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("sse2")))
+static void reverse_row_64BPP_sse2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+GP_SIMD_VARIANT __attribute__((target("avx2")))
+static void reverse_row_64BPP_avx2(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+GP_SIMD_VARIANT __attribute__((target("fpu=neon")))
+static void reverse_row_64BPP_neon(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	reverse_row_64BPP_body(dst, src, w);
+}
+#endif
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w);
+
+static void (*reverse_row_64BPP_fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_resolve;
+
+static void reverse_row_64BPP_resolve(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	unsigned int flags __attribute__((unused)) = gp_cpu_flags();
+	void (*fn)(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w) = reverse_row_64BPP_generic;
+	const char *variant = "generic";
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_SSE2) {
+		fn = reverse_row_64BPP_sse2;
+		variant = "sse2";
+	}
+#endif
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	if (flags & GP_CPU_AVX2) {
+		fn = reverse_row_64BPP_avx2;
+		variant = "avx2";
+	}
+#endif
+#if defined(__GNUC__) && defined(__arm__) && !defined(__aarch64__)
+	if (flags & GP_CPU_NEON) {
+		fn = reverse_row_64BPP_neon;
+		variant = "neon";
+	}
+#endif
+
+	GP_DEBUG(1, "Using %s variant of reverse_row_64BPP()", variant);
+
+	__atomic_store_n(&reverse_row_64BPP_fn, fn, __ATOMIC_RELAXED);
+
+	fn(dst, src, w);
+}
+
+static inline void reverse_row_64BPP(uint8_t *restrict dst, const uint8_t *restrict src, gp_size w)
+{
+	__atomic_load_n(&reverse_row_64BPP_fn, __ATOMIC_RELAXED)(dst, src, w);
+}
+
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_1BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_1BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_1BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_1BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_1BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_1BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_1BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_1BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_1BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_1BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_1BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_1BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_1BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_1BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_1BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_1BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_2BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_2BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_2BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_2BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_2BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_2BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_2BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_2BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_2BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_2BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_2BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_2BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_2BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_2BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_2BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_2BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_4BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_4BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_4BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_4BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_4BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_4BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_4BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_4BPP_LE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_4BPP_BE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_4BPP_BE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_4BPP_BE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_4BPP_BE(src, xr, b);
+
+		gp_putpixel_raw_4BPP_BE(dst, x, a, pbr);
+		gp_putpixel_raw_4BPP_BE(dst, xr, a, pb);
+		gp_putpixel_raw_4BPP_BE(dst, x, b, par);
+		gp_putpixel_raw_4BPP_BE(dst, xr, b, pa);
+	}
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_8BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_8BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_8BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_8BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 1);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_16BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_16BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_16BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_16BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 2);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_24BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_24BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_24BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_24BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 3);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_32BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_32BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_32BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_32BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 4);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_48BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_48BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_48BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_48BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_48BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 6);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_64BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_64BPP(da, sb, src->w);
+		if (a != b)
+			reverse_row_64BPP(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_64BPP(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_64BPP(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * 8);
+}
+
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_18BPP_LE(src, x, a);
+		gp_pixel par = gp_getpixel_raw_18BPP_LE(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_18BPP_LE(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_18BPP_LE(src, xr, b);
+
+		gp_putpixel_raw_18BPP_LE(dst, x, a, pbr);
+		gp_putpixel_raw_18BPP_LE(dst, xr, a, pb);
+		gp_putpixel_raw_18BPP_LE(dst, x, b, par);
+		gp_putpixel_raw_18BPP_LE(dst, xr, b, pa);
+	}
+}
+
+static void reverse_rows(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	GP_FN_PER_BPP_PIXMAP(reverse_rows, src, src, dst, a, b, tmp);
+}
+
+struct reverse_rows_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	/* Pairs rows from the top and bottom, i.e. rotates by 180 */
+	int flip;
+};
+
+static int reverse_rows_tile(const gp_tile *tile, void *ppriv,
+                             gp_progress_cb *callback)
+{
+	struct reverse_rows_priv *priv = ppriv;
+	const gp_pixmap *src = priv->src;
+	size_t size = 0;
+	uint8_t *tmp = NULL;
+	gp_size i;
+
+	if (src == priv->dst && !(src->bpp % 8)) {
+		size = (size_t)src->w * (src->bpp / 8);
+		tmp = gp_temp_alloc(size);
+		if (!tmp) {
+			GP_WARN("Malloc failed :(");
+			errno = ENOMEM;
+			return 1;
+		}
+	}
+
+	for (i = 0; i < tile->h; i++) {
+		gp_coord a = tile->y + i;
+		gp_coord b = priv->flip ? (gp_coord)src->h - a - 1 : a;
+
+		reverse_rows(src, priv->dst, a, b, tmp);
+
+		if (gp_progress_cb_report(callback, i, tile->h, tile->w)) {
+			gp_temp_free(size, tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_free(size, tmp);
+	return 0;
+}
+
+static int reverse_rows_run(const gp_pixmap *src, gp_pixmap *dst, int flip,
+                            const char *name, gp_progress_cb *callback)
+{
+	struct reverse_rows_priv priv = {
+		.src = src,
+		.dst = dst,
+		.flip = flip,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = flip ? (src->h + 1) / 2 : src->h,
+		.bpp = src->bpp,
+		.name = name,
+		.pixel_type = src->pixel_type,
+		/* Split only rows, each tile reverses whole rows */
+		.min_w = src->w,
+		.fn = reverse_rows_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	return gp_tiles_run(&tiles);
+}
+
+static int rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	return reverse_rows_run(src, dst, 1, "rotate_180", callback);
+}
+
+int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (rotate_180(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_180(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
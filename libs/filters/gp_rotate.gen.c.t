@@ -1,129 +1,176 @@
 @ include source.t
 /*
- * Vertical Mirror alogorithm
+ * Rotations by 90, 180 and 270 degrees
  *
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include <core/gp_debug.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_fn_per_bpp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
+#include <core/gp_cpu.h>
 #include <filters/gp_rotate.h>
 
-@ for ps in pixelsizes:
-static int rotate_90_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
-                                     gp_progress_cb *callback)
-{
-	uint32_t x, y;
-
-	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
-
-	for (x = 0; x < src->w; x++) {
-		for (y = 0; y < src->h; y++) {
-			uint32_t yr = src->h - y - 1;
-			gp_putpixel_raw_{{ ps.suffix }}(dst, yr, x, gp_getpixel_raw_{{ ps.suffix }}(src, x, y));
-		}
+/*
+ * The 90 and 270 degree rotations are transpositions with one of the axes
+ * reversed. The source is split into tiles and each tile is processed in
+ * columns of BLOCK_W pixels so that the destination rows written by a column
+ * stay in cache.
+ *
+ * Byte aligned pixels that fit into a 16 byte vector n times are transposed
+ * in n x n blocks in SIMD registers.
+ */
+#define BLOCK_W 64
 
-		if (gp_progress_cb_report(callback, x, src->w, src->h))
-			return 1;
-	}
-
-	gp_progress_cb_done(callback);
-	return 0;
-}
+@ include transpose.t
+{@ transpose_functions() @}
 
+@ def dst_xy(deg, x, y):
+@     if deg == 90:
+@         return ('src->h - 1 - (' + y + ')', x)
+@     return (y, 'src->w - 1 - (' + x + ')')
 @ end
 @
-static int rotate_90(const gp_pixmap *src, gp_pixmap *dst,
-                     gp_progress_cb *callback)
-{
-	GP_FN_RET_PER_BPP_PIXMAP(rotate_90, src, src, dst, callback);
-	return 1;
-}
-
-int gp_filter_rotate_90(const gp_pixmap *src, gp_pixmap *dst,
-                        gp_progress_cb *callback)
+@ def copy_pixel(ps, deg, x, y):
+@     dx, dy = dst_xy(deg, x, y)
+@     if ps.needs_bit_endian():
+gp_putpixel_raw_{{ ps.suffix }}(dst, {{ dx }}, {{ dy }}, gp_getpixel_raw_{{ ps.suffix }}(src, {{ x }}, {{ y }}));
+@     else:
+memcpy(GP_PIXEL_ADDR_{{ ps.suffix }}(dst, {{ dx }}, {{ dy }}), GP_PIXEL_ADDR_{{ ps.suffix }}(src, {{ x }}, {{ y }}), {{ ps.size // 8 }});
+@     end
+@ end
+@
+@ for deg in [90, 270]:
+@     for ps in pixelsizes:
+/*
+ * Rotates source rectangle, the x1 and y1 are exclusive.
+ */
+static void rotate_{{ deg }}_rect_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
 {
-	GP_ASSERT(src->pixel_type == dst->pixel_type,
-	          "The src and dst pixel types must match");
-	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
-	          "Destination is not large enough");
+	gp_coord x, y;
+@         if is_vec(ps):
+@             n = 128 // ps.size
+	gp_coord i;
+
+	for (y = y0; y + {{ n }} <= y1; y += {{ n }}) {
+		for (x = x0; x + {{ n }} <= x1; x += {{ n }}) {
+@             if deg == 90:
+			transpose_{{ ps.suffix }}((uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(dst, src->h - y - {{ n }}, x),
+			                 dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(src, x, y + {{ n - 1 }}),
+			                 -(ptrdiff_t)src->bytes_per_row);
+@             else:
+			transpose_{{ ps.suffix }}((uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(dst, y, src->w - 1 - x),
+			                 -(ptrdiff_t)dst->bytes_per_row,
+			                 (uint8_t*)GP_PIXEL_ADDR_{{ ps.suffix }}(src, x, y),
+			                 src->bytes_per_row);
+@             end
+		}
 
-	if (rotate_90(src, dst, callback)) {
-		GP_DEBUG(1, "Operation aborted");
-		return 1;
+		for (; x < x1; x++) {
+			for (i = 0; i < {{ n }}; i++)
+				{@ copy_pixel(ps, deg, 'x', 'y + i') @}
+		}
 	}
+@         else:
+	y = y0;
+@         end
 
-	return 0;
-}
-
-gp_pixmap *gp_filter_rotate_90_alloc(const gp_pixmap *src,
-                                     gp_progress_cb *callback)
-{
-	gp_pixmap *res;
-
-	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
-
-	if (res == NULL)
-		return NULL;
-
-	if (rotate_90(src, res, callback)) {
-		GP_DEBUG(1, "Operation aborted");
-		gp_pixmap_free(res);
-		return NULL;
+	for (; y < y1; y++) {
+		for (x = x0; x < x1; x++)
+			{@ copy_pixel(ps, deg, 'x', 'y') @}
 	}
-
-	return res;
 }
 
-@ def swap_pixels(ps, src, dst, x0, y0, x1, y1):
-gp_pixel pix0 = gp_getpixel_raw_{{ ps.suffix }}({{ src }}, {{ x0 }}, {{ y0 }});
-gp_pixel pix1 = gp_getpixel_raw_{{ ps.suffix }}({{ src }}, {{ x1 }}, {{ y1 }});
-gp_putpixel_raw_{{ ps.suffix }}({{ dst }}, {{ x0 }}, {{ y0 }}, pix1);
-gp_putpixel_raw_{{ ps.suffix }}({{ dst }}, {{ x1 }}, {{ y1 }}, pix0);
+@     end
 @ end
 @
-@ for ps in pixelsizes:
-static int rotate_180_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
-                                      gp_progress_cb *callback)
+struct rotate_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	void (*rect)(const gp_pixmap *src, gp_pixmap *dst,
+	             gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1);
+};
+
+static int rotate_tile(const gp_tile *tile, void *ppriv,
+                       gp_progress_cb *callback)
 {
-	uint32_t x, y;
-
-	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
-
-	for (x = 0; x < src->w; x++) {
-		for (y = 0; y < src->h; y++) {
-			uint32_t xr = src->w - x - 1;
-			uint32_t yr = src->h - y - 1;
+	struct rotate_priv *priv = ppriv;
+	gp_coord x, x1 = tile->x + tile->w;
 
-			{@ swap_pixels(ps, 'src', 'dst', 'x', 'y', 'xr', 'yr') @}
-		}
+	for (x = tile->x; x < x1; x += BLOCK_W) {
+		priv->rect(priv->src, priv->dst, x, tile->y,
+		           GP_MIN(x + BLOCK_W, x1), tile->y + tile->h);
 
-		if (gp_progress_cb_report(callback, x, src->w, src->h))
+		if (gp_progress_cb_report(callback, x - tile->x, tile->w, tile->h)) {
+			errno = ECANCELED;
 			return 1;
+		}
 	}
 
-	gp_progress_cb_done(callback);
 	return 0;
 }
 
-@ end
-@
-static int rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+@ for deg in [90, 270]:
+static void rotate_{{ deg }}_rect(const gp_pixmap *src, gp_pixmap *dst,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	GP_FN_PER_BPP_PIXMAP(rotate_{{ deg }}_rect, src, src, dst, x0, y0, x1, y1);
+}
+
+static int rotate_{{ deg }}(const gp_pixmap *src, gp_pixmap *dst,
                       gp_progress_cb *callback)
 {
-	GP_FN_RET_PER_BPP_PIXMAP(rotate_180, src, src, dst, callback);
-	return 1;
+	struct rotate_priv priv = {
+		.src = src,
+		.dst = dst,
+		.rect = rotate_{{ deg }}_rect,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = src->h,
+		.bpp = src->bpp,
+		.name = "rotate_{{ deg }}",
+		.pixel_type = src->pixel_type,
+		.min_w = BLOCK_W,
+		.min_h = BLOCK_W,
+		.fn = rotate_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	GP_DEBUG(1, "Rotating image by {{ deg }} %ux%u", src->w, src->h);
+
+	/*
+	 * Source columns are destination rows, pixels smaller than byte may
+	 * share bytes, hence such destination rows must not be split.
+	 */
+	if (src->bpp % 8)
+		tiles.min_h = src->h;
+
+	return gp_tiles_run(&tiles);
 }
 
-int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+int gp_filter_rotate_{{ deg }}(const gp_pixmap *src, gp_pixmap *dst,
                          gp_progress_cb *callback)
 {
 	GP_ASSERT(src->pixel_type == dst->pixel_type,
 	          "The src and dst pixel types must match");
-	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
 	          "Destination is not large enough");
 
-	if (rotate_180(src, dst, callback)) {
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (rotate_{{ deg }}(src, dst, callback)) {
 		GP_DEBUG(1, "Operation aborted");
 		return 1;
 	}
@@ -131,17 +178,17 @@ int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
 	return 0;
 }
 
-gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
+gp_pixmap *gp_filter_rotate_{{ deg }}_alloc(const gp_pixmap *src,
                                       gp_progress_cb *callback)
 {
 	gp_pixmap *res;
 
-	res = gp_pixmap_copy(src, 0);
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
 
 	if (res == NULL)
 		return NULL;
 
-	if (rotate_180(src, res, callback)) {
+	if (rotate_{{ deg }}(src, res, callback)) {
 		GP_DEBUG(1, "Operation aborted");
 		gp_pixmap_free(res);
 		return NULL;
@@ -150,46 +197,31 @@ gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
 	return res;
 }
 
-@ for ps in pixelsizes:
-static int rotate_270_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
-                                      gp_progress_cb *callback)
-{
-	uint32_t x, y;
-
-	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
-
-	for (x = 0; x < src->w; x++) {
-		for (y = 0; y < src->h; y++) {
-				uint32_t xr = src->w - x - 1;
-				gp_putpixel_raw_{{ ps.suffix }}(dst, y, xr, gp_getpixel_raw_{{ ps.suffix }}(src, x, y));
-		}
-
-		if (gp_progress_cb_report(callback, x, src->w, src->h))
-			return 1;
-	}
-
-	gp_progress_cb_done(callback);
-	return 0;
-}
-
 @ end
 @
-static int rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+@ include reverse_rows.t
+{@ reverse_rows() @}
+
+static int rotate_180(const gp_pixmap *src, gp_pixmap *dst,
                       gp_progress_cb *callback)
 {
-	GP_FN_RET_PER_BPP_PIXMAP(rotate_270, src, src, dst, callback);
-	return 1;
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	return reverse_rows_run(src, dst, 1, "rotate_180", callback);
 }
 
-int gp_filter_rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
                          gp_progress_cb *callback)
 {
 	GP_ASSERT(src->pixel_type == dst->pixel_type,
 	          "The src and dst pixel types must match");
-	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
 	          "Destination is not large enough");
 
-	if (rotate_270(src, dst, callback)) {
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
+	if (rotate_180(src, dst, callback)) {
 		GP_DEBUG(1, "Operation aborted");
 		return 1;
 	}
@@ -197,17 +229,17 @@ int gp_filter_rotate_270(const gp_pixmap *src, gp_pixmap *dst,
 	return 0;
 }
 
-gp_pixmap *gp_filter_rotate_270_alloc(const gp_pixmap *src,
+gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
                                       gp_progress_cb *callback)
 {
 	gp_pixmap *res;
 
-	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+	res = gp_pixmap_copy(src, 0);
 
 	if (res == NULL)
 		return NULL;
 
-	if (rotate_270(src, res, callback)) {
+	if (rotate_180(src, res, callback)) {
 		GP_DEBUG(1, "Operation aborted");
 		gp_pixmap_free(res);
 		return NULL;
@@ -203,6 +203,9 @@ int gp_filter_sigma_ex(const gp_pixmap *src,
 
 	GP_CHECK(xrad >= 0 && yrad >= 0);
 
+	if (gp_pixmap_unshare(dst))
+		return 1;
+
 	return gp_filter_sigma_raw(src, x_src, y_src, w_src, h_src,
 	                           dst, x_dst, y_dst, xrad, yrad, min, sigma,
 	                           callback);
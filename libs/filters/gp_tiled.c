@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Filters on tiled pixmaps.
+
+  The destination is processed tile by tile, source pixels needed for a
+  destination tile are gathered into a small linear buffer and the filter for
+  linear pixmaps is applied on it. The tiles are processed in columns so that
+  the source tiles are reused while they are still cached.
+
+ */
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_tiled_pixmap.h>
+#include <filters/gp_linear.h>
+#include <filters/gp_rotate.h>
+
+static gp_pixmap *tmp_init(gp_pixmap *tmp, gp_pixmap *buf, gp_size w, gp_size h)
+{
+	gp_pixmap_init(tmp, w, h, buf->pixel_type, buf->pixels);
+	tmp->bit_endian = buf->bit_endian;
+
+	return tmp;
+}
+
+static gp_size tile_w(const gp_tiled_pixmap *self, uint32_t tx)
+{
+	return GP_MIN((uint32_t)GP_TILE_SIZE, self->w - tx * GP_TILE_SIZE);
+}
+
+static gp_size tile_h(const gp_tiled_pixmap *self, uint32_t ty)
+{
+	return GP_MIN((uint32_t)GP_TILE_SIZE, self->h - ty * GP_TILE_SIZE);
+}
+
+static gp_pixmap *tmp_alloc(const gp_tiled_pixmap *src, gp_size h)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(GP_TILE_SIZE, h, src->pixel_type);
+
+	if (ret)
+		ret->bit_endian = src->bit_endian;
+
+	return ret;
+}
+
+int gp_filter_tiled_vconvolution(gp_tiled_pixmap *src, gp_tiled_pixmap *dst,
+                                 float kernel[], uint32_t kh, float kern_div,
+                                 gp_progress_cb *callback)
+{
+	uint32_t tx, ty, cnt = 0;
+	gp_pixmap *buf, tmp, tile;
+	int ret = 1;
+
+	GP_ASSERT(src != dst, "The filter does not work in-place");
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w == dst->w && src->h == dst->h,
+	          "The src and dst sizes must match");
+
+	GP_DEBUG(1, "Tiled vertical convolution kernel %u image %ux%u",
+	         kh, src->w, src->h);
+
+	buf = tmp_alloc(src, GP_TILE_SIZE + kh - 1);
+	if (!buf)
+		return 1;
+
+	for (tx = 0; tx < dst->tiles_w; tx++) {
+		for (ty = 0; ty < dst->tiles_h; ty++) {
+			gp_coord y0 = ty * GP_TILE_SIZE;
+			gp_size th = tile_h(dst, ty);
+			gp_coord sy0, sy1;
+
+			sy0 = GP_MAX(0, y0 - (gp_coord)kh/2);
+			sy1 = GP_MIN((gp_coord)src->h,
+			             y0 + (gp_coord)(th + kh - 1 - kh/2));
+
+			tmp_init(&tmp, buf, tile_w(dst, tx), sy1 - sy0);
+
+			if (gp_tiled_pixmap_get_rect(src, tx * GP_TILE_SIZE, sy0,
+			                             tmp.w, tmp.h, &tmp, 0, 0))
+				goto exit;
+
+			if (!gp_tiled_pixmap_tile(dst, tx, ty, GP_TILE_WR, &tile))
+				goto exit;
+
+			if (gp_filter_vlinear_convolution_raw(&tmp, 0, y0 - sy0,
+			                                      tile.w, tile.h,
+			                                      &tile, 0, 0, kernel,
+			                                      kh, kern_div, NULL))
+				goto exit;
+
+			if (gp_progress_cb_report(callback, cnt++,
+			                          dst->tiles_w * dst->tiles_h, 1)) {
+				GP_DEBUG(1, "Operation aborted");
+				errno = ECANCELED;
+				goto exit;
+			}
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	ret = 0;
+exit:
+	gp_pixmap_free(buf);
+	return ret;
+}
+
+/*
+ * Returns source rectangle that maps to the destination rectangle.
+ */
+static void symmetry_src_rect(gp_tiled_pixmap *src,
+                              gp_filter_symmetries symmetry,
+                              gp_coord x, gp_coord y, gp_size w, gp_size h,
+                              gp_coord *sx, gp_coord *sy, gp_size *sw, gp_size *sh)
+{
+	switch (symmetry) {
+	case GP_ROTATE_90:
+		*sx = y;
+		*sy = src->h - x - w;
+		*sw = h;
+		*sh = w;
+	break;
+	case GP_ROTATE_180:
+		*sx = src->w - x - w;
+		*sy = src->h - y - h;
+		*sw = w;
+		*sh = h;
+	break;
+	case GP_ROTATE_270:
+		*sx = src->w - y - h;
+		*sy = x;
+		*sw = h;
+		*sh = w;
+	break;
+	case GP_MIRROR_H:
+		*sx = src->w - x - w;
+		*sy = y;
+		*sw = w;
+		*sh = h;
+	break;
+	case GP_MIRROR_V:
+		*sx = x;
+		*sy = src->h - y - h;
+		*sw = w;
+		*sh = h;
+	break;
+	}
+}
+
+int gp_filter_tiled_symmetry(gp_tiled_pixmap *src, gp_tiled_pixmap *dst,
+                             gp_filter_symmetries symmetry,
+                             gp_progress_cb *callback)
+{
+	uint32_t tx, ty, cnt = 0;
+	gp_pixmap *buf, tmp, tile;
+	int ret = 1;
+
+	if (symmetry < GP_ROTATE_90 || symmetry > GP_MIRROR_V) {
+		GP_DEBUG(1, "Invalid symmetry %i", (int) symmetry);
+		errno = EINVAL;
+		return 1;
+	}
+
+	GP_ASSERT(src != dst, "The filter does not work in-place");
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+
+	if (symmetry == GP_ROTATE_90 || symmetry == GP_ROTATE_270) {
+		GP_ASSERT(src->w == dst->h && src->h == dst->w,
+		          "Destination size does not match");
+	} else {
+		GP_ASSERT(src->w == dst->w && src->h == dst->h,
+		          "Destination size does not match");
+	}
+
+	GP_DEBUG(1, "Tiled symmetry %s image %ux%u",
+	         gp_filter_symmetry_names[symmetry], src->w, src->h);
+
+	buf = tmp_alloc(src, GP_TILE_SIZE);
+	if (!buf)
+		return 1;
+
+	for (tx = 0; tx < dst->tiles_w; tx++) {
+		for (ty = 0; ty < dst->tiles_h; ty++) {
+			gp_coord sx, sy;
+			gp_size sw, sh;
+
+			symmetry_src_rect(src, symmetry, tx * GP_TILE_SIZE,
+			                  ty * GP_TILE_SIZE, tile_w(dst, tx),
+			                  tile_h(dst, ty), &sx, &sy, &sw, &sh);
+
+			tmp_init(&tmp, buf, sw, sh);
+
+			if (gp_tiled_pixmap_get_rect(src, sx, sy, sw, sh, &tmp, 0, 0))
+				goto exit;
+
+			if (!gp_tiled_pixmap_tile(dst, tx, ty, GP_TILE_WR, &tile))
+				goto exit;
+
+			if (gp_filter_symmetry(&tmp, &tile, symmetry, NULL))
+				goto exit;
+
+			if (gp_progress_cb_report(callback, cnt++,
+			                          dst->tiles_w * dst->tiles_h, 1)) {
+				GP_DEBUG(1, "Operation aborted");
+				errno = ECANCELED;
+				goto exit;
+			}
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	ret = 0;
+exit:
+	gp_pixmap_free(buf);
+	return ret;
+}
+
+gp_tiled_pixmap *gp_filter_tiled_symmetry_alloc(gp_tiled_pixmap *src,
+                                                gp_filter_symmetries symmetry,
+                                                gp_progress_cb *callback)
+{
+	gp_tiled_pixmap *res;
+	gp_size w = src->w, h = src->h;
+
+	if (symmetry == GP_ROTATE_90 || symmetry == GP_ROTATE_270)
+		GP_SWAP(w, h);
+
+	res = gp_tiled_pixmap_alloc(w, h, src->pixel_type, src->cache_tiles);
+	if (!res)
+		return NULL;
+
+	res->bit_endian = src->bit_endian;
+
+	if (gp_filter_tiled_symmetry(src, res, symmetry, callback)) {
+		gp_tiled_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
@@ -0,0 +1,137 @@
+@ #
+@ # Generator for row reversal code, licenced under LGPLv2+
+@ #
+@ # Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # Generates reverse_rows_run() shared by the horizontal mirror and 180 degree
+@ # rotation. The image is processed by whole rows in the thread pool, the
+@ # rows of byte aligned pixels are reversed by vectorized functions, pixels
+@ # smaller than a byte are swapped one by one.
+@ #
+@ include reverse_row.t
+@
+@ def reverse_rows():
+{@ reverse_row_functions() @}
+
+@     for ps in pixelsizes:
+/*
+ * Writes src row b reversed into dst row a and src row a reversed into dst
+ * row b, a == b mirrors a single row. Works in place as well, then the tmp
+ * buffer for a row is used for byte aligned pixels.
+ */
+static void reverse_rows_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
+                                    gp_coord a, gp_coord b, uint8_t *tmp)
+{
+@         if not ps.needs_bit_endian():
+	const uint8_t *sa = src->pixels + (size_t)a * src->bytes_per_row;
+	const uint8_t *sb = src->pixels + (size_t)b * src->bytes_per_row;
+	uint8_t *da = dst->pixels + (size_t)a * dst->bytes_per_row;
+	uint8_t *db = dst->pixels + (size_t)b * dst->bytes_per_row;
+
+	if (src != dst) {
+		reverse_row_{{ ps.suffix }}(da, sb, src->w);
+		if (a != b)
+			reverse_row_{{ ps.suffix }}(db, sa, src->w);
+		return;
+	}
+
+	reverse_row_{{ ps.suffix }}(tmp, sb, src->w);
+	if (a != b)
+		reverse_row_{{ ps.suffix }}(db, sa, src->w);
+	memcpy(da, tmp, (size_t)src->w * {{ ps.size // 8 }});
+@         else:
+	gp_coord x;
+
+	(void) tmp;
+
+	for (x = 0; x < ((gp_coord)src->w + 1) / 2; x++) {
+		gp_coord xr = src->w - x - 1;
+		gp_pixel pa = gp_getpixel_raw_{{ ps.suffix }}(src, x, a);
+		gp_pixel par = gp_getpixel_raw_{{ ps.suffix }}(src, xr, a);
+		gp_pixel pb = gp_getpixel_raw_{{ ps.suffix }}(src, x, b);
+		gp_pixel pbr = gp_getpixel_raw_{{ ps.suffix }}(src, xr, b);
+
+		gp_putpixel_raw_{{ ps.suffix }}(dst, x, a, pbr);
+		gp_putpixel_raw_{{ ps.suffix }}(dst, xr, a, pb);
+		gp_putpixel_raw_{{ ps.suffix }}(dst, x, b, par);
+		gp_putpixel_raw_{{ ps.suffix }}(dst, xr, b, pa);
+	}
+@         end
+}
+
+@     end
+@
+static void reverse_rows(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_coord a, gp_coord b, uint8_t *tmp)
+{
+	GP_FN_PER_BPP_PIXMAP(reverse_rows, src, src, dst, a, b, tmp);
+}
+
+struct reverse_rows_priv {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	/* Pairs rows from the top and bottom, i.e. rotates by 180 */
+	int flip;
+};
+
+static int reverse_rows_tile(const gp_tile *tile, void *ppriv,
+                             gp_progress_cb *callback)
+{
+	struct reverse_rows_priv *priv = ppriv;
+	const gp_pixmap *src = priv->src;
+	size_t size = 0;
+	uint8_t *tmp = NULL;
+	gp_size i;
+
+	if (src == priv->dst && !(src->bpp % 8)) {
+		size = (size_t)src->w * (src->bpp / 8);
+		tmp = gp_temp_alloc(size);
+		if (!tmp) {
+			GP_WARN("Malloc failed :(");
+			errno = ENOMEM;
+			return 1;
+		}
+	}
+
+	for (i = 0; i < tile->h; i++) {
+		gp_coord a = tile->y + i;
+		gp_coord b = priv->flip ? (gp_coord)src->h - a - 1 : a;
+
+		reverse_rows(src, priv->dst, a, b, tmp);
+
+		if (gp_progress_cb_report(callback, i, tile->h, tile->w)) {
+			gp_temp_free(size, tmp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_free(size, tmp);
+	return 0;
+}
+
+static int reverse_rows_run(const gp_pixmap *src, gp_pixmap *dst, int flip,
+                            const char *name, gp_progress_cb *callback)
+{
+	struct reverse_rows_priv priv = {
+		.src = src,
+		.dst = dst,
+		.flip = flip,
+	};
+
+	gp_tiles tiles = {
+		.w = src->w,
+		.h = flip ? (src->h + 1) / 2 : src->h,
+		.bpp = src->bpp,
+		.name = name,
+		.pixel_type = src->pixel_type,
+		/* Split only rows, each tile reverses whole rows */
+		.min_w = src->w,
+		.fn = reverse_rows_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	return gp_tiles_run(&tiles);
+}
+@ end
@@ -1,8 +1,77 @@
-#
-# Generator for filter thread dispatcher code, licenced under LGPLv2+
-#
-# Copyright (c) 2018 Cyril Hrubis <metan@ucw.cz>
-#
-@ def dispatcher(fn_params):
+@ #
+@ # Generator for filter thread dispatcher code, licenced under LGPLv2+
+@ #
+@ # Copyright (c) 2018 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # Generates {name}_mp() function that splits the image into tiles and runs
+@ # {name}_raw() on each of them in the thread pool. Both functions take the
+@ # usual src, rectangle, dst, position parameters followed by the filter
+@ # specific parameters and the progress callback.
+@ #
+@ def c_decl(p):
+@     if p[0].endswith('*'):
+@         return p[0] + p[1]
+@     return p[0] + ' ' + p[1]
+@ end
+@
+@ def dispatcher(name, fn_params):
+@     # fn_params is a list of (C type, name) of filter specific parameters
+@     fn_decl = ''.join([', ' + c_decl(p) for p in fn_params])
+@     fn_args = ''.join([', ' + p[1] for p in fn_params])
+@     priv_args = ''.join([', priv->' + p[1] for p in fn_params])
+struct {{ name }}_priv {
+	const gp_pixmap *src;
+	gp_coord x_src;
+	gp_coord y_src;
+	gp_pixmap *dst;
+	gp_coord x_dst;
+	gp_coord y_dst;
+@     for p in fn_params:
+	{{ c_decl(p) }};
+@     end
+};
 
+static int {{ name }}_tile(const gp_tile *tile, void *ppriv,
+                           gp_progress_cb *callback)
+{
+	struct {{ name }}_priv *priv = ppriv;
 
+	return {{ name }}_raw(priv->src, priv->x_src + tile->x,
+	                      priv->y_src + tile->y, tile->w, tile->h,
+	                      priv->dst, priv->x_dst + tile->x,
+	                      priv->y_dst + tile->y{{ priv_args }}, callback);
+}
+
+static int {{ name }}_mp(const gp_pixmap *src,
+                         gp_coord x_src, gp_coord y_src,
+                         gp_size w_src, gp_size h_src,
+                         gp_pixmap *dst,
+                         gp_coord x_dst, gp_coord y_dst{{ fn_decl }},
+                         gp_progress_cb *callback)
+{
+	struct {{ name }}_priv priv = {
+		.src = src,
+		.x_src = x_src,
+		.y_src = y_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+@     for p in fn_params:
+		.{{ p[1] }} = {{ p[1] }},
+@     end
+	};
+
+	gp_tiles tiles = {
+		.w = w_src,
+		.h = h_src,
+		.bpp = gp_pixel_size(src->pixel_type),
+		.name = "{{ name }}",
+		.pixel_type = src->pixel_type,
+		.fn = {{ name }}_tile,
+		.priv = &priv,
+		.callback = callback,
+	};
+
+	return gp_tiles_run(&tiles);
+}
+@ end
@@ -8,6 +8,7 @@
 
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_arc.h>
 
@@ -21,7 +22,9 @@ void gp_arc_segment_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 		        double start, double end,
 		        gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)a, ycenter - (gp_coord)b,
+	                          xcenter + (gp_coord)a, ycenter + (gp_coord)b);
 
 	GP_FN_PER_BPP_PIXMAP(gp_arc_segment_raw, pixmap, pixmap,
 	                     xcenter, ycenter, a, b, direction,
@@ -33,7 +36,7 @@ void gp_arc_segment(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 		    double start, double end,
 		    gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	/* recalculate center point and swap a and b when axes are swapped */
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
@@ -8,6 +8,7 @@
 
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_circle.h>
 #include <gfx/gp_hline.h>
@@ -22,7 +23,7 @@ void gp_ring_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_ring(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
              gp_size r1, gp_size r2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -37,7 +38,9 @@ GP_DEF_FILL_FN_PER_BPP(gp_fill_ring_raw, DEF_FILLRING_FN)
 void gp_fill_ring_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                      gp_size r1, gp_size r2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)GP_MAX(r1, r2), ycenter - (gp_coord)GP_MAX(r1, r2),
+	                          xcenter + (gp_coord)GP_MAX(r1, r2), ycenter + (gp_coord)GP_MAX(r1, r2));
 
 	GP_FN_PER_BPP_PIXMAP(gp_fill_ring_raw, pixmap, pixmap,
 	                     xcenter, ycenter, r1, r2, pixel);
@@ -46,7 +49,7 @@ void gp_fill_ring_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_fill_ring(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                   gp_size r1, gp_size r2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -9,6 +9,7 @@
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_transform.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_circle.h>
 #include <gfx/gp_circle_seg.h>
 
@@ -98,7 +99,9 @@ static void circle_{{ ps.suffix }}(gp_pixmap *pixmap,
 void gp_circle_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                    gp_size r, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)r, ycenter - (gp_coord)r,
+	                          xcenter + (gp_coord)r, ycenter + (gp_coord)r);
 
 	GP_FN_PER_BPP_PIXMAP(circle, pixmap, pixmap,
 	                     xcenter, ycenter, r, pixel);
@@ -107,7 +110,7 @@ void gp_circle_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_circle(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                gp_size r, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -41,7 +41,7 @@ static uint8_t transform_segments(gp_pixmap *pixmap, uint8_t seg_flags)
 void gp_circle_seg(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                    gp_size r, uint8_t seg_flag, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -52,7 +52,7 @@ void gp_circle_seg(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_fill_circle_seg(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                         gp_size r, uint8_t seg_flag, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -9,6 +9,7 @@
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_transform.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_circle_seg.h>
 
 /*
@@ -106,7 +107,9 @@ static void circle_seg_{{ ps.suffix }}(gp_pixmap *pixmap,
 void gp_circle_seg_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                        gp_size r, uint8_t seg_flags, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)r, ycenter - (gp_coord)r,
+	                          xcenter + (gp_coord)r, ycenter + (gp_coord)r);
 
 	GP_FN_PER_BPP_PIXMAP(circle_seg, pixmap, pixmap,
 	                     xcenter, ycenter, r, seg_flags, pixel);
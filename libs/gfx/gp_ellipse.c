@@ -8,6 +8,7 @@
 
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_ellipse.h>
 #include <gfx/gp_hline.h>
@@ -20,7 +21,9 @@ GP_DEF_DRAW_FN_PER_BPP(gp_ellipse_raw, DEF_ELLIPSE_FN)
 void gp_ellipse_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                     gp_size a, gp_size b, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)a, ycenter - (gp_coord)b,
+	                          xcenter + (gp_coord)a, ycenter + (gp_coord)b);
 
 	GP_FN_PER_BPP_PIXMAP(gp_ellipse_raw, pixmap, pixmap,
 	                      xcenter, ycenter, a, b, pixel);
@@ -29,7 +32,7 @@ void gp_ellipse_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_ellipse(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                 gp_size a, gp_size b, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	/* recalculate center point and swap a and b when axes are swapped */
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
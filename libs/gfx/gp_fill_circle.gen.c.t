@@ -10,6 +10,7 @@
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_transform.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_hline.h>
 #include <gfx/gp_circle.h>
 #include <gfx/gp_circle_seg.h>
@@ -82,7 +83,9 @@ static void fill_circle_seg_{{ ps.suffix }}(gp_pixmap *pixmap,
 void gp_fill_circle_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                         gp_size r, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)r, ycenter - (gp_coord)r,
+	                          xcenter + (gp_coord)r, ycenter + (gp_coord)r);
 
 	GP_FN_PER_BPP_PIXMAP(fill_circle, pixmap, pixmap,
 	                     xcenter, ycenter, r, pixel);
@@ -91,7 +94,9 @@ void gp_fill_circle_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_fill_circle_seg_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                             gp_size r, uint8_t seg_flag, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)r, ycenter - (gp_coord)r,
+	                          xcenter + (gp_coord)r, ycenter + (gp_coord)r);
 
 	GP_FN_PER_BPP_PIXMAP(fill_circle_seg, pixmap, pixmap,
 	                     xcenter, ycenter, r, seg_flag, pixel);
@@ -100,7 +105,7 @@ void gp_fill_circle_seg_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycente
 void gp_fill_circle(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                     gp_size r, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 
@@ -7,6 +7,7 @@
 
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_hline.h>
 #include <gfx/gp_vline.h>
 #include <gfx/gp_ellipse.h>
@@ -54,7 +55,9 @@ static void gp_fill_ellipse_raw_{{ ps.suffix }}(gp_pixmap *pixmap, gp_coord xcen
 void gp_fill_ellipse_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 	                 gp_size a, gp_size b, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)a, ycenter - (gp_coord)b,
+	                          xcenter + (gp_coord)a, ycenter + (gp_coord)b);
 
 	GP_FN_PER_BPP_PIXMAP(gp_fill_ellipse_raw, pixmap, pixmap,
 	                     xcenter, ycenter, a, b, pixel);
@@ -63,7 +66,7 @@ void gp_fill_ellipse_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
 void gp_fill_ellipse(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                     gp_size a, gp_size b, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 	GP_TRANSFORM_SWAP(pixmap, a, b);
@@ -8,6 +8,7 @@
 #include "core/gp_common.h"
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_hline.h>
 
 typedef struct gp_line {
@@ -101,7 +102,10 @@ static void fill_triangle_{{ ps.suffix }}(gp_pixmap *pixmap,
 void gp_fill_triangle_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                           gp_coord x1, gp_coord y1, gp_coord x2, gp_coord y2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap,
+	                          GP_MIN(x0, GP_MIN(x1, x2)), GP_MIN(y0, GP_MIN(y1, y2)),
+	                          GP_MAX(x0, GP_MAX(x1, x2)), GP_MAX(y0, GP_MAX(y1, y2)));
 
 	GP_FN_PER_BPP_PIXMAP(fill_triangle, pixmap, pixmap, x0, y0, x1, y1, x2, y2,
 	                     pixel);
@@ -8,6 +8,7 @@
 
 #include "core/gp_pixmap.h"
 #include <core/gp_transform.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_hline.h>
 #include <gfx/gp_vline.h>
@@ -15,7 +16,8 @@
 void gp_hline_xxy_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord x1,
                      gp_coord y, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, x0, y, x1, y);
 
 	GP_FN_PER_BPP_PIXMAP(gp_hline_raw, pixmap, pixmap, x0, x1, y,
 	                      pixel);
@@ -33,7 +35,7 @@ void gp_hline_xyw_raw(gp_pixmap *pixmap, gp_coord x, gp_coord y, gp_size w,
 void gp_hline_xxy(gp_pixmap *pixmap, gp_coord x0, gp_coord x1, gp_coord y,
                      gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	if (pixmap->axes_swap) {
 		GP_TRANSFORM_Y(pixmap, x0);
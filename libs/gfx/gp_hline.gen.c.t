@@ -37,13 +37,16 @@ void gp_hline_raw_{{ ps.suffix }}(gp_pixmap *pixmap, int x0, int x1, int y,
 
 @     if ps.suffix in have_writepixels:
 	size_t length = 1 + x1 - x0;
-	void *start = GP_PIXEL_ADDR(pixmap, x0, y);
-
 @         if ps.needs_bit_endian():
-	unsigned int offset = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x0);
+	/* The write pixels offset is in bits counted in the pixel order */
+	unsigned int bits = pixmap->offset + {{ ps.size }} * x0;
+	void *start = pixmap->pixels + y * pixmap->bytes_per_row + bits / 8;
+	unsigned int offset = bits % 8;
 
 	gp_write_pixels_{{ ps.suffix }}(start, offset, length, pixel);
 @         else:
+	void *start = GP_PIXEL_ADDR(pixmap, x0, y);
+
 	gp_write_pixels_{{ ps.suffix }}(start, length, pixel);
 @     else:
 	for (;x0 <= x1; x0++)
@@ -10,6 +10,7 @@
 #include "core/gp_common.h"
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_vline.h>
 #include <gfx/gp_hline.h>
@@ -120,7 +121,8 @@ void gp_line_raw_{{ ps.suffix }}(gp_pixmap *pixmap, int x0, int y0,
 void gp_line_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                  gp_coord x1, gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, x0, y0, x1, y1);
 
 	GP_FN_PER_BPP_PIXMAP(gp_line_raw, pixmap, pixmap, x0, y0, x1, y1,
 	                     pixel);
@@ -129,7 +131,7 @@ void gp_line_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
 void gp_line(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
              gp_coord x1, gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -13,6 +13,7 @@
 
 #include <core/gp_transform.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_line.h>
 #include <gfx/gp_hline.h>
@@ -135,11 +136,17 @@ void gp_fill_polygon_raw(gp_pixmap *pixmap, unsigned int nvert,
 
 	/* find first and last scanline */
 	gp_coord ymin = INT_MAX, ymax = -INT_MAX;
+	gp_coord xmin = INT_MAX, xmax = -INT_MAX;
 	for (i = 0; i < nvert; i++) {
 		ymax = GP_MAX(ymax, vert[i].y);
 		ymin = GP_MIN(ymin, vert[i].y);
+		xmax = GP_MAX(xmax, vert[i].x);
+		xmin = GP_MIN(xmin, vert[i].x);
 	}
 
+	/* The scanlines are damaged one by one, add the whole polygon first */
+	gp_pixmap_damage_xyxy_raw(pixmap, xmin, ymin, xmax, ymax);
+
 	/* build a list of edges */
 	struct edge edges[nvert];
 	unsigned int nedges = 0;		/* number of edges in list */
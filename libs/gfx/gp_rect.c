@@ -34,7 +34,7 @@ void gp_rect_xywh_raw(gp_pixmap *pixmap, gp_coord x, gp_coord y,
 void gp_rect_xyxy(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                   gp_coord x1, gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -54,7 +54,7 @@ void gp_rect_xywh(gp_pixmap *pixmap, gp_coord x, gp_coord y,
 void gp_fill_rect_xyxy_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                            gp_coord x1, gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	if (y0 > y1)
 		GP_SWAP(y0, y1);
@@ -79,7 +79,7 @@ void gp_fill_rect_xywh_raw(gp_pixmap *pixmap, gp_coord x, gp_coord y,
 void gp_fill_rect_xyxy(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                        gp_coord x1, gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -58,7 +58,7 @@ static enum gp_symbol_type transform_symbol(gp_pixmap *pixmap, enum gp_symbol_ty
 void gp_symbol(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                gp_size rx, gp_size ry, enum gp_symbol_type stype, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
 	GP_TRANSFORM_SWAP(pixmap, rx, ry);
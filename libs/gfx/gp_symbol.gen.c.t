@@ -6,6 +6,7 @@
 #include "core/gp_common.h"
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 #include <gfx/gp_symbol.h>
 #include <gfx/gp_hline.h>
 #include <gfx/gp_vline.h>
@@ -89,7 +90,9 @@ static void triangle_right_{{ ps.suffix }}(gp_pixmap *pixmap,
 void gp_symbol_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
                    gp_size rx, gp_size ry, enum gp_symbol_type stype, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
+	gp_pixmap_damage_xyxy_raw(pixmap, xcenter - (gp_coord)rx, ycenter - (gp_coord)ry,
+	                          xcenter + (gp_coord)rx, ycenter + (gp_coord)ry);
 
 	switch (stype) {
 	case GP_TRIANGLE_UP:
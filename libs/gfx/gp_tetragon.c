@@ -17,7 +17,7 @@ void gp_tetragon_raw(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                      gp_coord x1, gp_coord y1, gp_coord x2, gp_coord y2,
                      gp_coord x3, gp_coord y3, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	gp_line_raw(pixmap, x0, y0, x1, y1, pixel);
 	gp_line_raw(pixmap, x1, y1, x2, y2, pixel);
@@ -29,7 +29,7 @@ void gp_tetragon(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                  gp_coord x1, gp_coord y1, gp_coord x2, gp_coord y2,
                  gp_coord x3, gp_coord y3, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -52,7 +52,7 @@ void gp_fill_tetragon(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                       gp_coord x1, gp_coord y1, gp_coord x2, gp_coord y2,
                       gp_coord x3, gp_coord y3, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -26,7 +26,7 @@ void gp_triangle(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                  gp_coord x1, gp_coord y1,
                  gp_coord x2, gp_coord y2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
@@ -39,7 +39,7 @@ void gp_fill_triangle(gp_pixmap *pixmap, gp_coord x0, gp_coord y0,
                      gp_coord x1, gp_coord y1,
                      gp_coord x2, gp_coord y2, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	GP_TRANSFORM_POINT(pixmap, x0, y0);
 	GP_TRANSFORM_POINT(pixmap, x1, y1);
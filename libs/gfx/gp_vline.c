@@ -9,6 +9,7 @@
 #include "core/gp_common.h"
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_fn_per_bpp.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_vline.h>
 #include <gfx/gp_hline.h>
@@ -30,10 +31,12 @@
 void gp_vline_xyy_raw(gp_pixmap *pixmap, gp_coord x, gp_coord y0,
                       gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	ORDER_AND_CLIP_COORDS;
 
+	gp_pixmap_damage_xyxy_raw(pixmap, x, y0, x, y1);
+
 	GP_FN_PER_BPP_PIXMAP(gp_vline_raw, pixmap, pixmap, x, y0, y1, pixel);
 }
 
@@ -49,7 +52,7 @@ void gp_vline_xyh_raw(gp_pixmap *pixmap, gp_coord x, gp_coord y, gp_size h,
 void gp_vline_xyy(gp_pixmap *pixmap, gp_coord x, gp_coord y0,
                   gp_coord y1, gp_pixel pixel)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	if (pixmap->axes_swap) {
 		GP_TRANSFORM_Y(pixmap, x);
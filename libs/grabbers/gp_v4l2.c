@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include "core/gp_pixmap.h"
+#include <core/gp_yuv.h>
 
 #include <core/gp_debug.h>
 
@@ -39,6 +40,9 @@ struct v4l2_priv {
 	void *bufptr[4];
 	size_t buf_len[4];
 
+	/* Row size of the driver buffers, may be padded */
+	uint32_t bytes_per_row;
+
 	char device[];
 };
 
@@ -60,56 +64,30 @@ static void v4l2_exit(gp_grabber *self)
 
 	close(self->fd);
 	gp_pixmap_free(self->frame);
+	gp_yuv_frame_free(self->yuv_frame);
 	free(self);
 }
 
-#define CLAMP(x, max)    \
-	if (x > max)     \
-		x = max; \
-	if (x < 0)       \
-		x = 0;   \
-
-#define MUL 1024
-
 static void v4l2_yuv422_fillframe(gp_grabber *self, void *buf)
 {
-	unsigned int i, j;
-	unsigned char *py, *pu, *pv;
-	unsigned char *tmp = self->frame->pixels;
-
-	py = buf;
-	pu = buf + 1;
-	pv = buf + 3;
-
-	for (i = 0; i < self->frame->h; i++) {
-		for (j = 0; j < self->frame->w; j++) {
-			int32_t PU = ((int32_t)*pu) - 128;
-			int32_t PV = ((int32_t)*pv) - 128;
-
-			int32_t R = MUL * (*py) + ((int32_t)(MUL * 1.772)) * PU;
-			int32_t G = MUL * (*py) - ((int32_t)(MUL * 0.344)) * PU
-			            - ((int32_t)(MUL * 0.714)) * PV;
-			int32_t B = MUL * (*py) + ((int32_t)(MUL * 1.402)) * PV;
-
-			R = (R + MUL/2)/MUL;
-			G = (G + MUL/2)/MUL;
-			B = (B + MUL/2)/MUL;
-
-			CLAMP(R, 255);
-			CLAMP(G, 255);
-			CLAMP(B, 255);
-
-			*tmp++ = R;
-			*tmp++ = G;
-			*tmp++ = B;
-
-			py += 2;
+	struct v4l2_priv *priv = GP_GRABBER_PRIV(self);
+	gp_yuv_frame *yuv = self->yuv_frame;
+	uint32_t len = yuv->planes[0].bytes_per_row;
+	gp_yuv_frame drv;
+	unsigned int y;
+
+	/* Convert straight from the driver buffer unless the frame is kept */
+	if (!self->yuv_only) {
+		if (gp_yuv_frame_init(&drv, yuv->w, yuv->h, yuv->format,
+		                      buf, priv->bytes_per_row))
+			gp_yuv_frame_to_pixmap(&drv, self->frame, NULL);
+		return;
+	}
 
-			if ((j & 1) == 1) {
-				pu += 4;
-				pv += 4;
-			}
-		}
+	/* The buffer is queued back to the driver right after this */
+	for (y = 0; y < yuv->h; y++) {
+		memcpy(yuv->planes[0].pixels + (size_t)y * len,
+		       (uint8_t*)buf + (size_t)y * priv->bytes_per_row, len);
 	}
 }
 
@@ -336,15 +314,21 @@ gp_grabber *gp_grabber_v4l2_init(const char *device,
 	new->frame = gp_pixmap_alloc(fmt.fmt.pix.width, fmt.fmt.pix.height,
 				     GP_PIXEL_RGB888);
 
-	if (new->frame == NULL) {
+	new->yuv_frame = gp_yuv_frame_alloc(fmt.fmt.pix.width, fmt.fmt.pix.height,
+	                                    GP_YUV_YUYV);
+	new->yuv_only = 0;
+
+	if (new->frame == NULL || new->yuv_frame == NULL) {
 		err = ENOMEM;
-		goto err1;
+		goto err2;
 	}
 
 	struct v4l2_priv *priv = GP_GRABBER_PRIV(new);
 
 	strcpy(priv->device, device);
 	priv->mode = mode;
+	priv->bytes_per_row = GP_MAX(fmt.fmt.pix.bytesperline,
+	                             new->yuv_frame->planes[0].bytes_per_row);
 
 	switch (mode) {
 	case 1:
@@ -417,7 +401,7 @@ err3:
 			munmap(priv->bufptr[i], priv->buf_len[i]);
 err2:
 	gp_pixmap_free(new->frame);
-err1:
+	gp_yuv_frame_free(new->yuv_frame);
 	free(new);
 err0:
 	close(fd);
@@ -4,6 +4,7 @@
  */
 
 #include <core/gp_debug.h>
+#include <core/gp_convert.h>
 #include <loaders/gp_line_convert.h>
 
 static void abc888_to_cba888(const uint8_t *inbuf, uint8_t *outbuf,
@@ -51,9 +52,37 @@ static void xabc8888_to_cba888(const uint8_t *inbuf, uint8_t *outbuf,
 	}
 }
 
+/*
+ * Works in place as well, i.e. inbuf may be equal to outbuf.
+ */
+static void rgba8888_premultiply(const uint8_t *inbuf, uint8_t *outbuf,
+                                 unsigned int len)
+{
+	const uint32_t *in = (const uint32_t *)inbuf;
+	uint32_t *out = (uint32_t *)outbuf;
+	unsigned int i;
+
+	for (i = 0; i < len; i++) {
+		gp_pixel p = 0;
+
+		GP_PIXEL_RGBA8888_TO_RGBA8888_PM(in[i], p);
+
+		out[i] = p;
+	}
+}
+
 gp_line_convert gp_line_convert_get(gp_pixel_type in, gp_pixel_type out)
 {
 	switch (in) {
+	case GP_PIXEL_RGBA8888:
+		switch (out) {
+		case GP_PIXEL_RGBA8888_PM:
+			return rgba8888_premultiply;
+		break;
+		default:
+		break;
+		}
+	break;
 	case GP_PIXEL_RGB888:
 		switch (out) {
 		case GP_PIXEL_BGR888:
@@ -42,6 +42,21 @@ static const gp_loader *loaders[MAX_LOADERS] = {
 	&gp_ico,
 };
 
+static int premultiply;
+
+void gp_loader_premultiply_set(int enable)
+{
+	GP_DEBUG(1, "%s alpha premultiplication",
+	         enable ? "Enabling" : "Disabling");
+
+	premultiply = !!enable;
+}
+
+int gp_loader_premultiply_get(void)
+{
+	return premultiply;
+}
+
 static unsigned int get_last_loader(void)
 {
 	unsigned int i;
@@ -203,7 +203,8 @@ static int read_g1(gp_io *io, struct pcx_header *header,
                    gp_pixmap *res, gp_progress_cb *callback)
 {
 	uint32_t y;
-	int padd = (int)header->bytes_per_line - (int)res->bytes_per_row;
+	uint32_t row_size = GP_CALC_ROW_SIZE(res->pixel_type, res->w);
+	int padd = (int)header->bytes_per_line - (int)row_size;
 
 	if (padd < 0) {
 		GP_WARN("Invalid number of bytes per line");
@@ -216,11 +217,11 @@ static int read_g1(gp_io *io, struct pcx_header *header,
 
 	for (y = 0; y < res->h; y++) {
 		uint8_t *addr = GP_PIXEL_ADDR(res, 0, y);
-		gp_io_read(rle_io, addr, res->bytes_per_row);
+		gp_io_read(rle_io, addr, row_size);
 		gp_io_seek(rle_io, GP_IO_SEEK_CUR, padd);
 
 		//TODO: FIX Endians
-		gp_bit_swap_row_b1(addr, res->bytes_per_row);
+		gp_bit_swap_row_b1(addr, row_size);
 
 		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
 			GP_DEBUG(1, "Operation aborted");
@@ -21,6 +21,7 @@
 #include <core/gp_gamma_correction.h>
 
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_line_convert.h>
 
 #ifdef HAVE_LIBPNG
 
@@ -140,9 +141,13 @@ static void load_meta_data(png_structp png, png_infop png_info,
 static int read_bitmap(gp_pixmap *res, gp_progress_cb *callback,
                        png_structp png, int passes)
 {
+	gp_line_convert premultiply = NULL;
 	uint32_t y;
 	int p;
 
+	if (res->pixel_type == GP_PIXEL_RGBA8888_PM)
+		premultiply = gp_line_convert_get(GP_PIXEL_RGBA8888, GP_PIXEL_RGBA8888_PM);
+
 	/*
 	 * The passes are needed for adam7 interlacing.
 	 */
@@ -151,6 +156,10 @@ static int read_bitmap(gp_pixmap *res, gp_progress_cb *callback,
 			png_bytep row = GP_PIXEL_ADDR(res, 0, y);
 			png_read_row(png, row, NULL);
 
+			/* The row is complete after the last pass */
+			if (premultiply && p + 1 == passes)
+				premultiply(row, row, res->w);
+
 			if (gp_progress_cb_report(callback, y + res->h * p, res->h * passes, res->w)) {
 				GP_DEBUG(1, "Operation aborted");
 				return ECANCELED;
@@ -324,7 +333,10 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 
 		switch (depth) {
 		case 8:
-			pixel_type = GP_PIXEL_RGBA8888;
+			if (gp_loader_premultiply_get())
+				pixel_type = GP_PIXEL_RGBA8888_PM;
+			else
+				pixel_type = GP_PIXEL_RGBA8888;
 		break;
 		}
 	break;
@@ -350,7 +362,10 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 		             &color_type, NULL, NULL, NULL);
 
 		if (color_type & PNG_COLOR_MASK_ALPHA) {
-			pixel_type = GP_PIXEL_RGBA8888;
+			if (gp_loader_premultiply_get())
+				pixel_type = GP_PIXEL_RGBA8888_PM;
+			else
+				pixel_type = GP_PIXEL_RGBA8888;
 			png_set_swap_alpha(png);
 		} else {
 			pixel_type = GP_PIXEL_RGB888;
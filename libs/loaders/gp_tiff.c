@@ -417,6 +417,7 @@ static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
                      gp_progress_cb *callback)
 {
 	uint32_t i, y;
+	uint32_t row_size = GP_CALC_ROW_SIZE(res->pixel_type, res->w);
 	uint16_t planar_config, samples, s;
 
 	GP_DEBUG(1, "Reading tiff data");
@@ -465,13 +466,13 @@ static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
 			//Temporary, till bitendians are fixed
 			switch (res->pixel_type) {
 			case GP_PIXEL_G1:
-				gp_bit_swap_row_b1(addr, res->bytes_per_row);
+				gp_bit_swap_row_b1(addr, row_size);
 			break;
 			case GP_PIXEL_G2:
-				gp_bit_swap_row_b2(addr, res->bytes_per_row);
+				gp_bit_swap_row_b2(addr, row_size);
 			break;
 			case GP_PIXEL_G4:
-				gp_bit_swap_row_b4(addr, res->bytes_per_row);
+				gp_bit_swap_row_b4(addr, row_size);
 			break;
 			default:
 			break;
@@ -479,7 +480,7 @@ static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
 
 			/* We need to negate the values when Min is White */
 			if (header->photometric == PHOTOMETRIC_MINISWHITE)
-				for (i = 0; i < res->bytes_per_row; i++)
+				for (i = 0; i < row_size; i++)
 					addr[i] = ~addr[i];
 		}
 
@@ -603,7 +604,8 @@ static int save_grayscale(TIFF *tiff, const gp_pixmap *src,
                           gp_progress_cb *callback)
 {
 	uint32_t x, y;
-	uint8_t buf[src->bytes_per_row];
+	uint32_t row_size = GP_CALC_ROW_SIZE(src->pixel_type, src->w);
+	uint8_t buf[row_size];
 	tsize_t ret;
 
 	TIFFSetField(tiff, TIFFTAG_BITSPERSAMPLE, src->bpp);
@@ -615,7 +617,7 @@ static int save_grayscale(TIFF *tiff, const gp_pixmap *src,
 		uint8_t *addr = GP_PIXEL_ADDR(src, 0, y);
 
 		if (src->bpp < 8 && !src->bit_endian) {
-			for (x = 0; x < src->bytes_per_row; x++) {
+			for (x = 0; x < row_size; x++) {
 				switch (src->pixel_type) {
 				case GP_PIXEL_G1:
 					buf[x] = GP_BIT_SWAP_B1(addr[x]);
@@ -633,7 +635,7 @@ static int save_grayscale(TIFF *tiff, const gp_pixmap *src,
 			addr = buf;
 		}
 
-		ret = TIFFWriteEncodedStrip(tiff, y, addr, src->bytes_per_row);
+		ret = TIFFWriteEncodedStrip(tiff, y, addr, row_size);
 
 		if (ret == -1) {
 			//TODO TIFF ERROR
@@ -665,7 +667,7 @@ static int save_rgb(TIFF *tiff, const gp_pixmap *src,
 
 		switch (src->pixel_type) {
 		case GP_PIXEL_RGB888:
-			for (x = 0; x < src->bytes_per_row; x+=3) {
+			for (x = 0; x < 3 * src->w; x+=3) {
 				buf[x + 2] = addr[x];
 				buf[x + 1] = addr[x + 1];
 				buf[x]     = addr[x + 2];
@@ -673,7 +675,7 @@ static int save_rgb(TIFF *tiff, const gp_pixmap *src,
 			addr = buf;
 		break;
 		case GP_PIXEL_xRGB8888:
-			for (x = 0; x < src->bytes_per_row; x+=4) {
+			for (x = 0; x < 4 * src->w; x+=4) {
 				buf[3*(x/4) + 2] = addr[x];
 				buf[3*(x/4) + 1] = addr[x + 1];
 				buf[3*(x/4)]     = addr[x + 2];
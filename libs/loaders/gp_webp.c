@@ -78,7 +78,11 @@ int gp_read_webp_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 	if (!img)
 		return 0;
 
-	if (features.has_alpha) {
+	if (features.has_alpha && gp_loader_premultiply_get()) {
+		/* Let the decoder premultiply the pixels */
+		config.output.colorspace = MODE_bgrA;
+		ptype = GP_PIXEL_RGBA8888_PM;
+	} else if (features.has_alpha) {
 		config.output.colorspace = MODE_BGRA;
 		ptype = GP_PIXEL_RGBA8888;
 	} else {
@@ -9,6 +9,7 @@
 #include <core/gp_pixmap.h>
 #include <core/gp_fn_per_bpp.h>
 #include <core/gp_debug.h>
+#include <core/gp_damage.h>
 
 #include <gfx/gp_rect.h>
 
@@ -72,7 +73,7 @@ gp_size gp_text_ext(gp_pixmap *pixmap, const gp_text_style *style,
 	            gp_pixel fg_color, gp_pixel bg_color,
                     const char *str, size_t max_chars)
 {
-	GP_CHECK_PIXMAP(pixmap);
+	GP_CHECK_PIXMAP_WR(pixmap);
 
 	if (str == NULL)
 		return 0;
@@ -87,6 +88,12 @@ gp_size gp_text_ext(gp_pixmap *pixmap, const gp_text_style *style,
 	GP_ASSERT(do_align(&topleft_x, &topleft_y, align, x, y, style, w) == 0,
 	         "Invalid aligment flags");
 
+	if (w) {
+		gp_pixmap_damage_xyxy(pixmap, topleft_x, topleft_y,
+		                      topleft_x + w - 1,
+		                      topleft_y + gp_text_height(style) - 1);
+	}
+
 	return gp_text_raw(pixmap, style, topleft_x, topleft_y,
 	                   align, fg_color, bg_color, str, max_chars);
 }
@@ -0,0 +1,3826 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_text.gen.c
+ *
+ * GENERATED on 2026 10 17 00:27:15 from gp_text.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Text rendering rutines.
+ *
+ * Copyright (C) 2009-2011 Jiri "BlueBear" Dluhos
+ *                         <jiri.bluebear.dluhos@gmail.com>
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_mix_pixels.gen.h>
+
+#include <gfx/gp_hline.h>
+
+#include <text/gp_text_style.h>
+#include <text/gp_font.h>
+#include <text/gp_text.h>
+
+#define WIDTH_TO_1BPP_BPP(width) ((width)/8 + ((width)%8 != 0))
+
+static int get_width(const gp_text_style *style, int width)
+{
+	return width * style->pixel_xmul + (width - 1) * style->pixel_xspace;
+}
+
+
+static void text_draw_1BPP_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_24BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_24BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_18BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_2BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_4BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_G1(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_1BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_G2(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_2BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_G4(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_4BPP_LE(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_8BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_16BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGBA8888_PM(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_32BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGB161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_48BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP_RGBA16161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                         uint8_t bearing, gp_coord x, gp_coord y,
+				         gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k, l;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		unsigned int bpp = WIDTH_TO_1BPP_BPP(glyph->width);
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t bit = (glyph->bitmap[i/8 + j * bpp]) & (0x80>>(i%8));
+
+				if (!bit)
+					continue;
+
+				int start_x = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					start_x -= glyph->bearing_x * x_mul;
+
+				int start_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = start_y; k < start_y + style->pixel_ymul; k++) {
+					for (l = start_x; l < start_x + style->pixel_xmul; l++) {
+						int px = l;
+						int py = k;
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						if (!GP_PIXEL_IS_CLIPPED(pixmap, px, py))
+							gp_putpixel_raw_64BPP(pixmap, px, py, fg);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_draw_1BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                           uint8_t bearing, int x, int y,
+                           gp_pixel fg, const char *str, size_t max_chars)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		text_draw_1BPP_xRGB8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_draw_1BPP_RGBA8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB888:
+		text_draw_1BPP_RGB888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_BGR888:
+		text_draw_1BPP_BGR888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB555:
+		text_draw_1BPP_RGB555(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB565:
+		text_draw_1BPP_RGB565(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB666:
+		text_draw_1BPP_RGB666(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB332:
+		text_draw_1BPP_RGB332(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_draw_1BPP_CMYK8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P2:
+		text_draw_1BPP_P2(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P4:
+		text_draw_1BPP_P4(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P8:
+		text_draw_1BPP_P8(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G1:
+		text_draw_1BPP_G1(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G2:
+		text_draw_1BPP_G2(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G4:
+		text_draw_1BPP_G4(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G8:
+		text_draw_1BPP_G8(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_GA88:
+		text_draw_1BPP_GA88(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G16:
+		text_draw_1BPP_G16(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		text_draw_1BPP_RGBA8888_PM(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB161616:
+		text_draw_1BPP_RGB161616(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		text_draw_1BPP_RGBA16161616(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+
+static void text_8BPP_bg_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_xRGB8888(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_xRGB8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_xRGB8888(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGBA8888(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGBA8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGBA8888(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB888(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB888(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_BGR888(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_BGR888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_BGR888(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB555(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB555(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB555(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB565(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB565(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB565(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB666(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB666(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB666(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB332(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB332(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB332(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_CMYK8888(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_CMYK8888(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_CMYK8888(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_P2(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P2(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P2(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_P4(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P4(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P4(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_P8(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_P8(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_P8(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_G1(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_G1(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G1(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G1(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_G2(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_G2(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G2(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G2(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_G4(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_G4(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G4(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G4(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_G8(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G8(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G8(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_GA88(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_GA88(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_GA88(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_G16(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_G16(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_G16(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGBA8888_PM(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGBA8888_PM(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGBA8888_PM(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGBA8888_PM(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGB161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGB161616(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGB161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGB161616(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg_RGBA16161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                       uint8_t bearing, gp_coord x, gp_coord y,
+				       gp_pixel fg, gp_pixel bg,
+                                       const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					gp_hline(pixmap, x_start, x_start + style->pixel_xmul - 1, cur_y + k,
+					GP_MIX_PIXELS_RGBA16161616(fg, bg, gray));
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+static void text_8BPP_RGBA16161616(gp_pixmap *pixmap, const gp_text_style *style,
+                                    uint8_t bearing, gp_coord x, gp_coord y,
+				    gp_pixel fg, const char *str, size_t max_chars)
+{
+	const char *p;
+
+	gp_coord y0 = y;
+
+	for (p = str; *p != '\0' && (size_t)(p - str) < max_chars; p++) {
+		const gp_glyph *glyph = gp_get_glyph(style->font, *p);
+
+		if (glyph == NULL)
+			glyph = gp_get_glyph(style->font, ' ');
+
+		int i, j, k;
+
+		unsigned int x_mul = style->pixel_xmul + style->pixel_xspace;
+		unsigned int y_mul = style->pixel_ymul + style->pixel_yspace;
+
+		y = y0;
+
+		for (j = 0; j < glyph->height; j++) {
+			for (i = 0; i < glyph->width; i++) {
+				uint8_t gray = glyph->bitmap[i + j * glyph->width];
+
+				unsigned int x_start = x + (i + glyph->bearing_x) * x_mul;
+
+				if (!bearing && p == str)
+					x_start -= glyph->bearing_x * x_mul;
+
+				if (!gray)
+					continue;
+
+				int cur_y = y - (glyph->bearing_y - style->font->ascend) * y_mul;
+
+				for (k = 0; k < style->pixel_ymul; k++) {
+					unsigned int l;
+
+					for (l = x_start; l < x_start + style->pixel_xmul; l++) {
+						unsigned int px = l;
+						unsigned int py = cur_y + k;
+						//TODO: optimize this
+						GP_TRANSFORM_POINT(pixmap, px, py);
+						gp_mix_pixel_raw_clipped_RGBA16161616(pixmap, px, py, fg, gray);
+					}
+				}
+			}
+
+			y += style->pixel_ymul + style->pixel_yspace;
+		}
+
+		x += get_width(style, glyph->advance_x) + style->char_xspace;
+
+		if (!bearing && p == str)
+			x -= get_width(style, glyph->bearing_x);
+	}
+}
+
+
+static void text_8BPP_bg(gp_pixmap *pixmap, const gp_text_style *style,
+                         uint8_t bearing, gp_coord x, gp_coord y,
+                         gp_pixel fg, gp_pixel bg,
+                         const char *str, size_t max_chars)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		text_8BPP_bg_xRGB8888(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_8BPP_bg_RGBA8888(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB888:
+		text_8BPP_bg_RGB888(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_BGR888:
+		text_8BPP_bg_BGR888(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB555:
+		text_8BPP_bg_RGB555(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB565:
+		text_8BPP_bg_RGB565(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB666:
+		text_8BPP_bg_RGB666(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB332:
+		text_8BPP_bg_RGB332(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_8BPP_bg_CMYK8888(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_P2:
+		text_8BPP_bg_P2(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_P4:
+		text_8BPP_bg_P4(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_P8:
+		text_8BPP_bg_P8(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_G1:
+		text_8BPP_bg_G1(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_G2:
+		text_8BPP_bg_G2(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_G4:
+		text_8BPP_bg_G4(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_G8:
+		text_8BPP_bg_G8(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_GA88:
+		text_8BPP_bg_GA88(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_G16:
+		text_8BPP_bg_G16(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		text_8BPP_bg_RGBA8888_PM(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB161616:
+		text_8BPP_bg_RGB161616(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		text_8BPP_bg_RGBA16161616(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+static void text_8BPP(gp_pixmap *pixmap, const gp_text_style *style,
+                      uint8_t bearing, gp_coord x, gp_coord y,
+                      gp_pixel fg, const char *str, size_t max_chars)
+{
+	switch (pixmap->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		text_8BPP_xRGB8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888:
+		text_8BPP_RGBA8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB888:
+		text_8BPP_RGB888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_BGR888:
+		text_8BPP_BGR888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB555:
+		text_8BPP_RGB555(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB565:
+		text_8BPP_RGB565(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB666:
+		text_8BPP_RGB666(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB332:
+		text_8BPP_RGB332(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_CMYK8888:
+		text_8BPP_CMYK8888(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P2:
+		text_8BPP_P2(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P4:
+		text_8BPP_P4(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_P8:
+		text_8BPP_P8(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G1:
+		text_8BPP_G1(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G2:
+		text_8BPP_G2(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G4:
+		text_8BPP_G4(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G8:
+		text_8BPP_G8(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_GA88:
+		text_8BPP_GA88(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_G16:
+		text_8BPP_G16(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		text_8BPP_RGBA8888_PM(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGB161616:
+		text_8BPP_RGB161616(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_PIXEL_RGBA16161616:
+		text_8BPP_RGBA16161616(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	default:
+		GP_ABORT("Invalid pixmap->pixel_type");
+	}
+}
+
+gp_size gp_text_raw(gp_pixmap *pixmap, const gp_text_style *style,
+                    gp_coord x, gp_coord y, uint8_t flags,
+                    gp_pixel fg, gp_pixel bg,
+                    const char *str, size_t max_chars)
+{
+	uint8_t bearing = flags & GP_TEXT_BEARING;
+
+	switch (style->font->glyph_bitmap_format) {
+	case GP_FONT_BITMAP_1BPP:
+		text_draw_1BPP(pixmap, style, bearing, x, y, fg, str, max_chars);
+	break;
+	case GP_FONT_BITMAP_8BPP:
+		if (flags & GP_TEXT_NOBG)
+			text_8BPP(pixmap, style, bearing, x, y, fg, str, max_chars);
+		else
+			text_8BPP_bg(pixmap, style, bearing, x, y, fg, bg, str, max_chars);
+	break;
+	default:
+		GP_ABORT("Invalid font glyph bitmap format");
+	}
+
+	return gp_text_width_len(style, str, max_chars);
+}
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Helpers shared by the blit tests.
+
+  The rotation flags are passed as a bitmask, bit 0 is axes_swap, bit 1 is
+  x_swap and bit 2 is y_swap, so that all combinations can be iterated over
+  with a loop from 0 to 7.
+
+ */
+
+#ifndef TESTS_BLIT_H
+#define TESTS_BLIT_H
+
+#include <stdlib.h>
+#include <core/gp_pixmap.h>
+
+static inline void set_flags(gp_pixmap *pixmap, int flags)
+{
+	gp_pixmap_set_rotation(pixmap, !!(flags & 1), !!(flags & 2), !!(flags & 4));
+}
+
+/*
+ * Allocates a pixmap so that the user visible size is w x h after the
+ * rotation flags are applied.
+ */
+static inline gp_pixmap *alloc_flags(gp_size w, gp_size h, gp_pixel_type type,
+                                     int flags)
+{
+	gp_pixmap *ret;
+
+	if (flags & 1)
+		ret = gp_pixmap_alloc(h, w, type);
+	else
+		ret = gp_pixmap_alloc(w, h, type);
+
+	if (ret)
+		set_flags(ret, flags);
+
+	return ret;
+}
+
+/*
+ * Same as alloc_flags() but the pixels are filled with random data.
+ */
+static inline gp_pixmap *alloc_random(gp_size w, gp_size h, gp_pixel_type type,
+                                      int flags)
+{
+	gp_pixmap *ret = alloc_flags(w, h, type, flags);
+	size_t i;
+
+	if (!ret)
+		return NULL;
+
+	for (i = 0; i < (size_t)ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+#endif /* TESTS_BLIT_H */
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Blits of pixels smaller than byte, the blits between subpixmaps with all
+  possible combinations of bit alignments are compared against putpixel.
+
+ */
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_fill.h>
+
+#include "tst_test.h"
+
+struct bits_test {
+	gp_pixel_type pixel_type;
+	int bit_endian;
+};
+
+static gp_pixmap *alloc_pixmap(struct bits_test *test, gp_size w, gp_size h)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, test->pixel_type);
+	unsigned int i;
+
+	if (!ret)
+		return NULL;
+
+	ret->bit_endian = test->bit_endian;
+
+	for (i = 0; i < ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+static int subpixmap_getpixel(struct bits_test *test)
+{
+	unsigned int ppb = 8 / gp_pixel_size(test->pixel_type);
+	gp_pixmap *pixmap = alloc_pixmap(test, 4 * ppb, 2);
+	gp_pixmap sub;
+	gp_coord x, y, sx;
+
+	if (!pixmap) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (sx = 0; sx < (gp_coord)(2 * ppb); sx++) {
+		gp_sub_pixmap(pixmap, &sub, sx, 1, 2 * ppb, 1);
+
+		for (y = 0; y < (gp_coord)sub.h; y++) {
+			for (x = 0; x < (gp_coord)sub.w; x++) {
+				gp_pixel p = gp_getpixel_raw(&sub, x, y);
+				gp_pixel e = gp_getpixel_raw(pixmap, x + sx, y + 1);
+
+				if (p != e) {
+					tst_msg("Subpixmap %i pixel %i got %"PRIx64" expected %"PRIx64,
+					        sx, x, p, e);
+					gp_pixmap_free(pixmap);
+					return TST_FAILED;
+				}
+			}
+		}
+	}
+
+	gp_pixmap_free(pixmap);
+	return TST_SUCCESS;
+}
+
+static int subpixmap_fill(struct bits_test *test)
+{
+	unsigned int ppb = 8 / gp_pixel_size(test->pixel_type);
+	gp_pixmap *pixmap = alloc_pixmap(test, 4 * ppb, 3);
+	gp_pixmap *orig = gp_pixmap_copy(pixmap, GP_COPY_WITH_PIXELS);
+	gp_pixmap sub;
+	gp_coord x, y, sx;
+	gp_size w;
+
+	if (!pixmap || !orig) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		gp_pixmap_free(orig);
+		return TST_UNTESTED;
+	}
+
+	for (sx = 0; sx < (gp_coord)ppb; sx++) {
+		for (w = 1; w <= 2 * ppb + 1; w++) {
+			memcpy(pixmap->pixels, orig->pixels, pixmap->bytes_per_row * pixmap->h);
+
+			gp_sub_pixmap(pixmap, &sub, sx, 1, w, 1);
+			gp_fill(&sub, 1);
+
+			for (y = 0; y < (gp_coord)pixmap->h; y++) {
+				for (x = 0; x < (gp_coord)pixmap->w; x++) {
+					gp_pixel p = gp_getpixel_raw(pixmap, x, y);
+					gp_pixel e = gp_getpixel_raw(orig, x, y);
+
+					if (y == 1 && x >= sx && x < (gp_coord)(sx + w))
+						e = 1;
+
+					if (p != e) {
+						tst_msg("Subpixmap %i w %u pixel %ix%i got %"PRIx64" expected %"PRIx64,
+						        sx, w, x, y, p, e);
+						gp_pixmap_free(pixmap);
+						gp_pixmap_free(orig);
+						return TST_FAILED;
+					}
+				}
+			}
+		}
+	}
+
+	gp_pixmap_free(pixmap);
+	gp_pixmap_free(orig);
+	return TST_SUCCESS;
+}
+
+static int blit_bits(struct bits_test *test)
+{
+	unsigned int ppb = 8 / gp_pixel_size(test->pixel_type);
+	gp_size pw = 6 * ppb;
+	gp_pixmap *src = alloc_pixmap(test, pw, 2);
+	gp_pixmap *dst = alloc_pixmap(test, pw, 2);
+	gp_pixmap *ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	gp_pixmap *orig = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	gp_pixmap sub_src, sub_dst, sub_ref;
+	gp_coord sx, dx, x0, x2, x, y;
+	gp_size w, size;
+	unsigned int cnt = 0;
+	int ret = TST_SUCCESS;
+
+	if (!src || !dst || !ref || !orig) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	size = dst->bytes_per_row * dst->h;
+
+	for (sx = 0; sx < (gp_coord)ppb; sx++) {
+		gp_sub_pixmap(src, &sub_src, sx, 0, pw - sx, 2);
+
+		for (dx = 0; dx < (gp_coord)ppb; dx++) {
+			gp_sub_pixmap(dst, &sub_dst, dx, 0, pw - dx, 2);
+			gp_sub_pixmap(ref, &sub_ref, dx, 0, pw - dx, 2);
+
+			for (x0 = 0; x0 < (gp_coord)ppb; x0++) {
+				for (x2 = 0; x2 < (gp_coord)ppb; x2++) {
+					for (w = 1; w <= 3 * ppb + 1; w++) {
+						memcpy(dst->pixels, orig->pixels, size);
+						memcpy(ref->pixels, orig->pixels, size);
+
+						gp_blit_xywh(&sub_src, x0, 0, w, 2, &sub_dst, x2, 0);
+
+						for (y = 0; y < 2; y++) {
+							for (x = 0; x < (gp_coord)w; x++) {
+								gp_pixel p = gp_getpixel_raw(&sub_src, x0 + x, y);
+								gp_putpixel_raw(&sub_ref, x2 + x, y, p);
+							}
+						}
+
+						if (memcmp(dst->pixels, ref->pixels, size)) {
+							tst_msg("Blit differs src offset %i dst offset %i "
+							        "x0=%i x2=%i w=%u", sx, dx, x0, x2, w);
+							ret = TST_FAILED;
+							goto exit;
+						}
+
+						cnt++;
+					}
+				}
+			}
+		}
+	}
+
+	tst_msg("Checked %u blits", cnt);
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(orig);
+	return ret;
+}
+
+static struct bits_test G1_LE = {GP_PIXEL_G1, GP_BIT_ENDIAN_LE};
+static struct bits_test G2_LE = {GP_PIXEL_G2, GP_BIT_ENDIAN_LE};
+static struct bits_test G4_LE = {GP_PIXEL_G4, GP_BIT_ENDIAN_LE};
+static struct bits_test G1_BE = {GP_PIXEL_G1, GP_BIT_ENDIAN_BE};
+static struct bits_test G2_BE = {GP_PIXEL_G2, GP_BIT_ENDIAN_BE};
+static struct bits_test G4_BE = {GP_PIXEL_G4, GP_BIT_ENDIAN_BE};
+
+#define BITS_TESTS(desc, fn) \
+	{.name = desc " G1 LE", .tst_fn = fn, .data = &G1_LE, \
+	 .flags = TST_CHECK_MALLOC}, \
+	{.name = desc " G2 LE", .tst_fn = fn, .data = &G2_LE, \
+	 .flags = TST_CHECK_MALLOC}, \
+	{.name = desc " G4 LE", .tst_fn = fn, .data = &G4_LE, \
+	 .flags = TST_CHECK_MALLOC}, \
+	{.name = desc " G1 BE", .tst_fn = fn, .data = &G1_BE, \
+	 .flags = TST_CHECK_MALLOC}, \
+	{.name = desc " G2 BE", .tst_fn = fn, .data = &G2_BE, \
+	 .flags = TST_CHECK_MALLOC}, \
+	{.name = desc " G4 BE", .tst_fn = fn, .data = &G4_BE, \
+	 .flags = TST_CHECK_MALLOC}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit bits testsuite",
+	.tests = {
+		BITS_TESTS("Subpixmap getpixel", subpixmap_getpixel),
+		BITS_TESTS("Subpixmap fill", subpixmap_fill),
+		BITS_TESTS("Blit bits", blit_bits),
+		{.name = NULL},
+	}
+};
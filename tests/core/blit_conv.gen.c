@@ -0,0 +1,21440 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * blit_conv.gen.c
+ *
+ * GENERATED on 2026 10 17 00:30:14 from blit_conv.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Blit conversions tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_convert.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_threads.h>
+#include <core/gp_mix_pixels2.gen.h>
+
+#include "tst_test.h"
+
+static void fill_pixmap(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			gp_putpixel(c, x, y, p);
+}
+
+static void mess_pixmap(gp_pixmap *c)
+{
+	gp_coord y;
+	unsigned int i;
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		uint8_t *row = GP_PIXEL_ADDR(c, 0, y);
+		for (i = 0; i < c->bytes_per_row; i++) {
+			row[i] = y ^ i;
+		}
+	}
+}
+
+static int check_filled(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+	gp_pixel pc;
+
+	for (x = 0; x < (gp_coord)c->w; x++) {
+		for (y = 0; y < (gp_coord)c->h; y++) {
+			pc = gp_getpixel(c, x, y);
+			if (p != pc) {
+				tst_msg("Pixels different %08"PRIx64" %08"PRIx64, p, pc);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static gp_pixel rgb_to_pixel(int r, int g, int b, gp_pixmap *c)
+{
+	if (gp_pixel_has_flags(c->pixel_type, GP_PIXEL_HAS_ALPHA))
+		return gp_rgba_to_pixmap_pixel(r, g, b, 0xff, c);
+
+	return gp_rgb_to_pixmap_pixel(r, g, b, c);
+}
+
+static int blit_black_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB161616_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA16161616_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB161616_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA16161616_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+static int blit_equal_pixel_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB161616_to_RGB161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGBA16161616_to_RGBA16161616(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+
+static int blit_red_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_green_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_blue_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_gray_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_red_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_green_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_blue_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_gray_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+/*
+ * Checks the vectorized whole row converters against per pixel conversion on
+ * a subrectangle with odd width so that loop tails are exercised as well.
+ */
+static int blit_convert_rows(void)
+{
+	gp_pixel_type src_type, dst_type;
+	unsigned int cnt = 0;
+	gp_coord x, y;
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (!gp_convert_row_get(src_type, dst_type))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(67, 11, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(67, 11, dst_type);
+
+			if (src == NULL || dst == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				tst_msg("Malloc failed :(");
+				return TST_UNTESTED;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+
+			gp_blit_xywh(src, 1, 1, 63, 9, dst, 2, 1);
+
+			for (y = 0; y < 9; y++) {
+				for (x = 0; x < 63; x++) {
+					gp_pixel ps = gp_getpixel(src, x + 1, y + 1);
+					gp_pixel pd = gp_getpixel(dst, x + 2, y + 1);
+					gp_pixel exp = gp_convert_pixel(ps, src_type, dst_type);
+
+					if (pd != exp) {
+						tst_msg("%s -> %s %08"PRIx64" -> %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        ps, pd, exp);
+						gp_pixmap_free(src);
+						gp_pixmap_free(dst);
+						return TST_FAILED;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			cnt++;
+		}
+	}
+
+	tst_msg("Checked %u row converters", cnt);
+
+	return TST_SUCCESS;
+}
+
+static gp_pixel mix_pixels(gp_pixel_type src_type, gp_pixel_type dst_type,
+                           gp_pixel src, gp_pixel dst)
+{
+	switch (src_type) {
+	case GP_PIXEL_RGBA8888:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return gp_mix_pixels_RGBA8888_xRGB8888(src, dst);
+		case GP_PIXEL_RGBA8888:
+			return gp_mix_pixels_RGBA8888_RGBA8888(src, dst);
+		case GP_PIXEL_RGB888:
+			return gp_mix_pixels_RGBA8888_RGB888(src, dst);
+		case GP_PIXEL_BGR888:
+			return gp_mix_pixels_RGBA8888_BGR888(src, dst);
+		case GP_PIXEL_RGB555:
+			return gp_mix_pixels_RGBA8888_RGB555(src, dst);
+		case GP_PIXEL_RGB565:
+			return gp_mix_pixels_RGBA8888_RGB565(src, dst);
+		case GP_PIXEL_RGB666:
+			return gp_mix_pixels_RGBA8888_RGB666(src, dst);
+		case GP_PIXEL_RGB332:
+			return gp_mix_pixels_RGBA8888_RGB332(src, dst);
+		case GP_PIXEL_CMYK8888:
+			return gp_mix_pixels_RGBA8888_CMYK8888(src, dst);
+		case GP_PIXEL_G1:
+			return gp_mix_pixels_RGBA8888_G1(src, dst);
+		case GP_PIXEL_G2:
+			return gp_mix_pixels_RGBA8888_G2(src, dst);
+		case GP_PIXEL_G4:
+			return gp_mix_pixels_RGBA8888_G4(src, dst);
+		case GP_PIXEL_G8:
+			return gp_mix_pixels_RGBA8888_G8(src, dst);
+		case GP_PIXEL_GA88:
+			return gp_mix_pixels_RGBA8888_GA88(src, dst);
+		case GP_PIXEL_G16:
+			return gp_mix_pixels_RGBA8888_G16(src, dst);
+		case GP_PIXEL_RGBA8888_PM:
+			return gp_mix_pixels_RGBA8888_RGBA8888_PM(src, dst);
+		case GP_PIXEL_RGB161616:
+			return gp_mix_pixels_RGBA8888_RGB161616(src, dst);
+		case GP_PIXEL_RGBA16161616:
+			return gp_mix_pixels_RGBA8888_RGBA16161616(src, dst);
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return gp_mix_pixels_GA88_xRGB8888(src, dst);
+		case GP_PIXEL_RGBA8888:
+			return gp_mix_pixels_GA88_RGBA8888(src, dst);
+		case GP_PIXEL_RGB888:
+			return gp_mix_pixels_GA88_RGB888(src, dst);
+		case GP_PIXEL_BGR888:
+			return gp_mix_pixels_GA88_BGR888(src, dst);
+		case GP_PIXEL_RGB555:
+			return gp_mix_pixels_GA88_RGB555(src, dst);
+		case GP_PIXEL_RGB565:
+			return gp_mix_pixels_GA88_RGB565(src, dst);
+		case GP_PIXEL_RGB666:
+			return gp_mix_pixels_GA88_RGB666(src, dst);
+		case GP_PIXEL_RGB332:
+			return gp_mix_pixels_GA88_RGB332(src, dst);
+		case GP_PIXEL_CMYK8888:
+			return gp_mix_pixels_GA88_CMYK8888(src, dst);
+		case GP_PIXEL_G1:
+			return gp_mix_pixels_GA88_G1(src, dst);
+		case GP_PIXEL_G2:
+			return gp_mix_pixels_GA88_G2(src, dst);
+		case GP_PIXEL_G4:
+			return gp_mix_pixels_GA88_G4(src, dst);
+		case GP_PIXEL_G8:
+			return gp_mix_pixels_GA88_G8(src, dst);
+		case GP_PIXEL_GA88:
+			return gp_mix_pixels_GA88_GA88(src, dst);
+		case GP_PIXEL_G16:
+			return gp_mix_pixels_GA88_G16(src, dst);
+		case GP_PIXEL_RGBA8888_PM:
+			return gp_mix_pixels_GA88_RGBA8888_PM(src, dst);
+		case GP_PIXEL_RGB161616:
+			return gp_mix_pixels_GA88_RGB161616(src, dst);
+		case GP_PIXEL_RGBA16161616:
+			return gp_mix_pixels_GA88_RGBA16161616(src, dst);
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return gp_mix_pixels_RGBA8888_PM_xRGB8888(src, dst);
+		case GP_PIXEL_RGBA8888:
+			return gp_mix_pixels_RGBA8888_PM_RGBA8888(src, dst);
+		case GP_PIXEL_RGB888:
+			return gp_mix_pixels_RGBA8888_PM_RGB888(src, dst);
+		case GP_PIXEL_BGR888:
+			return gp_mix_pixels_RGBA8888_PM_BGR888(src, dst);
+		case GP_PIXEL_RGB555:
+			return gp_mix_pixels_RGBA8888_PM_RGB555(src, dst);
+		case GP_PIXEL_RGB565:
+			return gp_mix_pixels_RGBA8888_PM_RGB565(src, dst);
+		case GP_PIXEL_RGB666:
+			return gp_mix_pixels_RGBA8888_PM_RGB666(src, dst);
+		case GP_PIXEL_RGB332:
+			return gp_mix_pixels_RGBA8888_PM_RGB332(src, dst);
+		case GP_PIXEL_CMYK8888:
+			return gp_mix_pixels_RGBA8888_PM_CMYK8888(src, dst);
+		case GP_PIXEL_G1:
+			return gp_mix_pixels_RGBA8888_PM_G1(src, dst);
+		case GP_PIXEL_G2:
+			return gp_mix_pixels_RGBA8888_PM_G2(src, dst);
+		case GP_PIXEL_G4:
+			return gp_mix_pixels_RGBA8888_PM_G4(src, dst);
+		case GP_PIXEL_G8:
+			return gp_mix_pixels_RGBA8888_PM_G8(src, dst);
+		case GP_PIXEL_GA88:
+			return gp_mix_pixels_RGBA8888_PM_GA88(src, dst);
+		case GP_PIXEL_G16:
+			return gp_mix_pixels_RGBA8888_PM_G16(src, dst);
+		case GP_PIXEL_RGBA8888_PM:
+			return gp_mix_pixels_RGBA8888_PM_RGBA8888_PM(src, dst);
+		case GP_PIXEL_RGB161616:
+			return gp_mix_pixels_RGBA8888_PM_RGB161616(src, dst);
+		case GP_PIXEL_RGBA16161616:
+			return gp_mix_pixels_RGBA8888_PM_RGBA16161616(src, dst);
+		default:
+		break;
+		}
+	break;
+	case GP_PIXEL_RGBA16161616:
+		switch (dst_type) {
+		case GP_PIXEL_xRGB8888:
+			return gp_mix_pixels_RGBA16161616_xRGB8888(src, dst);
+		case GP_PIXEL_RGBA8888:
+			return gp_mix_pixels_RGBA16161616_RGBA8888(src, dst);
+		case GP_PIXEL_RGB888:
+			return gp_mix_pixels_RGBA16161616_RGB888(src, dst);
+		case GP_PIXEL_BGR888:
+			return gp_mix_pixels_RGBA16161616_BGR888(src, dst);
+		case GP_PIXEL_RGB555:
+			return gp_mix_pixels_RGBA16161616_RGB555(src, dst);
+		case GP_PIXEL_RGB565:
+			return gp_mix_pixels_RGBA16161616_RGB565(src, dst);
+		case GP_PIXEL_RGB666:
+			return gp_mix_pixels_RGBA16161616_RGB666(src, dst);
+		case GP_PIXEL_RGB332:
+			return gp_mix_pixels_RGBA16161616_RGB332(src, dst);
+		case GP_PIXEL_CMYK8888:
+			return gp_mix_pixels_RGBA16161616_CMYK8888(src, dst);
+		case GP_PIXEL_G1:
+			return gp_mix_pixels_RGBA16161616_G1(src, dst);
+		case GP_PIXEL_G2:
+			return gp_mix_pixels_RGBA16161616_G2(src, dst);
+		case GP_PIXEL_G4:
+			return gp_mix_pixels_RGBA16161616_G4(src, dst);
+		case GP_PIXEL_G8:
+			return gp_mix_pixels_RGBA16161616_G8(src, dst);
+		case GP_PIXEL_GA88:
+			return gp_mix_pixels_RGBA16161616_GA88(src, dst);
+		case GP_PIXEL_G16:
+			return gp_mix_pixels_RGBA16161616_G16(src, dst);
+		case GP_PIXEL_RGBA8888_PM:
+			return gp_mix_pixels_RGBA16161616_RGBA8888_PM(src, dst);
+		case GP_PIXEL_RGB161616:
+			return gp_mix_pixels_RGBA16161616_RGB161616(src, dst);
+		case GP_PIXEL_RGBA16161616:
+			return gp_mix_pixels_RGBA16161616_RGBA16161616(src, dst);
+		default:
+		break;
+		}
+	break;
+	default:
+	break;
+	}
+
+	return 0;
+}
+
+/*
+ * Checks the vectorized row compositors against per pixel mixing, the area
+ * is big enough to be split between threads.
+ */
+static int blit_blend_rows(void)
+{
+	gp_pixel_type src_type, dst_type;
+	unsigned int cnt = 0;
+	gp_coord x, y;
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (!gp_blend_row_get(src_type, dst_type))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(303, 233, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(303, 233, dst_type);
+			gp_pixmap *orig = gp_pixmap_alloc(303, 233, dst_type);
+
+			if (src == NULL || dst == NULL || orig == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				gp_pixmap_free(orig);
+				tst_msg("Malloc failed :(");
+				return TST_UNTESTED;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+			mess_pixmap(orig);
+
+			gp_blit_xywh(src, 1, 2, 299, 230, dst, 3, 1);
+
+			for (y = 0; y < 230; y++) {
+				for (x = 0; x < 299; x++) {
+					gp_pixel ps = gp_getpixel(src, x + 1, y + 2);
+					gp_pixel pd = gp_getpixel(dst, x + 3, y + 1);
+					gp_pixel po = gp_getpixel(orig, x + 3, y + 1);
+					gp_pixel exp = mix_pixels(src_type, dst_type, ps, po);
+
+					if (pd != exp) {
+						tst_msg("%s -> %s %08"PRIx64" onto %08"PRIx64" = %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        ps, po, pd, exp);
+						gp_pixmap_free(src);
+						gp_pixmap_free(dst);
+						gp_pixmap_free(orig);
+						return TST_FAILED;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			gp_pixmap_free(orig);
+			cnt++;
+		}
+	}
+
+	tst_msg("Checked %u row compositors", cnt);
+
+	return TST_SUCCESS;
+}
+
+/*
+ * Checks that blending premultiplied pixmap gives the same result, up to
+ * rounding, as blending the original pixmap with straight alpha.
+ */
+static int blit_blend_premultiplied(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(256, 256, GP_PIXEL_RGBA8888);
+	gp_pixmap *pm = gp_pixmap_alloc(256, 256, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(256, 256, GP_PIXEL_RGB888);
+	gp_pixmap *dst_pm = gp_pixmap_alloc(256, 256, GP_PIXEL_RGB888);
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+	int i;
+
+	if (!src || !pm || !dst || !dst_pm) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	/* All combinations of color and alpha values */
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++)
+			gp_putpixel_raw(src, x, y, GP_PIXEL_CREATE_RGBA8888(x, 255 - x, x ^ y, y));
+	}
+
+	mess_pixmap(dst);
+	gp_blit_xywh(dst, 0, 0, 256, 256, dst_pm, 0, 0);
+
+	gp_blit_xywh(src, 0, 0, 256, 256, pm, 0, 0);
+
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++) {
+			gp_pixel ps = gp_getpixel_raw(src, x, y);
+			gp_pixel pp = gp_getpixel_raw(pm, x, y);
+
+			if (pp != gp_convert_pixel(ps, GP_PIXEL_RGBA8888, GP_PIXEL_RGBA8888_PM)) {
+				tst_msg("Premultiply %08"PRIx64" -> %08"PRIx64, ps, pp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+	gp_blit_xywh(src, 0, 0, 256, 256, dst, 0, 0);
+	gp_blit_xywh(pm, 0, 0, 256, 256, dst_pm, 0, 0);
+
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++) {
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+			gp_pixel p_pm = gp_getpixel_raw(dst_pm, x, y);
+
+			for (i = 0; i < 24; i += 8) {
+				int diff = (int)((p >> i) & 0xff) - (int)((p_pm >> i) & 0xff);
+
+				if (diff < -1 || diff > 1) {
+					tst_msg("Pixel %ix%i %06"PRIx64", premultiplied %06"PRIx64,
+					        x, y, p, p_pm);
+					ret = TST_FAILED;
+					goto exit;
+				}
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(pm);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(dst_pm);
+	return ret;
+}
+
+/*
+ * Checks that blits split into tiles and processed in parallel give the same
+ * result as blits of single rows for all pixel type pairs.
+ */
+static int blit_tiles(void)
+{
+	gp_pixel_type src_type, dst_type;
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+
+	gp_nr_threads_set(4);
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		if (gp_pixel_has_flags(src_type, GP_PIXEL_IS_PALETTE))
+			continue;
+
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (gp_pixel_has_flags(dst_type, GP_PIXEL_IS_PALETTE))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(303, 233, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(303, 233, dst_type);
+			gp_pixmap *ref = gp_pixmap_alloc(303, 233, dst_type);
+
+			if (src == NULL || dst == NULL || ref == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				gp_pixmap_free(ref);
+				tst_msg("Malloc failed :(");
+				ret = TST_UNTESTED;
+				goto exit;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+			mess_pixmap(ref);
+
+			gp_blit_xywh(src, 1, 2, 299, 230, dst, 3, 1);
+
+			for (y = 0; y < 230; y++)
+				gp_blit_xywh(src, 1, y + 2, 299, 1, ref, 3, y + 1);
+
+			for (y = 0; y < (gp_coord)dst->h; y++) {
+				for (x = 0; x < (gp_coord)dst->w; x++) {
+					gp_pixel pd = gp_getpixel(dst, x, y);
+					gp_pixel pr = gp_getpixel(ref, x, y);
+
+					if (pd != pr) {
+						tst_msg("%s -> %s %ix%i %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        x, y, pd, pr);
+						ret = TST_FAILED;
+						break;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			gp_pixmap_free(ref);
+
+			if (ret)
+				goto exit;
+		}
+	}
+
+exit:
+	gp_nr_threads_set(0);
+	return ret;
+}
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit Conversions Testsuite",
+	.tests = {
+		{.name = "Blit black xRGB8888 to xRGB8888",
+		 .tst_fn = blit_black_xRGB8888_to_xRGB8888},
+		{.name = "Blit white xRGB8888 to xRGB8888",
+		 .tst_fn = blit_white_xRGB8888_to_xRGB8888},
+		{.name = "Blit black xRGB8888 to RGBA8888",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA8888},
+		{.name = "Blit white xRGB8888 to RGBA8888",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA8888},
+		{.name = "Blit black xRGB8888 to RGB888",
+		 .tst_fn = blit_black_xRGB8888_to_RGB888},
+		{.name = "Blit white xRGB8888 to RGB888",
+		 .tst_fn = blit_white_xRGB8888_to_RGB888},
+		{.name = "Blit black xRGB8888 to BGR888",
+		 .tst_fn = blit_black_xRGB8888_to_BGR888},
+		{.name = "Blit white xRGB8888 to BGR888",
+		 .tst_fn = blit_white_xRGB8888_to_BGR888},
+		{.name = "Blit black xRGB8888 to RGB555",
+		 .tst_fn = blit_black_xRGB8888_to_RGB555},
+		{.name = "Blit white xRGB8888 to RGB555",
+		 .tst_fn = blit_white_xRGB8888_to_RGB555},
+		{.name = "Blit black xRGB8888 to RGB565",
+		 .tst_fn = blit_black_xRGB8888_to_RGB565},
+		{.name = "Blit white xRGB8888 to RGB565",
+		 .tst_fn = blit_white_xRGB8888_to_RGB565},
+		{.name = "Blit black xRGB8888 to RGB666",
+		 .tst_fn = blit_black_xRGB8888_to_RGB666},
+		{.name = "Blit white xRGB8888 to RGB666",
+		 .tst_fn = blit_white_xRGB8888_to_RGB666},
+		{.name = "Blit black xRGB8888 to RGB332",
+		 .tst_fn = blit_black_xRGB8888_to_RGB332},
+		{.name = "Blit white xRGB8888 to RGB332",
+		 .tst_fn = blit_white_xRGB8888_to_RGB332},
+		{.name = "Blit black xRGB8888 to CMYK8888",
+		 .tst_fn = blit_black_xRGB8888_to_CMYK8888},
+		{.name = "Blit white xRGB8888 to CMYK8888",
+		 .tst_fn = blit_white_xRGB8888_to_CMYK8888},
+		{.name = "Blit black xRGB8888 to G1",
+		 .tst_fn = blit_black_xRGB8888_to_G1},
+		{.name = "Blit white xRGB8888 to G1",
+		 .tst_fn = blit_white_xRGB8888_to_G1},
+		{.name = "Blit black xRGB8888 to G2",
+		 .tst_fn = blit_black_xRGB8888_to_G2},
+		{.name = "Blit white xRGB8888 to G2",
+		 .tst_fn = blit_white_xRGB8888_to_G2},
+		{.name = "Blit black xRGB8888 to G4",
+		 .tst_fn = blit_black_xRGB8888_to_G4},
+		{.name = "Blit white xRGB8888 to G4",
+		 .tst_fn = blit_white_xRGB8888_to_G4},
+		{.name = "Blit black xRGB8888 to G8",
+		 .tst_fn = blit_black_xRGB8888_to_G8},
+		{.name = "Blit white xRGB8888 to G8",
+		 .tst_fn = blit_white_xRGB8888_to_G8},
+		{.name = "Blit black xRGB8888 to GA88",
+		 .tst_fn = blit_black_xRGB8888_to_GA88},
+		{.name = "Blit white xRGB8888 to GA88",
+		 .tst_fn = blit_white_xRGB8888_to_GA88},
+		{.name = "Blit black xRGB8888 to G16",
+		 .tst_fn = blit_black_xRGB8888_to_G16},
+		{.name = "Blit white xRGB8888 to G16",
+		 .tst_fn = blit_white_xRGB8888_to_G16},
+		{.name = "Blit black xRGB8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA8888_PM},
+		{.name = "Blit white xRGB8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA8888_PM},
+		{.name = "Blit black xRGB8888 to RGB161616",
+		 .tst_fn = blit_black_xRGB8888_to_RGB161616},
+		{.name = "Blit white xRGB8888 to RGB161616",
+		 .tst_fn = blit_white_xRGB8888_to_RGB161616},
+		{.name = "Blit black xRGB8888 to RGBA16161616",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA16161616},
+		{.name = "Blit white xRGB8888 to RGBA16161616",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA16161616},
+		{.name = "Blit black RGBA8888 to xRGB8888",
+		 .tst_fn = blit_black_RGBA8888_to_xRGB8888},
+		{.name = "Blit white RGBA8888 to xRGB8888",
+		 .tst_fn = blit_white_RGBA8888_to_xRGB8888},
+		{.name = "Blit black RGBA8888 to RGBA8888",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA8888},
+		{.name = "Blit white RGBA8888 to RGBA8888",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA8888},
+		{.name = "Blit black RGBA8888 to RGB888",
+		 .tst_fn = blit_black_RGBA8888_to_RGB888},
+		{.name = "Blit white RGBA8888 to RGB888",
+		 .tst_fn = blit_white_RGBA8888_to_RGB888},
+		{.name = "Blit black RGBA8888 to BGR888",
+		 .tst_fn = blit_black_RGBA8888_to_BGR888},
+		{.name = "Blit white RGBA8888 to BGR888",
+		 .tst_fn = blit_white_RGBA8888_to_BGR888},
+		{.name = "Blit black RGBA8888 to RGB555",
+		 .tst_fn = blit_black_RGBA8888_to_RGB555},
+		{.name = "Blit white RGBA8888 to RGB555",
+		 .tst_fn = blit_white_RGBA8888_to_RGB555},
+		{.name = "Blit black RGBA8888 to RGB565",
+		 .tst_fn = blit_black_RGBA8888_to_RGB565},
+		{.name = "Blit white RGBA8888 to RGB565",
+		 .tst_fn = blit_white_RGBA8888_to_RGB565},
+		{.name = "Blit black RGBA8888 to RGB666",
+		 .tst_fn = blit_black_RGBA8888_to_RGB666},
+		{.name = "Blit white RGBA8888 to RGB666",
+		 .tst_fn = blit_white_RGBA8888_to_RGB666},
+		{.name = "Blit black RGBA8888 to RGB332",
+		 .tst_fn = blit_black_RGBA8888_to_RGB332},
+		{.name = "Blit white RGBA8888 to RGB332",
+		 .tst_fn = blit_white_RGBA8888_to_RGB332},
+		{.name = "Blit black RGBA8888 to CMYK8888",
+		 .tst_fn = blit_black_RGBA8888_to_CMYK8888},
+		{.name = "Blit white RGBA8888 to CMYK8888",
+		 .tst_fn = blit_white_RGBA8888_to_CMYK8888},
+		{.name = "Blit black RGBA8888 to G1",
+		 .tst_fn = blit_black_RGBA8888_to_G1},
+		{.name = "Blit white RGBA8888 to G1",
+		 .tst_fn = blit_white_RGBA8888_to_G1},
+		{.name = "Blit black RGBA8888 to G2",
+		 .tst_fn = blit_black_RGBA8888_to_G2},
+		{.name = "Blit white RGBA8888 to G2",
+		 .tst_fn = blit_white_RGBA8888_to_G2},
+		{.name = "Blit black RGBA8888 to G4",
+		 .tst_fn = blit_black_RGBA8888_to_G4},
+		{.name = "Blit white RGBA8888 to G4",
+		 .tst_fn = blit_white_RGBA8888_to_G4},
+		{.name = "Blit black RGBA8888 to G8",
+		 .tst_fn = blit_black_RGBA8888_to_G8},
+		{.name = "Blit white RGBA8888 to G8",
+		 .tst_fn = blit_white_RGBA8888_to_G8},
+		{.name = "Blit black RGBA8888 to GA88",
+		 .tst_fn = blit_black_RGBA8888_to_GA88},
+		{.name = "Blit white RGBA8888 to GA88",
+		 .tst_fn = blit_white_RGBA8888_to_GA88},
+		{.name = "Blit black RGBA8888 to G16",
+		 .tst_fn = blit_black_RGBA8888_to_G16},
+		{.name = "Blit white RGBA8888 to G16",
+		 .tst_fn = blit_white_RGBA8888_to_G16},
+		{.name = "Blit black RGBA8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA8888_PM},
+		{.name = "Blit white RGBA8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA8888_PM},
+		{.name = "Blit black RGBA8888 to RGB161616",
+		 .tst_fn = blit_black_RGBA8888_to_RGB161616},
+		{.name = "Blit white RGBA8888 to RGB161616",
+		 .tst_fn = blit_white_RGBA8888_to_RGB161616},
+		{.name = "Blit black RGBA8888 to RGBA16161616",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA16161616},
+		{.name = "Blit white RGBA8888 to RGBA16161616",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA16161616},
+		{.name = "Blit black RGB888 to xRGB8888",
+		 .tst_fn = blit_black_RGB888_to_xRGB8888},
+		{.name = "Blit white RGB888 to xRGB8888",
+		 .tst_fn = blit_white_RGB888_to_xRGB8888},
+		{.name = "Blit black RGB888 to RGBA8888",
+		 .tst_fn = blit_black_RGB888_to_RGBA8888},
+		{.name = "Blit white RGB888 to RGBA8888",
+		 .tst_fn = blit_white_RGB888_to_RGBA8888},
+		{.name = "Blit black RGB888 to RGB888",
+		 .tst_fn = blit_black_RGB888_to_RGB888},
+		{.name = "Blit white RGB888 to RGB888",
+		 .tst_fn = blit_white_RGB888_to_RGB888},
+		{.name = "Blit black RGB888 to BGR888",
+		 .tst_fn = blit_black_RGB888_to_BGR888},
+		{.name = "Blit white RGB888 to BGR888",
+		 .tst_fn = blit_white_RGB888_to_BGR888},
+		{.name = "Blit black RGB888 to RGB555",
+		 .tst_fn = blit_black_RGB888_to_RGB555},
+		{.name = "Blit white RGB888 to RGB555",
+		 .tst_fn = blit_white_RGB888_to_RGB555},
+		{.name = "Blit black RGB888 to RGB565",
+		 .tst_fn = blit_black_RGB888_to_RGB565},
+		{.name = "Blit white RGB888 to RGB565",
+		 .tst_fn = blit_white_RGB888_to_RGB565},
+		{.name = "Blit black RGB888 to RGB666",
+		 .tst_fn = blit_black_RGB888_to_RGB666},
+		{.name = "Blit white RGB888 to RGB666",
+		 .tst_fn = blit_white_RGB888_to_RGB666},
+		{.name = "Blit black RGB888 to RGB332",
+		 .tst_fn = blit_black_RGB888_to_RGB332},
+		{.name = "Blit white RGB888 to RGB332",
+		 .tst_fn = blit_white_RGB888_to_RGB332},
+		{.name = "Blit black RGB888 to CMYK8888",
+		 .tst_fn = blit_black_RGB888_to_CMYK8888},
+		{.name = "Blit white RGB888 to CMYK8888",
+		 .tst_fn = blit_white_RGB888_to_CMYK8888},
+		{.name = "Blit black RGB888 to G1",
+		 .tst_fn = blit_black_RGB888_to_G1},
+		{.name = "Blit white RGB888 to G1",
+		 .tst_fn = blit_white_RGB888_to_G1},
+		{.name = "Blit black RGB888 to G2",
+		 .tst_fn = blit_black_RGB888_to_G2},
+		{.name = "Blit white RGB888 to G2",
+		 .tst_fn = blit_white_RGB888_to_G2},
+		{.name = "Blit black RGB888 to G4",
+		 .tst_fn = blit_black_RGB888_to_G4},
+		{.name = "Blit white RGB888 to G4",
+		 .tst_fn = blit_white_RGB888_to_G4},
+		{.name = "Blit black RGB888 to G8",
+		 .tst_fn = blit_black_RGB888_to_G8},
+		{.name = "Blit white RGB888 to G8",
+		 .tst_fn = blit_white_RGB888_to_G8},
+		{.name = "Blit black RGB888 to GA88",
+		 .tst_fn = blit_black_RGB888_to_GA88},
+		{.name = "Blit white RGB888 to GA88",
+		 .tst_fn = blit_white_RGB888_to_GA88},
+		{.name = "Blit black RGB888 to G16",
+		 .tst_fn = blit_black_RGB888_to_G16},
+		{.name = "Blit white RGB888 to G16",
+		 .tst_fn = blit_white_RGB888_to_G16},
+		{.name = "Blit black RGB888 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB888_to_RGBA8888_PM},
+		{.name = "Blit white RGB888 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB888_to_RGBA8888_PM},
+		{.name = "Blit black RGB888 to RGB161616",
+		 .tst_fn = blit_black_RGB888_to_RGB161616},
+		{.name = "Blit white RGB888 to RGB161616",
+		 .tst_fn = blit_white_RGB888_to_RGB161616},
+		{.name = "Blit black RGB888 to RGBA16161616",
+		 .tst_fn = blit_black_RGB888_to_RGBA16161616},
+		{.name = "Blit white RGB888 to RGBA16161616",
+		 .tst_fn = blit_white_RGB888_to_RGBA16161616},
+		{.name = "Blit black BGR888 to xRGB8888",
+		 .tst_fn = blit_black_BGR888_to_xRGB8888},
+		{.name = "Blit white BGR888 to xRGB8888",
+		 .tst_fn = blit_white_BGR888_to_xRGB8888},
+		{.name = "Blit black BGR888 to RGBA8888",
+		 .tst_fn = blit_black_BGR888_to_RGBA8888},
+		{.name = "Blit white BGR888 to RGBA8888",
+		 .tst_fn = blit_white_BGR888_to_RGBA8888},
+		{.name = "Blit black BGR888 to RGB888",
+		 .tst_fn = blit_black_BGR888_to_RGB888},
+		{.name = "Blit white BGR888 to RGB888",
+		 .tst_fn = blit_white_BGR888_to_RGB888},
+		{.name = "Blit black BGR888 to BGR888",
+		 .tst_fn = blit_black_BGR888_to_BGR888},
+		{.name = "Blit white BGR888 to BGR888",
+		 .tst_fn = blit_white_BGR888_to_BGR888},
+		{.name = "Blit black BGR888 to RGB555",
+		 .tst_fn = blit_black_BGR888_to_RGB555},
+		{.name = "Blit white BGR888 to RGB555",
+		 .tst_fn = blit_white_BGR888_to_RGB555},
+		{.name = "Blit black BGR888 to RGB565",
+		 .tst_fn = blit_black_BGR888_to_RGB565},
+		{.name = "Blit white BGR888 to RGB565",
+		 .tst_fn = blit_white_BGR888_to_RGB565},
+		{.name = "Blit black BGR888 to RGB666",
+		 .tst_fn = blit_black_BGR888_to_RGB666},
+		{.name = "Blit white BGR888 to RGB666",
+		 .tst_fn = blit_white_BGR888_to_RGB666},
+		{.name = "Blit black BGR888 to RGB332",
+		 .tst_fn = blit_black_BGR888_to_RGB332},
+		{.name = "Blit white BGR888 to RGB332",
+		 .tst_fn = blit_white_BGR888_to_RGB332},
+		{.name = "Blit black BGR888 to CMYK8888",
+		 .tst_fn = blit_black_BGR888_to_CMYK8888},
+		{.name = "Blit white BGR888 to CMYK8888",
+		 .tst_fn = blit_white_BGR888_to_CMYK8888},
+		{.name = "Blit black BGR888 to G1",
+		 .tst_fn = blit_black_BGR888_to_G1},
+		{.name = "Blit white BGR888 to G1",
+		 .tst_fn = blit_white_BGR888_to_G1},
+		{.name = "Blit black BGR888 to G2",
+		 .tst_fn = blit_black_BGR888_to_G2},
+		{.name = "Blit white BGR888 to G2",
+		 .tst_fn = blit_white_BGR888_to_G2},
+		{.name = "Blit black BGR888 to G4",
+		 .tst_fn = blit_black_BGR888_to_G4},
+		{.name = "Blit white BGR888 to G4",
+		 .tst_fn = blit_white_BGR888_to_G4},
+		{.name = "Blit black BGR888 to G8",
+		 .tst_fn = blit_black_BGR888_to_G8},
+		{.name = "Blit white BGR888 to G8",
+		 .tst_fn = blit_white_BGR888_to_G8},
+		{.name = "Blit black BGR888 to GA88",
+		 .tst_fn = blit_black_BGR888_to_GA88},
+		{.name = "Blit white BGR888 to GA88",
+		 .tst_fn = blit_white_BGR888_to_GA88},
+		{.name = "Blit black BGR888 to G16",
+		 .tst_fn = blit_black_BGR888_to_G16},
+		{.name = "Blit white BGR888 to G16",
+		 .tst_fn = blit_white_BGR888_to_G16},
+		{.name = "Blit black BGR888 to RGBA8888_PM",
+		 .tst_fn = blit_black_BGR888_to_RGBA8888_PM},
+		{.name = "Blit white BGR888 to RGBA8888_PM",
+		 .tst_fn = blit_white_BGR888_to_RGBA8888_PM},
+		{.name = "Blit black BGR888 to RGB161616",
+		 .tst_fn = blit_black_BGR888_to_RGB161616},
+		{.name = "Blit white BGR888 to RGB161616",
+		 .tst_fn = blit_white_BGR888_to_RGB161616},
+		{.name = "Blit black BGR888 to RGBA16161616",
+		 .tst_fn = blit_black_BGR888_to_RGBA16161616},
+		{.name = "Blit white BGR888 to RGBA16161616",
+		 .tst_fn = blit_white_BGR888_to_RGBA16161616},
+		{.name = "Blit black RGB555 to xRGB8888",
+		 .tst_fn = blit_black_RGB555_to_xRGB8888},
+		{.name = "Blit white RGB555 to xRGB8888",
+		 .tst_fn = blit_white_RGB555_to_xRGB8888},
+		{.name = "Blit black RGB555 to RGBA8888",
+		 .tst_fn = blit_black_RGB555_to_RGBA8888},
+		{.name = "Blit white RGB555 to RGBA8888",
+		 .tst_fn = blit_white_RGB555_to_RGBA8888},
+		{.name = "Blit black RGB555 to RGB888",
+		 .tst_fn = blit_black_RGB555_to_RGB888},
+		{.name = "Blit white RGB555 to RGB888",
+		 .tst_fn = blit_white_RGB555_to_RGB888},
+		{.name = "Blit black RGB555 to BGR888",
+		 .tst_fn = blit_black_RGB555_to_BGR888},
+		{.name = "Blit white RGB555 to BGR888",
+		 .tst_fn = blit_white_RGB555_to_BGR888},
+		{.name = "Blit black RGB555 to RGB555",
+		 .tst_fn = blit_black_RGB555_to_RGB555},
+		{.name = "Blit white RGB555 to RGB555",
+		 .tst_fn = blit_white_RGB555_to_RGB555},
+		{.name = "Blit black RGB555 to RGB565",
+		 .tst_fn = blit_black_RGB555_to_RGB565},
+		{.name = "Blit white RGB555 to RGB565",
+		 .tst_fn = blit_white_RGB555_to_RGB565},
+		{.name = "Blit black RGB555 to RGB666",
+		 .tst_fn = blit_black_RGB555_to_RGB666},
+		{.name = "Blit white RGB555 to RGB666",
+		 .tst_fn = blit_white_RGB555_to_RGB666},
+		{.name = "Blit black RGB555 to RGB332",
+		 .tst_fn = blit_black_RGB555_to_RGB332},
+		{.name = "Blit white RGB555 to RGB332",
+		 .tst_fn = blit_white_RGB555_to_RGB332},
+		{.name = "Blit black RGB555 to CMYK8888",
+		 .tst_fn = blit_black_RGB555_to_CMYK8888},
+		{.name = "Blit white RGB555 to CMYK8888",
+		 .tst_fn = blit_white_RGB555_to_CMYK8888},
+		{.name = "Blit black RGB555 to G1",
+		 .tst_fn = blit_black_RGB555_to_G1},
+		{.name = "Blit white RGB555 to G1",
+		 .tst_fn = blit_white_RGB555_to_G1},
+		{.name = "Blit black RGB555 to G2",
+		 .tst_fn = blit_black_RGB555_to_G2},
+		{.name = "Blit white RGB555 to G2",
+		 .tst_fn = blit_white_RGB555_to_G2},
+		{.name = "Blit black RGB555 to G4",
+		 .tst_fn = blit_black_RGB555_to_G4},
+		{.name = "Blit white RGB555 to G4",
+		 .tst_fn = blit_white_RGB555_to_G4},
+		{.name = "Blit black RGB555 to G8",
+		 .tst_fn = blit_black_RGB555_to_G8},
+		{.name = "Blit white RGB555 to G8",
+		 .tst_fn = blit_white_RGB555_to_G8},
+		{.name = "Blit black RGB555 to GA88",
+		 .tst_fn = blit_black_RGB555_to_GA88},
+		{.name = "Blit white RGB555 to GA88",
+		 .tst_fn = blit_white_RGB555_to_GA88},
+		{.name = "Blit black RGB555 to G16",
+		 .tst_fn = blit_black_RGB555_to_G16},
+		{.name = "Blit white RGB555 to G16",
+		 .tst_fn = blit_white_RGB555_to_G16},
+		{.name = "Blit black RGB555 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB555_to_RGBA8888_PM},
+		{.name = "Blit white RGB555 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB555_to_RGBA8888_PM},
+		{.name = "Blit black RGB555 to RGB161616",
+		 .tst_fn = blit_black_RGB555_to_RGB161616},
+		{.name = "Blit white RGB555 to RGB161616",
+		 .tst_fn = blit_white_RGB555_to_RGB161616},
+		{.name = "Blit black RGB555 to RGBA16161616",
+		 .tst_fn = blit_black_RGB555_to_RGBA16161616},
+		{.name = "Blit white RGB555 to RGBA16161616",
+		 .tst_fn = blit_white_RGB555_to_RGBA16161616},
+		{.name = "Blit black RGB565 to xRGB8888",
+		 .tst_fn = blit_black_RGB565_to_xRGB8888},
+		{.name = "Blit white RGB565 to xRGB8888",
+		 .tst_fn = blit_white_RGB565_to_xRGB8888},
+		{.name = "Blit black RGB565 to RGBA8888",
+		 .tst_fn = blit_black_RGB565_to_RGBA8888},
+		{.name = "Blit white RGB565 to RGBA8888",
+		 .tst_fn = blit_white_RGB565_to_RGBA8888},
+		{.name = "Blit black RGB565 to RGB888",
+		 .tst_fn = blit_black_RGB565_to_RGB888},
+		{.name = "Blit white RGB565 to RGB888",
+		 .tst_fn = blit_white_RGB565_to_RGB888},
+		{.name = "Blit black RGB565 to BGR888",
+		 .tst_fn = blit_black_RGB565_to_BGR888},
+		{.name = "Blit white RGB565 to BGR888",
+		 .tst_fn = blit_white_RGB565_to_BGR888},
+		{.name = "Blit black RGB565 to RGB555",
+		 .tst_fn = blit_black_RGB565_to_RGB555},
+		{.name = "Blit white RGB565 to RGB555",
+		 .tst_fn = blit_white_RGB565_to_RGB555},
+		{.name = "Blit black RGB565 to RGB565",
+		 .tst_fn = blit_black_RGB565_to_RGB565},
+		{.name = "Blit white RGB565 to RGB565",
+		 .tst_fn = blit_white_RGB565_to_RGB565},
+		{.name = "Blit black RGB565 to RGB666",
+		 .tst_fn = blit_black_RGB565_to_RGB666},
+		{.name = "Blit white RGB565 to RGB666",
+		 .tst_fn = blit_white_RGB565_to_RGB666},
+		{.name = "Blit black RGB565 to RGB332",
+		 .tst_fn = blit_black_RGB565_to_RGB332},
+		{.name = "Blit white RGB565 to RGB332",
+		 .tst_fn = blit_white_RGB565_to_RGB332},
+		{.name = "Blit black RGB565 to CMYK8888",
+		 .tst_fn = blit_black_RGB565_to_CMYK8888},
+		{.name = "Blit white RGB565 to CMYK8888",
+		 .tst_fn = blit_white_RGB565_to_CMYK8888},
+		{.name = "Blit black RGB565 to G1",
+		 .tst_fn = blit_black_RGB565_to_G1},
+		{.name = "Blit white RGB565 to G1",
+		 .tst_fn = blit_white_RGB565_to_G1},
+		{.name = "Blit black RGB565 to G2",
+		 .tst_fn = blit_black_RGB565_to_G2},
+		{.name = "Blit white RGB565 to G2",
+		 .tst_fn = blit_white_RGB565_to_G2},
+		{.name = "Blit black RGB565 to G4",
+		 .tst_fn = blit_black_RGB565_to_G4},
+		{.name = "Blit white RGB565 to G4",
+		 .tst_fn = blit_white_RGB565_to_G4},
+		{.name = "Blit black RGB565 to G8",
+		 .tst_fn = blit_black_RGB565_to_G8},
+		{.name = "Blit white RGB565 to G8",
+		 .tst_fn = blit_white_RGB565_to_G8},
+		{.name = "Blit black RGB565 to GA88",
+		 .tst_fn = blit_black_RGB565_to_GA88},
+		{.name = "Blit white RGB565 to GA88",
+		 .tst_fn = blit_white_RGB565_to_GA88},
+		{.name = "Blit black RGB565 to G16",
+		 .tst_fn = blit_black_RGB565_to_G16},
+		{.name = "Blit white RGB565 to G16",
+		 .tst_fn = blit_white_RGB565_to_G16},
+		{.name = "Blit black RGB565 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB565_to_RGBA8888_PM},
+		{.name = "Blit white RGB565 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB565_to_RGBA8888_PM},
+		{.name = "Blit black RGB565 to RGB161616",
+		 .tst_fn = blit_black_RGB565_to_RGB161616},
+		{.name = "Blit white RGB565 to RGB161616",
+		 .tst_fn = blit_white_RGB565_to_RGB161616},
+		{.name = "Blit black RGB565 to RGBA16161616",
+		 .tst_fn = blit_black_RGB565_to_RGBA16161616},
+		{.name = "Blit white RGB565 to RGBA16161616",
+		 .tst_fn = blit_white_RGB565_to_RGBA16161616},
+		{.name = "Blit black RGB666 to xRGB8888",
+		 .tst_fn = blit_black_RGB666_to_xRGB8888},
+		{.name = "Blit white RGB666 to xRGB8888",
+		 .tst_fn = blit_white_RGB666_to_xRGB8888},
+		{.name = "Blit black RGB666 to RGBA8888",
+		 .tst_fn = blit_black_RGB666_to_RGBA8888},
+		{.name = "Blit white RGB666 to RGBA8888",
+		 .tst_fn = blit_white_RGB666_to_RGBA8888},
+		{.name = "Blit black RGB666 to RGB888",
+		 .tst_fn = blit_black_RGB666_to_RGB888},
+		{.name = "Blit white RGB666 to RGB888",
+		 .tst_fn = blit_white_RGB666_to_RGB888},
+		{.name = "Blit black RGB666 to BGR888",
+		 .tst_fn = blit_black_RGB666_to_BGR888},
+		{.name = "Blit white RGB666 to BGR888",
+		 .tst_fn = blit_white_RGB666_to_BGR888},
+		{.name = "Blit black RGB666 to RGB555",
+		 .tst_fn = blit_black_RGB666_to_RGB555},
+		{.name = "Blit white RGB666 to RGB555",
+		 .tst_fn = blit_white_RGB666_to_RGB555},
+		{.name = "Blit black RGB666 to RGB565",
+		 .tst_fn = blit_black_RGB666_to_RGB565},
+		{.name = "Blit white RGB666 to RGB565",
+		 .tst_fn = blit_white_RGB666_to_RGB565},
+		{.name = "Blit black RGB666 to RGB666",
+		 .tst_fn = blit_black_RGB666_to_RGB666},
+		{.name = "Blit white RGB666 to RGB666",
+		 .tst_fn = blit_white_RGB666_to_RGB666},
+		{.name = "Blit black RGB666 to RGB332",
+		 .tst_fn = blit_black_RGB666_to_RGB332},
+		{.name = "Blit white RGB666 to RGB332",
+		 .tst_fn = blit_white_RGB666_to_RGB332},
+		{.name = "Blit black RGB666 to CMYK8888",
+		 .tst_fn = blit_black_RGB666_to_CMYK8888},
+		{.name = "Blit white RGB666 to CMYK8888",
+		 .tst_fn = blit_white_RGB666_to_CMYK8888},
+		{.name = "Blit black RGB666 to G1",
+		 .tst_fn = blit_black_RGB666_to_G1},
+		{.name = "Blit white RGB666 to G1",
+		 .tst_fn = blit_white_RGB666_to_G1},
+		{.name = "Blit black RGB666 to G2",
+		 .tst_fn = blit_black_RGB666_to_G2},
+		{.name = "Blit white RGB666 to G2",
+		 .tst_fn = blit_white_RGB666_to_G2},
+		{.name = "Blit black RGB666 to G4",
+		 .tst_fn = blit_black_RGB666_to_G4},
+		{.name = "Blit white RGB666 to G4",
+		 .tst_fn = blit_white_RGB666_to_G4},
+		{.name = "Blit black RGB666 to G8",
+		 .tst_fn = blit_black_RGB666_to_G8},
+		{.name = "Blit white RGB666 to G8",
+		 .tst_fn = blit_white_RGB666_to_G8},
+		{.name = "Blit black RGB666 to GA88",
+		 .tst_fn = blit_black_RGB666_to_GA88},
+		{.name = "Blit white RGB666 to GA88",
+		 .tst_fn = blit_white_RGB666_to_GA88},
+		{.name = "Blit black RGB666 to G16",
+		 .tst_fn = blit_black_RGB666_to_G16},
+		{.name = "Blit white RGB666 to G16",
+		 .tst_fn = blit_white_RGB666_to_G16},
+		{.name = "Blit black RGB666 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB666_to_RGBA8888_PM},
+		{.name = "Blit white RGB666 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB666_to_RGBA8888_PM},
+		{.name = "Blit black RGB666 to RGB161616",
+		 .tst_fn = blit_black_RGB666_to_RGB161616},
+		{.name = "Blit white RGB666 to RGB161616",
+		 .tst_fn = blit_white_RGB666_to_RGB161616},
+		{.name = "Blit black RGB666 to RGBA16161616",
+		 .tst_fn = blit_black_RGB666_to_RGBA16161616},
+		{.name = "Blit white RGB666 to RGBA16161616",
+		 .tst_fn = blit_white_RGB666_to_RGBA16161616},
+		{.name = "Blit black RGB332 to xRGB8888",
+		 .tst_fn = blit_black_RGB332_to_xRGB8888},
+		{.name = "Blit white RGB332 to xRGB8888",
+		 .tst_fn = blit_white_RGB332_to_xRGB8888},
+		{.name = "Blit black RGB332 to RGBA8888",
+		 .tst_fn = blit_black_RGB332_to_RGBA8888},
+		{.name = "Blit white RGB332 to RGBA8888",
+		 .tst_fn = blit_white_RGB332_to_RGBA8888},
+		{.name = "Blit black RGB332 to RGB888",
+		 .tst_fn = blit_black_RGB332_to_RGB888},
+		{.name = "Blit white RGB332 to RGB888",
+		 .tst_fn = blit_white_RGB332_to_RGB888},
+		{.name = "Blit black RGB332 to BGR888",
+		 .tst_fn = blit_black_RGB332_to_BGR888},
+		{.name = "Blit white RGB332 to BGR888",
+		 .tst_fn = blit_white_RGB332_to_BGR888},
+		{.name = "Blit black RGB332 to RGB555",
+		 .tst_fn = blit_black_RGB332_to_RGB555},
+		{.name = "Blit white RGB332 to RGB555",
+		 .tst_fn = blit_white_RGB332_to_RGB555},
+		{.name = "Blit black RGB332 to RGB565",
+		 .tst_fn = blit_black_RGB332_to_RGB565},
+		{.name = "Blit white RGB332 to RGB565",
+		 .tst_fn = blit_white_RGB332_to_RGB565},
+		{.name = "Blit black RGB332 to RGB666",
+		 .tst_fn = blit_black_RGB332_to_RGB666},
+		{.name = "Blit white RGB332 to RGB666",
+		 .tst_fn = blit_white_RGB332_to_RGB666},
+		{.name = "Blit black RGB332 to RGB332",
+		 .tst_fn = blit_black_RGB332_to_RGB332},
+		{.name = "Blit white RGB332 to RGB332",
+		 .tst_fn = blit_white_RGB332_to_RGB332},
+		{.name = "Blit black RGB332 to CMYK8888",
+		 .tst_fn = blit_black_RGB332_to_CMYK8888},
+		{.name = "Blit white RGB332 to CMYK8888",
+		 .tst_fn = blit_white_RGB332_to_CMYK8888},
+		{.name = "Blit black RGB332 to G1",
+		 .tst_fn = blit_black_RGB332_to_G1},
+		{.name = "Blit white RGB332 to G1",
+		 .tst_fn = blit_white_RGB332_to_G1},
+		{.name = "Blit black RGB332 to G2",
+		 .tst_fn = blit_black_RGB332_to_G2},
+		{.name = "Blit white RGB332 to G2",
+		 .tst_fn = blit_white_RGB332_to_G2},
+		{.name = "Blit black RGB332 to G4",
+		 .tst_fn = blit_black_RGB332_to_G4},
+		{.name = "Blit white RGB332 to G4",
+		 .tst_fn = blit_white_RGB332_to_G4},
+		{.name = "Blit black RGB332 to G8",
+		 .tst_fn = blit_black_RGB332_to_G8},
+		{.name = "Blit white RGB332 to G8",
+		 .tst_fn = blit_white_RGB332_to_G8},
+		{.name = "Blit black RGB332 to GA88",
+		 .tst_fn = blit_black_RGB332_to_GA88},
+		{.name = "Blit white RGB332 to GA88",
+		 .tst_fn = blit_white_RGB332_to_GA88},
+		{.name = "Blit black RGB332 to G16",
+		 .tst_fn = blit_black_RGB332_to_G16},
+		{.name = "Blit white RGB332 to G16",
+		 .tst_fn = blit_white_RGB332_to_G16},
+		{.name = "Blit black RGB332 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB332_to_RGBA8888_PM},
+		{.name = "Blit white RGB332 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB332_to_RGBA8888_PM},
+		{.name = "Blit black RGB332 to RGB161616",
+		 .tst_fn = blit_black_RGB332_to_RGB161616},
+		{.name = "Blit white RGB332 to RGB161616",
+		 .tst_fn = blit_white_RGB332_to_RGB161616},
+		{.name = "Blit black RGB332 to RGBA16161616",
+		 .tst_fn = blit_black_RGB332_to_RGBA16161616},
+		{.name = "Blit white RGB332 to RGBA16161616",
+		 .tst_fn = blit_white_RGB332_to_RGBA16161616},
+		{.name = "Blit black CMYK8888 to xRGB8888",
+		 .tst_fn = blit_black_CMYK8888_to_xRGB8888},
+		{.name = "Blit white CMYK8888 to xRGB8888",
+		 .tst_fn = blit_white_CMYK8888_to_xRGB8888},
+		{.name = "Blit black CMYK8888 to RGBA8888",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA8888},
+		{.name = "Blit white CMYK8888 to RGBA8888",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA8888},
+		{.name = "Blit black CMYK8888 to RGB888",
+		 .tst_fn = blit_black_CMYK8888_to_RGB888},
+		{.name = "Blit white CMYK8888 to RGB888",
+		 .tst_fn = blit_white_CMYK8888_to_RGB888},
+		{.name = "Blit black CMYK8888 to BGR888",
+		 .tst_fn = blit_black_CMYK8888_to_BGR888},
+		{.name = "Blit white CMYK8888 to BGR888",
+		 .tst_fn = blit_white_CMYK8888_to_BGR888},
+		{.name = "Blit black CMYK8888 to RGB555",
+		 .tst_fn = blit_black_CMYK8888_to_RGB555},
+		{.name = "Blit white CMYK8888 to RGB555",
+		 .tst_fn = blit_white_CMYK8888_to_RGB555},
+		{.name = "Blit black CMYK8888 to RGB565",
+		 .tst_fn = blit_black_CMYK8888_to_RGB565},
+		{.name = "Blit white CMYK8888 to RGB565",
+		 .tst_fn = blit_white_CMYK8888_to_RGB565},
+		{.name = "Blit black CMYK8888 to RGB666",
+		 .tst_fn = blit_black_CMYK8888_to_RGB666},
+		{.name = "Blit white CMYK8888 to RGB666",
+		 .tst_fn = blit_white_CMYK8888_to_RGB666},
+		{.name = "Blit black CMYK8888 to RGB332",
+		 .tst_fn = blit_black_CMYK8888_to_RGB332},
+		{.name = "Blit white CMYK8888 to RGB332",
+		 .tst_fn = blit_white_CMYK8888_to_RGB332},
+		{.name = "Blit black CMYK8888 to CMYK8888",
+		 .tst_fn = blit_black_CMYK8888_to_CMYK8888},
+		{.name = "Blit white CMYK8888 to CMYK8888",
+		 .tst_fn = blit_white_CMYK8888_to_CMYK8888},
+		{.name = "Blit black CMYK8888 to G1",
+		 .tst_fn = blit_black_CMYK8888_to_G1},
+		{.name = "Blit white CMYK8888 to G1",
+		 .tst_fn = blit_white_CMYK8888_to_G1},
+		{.name = "Blit black CMYK8888 to G2",
+		 .tst_fn = blit_black_CMYK8888_to_G2},
+		{.name = "Blit white CMYK8888 to G2",
+		 .tst_fn = blit_white_CMYK8888_to_G2},
+		{.name = "Blit black CMYK8888 to G4",
+		 .tst_fn = blit_black_CMYK8888_to_G4},
+		{.name = "Blit white CMYK8888 to G4",
+		 .tst_fn = blit_white_CMYK8888_to_G4},
+		{.name = "Blit black CMYK8888 to G8",
+		 .tst_fn = blit_black_CMYK8888_to_G8},
+		{.name = "Blit white CMYK8888 to G8",
+		 .tst_fn = blit_white_CMYK8888_to_G8},
+		{.name = "Blit black CMYK8888 to GA88",
+		 .tst_fn = blit_black_CMYK8888_to_GA88},
+		{.name = "Blit white CMYK8888 to GA88",
+		 .tst_fn = blit_white_CMYK8888_to_GA88},
+		{.name = "Blit black CMYK8888 to G16",
+		 .tst_fn = blit_black_CMYK8888_to_G16},
+		{.name = "Blit white CMYK8888 to G16",
+		 .tst_fn = blit_white_CMYK8888_to_G16},
+		{.name = "Blit black CMYK8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA8888_PM},
+		{.name = "Blit white CMYK8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA8888_PM},
+		{.name = "Blit black CMYK8888 to RGB161616",
+		 .tst_fn = blit_black_CMYK8888_to_RGB161616},
+		{.name = "Blit white CMYK8888 to RGB161616",
+		 .tst_fn = blit_white_CMYK8888_to_RGB161616},
+		{.name = "Blit black CMYK8888 to RGBA16161616",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA16161616},
+		{.name = "Blit white CMYK8888 to RGBA16161616",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA16161616},
+		{.name = "Blit black G1 to xRGB8888",
+		 .tst_fn = blit_black_G1_to_xRGB8888},
+		{.name = "Blit white G1 to xRGB8888",
+		 .tst_fn = blit_white_G1_to_xRGB8888},
+		{.name = "Blit black G1 to RGBA8888",
+		 .tst_fn = blit_black_G1_to_RGBA8888},
+		{.name = "Blit white G1 to RGBA8888",
+		 .tst_fn = blit_white_G1_to_RGBA8888},
+		{.name = "Blit black G1 to RGB888",
+		 .tst_fn = blit_black_G1_to_RGB888},
+		{.name = "Blit white G1 to RGB888",
+		 .tst_fn = blit_white_G1_to_RGB888},
+		{.name = "Blit black G1 to BGR888",
+		 .tst_fn = blit_black_G1_to_BGR888},
+		{.name = "Blit white G1 to BGR888",
+		 .tst_fn = blit_white_G1_to_BGR888},
+		{.name = "Blit black G1 to RGB555",
+		 .tst_fn = blit_black_G1_to_RGB555},
+		{.name = "Blit white G1 to RGB555",
+		 .tst_fn = blit_white_G1_to_RGB555},
+		{.name = "Blit black G1 to RGB565",
+		 .tst_fn = blit_black_G1_to_RGB565},
+		{.name = "Blit white G1 to RGB565",
+		 .tst_fn = blit_white_G1_to_RGB565},
+		{.name = "Blit black G1 to RGB666",
+		 .tst_fn = blit_black_G1_to_RGB666},
+		{.name = "Blit white G1 to RGB666",
+		 .tst_fn = blit_white_G1_to_RGB666},
+		{.name = "Blit black G1 to RGB332",
+		 .tst_fn = blit_black_G1_to_RGB332},
+		{.name = "Blit white G1 to RGB332",
+		 .tst_fn = blit_white_G1_to_RGB332},
+		{.name = "Blit black G1 to CMYK8888",
+		 .tst_fn = blit_black_G1_to_CMYK8888},
+		{.name = "Blit white G1 to CMYK8888",
+		 .tst_fn = blit_white_G1_to_CMYK8888},
+		{.name = "Blit black G1 to G1",
+		 .tst_fn = blit_black_G1_to_G1},
+		{.name = "Blit white G1 to G1",
+		 .tst_fn = blit_white_G1_to_G1},
+		{.name = "Blit black G1 to G2",
+		 .tst_fn = blit_black_G1_to_G2},
+		{.name = "Blit white G1 to G2",
+		 .tst_fn = blit_white_G1_to_G2},
+		{.name = "Blit black G1 to G4",
+		 .tst_fn = blit_black_G1_to_G4},
+		{.name = "Blit white G1 to G4",
+		 .tst_fn = blit_white_G1_to_G4},
+		{.name = "Blit black G1 to G8",
+		 .tst_fn = blit_black_G1_to_G8},
+		{.name = "Blit white G1 to G8",
+		 .tst_fn = blit_white_G1_to_G8},
+		{.name = "Blit black G1 to GA88",
+		 .tst_fn = blit_black_G1_to_GA88},
+		{.name = "Blit white G1 to GA88",
+		 .tst_fn = blit_white_G1_to_GA88},
+		{.name = "Blit black G1 to G16",
+		 .tst_fn = blit_black_G1_to_G16},
+		{.name = "Blit white G1 to G16",
+		 .tst_fn = blit_white_G1_to_G16},
+		{.name = "Blit black G1 to RGBA8888_PM",
+		 .tst_fn = blit_black_G1_to_RGBA8888_PM},
+		{.name = "Blit white G1 to RGBA8888_PM",
+		 .tst_fn = blit_white_G1_to_RGBA8888_PM},
+		{.name = "Blit black G1 to RGB161616",
+		 .tst_fn = blit_black_G1_to_RGB161616},
+		{.name = "Blit white G1 to RGB161616",
+		 .tst_fn = blit_white_G1_to_RGB161616},
+		{.name = "Blit black G1 to RGBA16161616",
+		 .tst_fn = blit_black_G1_to_RGBA16161616},
+		{.name = "Blit white G1 to RGBA16161616",
+		 .tst_fn = blit_white_G1_to_RGBA16161616},
+		{.name = "Blit black G2 to xRGB8888",
+		 .tst_fn = blit_black_G2_to_xRGB8888},
+		{.name = "Blit white G2 to xRGB8888",
+		 .tst_fn = blit_white_G2_to_xRGB8888},
+		{.name = "Blit black G2 to RGBA8888",
+		 .tst_fn = blit_black_G2_to_RGBA8888},
+		{.name = "Blit white G2 to RGBA8888",
+		 .tst_fn = blit_white_G2_to_RGBA8888},
+		{.name = "Blit black G2 to RGB888",
+		 .tst_fn = blit_black_G2_to_RGB888},
+		{.name = "Blit white G2 to RGB888",
+		 .tst_fn = blit_white_G2_to_RGB888},
+		{.name = "Blit black G2 to BGR888",
+		 .tst_fn = blit_black_G2_to_BGR888},
+		{.name = "Blit white G2 to BGR888",
+		 .tst_fn = blit_white_G2_to_BGR888},
+		{.name = "Blit black G2 to RGB555",
+		 .tst_fn = blit_black_G2_to_RGB555},
+		{.name = "Blit white G2 to RGB555",
+		 .tst_fn = blit_white_G2_to_RGB555},
+		{.name = "Blit black G2 to RGB565",
+		 .tst_fn = blit_black_G2_to_RGB565},
+		{.name = "Blit white G2 to RGB565",
+		 .tst_fn = blit_white_G2_to_RGB565},
+		{.name = "Blit black G2 to RGB666",
+		 .tst_fn = blit_black_G2_to_RGB666},
+		{.name = "Blit white G2 to RGB666",
+		 .tst_fn = blit_white_G2_to_RGB666},
+		{.name = "Blit black G2 to RGB332",
+		 .tst_fn = blit_black_G2_to_RGB332},
+		{.name = "Blit white G2 to RGB332",
+		 .tst_fn = blit_white_G2_to_RGB332},
+		{.name = "Blit black G2 to CMYK8888",
+		 .tst_fn = blit_black_G2_to_CMYK8888},
+		{.name = "Blit white G2 to CMYK8888",
+		 .tst_fn = blit_white_G2_to_CMYK8888},
+		{.name = "Blit black G2 to G1",
+		 .tst_fn = blit_black_G2_to_G1},
+		{.name = "Blit white G2 to G1",
+		 .tst_fn = blit_white_G2_to_G1},
+		{.name = "Blit black G2 to G2",
+		 .tst_fn = blit_black_G2_to_G2},
+		{.name = "Blit white G2 to G2",
+		 .tst_fn = blit_white_G2_to_G2},
+		{.name = "Blit black G2 to G4",
+		 .tst_fn = blit_black_G2_to_G4},
+		{.name = "Blit white G2 to G4",
+		 .tst_fn = blit_white_G2_to_G4},
+		{.name = "Blit black G2 to G8",
+		 .tst_fn = blit_black_G2_to_G8},
+		{.name = "Blit white G2 to G8",
+		 .tst_fn = blit_white_G2_to_G8},
+		{.name = "Blit black G2 to GA88",
+		 .tst_fn = blit_black_G2_to_GA88},
+		{.name = "Blit white G2 to GA88",
+		 .tst_fn = blit_white_G2_to_GA88},
+		{.name = "Blit black G2 to G16",
+		 .tst_fn = blit_black_G2_to_G16},
+		{.name = "Blit white G2 to G16",
+		 .tst_fn = blit_white_G2_to_G16},
+		{.name = "Blit black G2 to RGBA8888_PM",
+		 .tst_fn = blit_black_G2_to_RGBA8888_PM},
+		{.name = "Blit white G2 to RGBA8888_PM",
+		 .tst_fn = blit_white_G2_to_RGBA8888_PM},
+		{.name = "Blit black G2 to RGB161616",
+		 .tst_fn = blit_black_G2_to_RGB161616},
+		{.name = "Blit white G2 to RGB161616",
+		 .tst_fn = blit_white_G2_to_RGB161616},
+		{.name = "Blit black G2 to RGBA16161616",
+		 .tst_fn = blit_black_G2_to_RGBA16161616},
+		{.name = "Blit white G2 to RGBA16161616",
+		 .tst_fn = blit_white_G2_to_RGBA16161616},
+		{.name = "Blit black G4 to xRGB8888",
+		 .tst_fn = blit_black_G4_to_xRGB8888},
+		{.name = "Blit white G4 to xRGB8888",
+		 .tst_fn = blit_white_G4_to_xRGB8888},
+		{.name = "Blit black G4 to RGBA8888",
+		 .tst_fn = blit_black_G4_to_RGBA8888},
+		{.name = "Blit white G4 to RGBA8888",
+		 .tst_fn = blit_white_G4_to_RGBA8888},
+		{.name = "Blit black G4 to RGB888",
+		 .tst_fn = blit_black_G4_to_RGB888},
+		{.name = "Blit white G4 to RGB888",
+		 .tst_fn = blit_white_G4_to_RGB888},
+		{.name = "Blit black G4 to BGR888",
+		 .tst_fn = blit_black_G4_to_BGR888},
+		{.name = "Blit white G4 to BGR888",
+		 .tst_fn = blit_white_G4_to_BGR888},
+		{.name = "Blit black G4 to RGB555",
+		 .tst_fn = blit_black_G4_to_RGB555},
+		{.name = "Blit white G4 to RGB555",
+		 .tst_fn = blit_white_G4_to_RGB555},
+		{.name = "Blit black G4 to RGB565",
+		 .tst_fn = blit_black_G4_to_RGB565},
+		{.name = "Blit white G4 to RGB565",
+		 .tst_fn = blit_white_G4_to_RGB565},
+		{.name = "Blit black G4 to RGB666",
+		 .tst_fn = blit_black_G4_to_RGB666},
+		{.name = "Blit white G4 to RGB666",
+		 .tst_fn = blit_white_G4_to_RGB666},
+		{.name = "Blit black G4 to RGB332",
+		 .tst_fn = blit_black_G4_to_RGB332},
+		{.name = "Blit white G4 to RGB332",
+		 .tst_fn = blit_white_G4_to_RGB332},
+		{.name = "Blit black G4 to CMYK8888",
+		 .tst_fn = blit_black_G4_to_CMYK8888},
+		{.name = "Blit white G4 to CMYK8888",
+		 .tst_fn = blit_white_G4_to_CMYK8888},
+		{.name = "Blit black G4 to G1",
+		 .tst_fn = blit_black_G4_to_G1},
+		{.name = "Blit white G4 to G1",
+		 .tst_fn = blit_white_G4_to_G1},
+		{.name = "Blit black G4 to G2",
+		 .tst_fn = blit_black_G4_to_G2},
+		{.name = "Blit white G4 to G2",
+		 .tst_fn = blit_white_G4_to_G2},
+		{.name = "Blit black G4 to G4",
+		 .tst_fn = blit_black_G4_to_G4},
+		{.name = "Blit white G4 to G4",
+		 .tst_fn = blit_white_G4_to_G4},
+		{.name = "Blit black G4 to G8",
+		 .tst_fn = blit_black_G4_to_G8},
+		{.name = "Blit white G4 to G8",
+		 .tst_fn = blit_white_G4_to_G8},
+		{.name = "Blit black G4 to GA88",
+		 .tst_fn = blit_black_G4_to_GA88},
+		{.name = "Blit white G4 to GA88",
+		 .tst_fn = blit_white_G4_to_GA88},
+		{.name = "Blit black G4 to G16",
+		 .tst_fn = blit_black_G4_to_G16},
+		{.name = "Blit white G4 to G16",
+		 .tst_fn = blit_white_G4_to_G16},
+		{.name = "Blit black G4 to RGBA8888_PM",
+		 .tst_fn = blit_black_G4_to_RGBA8888_PM},
+		{.name = "Blit white G4 to RGBA8888_PM",
+		 .tst_fn = blit_white_G4_to_RGBA8888_PM},
+		{.name = "Blit black G4 to RGB161616",
+		 .tst_fn = blit_black_G4_to_RGB161616},
+		{.name = "Blit white G4 to RGB161616",
+		 .tst_fn = blit_white_G4_to_RGB161616},
+		{.name = "Blit black G4 to RGBA16161616",
+		 .tst_fn = blit_black_G4_to_RGBA16161616},
+		{.name = "Blit white G4 to RGBA16161616",
+		 .tst_fn = blit_white_G4_to_RGBA16161616},
+		{.name = "Blit black G8 to xRGB8888",
+		 .tst_fn = blit_black_G8_to_xRGB8888},
+		{.name = "Blit white G8 to xRGB8888",
+		 .tst_fn = blit_white_G8_to_xRGB8888},
+		{.name = "Blit black G8 to RGBA8888",
+		 .tst_fn = blit_black_G8_to_RGBA8888},
+		{.name = "Blit white G8 to RGBA8888",
+		 .tst_fn = blit_white_G8_to_RGBA8888},
+		{.name = "Blit black G8 to RGB888",
+		 .tst_fn = blit_black_G8_to_RGB888},
+		{.name = "Blit white G8 to RGB888",
+		 .tst_fn = blit_white_G8_to_RGB888},
+		{.name = "Blit black G8 to BGR888",
+		 .tst_fn = blit_black_G8_to_BGR888},
+		{.name = "Blit white G8 to BGR888",
+		 .tst_fn = blit_white_G8_to_BGR888},
+		{.name = "Blit black G8 to RGB555",
+		 .tst_fn = blit_black_G8_to_RGB555},
+		{.name = "Blit white G8 to RGB555",
+		 .tst_fn = blit_white_G8_to_RGB555},
+		{.name = "Blit black G8 to RGB565",
+		 .tst_fn = blit_black_G8_to_RGB565},
+		{.name = "Blit white G8 to RGB565",
+		 .tst_fn = blit_white_G8_to_RGB565},
+		{.name = "Blit black G8 to RGB666",
+		 .tst_fn = blit_black_G8_to_RGB666},
+		{.name = "Blit white G8 to RGB666",
+		 .tst_fn = blit_white_G8_to_RGB666},
+		{.name = "Blit black G8 to RGB332",
+		 .tst_fn = blit_black_G8_to_RGB332},
+		{.name = "Blit white G8 to RGB332",
+		 .tst_fn = blit_white_G8_to_RGB332},
+		{.name = "Blit black G8 to CMYK8888",
+		 .tst_fn = blit_black_G8_to_CMYK8888},
+		{.name = "Blit white G8 to CMYK8888",
+		 .tst_fn = blit_white_G8_to_CMYK8888},
+		{.name = "Blit black G8 to G1",
+		 .tst_fn = blit_black_G8_to_G1},
+		{.name = "Blit white G8 to G1",
+		 .tst_fn = blit_white_G8_to_G1},
+		{.name = "Blit black G8 to G2",
+		 .tst_fn = blit_black_G8_to_G2},
+		{.name = "Blit white G8 to G2",
+		 .tst_fn = blit_white_G8_to_G2},
+		{.name = "Blit black G8 to G4",
+		 .tst_fn = blit_black_G8_to_G4},
+		{.name = "Blit white G8 to G4",
+		 .tst_fn = blit_white_G8_to_G4},
+		{.name = "Blit black G8 to G8",
+		 .tst_fn = blit_black_G8_to_G8},
+		{.name = "Blit white G8 to G8",
+		 .tst_fn = blit_white_G8_to_G8},
+		{.name = "Blit black G8 to GA88",
+		 .tst_fn = blit_black_G8_to_GA88},
+		{.name = "Blit white G8 to GA88",
+		 .tst_fn = blit_white_G8_to_GA88},
+		{.name = "Blit black G8 to G16",
+		 .tst_fn = blit_black_G8_to_G16},
+		{.name = "Blit white G8 to G16",
+		 .tst_fn = blit_white_G8_to_G16},
+		{.name = "Blit black G8 to RGBA8888_PM",
+		 .tst_fn = blit_black_G8_to_RGBA8888_PM},
+		{.name = "Blit white G8 to RGBA8888_PM",
+		 .tst_fn = blit_white_G8_to_RGBA8888_PM},
+		{.name = "Blit black G8 to RGB161616",
+		 .tst_fn = blit_black_G8_to_RGB161616},
+		{.name = "Blit white G8 to RGB161616",
+		 .tst_fn = blit_white_G8_to_RGB161616},
+		{.name = "Blit black G8 to RGBA16161616",
+		 .tst_fn = blit_black_G8_to_RGBA16161616},
+		{.name = "Blit white G8 to RGBA16161616",
+		 .tst_fn = blit_white_G8_to_RGBA16161616},
+		{.name = "Blit black GA88 to xRGB8888",
+		 .tst_fn = blit_black_GA88_to_xRGB8888},
+		{.name = "Blit white GA88 to xRGB8888",
+		 .tst_fn = blit_white_GA88_to_xRGB8888},
+		{.name = "Blit black GA88 to RGBA8888",
+		 .tst_fn = blit_black_GA88_to_RGBA8888},
+		{.name = "Blit white GA88 to RGBA8888",
+		 .tst_fn = blit_white_GA88_to_RGBA8888},
+		{.name = "Blit black GA88 to RGB888",
+		 .tst_fn = blit_black_GA88_to_RGB888},
+		{.name = "Blit white GA88 to RGB888",
+		 .tst_fn = blit_white_GA88_to_RGB888},
+		{.name = "Blit black GA88 to BGR888",
+		 .tst_fn = blit_black_GA88_to_BGR888},
+		{.name = "Blit white GA88 to BGR888",
+		 .tst_fn = blit_white_GA88_to_BGR888},
+		{.name = "Blit black GA88 to RGB555",
+		 .tst_fn = blit_black_GA88_to_RGB555},
+		{.name = "Blit white GA88 to RGB555",
+		 .tst_fn = blit_white_GA88_to_RGB555},
+		{.name = "Blit black GA88 to RGB565",
+		 .tst_fn = blit_black_GA88_to_RGB565},
+		{.name = "Blit white GA88 to RGB565",
+		 .tst_fn = blit_white_GA88_to_RGB565},
+		{.name = "Blit black GA88 to RGB666",
+		 .tst_fn = blit_black_GA88_to_RGB666},
+		{.name = "Blit white GA88 to RGB666",
+		 .tst_fn = blit_white_GA88_to_RGB666},
+		{.name = "Blit black GA88 to RGB332",
+		 .tst_fn = blit_black_GA88_to_RGB332},
+		{.name = "Blit white GA88 to RGB332",
+		 .tst_fn = blit_white_GA88_to_RGB332},
+		{.name = "Blit black GA88 to CMYK8888",
+		 .tst_fn = blit_black_GA88_to_CMYK8888},
+		{.name = "Blit white GA88 to CMYK8888",
+		 .tst_fn = blit_white_GA88_to_CMYK8888},
+		{.name = "Blit black GA88 to G1",
+		 .tst_fn = blit_black_GA88_to_G1},
+		{.name = "Blit white GA88 to G1",
+		 .tst_fn = blit_white_GA88_to_G1},
+		{.name = "Blit black GA88 to G2",
+		 .tst_fn = blit_black_GA88_to_G2},
+		{.name = "Blit white GA88 to G2",
+		 .tst_fn = blit_white_GA88_to_G2},
+		{.name = "Blit black GA88 to G4",
+		 .tst_fn = blit_black_GA88_to_G4},
+		{.name = "Blit white GA88 to G4",
+		 .tst_fn = blit_white_GA88_to_G4},
+		{.name = "Blit black GA88 to G8",
+		 .tst_fn = blit_black_GA88_to_G8},
+		{.name = "Blit white GA88 to G8",
+		 .tst_fn = blit_white_GA88_to_G8},
+		{.name = "Blit black GA88 to GA88",
+		 .tst_fn = blit_black_GA88_to_GA88},
+		{.name = "Blit white GA88 to GA88",
+		 .tst_fn = blit_white_GA88_to_GA88},
+		{.name = "Blit black GA88 to G16",
+		 .tst_fn = blit_black_GA88_to_G16},
+		{.name = "Blit white GA88 to G16",
+		 .tst_fn = blit_white_GA88_to_G16},
+		{.name = "Blit black GA88 to RGBA8888_PM",
+		 .tst_fn = blit_black_GA88_to_RGBA8888_PM},
+		{.name = "Blit white GA88 to RGBA8888_PM",
+		 .tst_fn = blit_white_GA88_to_RGBA8888_PM},
+		{.name = "Blit black GA88 to RGB161616",
+		 .tst_fn = blit_black_GA88_to_RGB161616},
+		{.name = "Blit white GA88 to RGB161616",
+		 .tst_fn = blit_white_GA88_to_RGB161616},
+		{.name = "Blit black GA88 to RGBA16161616",
+		 .tst_fn = blit_black_GA88_to_RGBA16161616},
+		{.name = "Blit white GA88 to RGBA16161616",
+		 .tst_fn = blit_white_GA88_to_RGBA16161616},
+		{.name = "Blit black G16 to xRGB8888",
+		 .tst_fn = blit_black_G16_to_xRGB8888},
+		{.name = "Blit white G16 to xRGB8888",
+		 .tst_fn = blit_white_G16_to_xRGB8888},
+		{.name = "Blit black G16 to RGBA8888",
+		 .tst_fn = blit_black_G16_to_RGBA8888},
+		{.name = "Blit white G16 to RGBA8888",
+		 .tst_fn = blit_white_G16_to_RGBA8888},
+		{.name = "Blit black G16 to RGB888",
+		 .tst_fn = blit_black_G16_to_RGB888},
+		{.name = "Blit white G16 to RGB888",
+		 .tst_fn = blit_white_G16_to_RGB888},
+		{.name = "Blit black G16 to BGR888",
+		 .tst_fn = blit_black_G16_to_BGR888},
+		{.name = "Blit white G16 to BGR888",
+		 .tst_fn = blit_white_G16_to_BGR888},
+		{.name = "Blit black G16 to RGB555",
+		 .tst_fn = blit_black_G16_to_RGB555},
+		{.name = "Blit white G16 to RGB555",
+		 .tst_fn = blit_white_G16_to_RGB555},
+		{.name = "Blit black G16 to RGB565",
+		 .tst_fn = blit_black_G16_to_RGB565},
+		{.name = "Blit white G16 to RGB565",
+		 .tst_fn = blit_white_G16_to_RGB565},
+		{.name = "Blit black G16 to RGB666",
+		 .tst_fn = blit_black_G16_to_RGB666},
+		{.name = "Blit white G16 to RGB666",
+		 .tst_fn = blit_white_G16_to_RGB666},
+		{.name = "Blit black G16 to RGB332",
+		 .tst_fn = blit_black_G16_to_RGB332},
+		{.name = "Blit white G16 to RGB332",
+		 .tst_fn = blit_white_G16_to_RGB332},
+		{.name = "Blit black G16 to CMYK8888",
+		 .tst_fn = blit_black_G16_to_CMYK8888},
+		{.name = "Blit white G16 to CMYK8888",
+		 .tst_fn = blit_white_G16_to_CMYK8888},
+		{.name = "Blit black G16 to G1",
+		 .tst_fn = blit_black_G16_to_G1},
+		{.name = "Blit white G16 to G1",
+		 .tst_fn = blit_white_G16_to_G1},
+		{.name = "Blit black G16 to G2",
+		 .tst_fn = blit_black_G16_to_G2},
+		{.name = "Blit white G16 to G2",
+		 .tst_fn = blit_white_G16_to_G2},
+		{.name = "Blit black G16 to G4",
+		 .tst_fn = blit_black_G16_to_G4},
+		{.name = "Blit white G16 to G4",
+		 .tst_fn = blit_white_G16_to_G4},
+		{.name = "Blit black G16 to G8",
+		 .tst_fn = blit_black_G16_to_G8},
+		{.name = "Blit white G16 to G8",
+		 .tst_fn = blit_white_G16_to_G8},
+		{.name = "Blit black G16 to GA88",
+		 .tst_fn = blit_black_G16_to_GA88},
+		{.name = "Blit white G16 to GA88",
+		 .tst_fn = blit_white_G16_to_GA88},
+		{.name = "Blit black G16 to G16",
+		 .tst_fn = blit_black_G16_to_G16},
+		{.name = "Blit white G16 to G16",
+		 .tst_fn = blit_white_G16_to_G16},
+		{.name = "Blit black G16 to RGBA8888_PM",
+		 .tst_fn = blit_black_G16_to_RGBA8888_PM},
+		{.name = "Blit white G16 to RGBA8888_PM",
+		 .tst_fn = blit_white_G16_to_RGBA8888_PM},
+		{.name = "Blit black G16 to RGB161616",
+		 .tst_fn = blit_black_G16_to_RGB161616},
+		{.name = "Blit white G16 to RGB161616",
+		 .tst_fn = blit_white_G16_to_RGB161616},
+		{.name = "Blit black G16 to RGBA16161616",
+		 .tst_fn = blit_black_G16_to_RGBA16161616},
+		{.name = "Blit white G16 to RGBA16161616",
+		 .tst_fn = blit_white_G16_to_RGBA16161616},
+		{.name = "Blit black RGBA8888_PM to xRGB8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_xRGB8888},
+		{.name = "Blit white RGBA8888_PM to xRGB8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_xRGB8888},
+		{.name = "Blit black RGBA8888_PM to RGBA8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGBA8888},
+		{.name = "Blit white RGBA8888_PM to RGBA8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGBA8888},
+		{.name = "Blit black RGBA8888_PM to RGB888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB888},
+		{.name = "Blit white RGBA8888_PM to RGB888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB888},
+		{.name = "Blit black RGBA8888_PM to BGR888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_BGR888},
+		{.name = "Blit white RGBA8888_PM to BGR888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_BGR888},
+		{.name = "Blit black RGBA8888_PM to RGB555",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB555},
+		{.name = "Blit white RGBA8888_PM to RGB555",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB555},
+		{.name = "Blit black RGBA8888_PM to RGB565",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB565},
+		{.name = "Blit white RGBA8888_PM to RGB565",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB565},
+		{.name = "Blit black RGBA8888_PM to RGB666",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB666},
+		{.name = "Blit white RGBA8888_PM to RGB666",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB666},
+		{.name = "Blit black RGBA8888_PM to RGB332",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB332},
+		{.name = "Blit white RGBA8888_PM to RGB332",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB332},
+		{.name = "Blit black RGBA8888_PM to CMYK8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_CMYK8888},
+		{.name = "Blit white RGBA8888_PM to CMYK8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_CMYK8888},
+		{.name = "Blit black RGBA8888_PM to G1",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G1},
+		{.name = "Blit white RGBA8888_PM to G1",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G1},
+		{.name = "Blit black RGBA8888_PM to G2",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G2},
+		{.name = "Blit white RGBA8888_PM to G2",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G2},
+		{.name = "Blit black RGBA8888_PM to G4",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G4},
+		{.name = "Blit white RGBA8888_PM to G4",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G4},
+		{.name = "Blit black RGBA8888_PM to G8",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G8},
+		{.name = "Blit white RGBA8888_PM to G8",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G8},
+		{.name = "Blit black RGBA8888_PM to GA88",
+		 .tst_fn = blit_black_RGBA8888_PM_to_GA88},
+		{.name = "Blit white RGBA8888_PM to GA88",
+		 .tst_fn = blit_white_RGBA8888_PM_to_GA88},
+		{.name = "Blit black RGBA8888_PM to G16",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G16},
+		{.name = "Blit white RGBA8888_PM to G16",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G16},
+		{.name = "Blit black RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGBA8888_PM},
+		{.name = "Blit white RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGBA8888_PM},
+		{.name = "Blit black RGBA8888_PM to RGB161616",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB161616},
+		{.name = "Blit white RGBA8888_PM to RGB161616",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB161616},
+		{.name = "Blit black RGBA8888_PM to RGBA16161616",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGBA16161616},
+		{.name = "Blit white RGBA8888_PM to RGBA16161616",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGBA16161616},
+		{.name = "Blit black RGB161616 to xRGB8888",
+		 .tst_fn = blit_black_RGB161616_to_xRGB8888},
+		{.name = "Blit white RGB161616 to xRGB8888",
+		 .tst_fn = blit_white_RGB161616_to_xRGB8888},
+		{.name = "Blit black RGB161616 to RGBA8888",
+		 .tst_fn = blit_black_RGB161616_to_RGBA8888},
+		{.name = "Blit white RGB161616 to RGBA8888",
+		 .tst_fn = blit_white_RGB161616_to_RGBA8888},
+		{.name = "Blit black RGB161616 to RGB888",
+		 .tst_fn = blit_black_RGB161616_to_RGB888},
+		{.name = "Blit white RGB161616 to RGB888",
+		 .tst_fn = blit_white_RGB161616_to_RGB888},
+		{.name = "Blit black RGB161616 to BGR888",
+		 .tst_fn = blit_black_RGB161616_to_BGR888},
+		{.name = "Blit white RGB161616 to BGR888",
+		 .tst_fn = blit_white_RGB161616_to_BGR888},
+		{.name = "Blit black RGB161616 to RGB555",
+		 .tst_fn = blit_black_RGB161616_to_RGB555},
+		{.name = "Blit white RGB161616 to RGB555",
+		 .tst_fn = blit_white_RGB161616_to_RGB555},
+		{.name = "Blit black RGB161616 to RGB565",
+		 .tst_fn = blit_black_RGB161616_to_RGB565},
+		{.name = "Blit white RGB161616 to RGB565",
+		 .tst_fn = blit_white_RGB161616_to_RGB565},
+		{.name = "Blit black RGB161616 to RGB666",
+		 .tst_fn = blit_black_RGB161616_to_RGB666},
+		{.name = "Blit white RGB161616 to RGB666",
+		 .tst_fn = blit_white_RGB161616_to_RGB666},
+		{.name = "Blit black RGB161616 to RGB332",
+		 .tst_fn = blit_black_RGB161616_to_RGB332},
+		{.name = "Blit white RGB161616 to RGB332",
+		 .tst_fn = blit_white_RGB161616_to_RGB332},
+		{.name = "Blit black RGB161616 to CMYK8888",
+		 .tst_fn = blit_black_RGB161616_to_CMYK8888},
+		{.name = "Blit white RGB161616 to CMYK8888",
+		 .tst_fn = blit_white_RGB161616_to_CMYK8888},
+		{.name = "Blit black RGB161616 to G1",
+		 .tst_fn = blit_black_RGB161616_to_G1},
+		{.name = "Blit white RGB161616 to G1",
+		 .tst_fn = blit_white_RGB161616_to_G1},
+		{.name = "Blit black RGB161616 to G2",
+		 .tst_fn = blit_black_RGB161616_to_G2},
+		{.name = "Blit white RGB161616 to G2",
+		 .tst_fn = blit_white_RGB161616_to_G2},
+		{.name = "Blit black RGB161616 to G4",
+		 .tst_fn = blit_black_RGB161616_to_G4},
+		{.name = "Blit white RGB161616 to G4",
+		 .tst_fn = blit_white_RGB161616_to_G4},
+		{.name = "Blit black RGB161616 to G8",
+		 .tst_fn = blit_black_RGB161616_to_G8},
+		{.name = "Blit white RGB161616 to G8",
+		 .tst_fn = blit_white_RGB161616_to_G8},
+		{.name = "Blit black RGB161616 to GA88",
+		 .tst_fn = blit_black_RGB161616_to_GA88},
+		{.name = "Blit white RGB161616 to GA88",
+		 .tst_fn = blit_white_RGB161616_to_GA88},
+		{.name = "Blit black RGB161616 to G16",
+		 .tst_fn = blit_black_RGB161616_to_G16},
+		{.name = "Blit white RGB161616 to G16",
+		 .tst_fn = blit_white_RGB161616_to_G16},
+		{.name = "Blit black RGB161616 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB161616_to_RGBA8888_PM},
+		{.name = "Blit white RGB161616 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB161616_to_RGBA8888_PM},
+		{.name = "Blit black RGB161616 to RGB161616",
+		 .tst_fn = blit_black_RGB161616_to_RGB161616},
+		{.name = "Blit white RGB161616 to RGB161616",
+		 .tst_fn = blit_white_RGB161616_to_RGB161616},
+		{.name = "Blit black RGB161616 to RGBA16161616",
+		 .tst_fn = blit_black_RGB161616_to_RGBA16161616},
+		{.name = "Blit white RGB161616 to RGBA16161616",
+		 .tst_fn = blit_white_RGB161616_to_RGBA16161616},
+		{.name = "Blit black RGBA16161616 to xRGB8888",
+		 .tst_fn = blit_black_RGBA16161616_to_xRGB8888},
+		{.name = "Blit white RGBA16161616 to xRGB8888",
+		 .tst_fn = blit_white_RGBA16161616_to_xRGB8888},
+		{.name = "Blit black RGBA16161616 to RGBA8888",
+		 .tst_fn = blit_black_RGBA16161616_to_RGBA8888},
+		{.name = "Blit white RGBA16161616 to RGBA8888",
+		 .tst_fn = blit_white_RGBA16161616_to_RGBA8888},
+		{.name = "Blit black RGBA16161616 to RGB888",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB888},
+		{.name = "Blit white RGBA16161616 to RGB888",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB888},
+		{.name = "Blit black RGBA16161616 to BGR888",
+		 .tst_fn = blit_black_RGBA16161616_to_BGR888},
+		{.name = "Blit white RGBA16161616 to BGR888",
+		 .tst_fn = blit_white_RGBA16161616_to_BGR888},
+		{.name = "Blit black RGBA16161616 to RGB555",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB555},
+		{.name = "Blit white RGBA16161616 to RGB555",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB555},
+		{.name = "Blit black RGBA16161616 to RGB565",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB565},
+		{.name = "Blit white RGBA16161616 to RGB565",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB565},
+		{.name = "Blit black RGBA16161616 to RGB666",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB666},
+		{.name = "Blit white RGBA16161616 to RGB666",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB666},
+		{.name = "Blit black RGBA16161616 to RGB332",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB332},
+		{.name = "Blit white RGBA16161616 to RGB332",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB332},
+		{.name = "Blit black RGBA16161616 to CMYK8888",
+		 .tst_fn = blit_black_RGBA16161616_to_CMYK8888},
+		{.name = "Blit white RGBA16161616 to CMYK8888",
+		 .tst_fn = blit_white_RGBA16161616_to_CMYK8888},
+		{.name = "Blit black RGBA16161616 to G1",
+		 .tst_fn = blit_black_RGBA16161616_to_G1},
+		{.name = "Blit white RGBA16161616 to G1",
+		 .tst_fn = blit_white_RGBA16161616_to_G1},
+		{.name = "Blit black RGBA16161616 to G2",
+		 .tst_fn = blit_black_RGBA16161616_to_G2},
+		{.name = "Blit white RGBA16161616 to G2",
+		 .tst_fn = blit_white_RGBA16161616_to_G2},
+		{.name = "Blit black RGBA16161616 to G4",
+		 .tst_fn = blit_black_RGBA16161616_to_G4},
+		{.name = "Blit white RGBA16161616 to G4",
+		 .tst_fn = blit_white_RGBA16161616_to_G4},
+		{.name = "Blit black RGBA16161616 to G8",
+		 .tst_fn = blit_black_RGBA16161616_to_G8},
+		{.name = "Blit white RGBA16161616 to G8",
+		 .tst_fn = blit_white_RGBA16161616_to_G8},
+		{.name = "Blit black RGBA16161616 to GA88",
+		 .tst_fn = blit_black_RGBA16161616_to_GA88},
+		{.name = "Blit white RGBA16161616 to GA88",
+		 .tst_fn = blit_white_RGBA16161616_to_GA88},
+		{.name = "Blit black RGBA16161616 to G16",
+		 .tst_fn = blit_black_RGBA16161616_to_G16},
+		{.name = "Blit white RGBA16161616 to G16",
+		 .tst_fn = blit_white_RGBA16161616_to_G16},
+		{.name = "Blit black RGBA16161616 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGBA16161616_to_RGBA8888_PM},
+		{.name = "Blit white RGBA16161616 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGBA16161616_to_RGBA8888_PM},
+		{.name = "Blit black RGBA16161616 to RGB161616",
+		 .tst_fn = blit_black_RGBA16161616_to_RGB161616},
+		{.name = "Blit white RGBA16161616 to RGB161616",
+		 .tst_fn = blit_white_RGBA16161616_to_RGB161616},
+		{.name = "Blit black RGBA16161616 to RGBA16161616",
+		 .tst_fn = blit_black_RGBA16161616_to_RGBA16161616},
+		{.name = "Blit white RGBA16161616 to RGBA16161616",
+		 .tst_fn = blit_white_RGBA16161616_to_RGBA16161616},
+		{.name = "Blit xRGB8888 to xRGB8888",
+		 .tst_fn = blit_equal_pixel_xRGB8888_to_xRGB8888},
+		{.name = "Blit RGBA8888 to RGBA8888",
+		 .tst_fn = blit_equal_pixel_RGBA8888_to_RGBA8888},
+		{.name = "Blit RGB888 to RGB888",
+		 .tst_fn = blit_equal_pixel_RGB888_to_RGB888},
+		{.name = "Blit BGR888 to BGR888",
+		 .tst_fn = blit_equal_pixel_BGR888_to_BGR888},
+		{.name = "Blit RGB555 to RGB555",
+		 .tst_fn = blit_equal_pixel_RGB555_to_RGB555},
+		{.name = "Blit RGB565 to RGB565",
+		 .tst_fn = blit_equal_pixel_RGB565_to_RGB565},
+		{.name = "Blit RGB666 to RGB666",
+		 .tst_fn = blit_equal_pixel_RGB666_to_RGB666},
+		{.name = "Blit RGB332 to RGB332",
+		 .tst_fn = blit_equal_pixel_RGB332_to_RGB332},
+		{.name = "Blit CMYK8888 to CMYK8888",
+		 .tst_fn = blit_equal_pixel_CMYK8888_to_CMYK8888},
+		{.name = "Blit G1 to G1",
+		 .tst_fn = blit_equal_pixel_G1_to_G1},
+		{.name = "Blit G2 to G2",
+		 .tst_fn = blit_equal_pixel_G2_to_G2},
+		{.name = "Blit G4 to G4",
+		 .tst_fn = blit_equal_pixel_G4_to_G4},
+		{.name = "Blit G8 to G8",
+		 .tst_fn = blit_equal_pixel_G8_to_G8},
+		{.name = "Blit GA88 to GA88",
+		 .tst_fn = blit_equal_pixel_GA88_to_GA88},
+		{.name = "Blit G16 to G16",
+		 .tst_fn = blit_equal_pixel_G16_to_G16},
+		{.name = "Blit RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_equal_pixel_RGBA8888_PM_to_RGBA8888_PM},
+		{.name = "Blit RGB161616 to RGB161616",
+		 .tst_fn = blit_equal_pixel_RGB161616_to_RGB161616},
+		{.name = "Blit RGBA16161616 to RGBA16161616",
+		 .tst_fn = blit_equal_pixel_RGBA16161616_to_RGBA16161616},
+
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_red_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_green_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_blue_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_gray_RGB888_to_CMYK8888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_red_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_green_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_blue_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_gray_CMYK8888_to_RGB888},
+
+		{.name = "Blit convert rows",
+		 .tst_fn = blit_convert_rows,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Blit blend rows",
+		 .tst_fn = blit_blend_rows},
+		{.name = "Blit tiles",
+		 .tst_fn = blit_tiles},
+		{.name = "Blit blend premultiplied",
+		 .tst_fn = blit_blend_premultiplied,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL}
+	}
+};
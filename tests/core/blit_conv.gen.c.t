@@ -5,12 +5,15 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include <core/gp_pixmap.h>
 #include <core/gp_convert.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_blit.h>
+#include <core/gp_threads.h>
+#include <core/gp_mix_pixels2.gen.h>
 
 #include "tst_test.h"
 
@@ -45,7 +48,7 @@ static int check_filled(gp_pixmap *c, gp_pixel p)
 		for (y = 0; y < (gp_coord)c->h; y++) {
 			pc = gp_getpixel(c, x, y);
 			if (p != pc) {
-				tst_msg("Pixels different %08x %08x", p, pc);
+				tst_msg("Pixels different %08"PRIx64" %08"PRIx64, p, pc);
 				return 1;
 			}
 		}
@@ -79,7 +82,7 @@ static int blit_{{ name }}_{{ pt1.name }}_to_{{ pt2.name }}(void)
 	gp_pixel pix_src = rgb_to_pixel({{ r }}, {{ g }}, {{ b }}, src);
 	gp_pixel pix_dst = rgb_to_pixel({{ r }}, {{ g }}, {{ b }}, dst);
 
-        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+        tst_msg("pixel_src=%08"PRIx64" pixel_dst=%08"PRIx64, pix_src, pix_dst);
 
 	fill_pixmap(src, pix_src);
 	mess_pixmap(dst);
@@ -124,6 +127,300 @@ static int blit_{{ name }}_{{ pt1.name }}_to_{{ pt2.name }}(void)
 {@ gen_blit2('blue', '0x00', '0x00', '0xff', 'CMYK8888', 'RGB888') @}
 {@ gen_blit2('gray', '0xef', '0xef', '0xef', 'CMYK8888', 'RGB888') @}
 
+/*
+ * Checks the vectorized whole row converters against per pixel conversion on
+ * a subrectangle with odd width so that loop tails are exercised as well.
+ */
+static int blit_convert_rows(void)
+{
+	gp_pixel_type src_type, dst_type;
+	unsigned int cnt = 0;
+	gp_coord x, y;
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (!gp_convert_row_get(src_type, dst_type))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(67, 11, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(67, 11, dst_type);
+
+			if (src == NULL || dst == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				tst_msg("Malloc failed :(");
+				return TST_UNTESTED;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+
+			gp_blit_xywh(src, 1, 1, 63, 9, dst, 2, 1);
+
+			for (y = 0; y < 9; y++) {
+				for (x = 0; x < 63; x++) {
+					gp_pixel ps = gp_getpixel(src, x + 1, y + 1);
+					gp_pixel pd = gp_getpixel(dst, x + 2, y + 1);
+					gp_pixel exp = gp_convert_pixel(ps, src_type, dst_type);
+
+					if (pd != exp) {
+						tst_msg("%s -> %s %08"PRIx64" -> %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        ps, pd, exp);
+						gp_pixmap_free(src);
+						gp_pixmap_free(dst);
+						return TST_FAILED;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			cnt++;
+		}
+	}
+
+	tst_msg("Checked %u row converters", cnt);
+
+	return TST_SUCCESS;
+}
+
+static gp_pixel mix_pixels(gp_pixel_type src_type, gp_pixel_type dst_type,
+                           gp_pixel src, gp_pixel dst)
+{
+	switch (src_type) {
+@ for src in pixeltypes:
+@     if src.is_alpha() and not src.is_palette():
+	case GP_PIXEL_{{ src.name }}:
+		switch (dst_type) {
+@         for dst in pixeltypes:
+@             if not dst.is_unknown() and not dst.is_palette():
+		case GP_PIXEL_{{ dst.name }}:
+			return gp_mix_pixels_{{ src.name }}_{{ dst.name }}(src, dst);
+@         end
+		default:
+		break;
+		}
+	break;
+@ end
+	default:
+	break;
+	}
+
+	return 0;
+}
+
+/*
+ * Checks the vectorized row compositors against per pixel mixing, the area
+ * is big enough to be split between threads.
+ */
+static int blit_blend_rows(void)
+{
+	gp_pixel_type src_type, dst_type;
+	unsigned int cnt = 0;
+	gp_coord x, y;
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (!gp_blend_row_get(src_type, dst_type))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(303, 233, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(303, 233, dst_type);
+			gp_pixmap *orig = gp_pixmap_alloc(303, 233, dst_type);
+
+			if (src == NULL || dst == NULL || orig == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				gp_pixmap_free(orig);
+				tst_msg("Malloc failed :(");
+				return TST_UNTESTED;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+			mess_pixmap(orig);
+
+			gp_blit_xywh(src, 1, 2, 299, 230, dst, 3, 1);
+
+			for (y = 0; y < 230; y++) {
+				for (x = 0; x < 299; x++) {
+					gp_pixel ps = gp_getpixel(src, x + 1, y + 2);
+					gp_pixel pd = gp_getpixel(dst, x + 3, y + 1);
+					gp_pixel po = gp_getpixel(orig, x + 3, y + 1);
+					gp_pixel exp = mix_pixels(src_type, dst_type, ps, po);
+
+					if (pd != exp) {
+						tst_msg("%s -> %s %08"PRIx64" onto %08"PRIx64" = %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        ps, po, pd, exp);
+						gp_pixmap_free(src);
+						gp_pixmap_free(dst);
+						gp_pixmap_free(orig);
+						return TST_FAILED;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			gp_pixmap_free(orig);
+			cnt++;
+		}
+	}
+
+	tst_msg("Checked %u row compositors", cnt);
+
+	return TST_SUCCESS;
+}
+
+/*
+ * Checks that blending premultiplied pixmap gives the same result, up to
+ * rounding, as blending the original pixmap with straight alpha.
+ */
+static int blit_blend_premultiplied(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(256, 256, GP_PIXEL_RGBA8888);
+	gp_pixmap *pm = gp_pixmap_alloc(256, 256, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(256, 256, GP_PIXEL_RGB888);
+	gp_pixmap *dst_pm = gp_pixmap_alloc(256, 256, GP_PIXEL_RGB888);
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+	int i;
+
+	if (!src || !pm || !dst || !dst_pm) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	/* All combinations of color and alpha values */
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++)
+			gp_putpixel_raw(src, x, y, GP_PIXEL_CREATE_RGBA8888(x, 255 - x, x ^ y, y));
+	}
+
+	mess_pixmap(dst);
+	gp_blit_xywh(dst, 0, 0, 256, 256, dst_pm, 0, 0);
+
+	gp_blit_xywh(src, 0, 0, 256, 256, pm, 0, 0);
+
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++) {
+			gp_pixel ps = gp_getpixel_raw(src, x, y);
+			gp_pixel pp = gp_getpixel_raw(pm, x, y);
+
+			if (pp != gp_convert_pixel(ps, GP_PIXEL_RGBA8888, GP_PIXEL_RGBA8888_PM)) {
+				tst_msg("Premultiply %08"PRIx64" -> %08"PRIx64, ps, pp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+	gp_blit_xywh(src, 0, 0, 256, 256, dst, 0, 0);
+	gp_blit_xywh(pm, 0, 0, 256, 256, dst_pm, 0, 0);
+
+	for (y = 0; y < 256; y++) {
+		for (x = 0; x < 256; x++) {
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+			gp_pixel p_pm = gp_getpixel_raw(dst_pm, x, y);
+
+			for (i = 0; i < 24; i += 8) {
+				int diff = (int)((p >> i) & 0xff) - (int)((p_pm >> i) & 0xff);
+
+				if (diff < -1 || diff > 1) {
+					tst_msg("Pixel %ix%i %06"PRIx64", premultiplied %06"PRIx64,
+					        x, y, p, p_pm);
+					ret = TST_FAILED;
+					goto exit;
+				}
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(pm);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(dst_pm);
+	return ret;
+}
+
+/*
+ * Checks that blits split into tiles and processed in parallel give the same
+ * result as blits of single rows for all pixel type pairs.
+ */
+static int blit_tiles(void)
+{
+	gp_pixel_type src_type, dst_type;
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+
+	gp_nr_threads_set(4);
+
+	for (src_type = 1; src_type < GP_PIXEL_MAX; src_type++) {
+		if (gp_pixel_has_flags(src_type, GP_PIXEL_IS_PALETTE))
+			continue;
+
+		for (dst_type = 1; dst_type < GP_PIXEL_MAX; dst_type++) {
+			if (gp_pixel_has_flags(dst_type, GP_PIXEL_IS_PALETTE))
+				continue;
+
+			gp_pixmap *src = gp_pixmap_alloc(303, 233, src_type);
+			gp_pixmap *dst = gp_pixmap_alloc(303, 233, dst_type);
+			gp_pixmap *ref = gp_pixmap_alloc(303, 233, dst_type);
+
+			if (src == NULL || dst == NULL || ref == NULL) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				gp_pixmap_free(ref);
+				tst_msg("Malloc failed :(");
+				ret = TST_UNTESTED;
+				goto exit;
+			}
+
+			mess_pixmap(src);
+			mess_pixmap(dst);
+			mess_pixmap(ref);
+
+			gp_blit_xywh(src, 1, 2, 299, 230, dst, 3, 1);
+
+			for (y = 0; y < 230; y++)
+				gp_blit_xywh(src, 1, y + 2, 299, 1, ref, 3, y + 1);
+
+			for (y = 0; y < (gp_coord)dst->h; y++) {
+				for (x = 0; x < (gp_coord)dst->w; x++) {
+					gp_pixel pd = gp_getpixel(dst, x, y);
+					gp_pixel pr = gp_getpixel(ref, x, y);
+
+					if (pd != pr) {
+						tst_msg("%s -> %s %ix%i %08"PRIx64" expected %08"PRIx64,
+						        gp_pixel_type_name(src_type),
+						        gp_pixel_type_name(dst_type),
+						        x, y, pd, pr);
+						ret = TST_FAILED;
+						break;
+					}
+				}
+			}
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			gp_pixmap_free(ref);
+
+			if (ret)
+				goto exit;
+		}
+	}
+
+exit:
+	gp_nr_threads_set(0);
+	return ret;
+}
+
 @ def gen_suite_entry(name, p_from, p_to):
 		{.name = "Blit {{ p_from }} to {{ p_to }}",
 		 .tst_fn = blit_{{ name }}_{{ p_from }}_to_{{ p_to }}},
@@ -155,6 +452,17 @@ const struct tst_suite tst_suite = {
 {@ gen_suite_entry('blue', 'CMYK8888', 'RGB888') @}
 {@ gen_suite_entry('gray', 'CMYK8888', 'RGB888') @}
 
+		{.name = "Blit convert rows",
+		 .tst_fn = blit_convert_rows,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Blit blend rows",
+		 .tst_fn = blit_blend_rows},
+		{.name = "Blit tiles",
+		 .tst_fn = blit_tiles},
+		{.name = "Blit blend premultiplied",
+		 .tst_fn = blit_blend_premultiplied,
+		 .flags = TST_CHECK_MALLOC},
+
 		{.name = NULL}
 	}
 };
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Color keyed and masked blits compared against pixel by pixel reference. The
+  clipping is checked against gp_blit_xywh_clipped() by blitting pixmap with
+  source coordinates encoded in the pixel values.
+
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_blit.h>
+#include <core/gp_fill.h>
+
+#include "tst_test.h"
+#include "blit.h"
+
+struct blit_masked {
+	gp_pixel_type src_type;
+	gp_pixel_type dst_type;
+	/* Rotation flags for source, destination and mask */
+	int src_flags;
+	int dst_flags;
+	int mask_flags;
+	/* Mask bit endian */
+	int mask_be;
+};
+
+static const struct rect {
+	gp_coord x0, y0;
+	gp_size w0, h0;
+	gp_coord x1, y1;
+} rects[] = {
+	{0, 0, 300, 40, 0, 0},
+	{3, 5, 290, 30, 7, 9},
+	{1, 1, 17, 13, 2, 3},
+	/* Clipped */
+	{0, 0, 300, 40, -5, -7},
+	{10, 3, 300, 40, 200, 30},
+	{-3, -4, 20, 20, 5, 5},
+	{0, 0, 10, 10, 400, 0},
+	{0, 0, 10, 10, -20, 0},
+};
+
+#define SRC_W 300
+#define SRC_H 40
+#define DST_W 320
+#define DST_H 50
+
+/* The key and its neighbours are common in the source */
+#define KEY 0x1
+
+static void fill_random(gp_pixmap *pixmap, int keys)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)gp_pixmap_h(pixmap); y++) {
+		for (x = 0; x < (gp_coord)gp_pixmap_w(pixmap); x++) {
+			gp_pixel p = random();
+
+			if (keys && (random() % 3))
+				p = KEY + random() % 2;
+
+			gp_putpixel(pixmap, x, y, p & ((1ull<<pixmap->bpp) - 1));
+		}
+	}
+}
+
+/*
+ * Encodes source coordinates into pixels and blits them with the reference
+ * clipped blit.
+ */
+static gp_pixmap *clip_map(const struct rect *r)
+{
+	gp_pixmap *coords, *ret;
+	gp_coord x, y;
+
+	coords = gp_pixmap_alloc(SRC_W, SRC_H, GP_PIXEL_xRGB8888);
+	ret = gp_pixmap_alloc(DST_W, DST_H, GP_PIXEL_xRGB8888);
+
+	if (!coords || !ret) {
+		gp_pixmap_free(coords);
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	for (y = 0; y < SRC_H; y++) {
+		for (x = 0; x < SRC_W; x++)
+			gp_putpixel_raw(coords, x, y, ((y<<12) | x) + 1);
+	}
+
+	gp_fill(ret, 0);
+	gp_blit_xywh_clipped(coords, r->x0, r->y0, r->w0, r->h0, ret, r->x1, r->y1);
+	gp_pixmap_free(coords);
+
+	return ret;
+}
+
+static int check(const gp_pixmap *src, const gp_pixmap *dst,
+                 const gp_pixmap *orig, const gp_pixmap *mask,
+                 const gp_pixmap *map, const char *name)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < DST_H; y++) {
+		for (x = 0; x < DST_W; x++) {
+			gp_pixel c = gp_getpixel_raw(map, x, y);
+			gp_pixel e = gp_getpixel(orig, x, y);
+			gp_pixel p = gp_getpixel(dst, x, y);
+
+			if (c) {
+				gp_coord sx = (c - 1) & 0xfff;
+				gp_coord sy = (c - 1) >> 12;
+				gp_pixel s = gp_getpixel(src, sx, sy);
+
+				if (mask ? gp_getpixel(mask, sx, sy) : s != KEY) {
+					e = s;
+
+					if (src->pixel_type != dst->pixel_type) {
+						e = gp_convert_pixel(s, src->pixel_type,
+						                     dst->pixel_type);
+					}
+				}
+			}
+
+			if (e != p) {
+				tst_msg("%s %s -> %s pixel %i,%i %08"PRIx64" != %08"PRIx64,
+				        name, gp_pixel_type_name(src->pixel_type),
+				        gp_pixel_type_name(dst->pixel_type),
+				        x, y, e, p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int blit_masked(const struct blit_masked *params, const struct rect *r,
+                       int use_mask)
+{
+	gp_pixmap *src, *dst, *orig = NULL, *mask = NULL, *map = NULL;
+	int ret = TST_UNTESTED;
+
+	src = alloc_flags(SRC_W, SRC_H, params->src_type, params->src_flags);
+	dst = alloc_flags(DST_W, DST_H, params->dst_type, params->dst_flags);
+
+	if (use_mask) {
+		/* Mask larger than the source */
+		mask = alloc_flags(SRC_W + 13, SRC_H + 3, GP_PIXEL_G1, params->mask_flags);
+		if (!mask)
+			goto exit;
+
+		if (params->mask_be)
+			mask->bit_endian = GP_BIT_ENDIAN_BE;
+
+		fill_random(mask, 0);
+	}
+
+	if (!src || !dst)
+		goto exit;
+
+	fill_random(src, !use_mask);
+	fill_random(dst, 0);
+
+	orig = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS | GP_COPY_WITH_ROTATION);
+	map = clip_map(r);
+
+	if (!orig || !map)
+		goto exit;
+
+	if (use_mask)
+		gp_blit_masked(src, r->x0, r->y0, r->w0, r->h0, dst, r->x1, r->y1, mask);
+	else
+		gp_blit_colorkey(src, r->x0, r->y0, r->w0, r->h0, dst, r->x1, r->y1, KEY);
+
+	if (check(src, dst, orig, mask, map, use_mask ? "Masked" : "Colorkey"))
+		ret = TST_FAILED;
+	else
+		ret = TST_SUCCESS;
+exit:
+	if (ret == TST_UNTESTED)
+		tst_msg("Malloc failed :(");
+
+	gp_pixmap_free(map);
+	gp_pixmap_free(orig);
+	gp_pixmap_free(mask);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int test_blit_masked(const struct blit_masked *params)
+{
+	unsigned int i;
+	int use_mask, ret;
+
+	for (use_mask = 0; use_mask <= 1; use_mask++) {
+		for (i = 0; i < GP_ARRAY_SIZE(rects); i++) {
+			ret = blit_masked(params, &rects[i], use_mask);
+			if (ret != TST_SUCCESS)
+				return ret;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit masked",
+	.tests = {
+		{.name = "Blit masked G4",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_G4, GP_PIXEL_G4, 0, 0, 0, 0}},
+		{.name = "Blit masked G8",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_G8, GP_PIXEL_G8, 0, 0, 0, 0}},
+		{.name = "Blit masked RGB565",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_RGB565, GP_PIXEL_RGB565, 0, 0, 0, 0}},
+		{.name = "Blit masked RGB888",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_RGB888, GP_PIXEL_RGB888, 0, 0, 0, 0}},
+		{.name = "Blit masked xRGB8888",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, 0, 0, 0, 0}},
+		{.name = "Blit masked xRGB8888 mask BE",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, 0, 0, 0, 1}},
+		{.name = "Blit masked RGB888 -> xRGB8888",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_RGB888, GP_PIXEL_xRGB8888, 0, 0, 0, 0}},
+		{.name = "Blit masked rotated RGB565",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_RGB565, GP_PIXEL_RGB565, 3, 3, 3, 0}},
+		{.name = "Blit masked rotated G8",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_G8, GP_PIXEL_G8, 5, 5, 5, 1}},
+		{.name = "Blit masked different rotations xRGB8888",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, 1, 6, 2, 0}},
+		{.name = "Blit masked rotated RGB888",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_RGB888, GP_PIXEL_RGB888, 5, 5, 5, 0}},
+		{.name = "Blit masked different rotations G4",
+		 .tst_fn = test_blit_masked,
+		 .data = &(struct blit_masked){GP_PIXEL_G4, GP_PIXEL_G4, 2, 5, 7, 1}},
+		{.name = NULL}
+	}
+};
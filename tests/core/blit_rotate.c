@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Blits between pixmaps with all combinations of rotation flags compared
+  against the same blit between unrotated pixmaps read back pixel by pixel.
+
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_threads.h>
+
+#include "tst_test.h"
+#include "blit.h"
+
+struct blit_rotate {
+	gp_pixel_type src_type;
+	gp_pixel_type dst_type;
+};
+
+static const struct rect {
+	/* Source and destination pixmap sizes */
+	gp_size sw, sh;
+	gp_size dw, dh;
+	/* Source rectangle and destination offset */
+	gp_coord x0, y0;
+	gp_size w, h;
+	gp_coord x2, y2;
+} rects[] = {
+	{1, 1, 1, 1, 0, 0, 1, 1, 0, 0},
+	{7, 5, 9, 11, 1, 2, 5, 3, 2, 3},
+	{45, 37, 61, 53, 3, 1, 37, 29, 5, 7},
+	{600, 500, 620, 610, 13, 7, 500, 480, 11, 17},
+};
+
+/*
+ * Builds the expected result by blitting into unrotated pixmap initialized
+ * with the destination pixels.
+ */
+static gp_pixmap *expected(const gp_pixmap *src, const gp_pixmap *dst,
+                           const struct rect *r)
+{
+	gp_pixmap *s, *ret;
+	gp_coord x, y;
+
+	s = gp_pixmap_alloc(r->w, r->h, src->pixel_type);
+	ret = gp_pixmap_alloc(r->w, r->h, dst->pixel_type);
+
+	if (!s || !ret) {
+		gp_pixmap_free(s);
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	for (y = 0; y < (gp_coord)r->h; y++) {
+		for (x = 0; x < (gp_coord)r->w; x++) {
+			gp_putpixel_raw(s, x, y, gp_getpixel(src, r->x0 + x, r->y0 + y));
+			gp_putpixel_raw(ret, x, y, gp_getpixel(dst, r->x2 + x, r->y2 + y));
+		}
+	}
+
+	gp_blit_xywh(s, 0, 0, r->w, r->h, ret, 0, 0);
+	gp_pixmap_free(s);
+
+	return ret;
+}
+
+static int check(const gp_pixmap *exp, const gp_pixmap *dst,
+                 const gp_pixmap *src, const struct rect *r)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)r->h; y++) {
+		for (x = 0; x < (gp_coord)r->w; x++) {
+			gp_pixel e = gp_getpixel_raw(exp, x, y);
+			gp_pixel p = gp_getpixel(dst, r->x2 + x, r->y2 + y);
+
+			if (e != p) {
+				tst_msg("%s -> %s flags %i%i%i -> %i%i%i %ux%u pixel %i,%i %08"PRIx64" != %08"PRIx64,
+				        gp_pixel_type_name(src->pixel_type),
+				        gp_pixel_type_name(dst->pixel_type),
+				        src->axes_swap, src->x_swap, src->y_swap,
+				        dst->axes_swap, dst->x_swap, dst->y_swap,
+				        r->w, r->h, x, y, e, p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int blit_rotate(const struct blit_rotate *params, const struct rect *r,
+                       int src_flags, int dst_flags)
+{
+	gp_pixmap *src, *dst, *exp = NULL;
+	int ret = TST_FAILED;
+
+	src = alloc_random(r->sw, r->sh, params->src_type, src_flags);
+	dst = alloc_random(r->dw, r->dh, params->dst_type, dst_flags);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	exp = expected(src, dst, r);
+	if (!exp) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_blit_xywh(src, r->x0, r->y0, r->w, r->h, dst, r->x2, r->y2);
+
+	if (!check(exp, dst, src, r))
+		ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(exp);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int test_blit_rotate(const struct blit_rotate *params)
+{
+	unsigned int i, threads;
+	int src_flags, dst_flags, ret;
+
+	for (threads = 1; threads <= 4; threads += 3) {
+		gp_nr_threads_set(threads);
+
+		for (i = 0; i < GP_ARRAY_SIZE(rects); i++) {
+			for (src_flags = 0; src_flags < 8; src_flags++) {
+				for (dst_flags = 0; dst_flags < 8; dst_flags++) {
+					ret = blit_rotate(params, &rects[i], src_flags, dst_flags);
+					if (ret != TST_SUCCESS) {
+						gp_nr_threads_set(0);
+						return ret;
+					}
+				}
+			}
+		}
+	}
+
+	gp_nr_threads_set(0);
+
+	return TST_SUCCESS;
+}
+
+static int test_blit_rotate_clipped(void)
+{
+	gp_pixmap *src, *dst;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	src = alloc_random(20, 10, GP_PIXEL_RGB888, 3);
+	dst = alloc_random(15, 15, GP_PIXEL_RGB888, 4);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_blit_xywh_clipped(src, 0, 0, 20, 10, dst, 5, 8);
+
+	for (y = 0; y < 7; y++) {
+		for (x = 0; x < 10; x++) {
+			gp_pixel s = gp_getpixel(src, x, y);
+			gp_pixel d = gp_getpixel(dst, x + 5, y + 8);
+
+			if (s != d) {
+				tst_msg("Pixel %i,%i %08"PRIx64" != %08"PRIx64, x, y, s, d);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(dst);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit rotate",
+	.tests = {
+		{.name = "Blit rotate G1",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_G1, GP_PIXEL_G1}},
+		{.name = "Blit rotate G4",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_G4, GP_PIXEL_G4}},
+		{.name = "Blit rotate G8",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_G8, GP_PIXEL_G8}},
+		{.name = "Blit rotate RGB565",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGB565, GP_PIXEL_RGB565}},
+		{.name = "Blit rotate RGB888",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGB888, GP_PIXEL_RGB888}},
+		{.name = "Blit rotate xRGB8888",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888}},
+		{.name = "Blit rotate RGB161616",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGB161616, GP_PIXEL_RGB161616}},
+		{.name = "Blit rotate RGBA16161616",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGBA16161616, GP_PIXEL_RGBA16161616}},
+		{.name = "Blit rotate xRGB8888 -> RGB888",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_xRGB8888, GP_PIXEL_RGB888}},
+		{.name = "Blit rotate RGB888 -> G1",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGB888, GP_PIXEL_G1}},
+		{.name = "Blit rotate RGBA8888 -> xRGB8888",
+		 .tst_fn = test_blit_rotate,
+		 .data = &(struct blit_rotate){GP_PIXEL_RGBA8888, GP_PIXEL_xRGB8888}},
+		{.name = "Blit rotate clipped",
+		 .tst_fn = test_blit_rotate_clipped},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Scaled blits compared against per pixel reference scaling followed by a
+  clipped blit, for integer and arbitrary factors, pixel type conversions,
+  clipping and rotated pixmaps.
+
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+
+#include "tst_test.h"
+#include "blit.h"
+
+struct blit_scaled {
+	gp_pixel_type src_type;
+	gp_pixel_type dst_type;
+	enum gp_blit_scale_type type;
+	/* Rotation flags for source and destination */
+	int src_flags;
+	int dst_flags;
+};
+
+static const struct scale {
+	/* Source rectangle */
+	gp_coord x0, y0;
+	gp_size w0, h0;
+	/* Destination rectangle */
+	gp_coord x1, y1;
+	gp_size w1, h1;
+	/* The mapping does not depend on mirroring */
+	int symmetric;
+} scales[] = {
+	/* 2x and 3x */
+	{3, 2, 20, 10, 1, 3, 40, 20, 1},
+	{0, 0, 40, 30, 5, 2, 120, 90, 0},
+	/* 1/2 */
+	{2, 1, 64, 48, 7, 0, 32, 24, 1},
+	/* Arbitrary factors */
+	{1, 1, 37, 19, 0, 0, 53, 41, 0},
+	{0, 3, 100, 80, 2, 2, 33, 27, 0},
+	{5, 5, 1, 1, 0, 0, 7, 5, 0},
+	/* Clipped */
+	{0, 0, 20, 20, -13, -7, 40, 40, 1},
+	{0, 0, 64, 48, 100, 70, 32, 24, 1},
+	{0, 0, 37, 19, 90, -3, 53, 41, 0},
+};
+
+#define SRC_W 128
+#define SRC_H 96
+#define DST_W 125
+#define DST_H 91
+
+static gp_pixel chan_get(gp_pixel p, const gp_pixel_channel *c)
+{
+	return (p >> c->offset) & ((1<<c->size) - 1);
+}
+
+static void linear_pos(gp_coord i, gp_size from, gp_size to,
+                       gp_coord *a, gp_coord *b, unsigned int *w)
+{
+	int64_t pos = (((2 * (int64_t)i + 1) * from)<<16) / (2 * (int64_t)to) - (1<<15);
+
+	if (pos < 0)
+		pos = 0;
+
+	*a = pos>>16;
+	*w = (pos>>8) & 0xff;
+
+	if (*a >= (gp_coord)from - 1) {
+		*a = from - 1;
+		*w = 0;
+	}
+
+	*b = *w ? *a + 1 : *a;
+}
+
+static gp_pixel ref_linear(const gp_pixmap *src, const struct scale *s,
+                           gp_coord x, gp_coord y)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	gp_coord xa, xb, ya, yb;
+	unsigned int wx, wy, i;
+	gp_pixel p00, p10, p01, p11, ret = 0;
+
+	linear_pos(x, s->w0, s->w1, &xa, &xb, &wx);
+	linear_pos(y, s->h0, s->h1, &ya, &yb, &wy);
+
+	p00 = gp_getpixel(src, s->x0 + xa, s->y0 + ya);
+	p10 = gp_getpixel(src, s->x0 + xb, s->y0 + ya);
+	p01 = gp_getpixel(src, s->x0 + xa, s->y0 + yb);
+	p11 = gp_getpixel(src, s->x0 + xb, s->y0 + yb);
+
+	for (i = 0; i < desc->numchannels; i++) {
+		const gp_pixel_channel *c = &desc->channels[i];
+		uint32_t r0 = chan_get(p00, c) * (256 - wx) + chan_get(p10, c) * wx;
+		uint32_t r1 = chan_get(p01, c) * (256 - wx) + chan_get(p11, c) * wx;
+		gp_pixel v = (r0 * (256 - wy) + r1 * wy + (1<<15))>>16;
+
+		ret |= v << c->offset;
+	}
+
+	return ret;
+}
+
+static gp_pixel ref_nn(const gp_pixmap *src, const struct scale *s,
+                       gp_coord x, gp_coord y)
+{
+	gp_coord sx = ((2 * (uint64_t)x + 1) * s->w0) / (2 * s->w1);
+	gp_coord sy = ((2 * (uint64_t)y + 1) * s->h0) / (2 * s->h1);
+
+	return gp_getpixel(src, s->x0 + sx, s->y0 + sy);
+}
+
+/*
+ * Scales the source rectangle pixel by pixel and blits it into a copy of the
+ * destination.
+ */
+static gp_pixmap *expected(const gp_pixmap *src, const gp_pixmap *dst,
+                           const struct scale *s, enum gp_blit_scale_type type)
+{
+	gp_pixmap *ref, *ret;
+	gp_coord x, y;
+
+	ref = gp_pixmap_alloc(s->w1, s->h1, src->pixel_type);
+	ret = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS | GP_COPY_WITH_ROTATION);
+
+	if (!ref || !ret) {
+		gp_pixmap_free(ref);
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	for (y = 0; y < (gp_coord)s->h1; y++) {
+		for (x = 0; x < (gp_coord)s->w1; x++) {
+			gp_pixel p;
+
+			if (type == GP_BLIT_SCALE_LINEAR)
+				p = ref_linear(src, s, x, y);
+			else
+				p = ref_nn(src, s, x, y);
+
+			gp_putpixel_raw(ref, x, y, p);
+		}
+	}
+
+	gp_blit_clipped(ref, 0, 0, s->w1, s->h1, ret, s->x1, s->y1);
+	gp_pixmap_free(ref);
+
+	return ret;
+}
+
+static int check(const gp_pixmap *exp, const gp_pixmap *dst,
+                 const struct blit_scaled *params, const struct scale *s)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)gp_pixmap_h(dst); y++) {
+		for (x = 0; x < (gp_coord)gp_pixmap_w(dst); x++) {
+			gp_pixel e = gp_getpixel(exp, x, y);
+			gp_pixel p = gp_getpixel(dst, x, y);
+
+			if (e != p) {
+				tst_msg("%s %ux%u -> %s %ux%u at %i,%i pixel %i,%i %08"PRIx64" != %08"PRIx64,
+				        gp_pixel_type_name(params->src_type), s->w0, s->h0,
+				        gp_pixel_type_name(params->dst_type), s->w1, s->h1,
+				        s->x1, s->y1, x, y, e, p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int blit_scaled(const struct blit_scaled *params, const struct scale *s)
+{
+	gp_pixmap *src, *dst, *exp = NULL;
+	int ret = TST_FAILED;
+
+	src = alloc_random(SRC_W, SRC_H, params->src_type, params->src_flags);
+	dst = alloc_random(DST_W, DST_H, params->dst_type, params->dst_flags);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	exp = expected(src, dst, s, params->type);
+	if (!exp) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_blit_scaled(src, s->x0, s->y0, s->w0, s->h0,
+	                   dst, s->x1, s->y1, s->w1, s->h1, params->type)) {
+		tst_msg("gp_blit_scaled() failed");
+		goto exit;
+	}
+
+	if (!check(exp, dst, params, s))
+		ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(exp);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int test_blit_scaled(const struct blit_scaled *params)
+{
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < GP_ARRAY_SIZE(scales); i++) {
+		if ((params->src_flags || params->dst_flags) && !scales[i].symmetric)
+			continue;
+
+		ret = blit_scaled(params, &scales[i]);
+		if (ret != TST_SUCCESS)
+			return ret;
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit scaled",
+	.tests = {
+		{.name = "Blit scaled NN G1",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_G1, GP_PIXEL_G1, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled NN G8",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_G8, GP_PIXEL_G8, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled NN RGB565",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB565, GP_PIXEL_RGB565, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled NN RGB888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB888, GP_PIXEL_RGB888, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled NN xRGB8888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled NN RGBA16161616",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGBA16161616, GP_PIXEL_RGBA16161616, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled linear G1",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_G1, GP_PIXEL_G1, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear G8",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_G8, GP_PIXEL_G8, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear RGB565",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB565, GP_PIXEL_RGB565, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear RGB888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB888, GP_PIXEL_RGB888, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear xRGB8888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear RGBA16161616",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGBA16161616, GP_PIXEL_RGBA16161616, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled NN xRGB8888 -> RGB565",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_xRGB8888, GP_PIXEL_RGB565, GP_BLIT_SCALE_NN, 0, 0}},
+		{.name = "Blit scaled linear RGB888 -> G1",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB888, GP_PIXEL_G1, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled linear RGBA8888 -> xRGB8888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGBA8888, GP_PIXEL_xRGB8888, GP_BLIT_SCALE_LINEAR, 0, 0}},
+		{.name = "Blit scaled NN rotated RGB888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB888, GP_PIXEL_RGB888, GP_BLIT_SCALE_NN, 0, 3}},
+		{.name = "Blit scaled linear rotated xRGB8888",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_xRGB8888, GP_PIXEL_xRGB8888, GP_BLIT_SCALE_LINEAR, 5, 5}},
+		{.name = "Blit scaled linear rotated RGB888 -> G4",
+		 .tst_fn = test_blit_scaled,
+		 .data = &(struct blit_scaled){GP_PIXEL_RGB888, GP_PIXEL_G4, GP_BLIT_SCALE_LINEAR, 6, 1}},
+		{.name = NULL}
+	}
+};
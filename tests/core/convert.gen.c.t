@@ -4,6 +4,7 @@
  *
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
+#include <inttypes.h>
 #include <stdio.h>
 #include <core/gp_convert.h>
 
@@ -129,12 +130,12 @@ static int convert_and_check_{{ test_name }}_{{ in_name }}_to_{{ out_name }}(voi
 	gp_pixel in = get_{{ test_name }}(GP_PIXEL_{{ in_name }});
 	gp_pixel out_exp = get_{{ test_name }}(GP_PIXEL_{{ out_name }});
 
-	tst_msg("{{ in_name }} %08x -> {{ out_name }} %08x", in, out_exp);
+	tst_msg("{{ in_name }} %08"PRIx64" -> {{ out_name }} %08"PRIx64, in, out_exp);
 
 	GP_PIXEL_{{ in_name }}_TO_{{ out_name }}(in, out);
 
 	if (out_exp != out) {
-		tst_msg("Pixels are different have %08x, expected %08x",
+		tst_msg("Pixels are different have %08"PRIx64", expected %08"PRIx64,
 		        out, out_exp);
 		return TST_FAILED;
 	}
@@ -0,0 +1,537 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Pixmap damage tracking tests.
+
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_damage.h>
+#include <core/gp_fill.h>
+#include <core/gp_blit.h>
+#include <core/gp_get_put_pixel.h>
+#include <gfx/gp_gfx.h>
+#include <text/gp_text.h>
+#include <backends/gp_backend.h>
+
+#include "tst_test.h"
+
+static int rect_equal(const gp_pixmap *pixmap, unsigned int i,
+                      gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	const gp_damage_rect *r = &pixmap->damage->rects[i];
+
+	if (r->x0 == x0 && r->y0 == y0 && r->x1 == x1 && r->y1 == y1)
+		return 1;
+
+	tst_msg("Rect %u is [%i,%i]-[%i,%i] expected [%i,%i]-[%i,%i]",
+	        i, r->x0, r->y0, r->x1, r->y1, x0, y0, x1, y1);
+
+	return 0;
+}
+
+static int check_cnt(const gp_pixmap *pixmap, unsigned int cnt)
+{
+	if (pixmap->damage->rect_cnt == cnt)
+		return 0;
+
+	tst_msg("Wrong number of damaged rectangles %u expected %u",
+	        pixmap->damage->rect_cnt, cnt);
+
+	return 1;
+}
+
+static int damage_merge(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	if (gp_pixmap_damaged(pixmap)) {
+		tst_msg("Fresh damage is not empty");
+		goto exit;
+	}
+
+	/* Adjacent rectangles are merged */
+	gp_pixmap_damage_xyxy_raw(pixmap, 0, 0, 9, 9);
+	gp_pixmap_damage_xyxy_raw(pixmap, 19, 9, 10, 0);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 0, 19, 9))
+		goto exit;
+
+	/* Contained rectangle does not change anything */
+	gp_pixmap_damage_xyxy_raw(pixmap, 5, 5, 12, 7);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 0, 19, 9))
+		goto exit;
+
+	/* Crossing lines are not merged into the bounding box */
+	gp_pixmap_damage_xyxy_raw(pixmap, 50, 20, 50, 90);
+	gp_pixmap_damage_xyxy_raw(pixmap, 20, 50, 90, 50);
+
+	if (check_cnt(pixmap, 3))
+		goto exit;
+
+	/* Rectangle that covers the rest merges them all */
+	gp_pixmap_damage_xyxy_raw(pixmap, 0, 0, 99, 99);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 0, 99, 99))
+		goto exit;
+
+	gp_pixmap_damage_clear(pixmap);
+
+	if (gp_pixmap_damaged(pixmap)) {
+		tst_msg("Damage not cleared");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int covered(const gp_pixmap *pixmap, gp_coord x, gp_coord y)
+{
+	unsigned int i;
+
+	for (i = 0; i < pixmap->damage->rect_cnt; i++) {
+		const gp_damage_rect *r = &pixmap->damage->rects[i];
+
+		if (x >= r->x0 && x <= r->x1 && y >= r->y0 && y <= r->y1)
+			return 1;
+	}
+
+	return 0;
+}
+
+static int damage_overflow(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_coord i;
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < 30; i++)
+		gp_pixmap_damage_xyxy_raw(pixmap, 3 * i, 97 - 3 * i, 3 * i, 97 - 3 * i);
+
+	if (pixmap->damage->rect_cnt > GP_DAMAGE_MAX_RECTS) {
+		tst_msg("Too many rectangles %u", pixmap->damage->rect_cnt);
+		goto exit;
+	}
+
+	for (i = 0; i < 30; i++) {
+		if (!covered(pixmap, 3 * i, 97 - 3 * i)) {
+			tst_msg("Pixel %ix%i not damaged", 3 * i, 97 - 3 * i);
+			goto exit;
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int damage_clip(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 50, GP_PIXEL_RGB565);
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	gp_pixmap_damage_xyxy_raw(pixmap, 100, 0, 200, 10);
+	gp_pixmap_damage_xyxy_raw(pixmap, -10, -10, -1, 10);
+
+	if (check_cnt(pixmap, 0))
+		goto exit;
+
+	gp_pixmap_damage_xyxy_raw(pixmap, -10, 40, 10, 60);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 40, 10, 49))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int damage_subpixmap(gp_pixel_type pixel_type)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, pixel_type);
+	gp_pixmap sub, sub2;
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	gp_sub_pixmap(pixmap, &sub, 13, 21, 40, 40);
+	gp_sub_pixmap(&sub, &sub2, 3, 2, 20, 20);
+
+	gp_putpixel(&sub, 1, 1, 1);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 14, 22, 14, 22))
+		goto exit;
+
+	gp_pixmap_damage_clear(pixmap);
+
+	/* Clipped to the subpixmap */
+	gp_fill_rect_xyxy(&sub2, 10, 15, 30, 30, 1);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 26, 38, 35, 42))
+		goto exit;
+
+	/* Subpixmap does not own the damage */
+	gp_pixmap_damage_disable(&sub2);
+
+	if (!pixmap->damage) {
+		tst_msg("Damage freed by subpixmap");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static void draw_fill(gp_pixmap *pixmap)
+{
+	gp_fill(pixmap, 0x11);
+}
+
+static void draw_rect(gp_pixmap *pixmap)
+{
+	gp_rect_xyxy(pixmap, 5, 7, 60, 30, 0x11);
+}
+
+static void draw_lines(gp_pixmap *pixmap)
+{
+	gp_line(pixmap, -10, 3, 70, 60, 0x11);
+	gp_hline(pixmap, 2, 90, 45, 0x11);
+	gp_vline(pixmap, 33, 0, 90, 0x11);
+}
+
+static void draw_circles(gp_pixmap *pixmap)
+{
+	gp_circle(pixmap, 20, 20, 15, 0x11);
+	gp_fill_circle(pixmap, 60, 40, 10, 0x11);
+	gp_fill_ellipse(pixmap, 5, 50, 20, 8, 0x11);
+	gp_ring(pixmap, 70, 10, 5, 9, 0x11);
+}
+
+static void draw_polygons(gp_pixmap *pixmap)
+{
+	static const gp_coord xy[] = {10, 10, 60, 5, 40, 50, 20, 35};
+
+	gp_fill_polygon(pixmap, 4, xy, 0x11);
+	gp_fill_triangle(pixmap, 70, 5, 90, 40, 50, 60, 0x11);
+	gp_symbol(pixmap, 30, 60, 8, 6, GP_TRIANGLE_UP, 0x11);
+}
+
+static void draw_text(gp_pixmap *pixmap)
+{
+	gp_text(pixmap, NULL, 10, 10, GP_ALIGN_RIGHT | GP_VALIGN_BELOW,
+	        0x11, 0x22, "Damage!");
+}
+
+static void draw_blit(gp_pixmap *pixmap)
+{
+	gp_pixmap *src = gp_pixmap_alloc(30, 20, GP_PIXEL_RGB888);
+
+	if (!src)
+		return;
+
+	gp_fill(src, 0xffffff);
+	gp_blit_xywh_clipped(src, 0, 0, 30, 20, pixmap, 60, 50);
+	gp_pixmap_free(src);
+}
+
+struct damage_op {
+	void (*draw)(gp_pixmap *pixmap);
+	int rotate;
+};
+
+static struct damage_op fill = {draw_fill, 0};
+static struct damage_op rect = {draw_rect, 0};
+static struct damage_op rect_rot = {draw_rect, 1};
+static struct damage_op lines = {draw_lines, 0};
+static struct damage_op lines_rot = {draw_lines, 1};
+static struct damage_op circles = {draw_circles, 0};
+static struct damage_op circles_rot = {draw_circles, 1};
+static struct damage_op polygons = {draw_polygons, 0};
+static struct damage_op polygons_rot = {draw_polygons, 1};
+static struct damage_op text = {draw_text, 0};
+static struct damage_op text_rot = {draw_text, 1};
+static struct damage_op blit = {draw_blit, 0};
+static struct damage_op blit_rot = {draw_blit, 1};
+
+static int damage_draw(const struct damage_op *op)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(80, 70, GP_PIXEL_RGB888);
+	gp_pixmap *orig = NULL;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	if (op->rotate)
+		gp_pixmap_rotate_cw(pixmap);
+
+	gp_fill(pixmap, 0);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 0, 79, 69))
+		goto exit;
+
+	gp_pixmap_damage_clear(pixmap);
+
+	orig = gp_pixmap_copy(pixmap, GP_COPY_WITH_PIXELS);
+	if (!orig) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	op->draw(pixmap);
+
+	if (!gp_pixmap_damaged(pixmap)) {
+		tst_msg("Pixmap not damaged");
+		goto exit;
+	}
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++) {
+			if (gp_getpixel_raw(pixmap, x, y) ==
+			    gp_getpixel_raw(orig, x, y))
+				continue;
+
+			if (!covered(pixmap, x, y)) {
+				tst_msg("Modified pixel %ix%i not damaged",
+				        x, y);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(orig);
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int damage_free(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	gp_pixmap *copy;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	/* Enabling twice is no-op */
+	if (gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Second enable failed");
+		gp_pixmap_free(pixmap);
+		return TST_FAILED;
+	}
+
+	copy = gp_pixmap_copy(pixmap, GP_COPY_SHARE_PIXELS);
+	if (!copy) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	if (copy->damage) {
+		tst_msg("Damage copied");
+		gp_pixmap_free(copy);
+		gp_pixmap_free(pixmap);
+		return TST_FAILED;
+	}
+
+	gp_pixmap_free(copy);
+	gp_pixmap_free(pixmap);
+
+	return TST_SUCCESS;
+}
+
+/*
+ * Subpixmaps point to the parent damage list, it must stay valid when the
+ * tracking is disabled.
+ */
+static int damage_disable_subpixmap(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap sub;
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	gp_sub_pixmap(pixmap, &sub, 10, 10, 20, 20);
+
+	gp_pixmap_damage_disable(pixmap);
+
+	if (!pixmap->damage || sub.damage != pixmap->damage) {
+		tst_msg("Damage disabled with existing subpixmap");
+		goto exit;
+	}
+
+	gp_putpixel(&sub, 1, 1, 1);
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 11, 11, 11, 11))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+/* Shrinks the pixmap in place, as some of the backends do */
+static int resize_ack(gp_backend *self)
+{
+	gp_pixmap *pixmap = self->pixmap;
+
+	gp_pixmap_init(pixmap, 50, 50, pixmap->pixel_type, pixmap->pixels);
+
+	return 0;
+}
+
+static int damage_resize_ack(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_backend backend = {
+		.name = "test",
+		.pixmap = pixmap,
+		.resize_ack = resize_ack,
+	};
+	gp_damage *damage;
+	uint8_t *pixels;
+	gp_pixmap sub;
+	int ret = TST_FAILED;
+
+	if (!pixmap || gp_pixmap_damage_enable(pixmap)) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	pixels = pixmap->pixels;
+	damage = pixmap->damage;
+
+	gp_sub_pixmap(pixmap, &sub, 10, 10, 20, 20);
+
+	gp_backend_resize_ack(&backend);
+
+	if (pixmap->damage != damage || damage->pixmap != pixmap) {
+		tst_msg("Damage was not moved to the resized pixmap");
+		goto exit;
+	}
+
+	if (check_cnt(pixmap, 1) || !rect_equal(pixmap, 0, 0, 0, 49, 49))
+		goto exit;
+
+	gp_pixmap_damage_clear(pixmap);
+
+	/* The subpixmap is not inside the resized pixmap, damages all of it */
+	gp_putpixel(&sub, 1, 1, 1);
+
+	if (check_cnt(pixmap, 1))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	free(pixels);
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Pixmap damage testsuite",
+	.tests = {
+		{.name = "Damage merge",
+		 .tst_fn = damage_merge,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Damage overflow",
+		 .tst_fn = damage_overflow},
+		{.name = "Damage clipping",
+		 .tst_fn = damage_clip},
+		{.name = "Damage subpixmap RGB888",
+		 .tst_fn = damage_subpixmap, .data = (void*)GP_PIXEL_RGB888},
+		{.name = "Damage subpixmap G1",
+		 .tst_fn = damage_subpixmap, .data = (void*)GP_PIXEL_G1},
+		{.name = "Damage subpixmap G4",
+		 .tst_fn = damage_subpixmap, .data = (void*)GP_PIXEL_G4},
+		{.name = "Damage fill",
+		 .tst_fn = damage_draw, .data = &fill},
+		{.name = "Damage rect",
+		 .tst_fn = damage_draw, .data = &rect},
+		{.name = "Damage rect rotated",
+		 .tst_fn = damage_draw, .data = &rect_rot},
+		{.name = "Damage lines",
+		 .tst_fn = damage_draw, .data = &lines},
+		{.name = "Damage lines rotated",
+		 .tst_fn = damage_draw, .data = &lines_rot},
+		{.name = "Damage circles",
+		 .tst_fn = damage_draw, .data = &circles},
+		{.name = "Damage circles rotated",
+		 .tst_fn = damage_draw, .data = &circles_rot},
+		{.name = "Damage polygons",
+		 .tst_fn = damage_draw, .data = &polygons},
+		{.name = "Damage polygons rotated",
+		 .tst_fn = damage_draw, .data = &polygons_rot},
+		{.name = "Damage text",
+		 .tst_fn = damage_draw, .data = &text},
+		{.name = "Damage text rotated",
+		 .tst_fn = damage_draw, .data = &text_rot},
+		{.name = "Damage blit",
+		 .tst_fn = damage_draw, .data = &blit},
+		{.name = "Damage blit rotated",
+		 .tst_fn = damage_draw, .data = &blit_rot},
+		{.name = "Damage disable with subpixmap",
+		 .tst_fn = damage_disable_subpixmap,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Damage backend resize_ack",
+		 .tst_fn = damage_resize_ack,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Damage free",
+		 .tst_fn = damage_free,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = NULL},
+	}
+};
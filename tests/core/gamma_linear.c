@@ -0,0 +1,416 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Gamma linearization tests.
+
+ */
+
+#include <inttypes.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_threads.h>
+#include <core/gp_gamma_linear.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_damage.h>
+
+#include "tst_test.h"
+
+static void fill_random(gp_pixmap *pixmap)
+{
+	uint32_t i;
+
+	for (i = 0; i < pixmap->bytes_per_row * pixmap->h; i++)
+		pixmap->pixels[i] = random();
+}
+
+static int pixmaps_equal(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %ix%i %08"PRIx64" %08"PRIx64,
+				        x, y, pa, pb);
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+static int round_trip(gp_pixel_type pixel_type)
+{
+	gp_pixmap *src, *dst;
+	gp_linear_pixmap *lin;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(211, 97, pixel_type);
+	dst = gp_pixmap_alloc(211, 97, pixel_type);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+
+	lin = gp_pixmap_to_linear_alloc(src, NULL);
+	if (!lin) {
+		tst_msg("gp_pixmap_to_linear_alloc() failed");
+		goto exit;
+	}
+
+	if (gp_pixmap_from_linear(lin, dst, NULL)) {
+		tst_msg("gp_pixmap_from_linear() failed");
+		gp_linear_pixmap_free(lin);
+		goto exit;
+	}
+
+	gp_linear_pixmap_free(lin);
+
+	if (pixmaps_equal(src, dst))
+		ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * The 12 bit reverse tables cannot tell apart the darkest values for gamma 2.2
+ * but the rest has to be converted back exactly.
+ */
+static int round_trip_gamma(void)
+{
+	gp_pixmap *src, *dst;
+	gp_linear_pixmap *lin;
+	int r[256], g[256], b[256];
+	int *chans[] = {r, g, b};
+	int i, ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(256, 1, GP_PIXEL_RGB888);
+	dst = gp_pixmap_alloc(256, 1, GP_PIXEL_RGB888);
+	lin = gp_linear_pixmap_alloc(256, 1, GP_PIXEL_RGB888);
+
+	if (!src || !dst || !lin) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_pixmap_set_gamma(src, 2.2) || gp_pixmap_set_gamma(dst, 2.2)) {
+		tst_msg("gp_pixmap_set_gamma() failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < 256; i++) {
+		r[i] = i;
+		g[i] = 255 - i;
+		b[i] = i ^ 0x55;
+	}
+
+	gp_pixel_row_pack(src, 0, 0, 256, chans);
+
+	if (gp_pixmap_to_linear(src, lin, NULL) ||
+	    gp_pixmap_from_linear(lin, dst, NULL)) {
+		tst_msg("Conversion failed");
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(dst, 0, 0, 256, chans);
+
+	for (i = 0; i < 256; i++) {
+		int err = GP_MAX(abs(r[i] - i), GP_MAX(abs(g[i] - (255 - i)),
+		                                         abs(b[i] - (i ^ 0x55))));
+		int min = GP_MIN(i, GP_MIN(255 - i, i ^ 0x55));
+
+		if ((min >= 16 && err) || err > 4) {
+			tst_msg("Pixel %i error %i", i, err);
+			goto exit;
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_linear_pixmap_free(lin);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int srgb_values(void)
+{
+	gp_pixmap *src;
+	gp_gamma *srgb;
+	uint16_t r[256], g[256], b[256], a[256];
+	uint16_t *chans[] = {r, g, b, a};
+	gp_coord i;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(256, 1, GP_PIXEL_RGBA8888);
+	srgb = gp_sRGB_acquire(GP_PIXEL_RGBA8888);
+
+	if (!src || !srgb) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < 256; i++)
+		gp_putpixel_raw(src, i, 0, GP_PIXEL_CREATE_RGBA8888(i, i, i, i));
+
+	gp_gamma_row_to_linear(srgb, src, 0, 0, 256, chans);
+
+	if (r[0] != 0 || r[255] != 0xffff) {
+		tst_msg("Wrong endpoints %u %u", r[0], r[255]);
+		goto exit;
+	}
+
+	for (i = 1; i < 256; i++) {
+		if (r[i] <= r[i-1]) {
+			tst_msg("Not strictly increasing at %i", i);
+			goto exit;
+		}
+	}
+
+	/* sRGB 0.5 == 0.214 linear */
+	if (r[128] < 14000 || r[128] > 14200) {
+		tst_msg("Wrong sRGB value %u", r[128]);
+		goto exit;
+	}
+
+	/* Alpha is linear */
+	for (i = 0; i < 256; i++) {
+		if (a[i] != i * 0x101) {
+			tst_msg("Alpha %i converted to %u", i, a[i]);
+			goto exit;
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_gamma_release(srgb);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int linear_threads(void)
+{
+	gp_pixmap *src, *dst;
+	gp_linear_pixmap *lin1, *lin4;
+	size_t size = 2 * 1024 * 1024;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(1024, 1024, GP_PIXEL_RGB565);
+	dst = gp_pixmap_alloc(1024, 1024, GP_PIXEL_RGB565);
+	lin1 = gp_linear_pixmap_alloc(1024, 1024, GP_PIXEL_RGB565);
+	lin4 = gp_linear_pixmap_alloc(1024, 1024, GP_PIXEL_RGB565);
+
+	if (!src || !dst || !lin1 || !lin4) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+
+	gp_nr_threads_set(1);
+	gp_pixmap_to_linear(src, lin1, NULL);
+	gp_nr_threads_set(4);
+	gp_pixmap_to_linear(src, lin4, NULL);
+
+	if (memcmp(lin1->chans[0], lin4->chans[0], 3 * size)) {
+		tst_msg("Linear buffers differ");
+		goto exit;
+	}
+
+	gp_pixmap_from_linear(lin4, dst, NULL);
+
+	if (pixmaps_equal(src, dst))
+		ret = TST_SUCCESS;
+exit:
+	gp_nr_threads_set(0);
+	gp_linear_pixmap_free(lin1);
+	gp_linear_pixmap_free(lin4);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int linear_mismatch(void)
+{
+	gp_pixmap *src;
+	gp_linear_pixmap *lin;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	lin = gp_linear_pixmap_alloc(10, 11, GP_PIXEL_RGB888);
+
+	if (!src || !lin) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	errno = 0;
+
+	if (!gp_pixmap_to_linear(src, lin, NULL) || errno != EINVAL) {
+		tst_msg("Size mismatch was not detected");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_linear_pixmap_free(lin);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int gamma_refcount(void)
+{
+	gp_gamma *g1, *g2, *g3;
+	int ret = TST_FAILED;
+
+	g1 = gp_gamma_acquire(GP_PIXEL_RGB888, 2.2);
+	g2 = gp_gamma_acquire(GP_PIXEL_RGB888, 2.2);
+
+	if (!g1 || !g2) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (g1->tables[0] != g2->tables[0]) {
+		tst_msg("Tables are not shared");
+		goto exit;
+	}
+
+	g3 = gp_gamma_copy(g1);
+	gp_gamma_release(g1);
+	g1 = NULL;
+
+	/* The tables are still referenced by g2 and g3 */
+	if (g3->tables[0]->ref_count != 2 * 3) {
+		tst_msg("Wrong table ref_count %u", g3->tables[0]->ref_count);
+		gp_gamma_release(g3);
+		goto exit;
+	}
+
+	gp_gamma_release(g3);
+
+	ret = TST_SUCCESS;
+exit:
+	gp_gamma_release(g1);
+	gp_gamma_release(g2);
+	return ret;
+}
+
+/*
+ * Converting into a pixmap that shares pixels copy-on-write must not change
+ * the other copies and has to record the damage.
+ */
+static int linear_shared(void)
+{
+	gp_pixmap *src, *orig = NULL, *copy = NULL, *backup = NULL;
+	gp_linear_pixmap *lin = NULL;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(67, 31, GP_PIXEL_RGB888);
+	orig = gp_pixmap_alloc(67, 31, GP_PIXEL_RGB888);
+
+	if (!src || !orig) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+	fill_random(orig);
+
+	backup = gp_pixmap_copy(orig, GP_COPY_WITH_PIXELS);
+	copy = gp_pixmap_copy(orig, GP_COPY_SHARE_PIXELS);
+	lin = gp_pixmap_to_linear_alloc(src, NULL);
+
+	if (!backup || !copy || !lin || gp_pixmap_damage_enable(copy)) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_pixmap_from_linear(lin, copy, NULL)) {
+		tst_msg("gp_pixmap_from_linear() failed");
+		goto exit;
+	}
+
+	if (!pixmaps_equal(orig, backup)) {
+		tst_msg("Shared pixels were modified");
+		goto exit;
+	}
+
+	if (!pixmaps_equal(src, copy))
+		goto exit;
+
+	if (!gp_pixmap_damaged(copy)) {
+		tst_msg("Damage was not recorded");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_linear_pixmap_free(lin);
+	gp_pixmap_free(copy);
+	gp_pixmap_free(backup);
+	gp_pixmap_free(orig);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Gamma linearization testsuite",
+	.tests = {
+		{.name = "Linear round trip RGB888",
+		 .tst_fn = round_trip, .data = (void*)GP_PIXEL_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Linear round trip RGBA8888",
+		 .tst_fn = round_trip, .data = (void*)GP_PIXEL_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Linear round trip RGB565",
+		 .tst_fn = round_trip, .data = (void*)GP_PIXEL_RGB565,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Linear round trip G8",
+		 .tst_fn = round_trip, .data = (void*)GP_PIXEL_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Linear round trip G2",
+		 .tst_fn = round_trip, .data = (void*)GP_PIXEL_G2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Linear round trip gamma 2.2",
+		 .tst_fn = round_trip_gamma},
+		{.name = "sRGB linear values",
+		 .tst_fn = srgb_values},
+		{.name = "Linear conversion threads",
+		 .tst_fn = linear_threads},
+		{.name = "Linear size mismatch",
+		 .tst_fn = linear_mismatch},
+		{.name = "Gamma ref_count",
+		 .tst_fn = gamma_refcount},
+		{.name = "Linear into shared pixmap",
+		 .tst_fn = linear_shared,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,1645 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * get_put_pixel.gen.c
+ *
+ * GENERATED on 2026 10 17 00:28:55 from get_put_pixel.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * GetPutPixel tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+
+#include "tst_test.h"
+
+static void fill_pixmap(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			gp_putpixel(c, x, y, p);
+}
+
+static int check_filled(gp_pixmap *c)
+{
+	gp_coord x, y;
+	gp_pixel p;
+
+	p = gp_getpixel(c, 0, 0);
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			if (p != gp_getpixel(c, x, y)) {
+				tst_msg("Pixels different %i %i", x, y);
+				return 1;
+			}
+
+	return 0;
+}
+
+static int try_pattern(gp_pixmap *c, gp_pixel p)
+{
+	fill_pixmap(c, p);
+
+	tst_msg("Filling pattern 0x%"PRIx64, p);
+
+	if (check_filled(c))
+		return 1;
+
+	return 0;
+}
+
+static int GetPutPixel_xRGB8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGBA8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 16777215U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_BGR888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 16777215U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 16777215U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB555(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB565(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB666(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 262143U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 262143U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 262143U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 262143U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB332(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_CMYK8888(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_P2(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 3U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 3U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 3U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 3U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_P4(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 15U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 15U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 15U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 15U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_P8(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_G1(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 1U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 1U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 1U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 1U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_G2(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 3U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 3U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 3U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 3U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_G4(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 15U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 15U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 15U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 15U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_G8(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 255U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 255U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 255U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 255U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_GA88(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_G16(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 65535U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 65535U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 65535U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGBA8888_PM(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 4294967295U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 4294967295U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGB161616(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 281474976710655U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 281474976710655U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 281474976710655U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 281474976710655U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_RGBA16161616(void)
+{
+	gp_pixmap *c;
+	int err = 0;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	if (try_pattern(c, 0x55555555 & 18446744073709551615U))
+		err++;
+
+	if (try_pattern(c, 0xaaaaaaaa & 18446744073709551615U))
+		err++;
+
+	if (try_pattern(c, 0x0f0f0f0f & 18446744073709551615U))
+		err++;
+
+	if (try_pattern(c, 0xf0f0f0f0 & 18446744073709551615U))
+		err++;
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int GetPutPixel_Clipping_xRGB8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGBA8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_BGR888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB555(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB565(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB666(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB332(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_CMYK8888(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_P2(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_P4(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_P8(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_P8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_G1(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_G2(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_G4(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_G8(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_GA88(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_G16(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGBA8888_PM(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGB161616(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB161616);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+static int GetPutPixel_Clipping_RGBA16161616(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA16161616);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return TST_UNTESTED;
+	}
+
+	fill_pixmap(c, 0xffffffff);
+
+	gp_coord x, y;
+	int err = 0;
+
+	for (x = -1000; x < 200; x++) {
+		for (y = -1000; y < 200; y++) {
+			if (x > 0 && x < 100 && y > 0 && y < 100)
+				continue;
+
+			/* Must be no-op */
+			gp_putpixel(c, x, y, 0);
+
+			/* Must return 0 */
+			if (gp_getpixel(c, x, y) != 0) {
+				tst_msg("gp_getpixel returned non-zero "
+				        "at %i %i", x, y);
+				err++;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	if (err)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "GetPutPixel Testsuite",
+	.tests = {
+		{.name = "GetPutPixel xRGB8888",
+		 .tst_fn = GetPutPixel_xRGB8888},
+		{.name = "GetPutPixel RGBA8888",
+		 .tst_fn = GetPutPixel_RGBA8888},
+		{.name = "GetPutPixel RGB888",
+		 .tst_fn = GetPutPixel_RGB888},
+		{.name = "GetPutPixel BGR888",
+		 .tst_fn = GetPutPixel_BGR888},
+		{.name = "GetPutPixel RGB555",
+		 .tst_fn = GetPutPixel_RGB555},
+		{.name = "GetPutPixel RGB565",
+		 .tst_fn = GetPutPixel_RGB565},
+		{.name = "GetPutPixel RGB666",
+		 .tst_fn = GetPutPixel_RGB666},
+		{.name = "GetPutPixel RGB332",
+		 .tst_fn = GetPutPixel_RGB332},
+		{.name = "GetPutPixel CMYK8888",
+		 .tst_fn = GetPutPixel_CMYK8888},
+		{.name = "GetPutPixel P2",
+		 .tst_fn = GetPutPixel_P2},
+		{.name = "GetPutPixel P4",
+		 .tst_fn = GetPutPixel_P4},
+		{.name = "GetPutPixel P8",
+		 .tst_fn = GetPutPixel_P8},
+		{.name = "GetPutPixel G1",
+		 .tst_fn = GetPutPixel_G1},
+		{.name = "GetPutPixel G2",
+		 .tst_fn = GetPutPixel_G2},
+		{.name = "GetPutPixel G4",
+		 .tst_fn = GetPutPixel_G4},
+		{.name = "GetPutPixel G8",
+		 .tst_fn = GetPutPixel_G8},
+		{.name = "GetPutPixel GA88",
+		 .tst_fn = GetPutPixel_GA88},
+		{.name = "GetPutPixel G16",
+		 .tst_fn = GetPutPixel_G16},
+		{.name = "GetPutPixel RGBA8888_PM",
+		 .tst_fn = GetPutPixel_RGBA8888_PM},
+		{.name = "GetPutPixel RGB161616",
+		 .tst_fn = GetPutPixel_RGB161616},
+		{.name = "GetPutPixel RGBA16161616",
+		 .tst_fn = GetPutPixel_RGBA16161616},
+
+		{.name = "GetPutPixel Clipping xRGB8888",
+		 .tst_fn = GetPutPixel_Clipping_xRGB8888},
+		{.name = "GetPutPixel Clipping RGBA8888",
+		 .tst_fn = GetPutPixel_Clipping_RGBA8888},
+		{.name = "GetPutPixel Clipping RGB888",
+		 .tst_fn = GetPutPixel_Clipping_RGB888},
+		{.name = "GetPutPixel Clipping BGR888",
+		 .tst_fn = GetPutPixel_Clipping_BGR888},
+		{.name = "GetPutPixel Clipping RGB555",
+		 .tst_fn = GetPutPixel_Clipping_RGB555},
+		{.name = "GetPutPixel Clipping RGB565",
+		 .tst_fn = GetPutPixel_Clipping_RGB565},
+		{.name = "GetPutPixel Clipping RGB666",
+		 .tst_fn = GetPutPixel_Clipping_RGB666},
+		{.name = "GetPutPixel Clipping RGB332",
+		 .tst_fn = GetPutPixel_Clipping_RGB332},
+		{.name = "GetPutPixel Clipping CMYK8888",
+		 .tst_fn = GetPutPixel_Clipping_CMYK8888},
+		{.name = "GetPutPixel Clipping P2",
+		 .tst_fn = GetPutPixel_Clipping_P2},
+		{.name = "GetPutPixel Clipping P4",
+		 .tst_fn = GetPutPixel_Clipping_P4},
+		{.name = "GetPutPixel Clipping P8",
+		 .tst_fn = GetPutPixel_Clipping_P8},
+		{.name = "GetPutPixel Clipping G1",
+		 .tst_fn = GetPutPixel_Clipping_G1},
+		{.name = "GetPutPixel Clipping G2",
+		 .tst_fn = GetPutPixel_Clipping_G2},
+		{.name = "GetPutPixel Clipping G4",
+		 .tst_fn = GetPutPixel_Clipping_G4},
+		{.name = "GetPutPixel Clipping G8",
+		 .tst_fn = GetPutPixel_Clipping_G8},
+		{.name = "GetPutPixel Clipping GA88",
+		 .tst_fn = GetPutPixel_Clipping_GA88},
+		{.name = "GetPutPixel Clipping G16",
+		 .tst_fn = GetPutPixel_Clipping_G16},
+		{.name = "GetPutPixel Clipping RGBA8888_PM",
+		 .tst_fn = GetPutPixel_Clipping_RGBA8888_PM},
+		{.name = "GetPutPixel Clipping RGB161616",
+		 .tst_fn = GetPutPixel_Clipping_RGB161616},
+		{.name = "GetPutPixel Clipping RGBA16161616",
+		 .tst_fn = GetPutPixel_Clipping_RGBA16161616},
+
+		{.name = NULL}
+	}
+};
@@ -5,6 +5,7 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include <core/gp_pixmap.h>
@@ -42,7 +43,7 @@ static int try_pattern(gp_pixmap *c, gp_pixel p)
 {
 	fill_pixmap(c, p);
 
-	tst_msg("Filling pattern 0x%x", p);
+	tst_msg("Filling pattern 0x%"PRIx64, p);
 
 	if (check_filled(c))
 		return 1;
@@ -0,0 +1,1609 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * pixel_row.gen.c
+ *
+ * GENERATED on 2026 10 17 00:28:47 from pixel_row.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Bulk row unpack and pack tests.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+
+#include "tst_test.h"
+
+#define ROW_W 77
+#define ROW_H 3
+#define ROW_X 3
+#define ROW_Y 1
+
+static gp_pixmap *alloc_random(gp_pixel_type type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(ROW_W, ROW_H, type);
+	unsigned int i;
+
+	if (!ret)
+		return NULL;
+
+	for (i = 0; i < ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+static int row_unpack_pack_xRGB8888(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_xRGB8888);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_xRGB8888(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_xRGB8888(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_xRGB8888(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_xRGB8888(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_xRGB8888(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_xRGB8888(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_xRGB8888(GP_PIXEL_GET_R_xRGB8888(exp), GP_PIXEL_GET_G_xRGB8888(exp), GP_PIXEL_GET_B_xRGB8888(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGBA8888(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGBA8888);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int A[ROW_W];
+	int *const chans[] = {R, G, B, A};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGBA8888(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGBA8888(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGBA8888(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGBA8888(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGBA8888(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGBA8888(p));
+			goto exit;
+		}
+		if (A[x] != (int)GP_PIXEL_GET_A_RGBA8888(p)) {
+			tst_msg("Channel A at %i unpacked %i expected %i",
+			        x, A[x], (int)GP_PIXEL_GET_A_RGBA8888(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGBA8888(GP_PIXEL_GET_R_RGBA8888(exp), GP_PIXEL_GET_G_RGBA8888(exp), GP_PIXEL_GET_B_RGBA8888(exp), GP_PIXEL_GET_A_RGBA8888(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB888(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB888);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB888);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB888(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB888(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB888(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB888(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB888(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB888(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB888(GP_PIXEL_GET_R_RGB888(exp), GP_PIXEL_GET_G_RGB888(exp), GP_PIXEL_GET_B_RGB888(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_BGR888(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_BGR888);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_BGR888);
+	gp_pixmap *ref = NULL;
+	int B[ROW_W];
+	int G[ROW_W];
+	int R[ROW_W];
+	int *const chans[] = {B, G, R};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (B[x] != (int)GP_PIXEL_GET_B_BGR888(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_BGR888(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_BGR888(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_BGR888(p));
+			goto exit;
+		}
+		if (R[x] != (int)GP_PIXEL_GET_R_BGR888(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_BGR888(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_BGR888(GP_PIXEL_GET_B_BGR888(exp), GP_PIXEL_GET_G_BGR888(exp), GP_PIXEL_GET_R_BGR888(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB555(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB555);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB555);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB555(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB555(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB555(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB555(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB555(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB555(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB555(GP_PIXEL_GET_R_RGB555(exp), GP_PIXEL_GET_G_RGB555(exp), GP_PIXEL_GET_B_RGB555(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB565(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB565);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB565);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB565(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB565(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB565(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB565(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB565(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB565(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB565(GP_PIXEL_GET_R_RGB565(exp), GP_PIXEL_GET_G_RGB565(exp), GP_PIXEL_GET_B_RGB565(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB666(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB666);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB666);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB666(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB666(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB666(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB666(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB666(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB666(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB666(GP_PIXEL_GET_R_RGB666(exp), GP_PIXEL_GET_G_RGB666(exp), GP_PIXEL_GET_B_RGB666(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB332(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB332);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB332);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB332(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB332(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB332(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB332(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB332(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB332(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB332(GP_PIXEL_GET_R_RGB332(exp), GP_PIXEL_GET_G_RGB332(exp), GP_PIXEL_GET_B_RGB332(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_CMYK8888(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_CMYK8888);
+	gp_pixmap *ref = NULL;
+	int K[ROW_W];
+	int Y[ROW_W];
+	int M[ROW_W];
+	int C[ROW_W];
+	int *const chans[] = {K, Y, M, C};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (K[x] != (int)GP_PIXEL_GET_K_CMYK8888(p)) {
+			tst_msg("Channel K at %i unpacked %i expected %i",
+			        x, K[x], (int)GP_PIXEL_GET_K_CMYK8888(p));
+			goto exit;
+		}
+		if (Y[x] != (int)GP_PIXEL_GET_Y_CMYK8888(p)) {
+			tst_msg("Channel Y at %i unpacked %i expected %i",
+			        x, Y[x], (int)GP_PIXEL_GET_Y_CMYK8888(p));
+			goto exit;
+		}
+		if (M[x] != (int)GP_PIXEL_GET_M_CMYK8888(p)) {
+			tst_msg("Channel M at %i unpacked %i expected %i",
+			        x, M[x], (int)GP_PIXEL_GET_M_CMYK8888(p));
+			goto exit;
+		}
+		if (C[x] != (int)GP_PIXEL_GET_C_CMYK8888(p)) {
+			tst_msg("Channel C at %i unpacked %i expected %i",
+			        x, C[x], (int)GP_PIXEL_GET_C_CMYK8888(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_CMYK8888(GP_PIXEL_GET_K_CMYK8888(exp), GP_PIXEL_GET_Y_CMYK8888(exp), GP_PIXEL_GET_M_CMYK8888(exp), GP_PIXEL_GET_C_CMYK8888(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_P2(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_P2);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_P2);
+	gp_pixmap *ref = NULL;
+	int P[ROW_W];
+	int *const chans[] = {P};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (P[x] != (int)GP_PIXEL_GET_P_P2(p)) {
+			tst_msg("Channel P at %i unpacked %i expected %i",
+			        x, P[x], (int)GP_PIXEL_GET_P_P2(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_P2(GP_PIXEL_GET_P_P2(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_P4(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_P4);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_P4);
+	gp_pixmap *ref = NULL;
+	int P[ROW_W];
+	int *const chans[] = {P};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (P[x] != (int)GP_PIXEL_GET_P_P4(p)) {
+			tst_msg("Channel P at %i unpacked %i expected %i",
+			        x, P[x], (int)GP_PIXEL_GET_P_P4(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_P4(GP_PIXEL_GET_P_P4(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_P8(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_P8);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_P8);
+	gp_pixmap *ref = NULL;
+	int P[ROW_W];
+	int *const chans[] = {P};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (P[x] != (int)GP_PIXEL_GET_P_P8(p)) {
+			tst_msg("Channel P at %i unpacked %i expected %i",
+			        x, P[x], (int)GP_PIXEL_GET_P_P8(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_P8(GP_PIXEL_GET_P_P8(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_G1(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_G1);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_G1);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int *const chans[] = {V};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_G1(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_G1(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_G1(GP_PIXEL_GET_V_G1(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_G2(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_G2);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_G2);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int *const chans[] = {V};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_G2(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_G2(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_G2(GP_PIXEL_GET_V_G2(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_G4(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_G4);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_G4);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int *const chans[] = {V};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_G4(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_G4(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_G4(GP_PIXEL_GET_V_G4(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_G8(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_G8);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_G8);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int *const chans[] = {V};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_G8(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_G8(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_G8(GP_PIXEL_GET_V_G8(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_GA88(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_GA88);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_GA88);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int A[ROW_W];
+	int *const chans[] = {V, A};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_GA88(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_GA88(p));
+			goto exit;
+		}
+		if (A[x] != (int)GP_PIXEL_GET_A_GA88(p)) {
+			tst_msg("Channel A at %i unpacked %i expected %i",
+			        x, A[x], (int)GP_PIXEL_GET_A_GA88(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_GA88(GP_PIXEL_GET_V_GA88(exp), GP_PIXEL_GET_A_GA88(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_G16(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_G16);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_G16);
+	gp_pixmap *ref = NULL;
+	int V[ROW_W];
+	int *const chans[] = {V};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (V[x] != (int)GP_PIXEL_GET_V_G16(p)) {
+			tst_msg("Channel V at %i unpacked %i expected %i",
+			        x, V[x], (int)GP_PIXEL_GET_V_G16(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_G16(GP_PIXEL_GET_V_G16(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGBA8888_PM(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int A[ROW_W];
+	int *const chans[] = {R, G, B, A};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGBA8888_PM(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGBA8888_PM(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGBA8888_PM(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGBA8888_PM(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGBA8888_PM(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGBA8888_PM(p));
+			goto exit;
+		}
+		if (A[x] != (int)GP_PIXEL_GET_A_RGBA8888_PM(p)) {
+			tst_msg("Channel A at %i unpacked %i expected %i",
+			        x, A[x], (int)GP_PIXEL_GET_A_RGBA8888_PM(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGBA8888_PM(GP_PIXEL_GET_R_RGBA8888_PM(exp), GP_PIXEL_GET_G_RGBA8888_PM(exp), GP_PIXEL_GET_B_RGBA8888_PM(exp), GP_PIXEL_GET_A_RGBA8888_PM(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGB161616(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGB161616);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGB161616);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int *const chans[] = {R, G, B};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGB161616(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGB161616(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGB161616(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGB161616(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGB161616(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGB161616(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGB161616(GP_PIXEL_GET_R_RGB161616(exp), GP_PIXEL_GET_G_RGB161616(exp), GP_PIXEL_GET_B_RGB161616(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int row_unpack_pack_RGBA16161616(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_RGBA16161616);
+	gp_pixmap *dst = alloc_random(GP_PIXEL_RGBA16161616);
+	gp_pixmap *ref = NULL;
+	int R[ROW_W];
+	int G[ROW_W];
+	int B[ROW_W];
+	int A[ROW_W];
+	int *const chans[] = {R, G, B, A};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+		if (R[x] != (int)GP_PIXEL_GET_R_RGBA16161616(p)) {
+			tst_msg("Channel R at %i unpacked %i expected %i",
+			        x, R[x], (int)GP_PIXEL_GET_R_RGBA16161616(p));
+			goto exit;
+		}
+		if (G[x] != (int)GP_PIXEL_GET_G_RGBA16161616(p)) {
+			tst_msg("Channel G at %i unpacked %i expected %i",
+			        x, G[x], (int)GP_PIXEL_GET_G_RGBA16161616(p));
+			goto exit;
+		}
+		if (B[x] != (int)GP_PIXEL_GET_B_RGBA16161616(p)) {
+			tst_msg("Channel B at %i unpacked %i expected %i",
+			        x, B[x], (int)GP_PIXEL_GET_B_RGBA16161616(p));
+			goto exit;
+		}
+		if (A[x] != (int)GP_PIXEL_GET_A_RGBA16161616(p)) {
+			tst_msg("Channel A at %i unpacked %i expected %i",
+			        x, A[x], (int)GP_PIXEL_GET_A_RGBA16161616(p));
+			goto exit;
+		}
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_RGBA16161616(GP_PIXEL_GET_R_RGBA16161616(exp), GP_PIXEL_GET_G_RGBA16161616(exp), GP_PIXEL_GET_B_RGBA16161616(exp), GP_PIXEL_GET_A_RGBA16161616(exp));
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Pixel row testsuite",
+	.tests = {
+		{.name = "Row unpack pack xRGB8888",
+		 .tst_fn = row_unpack_pack_xRGB8888},
+		{.name = "Row unpack pack RGBA8888",
+		 .tst_fn = row_unpack_pack_RGBA8888},
+		{.name = "Row unpack pack RGB888",
+		 .tst_fn = row_unpack_pack_RGB888},
+		{.name = "Row unpack pack BGR888",
+		 .tst_fn = row_unpack_pack_BGR888},
+		{.name = "Row unpack pack RGB555",
+		 .tst_fn = row_unpack_pack_RGB555},
+		{.name = "Row unpack pack RGB565",
+		 .tst_fn = row_unpack_pack_RGB565},
+		{.name = "Row unpack pack RGB666",
+		 .tst_fn = row_unpack_pack_RGB666},
+		{.name = "Row unpack pack RGB332",
+		 .tst_fn = row_unpack_pack_RGB332},
+		{.name = "Row unpack pack CMYK8888",
+		 .tst_fn = row_unpack_pack_CMYK8888},
+		{.name = "Row unpack pack P2",
+		 .tst_fn = row_unpack_pack_P2},
+		{.name = "Row unpack pack P4",
+		 .tst_fn = row_unpack_pack_P4},
+		{.name = "Row unpack pack P8",
+		 .tst_fn = row_unpack_pack_P8},
+		{.name = "Row unpack pack G1",
+		 .tst_fn = row_unpack_pack_G1},
+		{.name = "Row unpack pack G2",
+		 .tst_fn = row_unpack_pack_G2},
+		{.name = "Row unpack pack G4",
+		 .tst_fn = row_unpack_pack_G4},
+		{.name = "Row unpack pack G8",
+		 .tst_fn = row_unpack_pack_G8},
+		{.name = "Row unpack pack GA88",
+		 .tst_fn = row_unpack_pack_GA88},
+		{.name = "Row unpack pack G16",
+		 .tst_fn = row_unpack_pack_G16},
+		{.name = "Row unpack pack RGBA8888_PM",
+		 .tst_fn = row_unpack_pack_RGBA8888_PM},
+		{.name = "Row unpack pack RGB161616",
+		 .tst_fn = row_unpack_pack_RGB161616},
+		{.name = "Row unpack pack RGBA16161616",
+		 .tst_fn = row_unpack_pack_RGBA16161616},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,118 @@
+@ include source.t
+/*
+ * Bulk row unpack and pack tests.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_row.h>
+
+#include "tst_test.h"
+
+#define ROW_W 77
+#define ROW_H 3
+#define ROW_X 3
+#define ROW_Y 1
+
+static gp_pixmap *alloc_random(gp_pixel_type type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(ROW_W, ROW_H, type);
+	unsigned int i;
+
+	if (!ret)
+		return NULL;
+
+	for (i = 0; i < ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+@ for pt in pixeltypes:
+@     if not pt.is_unknown():
+static int row_unpack_pack_{{ pt.name }}(void)
+{
+	gp_pixmap *src = alloc_random(GP_PIXEL_{{ pt.name }});
+	gp_pixmap *dst = alloc_random(GP_PIXEL_{{ pt.name }});
+	gp_pixmap *ref = NULL;
+@         for c in pt.chanslist:
+	int {{ c.name }}[ROW_W];
+@         end
+	int *const chans[] = {{ '{' + ', '.join([c.name for c in pt.chanslist]) + '}' }};
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_pixel_row_unpack(src, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (x = 0; x < ROW_W - ROW_X - 2; x++) {
+		gp_pixel p = gp_getpixel_raw(src, ROW_X + x, ROW_Y);
+
+@         for i, c in enumerate(pt.chanslist):
+		if ({{ c.name }}[x] != (int)GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p)) {
+			tst_msg("Channel {{ c.name }} at %i unpacked %i expected %i",
+			        x, {{ c.name }}[x], (int)GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(p));
+			goto exit;
+		}
+@         end
+	}
+
+	gp_pixel_row_pack(dst, ROW_X, ROW_Y, ROW_W - ROW_X - 2, chans);
+
+	for (y = 0; y < ROW_H; y++) {
+		for (x = 0; x < ROW_W; x++) {
+			gp_pixel exp = gp_getpixel_raw(ref, x, y);
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+
+			/* Unused bits, if any, are cleared by the pack */
+			if (y == ROW_Y && x >= ROW_X && x < ROW_W - 2) {
+				exp = gp_getpixel_raw(src, x, y);
+				exp = GP_PIXEL_CREATE_{{ pt.name }}({{ ', '.join(['GP_PIXEL_GET_%s_%s(exp)' % (c.name, pt.name) for c in pt.chanslist]) }});
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, exp);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+@ end
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Pixel row testsuite",
+	.tests = {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown():
+		{.name = "Row unpack pack {{ pt.name }}",
+		 .tst_fn = row_unpack_pack_{{ pt.name }}},
+@ end
+		{.name = NULL}
+	}
+};
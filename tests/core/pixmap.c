@@ -8,9 +8,18 @@
   Very basic gp_pixmap tests.
 
  */
+#include <inttypes.h>
 #include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
 
 #include <core/gp_pixmap.h>
+#include <core/gp_pixmap_mmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fill.h>
+#include <core/gp_blit.h>
+#include <core/gp_threads.h>
 
 #include "tst_test.h"
 
@@ -264,6 +273,822 @@ static int pixmap_invalid_pixeltype2(void)
 	return TST_SUCCESS;
 }
 
+static int pixmap_alloc_aligned(int flags)
+{
+	gp_pixmap *c;
+	gp_coord y;
+	int ret = TST_SUCCESS;
+
+	c = gp_pixmap_alloc_ex(100, 20, GP_PIXEL_RGB888, flags);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc_ex() failed");
+		return TST_FAILED;
+	}
+
+	if (c->bytes_per_row != 320) {
+		tst_msg("Pixmap->bytes_per_row != 320 (== %i)", c->bytes_per_row);
+		ret = TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		if ((uintptr_t)GP_PIXEL_ADDR(c, 0, y) % GP_PIXMAP_ROW_ALIGNMENT) {
+			tst_msg("Row %i is not aligned", y);
+			ret = TST_FAILED;
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	return ret;
+}
+
+static int pixmap_alloc_padded(void)
+{
+	gp_pixmap *c;
+	int ret = TST_SUCCESS;
+
+	c = gp_pixmap_alloc_ex(1024, 20, GP_PIXEL_xRGB8888, GP_PIXMAP_PAD_ROWS);
+
+	if (c == NULL) {
+		tst_msg("gp_pixmap_alloc_ex() failed");
+		return TST_FAILED;
+	}
+
+	if (c->bytes_per_row % GP_PIXMAP_ROW_ALIGNMENT ||
+	    !(c->bytes_per_row % GP_PIXMAP_CRITICAL_STRIDE) ||
+	    c->bytes_per_row < 4096) {
+		tst_msg("Wrong Pixmap->bytes_per_row %i", c->bytes_per_row);
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(c);
+
+	return ret;
+}
+
+static int pixmap_alloc_huge_pages(void)
+{
+	gp_pixmap *c, *copy = NULL, *small;
+	int ret = TST_SUCCESS;
+
+	c = gp_pixmap_alloc_ex(2048, 1024, GP_PIXEL_xRGB8888,
+	                       GP_PIXMAP_HUGE_PAGES | GP_PIXMAP_ALIGN_ROWS);
+	small = gp_pixmap_alloc_ex(100, 100, GP_PIXEL_xRGB8888,
+	                           GP_PIXMAP_HUGE_PAGES);
+
+	if (!c || !small) {
+		tst_msg("gp_pixmap_alloc_ex() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (!c->mmap_pixels || small->mmap_pixels) {
+		tst_msg("Wrong mmap_pixels %i %i", c->mmap_pixels, small->mmap_pixels);
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	memset(c->pixels, 0xaa, c->bytes_per_row * c->h);
+
+	copy = gp_pixmap_copy(c, GP_COPY_WITH_PIXELS);
+
+	if (!copy || !copy->mmap_pixels ||
+	    memcmp(copy->pixels, c->pixels, c->bytes_per_row * c->h)) {
+		tst_msg("Wrong pixmap copy");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (gp_pixmap_resize(c, 4096, 1024)) {
+		tst_msg("gp_pixmap_resize() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	memset(c->pixels, 0x55, c->bytes_per_row * c->h);
+
+exit:
+	gp_pixmap_free(c);
+	gp_pixmap_free(copy);
+	gp_pixmap_free(small);
+
+	return ret;
+}
+
+static int pixmap_mmap(void)
+{
+	gp_pixmap *c;
+	gp_coord x, y;
+
+	c = gp_pixmap_mmap("pixmap.gpx", 333, 111, GP_PIXEL_RGB888,
+	                   GP_PIXMAP_MMAP_CREATE);
+	if (!c) {
+		tst_msg("gp_pixmap_mmap(CREATE) failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (!c->mmap_pixels || !c->free_pixels) {
+		tst_msg("Wrong pixmap flags");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		for (x = 0; x < (gp_coord)c->w; x++)
+			gp_putpixel_raw(c, x, y, x * y);
+	}
+
+	gp_pixmap_free(c);
+
+	c = gp_pixmap_mmap("pixmap.gpx", 0, 0, GP_PIXEL_UNKNOWN,
+	                   GP_PIXMAP_MMAP_RDONLY);
+	if (!c) {
+		tst_msg("gp_pixmap_mmap() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (c->w != 333 || c->h != 111 || c->pixel_type != GP_PIXEL_RGB888 ||
+	    c->bytes_per_row != 3 * 333) {
+		tst_msg("Wrong pixmap %ux%u %s bpr %u", c->w, c->h,
+		        gp_pixel_type_name(c->pixel_type), c->bytes_per_row);
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	if (!gp_pixmap_resize(c, 100, 100) || errno != ENOTSUP) {
+		tst_msg("File backed pixmap resized");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		for (x = 0; x < (gp_coord)c->w; x++) {
+			gp_pixel p = gp_getpixel_raw(c, x, y);
+
+			if (p != (gp_pixel)(x * y)) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, (gp_pixel)(x * y));
+				gp_pixmap_free(c);
+				return TST_FAILED;
+			}
+		}
+	}
+
+	gp_pixmap_free(c);
+
+	return TST_SUCCESS;
+}
+
+static int pixmap_mmap_mismatch(void)
+{
+	gp_pixmap *c;
+
+	c = gp_pixmap_mmap("pixmap.gpx", 100, 100, GP_PIXEL_G8,
+	                   GP_PIXMAP_MMAP_CREATE);
+	if (!c) {
+		tst_msg("gp_pixmap_mmap(CREATE) failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	gp_pixmap_free(c);
+
+	c = gp_pixmap_mmap("pixmap.gpx", 100, 100, GP_PIXEL_RGB888, 0);
+	if (c) {
+		tst_msg("Pixel type mismatch not detected");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Expected EINVAL got %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	c = gp_pixmap_mmap("pixmap.gpx", 100, 101, GP_PIXEL_G8, 0);
+	if (c) {
+		tst_msg("Size mismatch not detected");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+/*
+ * Overwrites a 32 bit header field at the offset in the file.
+ */
+static int patch_header(const char *path, long offset, uint32_t val)
+{
+	FILE *f = fopen(path, "r+");
+	int ret;
+
+	if (!f)
+		return 1;
+
+	ret = fseek(f, offset, SEEK_SET) || fwrite(&val, sizeof(val), 1, f) != 1;
+
+	return fclose(f) || ret;
+}
+
+#define HEADER_W 16
+#define HEADER_BPR 24
+#define HEADER_BIT_ENDIAN 32
+
+static int pixmap_mmap_invalid(void)
+{
+	static const struct {
+		long offset;
+		uint32_t val;
+		const char *desc;
+	} patches[] = {
+		/* The row size in bits overflows 32 bits and wraps to 4 bytes */
+		{HEADER_W, 0x08000001, "width"},
+		{HEADER_BPR, 3, "bytes per row"},
+		{HEADER_BIT_ENDIAN, GP_BIT_ENDIAN_BE, "bit endian"},
+	};
+	unsigned int i;
+	gp_pixmap *c;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patches); i++) {
+		c = gp_pixmap_mmap("pixmap.gpx", 1, 1, GP_PIXEL_RGBA8888,
+		                   GP_PIXMAP_MMAP_CREATE);
+		if (!c) {
+			tst_msg("gp_pixmap_mmap(CREATE) failed: %s", strerror(errno));
+			return TST_FAILED;
+		}
+
+		gp_pixmap_free(c);
+
+		if (patch_header("pixmap.gpx", patches[i].offset, patches[i].val)) {
+			tst_msg("Failed to patch header: %s", strerror(errno));
+			return TST_UNTESTED;
+		}
+
+		c = gp_pixmap_mmap("pixmap.gpx", 0, 0, GP_PIXEL_UNKNOWN, 0);
+		if (c) {
+			tst_msg("Invalid %s not detected", patches[i].desc);
+			gp_pixmap_free(c);
+			return TST_FAILED;
+		}
+	}
+
+	c = gp_pixmap_mmap("pixmap.gpx", 0x40000001, 1, GP_PIXEL_RGBA8888,
+	                   GP_PIXMAP_MMAP_CREATE);
+	if (c) {
+		tst_msg("Row size overflow not detected");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	if (errno != EOVERFLOW) {
+		tst_msg("Expected EOVERFLOW got %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int pixmap_mmap_raw(void)
+{
+	gp_pixmap *c;
+	FILE *f;
+	int i;
+
+	f = fopen("pixmap.raw", "w");
+	if (!f) {
+		tst_msg("Failed to create file: %s", strerror(errno));
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < 20 * 10; i++)
+		fputc(i, f);
+
+	fclose(f);
+
+	c = gp_pixmap_mmap("pixmap.raw", 20, 11, GP_PIXEL_G8,
+	                   GP_PIXMAP_MMAP_RAW);
+	if (c) {
+		tst_msg("Too short file not detected");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	c = gp_pixmap_mmap("pixmap.raw", 20, 10, GP_PIXEL_G8,
+	                   GP_PIXMAP_MMAP_RAW);
+	if (!c) {
+		tst_msg("gp_pixmap_mmap(RAW) failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_getpixel_raw(c, 19, 9) != 199 || gp_getpixel_raw(c, 5, 1) != 25) {
+		tst_msg("Wrong pixel values");
+		gp_pixmap_free(c);
+		return TST_FAILED;
+	}
+
+	gp_putpixel_raw(c, 0, 0, 0xff);
+	gp_pixmap_free(c);
+
+	f = fopen("pixmap.raw", "r");
+	if (!f || fgetc(f) != 0xff) {
+		tst_msg("Pixel was not written to file");
+		if (f)
+			fclose(f);
+		return TST_FAILED;
+	}
+
+	fclose(f);
+
+	return TST_SUCCESS;
+}
+
+static int check_unchanged(gp_pixmap *c, gp_pixel val)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		for (x = 0; x < (gp_coord)c->w; x++) {
+			if (gp_getpixel_raw(c, x, y) != val) {
+				tst_msg("Shared pixmap modified at %ix%i", x, y);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+enum share_write {
+	SHARE_PUTPIXEL,
+	SHARE_FILL,
+	SHARE_BLIT,
+	SHARE_SUBPIXMAP,
+};
+
+static int pixmap_share_pixels(enum share_write how)
+{
+	gp_pixmap *c, *copy, *src = NULL, sub;
+	int ret = TST_FAILED;
+
+	c = gp_pixmap_alloc(100, 50, GP_PIXEL_RGB888);
+	if (!c) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	gp_fill(c, 0x102030);
+
+	copy = gp_pixmap_copy(c, GP_COPY_SHARE_PIXELS);
+	if (!copy) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(c);
+		return TST_UNTESTED;
+	}
+
+	if (copy->pixels != c->pixels) {
+		tst_msg("Pixels are not shared");
+		goto exit;
+	}
+
+	switch (how) {
+	case SHARE_PUTPIXEL:
+		gp_putpixel(copy, 10, 10, 0xffffff);
+	break;
+	case SHARE_FILL:
+		gp_fill(copy, 0xffffff);
+	break;
+	case SHARE_BLIT:
+		src = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+		if (!src) {
+			ret = TST_UNTESTED;
+			goto exit;
+		}
+		gp_fill(src, 0xffffff);
+		gp_blit(src, 0, 0, 10, 10, copy, 5, 5);
+	break;
+	case SHARE_SUBPIXMAP:
+		gp_sub_pixmap(copy, &sub, 10, 10, 20, 20);
+		gp_putpixel_raw(&sub, 0, 0, 0xffffff);
+	break;
+	}
+
+	if (copy->pixels == c->pixels) {
+		tst_msg("Pixels were not forked on write");
+		goto exit;
+	}
+
+	if (gp_getpixel_raw(copy, 10, 10) != 0xffffff) {
+		tst_msg("Pixel was not written");
+		goto exit;
+	}
+
+	if (gp_getpixel_raw(copy, 0, 0) != (how == SHARE_FILL ? 0xffffff : 0x102030)) {
+		tst_msg("Pixels were not copied on fork");
+		goto exit;
+	}
+
+	if (check_unchanged(c, 0x102030))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	/* The original is freed first, the copy must survive */
+	gp_pixmap_free(c);
+	gp_pixmap_free(copy);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int pixmap_share_last_owner(void)
+{
+	gp_pixmap *c, *copy;
+	uint8_t *pixels;
+	int ret = TST_FAILED;
+
+	c = gp_pixmap_alloc(33, 33, GP_PIXEL_G8);
+	copy = gp_pixmap_copy(c, GP_COPY_SHARE_PIXELS);
+	if (!c || !copy) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(c);
+		gp_pixmap_free(copy);
+		return TST_UNTESTED;
+	}
+
+	pixels = c->pixels;
+	gp_pixmap_free(copy);
+
+	/* Sole owner keeps the buffer on write */
+	gp_fill(c, 0xaa);
+
+	if (c->pixels != pixels) {
+		tst_msg("Pixels were reallocated for the last owner");
+		goto exit;
+	}
+
+	if (c->pixels_refs) {
+		tst_msg("Reference counter was not dropped");
+		goto exit;
+	}
+
+	if (check_unchanged(c, 0xaa))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(c);
+	return ret;
+}
+
+/*
+ * Pixmap with subpixmaps must not be shared, the subpixmaps would not follow
+ * the parent pixels once they are forked.
+ */
+static int pixmap_share_parent(void)
+{
+	gp_pixmap *c, *copy, sub;
+	int ret = TST_FAILED;
+
+	c = gp_pixmap_alloc(33, 33, GP_PIXEL_RGB888);
+	if (!c) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	gp_fill(c, 0);
+	gp_sub_pixmap(c, &sub, 4, 4, 10, 10);
+
+	copy = gp_pixmap_copy(c, GP_COPY_SHARE_PIXELS | GP_COPY_WITH_PIXELS);
+	if (!copy) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(c);
+		return TST_UNTESTED;
+	}
+
+	if (copy->pixels == c->pixels) {
+		tst_msg("Pixels with subpixmap shared");
+		goto exit;
+	}
+
+	gp_putpixel(&sub, 0, 0, 0xffffff);
+	gp_putpixel(c, 0, 0, 0xffffff);
+	gp_putpixel(&sub, 1, 1, 0xabcdef);
+
+	if (gp_getpixel(c, 4, 4) != 0xffffff ||
+	    gp_getpixel(c, 5, 5) != 0xabcdef) {
+		tst_msg("Subpixmap writes did not reach the parent");
+		goto exit;
+	}
+
+	if (check_unchanged(copy, 0))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(copy);
+	gp_pixmap_free(c);
+	return ret;
+}
+
+#define SHARE_THREADS 4
+
+static void *share_thread(void *arg)
+{
+	return gp_pixmap_copy(arg, GP_COPY_SHARE_PIXELS);
+}
+
+/*
+ * The source is const and may be shared from several threads at once, the
+ * reference counter must be allocated only once.
+ */
+static int pixmap_share_threads(void)
+{
+	pthread_t threads[SHARE_THREADS];
+	gp_pixmap *c, *copies[SHARE_THREADS];
+	unsigned int i, j, refs;
+	int ret = TST_SUCCESS;
+
+	for (i = 0; i < 100 && ret == TST_SUCCESS; i++) {
+		c = gp_pixmap_alloc(10, 10, GP_PIXEL_G8);
+		if (!c) {
+			tst_msg("Malloc failed :(");
+			return TST_UNTESTED;
+		}
+
+		for (j = 0; j < SHARE_THREADS; j++) {
+			if (pthread_create(&threads[j], NULL, share_thread, c))
+				threads[j] = pthread_self();
+		}
+
+		for (j = 0; j < SHARE_THREADS; j++) {
+			copies[j] = NULL;
+
+			if (pthread_equal(threads[j], pthread_self()))
+				copies[j] = gp_pixmap_copy(c, GP_COPY_SHARE_PIXELS);
+			else
+				pthread_join(threads[j], (void**)&copies[j]);
+
+			if (!copies[j]) {
+				tst_msg("gp_pixmap_copy() failed");
+				ret = TST_FAILED;
+			} else if (copies[j]->pixels_refs != c->pixels_refs) {
+				tst_msg("Copy %u has different reference counter", j);
+				ret = TST_FAILED;
+			}
+		}
+
+		refs = c->pixels_refs ? *c->pixels_refs : 0;
+
+		if (ret == TST_SUCCESS && refs != SHARE_THREADS + 1) {
+			tst_msg("Wrong reference count %u expected %u",
+			        refs, SHARE_THREADS + 1);
+			ret = TST_FAILED;
+		}
+
+		for (j = 0; j < SHARE_THREADS; j++)
+			gp_pixmap_free(copies[j]);
+
+		gp_pixmap_free(c);
+	}
+
+	return ret;
+}
+
+static int pixmap_share_not_owned(void)
+{
+	gp_pixmap *c, *copy, sub;
+	int ret = TST_FAILED;
+
+	c = gp_pixmap_alloc(33, 33, GP_PIXEL_G8);
+	if (!c) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	gp_fill(c, 0x11);
+	gp_sub_pixmap(c, &sub, 1, 1, 10, 10);
+
+	copy = gp_pixmap_copy(&sub, GP_COPY_SHARE_PIXELS);
+	if (!copy) {
+		tst_msg("Malloc failed :(");
+		gp_pixmap_free(c);
+		return TST_UNTESTED;
+	}
+
+	if (copy->pixels_refs || c->pixels_refs) {
+		tst_msg("Sub-pixmap pixels were shared");
+		goto exit;
+	}
+
+	if (check_unchanged(copy, 0x11))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(c);
+	gp_pixmap_free(copy);
+	return ret;
+}
+
+/*
+ * Each eight columns have the same value so that 8x8 blocks cover the whole
+ * dither matrix.
+ */
+static uint8_t dither_val(gp_coord x, unsigned int chan)
+{
+	switch (chan) {
+	case 'R':
+		return x / 8;
+	case 'G':
+		return 255 - x / 8;
+	case 'B':
+		return (x / 8) * 37;
+	default:
+		return (dither_val(x, 'R') + dither_val(x, 'G') + dither_val(x, 'B')) / 3;
+	}
+}
+
+static int check_dither_chan(gp_pixmap *dst, const gp_pixel_channel *chan)
+{
+	unsigned int max = (1u << chan->size) - 1;
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)dst->w; x += 8) {
+		unsigned int v = dither_val(x, chan->name[0]);
+		unsigned int lo = v * max / 255, hi = (v * max + 254) / 255;
+		int sum = 0;
+
+		for (y = 0; y < 8; y++) {
+			gp_coord i;
+
+			for (i = x; i < x + 8; i++) {
+				gp_pixel p = gp_getpixel_raw(dst, i, y);
+				unsigned int q = (p >> chan->offset) & max;
+
+				if (q < lo || q > hi) {
+					tst_msg("Channel %s value %u out of %u-%u for %u",
+					        chan->name, q, lo, hi, v);
+					return 1;
+				}
+
+				sum += q;
+			}
+		}
+
+		/* Block average has to match the value with 1/32 precision */
+		if (GP_ABS(sum * 255 - 64 * (int)(v * max)) > 64 * 255 / 32) {
+			tst_msg("Channel %s average %.2f expected %.2f",
+			        chan->name, sum / 64.0, v * max / 255.0);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int pixmap_convert_dither(gp_pixel_type type)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(type);
+	gp_pixmap *src, *dst;
+	gp_coord x, y;
+	unsigned int i;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(2048, 8, GP_PIXEL_RGB888);
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_putpixel_raw(src, x, y,
+			                GP_PIXEL_CREATE_RGB888(dither_val(x, 'R'),
+			                                       dither_val(x, 'G'),
+			                                       dither_val(x, 'B')));
+		}
+	}
+
+	dst = gp_pixmap_convert_alloc_ex(src, type, GP_CONVERT_DITHER);
+	if (!dst) {
+		tst_msg("gp_pixmap_convert_alloc_ex() failed");
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < desc->numchannels; i++) {
+		if (check_dither_chan(dst, &desc->channels[i]))
+			ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+
+	return ret;
+}
+
+/*
+ * The result does not depend on how the image was split between threads.
+ */
+static int pixmap_convert_dither_threads(gp_pixel_type type)
+{
+	gp_pixmap *src, *dst1, *dst4 = NULL;
+	gp_coord x, y;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(601, 301, GP_PIXEL_xRGB8888);
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < src->bytes_per_row * src->h; i++)
+		src->pixels[i] = i * 7 + i / 1000;
+
+	gp_nr_threads_set(1);
+	dst1 = gp_pixmap_convert_alloc_ex(src, type, GP_CONVERT_DITHER);
+	gp_nr_threads_set(4);
+	dst4 = gp_pixmap_convert_alloc_ex(src, type, GP_CONVERT_DITHER);
+	gp_nr_threads_set(0);
+
+	if (!dst1 || !dst4) {
+		tst_msg("gp_pixmap_convert_alloc_ex() failed");
+		goto exit;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel p1 = gp_getpixel_raw(dst1, x, y);
+			gp_pixel p4 = gp_getpixel_raw(dst4, x, y);
+
+			if (p1 != p4) {
+				tst_msg("Pixels at %ix%i differ %08"PRIx64" %08"PRIx64,
+				        x, y, p1, p4);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst1);
+	gp_pixmap_free(dst4);
+	return ret;
+}
+
+/*
+ * Conversion between the 16 bit per channel types must not lose precision.
+ */
+static int pixmap_convert_16bpc(void)
+{
+	gp_pixmap *src, *dst = NULL, *back = NULL;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(257, 3, GP_PIXEL_RGBA16161616);
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_putpixel_raw(src, x, y,
+			                GP_PIXEL_CREATE_RGBA16161616(x * 255 + y, x ^ 0x5555,
+			                                             65535 - x, 0xffff));
+		}
+	}
+
+	dst = gp_pixmap_convert_alloc(src, GP_PIXEL_RGB161616);
+	back = gp_pixmap_convert_alloc(dst, GP_PIXEL_RGBA16161616);
+	if (!dst || !back) {
+		tst_msg("gp_pixmap_convert_alloc() failed");
+		goto exit;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+			gp_pixel pb = gp_getpixel_raw(back, x, y);
+
+			if (p != pb) {
+				tst_msg("Pixels at %ix%i differ %016"PRIx64" %016"PRIx64,
+				        x, y, p, pb);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(back);
+	return ret;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Pixmap Testsuite",
 	.tests = {
@@ -282,6 +1107,90 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = pixmap_invalid_pixeltype1},
 		{.name = "Pixmap Create invalid pixel_type",
 		 .tst_fn = pixmap_invalid_pixeltype2},
+		{.name = "Pixmap Alloc aligned rows",
+		 .tst_fn = pixmap_alloc_aligned,
+		 .data = (void*)GP_PIXMAP_ALIGN_ROWS},
+		{.name = "Pixmap Alloc padded rows",
+		 .tst_fn = pixmap_alloc_aligned,
+		 .data = (void*)GP_PIXMAP_PAD_ROWS},
+		{.name = "Pixmap Alloc padded critical stride",
+		 .tst_fn = pixmap_alloc_padded},
+		{.name = "Pixmap Alloc huge pages",
+		 .tst_fn = pixmap_alloc_huge_pages},
+		{.name = "Pixmap mmap",
+		 .tst_fn = pixmap_mmap,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+		{.name = "Pixmap mmap mismatch",
+		 .tst_fn = pixmap_mmap_mismatch,
+		 .flags = TST_TMPDIR},
+		{.name = "Pixmap mmap invalid header",
+		 .tst_fn = pixmap_mmap_invalid,
+		 .flags = TST_TMPDIR},
+		{.name = "Pixmap mmap raw",
+		 .tst_fn = pixmap_mmap_raw,
+		 .flags = TST_TMPDIR},
+		{.name = "Pixmap share pixels putpixel",
+		 .tst_fn = pixmap_share_pixels,
+		 .data = (void*)SHARE_PUTPIXEL,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap share pixels fill",
+		 .tst_fn = pixmap_share_pixels,
+		 .data = (void*)SHARE_FILL,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap share pixels blit",
+		 .tst_fn = pixmap_share_pixels,
+		 .data = (void*)SHARE_BLIT,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap share pixels sub-pixmap",
+		 .tst_fn = pixmap_share_pixels,
+		 .data = (void*)SHARE_SUBPIXMAP,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap share pixels last owner",
+		 .tst_fn = pixmap_share_last_owner,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap share pixels with subpixmap",
+		 .tst_fn = pixmap_share_parent},
+		{.name = "Pixmap share pixels from threads",
+		 .tst_fn = pixmap_share_threads},
+		{.name = "Pixmap share not owned pixels",
+		 .tst_fn = pixmap_share_not_owned,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither RGB565",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_RGB565,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither RGB555",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither RGB332",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither RGB666",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither G1",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_G1,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither G2",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_G2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither G4",
+		 .tst_fn = pixmap_convert_dither,
+		 .data = (void*)GP_PIXEL_G4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap convert dither RGB565 threads",
+		 .tst_fn = pixmap_convert_dither_threads,
+		 .data = (void*)GP_PIXEL_RGB565},
+		{.name = "Pixmap convert dither G1 threads",
+		 .tst_fn = pixmap_convert_dither_threads,
+		 .data = (void*)GP_PIXEL_G1},
+		{.name = "Pixmap convert 16 bits per channel",
+		 .tst_fn = pixmap_convert_16bpc, .flags = TST_CHECK_MALLOC},
 		{.name = NULL},
 	}
 };
@@ -0,0 +1,345 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Pixmap pool tests.
+
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixmap_pool.h>
+
+#include "tst_test.h"
+#include "tst_preload.h"
+
+static int pool_reuse(void)
+{
+	gp_pixmap_pool *pool = gp_pixmap_pool_create(1024 * 1024);
+	struct malloc_stats stats;
+	gp_pixmap *p;
+	uint8_t *pixels;
+	unsigned int chunks, i;
+	int ret = TST_FAILED;
+
+	if (!pool) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	p = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_RGB888, 0);
+	if (!p) {
+		tst_msg("gp_pixmap_pool_alloc() failed");
+		goto exit;
+	}
+
+	pixels = p->pixels;
+	gp_pixmap_set_rotation(p, 1, 0, 1);
+	gp_pixmap_free(p);
+
+	tst_malloc_check_report(&stats);
+	chunks = stats.total_chunks;
+
+	for (i = 0; i < 10; i++) {
+		p = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_RGB888, 0);
+
+		if (!p || p->pixels != pixels) {
+			tst_msg("Pixmap was not reused");
+			gp_pixmap_free(p);
+			goto exit;
+		}
+
+		if (p->axes_swap || p->y_swap) {
+			tst_msg("Rotation flags were not reset");
+			gp_pixmap_free(p);
+			goto exit;
+		}
+
+		gp_pixmap_free(p);
+	}
+
+	tst_malloc_check_report(&stats);
+
+	if (stats.total_chunks != chunks) {
+		tst_msg("Steady state allocated %u chunks",
+		        stats.total_chunks - chunks);
+		goto exit;
+	}
+
+	if (pool->hits != 10 || pool->misses != 1) {
+		tst_msg("Wrong pool stats hits %lu misses %lu",
+		        pool->hits, pool->misses);
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_pool_destroy(pool);
+	return ret;
+}
+
+static int pool_key(void)
+{
+	gp_pixmap_pool *pool = gp_pixmap_pool_create(1024 * 1024);
+	gp_pixmap *p, *c;
+	int ret = TST_FAILED;
+
+	if (!pool) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	p = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_RGB888, 0);
+	if (!p) {
+		tst_msg("gp_pixmap_pool_alloc() failed");
+		goto exit;
+	}
+
+	gp_pixmap_free(p);
+
+	c = gp_pixmap_pool_alloc(pool, 100, 101, GP_PIXEL_RGB888, 0);
+	gp_pixmap_free(c);
+	c = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_BGR888, 0);
+	gp_pixmap_free(c);
+	c = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_RGB888, GP_PIXMAP_PAD_ROWS);
+	gp_pixmap_free(c);
+
+	if (pool->hits) {
+		tst_msg("Pixmap with different parameters was reused");
+		goto exit;
+	}
+
+	if (pool->cached_cnt != 4) {
+		tst_msg("Wrong number of cached pixmaps %u", pool->cached_cnt);
+		goto exit;
+	}
+
+	c = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_RGB888, GP_PIXMAP_PAD_ROWS);
+
+	if (!c || (uintptr_t)c->pixels % GP_PIXMAP_ROW_ALIGNMENT) {
+		tst_msg("Wrong pixmap reused for aligned rows");
+		gp_pixmap_free(c);
+		goto exit;
+	}
+
+	gp_pixmap_free(c);
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_pool_destroy(pool);
+	return ret;
+}
+
+static int pool_max_size(void)
+{
+	gp_pixmap_pool *pool = gp_pixmap_pool_create(2 * 100 * 100);
+	gp_pixmap *p[4];
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	if (!pool) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < 4; i++) {
+		p[i] = gp_pixmap_pool_alloc(pool, 100, 100, GP_PIXEL_G8, 0);
+		if (!p[i]) {
+			tst_msg("gp_pixmap_pool_alloc() failed");
+			goto exit;
+		}
+	}
+
+	for (i = 0; i < 4; i++)
+		gp_pixmap_free(p[i]);
+
+	if (pool->cached_cnt != 2 || pool->size != 2 * 100 * 100) {
+		tst_msg("Cached %u pixmaps size %zu",
+		        pool->cached_cnt, pool->size);
+		goto exit;
+	}
+
+	/* Least recently freed are evicted */
+	if (pool->cached[0] != p[2] || pool->cached[1] != p[3]) {
+		tst_msg("Wrong pixmaps evicted");
+		goto exit;
+	}
+
+	/* Bigger than the pool limit */
+	p[0] = gp_pixmap_pool_alloc(pool, 1000, 100, GP_PIXEL_G8, 0);
+	gp_pixmap_free(p[0]);
+
+	if (pool->cached_cnt != 2) {
+		tst_msg("Pixmap over the size limit was cached");
+		goto exit;
+	}
+
+	gp_pixmap_pool_flush(pool);
+
+	if (pool->cached_cnt || pool->size) {
+		tst_msg("Pool was not flushed");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_pool_destroy(pool);
+	return ret;
+}
+
+static int pool_default(void)
+{
+	gp_pixmap_pool *pool = gp_pixmap_pool_create(1024 * 1024);
+	gp_pixmap *p, *c;
+	int ret = TST_FAILED;
+
+	if (!pool) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	if (gp_pixmap_pool_set_default(pool)) {
+		tst_msg("Default pool was set");
+		goto exit;
+	}
+
+	p = gp_pixmap_alloc(64, 64, GP_PIXEL_RGB565);
+	c = gp_pixmap_copy(p, GP_COPY_WITH_PIXELS);
+
+	if (!p || !c || p->pool != pool || c->pool != pool) {
+		tst_msg("Pixmaps not allocated from the default pool");
+		gp_pixmap_free(p);
+		gp_pixmap_free(c);
+		goto exit;
+	}
+
+	gp_pixmap_free(c);
+	c = gp_pixmap_copy(p, 0);
+	gp_pixmap_free(c);
+
+	if (pool->hits != 1) {
+		tst_msg("Copy was not reused");
+		gp_pixmap_free(p);
+		goto exit;
+	}
+
+	if (gp_pixmap_pool_set_default(NULL) != pool) {
+		tst_msg("Wrong previous default pool");
+		gp_pixmap_free(p);
+		goto exit;
+	}
+
+	c = gp_pixmap_alloc(64, 64, GP_PIXEL_RGB565);
+	if (!c || c->pool) {
+		tst_msg("Pixmap allocated from unset default pool");
+		gp_pixmap_free(c);
+		gp_pixmap_free(p);
+		goto exit;
+	}
+
+	gp_pixmap_free(c);
+
+	/* The pool is freed with the last pixmap */
+	gp_pixmap_pool_destroy(pool);
+	gp_pixmap_free(p);
+
+	return TST_SUCCESS;
+exit:
+	gp_pixmap_pool_set_default(NULL);
+	gp_pixmap_pool_destroy(pool);
+	return ret;
+}
+
+struct destroy_data {
+	gp_pixmap_pool *pool;
+	sem_t set;
+	sem_t destroyed;
+	int ret;
+};
+
+static void *destroy_thread(void *arg)
+{
+	struct destroy_data *data = arg;
+	gp_pixmap *p;
+
+	gp_pixmap_pool_set_default(data->pool);
+	sem_post(&data->set);
+	sem_wait(&data->destroyed);
+
+	p = gp_pixmap_alloc(64, 64, GP_PIXEL_RGB565);
+	if (!p) {
+		tst_msg("gp_pixmap_alloc() failed");
+		return NULL;
+	}
+
+	gp_pixmap_free(p);
+
+	if (gp_pixmap_pool_set_default(NULL)) {
+		tst_msg("Destroyed pool was not freed");
+		return NULL;
+	}
+
+	data->ret = TST_SUCCESS;
+	return NULL;
+}
+
+static int pool_destroy_default(void)
+{
+	struct destroy_data data = {.ret = TST_FAILED};
+	pthread_t thread;
+
+	data.pool = gp_pixmap_pool_create(1024 * 1024);
+	if (!data.pool) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	sem_init(&data.set, 0, 0);
+	sem_init(&data.destroyed, 0, 0);
+
+	if (pthread_create(&thread, NULL, destroy_thread, &data)) {
+		tst_msg("pthread_create() failed");
+		gp_pixmap_pool_destroy(data.pool);
+		return TST_UNTESTED;
+	}
+
+	/* Destroy the pool while it's a default pool in the other thread */
+	sem_wait(&data.set);
+	gp_pixmap_pool_destroy(data.pool);
+	sem_post(&data.destroyed);
+
+	pthread_join(thread, NULL);
+
+	sem_destroy(&data.set);
+	sem_destroy(&data.destroyed);
+
+	return data.ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Pixmap pool testsuite",
+	.tests = {
+		{.name = "Pixmap pool reuse",
+		 .tst_fn = pool_reuse,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap pool key",
+		 .tst_fn = pool_key,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap pool max size",
+		 .tst_fn = pool_max_size,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap pool default",
+		 .tst_fn = pool_default,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Pixmap pool destroy default",
+		 .tst_fn = pool_destroy_default,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = NULL},
+	}
+};
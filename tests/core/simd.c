@@ -0,0 +1,470 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Checks that the runtime dispatched SIMD variants of the generated kernels
+  produce the same results as the generic ones.
+
+  The variant is selected once per process, so the checks run in child
+  processes with different GP_SIMD values and the parent compares checksums
+  of the results.
+
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_blit.h>
+#include <core/gp_gamma_linear.h>
+#include <core/gp_pixel_row.h>
+#include <core/gp_yuv.h>
+#include <core/gp_cpu.h>
+#include <filters/gp_filters.h>
+
+#include "tst_test.h"
+#include "blit.h"
+
+/* Odd width so that the vector loops have a remainder */
+#define W 67
+#define H 13
+
+/* FNV-1a */
+#define HASH_INIT 0xcbf29ce484222325
+
+static uint64_t hash_buf(uint64_t hash, const void *buf, size_t len)
+{
+	const uint8_t *b = buf;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash ^= b[i];
+		hash *= 0x100000001b3;
+	}
+
+	return hash;
+}
+
+/* Hashes pixel values only, padding bits are not initialized */
+static uint64_t hash_pixmap(uint64_t hash, const gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++) {
+			gp_pixel p = gp_getpixel_raw(pixmap, x, y);
+
+			hash = hash_buf(hash, &p, sizeof(p));
+		}
+	}
+
+	return hash;
+}
+
+static void fill_random(void *buf, size_t len)
+{
+	uint8_t *b = buf;
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		b[i] = random();
+}
+
+static uint64_t check_convert_rows(void)
+{
+	uint8_t src[W * 8], dst[W * 8];
+	uint64_t hash = HASH_INIT;
+	gp_pixel_type s, d;
+
+	for (s = 1; s < GP_PIXEL_MAX; s++) {
+		for (d = 1; d < GP_PIXEL_MAX; d++) {
+			gp_convert_row_fn convert = gp_convert_row_get(s, d);
+			gp_convert_row_fn blend = gp_blend_row_get(s, d);
+			size_t len = W * gp_pixel_size(d) / 8;
+
+			if (convert) {
+				fill_random(src, sizeof(src));
+				memset(dst, 0, sizeof(dst));
+				convert(dst, src, W);
+				hash = hash_buf(hash, dst, len);
+			}
+
+			if (blend) {
+				fill_random(src, sizeof(src));
+				fill_random(dst, sizeof(dst));
+				blend(dst, src, W);
+				hash = hash_buf(hash, dst, len);
+			}
+		}
+	}
+
+	return hash;
+}
+
+static uint64_t check_dither_rows(void)
+{
+	uint64_t hash = HASH_INIT;
+	uint32_t src[W];
+	gp_pixel_type d;
+	gp_coord y;
+
+	for (d = 1; d < GP_PIXEL_MAX; d++) {
+		gp_dither_row_fn dither = gp_dither_row_get(d);
+		gp_pixmap *dst;
+
+		if (!dither)
+			continue;
+
+		dst = gp_pixmap_alloc(W + 3, H, d);
+		if (!dst)
+			return 0;
+
+		for (y = 0; y < H; y++) {
+			fill_random(src, sizeof(src));
+			dither(dst, y % 3, y, src, W);
+		}
+
+		hash = hash_pixmap(hash, dst);
+		gp_pixmap_free(dst);
+	}
+
+	return hash;
+}
+
+static uint64_t check_pixel_rows(void)
+{
+	uint64_t hash = HASH_INIT;
+	int bufs[GP_PIXELTYPE_MAX_CHANNELS][W];
+	int *chans[GP_PIXELTYPE_MAX_CHANNELS];
+	gp_pixel_type t;
+	unsigned int c;
+	gp_coord y;
+
+	for (c = 0; c < GP_PIXELTYPE_MAX_CHANNELS; c++)
+		chans[c] = bufs[c];
+
+	for (t = 1; t < GP_PIXEL_MAX; t++) {
+		gp_pixmap *src = alloc_random(W, H, t, 0);
+		gp_pixmap *dst = gp_pixmap_alloc(W, H, t);
+
+		if (!src || !dst) {
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			return 0;
+		}
+
+		for (y = 0; y < H; y++) {
+			memset(bufs, 0, sizeof(bufs));
+			gp_pixel_row_unpack(src, 0, y, W, chans);
+			hash = hash_buf(hash, bufs, sizeof(bufs));
+			gp_pixel_row_pack(dst, 0, y, W, chans);
+		}
+
+		hash = hash_pixmap(hash, dst);
+
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+	}
+
+	return hash;
+}
+
+static uint64_t check_gamma_linear(void)
+{
+	static const gp_pixel_type types[] = {
+		GP_PIXEL_G8, GP_PIXEL_RGB565, GP_PIXEL_RGB888, GP_PIXEL_RGBA8888,
+	};
+	uint64_t hash = HASH_INIT;
+	unsigned int i, c;
+
+	for (i = 0; i < GP_ARRAY_SIZE(types); i++) {
+		gp_pixmap *src = alloc_random(W, H, types[i], 0);
+		gp_pixmap *dst = gp_pixmap_alloc(W, H, types[i]);
+		gp_linear_pixmap *lin = NULL;
+
+		if (src && dst)
+			lin = gp_pixmap_to_linear_alloc(src, NULL);
+
+		if (!lin || gp_pixmap_from_linear(lin, dst, NULL)) {
+			gp_linear_pixmap_free(lin);
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			return 0;
+		}
+
+		for (c = 0; c < lin->chan_cnt; c++) {
+			hash = hash_buf(hash, lin->chans[c],
+			                sizeof(uint16_t) * lin->w * lin->h);
+		}
+
+		hash = hash_pixmap(hash, dst);
+
+		gp_linear_pixmap_free(lin);
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+	}
+
+	return hash;
+}
+
+static uint64_t check_yuv(void)
+{
+	static const gp_pixel_type types[] = {
+		GP_PIXEL_RGB888, GP_PIXEL_BGR888, GP_PIXEL_xRGB8888,
+	};
+	uint64_t hash = HASH_INIT;
+	enum gp_yuv_format f;
+	unsigned int i;
+
+	for (f = 0; f < GP_YUV_MAX; f++) {
+		/* Even size for the subsampled formats */
+		gp_yuv_frame *frame = gp_yuv_frame_alloc(W + 1, H + 1, f);
+		gp_pixmap *rgb = alloc_random(W + 1, H + 1, GP_PIXEL_RGB888, 0);
+
+		if (!frame || !rgb)
+			goto err;
+
+		fill_random(frame->planes[0].pixels,
+		            gp_yuv_frame_size(W + 1, H + 1, f, 0));
+
+		for (i = 0; i < GP_ARRAY_SIZE(types); i++) {
+			gp_pixmap *res = gp_yuv_frame_to_pixmap_alloc(frame, types[i], NULL);
+
+			if (!res)
+				goto err;
+
+			hash = hash_pixmap(hash, res);
+			gp_pixmap_free(res);
+		}
+
+		if (gp_pixmap_to_yuv_frame(rgb, frame, NULL))
+			goto err;
+
+		hash = hash_buf(hash, frame->planes[0].pixels,
+		                gp_yuv_frame_size(W + 1, H + 1, f, 0));
+
+		gp_pixmap_free(rgb);
+		gp_yuv_frame_free(frame);
+		continue;
+err:
+		gp_pixmap_free(rgb);
+		gp_yuv_frame_free(frame);
+		return 0;
+	}
+
+	return hash;
+}
+
+static uint64_t check_blits(void)
+{
+	static const gp_pixel_type types[] = {
+		GP_PIXEL_G1, GP_PIXEL_G4, GP_PIXEL_G8, GP_PIXEL_RGB565,
+		GP_PIXEL_RGB888, GP_PIXEL_xRGB8888,
+	};
+	uint64_t hash = HASH_INIT;
+	unsigned int i;
+	int flags;
+
+	for (i = 0; i < GP_ARRAY_SIZE(types); i++) {
+		for (flags = 0; flags < 8; flags++) {
+			gp_pixmap *src = alloc_random(W, H, types[i], 0);
+			gp_pixmap *dst = alloc_random(W + 9, H, types[i], flags);
+			gp_pixmap *mask = alloc_random(W, H, GP_PIXEL_G1, 0);
+
+			if (!src || !dst || !mask) {
+				gp_pixmap_free(src);
+				gp_pixmap_free(dst);
+				gp_pixmap_free(mask);
+				return 0;
+			}
+
+			/* Odd offsets for the sub-byte shifted blits */
+			gp_blit_xywh(src, 1, 0, W - 1, H, dst, 3 + flags, 0);
+			hash = hash_pixmap(hash, dst);
+
+			gp_blit_colorkey(src, 0, 0, W, H, dst, 5, 0,
+			                 gp_getpixel_raw(src, 0, 0));
+			hash = hash_pixmap(hash, dst);
+
+			gp_blit_masked(src, 0, 0, W, H, dst, 7, 0, mask);
+			hash = hash_pixmap(hash, dst);
+
+			gp_pixmap_free(src);
+			gp_pixmap_free(dst);
+			gp_pixmap_free(mask);
+		}
+	}
+
+	return hash;
+}
+
+static uint64_t check_convolution(void)
+{
+	uint64_t hash = HASH_INIT;
+	gp_pixmap *src, *res;
+
+	src = alloc_random(W, H, GP_PIXEL_RGB888, 0);
+	if (!src)
+		return 0;
+
+	res = gp_filter_gaussian_blur_alloc(src, 2, 2, NULL);
+	if (!res) {
+		gp_pixmap_free(src);
+		return 0;
+	}
+
+	hash = hash_pixmap(hash, res);
+
+	gp_pixmap_free(res);
+	gp_pixmap_free(src);
+
+	return hash;
+}
+
+static const struct check {
+	const char *name;
+	uint64_t (*fn)(void);
+} checks[] = {
+	{"convert and blend rows", check_convert_rows},
+	{"dither rows", check_dither_rows},
+	{"pixel rows", check_pixel_rows},
+	{"gamma linear", check_gamma_linear},
+	{"yuv", check_yuv},
+	{"blits", check_blits},
+	{"convolution", check_convolution},
+};
+
+#define NR_CHECKS GP_ARRAY_SIZE(checks)
+
+struct results {
+	unsigned int flags;
+	uint64_t hashes[NR_CHECKS];
+};
+
+/*
+ * Runs all checks in a child process with GP_SIMD set to simd, or unset if
+ * simd is NULL. Zero hash means that the check failed to allocate memory.
+ */
+static int run_checks(const char *simd, struct results *res)
+{
+	int fds[2], status;
+	unsigned int i;
+	ssize_t len;
+	pid_t pid;
+
+	if (pipe(fds)) {
+		tst_msg("pipe() failed: %s", tst_strerr(errno));
+		return 1;
+	}
+
+	pid = fork();
+	if (pid < 0) {
+		tst_msg("fork() failed: %s", tst_strerr(errno));
+		close(fds[0]);
+		close(fds[1]);
+		return 1;
+	}
+
+	if (!pid) {
+		close(fds[0]);
+
+		if (simd)
+			setenv("GP_SIMD", simd, 1);
+		else
+			unsetenv("GP_SIMD");
+
+		/* Same input data in all children */
+		srandom(42);
+
+		res->flags = gp_cpu_flags();
+
+		for (i = 0; i < NR_CHECKS; i++)
+			res->hashes[i] = checks[i].fn();
+
+		len = write(fds[1], res, sizeof(*res));
+		_exit(len != sizeof(*res));
+	}
+
+	close(fds[1]);
+	len = read(fds[0], res, sizeof(*res));
+	close(fds[0]);
+
+	if (waitpid(pid, &status, 0) < 0) {
+		tst_msg("waitpid() failed: %s", tst_strerr(errno));
+		return 1;
+	}
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) || len != sizeof(*res)) {
+		tst_msg("Child with GP_SIMD=%s failed", simd ? simd : "unset");
+		return 1;
+	}
+
+	for (i = 0; i < NR_CHECKS; i++) {
+		if (!res->hashes[i]) {
+			tst_msg("Check %s failed with GP_SIMD=%s",
+			        checks[i].name, simd ? simd : "unset");
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int simd_variants(void)
+{
+	static const char *variants[] = {NULL, "sse2", "avx2", "neon"};
+	struct results generic, res;
+	unsigned int i, j, tested = 0;
+	int ret = TST_SUCCESS;
+
+	if (run_checks("0", &generic))
+		return TST_UNTESTED;
+
+	for (i = 0; i < GP_ARRAY_SIZE(variants); i++) {
+		const char *name = variants[i] ? variants[i] : "default";
+
+		if (run_checks(variants[i], &res))
+			return TST_UNTESTED;
+
+		if (!res.flags) {
+			tst_msg("Variant %s not supported by CPU", name);
+			continue;
+		}
+
+		tested++;
+
+		for (j = 0; j < NR_CHECKS; j++) {
+			if (res.hashes[j] != generic.hashes[j]) {
+				tst_msg("Check %s differs for %s variant",
+				        checks[j].name, name);
+				ret = TST_FAILED;
+			}
+		}
+	}
+
+	if (!tested) {
+		tst_msg("No SIMD variants supported");
+		return TST_SKIPPED;
+	}
+
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "SIMD testsuite",
+	.tests = {
+		{.name = "SIMD variants match generic",
+		 .tst_fn = simd_variants},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,767 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <core/gp_threads.h>
+#include "tst_test.h"
+
+#define NR_JOBS 16
+
+static int job_count(void *arg)
+{
+	int *cnt = arg;
+
+	(*cnt)++;
+
+	return 0;
+}
+
+static int thread_pool_run(void)
+{
+	gp_thread_job jobs[NR_JOBS];
+	int cnts[NR_JOBS] = {};
+	int i, ret = TST_SUCCESS;
+
+	for (i = 0; i < NR_JOBS; i++) {
+		jobs[i].fn = job_count;
+		jobs[i].arg = &cnts[i];
+	}
+
+	if (gp_thread_pool_run(jobs, NR_JOBS)) {
+		tst_msg("gp_thread_pool_run() failed");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < NR_JOBS; i++) {
+		if (cnts[i] != 1) {
+			tst_msg("Job %i executed %i times", i, cnts[i]);
+			ret = TST_FAILED;
+		}
+	}
+
+	return ret;
+}
+
+static int job_fail(void *arg)
+{
+	errno = *(int*)arg;
+
+	return *(int*)arg ? 1 : 0;
+}
+
+static int thread_pool_err(void)
+{
+	gp_thread_job jobs[NR_JOBS];
+	int errs[NR_JOBS] = {};
+	int i;
+
+	errs[NR_JOBS/2] = ENOMEM;
+
+	for (i = 0; i < NR_JOBS; i++) {
+		jobs[i].fn = job_fail;
+		jobs[i].arg = &errs[i];
+	}
+
+	if (!gp_thread_pool_run(jobs, NR_JOBS)) {
+		tst_msg("gp_thread_pool_run() succeeded");
+		return TST_FAILED;
+	}
+
+	if (errno != ENOMEM) {
+		tst_msg("Wrong errno %s expected ENOMEM", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int job_nested(void *arg)
+{
+	gp_thread_job jobs[NR_JOBS];
+	int *cnts = arg;
+	int i;
+
+	for (i = 0; i < NR_JOBS; i++) {
+		jobs[i].fn = job_count;
+		jobs[i].arg = &cnts[i];
+	}
+
+	return gp_thread_pool_run(jobs, NR_JOBS);
+}
+
+static int thread_pool_nested(void)
+{
+	gp_thread_job jobs[NR_JOBS];
+	int cnts[NR_JOBS][NR_JOBS] = {};
+	int i, j, ret = TST_SUCCESS;
+
+	for (i = 0; i < NR_JOBS; i++) {
+		jobs[i].fn = job_nested;
+		jobs[i].arg = cnts[i];
+	}
+
+	if (gp_thread_pool_run(jobs, NR_JOBS)) {
+		tst_msg("gp_thread_pool_run() failed");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < NR_JOBS; i++) {
+		for (j = 0; j < NR_JOBS; j++) {
+			if (cnts[i][j] != 1) {
+				tst_msg("Job %i:%i executed %i times",
+				        i, j, cnts[i][j]);
+				ret = TST_FAILED;
+			}
+		}
+	}
+
+	return ret;
+}
+
+static int job_self(void *arg)
+{
+	pthread_t *self = arg;
+
+	*self = pthread_self();
+	usleep(1000);
+
+	return 0;
+}
+
+static int pool_threads(unsigned int nr)
+{
+	gp_thread_job jobs[NR_JOBS];
+	pthread_t selfs[NR_JOBS];
+	unsigned int i, j, max, cnt = 0;
+
+	gp_nr_threads_set(nr);
+
+	/* The GP_THREADS enviroment variable takes precedence */
+	max = gp_nr_threads(1024, 1024, NULL);
+
+	for (i = 0; i < NR_JOBS; i++) {
+		jobs[i].fn = job_self;
+		jobs[i].arg = &selfs[i];
+	}
+
+	if (gp_thread_pool_run(jobs, NR_JOBS)) {
+		tst_msg("gp_thread_pool_run() failed");
+		return 1;
+	}
+
+	for (i = 0; i < NR_JOBS; i++) {
+		for (j = 0; j < i; j++) {
+			if (pthread_equal(selfs[i], selfs[j]))
+				break;
+		}
+
+		if (j == i)
+			cnt++;
+	}
+
+	if (cnt > max) {
+		tst_msg("Jobs executed by %u threads expected at most %u",
+		        cnt, max);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int thread_pool_limit(void)
+{
+	int ret = TST_SUCCESS;
+
+	if (pool_threads(4) || pool_threads(2) || pool_threads(1))
+		ret = TST_FAILED;
+
+	gp_nr_threads_set(0);
+
+	return ret;
+}
+
+static int progress_nop(gp_progress_cb *self)
+{
+	(void) self;
+
+	return 0;
+}
+
+struct tiles_check {
+	gp_size w, h;
+	gp_size min_w, min_h;
+	/* Per pixel visit counters */
+	unsigned int *cnts;
+	unsigned int bad_tiles;
+};
+
+static int tile_count(const gp_tile *tile, void *priv, gp_progress_cb *callback)
+{
+	struct tiles_check *check = priv;
+	gp_coord x, y;
+
+	(void) callback;
+
+	if (tile->x < 0 || tile->y < 0 || !tile->w || !tile->h ||
+	    tile->x + tile->w > check->w || tile->y + tile->h > check->h) {
+		__atomic_add_fetch(&check->bad_tiles, 1, __ATOMIC_RELAXED);
+		return 0;
+	}
+
+	/* Only tiles at the right and bottom edge may be smaller */
+	if ((tile->w < check->min_w && tile->x + tile->w != check->w) ||
+	    (tile->h < check->min_h && tile->y + tile->h != check->h))
+		__atomic_add_fetch(&check->bad_tiles, 1, __ATOMIC_RELAXED);
+
+	for (y = tile->y; y < (gp_coord)(tile->y + tile->h); y++) {
+		for (x = tile->x; x < (gp_coord)(tile->x + tile->w); x++) {
+			__atomic_add_fetch(&check->cnts[y * check->w + x], 1,
+			                   __ATOMIC_RELAXED);
+		}
+	}
+
+	return 0;
+}
+
+static int tiles_check(gp_size w, gp_size h, gp_size min_w, gp_size min_h,
+                       unsigned int threads)
+{
+	GP_PROGRESS_CALLBACK(callback, progress_nop, NULL);
+	struct tiles_check check = {
+		.w = w,
+		.h = h,
+		.min_w = min_w,
+		.min_h = min_h,
+	};
+	gp_tiles tiles = {
+		.w = w,
+		.h = h,
+		.bpp = 32,
+		.min_w = min_w,
+		.min_h = min_h,
+		.fn = tile_count,
+		.priv = &check,
+		.callback = &callback,
+	};
+	size_t i;
+	int ret = 0;
+
+	callback.threads = threads;
+
+	check.cnts = calloc((size_t)w * h, sizeof(*check.cnts));
+	if (!check.cnts) {
+		tst_msg("Malloc failed :(");
+		return 1;
+	}
+
+	if (gp_tiles_run(&tiles)) {
+		tst_msg("gp_tiles_run() failed %s", tst_strerr(errno));
+		ret = 1;
+		goto exit;
+	}
+
+	if (check.bad_tiles) {
+		tst_msg("%ux%u min %ux%u threads %u: %u tiles out of bounds or too small",
+		        w, h, min_w, min_h, threads, check.bad_tiles);
+		ret = 1;
+	}
+
+	for (i = 0; i < (size_t)w * h; i++) {
+		if (check.cnts[i] != 1) {
+			tst_msg("%ux%u threads %u: pixel %zu,%zu visited %u times",
+			        w, h, threads, i % w, i / w, check.cnts[i]);
+			ret = 1;
+			break;
+		}
+	}
+
+exit:
+	free(check.cnts);
+	return ret;
+}
+
+static int tiles_run(void)
+{
+	static const gp_size sizes[][2] = {
+		{1, 1}, {97, 53}, {640, 480}, {5000, 7}, {3, 2000},
+	};
+	static const unsigned int threads[] = {1, 2, 4, 7};
+	unsigned int i, j;
+	int ret = TST_SUCCESS;
+
+	for (i = 0; i < GP_ARRAY_SIZE(sizes); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(threads); j++) {
+			if (tiles_check(sizes[i][0], sizes[i][1], 0, 0, threads[j]))
+				ret = TST_FAILED;
+		}
+	}
+
+	gp_nr_threads_set(0);
+
+	return ret;
+}
+
+static int tiles_min_size(void)
+{
+	int ret = TST_SUCCESS;
+
+	if (tiles_check(640, 480, 200, 100, 4) ||
+	    tiles_check(640, 480, 640, 1, 7) ||
+	    tiles_check(97, 301, 1, 97, 4) ||
+	    tiles_check(100, 100, 1000, 1000, 4))
+		ret = TST_FAILED;
+
+	gp_nr_threads_set(0);
+
+	return ret;
+}
+
+#define STEAL_THREADS 4
+
+struct tiles_steal {
+	gp_size h;
+	/* Threads that processed the expensive tiles */
+	pthread_t selfs[64];
+	unsigned int nr_selfs;
+	unsigned int pixels;
+};
+
+static int tile_uneven(const gp_tile *tile, void *priv, gp_progress_cb *callback)
+{
+	struct tiles_steal *steal = priv;
+	unsigned int i;
+
+	(void) callback;
+
+	__atomic_add_fetch(&steal->pixels, tile->w * tile->h, __ATOMIC_RELAXED);
+
+	/* Tiles from the first thread range are expensive */
+	if (tile->y >= (gp_coord)(steal->h / STEAL_THREADS))
+		return 0;
+
+	usleep(20000);
+
+	i = __atomic_fetch_add(&steal->nr_selfs, 1, __ATOMIC_RELAXED);
+	if (i < GP_ARRAY_SIZE(steal->selfs))
+		steal->selfs[i] = pthread_self();
+
+	return 0;
+}
+
+static int tiles_steal(void)
+{
+	GP_PROGRESS_CALLBACK(callback, progress_nop, NULL);
+	struct tiles_steal steal = {.h = 256};
+	/* Full rows so that the first thread range is the top of the region */
+	gp_tiles tiles = {
+		.w = 64,
+		.h = steal.h,
+		.bpp = 8,
+		.min_w = 64,
+		.fn = tile_uneven,
+		.priv = &steal,
+		.callback = &callback,
+	};
+	unsigned int i, j, cnt = 0;
+	int ret = TST_SUCCESS;
+
+	/* The GP_THREADS enviroment variable limits the pool size */
+	unsetenv("GP_THREADS");
+	callback.threads = STEAL_THREADS;
+
+	if (gp_tiles_run(&tiles)) {
+		tst_msg("gp_tiles_run() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (steal.pixels != tiles.w * tiles.h) {
+		tst_msg("Processed %u pixels expected %u",
+		        steal.pixels, tiles.w * tiles.h);
+		ret = TST_FAILED;
+	}
+
+	if (steal.nr_selfs < 2) {
+		tst_msg("Only %u expensive tiles, expected at least 2",
+		        steal.nr_selfs);
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	for (i = 0; i < steal.nr_selfs; i++) {
+		for (j = 0; j < i; j++) {
+			if (pthread_equal(steal.selfs[i], steal.selfs[j]))
+				break;
+		}
+
+		if (j == i)
+			cnt++;
+	}
+
+	if (cnt < 2) {
+		tst_msg("Expensive tiles processed by %u thread(s), no stealing",
+		        cnt);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_nr_threads_set(0);
+	return ret;
+}
+
+struct progress_abort {
+	unsigned int calls;
+	unsigned int pixels;
+};
+
+static int progress_abort(gp_progress_cb *self)
+{
+	struct progress_abort *state = self->priv;
+
+	__atomic_add_fetch(&state->calls, 1, __ATOMIC_RELAXED);
+
+	return 1;
+}
+
+static int tile_slow(const gp_tile *tile, void *priv, gp_progress_cb *callback)
+{
+	struct progress_abort *state = priv;
+
+	(void) callback;
+
+	usleep(1000);
+
+	__atomic_add_fetch(&state->pixels, tile->w * tile->h, __ATOMIC_RELAXED);
+
+	return 0;
+}
+
+static int tiles_abort(void)
+{
+	struct progress_abort state = {};
+	GP_PROGRESS_CALLBACK(callback, progress_abort, &state);
+	gp_tiles tiles = {
+		.w = 256,
+		.h = 256,
+		.bpp = 8,
+		.fn = tile_slow,
+		.priv = &state,
+		.callback = &callback,
+	};
+	int ret = TST_SUCCESS;
+
+	callback.threads = 4;
+
+	if (!gp_tiles_run(&tiles)) {
+		tst_msg("gp_tiles_run() succeeded");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (errno != ECANCELED) {
+		tst_msg("Wrong errno %s expected ECANCELED", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+	if (state.calls != 1) {
+		tst_msg("Callback called %u times after abort", state.calls);
+		ret = TST_FAILED;
+	}
+
+	if (state.pixels >= tiles.w * tiles.h) {
+		tst_msg("Workers processed all pixels after abort");
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_nr_threads_set(0);
+	return ret;
+}
+
+static int progress_count(gp_progress_cb *self)
+{
+	int *ret = self->priv;
+
+	ret[0]++;
+
+	return ret[1];
+}
+
+static int progress_mp_abort(void)
+{
+	/* Number of calls and the callback return value */
+	int priv[2] = {};
+	GP_PROGRESS_CALLBACK(callback, progress_count, priv);
+	gp_progress_cb_mp_counter counters[2] = {};
+	struct gp_progress_cb_mp_priv mp = {
+		.orig_callback = &callback,
+		.counters = counters,
+		.nr_counters = 2,
+		.max = 20,
+	};
+
+	if (gp_progress_cb_mp_report(&mp, 0, 5)) {
+		tst_msg("Report aborted");
+		return TST_FAILED;
+	}
+
+	if (priv[0] != 1 || callback.percentage != 25) {
+		tst_msg("Callback called %i times percentage %.2f",
+		        priv[0], callback.percentage);
+		return TST_FAILED;
+	}
+
+	/* Reports are rate limited */
+	gp_progress_cb_mp_report(&mp, 1, 5);
+
+	if (priv[0] != 1) {
+		tst_msg("Callback called within GP_PROGRESS_MP_INTERVAL");
+		return TST_FAILED;
+	}
+
+	usleep(2000 * GP_PROGRESS_MP_INTERVAL);
+	priv[1] = 1;
+
+	if (!gp_progress_cb_mp_report(&mp, 1, 10)) {
+		tst_msg("Report did not abort");
+		return TST_FAILED;
+	}
+
+	if (priv[0] != 2 || callback.percentage != 75) {
+		tst_msg("Callback called %i times percentage %.2f",
+		        priv[0], callback.percentage);
+		return TST_FAILED;
+	}
+
+	/* Abort is sticky and the callback is not called anymore */
+	priv[1] = 0;
+	usleep(2000 * GP_PROGRESS_MP_INTERVAL);
+
+	if (!gp_progress_cb_mp_report(&mp, 0, 6)) {
+		tst_msg("Abort is not sticky");
+		return TST_FAILED;
+	}
+
+	if (priv[0] != 2) {
+		tst_msg("Callback called after abort");
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+#define AUTOTUNE_HEADER "# name pixel_type cost_ns_per_pixel samples\n"
+
+static int write_file(const char *path, const char *str)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f) {
+		tst_msg("fopen(%s) failed: %s", path, tst_strerr(errno));
+		return 1;
+	}
+
+	fputs(str, f);
+
+	return fclose(f);
+}
+
+static int check_file(const char *path, const char *expected)
+{
+	char buf[1024];
+	size_t len;
+	FILE *f = fopen(path, "r");
+
+	if (!f) {
+		tst_msg("fopen(%s) failed: %s", path, tst_strerr(errno));
+		return 1;
+	}
+
+	len = fread(buf, 1, sizeof(buf) - 1, f);
+	buf[len] = 0;
+	fclose(f);
+
+	if (strcmp(buf, expected)) {
+		tst_msg("File '%s' has content:\n%sexpected:\n%s",
+		        path, buf, expected);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int tile_nop(const gp_tile *tile, void *priv, gp_progress_cb *callback)
+{
+	(void) tile;
+	(void) priv;
+	(void) callback;
+
+	return 0;
+}
+
+static int autotune_round_trip(void)
+{
+	static const char *entries =
+		AUTOTUNE_HEADER
+		"op_a RGB888 2.500000 7\n"
+		"op_b G8 0.125000 1\n";
+	gp_tiles tiles = {
+		.w = 100,
+		.h = 100,
+		.bpp = 8,
+		.name = "op_c",
+		.pixel_type = GP_PIXEL_G8,
+		.fn = tile_nop,
+	};
+	char name[32], pixel_type[32];
+	unsigned int samples;
+	float cost;
+	FILE *f;
+	int ret;
+
+	if (write_file("in.txt", entries))
+		return TST_UNTESTED;
+
+	if (gp_autotune_load("in.txt")) {
+		tst_msg("gp_autotune_load() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_autotune_save("out.txt")) {
+		tst_msg("gp_autotune_save() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (check_file("out.txt", entries))
+		return TST_FAILED;
+
+	/* Loading the same entries again updates them in place */
+	if (gp_autotune_load("out.txt") || gp_autotune_save("out2.txt")) {
+		tst_msg("gp_autotune_load/save() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (check_file("out2.txt", entries))
+		return TST_FAILED;
+
+	/* Measured entries are saved as well */
+	gp_autotune_set(1);
+
+	if (gp_tiles_run(&tiles)) {
+		tst_msg("gp_tiles_run() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_autotune_save("out3.txt")) {
+		tst_msg("gp_autotune_save() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	f = fopen("out3.txt", "r");
+	if (!f) {
+		tst_msg("fopen() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	/* Skip header and the two loaded entries */
+	ret = fscanf(f, "%*[^\n]\n%*[^\n]\n%*[^\n]\n%31s %31s %f %u",
+	             name, pixel_type, &cost, &samples);
+	fclose(f);
+
+	if (ret != 4 || strcmp(name, "op_c") || strcmp(pixel_type, "G8") ||
+	    cost < 0 || samples != 1) {
+		tst_msg("Wrong measured entry");
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int autotune_malformed(void)
+{
+	static const char *entries =
+		AUTOTUNE_HEADER
+		"garbage\n"
+		"op_a RGB888\n"
+		"op_b NOT_A_PIXEL_TYPE 1.000000 1\n"
+		"op_c G8 -1.000000 1\n"
+		"op_d G8 0.000000 1\n"
+		"op_e G8 abc 1\n"
+		"op_ok G8 1.000000 2\n";
+
+	if (write_file("in.txt", entries))
+		return TST_UNTESTED;
+
+	if (gp_autotune_load("in.txt")) {
+		tst_msg("gp_autotune_load() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_autotune_save("out.txt")) {
+		tst_msg("gp_autotune_save() failed: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (check_file("out.txt", AUTOTUNE_HEADER "op_ok G8 1.000000 2\n"))
+		return TST_FAILED;
+
+	if (!gp_autotune_load("nonexistent.txt")) {
+		tst_msg("gp_autotune_load() succeeded on nonexistent file");
+		return TST_FAILED;
+	}
+
+	if (errno != ENOENT) {
+		tst_msg("Wrong errno %s expected ENOENT", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "thread pool testsuite",
+	.tests = {
+		{.name = "thread pool run",
+		 .tst_fn = thread_pool_run},
+
+		{.name = "thread pool error",
+		 .tst_fn = thread_pool_err},
+
+		{.name = "thread pool nested",
+		 .tst_fn = thread_pool_nested},
+
+		{.name = "thread pool limit",
+		 .tst_fn = thread_pool_limit},
+
+		{.name = "tiles run",
+		 .tst_fn = tiles_run},
+
+		{.name = "tiles min size",
+		 .tst_fn = tiles_min_size},
+
+		{.name = "tiles stealing",
+		 .tst_fn = tiles_steal},
+
+		{.name = "tiles progress abort",
+		 .tst_fn = tiles_abort},
+
+		{.name = "progress mp abort",
+		 .tst_fn = progress_mp_abort},
+
+		{.name = "autotune save load",
+		 .tst_fn = autotune_round_trip,
+		 .flags = TST_TMPDIR},
+
+		{.name = "autotune malformed",
+		 .tst_fn = autotune_malformed,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
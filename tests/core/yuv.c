@@ -0,0 +1,420 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  YUV frame tests.
+
+ */
+
+#include <inttypes.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_threads.h>
+#include <core/gp_blit.h>
+#include <core/gp_fill.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_yuv.h>
+
+#include "tst_test.h"
+
+/*
+ * Fills the pixmap with random colors in 2x2 blocks so that the chroma
+ * subsampling does not lose any information.
+ */
+static void fill_blocks(gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)pixmap->h; y += 2) {
+		for (x = 0; x < (gp_coord)pixmap->w; x += 2) {
+			gp_pixel p = GP_PIXEL_CREATE_RGB888(random() & 0xff,
+			                                    random() & 0xff,
+			                                    random() & 0xff);
+
+			gp_putpixel_raw(pixmap, x, y, p);
+
+			if (x + 1 < (gp_coord)pixmap->w)
+				gp_putpixel_raw(pixmap, x + 1, y, p);
+
+			if (y + 1 < (gp_coord)pixmap->h) {
+				gp_putpixel_raw(pixmap, x, y + 1, p);
+				if (x + 1 < (gp_coord)pixmap->w)
+					gp_putpixel_raw(pixmap, x + 1, y + 1, p);
+			}
+		}
+	}
+}
+
+static int chan_diff(gp_pixel a, gp_pixel b, unsigned int shift)
+{
+	return abs((int)((a >> shift) & 0xff) - (int)((b >> shift) & 0xff));
+}
+
+static int pixmaps_close(const gp_pixmap *a, const gp_pixmap *b, int max_err)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (chan_diff(pa, pb, 0) > max_err ||
+			    chan_diff(pa, pb, 8) > max_err ||
+			    chan_diff(pa, pb, 16) > max_err) {
+				tst_msg("Pixels differ at %ix%i %06"PRIx64" %06"PRIx64,
+				        x, y, pa, pb);
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+struct round_trip {
+	enum gp_yuv_format format;
+	gp_size w;
+	gp_size h;
+};
+
+static int round_trip(struct round_trip *params)
+{
+	gp_pixmap *src, *dst = NULL;
+	gp_yuv_frame *frame;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(params->w, params->h, GP_PIXEL_RGB888);
+	frame = gp_yuv_frame_alloc(params->w, params->h, params->format);
+
+	if (!src || !frame) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_blocks(src);
+
+	if (gp_pixmap_to_yuv_frame(src, frame, NULL)) {
+		tst_msg("gp_pixmap_to_yuv_frame() failed");
+		goto exit;
+	}
+
+	dst = gp_yuv_frame_to_pixmap_alloc(frame, GP_PIXEL_RGB888, NULL);
+	if (!dst) {
+		tst_msg("gp_yuv_frame_to_pixmap_alloc() failed");
+		goto exit;
+	}
+
+	if (pixmaps_close(src, dst, 2))
+		ret = TST_SUCCESS;
+exit:
+	gp_yuv_frame_free(frame);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * Gray has zero chroma and the luma is copied to all channels.
+ */
+static int gray_values(void)
+{
+	gp_yuv_frame frame;
+	gp_pixmap *dst;
+	uint8_t buf[512];
+	gp_coord x;
+	int ret = TST_FAILED;
+
+	for (x = 0; x < 256; x++) {
+		buf[2*x] = x;
+		buf[2*x+1] = 128;
+	}
+
+	gp_yuv_frame_init(&frame, 256, 1, GP_YUV_YUYV, buf, 0);
+
+	dst = gp_yuv_frame_to_pixmap_alloc(&frame, GP_PIXEL_xRGB8888, NULL);
+	if (!dst) {
+		tst_msg("gp_yuv_frame_to_pixmap_alloc() failed");
+		return TST_FAILED;
+	}
+
+	for (x = 0; x < 256; x++) {
+		gp_pixel p = gp_getpixel_raw(dst, x, 0);
+
+		if (p != (gp_pixel)x * 0x010101) {
+			tst_msg("Wrong pixel %i = %06"PRIx64, x, p);
+			goto exit;
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * The SIMD converters for RGB types and the generic path have to produce the
+ * same colors.
+ */
+static int pixel_types(gp_pixel_type pixel_type)
+{
+	gp_pixmap *src, *ref = NULL, *exp = NULL, *dst = NULL;
+	gp_yuv_frame *frame;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(301, 37, GP_PIXEL_RGB888);
+	frame = gp_yuv_frame_alloc(301, 37, GP_YUV_NV12);
+
+	if (!src || !frame) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_blocks(src);
+	gp_pixmap_to_yuv_frame(src, frame, NULL);
+
+	ref = gp_yuv_frame_to_pixmap_alloc(frame, GP_PIXEL_RGB888, NULL);
+	dst = gp_yuv_frame_to_pixmap_alloc(frame, pixel_type, NULL);
+	exp = gp_pixmap_alloc(301, 37, pixel_type);
+
+	if (!ref || !dst || !exp) {
+		tst_msg("Conversion failed");
+		goto exit;
+	}
+
+	gp_blit(ref, 0, 0, ref->w, ref->h, exp, 0, 0);
+
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+			gp_pixel pe = gp_getpixel_raw(exp, x, y);
+
+			if (p != pe) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, p, pe);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_yuv_frame_free(frame);
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(exp);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * Nearest neighbour upscale by two into a rectangle in the middle of the
+ * pixmap.
+ */
+static int blit_scaled(void)
+{
+	gp_pixmap *src, *exp = NULL, *dst = NULL;
+	gp_yuv_frame *frame;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(64, 32, GP_PIXEL_RGB888);
+	frame = gp_yuv_frame_alloc(64, 32, GP_YUV_I420);
+	dst = gp_pixmap_alloc(200, 100, GP_PIXEL_RGB888);
+
+	if (!src || !frame || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_blocks(src);
+	gp_pixmap_to_yuv_frame(src, frame, NULL);
+	gp_fill(dst, 0);
+
+	exp = gp_yuv_frame_to_pixmap_alloc(frame, GP_PIXEL_RGB888, NULL);
+
+	if (!exp || gp_yuv_frame_blit_scaled(frame, dst, 10, 20, 128, 64, NULL)) {
+		tst_msg("Conversion failed");
+		goto exit;
+	}
+
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel p = gp_getpixel_raw(dst, x, y);
+			gp_pixel pe = 0;
+
+			if (x >= 10 && x < 138 && y >= 20 && y < 84)
+				pe = gp_getpixel_raw(exp, (x - 10)/2, (y - 20)/2);
+
+			if (p != pe) {
+				tst_msg("Pixel %ix%i %06"PRIx64" expected %06"PRIx64,
+				        x, y, p, pe);
+				goto exit;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_yuv_frame_free(frame);
+	gp_pixmap_free(src);
+	gp_pixmap_free(exp);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int yuv_threads(enum gp_yuv_format format)
+{
+	gp_pixmap *src, *dst1 = NULL, *dst4 = NULL;
+	gp_yuv_frame *frame1, *frame4;
+	size_t size;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(1001, 301, GP_PIXEL_xRGB8888);
+	frame1 = gp_yuv_frame_alloc(1001, 301, format);
+	frame4 = gp_yuv_frame_alloc(1001, 301, format);
+
+	if (!src || !frame1 || !frame4) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < src->bytes_per_row * src->h; i++)
+		src->pixels[i] = random();
+
+	size = gp_yuv_frame_size(1001, 301, format, 0);
+
+	gp_nr_threads_set(1);
+	gp_pixmap_to_yuv_frame(src, frame1, NULL);
+	dst1 = gp_yuv_frame_to_pixmap_alloc(frame1, GP_PIXEL_RGB888, NULL);
+	gp_nr_threads_set(4);
+	gp_pixmap_to_yuv_frame(src, frame4, NULL);
+	dst4 = gp_yuv_frame_to_pixmap_alloc(frame4, GP_PIXEL_RGB888, NULL);
+
+	if (!dst1 || !dst4) {
+		tst_msg("Conversion failed");
+		goto exit;
+	}
+
+	if (memcmp(frame1->planes[0].pixels, frame4->planes[0].pixels, size)) {
+		tst_msg("YUV frames differ");
+		goto exit;
+	}
+
+	if (memcmp(dst1->pixels, dst4->pixels, dst1->bytes_per_row * dst1->h)) {
+		tst_msg("Pixmaps differ");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_nr_threads_set(0);
+	gp_yuv_frame_free(frame1);
+	gp_yuv_frame_free(frame4);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst1);
+	gp_pixmap_free(dst4);
+	return ret;
+}
+
+static int frame_init(void)
+{
+	gp_yuv_frame frame;
+	uint8_t buf[96];
+
+	errno = 0;
+
+	if (gp_yuv_frame_init(&frame, 10, 10, GP_YUV_YUYV, buf, 19) ||
+	    errno != EINVAL) {
+		tst_msg("Too small row size was not detected");
+		return TST_FAILED;
+	}
+
+	if (!gp_yuv_frame_init(&frame, 11, 5, GP_YUV_I420, buf, 0))
+		return TST_FAILED;
+
+	if (frame.planes[0].bytes_per_row != 12 ||
+	    frame.planes[1].pixels != buf + 60 ||
+	    frame.planes[1].bytes_per_row != 6 ||
+	    frame.planes[2].pixels != buf + 78) {
+		tst_msg("Wrong I420 planes layout");
+		return TST_FAILED;
+	}
+
+	if (gp_yuv_frame_size(11, 5, GP_YUV_I420, 0) != 96) {
+		tst_msg("Wrong I420 size %zu",
+		        gp_yuv_frame_size(11, 5, GP_YUV_I420, 0));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static struct round_trip yuyv = {GP_YUV_YUYV, 100, 50};
+static struct round_trip uyvy = {GP_YUV_UYVY, 100, 50};
+static struct round_trip nv12 = {GP_YUV_NV12, 100, 50};
+static struct round_trip i420 = {GP_YUV_I420, 100, 50};
+static struct round_trip yuyv_odd = {GP_YUV_YUYV, 33, 17};
+static struct round_trip nv12_odd = {GP_YUV_NV12, 33, 17};
+static struct round_trip i420_odd = {GP_YUV_I420, 33, 17};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "YUV testsuite",
+	.tests = {
+		{.name = "YUV round trip YUYV",
+		 .tst_fn = round_trip, .data = &yuyv,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "YUV round trip UYVY",
+		 .tst_fn = round_trip, .data = &uyvy,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "YUV round trip NV12",
+		 .tst_fn = round_trip, .data = &nv12,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "YUV round trip I420",
+		 .tst_fn = round_trip, .data = &i420,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "YUV round trip YUYV odd size",
+		 .tst_fn = round_trip, .data = &yuyv_odd,
+		 .flags = TST_MALLOC_CANARIES},
+		{.name = "YUV round trip NV12 odd size",
+		 .tst_fn = round_trip, .data = &nv12_odd,
+		 .flags = TST_MALLOC_CANARIES},
+		{.name = "YUV round trip I420 odd size",
+		 .tst_fn = round_trip, .data = &i420_odd,
+		 .flags = TST_MALLOC_CANARIES},
+		{.name = "YUV gray values",
+		 .tst_fn = gray_values},
+		{.name = "YUV to BGR888",
+		 .tst_fn = pixel_types, .data = (void*)GP_PIXEL_BGR888},
+		{.name = "YUV to xRGB8888",
+		 .tst_fn = pixel_types, .data = (void*)GP_PIXEL_xRGB8888},
+		{.name = "YUV to RGB565",
+		 .tst_fn = pixel_types, .data = (void*)GP_PIXEL_RGB565},
+		{.name = "YUV to G1",
+		 .tst_fn = pixel_types, .data = (void*)GP_PIXEL_G1},
+		{.name = "YUV blit scaled",
+		 .tst_fn = blit_scaled},
+		{.name = "YUV threads YUYV",
+		 .tst_fn = yuv_threads, .data = (void*)GP_YUV_YUYV},
+		{.name = "YUV threads I420",
+		 .tst_fn = yuv_threads, .data = (void*)GP_YUV_I420},
+		{.name = "YUV frame init",
+		 .tst_fn = frame_init},
+		{.name = NULL},
+	}
+};
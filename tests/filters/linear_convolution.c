@@ -4,12 +4,14 @@
  */
 
 #include <string.h>
+#include <stdlib.h>
 #include <errno.h>
 #include <sys/stat.h>
 
 #include <core/gp_pixmap.h>
 #include <loaders/gp_loaders.h>
 #include <filters/gp_convolution.h>
+#include <filters/gp_linear.h>
 
 #include "tst_test.h"
 
@@ -112,6 +114,78 @@ static int test_v_lin_conv_box_3_raw(void)
 	return TST_SUCCESS;
 }
 
+static gp_pixmap *alloc_random(gp_size w, gp_size h, gp_pixel_type type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, type);
+	unsigned int i;
+
+	if (!ret)
+		return NULL;
+
+	for (i = 0; i < ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+/*
+ * In-place convolution has to produce the same result as the one with a
+ * separate destination.
+ */
+static int test_lin_conv_in_place(int vertical)
+{
+	gp_pixmap *src = alloc_random(1100, 37, GP_PIXEL_RGB888), *in, *out;
+	float kernel[] = {
+		1, 2, 3, 2, 1,
+		2, 3, 4, 3, 2,
+		1, 2, 3, 2, 1,
+	};
+	int ret = TST_FAILED;
+
+	in = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+	out = gp_pixmap_copy(src, 0);
+
+	if (!src || !in || !out) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (vertical) {
+		gp_filter_vlinear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                  out, 0, 0, kernel, 7, 17, NULL);
+		gp_filter_vlinear_convolution_raw(in, 0, 0, in->w, in->h,
+		                                  in, 0, 0, kernel, 7, 17, NULL);
+	} else {
+		gp_filter_linear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                 out, 0, 0, kernel, 5, 3, 37, NULL);
+		gp_filter_linear_convolution_raw(in, 0, 0, in->w, in->h,
+		                                 in, 0, 0, kernel, 5, 3, 37, NULL);
+	}
+
+	if (!gp_pixmap_equal(in, out)) {
+		tst_msg("In-place result differs");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(in);
+	gp_pixmap_free(out);
+	return ret;
+}
+
+static int test_lin_conv_5x3_in_place(void)
+{
+	return test_lin_conv_in_place(0);
+}
+
+static int test_v_lin_conv_7_in_place(void)
+{
+	return test_lin_conv_in_place(1);
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Linear Convolution Testsuite",
 	.tests = {
@@ -127,6 +201,12 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = test_v_lin_conv_box_3_raw,
 		 .res_path = "data/conv/box_3x3/",
 		 .flags = TST_TMPDIR},
+		{.name = "LinearConvolution 5x3 in-place",
+		 .tst_fn = test_lin_conv_5x3_in_place,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "VLinearConvolution_Raw Kern 7 in-place",
+		 .tst_fn = test_v_lin_conv_7_in_place,
+		 .flags = TST_CHECK_MALLOC},
 		{.name = NULL}
 	}
 };
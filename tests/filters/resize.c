@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Resizes images filled with a single color with all interpolations and checks
+  that the color is preserved, which catches both overflows and rounding
+  errors in the fixed point arithmetics for 16 bits per channel.
+
+ */
+
+#include <inttypes.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fill.h>
+#include <filters/gp_resize.h>
+
+#include "tst_test.h"
+
+static const struct size {
+	gp_size w, h;
+} sizes[] = {
+	/* upscaling */
+	{97, 71},
+	/* downscaling */
+	{23, 17},
+	{7, 5},
+};
+
+/*
+ * Fills all channels with the maximal value with the lowest four bits cleared,
+ * e.g. 0xf0 for 8 bit and 0xfff0 for 16 bit channels.
+ */
+static gp_pixel fill_pixel(gp_pixel_type pixel_type)
+{
+	const gp_pixel_type_desc *desc = &gp_pixel_types[pixel_type];
+	gp_pixel pixel = 0;
+	unsigned int i;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		const gp_pixel_channel *chan = &desc->channels[i];
+		gp_pixel val = ((gp_pixel)1 << chan->size) - 1;
+
+		pixel |= (val & ~(gp_pixel)0x0f) << chan->offset;
+	}
+
+	return pixel;
+}
+
+static int resize(gp_pixel_type pixel_type, gp_interpolation_type interp)
+{
+	gp_pixel pixel = fill_pixel(pixel_type);
+	gp_pixmap *src, *res;
+	gp_coord x, y;
+	unsigned int i;
+
+	src = gp_pixmap_alloc(64, 48, pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	gp_fill(src, pixel);
+
+	for (i = 0; i < GP_ARRAY_SIZE(sizes); i++) {
+		res = gp_filter_resize_alloc(src, sizes[i].w, sizes[i].h,
+		                             interp, NULL);
+		if (!res) {
+			tst_msg("gp_filter_resize_alloc() failed");
+			gp_pixmap_free(src);
+			return TST_FAILED;
+		}
+
+		for (y = 0; y < (gp_coord)res->h; y++) {
+			for (x = 0; x < (gp_coord)res->w; x++) {
+				gp_pixel p = gp_getpixel_raw(res, x, y);
+
+				if (p != pixel) {
+					tst_msg("%s %ux%u pixel %i,%i %08"PRIx64" != %08"PRIx64,
+					        gp_interpolation_type_name(interp),
+					        res->w, res->h, x, y, p, pixel);
+					gp_pixmap_free(res);
+					gp_pixmap_free(src);
+					return TST_FAILED;
+				}
+			}
+		}
+
+		gp_pixmap_free(res);
+	}
+
+	gp_pixmap_free(src);
+
+	return TST_SUCCESS;
+}
+
+static int test_resize(const gp_pixel_type *pixel_type)
+{
+	int interp, ret;
+
+	for (interp = GP_INTERP_NN; interp <= GP_INTERP_MAX; interp++) {
+		/* Float cubic supports only RGB888 and rounds differently */
+		if (interp == GP_INTERP_CUBIC)
+			continue;
+
+		ret = resize(*pixel_type, interp);
+		if (ret != TST_SUCCESS)
+			return ret;
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Resize",
+	.tests = {
+		{.name = "Resize G8",
+		 .tst_fn = test_resize,
+		 .data = &(gp_pixel_type){GP_PIXEL_G8},
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Resize RGB888",
+		 .tst_fn = test_resize,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB888},
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Resize RGB161616",
+		 .tst_fn = test_resize,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB161616},
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Resize RGBA16161616",
+		 .tst_fn = test_resize,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGBA16161616},
+		 .flags = TST_CHECK_MALLOC},
+		{.name = NULL}
+	}
+};
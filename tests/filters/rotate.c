@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Compares rotations and mirrors against per pixel reference for all pixel
+  sizes, for images smaller and larger than the transposed blocks and tiles,
+  both in a single thread and in parallel and in-place where possible.
+
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <filters/gp_rotate.h>
+
+#include "tst_test.h"
+
+static const struct size {
+	gp_size w, h;
+} sizes[] = {
+	{1, 1},
+	{5, 3},
+	{37, 19},
+	{640, 480},
+};
+
+static void ref_pos(gp_filter_symmetries sym, gp_size w, gp_size h,
+                    gp_coord x, gp_coord y, gp_coord *rx, gp_coord *ry)
+{
+	switch (sym) {
+	case GP_ROTATE_90:
+		*rx = h - y - 1;
+		*ry = x;
+		break;
+	case GP_ROTATE_180:
+		*rx = w - x - 1;
+		*ry = h - y - 1;
+		break;
+	case GP_ROTATE_270:
+		*rx = y;
+		*ry = w - x - 1;
+		break;
+	case GP_MIRROR_H:
+		*rx = w - x - 1;
+		*ry = y;
+		break;
+	case GP_MIRROR_V:
+		*rx = x;
+		*ry = h - y - 1;
+		break;
+	}
+}
+
+static int check(const gp_pixmap *src, const gp_pixmap *res,
+                 gp_filter_symmetries sym, const char *variant)
+{
+	gp_coord x, y, rx, ry;
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			ref_pos(sym, src->w, src->h, x, y, &rx, &ry);
+
+			gp_pixel r = gp_getpixel_raw(res, rx, ry);
+
+			if (p != r) {
+				tst_msg("%s %s %ux%u %s pixel %i,%i %08"PRIx64" != %08"PRIx64,
+				        gp_filter_symmetry_names[sym],
+				        gp_pixel_type_name(src->pixel_type),
+				        src->w, src->h, variant, x, y, p, r);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int is_in_place(gp_filter_symmetries sym)
+{
+	return sym == GP_ROTATE_180 || sym == GP_MIRROR_H || sym == GP_MIRROR_V;
+}
+
+static int symmetry(gp_pixel_type pixel_type, gp_size w, gp_size h,
+                    gp_filter_symmetries sym)
+{
+	gp_pixmap *src, *res = NULL, *copy = NULL;
+	size_t i;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(w, h, pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < (size_t)src->bytes_per_row * src->h; i++)
+		src->pixels[i] = random();
+
+	res = gp_filter_symmetry_alloc(src, sym, NULL);
+	if (!res) {
+		tst_msg("gp_filter_symmetry_alloc() failed");
+		goto exit;
+	}
+
+	if (check(src, res, sym, "alloc"))
+		goto exit;
+
+	if (is_in_place(sym)) {
+		copy = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+		if (!copy) {
+			tst_msg("Malloc failed :(");
+			ret = TST_UNTESTED;
+			goto exit;
+		}
+
+		if (gp_filter_symmetry(copy, copy, sym, NULL)) {
+			tst_msg("gp_filter_symmetry() failed");
+			goto exit;
+		}
+
+		if (check(src, copy, sym, "in-place"))
+			goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(copy);
+	gp_pixmap_free(res);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int test_symmetries(const gp_pixel_type *pixel_type)
+{
+	unsigned int i, threads;
+	int sym, ret;
+
+	for (threads = 1; threads <= 4; threads += 3) {
+		gp_nr_threads_set(threads);
+
+		for (i = 0; i < GP_ARRAY_SIZE(sizes); i++) {
+			for (sym = GP_ROTATE_90; sym <= GP_MIRROR_V; sym++) {
+				ret = symmetry(*pixel_type, sizes[i].w, sizes[i].h, sym);
+				if (ret != TST_SUCCESS) {
+					gp_nr_threads_set(0);
+					return ret;
+				}
+			}
+		}
+	}
+
+	gp_nr_threads_set(0);
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Rotate",
+	.tests = {
+		{.name = "Symmetries G1",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_G1}},
+		{.name = "Symmetries G2",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_G2}},
+		{.name = "Symmetries G4",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_G4}},
+		{.name = "Symmetries G8",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_G8}},
+		{.name = "Symmetries RGB565",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB565}},
+		{.name = "Symmetries RGB666",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB666}},
+		{.name = "Symmetries RGB888",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB888}},
+		{.name = "Symmetries xRGB8888",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_xRGB8888}},
+		{.name = "Symmetries RGB161616",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGB161616}},
+		{.name = "Symmetries RGBA16161616",
+		 .tst_fn = test_symmetries,
+		 .data = &(gp_pixel_type){GP_PIXEL_RGBA16161616}},
+		{.name = NULL}
+	}
+};
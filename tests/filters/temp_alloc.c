@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Checks that steady-state filter calls do not allocate memory, the temporary
+  buffers are borrowed from the per-thread arenas.
+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_threads.h>
+#include <core/gp_temp_alloc.h>
+#include <filters/gp_linear.h>
+#include <filters/gp_blur.h>
+#include <filters/gp_median.h>
+#include <filters/gp_sigma.h>
+#include <filters/gp_arithmetic.h>
+
+#include "tst_test.h"
+#include "tst_preload.h"
+
+static float kernel[] = {
+	1, 2, 3, 2, 1,
+	2, 3, 4, 3, 2,
+	1, 2, 3, 2, 1,
+};
+
+static int run_filter(const char *name, gp_pixmap *src, gp_pixmap *dst)
+{
+	if (!strcmp(name, "hconv"))
+		return gp_filter_hlinear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                         dst, 0, 0, kernel, 15, 27, NULL);
+	if (!strcmp(name, "vconv"))
+		return gp_filter_vlinear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                         dst, 0, 0, kernel, 15, 27, NULL);
+	if (!strcmp(name, "conv"))
+		return gp_filter_linear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                        dst, 0, 0, kernel, 5, 3, 27, NULL);
+	if (!strcmp(name, "blur"))
+		return gp_filter_gaussian_blur(src, dst, 3, 3, NULL);
+	if (!strcmp(name, "median"))
+		return gp_filter_median(src, dst, 2, 2, NULL);
+	if (!strcmp(name, "sigma"))
+		return gp_filter_sigma(src, dst, 2, 2, 0, 0.2, NULL);
+	if (!strcmp(name, "add"))
+		return gp_filter_add(src, src, dst, NULL);
+
+	tst_msg("Invalid filter %s", name);
+	return 1;
+}
+
+static int filter_steady_state(const char *name)
+{
+	gp_pixmap *src, *dst;
+	struct malloc_stats stats;
+	unsigned int chunks, i;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(1000, 200, GP_PIXEL_RGB888);
+	dst = gp_pixmap_alloc(1000, 200, GP_PIXEL_RGB888);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < src->bytes_per_row * src->h; i++)
+		src->pixels[i] = random();
+
+	gp_nr_threads_set(2);
+
+	/* Warm up, grows the arenas and starts the worker threads */
+	for (i = 0; i < 2; i++) {
+		if (run_filter(name, src, dst)) {
+			tst_msg("Filter %s failed", name);
+			goto exit;
+		}
+	}
+
+	tst_malloc_check_report(&stats);
+	chunks = stats.total_chunks;
+
+	for (i = 0; i < 5; i++)
+		run_filter(name, src, dst);
+
+	tst_malloc_check_report(&stats);
+
+	if (stats.total_chunks != chunks) {
+		tst_msg("Filter %s allocated %u chunks in steady state",
+		        name, stats.total_chunks - chunks);
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_nr_threads_set(0);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * Released arena has to grow only to the size of the following requests.
+ */
+static int arena_release(void)
+{
+	void *buf;
+
+	buf = gp_temp_arena_get(16 * 1024 * 1024);
+	gp_temp_arena_put(buf, 16 * 1024 * 1024);
+
+	if (gp_temp_arena_size() < 16 * 1024 * 1024) {
+		tst_msg("Arena did not grow, size %zu", gp_temp_arena_size());
+		return TST_FAILED;
+	}
+
+	gp_temp_arena_release();
+
+	if (gp_temp_arena_size()) {
+		tst_msg("Arena was not released, size %zu", gp_temp_arena_size());
+		return TST_FAILED;
+	}
+
+	buf = gp_temp_arena_get(4096);
+	gp_temp_arena_put(buf, 4096);
+
+	if (gp_temp_arena_size() > 1024 * 1024) {
+		tst_msg("Arena grew to the old peak size %zu",
+		        gp_temp_arena_size());
+		return TST_FAILED;
+	}
+
+	gp_temp_arena_release();
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Filter temporary buffers",
+	.tests = {
+		{.name = "HConvolution steady state", .tst_fn = filter_steady_state,
+		 .data = "hconv", .flags = TST_MALLOC_CANARIES},
+		{.name = "VConvolution steady state", .tst_fn = filter_steady_state,
+		 .data = "vconv", .flags = TST_MALLOC_CANARIES},
+		{.name = "Convolution steady state", .tst_fn = filter_steady_state,
+		 .data = "conv", .flags = TST_MALLOC_CANARIES},
+		{.name = "Gaussian blur steady state", .tst_fn = filter_steady_state,
+		 .data = "blur", .flags = TST_MALLOC_CANARIES},
+		{.name = "Median steady state", .tst_fn = filter_steady_state,
+		 .data = "median", .flags = TST_MALLOC_CANARIES},
+		{.name = "Sigma steady state", .tst_fn = filter_steady_state,
+		 .data = "sigma", .flags = TST_MALLOC_CANARIES},
+		{.name = "Add steady state", .tst_fn = filter_steady_state,
+		 .data = "add", .flags = TST_MALLOC_CANARIES},
+		{.name = "Arena release", .tst_fn = arena_release},
+		{.name = NULL},
+	}
+};
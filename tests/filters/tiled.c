@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Tiled pixmaps, the results are compared against linear pixmaps. The small
+  caches force the tiles to be paged out to the swap file.
+
+ */
+
+#include <inttypes.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_tiled_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <filters/gp_linear.h>
+#include <filters/gp_rotate.h>
+
+#include "tst_test.h"
+
+struct tiled_test {
+	gp_size w, h;
+	gp_pixel_type pixel_type;
+	uint32_t cache_tiles;
+};
+
+static gp_pixmap *alloc_random(struct tiled_test *test)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(test->w, test->h, test->pixel_type);
+	unsigned int i;
+
+	if (!ret)
+		return NULL;
+
+	for (i = 0; i < ret->bytes_per_row * ret->h; i++)
+		ret->pixels[i] = random();
+
+	return ret;
+}
+
+static int compare(gp_pixmap *pixmap, gp_tiled_pixmap *tiled)
+{
+	gp_coord x, y;
+
+	if (pixmap->w != tiled->w || pixmap->h != tiled->h) {
+		tst_msg("Size differs %ux%u %ux%u",
+		        pixmap->w, pixmap->h, tiled->w, tiled->h);
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++) {
+			gp_pixel p = gp_getpixel_raw(pixmap, x, y);
+			gp_pixel t = gp_tiled_getpixel(tiled, x, y);
+
+			if (p != t) {
+				tst_msg("Pixel %ix%i %08"PRIx64" expected %08"PRIx64,
+				        x, y, t, p);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int tiled_convert(struct tiled_test *test)
+{
+	gp_pixmap *src = alloc_random(test), *res = NULL;
+	gp_tiled_pixmap *tiled = NULL;
+	int ret = TST_FAILED;
+
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	tiled = gp_tiled_pixmap_from_pixmap(src, test->cache_tiles);
+	if (!tiled) {
+		tst_msg("gp_tiled_pixmap_from_pixmap() failed");
+		goto exit;
+	}
+
+	if (test->cache_tiles && tiled->loaded_tiles > test->cache_tiles) {
+		tst_msg("Too many loaded tiles %u", tiled->loaded_tiles);
+		goto exit;
+	}
+
+	res = gp_tiled_pixmap_to_pixmap(tiled);
+	if (!res) {
+		tst_msg("gp_tiled_pixmap_to_pixmap() failed");
+		goto exit;
+	}
+
+	if (!gp_pixmap_equal(src, res)) {
+		tst_msg("Pixmaps differ");
+		goto exit;
+	}
+
+	if (compare(src, tiled))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(res);
+	gp_tiled_pixmap_free(tiled);
+	return ret;
+}
+
+static int tiled_putpixel(struct tiled_test *test)
+{
+	gp_pixmap *ref = alloc_random(test);
+	gp_tiled_pixmap *tiled = NULL;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	if (!ref) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	tiled = gp_tiled_pixmap_alloc(test->w, test->h, test->pixel_type,
+	                              test->cache_tiles);
+	if (!tiled) {
+		tst_msg("gp_tiled_pixmap_alloc() failed");
+		goto exit;
+	}
+
+	/* Column by column to page the tiles in and out as much as possible */
+	for (x = 0; x < (gp_coord)ref->w; x++) {
+		for (y = 0; y < (gp_coord)ref->h; y++)
+			gp_tiled_putpixel(tiled, x, y, gp_getpixel_raw(ref, x, y));
+	}
+
+	gp_tiled_putpixel(tiled, -1, 0, 0);
+	gp_tiled_putpixel(tiled, 0, ref->h, 0);
+
+	if (compare(ref, tiled))
+		goto exit;
+
+	if (gp_tiled_getpixel(tiled, ref->w, 0) || gp_tiled_getpixel(tiled, 0, -1)) {
+		tst_msg("Non-zero pixel outside of the pixmap");
+		goto exit;
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(ref);
+	gp_tiled_pixmap_free(tiled);
+	return ret;
+}
+
+static int tiled_vconvolution(struct tiled_test *test, unsigned int kh)
+{
+	gp_pixmap *src = alloc_random(test), *ref = NULL;
+	gp_tiled_pixmap *tsrc = NULL, *tdst = NULL;
+	float kernel[kh];
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < kh; i++)
+		kernel[i] = 1 + i % 3;
+
+	ref = gp_pixmap_copy(src, 0);
+	tsrc = gp_tiled_pixmap_from_pixmap(src, test->cache_tiles);
+	tdst = gp_tiled_pixmap_alloc(test->w, test->h, test->pixel_type,
+	                             test->cache_tiles);
+
+	if (!ref || !tsrc || !tdst) {
+		tst_msg("Allocation failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_filter_vlinear_convolution_raw(src, 0, 0, src->w, src->h, ref, 0, 0,
+	                                  kernel, kh, 2 * kh, NULL);
+
+	if (gp_filter_tiled_vconvolution(tsrc, tdst, kernel, kh, 2 * kh, NULL)) {
+		tst_msg("gp_filter_tiled_vconvolution() failed");
+		goto exit;
+	}
+
+	if (compare(ref, tdst))
+		goto exit;
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_tiled_pixmap_free(tsrc);
+	gp_tiled_pixmap_free(tdst);
+	return ret;
+}
+
+static int tiled_vconvolution_small(struct tiled_test *test)
+{
+	return tiled_vconvolution(test, 7);
+}
+
+static int tiled_vconvolution_big(struct tiled_test *test)
+{
+	return tiled_vconvolution(test, 151);
+}
+
+static int tiled_symmetry(struct tiled_test *test)
+{
+	gp_pixmap *src = alloc_random(test), *ref;
+	gp_tiled_pixmap *tsrc = NULL, *tdst;
+	int i, ret = TST_FAILED;
+
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	tsrc = gp_tiled_pixmap_from_pixmap(src, test->cache_tiles);
+	if (!tsrc) {
+		tst_msg("gp_tiled_pixmap_from_pixmap() failed");
+		goto exit;
+	}
+
+	for (i = 0; gp_filter_symmetry_names[i]; i++) {
+		ref = gp_filter_symmetry_alloc(src, i, NULL);
+		tdst = gp_filter_tiled_symmetry_alloc(tsrc, i, NULL);
+
+		if (!ref || !tdst) {
+			tst_msg("Symmetry %s failed", gp_filter_symmetry_names[i]);
+			gp_pixmap_free(ref);
+			gp_tiled_pixmap_free(tdst);
+			goto exit;
+		}
+
+		if (compare(ref, tdst)) {
+			tst_msg("Symmetry %s differs", gp_filter_symmetry_names[i]);
+			gp_pixmap_free(ref);
+			gp_tiled_pixmap_free(tdst);
+			goto exit;
+		}
+
+		gp_pixmap_free(ref);
+		gp_tiled_pixmap_free(tdst);
+	}
+
+	ret = TST_SUCCESS;
+exit:
+	gp_pixmap_free(src);
+	gp_tiled_pixmap_free(tsrc);
+	return ret;
+}
+
+static struct tiled_test rgb888 = {200, 150, GP_PIXEL_RGB888, 0};
+static struct tiled_test rgb888_paged = {200, 150, GP_PIXEL_RGB888, 2};
+static struct tiled_test g8_paged = {64, 129, GP_PIXEL_G8, 1};
+static struct tiled_test g1_paged = {130, 70, GP_PIXEL_G1, 3};
+static struct tiled_test xrgb_paged = {97, 211, GP_PIXEL_xRGB8888, 2};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Tiled pixmap testsuite",
+	.tests = {
+		{.name = "Tiled convert RGB888", .tst_fn = tiled_convert,
+		 .data = &rgb888, .flags = TST_CHECK_MALLOC},
+		{.name = "Tiled convert RGB888 paged", .tst_fn = tiled_convert,
+		 .data = &rgb888_paged, .flags = TST_CHECK_MALLOC},
+		{.name = "Tiled convert G8 paged", .tst_fn = tiled_convert,
+		 .data = &g8_paged, .flags = TST_CHECK_MALLOC},
+		{.name = "Tiled convert G1 paged", .tst_fn = tiled_convert,
+		 .data = &g1_paged, .flags = TST_CHECK_MALLOC},
+		{.name = "Tiled putpixel RGB888", .tst_fn = tiled_putpixel,
+		 .data = &rgb888},
+		{.name = "Tiled putpixel G1 paged", .tst_fn = tiled_putpixel,
+		 .data = &g1_paged},
+		{.name = "Tiled vconvolution RGB888", .tst_fn = tiled_vconvolution_small,
+		 .data = &rgb888},
+		{.name = "Tiled vconvolution xRGB8888 paged", .tst_fn = tiled_vconvolution_small,
+		 .data = &xrgb_paged},
+		{.name = "Tiled vconvolution big kernel paged", .tst_fn = tiled_vconvolution_big,
+		 .data = &xrgb_paged},
+		{.name = "Tiled symmetry RGB888", .tst_fn = tiled_symmetry,
+		 .data = &rgb888},
+		{.name = "Tiled symmetry xRGB8888 paged", .tst_fn = tiled_symmetry,
+		 .data = &xrgb_paged},
+		{.name = "Tiled symmetry G8 paged", .tst_fn = tiled_symmetry,
+		 .data = &g8_paged},
+		{.name = "Tiled symmetry G1 paged", .tst_fn = tiled_symmetry,
+		 .data = &g1_paged},
+		{.name = NULL},
+	}
+};
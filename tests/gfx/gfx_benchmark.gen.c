@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gfx_benchmark.gen.c
+ *
+ * GENERATED on 2026 10 17 00:28:52 from gfx_benchmark.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+
+#include "tst_test.h"
+
+static int bench_line(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(800, 600, type);
+
+	if (img == NULL) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 20000; i++) {
+		gp_line(img, 0 + i % 100, 0 - i % 100,
+		        800 - i%200, 600 + i%200, i % 0xff);
+	}
+
+	return TST_SUCCESS;
+}
+
+static int bench_circle(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 10000; i++)
+		gp_circle(img, img->w/2, img->h/2, i % 1000, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_circle_seg(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 10000; i++)
+		gp_circle_seg(img, img->w/2, img->h/2, i % 1000, 0xff, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_fill_circle(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++)
+		gp_fill_circle(img, img->w/2, img->h/2, i % 1000, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_line_1BPP(void)
+{
+	return bench_line(GP_PIXEL_G1);
+}
+
+static int bench_line_2BPP(void)
+{
+	return bench_line(GP_PIXEL_G2);
+}
+
+static int bench_line_4BPP(void)
+{
+	return bench_line(GP_PIXEL_G4);
+}
+
+static int bench_line_8BPP(void)
+{
+	return bench_line(GP_PIXEL_G8);
+}
+
+static int bench_line_16BPP(void)
+{
+	return bench_line(GP_PIXEL_RGB565);
+}
+
+static int bench_line_24BPP(void)
+{
+	return bench_line(GP_PIXEL_RGB888);
+}
+
+static int bench_line_32BPP(void)
+{
+	return bench_line(GP_PIXEL_xRGB8888);
+}
+
+static int bench_circle_1BPP(void)
+{
+	return bench_circle(GP_PIXEL_G1);
+}
+
+static int bench_circle_2BPP(void)
+{
+	return bench_circle(GP_PIXEL_G2);
+}
+
+static int bench_circle_4BPP(void)
+{
+	return bench_circle(GP_PIXEL_G4);
+}
+
+static int bench_circle_8BPP(void)
+{
+	return bench_circle(GP_PIXEL_G8);
+}
+
+static int bench_circle_16BPP(void)
+{
+	return bench_circle(GP_PIXEL_RGB565);
+}
+
+static int bench_circle_24BPP(void)
+{
+	return bench_circle(GP_PIXEL_RGB888);
+}
+
+static int bench_circle_32BPP(void)
+{
+	return bench_circle(GP_PIXEL_xRGB8888);
+}
+
+static int bench_circle_seg_1BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G1);
+}
+
+static int bench_circle_seg_2BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G2);
+}
+
+static int bench_circle_seg_4BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G4);
+}
+
+static int bench_circle_seg_8BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G8);
+}
+
+static int bench_circle_seg_16BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_RGB565);
+}
+
+static int bench_circle_seg_24BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_RGB888);
+}
+
+static int bench_circle_seg_32BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_xRGB8888);
+}
+
+static int bench_fill_circle_1BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G1);
+}
+
+static int bench_fill_circle_2BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G2);
+}
+
+static int bench_fill_circle_4BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G4);
+}
+
+static int bench_fill_circle_8BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G8);
+}
+
+static int bench_fill_circle_16BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_RGB565);
+}
+
+static int bench_fill_circle_24BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_RGB888);
+}
+
+static int bench_fill_circle_32BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_xRGB8888);
+}
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "GFX benchmark",
+	.tests = {
+		{.name = "line 1BPP", .tst_fn = bench_line_1BPP,
+	         .bench_iter = 10},
+		{.name = "line 2BPP", .tst_fn = bench_line_2BPP,
+	         .bench_iter = 10},
+		{.name = "line 4BPP", .tst_fn = bench_line_4BPP,
+	         .bench_iter = 10},
+		{.name = "line 8BPP", .tst_fn = bench_line_8BPP,
+	         .bench_iter = 10},
+		{.name = "line 16BPP", .tst_fn = bench_line_16BPP,
+	         .bench_iter = 10},
+		{.name = "line 24BPP", .tst_fn = bench_line_24BPP,
+	         .bench_iter = 10},
+		{.name = "line 32BPP", .tst_fn = bench_line_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "circle 1BPP", .tst_fn = bench_circle_1BPP,
+	         .bench_iter = 10},
+		{.name = "circle 2BPP", .tst_fn = bench_circle_2BPP,
+	         .bench_iter = 10},
+		{.name = "circle 4BPP", .tst_fn = bench_circle_4BPP,
+	         .bench_iter = 10},
+		{.name = "circle 8BPP", .tst_fn = bench_circle_8BPP,
+	         .bench_iter = 10},
+		{.name = "circle 16BPP", .tst_fn = bench_circle_16BPP,
+	         .bench_iter = 10},
+		{.name = "circle 24BPP", .tst_fn = bench_circle_24BPP,
+	         .bench_iter = 10},
+		{.name = "circle 32BPP", .tst_fn = bench_circle_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "circle_seg 1BPP", .tst_fn = bench_circle_seg_1BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 2BPP", .tst_fn = bench_circle_seg_2BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 4BPP", .tst_fn = bench_circle_seg_4BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 8BPP", .tst_fn = bench_circle_seg_8BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 16BPP", .tst_fn = bench_circle_seg_16BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 24BPP", .tst_fn = bench_circle_seg_24BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 32BPP", .tst_fn = bench_circle_seg_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "fill_circle 1BPP", .tst_fn = bench_fill_circle_1BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 2BPP", .tst_fn = bench_fill_circle_2BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 4BPP", .tst_fn = bench_fill_circle_4BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 8BPP", .tst_fn = bench_fill_circle_8BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 16BPP", .tst_fn = bench_fill_circle_16BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 24BPP", .tst_fn = bench_fill_circle_24BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 32BPP", .tst_fn = bench_fill_circle_32BPP,
+	         .bench_iter = 10},
+
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,19237 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * line_symmetry.gen.c
+ *
+ * GENERATED on 2026 10 17 00:28:55 from line_symmetry.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Tests that lines horizontally and vertically symetric lines are symetric.
+ *
+ * Copyright (C) 2018 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+#include <filters/gp_rotate.h>
+
+#include "tst_test.h"
+#include "compare.h"
+
+
+static void prep(gp_pixmap **p1, gp_pixmap **p2, gp_size w, gp_size h)
+{
+	*p1 = gp_pixmap_alloc(w, h, GP_PIXEL_G8);
+	*p2 = gp_pixmap_alloc(w, h, GP_PIXEL_G8);
+
+	gp_fill(*p1, 0);
+	gp_fill(*p2, 0);
+}
+
+static int line_1_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 1+1);
+
+	gp_line(p1, 0, 0, 1, 1, 1);
+	gp_line(p2, 0, 1, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 1+1);
+
+	gp_line(p1, 0, 0, 1, 1, 1);
+	gp_line(p2, 1, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 2+1);
+
+	gp_line(p1, 0, 0, 1, 2, 1);
+	gp_line(p2, 0, 2, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 2+1);
+
+	gp_line(p1, 0, 0, 1, 2, 1);
+	gp_line(p2, 1, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 3+1);
+
+	gp_line(p1, 0, 0, 1, 3, 1);
+	gp_line(p2, 0, 3, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 3+1);
+
+	gp_line(p1, 0, 0, 1, 3, 1);
+	gp_line(p2, 1, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 4+1);
+
+	gp_line(p1, 0, 0, 1, 4, 1);
+	gp_line(p2, 0, 4, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 4+1);
+
+	gp_line(p1, 0, 0, 1, 4, 1);
+	gp_line(p2, 1, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 5+1);
+
+	gp_line(p1, 0, 0, 1, 5, 1);
+	gp_line(p2, 0, 5, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 5+1);
+
+	gp_line(p1, 0, 0, 1, 5, 1);
+	gp_line(p2, 1, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 6+1);
+
+	gp_line(p1, 0, 0, 1, 6, 1);
+	gp_line(p2, 0, 6, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 6+1);
+
+	gp_line(p1, 0, 0, 1, 6, 1);
+	gp_line(p2, 1, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 7+1);
+
+	gp_line(p1, 0, 0, 1, 7, 1);
+	gp_line(p2, 0, 7, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 7+1);
+
+	gp_line(p1, 0, 0, 1, 7, 1);
+	gp_line(p2, 1, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 8+1);
+
+	gp_line(p1, 0, 0, 1, 8, 1);
+	gp_line(p2, 0, 8, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 8+1);
+
+	gp_line(p1, 0, 0, 1, 8, 1);
+	gp_line(p2, 1, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 9+1);
+
+	gp_line(p1, 0, 0, 1, 9, 1);
+	gp_line(p2, 0, 9, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 9+1);
+
+	gp_line(p1, 0, 0, 1, 9, 1);
+	gp_line(p2, 1, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 10+1);
+
+	gp_line(p1, 0, 0, 1, 10, 1);
+	gp_line(p2, 0, 10, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 10+1);
+
+	gp_line(p1, 0, 0, 1, 10, 1);
+	gp_line(p2, 1, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 11+1);
+
+	gp_line(p1, 0, 0, 1, 11, 1);
+	gp_line(p2, 0, 11, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 11+1);
+
+	gp_line(p1, 0, 0, 1, 11, 1);
+	gp_line(p2, 1, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 12+1);
+
+	gp_line(p1, 0, 0, 1, 12, 1);
+	gp_line(p2, 0, 12, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 12+1);
+
+	gp_line(p1, 0, 0, 1, 12, 1);
+	gp_line(p2, 1, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 13+1);
+
+	gp_line(p1, 0, 0, 1, 13, 1);
+	gp_line(p2, 0, 13, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 13+1);
+
+	gp_line(p1, 0, 0, 1, 13, 1);
+	gp_line(p2, 1, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 14+1);
+
+	gp_line(p1, 0, 0, 1, 14, 1);
+	gp_line(p2, 0, 14, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 14+1);
+
+	gp_line(p1, 0, 0, 1, 14, 1);
+	gp_line(p2, 1, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 15+1);
+
+	gp_line(p1, 0, 0, 1, 15, 1);
+	gp_line(p2, 0, 15, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 15+1);
+
+	gp_line(p1, 0, 0, 1, 15, 1);
+	gp_line(p2, 1, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 16+1);
+
+	gp_line(p1, 0, 0, 1, 16, 1);
+	gp_line(p2, 0, 16, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 16+1);
+
+	gp_line(p1, 0, 0, 1, 16, 1);
+	gp_line(p2, 1, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 17+1);
+
+	gp_line(p1, 0, 0, 1, 17, 1);
+	gp_line(p2, 0, 17, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 17+1);
+
+	gp_line(p1, 0, 0, 1, 17, 1);
+	gp_line(p2, 1, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 18+1);
+
+	gp_line(p1, 0, 0, 1, 18, 1);
+	gp_line(p2, 0, 18, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 18+1);
+
+	gp_line(p1, 0, 0, 1, 18, 1);
+	gp_line(p2, 1, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 19+1);
+
+	gp_line(p1, 0, 0, 1, 19, 1);
+	gp_line(p2, 0, 19, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 19+1);
+
+	gp_line(p1, 0, 0, 1, 19, 1);
+	gp_line(p2, 1, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 20+1);
+
+	gp_line(p1, 0, 0, 1, 20, 1);
+	gp_line(p2, 0, 20, 1, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 1+1, 20+1);
+
+	gp_line(p1, 0, 0, 1, 20, 1);
+	gp_line(p2, 1, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_1_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(1, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 1, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 1, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 1+1);
+
+	gp_line(p1, 0, 0, 2, 1, 1);
+	gp_line(p2, 0, 1, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 1+1);
+
+	gp_line(p1, 0, 0, 2, 1, 1);
+	gp_line(p2, 2, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 2+1);
+
+	gp_line(p1, 0, 0, 2, 2, 1);
+	gp_line(p2, 0, 2, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 2+1);
+
+	gp_line(p1, 0, 0, 2, 2, 1);
+	gp_line(p2, 2, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 3+1);
+
+	gp_line(p1, 0, 0, 2, 3, 1);
+	gp_line(p2, 0, 3, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 3+1);
+
+	gp_line(p1, 0, 0, 2, 3, 1);
+	gp_line(p2, 2, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 4+1);
+
+	gp_line(p1, 0, 0, 2, 4, 1);
+	gp_line(p2, 0, 4, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 4+1);
+
+	gp_line(p1, 0, 0, 2, 4, 1);
+	gp_line(p2, 2, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 5+1);
+
+	gp_line(p1, 0, 0, 2, 5, 1);
+	gp_line(p2, 0, 5, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 5+1);
+
+	gp_line(p1, 0, 0, 2, 5, 1);
+	gp_line(p2, 2, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 6+1);
+
+	gp_line(p1, 0, 0, 2, 6, 1);
+	gp_line(p2, 0, 6, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 6+1);
+
+	gp_line(p1, 0, 0, 2, 6, 1);
+	gp_line(p2, 2, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 7+1);
+
+	gp_line(p1, 0, 0, 2, 7, 1);
+	gp_line(p2, 0, 7, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 7+1);
+
+	gp_line(p1, 0, 0, 2, 7, 1);
+	gp_line(p2, 2, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 8+1);
+
+	gp_line(p1, 0, 0, 2, 8, 1);
+	gp_line(p2, 0, 8, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 8+1);
+
+	gp_line(p1, 0, 0, 2, 8, 1);
+	gp_line(p2, 2, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 9+1);
+
+	gp_line(p1, 0, 0, 2, 9, 1);
+	gp_line(p2, 0, 9, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 9+1);
+
+	gp_line(p1, 0, 0, 2, 9, 1);
+	gp_line(p2, 2, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 10+1);
+
+	gp_line(p1, 0, 0, 2, 10, 1);
+	gp_line(p2, 0, 10, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 10+1);
+
+	gp_line(p1, 0, 0, 2, 10, 1);
+	gp_line(p2, 2, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 11+1);
+
+	gp_line(p1, 0, 0, 2, 11, 1);
+	gp_line(p2, 0, 11, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 11+1);
+
+	gp_line(p1, 0, 0, 2, 11, 1);
+	gp_line(p2, 2, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 12+1);
+
+	gp_line(p1, 0, 0, 2, 12, 1);
+	gp_line(p2, 0, 12, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 12+1);
+
+	gp_line(p1, 0, 0, 2, 12, 1);
+	gp_line(p2, 2, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 13+1);
+
+	gp_line(p1, 0, 0, 2, 13, 1);
+	gp_line(p2, 0, 13, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 13+1);
+
+	gp_line(p1, 0, 0, 2, 13, 1);
+	gp_line(p2, 2, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 14+1);
+
+	gp_line(p1, 0, 0, 2, 14, 1);
+	gp_line(p2, 0, 14, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 14+1);
+
+	gp_line(p1, 0, 0, 2, 14, 1);
+	gp_line(p2, 2, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 15+1);
+
+	gp_line(p1, 0, 0, 2, 15, 1);
+	gp_line(p2, 0, 15, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 15+1);
+
+	gp_line(p1, 0, 0, 2, 15, 1);
+	gp_line(p2, 2, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 16+1);
+
+	gp_line(p1, 0, 0, 2, 16, 1);
+	gp_line(p2, 0, 16, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 16+1);
+
+	gp_line(p1, 0, 0, 2, 16, 1);
+	gp_line(p2, 2, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 17+1);
+
+	gp_line(p1, 0, 0, 2, 17, 1);
+	gp_line(p2, 0, 17, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 17+1);
+
+	gp_line(p1, 0, 0, 2, 17, 1);
+	gp_line(p2, 2, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 18+1);
+
+	gp_line(p1, 0, 0, 2, 18, 1);
+	gp_line(p2, 0, 18, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 18+1);
+
+	gp_line(p1, 0, 0, 2, 18, 1);
+	gp_line(p2, 2, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 19+1);
+
+	gp_line(p1, 0, 0, 2, 19, 1);
+	gp_line(p2, 0, 19, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 19+1);
+
+	gp_line(p1, 0, 0, 2, 19, 1);
+	gp_line(p2, 2, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 20+1);
+
+	gp_line(p1, 0, 0, 2, 20, 1);
+	gp_line(p2, 0, 20, 2, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 20+1);
+
+	gp_line(p1, 0, 0, 2, 20, 1);
+	gp_line(p2, 2, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_2_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(2, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 2, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 2, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 1+1);
+
+	gp_line(p1, 0, 0, 3, 1, 1);
+	gp_line(p2, 0, 1, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 1+1);
+
+	gp_line(p1, 0, 0, 3, 1, 1);
+	gp_line(p2, 3, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 2+1);
+
+	gp_line(p1, 0, 0, 3, 2, 1);
+	gp_line(p2, 0, 2, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 2+1);
+
+	gp_line(p1, 0, 0, 3, 2, 1);
+	gp_line(p2, 3, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 3+1);
+
+	gp_line(p1, 0, 0, 3, 3, 1);
+	gp_line(p2, 0, 3, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 3+1);
+
+	gp_line(p1, 0, 0, 3, 3, 1);
+	gp_line(p2, 3, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 4+1);
+
+	gp_line(p1, 0, 0, 3, 4, 1);
+	gp_line(p2, 0, 4, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 4+1);
+
+	gp_line(p1, 0, 0, 3, 4, 1);
+	gp_line(p2, 3, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 5+1);
+
+	gp_line(p1, 0, 0, 3, 5, 1);
+	gp_line(p2, 0, 5, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 5+1);
+
+	gp_line(p1, 0, 0, 3, 5, 1);
+	gp_line(p2, 3, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 6+1);
+
+	gp_line(p1, 0, 0, 3, 6, 1);
+	gp_line(p2, 0, 6, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 6+1);
+
+	gp_line(p1, 0, 0, 3, 6, 1);
+	gp_line(p2, 3, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 7+1);
+
+	gp_line(p1, 0, 0, 3, 7, 1);
+	gp_line(p2, 0, 7, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 7+1);
+
+	gp_line(p1, 0, 0, 3, 7, 1);
+	gp_line(p2, 3, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 8+1);
+
+	gp_line(p1, 0, 0, 3, 8, 1);
+	gp_line(p2, 0, 8, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 8+1);
+
+	gp_line(p1, 0, 0, 3, 8, 1);
+	gp_line(p2, 3, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 9+1);
+
+	gp_line(p1, 0, 0, 3, 9, 1);
+	gp_line(p2, 0, 9, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 9+1);
+
+	gp_line(p1, 0, 0, 3, 9, 1);
+	gp_line(p2, 3, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 10+1);
+
+	gp_line(p1, 0, 0, 3, 10, 1);
+	gp_line(p2, 0, 10, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 10+1);
+
+	gp_line(p1, 0, 0, 3, 10, 1);
+	gp_line(p2, 3, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 11+1);
+
+	gp_line(p1, 0, 0, 3, 11, 1);
+	gp_line(p2, 0, 11, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 11+1);
+
+	gp_line(p1, 0, 0, 3, 11, 1);
+	gp_line(p2, 3, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 12+1);
+
+	gp_line(p1, 0, 0, 3, 12, 1);
+	gp_line(p2, 0, 12, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 12+1);
+
+	gp_line(p1, 0, 0, 3, 12, 1);
+	gp_line(p2, 3, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 13+1);
+
+	gp_line(p1, 0, 0, 3, 13, 1);
+	gp_line(p2, 0, 13, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 13+1);
+
+	gp_line(p1, 0, 0, 3, 13, 1);
+	gp_line(p2, 3, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 14+1);
+
+	gp_line(p1, 0, 0, 3, 14, 1);
+	gp_line(p2, 0, 14, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 14+1);
+
+	gp_line(p1, 0, 0, 3, 14, 1);
+	gp_line(p2, 3, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 15+1);
+
+	gp_line(p1, 0, 0, 3, 15, 1);
+	gp_line(p2, 0, 15, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 15+1);
+
+	gp_line(p1, 0, 0, 3, 15, 1);
+	gp_line(p2, 3, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 16+1);
+
+	gp_line(p1, 0, 0, 3, 16, 1);
+	gp_line(p2, 0, 16, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 16+1);
+
+	gp_line(p1, 0, 0, 3, 16, 1);
+	gp_line(p2, 3, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 17+1);
+
+	gp_line(p1, 0, 0, 3, 17, 1);
+	gp_line(p2, 0, 17, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 17+1);
+
+	gp_line(p1, 0, 0, 3, 17, 1);
+	gp_line(p2, 3, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 18+1);
+
+	gp_line(p1, 0, 0, 3, 18, 1);
+	gp_line(p2, 0, 18, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 18+1);
+
+	gp_line(p1, 0, 0, 3, 18, 1);
+	gp_line(p2, 3, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 19+1);
+
+	gp_line(p1, 0, 0, 3, 19, 1);
+	gp_line(p2, 0, 19, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 19+1);
+
+	gp_line(p1, 0, 0, 3, 19, 1);
+	gp_line(p2, 3, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 20+1);
+
+	gp_line(p1, 0, 0, 3, 20, 1);
+	gp_line(p2, 0, 20, 3, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 3+1, 20+1);
+
+	gp_line(p1, 0, 0, 3, 20, 1);
+	gp_line(p2, 3, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_3_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(3, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 3, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 3, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 1+1);
+
+	gp_line(p1, 0, 0, 4, 1, 1);
+	gp_line(p2, 0, 1, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 1+1);
+
+	gp_line(p1, 0, 0, 4, 1, 1);
+	gp_line(p2, 4, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 2+1);
+
+	gp_line(p1, 0, 0, 4, 2, 1);
+	gp_line(p2, 0, 2, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 2+1);
+
+	gp_line(p1, 0, 0, 4, 2, 1);
+	gp_line(p2, 4, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 3+1);
+
+	gp_line(p1, 0, 0, 4, 3, 1);
+	gp_line(p2, 0, 3, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 3+1);
+
+	gp_line(p1, 0, 0, 4, 3, 1);
+	gp_line(p2, 4, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 4+1);
+
+	gp_line(p1, 0, 0, 4, 4, 1);
+	gp_line(p2, 0, 4, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 4+1);
+
+	gp_line(p1, 0, 0, 4, 4, 1);
+	gp_line(p2, 4, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 5+1);
+
+	gp_line(p1, 0, 0, 4, 5, 1);
+	gp_line(p2, 0, 5, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 5+1);
+
+	gp_line(p1, 0, 0, 4, 5, 1);
+	gp_line(p2, 4, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 6+1);
+
+	gp_line(p1, 0, 0, 4, 6, 1);
+	gp_line(p2, 0, 6, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 6+1);
+
+	gp_line(p1, 0, 0, 4, 6, 1);
+	gp_line(p2, 4, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 7+1);
+
+	gp_line(p1, 0, 0, 4, 7, 1);
+	gp_line(p2, 0, 7, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 7+1);
+
+	gp_line(p1, 0, 0, 4, 7, 1);
+	gp_line(p2, 4, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 8+1);
+
+	gp_line(p1, 0, 0, 4, 8, 1);
+	gp_line(p2, 0, 8, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 8+1);
+
+	gp_line(p1, 0, 0, 4, 8, 1);
+	gp_line(p2, 4, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 9+1);
+
+	gp_line(p1, 0, 0, 4, 9, 1);
+	gp_line(p2, 0, 9, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 9+1);
+
+	gp_line(p1, 0, 0, 4, 9, 1);
+	gp_line(p2, 4, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 10+1);
+
+	gp_line(p1, 0, 0, 4, 10, 1);
+	gp_line(p2, 0, 10, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 10+1);
+
+	gp_line(p1, 0, 0, 4, 10, 1);
+	gp_line(p2, 4, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 11+1);
+
+	gp_line(p1, 0, 0, 4, 11, 1);
+	gp_line(p2, 0, 11, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 11+1);
+
+	gp_line(p1, 0, 0, 4, 11, 1);
+	gp_line(p2, 4, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 12+1);
+
+	gp_line(p1, 0, 0, 4, 12, 1);
+	gp_line(p2, 0, 12, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 12+1);
+
+	gp_line(p1, 0, 0, 4, 12, 1);
+	gp_line(p2, 4, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 13+1);
+
+	gp_line(p1, 0, 0, 4, 13, 1);
+	gp_line(p2, 0, 13, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 13+1);
+
+	gp_line(p1, 0, 0, 4, 13, 1);
+	gp_line(p2, 4, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 14+1);
+
+	gp_line(p1, 0, 0, 4, 14, 1);
+	gp_line(p2, 0, 14, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 14+1);
+
+	gp_line(p1, 0, 0, 4, 14, 1);
+	gp_line(p2, 4, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 15+1);
+
+	gp_line(p1, 0, 0, 4, 15, 1);
+	gp_line(p2, 0, 15, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 15+1);
+
+	gp_line(p1, 0, 0, 4, 15, 1);
+	gp_line(p2, 4, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 16+1);
+
+	gp_line(p1, 0, 0, 4, 16, 1);
+	gp_line(p2, 0, 16, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 16+1);
+
+	gp_line(p1, 0, 0, 4, 16, 1);
+	gp_line(p2, 4, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 17+1);
+
+	gp_line(p1, 0, 0, 4, 17, 1);
+	gp_line(p2, 0, 17, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 17+1);
+
+	gp_line(p1, 0, 0, 4, 17, 1);
+	gp_line(p2, 4, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 18+1);
+
+	gp_line(p1, 0, 0, 4, 18, 1);
+	gp_line(p2, 0, 18, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 18+1);
+
+	gp_line(p1, 0, 0, 4, 18, 1);
+	gp_line(p2, 4, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 19+1);
+
+	gp_line(p1, 0, 0, 4, 19, 1);
+	gp_line(p2, 0, 19, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 19+1);
+
+	gp_line(p1, 0, 0, 4, 19, 1);
+	gp_line(p2, 4, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 20+1);
+
+	gp_line(p1, 0, 0, 4, 20, 1);
+	gp_line(p2, 0, 20, 4, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 20+1);
+
+	gp_line(p1, 0, 0, 4, 20, 1);
+	gp_line(p2, 4, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_4_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(4, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 4, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 4, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 1+1);
+
+	gp_line(p1, 0, 0, 5, 1, 1);
+	gp_line(p2, 0, 1, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 1+1);
+
+	gp_line(p1, 0, 0, 5, 1, 1);
+	gp_line(p2, 5, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 2+1);
+
+	gp_line(p1, 0, 0, 5, 2, 1);
+	gp_line(p2, 0, 2, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 2+1);
+
+	gp_line(p1, 0, 0, 5, 2, 1);
+	gp_line(p2, 5, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 3+1);
+
+	gp_line(p1, 0, 0, 5, 3, 1);
+	gp_line(p2, 0, 3, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 3+1);
+
+	gp_line(p1, 0, 0, 5, 3, 1);
+	gp_line(p2, 5, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 4+1);
+
+	gp_line(p1, 0, 0, 5, 4, 1);
+	gp_line(p2, 0, 4, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 4+1);
+
+	gp_line(p1, 0, 0, 5, 4, 1);
+	gp_line(p2, 5, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 5+1);
+
+	gp_line(p1, 0, 0, 5, 5, 1);
+	gp_line(p2, 0, 5, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 5+1);
+
+	gp_line(p1, 0, 0, 5, 5, 1);
+	gp_line(p2, 5, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 6+1);
+
+	gp_line(p1, 0, 0, 5, 6, 1);
+	gp_line(p2, 0, 6, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 6+1);
+
+	gp_line(p1, 0, 0, 5, 6, 1);
+	gp_line(p2, 5, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 7+1);
+
+	gp_line(p1, 0, 0, 5, 7, 1);
+	gp_line(p2, 0, 7, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 7+1);
+
+	gp_line(p1, 0, 0, 5, 7, 1);
+	gp_line(p2, 5, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 8+1);
+
+	gp_line(p1, 0, 0, 5, 8, 1);
+	gp_line(p2, 0, 8, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 8+1);
+
+	gp_line(p1, 0, 0, 5, 8, 1);
+	gp_line(p2, 5, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 9+1);
+
+	gp_line(p1, 0, 0, 5, 9, 1);
+	gp_line(p2, 0, 9, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 9+1);
+
+	gp_line(p1, 0, 0, 5, 9, 1);
+	gp_line(p2, 5, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 10+1);
+
+	gp_line(p1, 0, 0, 5, 10, 1);
+	gp_line(p2, 0, 10, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 10+1);
+
+	gp_line(p1, 0, 0, 5, 10, 1);
+	gp_line(p2, 5, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 11+1);
+
+	gp_line(p1, 0, 0, 5, 11, 1);
+	gp_line(p2, 0, 11, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 11+1);
+
+	gp_line(p1, 0, 0, 5, 11, 1);
+	gp_line(p2, 5, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 12+1);
+
+	gp_line(p1, 0, 0, 5, 12, 1);
+	gp_line(p2, 0, 12, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 12+1);
+
+	gp_line(p1, 0, 0, 5, 12, 1);
+	gp_line(p2, 5, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 13+1);
+
+	gp_line(p1, 0, 0, 5, 13, 1);
+	gp_line(p2, 0, 13, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 13+1);
+
+	gp_line(p1, 0, 0, 5, 13, 1);
+	gp_line(p2, 5, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 14+1);
+
+	gp_line(p1, 0, 0, 5, 14, 1);
+	gp_line(p2, 0, 14, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 14+1);
+
+	gp_line(p1, 0, 0, 5, 14, 1);
+	gp_line(p2, 5, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 15+1);
+
+	gp_line(p1, 0, 0, 5, 15, 1);
+	gp_line(p2, 0, 15, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 15+1);
+
+	gp_line(p1, 0, 0, 5, 15, 1);
+	gp_line(p2, 5, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 16+1);
+
+	gp_line(p1, 0, 0, 5, 16, 1);
+	gp_line(p2, 0, 16, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 16+1);
+
+	gp_line(p1, 0, 0, 5, 16, 1);
+	gp_line(p2, 5, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 17+1);
+
+	gp_line(p1, 0, 0, 5, 17, 1);
+	gp_line(p2, 0, 17, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 17+1);
+
+	gp_line(p1, 0, 0, 5, 17, 1);
+	gp_line(p2, 5, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 18+1);
+
+	gp_line(p1, 0, 0, 5, 18, 1);
+	gp_line(p2, 0, 18, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 18+1);
+
+	gp_line(p1, 0, 0, 5, 18, 1);
+	gp_line(p2, 5, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 19+1);
+
+	gp_line(p1, 0, 0, 5, 19, 1);
+	gp_line(p2, 0, 19, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 19+1);
+
+	gp_line(p1, 0, 0, 5, 19, 1);
+	gp_line(p2, 5, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 20+1);
+
+	gp_line(p1, 0, 0, 5, 20, 1);
+	gp_line(p2, 0, 20, 5, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 5+1, 20+1);
+
+	gp_line(p1, 0, 0, 5, 20, 1);
+	gp_line(p2, 5, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_5_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(5, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 5, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 5, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 1+1);
+
+	gp_line(p1, 0, 0, 6, 1, 1);
+	gp_line(p2, 0, 1, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 1+1);
+
+	gp_line(p1, 0, 0, 6, 1, 1);
+	gp_line(p2, 6, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 2+1);
+
+	gp_line(p1, 0, 0, 6, 2, 1);
+	gp_line(p2, 0, 2, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 2+1);
+
+	gp_line(p1, 0, 0, 6, 2, 1);
+	gp_line(p2, 6, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 3+1);
+
+	gp_line(p1, 0, 0, 6, 3, 1);
+	gp_line(p2, 0, 3, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 3+1);
+
+	gp_line(p1, 0, 0, 6, 3, 1);
+	gp_line(p2, 6, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 4+1);
+
+	gp_line(p1, 0, 0, 6, 4, 1);
+	gp_line(p2, 0, 4, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 4+1);
+
+	gp_line(p1, 0, 0, 6, 4, 1);
+	gp_line(p2, 6, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 5+1);
+
+	gp_line(p1, 0, 0, 6, 5, 1);
+	gp_line(p2, 0, 5, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 5+1);
+
+	gp_line(p1, 0, 0, 6, 5, 1);
+	gp_line(p2, 6, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 6+1);
+
+	gp_line(p1, 0, 0, 6, 6, 1);
+	gp_line(p2, 0, 6, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 6+1);
+
+	gp_line(p1, 0, 0, 6, 6, 1);
+	gp_line(p2, 6, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 7+1);
+
+	gp_line(p1, 0, 0, 6, 7, 1);
+	gp_line(p2, 0, 7, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 7+1);
+
+	gp_line(p1, 0, 0, 6, 7, 1);
+	gp_line(p2, 6, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 8+1);
+
+	gp_line(p1, 0, 0, 6, 8, 1);
+	gp_line(p2, 0, 8, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 8+1);
+
+	gp_line(p1, 0, 0, 6, 8, 1);
+	gp_line(p2, 6, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 9+1);
+
+	gp_line(p1, 0, 0, 6, 9, 1);
+	gp_line(p2, 0, 9, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 9+1);
+
+	gp_line(p1, 0, 0, 6, 9, 1);
+	gp_line(p2, 6, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 10+1);
+
+	gp_line(p1, 0, 0, 6, 10, 1);
+	gp_line(p2, 0, 10, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 10+1);
+
+	gp_line(p1, 0, 0, 6, 10, 1);
+	gp_line(p2, 6, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 11+1);
+
+	gp_line(p1, 0, 0, 6, 11, 1);
+	gp_line(p2, 0, 11, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 11+1);
+
+	gp_line(p1, 0, 0, 6, 11, 1);
+	gp_line(p2, 6, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 12+1);
+
+	gp_line(p1, 0, 0, 6, 12, 1);
+	gp_line(p2, 0, 12, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 12+1);
+
+	gp_line(p1, 0, 0, 6, 12, 1);
+	gp_line(p2, 6, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 13+1);
+
+	gp_line(p1, 0, 0, 6, 13, 1);
+	gp_line(p2, 0, 13, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 13+1);
+
+	gp_line(p1, 0, 0, 6, 13, 1);
+	gp_line(p2, 6, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 14+1);
+
+	gp_line(p1, 0, 0, 6, 14, 1);
+	gp_line(p2, 0, 14, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 14+1);
+
+	gp_line(p1, 0, 0, 6, 14, 1);
+	gp_line(p2, 6, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 15+1);
+
+	gp_line(p1, 0, 0, 6, 15, 1);
+	gp_line(p2, 0, 15, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 15+1);
+
+	gp_line(p1, 0, 0, 6, 15, 1);
+	gp_line(p2, 6, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 16+1);
+
+	gp_line(p1, 0, 0, 6, 16, 1);
+	gp_line(p2, 0, 16, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 16+1);
+
+	gp_line(p1, 0, 0, 6, 16, 1);
+	gp_line(p2, 6, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 17+1);
+
+	gp_line(p1, 0, 0, 6, 17, 1);
+	gp_line(p2, 0, 17, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 17+1);
+
+	gp_line(p1, 0, 0, 6, 17, 1);
+	gp_line(p2, 6, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 18+1);
+
+	gp_line(p1, 0, 0, 6, 18, 1);
+	gp_line(p2, 0, 18, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 18+1);
+
+	gp_line(p1, 0, 0, 6, 18, 1);
+	gp_line(p2, 6, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 19+1);
+
+	gp_line(p1, 0, 0, 6, 19, 1);
+	gp_line(p2, 0, 19, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 19+1);
+
+	gp_line(p1, 0, 0, 6, 19, 1);
+	gp_line(p2, 6, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 20+1);
+
+	gp_line(p1, 0, 0, 6, 20, 1);
+	gp_line(p2, 0, 20, 6, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 20+1);
+
+	gp_line(p1, 0, 0, 6, 20, 1);
+	gp_line(p2, 6, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_6_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(6, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 6, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 6, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 1+1);
+
+	gp_line(p1, 0, 0, 7, 1, 1);
+	gp_line(p2, 0, 1, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 1+1);
+
+	gp_line(p1, 0, 0, 7, 1, 1);
+	gp_line(p2, 7, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 2+1);
+
+	gp_line(p1, 0, 0, 7, 2, 1);
+	gp_line(p2, 0, 2, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 2+1);
+
+	gp_line(p1, 0, 0, 7, 2, 1);
+	gp_line(p2, 7, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 3+1);
+
+	gp_line(p1, 0, 0, 7, 3, 1);
+	gp_line(p2, 0, 3, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 3+1);
+
+	gp_line(p1, 0, 0, 7, 3, 1);
+	gp_line(p2, 7, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 4+1);
+
+	gp_line(p1, 0, 0, 7, 4, 1);
+	gp_line(p2, 0, 4, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 4+1);
+
+	gp_line(p1, 0, 0, 7, 4, 1);
+	gp_line(p2, 7, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 5+1);
+
+	gp_line(p1, 0, 0, 7, 5, 1);
+	gp_line(p2, 0, 5, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 5+1);
+
+	gp_line(p1, 0, 0, 7, 5, 1);
+	gp_line(p2, 7, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 6+1);
+
+	gp_line(p1, 0, 0, 7, 6, 1);
+	gp_line(p2, 0, 6, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 6+1);
+
+	gp_line(p1, 0, 0, 7, 6, 1);
+	gp_line(p2, 7, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 7+1);
+
+	gp_line(p1, 0, 0, 7, 7, 1);
+	gp_line(p2, 0, 7, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 7+1);
+
+	gp_line(p1, 0, 0, 7, 7, 1);
+	gp_line(p2, 7, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 8+1);
+
+	gp_line(p1, 0, 0, 7, 8, 1);
+	gp_line(p2, 0, 8, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 8+1);
+
+	gp_line(p1, 0, 0, 7, 8, 1);
+	gp_line(p2, 7, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 9+1);
+
+	gp_line(p1, 0, 0, 7, 9, 1);
+	gp_line(p2, 0, 9, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 9+1);
+
+	gp_line(p1, 0, 0, 7, 9, 1);
+	gp_line(p2, 7, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 10+1);
+
+	gp_line(p1, 0, 0, 7, 10, 1);
+	gp_line(p2, 0, 10, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 10+1);
+
+	gp_line(p1, 0, 0, 7, 10, 1);
+	gp_line(p2, 7, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 11+1);
+
+	gp_line(p1, 0, 0, 7, 11, 1);
+	gp_line(p2, 0, 11, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 11+1);
+
+	gp_line(p1, 0, 0, 7, 11, 1);
+	gp_line(p2, 7, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 12+1);
+
+	gp_line(p1, 0, 0, 7, 12, 1);
+	gp_line(p2, 0, 12, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 12+1);
+
+	gp_line(p1, 0, 0, 7, 12, 1);
+	gp_line(p2, 7, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 13+1);
+
+	gp_line(p1, 0, 0, 7, 13, 1);
+	gp_line(p2, 0, 13, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 13+1);
+
+	gp_line(p1, 0, 0, 7, 13, 1);
+	gp_line(p2, 7, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 14+1);
+
+	gp_line(p1, 0, 0, 7, 14, 1);
+	gp_line(p2, 0, 14, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 14+1);
+
+	gp_line(p1, 0, 0, 7, 14, 1);
+	gp_line(p2, 7, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 15+1);
+
+	gp_line(p1, 0, 0, 7, 15, 1);
+	gp_line(p2, 0, 15, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 15+1);
+
+	gp_line(p1, 0, 0, 7, 15, 1);
+	gp_line(p2, 7, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 16+1);
+
+	gp_line(p1, 0, 0, 7, 16, 1);
+	gp_line(p2, 0, 16, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 16+1);
+
+	gp_line(p1, 0, 0, 7, 16, 1);
+	gp_line(p2, 7, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 17+1);
+
+	gp_line(p1, 0, 0, 7, 17, 1);
+	gp_line(p2, 0, 17, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 17+1);
+
+	gp_line(p1, 0, 0, 7, 17, 1);
+	gp_line(p2, 7, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 18+1);
+
+	gp_line(p1, 0, 0, 7, 18, 1);
+	gp_line(p2, 0, 18, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 18+1);
+
+	gp_line(p1, 0, 0, 7, 18, 1);
+	gp_line(p2, 7, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 19+1);
+
+	gp_line(p1, 0, 0, 7, 19, 1);
+	gp_line(p2, 0, 19, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 19+1);
+
+	gp_line(p1, 0, 0, 7, 19, 1);
+	gp_line(p2, 7, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 20+1);
+
+	gp_line(p1, 0, 0, 7, 20, 1);
+	gp_line(p2, 0, 20, 7, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 7+1, 20+1);
+
+	gp_line(p1, 0, 0, 7, 20, 1);
+	gp_line(p2, 7, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_7_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(7, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 7, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 7, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 1+1);
+
+	gp_line(p1, 0, 0, 8, 1, 1);
+	gp_line(p2, 0, 1, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 1+1);
+
+	gp_line(p1, 0, 0, 8, 1, 1);
+	gp_line(p2, 8, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 2+1);
+
+	gp_line(p1, 0, 0, 8, 2, 1);
+	gp_line(p2, 0, 2, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 2+1);
+
+	gp_line(p1, 0, 0, 8, 2, 1);
+	gp_line(p2, 8, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 3+1);
+
+	gp_line(p1, 0, 0, 8, 3, 1);
+	gp_line(p2, 0, 3, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 3+1);
+
+	gp_line(p1, 0, 0, 8, 3, 1);
+	gp_line(p2, 8, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 4+1);
+
+	gp_line(p1, 0, 0, 8, 4, 1);
+	gp_line(p2, 0, 4, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 4+1);
+
+	gp_line(p1, 0, 0, 8, 4, 1);
+	gp_line(p2, 8, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 5+1);
+
+	gp_line(p1, 0, 0, 8, 5, 1);
+	gp_line(p2, 0, 5, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 5+1);
+
+	gp_line(p1, 0, 0, 8, 5, 1);
+	gp_line(p2, 8, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 6+1);
+
+	gp_line(p1, 0, 0, 8, 6, 1);
+	gp_line(p2, 0, 6, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 6+1);
+
+	gp_line(p1, 0, 0, 8, 6, 1);
+	gp_line(p2, 8, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 7+1);
+
+	gp_line(p1, 0, 0, 8, 7, 1);
+	gp_line(p2, 0, 7, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 7+1);
+
+	gp_line(p1, 0, 0, 8, 7, 1);
+	gp_line(p2, 8, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 8+1);
+
+	gp_line(p1, 0, 0, 8, 8, 1);
+	gp_line(p2, 0, 8, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 8+1);
+
+	gp_line(p1, 0, 0, 8, 8, 1);
+	gp_line(p2, 8, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 9+1);
+
+	gp_line(p1, 0, 0, 8, 9, 1);
+	gp_line(p2, 0, 9, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 9+1);
+
+	gp_line(p1, 0, 0, 8, 9, 1);
+	gp_line(p2, 8, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 10+1);
+
+	gp_line(p1, 0, 0, 8, 10, 1);
+	gp_line(p2, 0, 10, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 10+1);
+
+	gp_line(p1, 0, 0, 8, 10, 1);
+	gp_line(p2, 8, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 11+1);
+
+	gp_line(p1, 0, 0, 8, 11, 1);
+	gp_line(p2, 0, 11, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 11+1);
+
+	gp_line(p1, 0, 0, 8, 11, 1);
+	gp_line(p2, 8, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 12+1);
+
+	gp_line(p1, 0, 0, 8, 12, 1);
+	gp_line(p2, 0, 12, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 12+1);
+
+	gp_line(p1, 0, 0, 8, 12, 1);
+	gp_line(p2, 8, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 13+1);
+
+	gp_line(p1, 0, 0, 8, 13, 1);
+	gp_line(p2, 0, 13, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 13+1);
+
+	gp_line(p1, 0, 0, 8, 13, 1);
+	gp_line(p2, 8, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 14+1);
+
+	gp_line(p1, 0, 0, 8, 14, 1);
+	gp_line(p2, 0, 14, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 14+1);
+
+	gp_line(p1, 0, 0, 8, 14, 1);
+	gp_line(p2, 8, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 15+1);
+
+	gp_line(p1, 0, 0, 8, 15, 1);
+	gp_line(p2, 0, 15, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 15+1);
+
+	gp_line(p1, 0, 0, 8, 15, 1);
+	gp_line(p2, 8, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 16+1);
+
+	gp_line(p1, 0, 0, 8, 16, 1);
+	gp_line(p2, 0, 16, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 16+1);
+
+	gp_line(p1, 0, 0, 8, 16, 1);
+	gp_line(p2, 8, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 17+1);
+
+	gp_line(p1, 0, 0, 8, 17, 1);
+	gp_line(p2, 0, 17, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 17+1);
+
+	gp_line(p1, 0, 0, 8, 17, 1);
+	gp_line(p2, 8, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 18+1);
+
+	gp_line(p1, 0, 0, 8, 18, 1);
+	gp_line(p2, 0, 18, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 18+1);
+
+	gp_line(p1, 0, 0, 8, 18, 1);
+	gp_line(p2, 8, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 19+1);
+
+	gp_line(p1, 0, 0, 8, 19, 1);
+	gp_line(p2, 0, 19, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 19+1);
+
+	gp_line(p1, 0, 0, 8, 19, 1);
+	gp_line(p2, 8, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 20+1);
+
+	gp_line(p1, 0, 0, 8, 20, 1);
+	gp_line(p2, 0, 20, 8, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 20+1);
+
+	gp_line(p1, 0, 0, 8, 20, 1);
+	gp_line(p2, 8, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_8_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(8, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 8, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 8, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 1+1);
+
+	gp_line(p1, 0, 0, 9, 1, 1);
+	gp_line(p2, 0, 1, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 1+1);
+
+	gp_line(p1, 0, 0, 9, 1, 1);
+	gp_line(p2, 9, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 2+1);
+
+	gp_line(p1, 0, 0, 9, 2, 1);
+	gp_line(p2, 0, 2, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 2+1);
+
+	gp_line(p1, 0, 0, 9, 2, 1);
+	gp_line(p2, 9, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 3+1);
+
+	gp_line(p1, 0, 0, 9, 3, 1);
+	gp_line(p2, 0, 3, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 3+1);
+
+	gp_line(p1, 0, 0, 9, 3, 1);
+	gp_line(p2, 9, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 4+1);
+
+	gp_line(p1, 0, 0, 9, 4, 1);
+	gp_line(p2, 0, 4, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 4+1);
+
+	gp_line(p1, 0, 0, 9, 4, 1);
+	gp_line(p2, 9, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 5+1);
+
+	gp_line(p1, 0, 0, 9, 5, 1);
+	gp_line(p2, 0, 5, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 5+1);
+
+	gp_line(p1, 0, 0, 9, 5, 1);
+	gp_line(p2, 9, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 6+1);
+
+	gp_line(p1, 0, 0, 9, 6, 1);
+	gp_line(p2, 0, 6, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 6+1);
+
+	gp_line(p1, 0, 0, 9, 6, 1);
+	gp_line(p2, 9, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 7+1);
+
+	gp_line(p1, 0, 0, 9, 7, 1);
+	gp_line(p2, 0, 7, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 7+1);
+
+	gp_line(p1, 0, 0, 9, 7, 1);
+	gp_line(p2, 9, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 8+1);
+
+	gp_line(p1, 0, 0, 9, 8, 1);
+	gp_line(p2, 0, 8, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 8+1);
+
+	gp_line(p1, 0, 0, 9, 8, 1);
+	gp_line(p2, 9, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 9+1);
+
+	gp_line(p1, 0, 0, 9, 9, 1);
+	gp_line(p2, 0, 9, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 9+1);
+
+	gp_line(p1, 0, 0, 9, 9, 1);
+	gp_line(p2, 9, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 10+1);
+
+	gp_line(p1, 0, 0, 9, 10, 1);
+	gp_line(p2, 0, 10, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 10+1);
+
+	gp_line(p1, 0, 0, 9, 10, 1);
+	gp_line(p2, 9, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 11+1);
+
+	gp_line(p1, 0, 0, 9, 11, 1);
+	gp_line(p2, 0, 11, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 11+1);
+
+	gp_line(p1, 0, 0, 9, 11, 1);
+	gp_line(p2, 9, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 12+1);
+
+	gp_line(p1, 0, 0, 9, 12, 1);
+	gp_line(p2, 0, 12, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 12+1);
+
+	gp_line(p1, 0, 0, 9, 12, 1);
+	gp_line(p2, 9, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 13+1);
+
+	gp_line(p1, 0, 0, 9, 13, 1);
+	gp_line(p2, 0, 13, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 13+1);
+
+	gp_line(p1, 0, 0, 9, 13, 1);
+	gp_line(p2, 9, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 14+1);
+
+	gp_line(p1, 0, 0, 9, 14, 1);
+	gp_line(p2, 0, 14, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 14+1);
+
+	gp_line(p1, 0, 0, 9, 14, 1);
+	gp_line(p2, 9, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 15+1);
+
+	gp_line(p1, 0, 0, 9, 15, 1);
+	gp_line(p2, 0, 15, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 15+1);
+
+	gp_line(p1, 0, 0, 9, 15, 1);
+	gp_line(p2, 9, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 16+1);
+
+	gp_line(p1, 0, 0, 9, 16, 1);
+	gp_line(p2, 0, 16, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 16+1);
+
+	gp_line(p1, 0, 0, 9, 16, 1);
+	gp_line(p2, 9, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 17+1);
+
+	gp_line(p1, 0, 0, 9, 17, 1);
+	gp_line(p2, 0, 17, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 17+1);
+
+	gp_line(p1, 0, 0, 9, 17, 1);
+	gp_line(p2, 9, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 18+1);
+
+	gp_line(p1, 0, 0, 9, 18, 1);
+	gp_line(p2, 0, 18, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 18+1);
+
+	gp_line(p1, 0, 0, 9, 18, 1);
+	gp_line(p2, 9, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 19+1);
+
+	gp_line(p1, 0, 0, 9, 19, 1);
+	gp_line(p2, 0, 19, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 19+1);
+
+	gp_line(p1, 0, 0, 9, 19, 1);
+	gp_line(p2, 9, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 20+1);
+
+	gp_line(p1, 0, 0, 9, 20, 1);
+	gp_line(p2, 0, 20, 9, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 9+1, 20+1);
+
+	gp_line(p1, 0, 0, 9, 20, 1);
+	gp_line(p2, 9, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_9_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(9, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 9, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 9, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 1+1);
+
+	gp_line(p1, 0, 0, 10, 1, 1);
+	gp_line(p2, 0, 1, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 1+1);
+
+	gp_line(p1, 0, 0, 10, 1, 1);
+	gp_line(p2, 10, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 2+1);
+
+	gp_line(p1, 0, 0, 10, 2, 1);
+	gp_line(p2, 0, 2, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 2+1);
+
+	gp_line(p1, 0, 0, 10, 2, 1);
+	gp_line(p2, 10, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 3+1);
+
+	gp_line(p1, 0, 0, 10, 3, 1);
+	gp_line(p2, 0, 3, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 3+1);
+
+	gp_line(p1, 0, 0, 10, 3, 1);
+	gp_line(p2, 10, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 4+1);
+
+	gp_line(p1, 0, 0, 10, 4, 1);
+	gp_line(p2, 0, 4, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 4+1);
+
+	gp_line(p1, 0, 0, 10, 4, 1);
+	gp_line(p2, 10, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 5+1);
+
+	gp_line(p1, 0, 0, 10, 5, 1);
+	gp_line(p2, 0, 5, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 5+1);
+
+	gp_line(p1, 0, 0, 10, 5, 1);
+	gp_line(p2, 10, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 6+1);
+
+	gp_line(p1, 0, 0, 10, 6, 1);
+	gp_line(p2, 0, 6, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 6+1);
+
+	gp_line(p1, 0, 0, 10, 6, 1);
+	gp_line(p2, 10, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 7+1);
+
+	gp_line(p1, 0, 0, 10, 7, 1);
+	gp_line(p2, 0, 7, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 7+1);
+
+	gp_line(p1, 0, 0, 10, 7, 1);
+	gp_line(p2, 10, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 8+1);
+
+	gp_line(p1, 0, 0, 10, 8, 1);
+	gp_line(p2, 0, 8, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 8+1);
+
+	gp_line(p1, 0, 0, 10, 8, 1);
+	gp_line(p2, 10, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 9+1);
+
+	gp_line(p1, 0, 0, 10, 9, 1);
+	gp_line(p2, 0, 9, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 9+1);
+
+	gp_line(p1, 0, 0, 10, 9, 1);
+	gp_line(p2, 10, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 10+1);
+
+	gp_line(p1, 0, 0, 10, 10, 1);
+	gp_line(p2, 0, 10, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 10+1);
+
+	gp_line(p1, 0, 0, 10, 10, 1);
+	gp_line(p2, 10, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 11+1);
+
+	gp_line(p1, 0, 0, 10, 11, 1);
+	gp_line(p2, 0, 11, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 11+1);
+
+	gp_line(p1, 0, 0, 10, 11, 1);
+	gp_line(p2, 10, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 12+1);
+
+	gp_line(p1, 0, 0, 10, 12, 1);
+	gp_line(p2, 0, 12, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 12+1);
+
+	gp_line(p1, 0, 0, 10, 12, 1);
+	gp_line(p2, 10, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 13+1);
+
+	gp_line(p1, 0, 0, 10, 13, 1);
+	gp_line(p2, 0, 13, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 13+1);
+
+	gp_line(p1, 0, 0, 10, 13, 1);
+	gp_line(p2, 10, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 14+1);
+
+	gp_line(p1, 0, 0, 10, 14, 1);
+	gp_line(p2, 0, 14, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 14+1);
+
+	gp_line(p1, 0, 0, 10, 14, 1);
+	gp_line(p2, 10, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 15+1);
+
+	gp_line(p1, 0, 0, 10, 15, 1);
+	gp_line(p2, 0, 15, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 15+1);
+
+	gp_line(p1, 0, 0, 10, 15, 1);
+	gp_line(p2, 10, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 16+1);
+
+	gp_line(p1, 0, 0, 10, 16, 1);
+	gp_line(p2, 0, 16, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 16+1);
+
+	gp_line(p1, 0, 0, 10, 16, 1);
+	gp_line(p2, 10, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 17+1);
+
+	gp_line(p1, 0, 0, 10, 17, 1);
+	gp_line(p2, 0, 17, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 17+1);
+
+	gp_line(p1, 0, 0, 10, 17, 1);
+	gp_line(p2, 10, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 18+1);
+
+	gp_line(p1, 0, 0, 10, 18, 1);
+	gp_line(p2, 0, 18, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 18+1);
+
+	gp_line(p1, 0, 0, 10, 18, 1);
+	gp_line(p2, 10, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 19+1);
+
+	gp_line(p1, 0, 0, 10, 19, 1);
+	gp_line(p2, 0, 19, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 19+1);
+
+	gp_line(p1, 0, 0, 10, 19, 1);
+	gp_line(p2, 10, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 20+1);
+
+	gp_line(p1, 0, 0, 10, 20, 1);
+	gp_line(p2, 0, 20, 10, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 10+1, 20+1);
+
+	gp_line(p1, 0, 0, 10, 20, 1);
+	gp_line(p2, 10, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_10_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(10, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 10, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 10, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 1+1);
+
+	gp_line(p1, 0, 0, 11, 1, 1);
+	gp_line(p2, 0, 1, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 1+1);
+
+	gp_line(p1, 0, 0, 11, 1, 1);
+	gp_line(p2, 11, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 2+1);
+
+	gp_line(p1, 0, 0, 11, 2, 1);
+	gp_line(p2, 0, 2, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 2+1);
+
+	gp_line(p1, 0, 0, 11, 2, 1);
+	gp_line(p2, 11, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 3+1);
+
+	gp_line(p1, 0, 0, 11, 3, 1);
+	gp_line(p2, 0, 3, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 3+1);
+
+	gp_line(p1, 0, 0, 11, 3, 1);
+	gp_line(p2, 11, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 4+1);
+
+	gp_line(p1, 0, 0, 11, 4, 1);
+	gp_line(p2, 0, 4, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 4+1);
+
+	gp_line(p1, 0, 0, 11, 4, 1);
+	gp_line(p2, 11, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 5+1);
+
+	gp_line(p1, 0, 0, 11, 5, 1);
+	gp_line(p2, 0, 5, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 5+1);
+
+	gp_line(p1, 0, 0, 11, 5, 1);
+	gp_line(p2, 11, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 6+1);
+
+	gp_line(p1, 0, 0, 11, 6, 1);
+	gp_line(p2, 0, 6, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 6+1);
+
+	gp_line(p1, 0, 0, 11, 6, 1);
+	gp_line(p2, 11, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 7+1);
+
+	gp_line(p1, 0, 0, 11, 7, 1);
+	gp_line(p2, 0, 7, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 7+1);
+
+	gp_line(p1, 0, 0, 11, 7, 1);
+	gp_line(p2, 11, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 8+1);
+
+	gp_line(p1, 0, 0, 11, 8, 1);
+	gp_line(p2, 0, 8, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 8+1);
+
+	gp_line(p1, 0, 0, 11, 8, 1);
+	gp_line(p2, 11, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 9+1);
+
+	gp_line(p1, 0, 0, 11, 9, 1);
+	gp_line(p2, 0, 9, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 9+1);
+
+	gp_line(p1, 0, 0, 11, 9, 1);
+	gp_line(p2, 11, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 10+1);
+
+	gp_line(p1, 0, 0, 11, 10, 1);
+	gp_line(p2, 0, 10, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 10+1);
+
+	gp_line(p1, 0, 0, 11, 10, 1);
+	gp_line(p2, 11, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 11+1);
+
+	gp_line(p1, 0, 0, 11, 11, 1);
+	gp_line(p2, 0, 11, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 11+1);
+
+	gp_line(p1, 0, 0, 11, 11, 1);
+	gp_line(p2, 11, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 12+1);
+
+	gp_line(p1, 0, 0, 11, 12, 1);
+	gp_line(p2, 0, 12, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 12+1);
+
+	gp_line(p1, 0, 0, 11, 12, 1);
+	gp_line(p2, 11, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 13+1);
+
+	gp_line(p1, 0, 0, 11, 13, 1);
+	gp_line(p2, 0, 13, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 13+1);
+
+	gp_line(p1, 0, 0, 11, 13, 1);
+	gp_line(p2, 11, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 14+1);
+
+	gp_line(p1, 0, 0, 11, 14, 1);
+	gp_line(p2, 0, 14, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 14+1);
+
+	gp_line(p1, 0, 0, 11, 14, 1);
+	gp_line(p2, 11, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 15+1);
+
+	gp_line(p1, 0, 0, 11, 15, 1);
+	gp_line(p2, 0, 15, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 15+1);
+
+	gp_line(p1, 0, 0, 11, 15, 1);
+	gp_line(p2, 11, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 16+1);
+
+	gp_line(p1, 0, 0, 11, 16, 1);
+	gp_line(p2, 0, 16, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 16+1);
+
+	gp_line(p1, 0, 0, 11, 16, 1);
+	gp_line(p2, 11, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 17+1);
+
+	gp_line(p1, 0, 0, 11, 17, 1);
+	gp_line(p2, 0, 17, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 17+1);
+
+	gp_line(p1, 0, 0, 11, 17, 1);
+	gp_line(p2, 11, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 18+1);
+
+	gp_line(p1, 0, 0, 11, 18, 1);
+	gp_line(p2, 0, 18, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 18+1);
+
+	gp_line(p1, 0, 0, 11, 18, 1);
+	gp_line(p2, 11, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 19+1);
+
+	gp_line(p1, 0, 0, 11, 19, 1);
+	gp_line(p2, 0, 19, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 19+1);
+
+	gp_line(p1, 0, 0, 11, 19, 1);
+	gp_line(p2, 11, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 20+1);
+
+	gp_line(p1, 0, 0, 11, 20, 1);
+	gp_line(p2, 0, 20, 11, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 11+1, 20+1);
+
+	gp_line(p1, 0, 0, 11, 20, 1);
+	gp_line(p2, 11, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_11_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(11, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 11, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 11, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 1+1);
+
+	gp_line(p1, 0, 0, 12, 1, 1);
+	gp_line(p2, 0, 1, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 1+1);
+
+	gp_line(p1, 0, 0, 12, 1, 1);
+	gp_line(p2, 12, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 2+1);
+
+	gp_line(p1, 0, 0, 12, 2, 1);
+	gp_line(p2, 0, 2, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 2+1);
+
+	gp_line(p1, 0, 0, 12, 2, 1);
+	gp_line(p2, 12, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 3+1);
+
+	gp_line(p1, 0, 0, 12, 3, 1);
+	gp_line(p2, 0, 3, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 3+1);
+
+	gp_line(p1, 0, 0, 12, 3, 1);
+	gp_line(p2, 12, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 4+1);
+
+	gp_line(p1, 0, 0, 12, 4, 1);
+	gp_line(p2, 0, 4, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 4+1);
+
+	gp_line(p1, 0, 0, 12, 4, 1);
+	gp_line(p2, 12, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 5+1);
+
+	gp_line(p1, 0, 0, 12, 5, 1);
+	gp_line(p2, 0, 5, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 5+1);
+
+	gp_line(p1, 0, 0, 12, 5, 1);
+	gp_line(p2, 12, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 6+1);
+
+	gp_line(p1, 0, 0, 12, 6, 1);
+	gp_line(p2, 0, 6, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 6+1);
+
+	gp_line(p1, 0, 0, 12, 6, 1);
+	gp_line(p2, 12, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 7+1);
+
+	gp_line(p1, 0, 0, 12, 7, 1);
+	gp_line(p2, 0, 7, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 7+1);
+
+	gp_line(p1, 0, 0, 12, 7, 1);
+	gp_line(p2, 12, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 8+1);
+
+	gp_line(p1, 0, 0, 12, 8, 1);
+	gp_line(p2, 0, 8, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 8+1);
+
+	gp_line(p1, 0, 0, 12, 8, 1);
+	gp_line(p2, 12, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 9+1);
+
+	gp_line(p1, 0, 0, 12, 9, 1);
+	gp_line(p2, 0, 9, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 9+1);
+
+	gp_line(p1, 0, 0, 12, 9, 1);
+	gp_line(p2, 12, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 10+1);
+
+	gp_line(p1, 0, 0, 12, 10, 1);
+	gp_line(p2, 0, 10, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 10+1);
+
+	gp_line(p1, 0, 0, 12, 10, 1);
+	gp_line(p2, 12, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 11+1);
+
+	gp_line(p1, 0, 0, 12, 11, 1);
+	gp_line(p2, 0, 11, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 11+1);
+
+	gp_line(p1, 0, 0, 12, 11, 1);
+	gp_line(p2, 12, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 12+1);
+
+	gp_line(p1, 0, 0, 12, 12, 1);
+	gp_line(p2, 0, 12, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 12+1);
+
+	gp_line(p1, 0, 0, 12, 12, 1);
+	gp_line(p2, 12, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 13+1);
+
+	gp_line(p1, 0, 0, 12, 13, 1);
+	gp_line(p2, 0, 13, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 13+1);
+
+	gp_line(p1, 0, 0, 12, 13, 1);
+	gp_line(p2, 12, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 14+1);
+
+	gp_line(p1, 0, 0, 12, 14, 1);
+	gp_line(p2, 0, 14, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 14+1);
+
+	gp_line(p1, 0, 0, 12, 14, 1);
+	gp_line(p2, 12, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 15+1);
+
+	gp_line(p1, 0, 0, 12, 15, 1);
+	gp_line(p2, 0, 15, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 15+1);
+
+	gp_line(p1, 0, 0, 12, 15, 1);
+	gp_line(p2, 12, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 16+1);
+
+	gp_line(p1, 0, 0, 12, 16, 1);
+	gp_line(p2, 0, 16, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 16+1);
+
+	gp_line(p1, 0, 0, 12, 16, 1);
+	gp_line(p2, 12, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 17+1);
+
+	gp_line(p1, 0, 0, 12, 17, 1);
+	gp_line(p2, 0, 17, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 17+1);
+
+	gp_line(p1, 0, 0, 12, 17, 1);
+	gp_line(p2, 12, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 18+1);
+
+	gp_line(p1, 0, 0, 12, 18, 1);
+	gp_line(p2, 0, 18, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 18+1);
+
+	gp_line(p1, 0, 0, 12, 18, 1);
+	gp_line(p2, 12, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 19+1);
+
+	gp_line(p1, 0, 0, 12, 19, 1);
+	gp_line(p2, 0, 19, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 19+1);
+
+	gp_line(p1, 0, 0, 12, 19, 1);
+	gp_line(p2, 12, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 20+1);
+
+	gp_line(p1, 0, 0, 12, 20, 1);
+	gp_line(p2, 0, 20, 12, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 12+1, 20+1);
+
+	gp_line(p1, 0, 0, 12, 20, 1);
+	gp_line(p2, 12, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_12_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(12, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 12, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 12, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 1+1);
+
+	gp_line(p1, 0, 0, 13, 1, 1);
+	gp_line(p2, 0, 1, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 1+1);
+
+	gp_line(p1, 0, 0, 13, 1, 1);
+	gp_line(p2, 13, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 2+1);
+
+	gp_line(p1, 0, 0, 13, 2, 1);
+	gp_line(p2, 0, 2, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 2+1);
+
+	gp_line(p1, 0, 0, 13, 2, 1);
+	gp_line(p2, 13, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 3+1);
+
+	gp_line(p1, 0, 0, 13, 3, 1);
+	gp_line(p2, 0, 3, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 3+1);
+
+	gp_line(p1, 0, 0, 13, 3, 1);
+	gp_line(p2, 13, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 4+1);
+
+	gp_line(p1, 0, 0, 13, 4, 1);
+	gp_line(p2, 0, 4, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 4+1);
+
+	gp_line(p1, 0, 0, 13, 4, 1);
+	gp_line(p2, 13, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 5+1);
+
+	gp_line(p1, 0, 0, 13, 5, 1);
+	gp_line(p2, 0, 5, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 5+1);
+
+	gp_line(p1, 0, 0, 13, 5, 1);
+	gp_line(p2, 13, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 6+1);
+
+	gp_line(p1, 0, 0, 13, 6, 1);
+	gp_line(p2, 0, 6, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 6+1);
+
+	gp_line(p1, 0, 0, 13, 6, 1);
+	gp_line(p2, 13, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 7+1);
+
+	gp_line(p1, 0, 0, 13, 7, 1);
+	gp_line(p2, 0, 7, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 7+1);
+
+	gp_line(p1, 0, 0, 13, 7, 1);
+	gp_line(p2, 13, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 8+1);
+
+	gp_line(p1, 0, 0, 13, 8, 1);
+	gp_line(p2, 0, 8, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 8+1);
+
+	gp_line(p1, 0, 0, 13, 8, 1);
+	gp_line(p2, 13, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 9+1);
+
+	gp_line(p1, 0, 0, 13, 9, 1);
+	gp_line(p2, 0, 9, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 9+1);
+
+	gp_line(p1, 0, 0, 13, 9, 1);
+	gp_line(p2, 13, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 10+1);
+
+	gp_line(p1, 0, 0, 13, 10, 1);
+	gp_line(p2, 0, 10, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 10+1);
+
+	gp_line(p1, 0, 0, 13, 10, 1);
+	gp_line(p2, 13, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 11+1);
+
+	gp_line(p1, 0, 0, 13, 11, 1);
+	gp_line(p2, 0, 11, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 11+1);
+
+	gp_line(p1, 0, 0, 13, 11, 1);
+	gp_line(p2, 13, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 12+1);
+
+	gp_line(p1, 0, 0, 13, 12, 1);
+	gp_line(p2, 0, 12, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 12+1);
+
+	gp_line(p1, 0, 0, 13, 12, 1);
+	gp_line(p2, 13, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 13+1);
+
+	gp_line(p1, 0, 0, 13, 13, 1);
+	gp_line(p2, 0, 13, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 13+1);
+
+	gp_line(p1, 0, 0, 13, 13, 1);
+	gp_line(p2, 13, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 14+1);
+
+	gp_line(p1, 0, 0, 13, 14, 1);
+	gp_line(p2, 0, 14, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 14+1);
+
+	gp_line(p1, 0, 0, 13, 14, 1);
+	gp_line(p2, 13, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 15+1);
+
+	gp_line(p1, 0, 0, 13, 15, 1);
+	gp_line(p2, 0, 15, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 15+1);
+
+	gp_line(p1, 0, 0, 13, 15, 1);
+	gp_line(p2, 13, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 16+1);
+
+	gp_line(p1, 0, 0, 13, 16, 1);
+	gp_line(p2, 0, 16, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 16+1);
+
+	gp_line(p1, 0, 0, 13, 16, 1);
+	gp_line(p2, 13, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 17+1);
+
+	gp_line(p1, 0, 0, 13, 17, 1);
+	gp_line(p2, 0, 17, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 17+1);
+
+	gp_line(p1, 0, 0, 13, 17, 1);
+	gp_line(p2, 13, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 18+1);
+
+	gp_line(p1, 0, 0, 13, 18, 1);
+	gp_line(p2, 0, 18, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 18+1);
+
+	gp_line(p1, 0, 0, 13, 18, 1);
+	gp_line(p2, 13, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 19+1);
+
+	gp_line(p1, 0, 0, 13, 19, 1);
+	gp_line(p2, 0, 19, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 19+1);
+
+	gp_line(p1, 0, 0, 13, 19, 1);
+	gp_line(p2, 13, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 20+1);
+
+	gp_line(p1, 0, 0, 13, 20, 1);
+	gp_line(p2, 0, 20, 13, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 13+1, 20+1);
+
+	gp_line(p1, 0, 0, 13, 20, 1);
+	gp_line(p2, 13, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_13_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(13, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 13, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 13, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 1+1);
+
+	gp_line(p1, 0, 0, 14, 1, 1);
+	gp_line(p2, 0, 1, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 1+1);
+
+	gp_line(p1, 0, 0, 14, 1, 1);
+	gp_line(p2, 14, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 2+1);
+
+	gp_line(p1, 0, 0, 14, 2, 1);
+	gp_line(p2, 0, 2, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 2+1);
+
+	gp_line(p1, 0, 0, 14, 2, 1);
+	gp_line(p2, 14, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 3+1);
+
+	gp_line(p1, 0, 0, 14, 3, 1);
+	gp_line(p2, 0, 3, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 3+1);
+
+	gp_line(p1, 0, 0, 14, 3, 1);
+	gp_line(p2, 14, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 4+1);
+
+	gp_line(p1, 0, 0, 14, 4, 1);
+	gp_line(p2, 0, 4, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 4+1);
+
+	gp_line(p1, 0, 0, 14, 4, 1);
+	gp_line(p2, 14, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 5+1);
+
+	gp_line(p1, 0, 0, 14, 5, 1);
+	gp_line(p2, 0, 5, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 5+1);
+
+	gp_line(p1, 0, 0, 14, 5, 1);
+	gp_line(p2, 14, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 6+1);
+
+	gp_line(p1, 0, 0, 14, 6, 1);
+	gp_line(p2, 0, 6, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 6+1);
+
+	gp_line(p1, 0, 0, 14, 6, 1);
+	gp_line(p2, 14, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 7+1);
+
+	gp_line(p1, 0, 0, 14, 7, 1);
+	gp_line(p2, 0, 7, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 7+1);
+
+	gp_line(p1, 0, 0, 14, 7, 1);
+	gp_line(p2, 14, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 8+1);
+
+	gp_line(p1, 0, 0, 14, 8, 1);
+	gp_line(p2, 0, 8, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 8+1);
+
+	gp_line(p1, 0, 0, 14, 8, 1);
+	gp_line(p2, 14, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 9+1);
+
+	gp_line(p1, 0, 0, 14, 9, 1);
+	gp_line(p2, 0, 9, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 9+1);
+
+	gp_line(p1, 0, 0, 14, 9, 1);
+	gp_line(p2, 14, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 10+1);
+
+	gp_line(p1, 0, 0, 14, 10, 1);
+	gp_line(p2, 0, 10, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 10+1);
+
+	gp_line(p1, 0, 0, 14, 10, 1);
+	gp_line(p2, 14, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 11+1);
+
+	gp_line(p1, 0, 0, 14, 11, 1);
+	gp_line(p2, 0, 11, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 11+1);
+
+	gp_line(p1, 0, 0, 14, 11, 1);
+	gp_line(p2, 14, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 12+1);
+
+	gp_line(p1, 0, 0, 14, 12, 1);
+	gp_line(p2, 0, 12, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 12+1);
+
+	gp_line(p1, 0, 0, 14, 12, 1);
+	gp_line(p2, 14, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 13+1);
+
+	gp_line(p1, 0, 0, 14, 13, 1);
+	gp_line(p2, 0, 13, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 13+1);
+
+	gp_line(p1, 0, 0, 14, 13, 1);
+	gp_line(p2, 14, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 14+1);
+
+	gp_line(p1, 0, 0, 14, 14, 1);
+	gp_line(p2, 0, 14, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 14+1);
+
+	gp_line(p1, 0, 0, 14, 14, 1);
+	gp_line(p2, 14, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 15+1);
+
+	gp_line(p1, 0, 0, 14, 15, 1);
+	gp_line(p2, 0, 15, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 15+1);
+
+	gp_line(p1, 0, 0, 14, 15, 1);
+	gp_line(p2, 14, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 16+1);
+
+	gp_line(p1, 0, 0, 14, 16, 1);
+	gp_line(p2, 0, 16, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 16+1);
+
+	gp_line(p1, 0, 0, 14, 16, 1);
+	gp_line(p2, 14, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 17+1);
+
+	gp_line(p1, 0, 0, 14, 17, 1);
+	gp_line(p2, 0, 17, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 17+1);
+
+	gp_line(p1, 0, 0, 14, 17, 1);
+	gp_line(p2, 14, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 18+1);
+
+	gp_line(p1, 0, 0, 14, 18, 1);
+	gp_line(p2, 0, 18, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 18+1);
+
+	gp_line(p1, 0, 0, 14, 18, 1);
+	gp_line(p2, 14, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 19+1);
+
+	gp_line(p1, 0, 0, 14, 19, 1);
+	gp_line(p2, 0, 19, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 19+1);
+
+	gp_line(p1, 0, 0, 14, 19, 1);
+	gp_line(p2, 14, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 20+1);
+
+	gp_line(p1, 0, 0, 14, 20, 1);
+	gp_line(p2, 0, 20, 14, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 14+1, 20+1);
+
+	gp_line(p1, 0, 0, 14, 20, 1);
+	gp_line(p2, 14, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_14_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(14, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 14, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 14, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 1+1);
+
+	gp_line(p1, 0, 0, 15, 1, 1);
+	gp_line(p2, 0, 1, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 1+1);
+
+	gp_line(p1, 0, 0, 15, 1, 1);
+	gp_line(p2, 15, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 2+1);
+
+	gp_line(p1, 0, 0, 15, 2, 1);
+	gp_line(p2, 0, 2, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 2+1);
+
+	gp_line(p1, 0, 0, 15, 2, 1);
+	gp_line(p2, 15, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 3+1);
+
+	gp_line(p1, 0, 0, 15, 3, 1);
+	gp_line(p2, 0, 3, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 3+1);
+
+	gp_line(p1, 0, 0, 15, 3, 1);
+	gp_line(p2, 15, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 4+1);
+
+	gp_line(p1, 0, 0, 15, 4, 1);
+	gp_line(p2, 0, 4, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 4+1);
+
+	gp_line(p1, 0, 0, 15, 4, 1);
+	gp_line(p2, 15, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 5+1);
+
+	gp_line(p1, 0, 0, 15, 5, 1);
+	gp_line(p2, 0, 5, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 5+1);
+
+	gp_line(p1, 0, 0, 15, 5, 1);
+	gp_line(p2, 15, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 6+1);
+
+	gp_line(p1, 0, 0, 15, 6, 1);
+	gp_line(p2, 0, 6, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 6+1);
+
+	gp_line(p1, 0, 0, 15, 6, 1);
+	gp_line(p2, 15, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 7+1);
+
+	gp_line(p1, 0, 0, 15, 7, 1);
+	gp_line(p2, 0, 7, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 7+1);
+
+	gp_line(p1, 0, 0, 15, 7, 1);
+	gp_line(p2, 15, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 8+1);
+
+	gp_line(p1, 0, 0, 15, 8, 1);
+	gp_line(p2, 0, 8, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 8+1);
+
+	gp_line(p1, 0, 0, 15, 8, 1);
+	gp_line(p2, 15, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 9+1);
+
+	gp_line(p1, 0, 0, 15, 9, 1);
+	gp_line(p2, 0, 9, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 9+1);
+
+	gp_line(p1, 0, 0, 15, 9, 1);
+	gp_line(p2, 15, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 10+1);
+
+	gp_line(p1, 0, 0, 15, 10, 1);
+	gp_line(p2, 0, 10, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 10+1);
+
+	gp_line(p1, 0, 0, 15, 10, 1);
+	gp_line(p2, 15, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 11+1);
+
+	gp_line(p1, 0, 0, 15, 11, 1);
+	gp_line(p2, 0, 11, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 11+1);
+
+	gp_line(p1, 0, 0, 15, 11, 1);
+	gp_line(p2, 15, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 12+1);
+
+	gp_line(p1, 0, 0, 15, 12, 1);
+	gp_line(p2, 0, 12, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 12+1);
+
+	gp_line(p1, 0, 0, 15, 12, 1);
+	gp_line(p2, 15, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 13+1);
+
+	gp_line(p1, 0, 0, 15, 13, 1);
+	gp_line(p2, 0, 13, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 13+1);
+
+	gp_line(p1, 0, 0, 15, 13, 1);
+	gp_line(p2, 15, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 14+1);
+
+	gp_line(p1, 0, 0, 15, 14, 1);
+	gp_line(p2, 0, 14, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 14+1);
+
+	gp_line(p1, 0, 0, 15, 14, 1);
+	gp_line(p2, 15, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 15+1);
+
+	gp_line(p1, 0, 0, 15, 15, 1);
+	gp_line(p2, 0, 15, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 15+1);
+
+	gp_line(p1, 0, 0, 15, 15, 1);
+	gp_line(p2, 15, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 16+1);
+
+	gp_line(p1, 0, 0, 15, 16, 1);
+	gp_line(p2, 0, 16, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 16+1);
+
+	gp_line(p1, 0, 0, 15, 16, 1);
+	gp_line(p2, 15, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 17+1);
+
+	gp_line(p1, 0, 0, 15, 17, 1);
+	gp_line(p2, 0, 17, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 17+1);
+
+	gp_line(p1, 0, 0, 15, 17, 1);
+	gp_line(p2, 15, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 18+1);
+
+	gp_line(p1, 0, 0, 15, 18, 1);
+	gp_line(p2, 0, 18, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 18+1);
+
+	gp_line(p1, 0, 0, 15, 18, 1);
+	gp_line(p2, 15, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 19+1);
+
+	gp_line(p1, 0, 0, 15, 19, 1);
+	gp_line(p2, 0, 19, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 19+1);
+
+	gp_line(p1, 0, 0, 15, 19, 1);
+	gp_line(p2, 15, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 20+1);
+
+	gp_line(p1, 0, 0, 15, 20, 1);
+	gp_line(p2, 0, 20, 15, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 15+1, 20+1);
+
+	gp_line(p1, 0, 0, 15, 20, 1);
+	gp_line(p2, 15, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_15_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(15, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 15, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 15, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 1+1);
+
+	gp_line(p1, 0, 0, 16, 1, 1);
+	gp_line(p2, 0, 1, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 1+1);
+
+	gp_line(p1, 0, 0, 16, 1, 1);
+	gp_line(p2, 16, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 2+1);
+
+	gp_line(p1, 0, 0, 16, 2, 1);
+	gp_line(p2, 0, 2, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 2+1);
+
+	gp_line(p1, 0, 0, 16, 2, 1);
+	gp_line(p2, 16, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 3+1);
+
+	gp_line(p1, 0, 0, 16, 3, 1);
+	gp_line(p2, 0, 3, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 3+1);
+
+	gp_line(p1, 0, 0, 16, 3, 1);
+	gp_line(p2, 16, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 4+1);
+
+	gp_line(p1, 0, 0, 16, 4, 1);
+	gp_line(p2, 0, 4, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 4+1);
+
+	gp_line(p1, 0, 0, 16, 4, 1);
+	gp_line(p2, 16, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 5+1);
+
+	gp_line(p1, 0, 0, 16, 5, 1);
+	gp_line(p2, 0, 5, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 5+1);
+
+	gp_line(p1, 0, 0, 16, 5, 1);
+	gp_line(p2, 16, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 6+1);
+
+	gp_line(p1, 0, 0, 16, 6, 1);
+	gp_line(p2, 0, 6, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 6+1);
+
+	gp_line(p1, 0, 0, 16, 6, 1);
+	gp_line(p2, 16, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 7+1);
+
+	gp_line(p1, 0, 0, 16, 7, 1);
+	gp_line(p2, 0, 7, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 7+1);
+
+	gp_line(p1, 0, 0, 16, 7, 1);
+	gp_line(p2, 16, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 8+1);
+
+	gp_line(p1, 0, 0, 16, 8, 1);
+	gp_line(p2, 0, 8, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 8+1);
+
+	gp_line(p1, 0, 0, 16, 8, 1);
+	gp_line(p2, 16, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 9+1);
+
+	gp_line(p1, 0, 0, 16, 9, 1);
+	gp_line(p2, 0, 9, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 9+1);
+
+	gp_line(p1, 0, 0, 16, 9, 1);
+	gp_line(p2, 16, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 10+1);
+
+	gp_line(p1, 0, 0, 16, 10, 1);
+	gp_line(p2, 0, 10, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 10+1);
+
+	gp_line(p1, 0, 0, 16, 10, 1);
+	gp_line(p2, 16, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 11+1);
+
+	gp_line(p1, 0, 0, 16, 11, 1);
+	gp_line(p2, 0, 11, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 11+1);
+
+	gp_line(p1, 0, 0, 16, 11, 1);
+	gp_line(p2, 16, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 12+1);
+
+	gp_line(p1, 0, 0, 16, 12, 1);
+	gp_line(p2, 0, 12, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 12+1);
+
+	gp_line(p1, 0, 0, 16, 12, 1);
+	gp_line(p2, 16, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 13+1);
+
+	gp_line(p1, 0, 0, 16, 13, 1);
+	gp_line(p2, 0, 13, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 13+1);
+
+	gp_line(p1, 0, 0, 16, 13, 1);
+	gp_line(p2, 16, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 14+1);
+
+	gp_line(p1, 0, 0, 16, 14, 1);
+	gp_line(p2, 0, 14, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 14+1);
+
+	gp_line(p1, 0, 0, 16, 14, 1);
+	gp_line(p2, 16, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 15+1);
+
+	gp_line(p1, 0, 0, 16, 15, 1);
+	gp_line(p2, 0, 15, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 15+1);
+
+	gp_line(p1, 0, 0, 16, 15, 1);
+	gp_line(p2, 16, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 16+1);
+
+	gp_line(p1, 0, 0, 16, 16, 1);
+	gp_line(p2, 0, 16, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 16+1);
+
+	gp_line(p1, 0, 0, 16, 16, 1);
+	gp_line(p2, 16, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 17+1);
+
+	gp_line(p1, 0, 0, 16, 17, 1);
+	gp_line(p2, 0, 17, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 17+1);
+
+	gp_line(p1, 0, 0, 16, 17, 1);
+	gp_line(p2, 16, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 18+1);
+
+	gp_line(p1, 0, 0, 16, 18, 1);
+	gp_line(p2, 0, 18, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 18+1);
+
+	gp_line(p1, 0, 0, 16, 18, 1);
+	gp_line(p2, 16, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 19+1);
+
+	gp_line(p1, 0, 0, 16, 19, 1);
+	gp_line(p2, 0, 19, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 19+1);
+
+	gp_line(p1, 0, 0, 16, 19, 1);
+	gp_line(p2, 16, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 20+1);
+
+	gp_line(p1, 0, 0, 16, 20, 1);
+	gp_line(p2, 0, 20, 16, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 16+1, 20+1);
+
+	gp_line(p1, 0, 0, 16, 20, 1);
+	gp_line(p2, 16, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_16_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(16, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 16, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 16, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 1+1);
+
+	gp_line(p1, 0, 0, 17, 1, 1);
+	gp_line(p2, 0, 1, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 1+1);
+
+	gp_line(p1, 0, 0, 17, 1, 1);
+	gp_line(p2, 17, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 2+1);
+
+	gp_line(p1, 0, 0, 17, 2, 1);
+	gp_line(p2, 0, 2, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 2+1);
+
+	gp_line(p1, 0, 0, 17, 2, 1);
+	gp_line(p2, 17, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 3+1);
+
+	gp_line(p1, 0, 0, 17, 3, 1);
+	gp_line(p2, 0, 3, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 3+1);
+
+	gp_line(p1, 0, 0, 17, 3, 1);
+	gp_line(p2, 17, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 4+1);
+
+	gp_line(p1, 0, 0, 17, 4, 1);
+	gp_line(p2, 0, 4, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 4+1);
+
+	gp_line(p1, 0, 0, 17, 4, 1);
+	gp_line(p2, 17, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 5+1);
+
+	gp_line(p1, 0, 0, 17, 5, 1);
+	gp_line(p2, 0, 5, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 5+1);
+
+	gp_line(p1, 0, 0, 17, 5, 1);
+	gp_line(p2, 17, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 6+1);
+
+	gp_line(p1, 0, 0, 17, 6, 1);
+	gp_line(p2, 0, 6, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 6+1);
+
+	gp_line(p1, 0, 0, 17, 6, 1);
+	gp_line(p2, 17, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 7+1);
+
+	gp_line(p1, 0, 0, 17, 7, 1);
+	gp_line(p2, 0, 7, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 7+1);
+
+	gp_line(p1, 0, 0, 17, 7, 1);
+	gp_line(p2, 17, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 8+1);
+
+	gp_line(p1, 0, 0, 17, 8, 1);
+	gp_line(p2, 0, 8, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 8+1);
+
+	gp_line(p1, 0, 0, 17, 8, 1);
+	gp_line(p2, 17, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 9+1);
+
+	gp_line(p1, 0, 0, 17, 9, 1);
+	gp_line(p2, 0, 9, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 9+1);
+
+	gp_line(p1, 0, 0, 17, 9, 1);
+	gp_line(p2, 17, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 10+1);
+
+	gp_line(p1, 0, 0, 17, 10, 1);
+	gp_line(p2, 0, 10, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 10+1);
+
+	gp_line(p1, 0, 0, 17, 10, 1);
+	gp_line(p2, 17, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 11+1);
+
+	gp_line(p1, 0, 0, 17, 11, 1);
+	gp_line(p2, 0, 11, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 11+1);
+
+	gp_line(p1, 0, 0, 17, 11, 1);
+	gp_line(p2, 17, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 12+1);
+
+	gp_line(p1, 0, 0, 17, 12, 1);
+	gp_line(p2, 0, 12, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 12+1);
+
+	gp_line(p1, 0, 0, 17, 12, 1);
+	gp_line(p2, 17, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 13+1);
+
+	gp_line(p1, 0, 0, 17, 13, 1);
+	gp_line(p2, 0, 13, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 13+1);
+
+	gp_line(p1, 0, 0, 17, 13, 1);
+	gp_line(p2, 17, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 14+1);
+
+	gp_line(p1, 0, 0, 17, 14, 1);
+	gp_line(p2, 0, 14, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 14+1);
+
+	gp_line(p1, 0, 0, 17, 14, 1);
+	gp_line(p2, 17, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 15+1);
+
+	gp_line(p1, 0, 0, 17, 15, 1);
+	gp_line(p2, 0, 15, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 15+1);
+
+	gp_line(p1, 0, 0, 17, 15, 1);
+	gp_line(p2, 17, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 16+1);
+
+	gp_line(p1, 0, 0, 17, 16, 1);
+	gp_line(p2, 0, 16, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 16+1);
+
+	gp_line(p1, 0, 0, 17, 16, 1);
+	gp_line(p2, 17, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 17+1);
+
+	gp_line(p1, 0, 0, 17, 17, 1);
+	gp_line(p2, 0, 17, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 17+1);
+
+	gp_line(p1, 0, 0, 17, 17, 1);
+	gp_line(p2, 17, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 18+1);
+
+	gp_line(p1, 0, 0, 17, 18, 1);
+	gp_line(p2, 0, 18, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 18+1);
+
+	gp_line(p1, 0, 0, 17, 18, 1);
+	gp_line(p2, 17, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 19+1);
+
+	gp_line(p1, 0, 0, 17, 19, 1);
+	gp_line(p2, 0, 19, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 19+1);
+
+	gp_line(p1, 0, 0, 17, 19, 1);
+	gp_line(p2, 17, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 20+1);
+
+	gp_line(p1, 0, 0, 17, 20, 1);
+	gp_line(p2, 0, 20, 17, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 17+1, 20+1);
+
+	gp_line(p1, 0, 0, 17, 20, 1);
+	gp_line(p2, 17, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_17_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(17, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 17, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 17, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 1+1);
+
+	gp_line(p1, 0, 0, 18, 1, 1);
+	gp_line(p2, 0, 1, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 1+1);
+
+	gp_line(p1, 0, 0, 18, 1, 1);
+	gp_line(p2, 18, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 2+1);
+
+	gp_line(p1, 0, 0, 18, 2, 1);
+	gp_line(p2, 0, 2, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 2+1);
+
+	gp_line(p1, 0, 0, 18, 2, 1);
+	gp_line(p2, 18, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 3+1);
+
+	gp_line(p1, 0, 0, 18, 3, 1);
+	gp_line(p2, 0, 3, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 3+1);
+
+	gp_line(p1, 0, 0, 18, 3, 1);
+	gp_line(p2, 18, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 4+1);
+
+	gp_line(p1, 0, 0, 18, 4, 1);
+	gp_line(p2, 0, 4, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 4+1);
+
+	gp_line(p1, 0, 0, 18, 4, 1);
+	gp_line(p2, 18, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 5+1);
+
+	gp_line(p1, 0, 0, 18, 5, 1);
+	gp_line(p2, 0, 5, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 5+1);
+
+	gp_line(p1, 0, 0, 18, 5, 1);
+	gp_line(p2, 18, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 6+1);
+
+	gp_line(p1, 0, 0, 18, 6, 1);
+	gp_line(p2, 0, 6, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 6+1);
+
+	gp_line(p1, 0, 0, 18, 6, 1);
+	gp_line(p2, 18, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 7+1);
+
+	gp_line(p1, 0, 0, 18, 7, 1);
+	gp_line(p2, 0, 7, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 7+1);
+
+	gp_line(p1, 0, 0, 18, 7, 1);
+	gp_line(p2, 18, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 8+1);
+
+	gp_line(p1, 0, 0, 18, 8, 1);
+	gp_line(p2, 0, 8, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 8+1);
+
+	gp_line(p1, 0, 0, 18, 8, 1);
+	gp_line(p2, 18, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 9+1);
+
+	gp_line(p1, 0, 0, 18, 9, 1);
+	gp_line(p2, 0, 9, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 9+1);
+
+	gp_line(p1, 0, 0, 18, 9, 1);
+	gp_line(p2, 18, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 10+1);
+
+	gp_line(p1, 0, 0, 18, 10, 1);
+	gp_line(p2, 0, 10, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 10+1);
+
+	gp_line(p1, 0, 0, 18, 10, 1);
+	gp_line(p2, 18, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 11+1);
+
+	gp_line(p1, 0, 0, 18, 11, 1);
+	gp_line(p2, 0, 11, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 11+1);
+
+	gp_line(p1, 0, 0, 18, 11, 1);
+	gp_line(p2, 18, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 12+1);
+
+	gp_line(p1, 0, 0, 18, 12, 1);
+	gp_line(p2, 0, 12, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 12+1);
+
+	gp_line(p1, 0, 0, 18, 12, 1);
+	gp_line(p2, 18, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 13+1);
+
+	gp_line(p1, 0, 0, 18, 13, 1);
+	gp_line(p2, 0, 13, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 13+1);
+
+	gp_line(p1, 0, 0, 18, 13, 1);
+	gp_line(p2, 18, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 14+1);
+
+	gp_line(p1, 0, 0, 18, 14, 1);
+	gp_line(p2, 0, 14, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 14+1);
+
+	gp_line(p1, 0, 0, 18, 14, 1);
+	gp_line(p2, 18, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 15+1);
+
+	gp_line(p1, 0, 0, 18, 15, 1);
+	gp_line(p2, 0, 15, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 15+1);
+
+	gp_line(p1, 0, 0, 18, 15, 1);
+	gp_line(p2, 18, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 16+1);
+
+	gp_line(p1, 0, 0, 18, 16, 1);
+	gp_line(p2, 0, 16, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 16+1);
+
+	gp_line(p1, 0, 0, 18, 16, 1);
+	gp_line(p2, 18, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 17+1);
+
+	gp_line(p1, 0, 0, 18, 17, 1);
+	gp_line(p2, 0, 17, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 17+1);
+
+	gp_line(p1, 0, 0, 18, 17, 1);
+	gp_line(p2, 18, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 18+1);
+
+	gp_line(p1, 0, 0, 18, 18, 1);
+	gp_line(p2, 0, 18, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 18+1);
+
+	gp_line(p1, 0, 0, 18, 18, 1);
+	gp_line(p2, 18, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 19+1);
+
+	gp_line(p1, 0, 0, 18, 19, 1);
+	gp_line(p2, 0, 19, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 19+1);
+
+	gp_line(p1, 0, 0, 18, 19, 1);
+	gp_line(p2, 18, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 20+1);
+
+	gp_line(p1, 0, 0, 18, 20, 1);
+	gp_line(p2, 0, 20, 18, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 18+1, 20+1);
+
+	gp_line(p1, 0, 0, 18, 20, 1);
+	gp_line(p2, 18, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_18_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(18, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 18, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 18, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 1+1);
+
+	gp_line(p1, 0, 0, 19, 1, 1);
+	gp_line(p2, 0, 1, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 1+1);
+
+	gp_line(p1, 0, 0, 19, 1, 1);
+	gp_line(p2, 19, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 2+1);
+
+	gp_line(p1, 0, 0, 19, 2, 1);
+	gp_line(p2, 0, 2, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 2+1);
+
+	gp_line(p1, 0, 0, 19, 2, 1);
+	gp_line(p2, 19, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 3+1);
+
+	gp_line(p1, 0, 0, 19, 3, 1);
+	gp_line(p2, 0, 3, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 3+1);
+
+	gp_line(p1, 0, 0, 19, 3, 1);
+	gp_line(p2, 19, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 4+1);
+
+	gp_line(p1, 0, 0, 19, 4, 1);
+	gp_line(p2, 0, 4, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 4+1);
+
+	gp_line(p1, 0, 0, 19, 4, 1);
+	gp_line(p2, 19, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 5+1);
+
+	gp_line(p1, 0, 0, 19, 5, 1);
+	gp_line(p2, 0, 5, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 5+1);
+
+	gp_line(p1, 0, 0, 19, 5, 1);
+	gp_line(p2, 19, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 6+1);
+
+	gp_line(p1, 0, 0, 19, 6, 1);
+	gp_line(p2, 0, 6, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 6+1);
+
+	gp_line(p1, 0, 0, 19, 6, 1);
+	gp_line(p2, 19, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 7+1);
+
+	gp_line(p1, 0, 0, 19, 7, 1);
+	gp_line(p2, 0, 7, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 7+1);
+
+	gp_line(p1, 0, 0, 19, 7, 1);
+	gp_line(p2, 19, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 8+1);
+
+	gp_line(p1, 0, 0, 19, 8, 1);
+	gp_line(p2, 0, 8, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 8+1);
+
+	gp_line(p1, 0, 0, 19, 8, 1);
+	gp_line(p2, 19, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 9+1);
+
+	gp_line(p1, 0, 0, 19, 9, 1);
+	gp_line(p2, 0, 9, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 9+1);
+
+	gp_line(p1, 0, 0, 19, 9, 1);
+	gp_line(p2, 19, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 10+1);
+
+	gp_line(p1, 0, 0, 19, 10, 1);
+	gp_line(p2, 0, 10, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 10+1);
+
+	gp_line(p1, 0, 0, 19, 10, 1);
+	gp_line(p2, 19, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 11+1);
+
+	gp_line(p1, 0, 0, 19, 11, 1);
+	gp_line(p2, 0, 11, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 11+1);
+
+	gp_line(p1, 0, 0, 19, 11, 1);
+	gp_line(p2, 19, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 12+1);
+
+	gp_line(p1, 0, 0, 19, 12, 1);
+	gp_line(p2, 0, 12, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 12+1);
+
+	gp_line(p1, 0, 0, 19, 12, 1);
+	gp_line(p2, 19, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 13+1);
+
+	gp_line(p1, 0, 0, 19, 13, 1);
+	gp_line(p2, 0, 13, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 13+1);
+
+	gp_line(p1, 0, 0, 19, 13, 1);
+	gp_line(p2, 19, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 14+1);
+
+	gp_line(p1, 0, 0, 19, 14, 1);
+	gp_line(p2, 0, 14, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 14+1);
+
+	gp_line(p1, 0, 0, 19, 14, 1);
+	gp_line(p2, 19, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 15+1);
+
+	gp_line(p1, 0, 0, 19, 15, 1);
+	gp_line(p2, 0, 15, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 15+1);
+
+	gp_line(p1, 0, 0, 19, 15, 1);
+	gp_line(p2, 19, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 16+1);
+
+	gp_line(p1, 0, 0, 19, 16, 1);
+	gp_line(p2, 0, 16, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 16+1);
+
+	gp_line(p1, 0, 0, 19, 16, 1);
+	gp_line(p2, 19, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 17+1);
+
+	gp_line(p1, 0, 0, 19, 17, 1);
+	gp_line(p2, 0, 17, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 17+1);
+
+	gp_line(p1, 0, 0, 19, 17, 1);
+	gp_line(p2, 19, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 18+1);
+
+	gp_line(p1, 0, 0, 19, 18, 1);
+	gp_line(p2, 0, 18, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 18+1);
+
+	gp_line(p1, 0, 0, 19, 18, 1);
+	gp_line(p2, 19, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 19+1);
+
+	gp_line(p1, 0, 0, 19, 19, 1);
+	gp_line(p2, 0, 19, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 19+1);
+
+	gp_line(p1, 0, 0, 19, 19, 1);
+	gp_line(p2, 19, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 20+1);
+
+	gp_line(p1, 0, 0, 19, 20, 1);
+	gp_line(p2, 0, 20, 19, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 19+1, 20+1);
+
+	gp_line(p1, 0, 0, 19, 20, 1);
+	gp_line(p2, 19, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_19_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(19, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 19, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 19, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_1_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 1+1);
+
+	gp_line(p1, 0, 0, 20, 1, 1);
+	gp_line(p2, 0, 1, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_1_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 1+1);
+
+	gp_line(p1, 0, 0, 20, 1, 1);
+	gp_line(p2, 20, 0, 0, 1, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_1_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 1) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 1, 1);
+	gp_line(p2, 0, w-1, 1, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_2_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 2+1);
+
+	gp_line(p1, 0, 0, 20, 2, 1);
+	gp_line(p2, 0, 2, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_2_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 2+1);
+
+	gp_line(p1, 0, 0, 20, 2, 1);
+	gp_line(p2, 20, 0, 0, 2, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_2_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 2) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 2, 1);
+	gp_line(p2, 0, w-1, 2, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_3_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 3+1);
+
+	gp_line(p1, 0, 0, 20, 3, 1);
+	gp_line(p2, 0, 3, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_3_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 3+1);
+
+	gp_line(p1, 0, 0, 20, 3, 1);
+	gp_line(p2, 20, 0, 0, 3, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_3_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 3) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 3, 1);
+	gp_line(p2, 0, w-1, 3, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_4_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 4+1);
+
+	gp_line(p1, 0, 0, 20, 4, 1);
+	gp_line(p2, 0, 4, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_4_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 4+1);
+
+	gp_line(p1, 0, 0, 20, 4, 1);
+	gp_line(p2, 20, 0, 0, 4, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_4_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 4) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 4, 1);
+	gp_line(p2, 0, w-1, 4, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_5_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 5+1);
+
+	gp_line(p1, 0, 0, 20, 5, 1);
+	gp_line(p2, 0, 5, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_5_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 5+1);
+
+	gp_line(p1, 0, 0, 20, 5, 1);
+	gp_line(p2, 20, 0, 0, 5, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_5_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 5) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 5, 1);
+	gp_line(p2, 0, w-1, 5, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_6_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 6+1);
+
+	gp_line(p1, 0, 0, 20, 6, 1);
+	gp_line(p2, 0, 6, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_6_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 6+1);
+
+	gp_line(p1, 0, 0, 20, 6, 1);
+	gp_line(p2, 20, 0, 0, 6, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_6_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 6) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 6, 1);
+	gp_line(p2, 0, w-1, 6, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_7_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 7+1);
+
+	gp_line(p1, 0, 0, 20, 7, 1);
+	gp_line(p2, 0, 7, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_7_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 7+1);
+
+	gp_line(p1, 0, 0, 20, 7, 1);
+	gp_line(p2, 20, 0, 0, 7, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_7_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 7) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 7, 1);
+	gp_line(p2, 0, w-1, 7, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_8_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 8+1);
+
+	gp_line(p1, 0, 0, 20, 8, 1);
+	gp_line(p2, 0, 8, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_8_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 8+1);
+
+	gp_line(p1, 0, 0, 20, 8, 1);
+	gp_line(p2, 20, 0, 0, 8, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_8_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 8) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 8, 1);
+	gp_line(p2, 0, w-1, 8, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_9_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 9+1);
+
+	gp_line(p1, 0, 0, 20, 9, 1);
+	gp_line(p2, 0, 9, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_9_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 9+1);
+
+	gp_line(p1, 0, 0, 20, 9, 1);
+	gp_line(p2, 20, 0, 0, 9, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_9_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 9) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 9, 1);
+	gp_line(p2, 0, w-1, 9, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_10_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 10+1);
+
+	gp_line(p1, 0, 0, 20, 10, 1);
+	gp_line(p2, 0, 10, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_10_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 10+1);
+
+	gp_line(p1, 0, 0, 20, 10, 1);
+	gp_line(p2, 20, 0, 0, 10, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_10_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 10) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 10, 1);
+	gp_line(p2, 0, w-1, 10, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_11_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 11+1);
+
+	gp_line(p1, 0, 0, 20, 11, 1);
+	gp_line(p2, 0, 11, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_11_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 11+1);
+
+	gp_line(p1, 0, 0, 20, 11, 1);
+	gp_line(p2, 20, 0, 0, 11, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_11_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 11) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 11, 1);
+	gp_line(p2, 0, w-1, 11, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_12_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 12+1);
+
+	gp_line(p1, 0, 0, 20, 12, 1);
+	gp_line(p2, 0, 12, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_12_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 12+1);
+
+	gp_line(p1, 0, 0, 20, 12, 1);
+	gp_line(p2, 20, 0, 0, 12, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_12_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 12) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 12, 1);
+	gp_line(p2, 0, w-1, 12, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_13_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 13+1);
+
+	gp_line(p1, 0, 0, 20, 13, 1);
+	gp_line(p2, 0, 13, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_13_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 13+1);
+
+	gp_line(p1, 0, 0, 20, 13, 1);
+	gp_line(p2, 20, 0, 0, 13, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_13_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 13) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 13, 1);
+	gp_line(p2, 0, w-1, 13, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_14_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 14+1);
+
+	gp_line(p1, 0, 0, 20, 14, 1);
+	gp_line(p2, 0, 14, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_14_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 14+1);
+
+	gp_line(p1, 0, 0, 20, 14, 1);
+	gp_line(p2, 20, 0, 0, 14, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_14_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 14) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 14, 1);
+	gp_line(p2, 0, w-1, 14, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_15_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 15+1);
+
+	gp_line(p1, 0, 0, 20, 15, 1);
+	gp_line(p2, 0, 15, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_15_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 15+1);
+
+	gp_line(p1, 0, 0, 20, 15, 1);
+	gp_line(p2, 20, 0, 0, 15, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_15_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 15) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 15, 1);
+	gp_line(p2, 0, w-1, 15, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_16_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 16+1);
+
+	gp_line(p1, 0, 0, 20, 16, 1);
+	gp_line(p2, 0, 16, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_16_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 16+1);
+
+	gp_line(p1, 0, 0, 20, 16, 1);
+	gp_line(p2, 20, 0, 0, 16, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_16_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 16) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 16, 1);
+	gp_line(p2, 0, w-1, 16, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_17_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 17+1);
+
+	gp_line(p1, 0, 0, 20, 17, 1);
+	gp_line(p2, 0, 17, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_17_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 17+1);
+
+	gp_line(p1, 0, 0, 20, 17, 1);
+	gp_line(p2, 20, 0, 0, 17, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_17_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 17) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 17, 1);
+	gp_line(p2, 0, w-1, 17, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_18_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 18+1);
+
+	gp_line(p1, 0, 0, 20, 18, 1);
+	gp_line(p2, 0, 18, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_18_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 18+1);
+
+	gp_line(p1, 0, 0, 20, 18, 1);
+	gp_line(p2, 20, 0, 0, 18, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_18_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 18) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 18, 1);
+	gp_line(p2, 0, w-1, 18, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_19_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 19+1);
+
+	gp_line(p1, 0, 0, 20, 19, 1);
+	gp_line(p2, 0, 19, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_19_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 19+1);
+
+	gp_line(p1, 0, 0, 20, 19, 1);
+	gp_line(p2, 20, 0, 0, 19, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_19_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 19) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 19, 1);
+	gp_line(p2, 0, w-1, 19, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_20_h(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 20+1);
+
+	gp_line(p1, 0, 0, 20, 20, 1);
+	gp_line(p2, 0, 20, 20, 0, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_20_v(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 20+1, 20+1);
+
+	gp_line(p1, 0, 0, 20, 20, 1);
+	gp_line(p2, 20, 0, 0, 20, 1);
+
+	gp_filter_mirror_v(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int line_20_20_rot(void)
+{
+	gp_pixmap *p1, *p2;
+	gp_size w = GP_MAX(20, 20) + 1;
+
+	prep(&p1, &p2, w, w);
+
+	gp_line(p1, 0, 0, 20, 20, 1);
+	gp_line(p2, 0, w-1, 20, w - 1 - 20, 1);
+	p2 = gp_filter_rotate_90_alloc(p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Line symmetry testsuite",
+	.tests = {
+		{.name = "line_h 0, 0, 1, 1 vs 0, 1, 1, 0",
+		 .tst_fn = line_1_1_h},
+		{.name = "line_v 0, 0, 1, 1 vs 1, 0, 0, 1",
+		 .tst_fn = line_1_1_v},
+		{.name = "line 0, 0, 1, 1 rot 90",
+		 .tst_fn = line_1_1_rot},
+		{.name = "line_h 0, 0, 1, 2 vs 0, 2, 1, 0",
+		 .tst_fn = line_1_2_h},
+		{.name = "line_v 0, 0, 1, 2 vs 1, 0, 0, 2",
+		 .tst_fn = line_1_2_v},
+		{.name = "line 0, 0, 1, 2 rot 90",
+		 .tst_fn = line_1_2_rot},
+		{.name = "line_h 0, 0, 1, 3 vs 0, 3, 1, 0",
+		 .tst_fn = line_1_3_h},
+		{.name = "line_v 0, 0, 1, 3 vs 1, 0, 0, 3",
+		 .tst_fn = line_1_3_v},
+		{.name = "line 0, 0, 1, 3 rot 90",
+		 .tst_fn = line_1_3_rot},
+		{.name = "line_h 0, 0, 1, 4 vs 0, 4, 1, 0",
+		 .tst_fn = line_1_4_h},
+		{.name = "line_v 0, 0, 1, 4 vs 1, 0, 0, 4",
+		 .tst_fn = line_1_4_v},
+		{.name = "line 0, 0, 1, 4 rot 90",
+		 .tst_fn = line_1_4_rot},
+		{.name = "line_h 0, 0, 1, 5 vs 0, 5, 1, 0",
+		 .tst_fn = line_1_5_h},
+		{.name = "line_v 0, 0, 1, 5 vs 1, 0, 0, 5",
+		 .tst_fn = line_1_5_v},
+		{.name = "line 0, 0, 1, 5 rot 90",
+		 .tst_fn = line_1_5_rot},
+		{.name = "line_h 0, 0, 1, 6 vs 0, 6, 1, 0",
+		 .tst_fn = line_1_6_h},
+		{.name = "line_v 0, 0, 1, 6 vs 1, 0, 0, 6",
+		 .tst_fn = line_1_6_v},
+		{.name = "line 0, 0, 1, 6 rot 90",
+		 .tst_fn = line_1_6_rot},
+		{.name = "line_h 0, 0, 1, 7 vs 0, 7, 1, 0",
+		 .tst_fn = line_1_7_h},
+		{.name = "line_v 0, 0, 1, 7 vs 1, 0, 0, 7",
+		 .tst_fn = line_1_7_v},
+		{.name = "line 0, 0, 1, 7 rot 90",
+		 .tst_fn = line_1_7_rot},
+		{.name = "line_h 0, 0, 1, 8 vs 0, 8, 1, 0",
+		 .tst_fn = line_1_8_h},
+		{.name = "line_v 0, 0, 1, 8 vs 1, 0, 0, 8",
+		 .tst_fn = line_1_8_v},
+		{.name = "line 0, 0, 1, 8 rot 90",
+		 .tst_fn = line_1_8_rot},
+		{.name = "line_h 0, 0, 1, 9 vs 0, 9, 1, 0",
+		 .tst_fn = line_1_9_h},
+		{.name = "line_v 0, 0, 1, 9 vs 1, 0, 0, 9",
+		 .tst_fn = line_1_9_v},
+		{.name = "line 0, 0, 1, 9 rot 90",
+		 .tst_fn = line_1_9_rot},
+		{.name = "line_h 0, 0, 1, 10 vs 0, 10, 1, 0",
+		 .tst_fn = line_1_10_h},
+		{.name = "line_v 0, 0, 1, 10 vs 1, 0, 0, 10",
+		 .tst_fn = line_1_10_v},
+		{.name = "line 0, 0, 1, 10 rot 90",
+		 .tst_fn = line_1_10_rot},
+		{.name = "line_h 0, 0, 1, 11 vs 0, 11, 1, 0",
+		 .tst_fn = line_1_11_h},
+		{.name = "line_v 0, 0, 1, 11 vs 1, 0, 0, 11",
+		 .tst_fn = line_1_11_v},
+		{.name = "line 0, 0, 1, 11 rot 90",
+		 .tst_fn = line_1_11_rot},
+		{.name = "line_h 0, 0, 1, 12 vs 0, 12, 1, 0",
+		 .tst_fn = line_1_12_h},
+		{.name = "line_v 0, 0, 1, 12 vs 1, 0, 0, 12",
+		 .tst_fn = line_1_12_v},
+		{.name = "line 0, 0, 1, 12 rot 90",
+		 .tst_fn = line_1_12_rot},
+		{.name = "line_h 0, 0, 1, 13 vs 0, 13, 1, 0",
+		 .tst_fn = line_1_13_h},
+		{.name = "line_v 0, 0, 1, 13 vs 1, 0, 0, 13",
+		 .tst_fn = line_1_13_v},
+		{.name = "line 0, 0, 1, 13 rot 90",
+		 .tst_fn = line_1_13_rot},
+		{.name = "line_h 0, 0, 1, 14 vs 0, 14, 1, 0",
+		 .tst_fn = line_1_14_h},
+		{.name = "line_v 0, 0, 1, 14 vs 1, 0, 0, 14",
+		 .tst_fn = line_1_14_v},
+		{.name = "line 0, 0, 1, 14 rot 90",
+		 .tst_fn = line_1_14_rot},
+		{.name = "line_h 0, 0, 1, 15 vs 0, 15, 1, 0",
+		 .tst_fn = line_1_15_h},
+		{.name = "line_v 0, 0, 1, 15 vs 1, 0, 0, 15",
+		 .tst_fn = line_1_15_v},
+		{.name = "line 0, 0, 1, 15 rot 90",
+		 .tst_fn = line_1_15_rot},
+		{.name = "line_h 0, 0, 1, 16 vs 0, 16, 1, 0",
+		 .tst_fn = line_1_16_h},
+		{.name = "line_v 0, 0, 1, 16 vs 1, 0, 0, 16",
+		 .tst_fn = line_1_16_v},
+		{.name = "line 0, 0, 1, 16 rot 90",
+		 .tst_fn = line_1_16_rot},
+		{.name = "line_h 0, 0, 1, 17 vs 0, 17, 1, 0",
+		 .tst_fn = line_1_17_h},
+		{.name = "line_v 0, 0, 1, 17 vs 1, 0, 0, 17",
+		 .tst_fn = line_1_17_v},
+		{.name = "line 0, 0, 1, 17 rot 90",
+		 .tst_fn = line_1_17_rot},
+		{.name = "line_h 0, 0, 1, 18 vs 0, 18, 1, 0",
+		 .tst_fn = line_1_18_h},
+		{.name = "line_v 0, 0, 1, 18 vs 1, 0, 0, 18",
+		 .tst_fn = line_1_18_v},
+		{.name = "line 0, 0, 1, 18 rot 90",
+		 .tst_fn = line_1_18_rot},
+		{.name = "line_h 0, 0, 1, 19 vs 0, 19, 1, 0",
+		 .tst_fn = line_1_19_h},
+		{.name = "line_v 0, 0, 1, 19 vs 1, 0, 0, 19",
+		 .tst_fn = line_1_19_v},
+		{.name = "line 0, 0, 1, 19 rot 90",
+		 .tst_fn = line_1_19_rot},
+		{.name = "line_h 0, 0, 1, 20 vs 0, 20, 1, 0",
+		 .tst_fn = line_1_20_h},
+		{.name = "line_v 0, 0, 1, 20 vs 1, 0, 0, 20",
+		 .tst_fn = line_1_20_v},
+		{.name = "line 0, 0, 1, 20 rot 90",
+		 .tst_fn = line_1_20_rot},
+		{.name = "line_h 0, 0, 2, 1 vs 0, 1, 2, 0",
+		 .tst_fn = line_2_1_h},
+		{.name = "line_v 0, 0, 2, 1 vs 2, 0, 0, 1",
+		 .tst_fn = line_2_1_v},
+		{.name = "line 0, 0, 2, 1 rot 90",
+		 .tst_fn = line_2_1_rot},
+		{.name = "line_h 0, 0, 2, 2 vs 0, 2, 2, 0",
+		 .tst_fn = line_2_2_h},
+		{.name = "line_v 0, 0, 2, 2 vs 2, 0, 0, 2",
+		 .tst_fn = line_2_2_v},
+		{.name = "line 0, 0, 2, 2 rot 90",
+		 .tst_fn = line_2_2_rot},
+		{.name = "line_h 0, 0, 2, 3 vs 0, 3, 2, 0",
+		 .tst_fn = line_2_3_h},
+		{.name = "line_v 0, 0, 2, 3 vs 2, 0, 0, 3",
+		 .tst_fn = line_2_3_v},
+		{.name = "line 0, 0, 2, 3 rot 90",
+		 .tst_fn = line_2_3_rot},
+		{.name = "line_h 0, 0, 2, 4 vs 0, 4, 2, 0",
+		 .tst_fn = line_2_4_h},
+		{.name = "line_v 0, 0, 2, 4 vs 2, 0, 0, 4",
+		 .tst_fn = line_2_4_v},
+		{.name = "line 0, 0, 2, 4 rot 90",
+		 .tst_fn = line_2_4_rot},
+		{.name = "line_h 0, 0, 2, 5 vs 0, 5, 2, 0",
+		 .tst_fn = line_2_5_h},
+		{.name = "line_v 0, 0, 2, 5 vs 2, 0, 0, 5",
+		 .tst_fn = line_2_5_v},
+		{.name = "line 0, 0, 2, 5 rot 90",
+		 .tst_fn = line_2_5_rot},
+		{.name = "line_h 0, 0, 2, 6 vs 0, 6, 2, 0",
+		 .tst_fn = line_2_6_h},
+		{.name = "line_v 0, 0, 2, 6 vs 2, 0, 0, 6",
+		 .tst_fn = line_2_6_v},
+		{.name = "line 0, 0, 2, 6 rot 90",
+		 .tst_fn = line_2_6_rot},
+		{.name = "line_h 0, 0, 2, 7 vs 0, 7, 2, 0",
+		 .tst_fn = line_2_7_h},
+		{.name = "line_v 0, 0, 2, 7 vs 2, 0, 0, 7",
+		 .tst_fn = line_2_7_v},
+		{.name = "line 0, 0, 2, 7 rot 90",
+		 .tst_fn = line_2_7_rot},
+		{.name = "line_h 0, 0, 2, 8 vs 0, 8, 2, 0",
+		 .tst_fn = line_2_8_h},
+		{.name = "line_v 0, 0, 2, 8 vs 2, 0, 0, 8",
+		 .tst_fn = line_2_8_v},
+		{.name = "line 0, 0, 2, 8 rot 90",
+		 .tst_fn = line_2_8_rot},
+		{.name = "line_h 0, 0, 2, 9 vs 0, 9, 2, 0",
+		 .tst_fn = line_2_9_h},
+		{.name = "line_v 0, 0, 2, 9 vs 2, 0, 0, 9",
+		 .tst_fn = line_2_9_v},
+		{.name = "line 0, 0, 2, 9 rot 90",
+		 .tst_fn = line_2_9_rot},
+		{.name = "line_h 0, 0, 2, 10 vs 0, 10, 2, 0",
+		 .tst_fn = line_2_10_h},
+		{.name = "line_v 0, 0, 2, 10 vs 2, 0, 0, 10",
+		 .tst_fn = line_2_10_v},
+		{.name = "line 0, 0, 2, 10 rot 90",
+		 .tst_fn = line_2_10_rot},
+		{.name = "line_h 0, 0, 2, 11 vs 0, 11, 2, 0",
+		 .tst_fn = line_2_11_h},
+		{.name = "line_v 0, 0, 2, 11 vs 2, 0, 0, 11",
+		 .tst_fn = line_2_11_v},
+		{.name = "line 0, 0, 2, 11 rot 90",
+		 .tst_fn = line_2_11_rot},
+		{.name = "line_h 0, 0, 2, 12 vs 0, 12, 2, 0",
+		 .tst_fn = line_2_12_h},
+		{.name = "line_v 0, 0, 2, 12 vs 2, 0, 0, 12",
+		 .tst_fn = line_2_12_v},
+		{.name = "line 0, 0, 2, 12 rot 90",
+		 .tst_fn = line_2_12_rot},
+		{.name = "line_h 0, 0, 2, 13 vs 0, 13, 2, 0",
+		 .tst_fn = line_2_13_h},
+		{.name = "line_v 0, 0, 2, 13 vs 2, 0, 0, 13",
+		 .tst_fn = line_2_13_v},
+		{.name = "line 0, 0, 2, 13 rot 90",
+		 .tst_fn = line_2_13_rot},
+		{.name = "line_h 0, 0, 2, 14 vs 0, 14, 2, 0",
+		 .tst_fn = line_2_14_h},
+		{.name = "line_v 0, 0, 2, 14 vs 2, 0, 0, 14",
+		 .tst_fn = line_2_14_v},
+		{.name = "line 0, 0, 2, 14 rot 90",
+		 .tst_fn = line_2_14_rot},
+		{.name = "line_h 0, 0, 2, 15 vs 0, 15, 2, 0",
+		 .tst_fn = line_2_15_h},
+		{.name = "line_v 0, 0, 2, 15 vs 2, 0, 0, 15",
+		 .tst_fn = line_2_15_v},
+		{.name = "line 0, 0, 2, 15 rot 90",
+		 .tst_fn = line_2_15_rot},
+		{.name = "line_h 0, 0, 2, 16 vs 0, 16, 2, 0",
+		 .tst_fn = line_2_16_h},
+		{.name = "line_v 0, 0, 2, 16 vs 2, 0, 0, 16",
+		 .tst_fn = line_2_16_v},
+		{.name = "line 0, 0, 2, 16 rot 90",
+		 .tst_fn = line_2_16_rot},
+		{.name = "line_h 0, 0, 2, 17 vs 0, 17, 2, 0",
+		 .tst_fn = line_2_17_h},
+		{.name = "line_v 0, 0, 2, 17 vs 2, 0, 0, 17",
+		 .tst_fn = line_2_17_v},
+		{.name = "line 0, 0, 2, 17 rot 90",
+		 .tst_fn = line_2_17_rot},
+		{.name = "line_h 0, 0, 2, 18 vs 0, 18, 2, 0",
+		 .tst_fn = line_2_18_h},
+		{.name = "line_v 0, 0, 2, 18 vs 2, 0, 0, 18",
+		 .tst_fn = line_2_18_v},
+		{.name = "line 0, 0, 2, 18 rot 90",
+		 .tst_fn = line_2_18_rot},
+		{.name = "line_h 0, 0, 2, 19 vs 0, 19, 2, 0",
+		 .tst_fn = line_2_19_h},
+		{.name = "line_v 0, 0, 2, 19 vs 2, 0, 0, 19",
+		 .tst_fn = line_2_19_v},
+		{.name = "line 0, 0, 2, 19 rot 90",
+		 .tst_fn = line_2_19_rot},
+		{.name = "line_h 0, 0, 2, 20 vs 0, 20, 2, 0",
+		 .tst_fn = line_2_20_h},
+		{.name = "line_v 0, 0, 2, 20 vs 2, 0, 0, 20",
+		 .tst_fn = line_2_20_v},
+		{.name = "line 0, 0, 2, 20 rot 90",
+		 .tst_fn = line_2_20_rot},
+		{.name = "line_h 0, 0, 3, 1 vs 0, 1, 3, 0",
+		 .tst_fn = line_3_1_h},
+		{.name = "line_v 0, 0, 3, 1 vs 3, 0, 0, 1",
+		 .tst_fn = line_3_1_v},
+		{.name = "line 0, 0, 3, 1 rot 90",
+		 .tst_fn = line_3_1_rot},
+		{.name = "line_h 0, 0, 3, 2 vs 0, 2, 3, 0",
+		 .tst_fn = line_3_2_h},
+		{.name = "line_v 0, 0, 3, 2 vs 3, 0, 0, 2",
+		 .tst_fn = line_3_2_v},
+		{.name = "line 0, 0, 3, 2 rot 90",
+		 .tst_fn = line_3_2_rot},
+		{.name = "line_h 0, 0, 3, 3 vs 0, 3, 3, 0",
+		 .tst_fn = line_3_3_h},
+		{.name = "line_v 0, 0, 3, 3 vs 3, 0, 0, 3",
+		 .tst_fn = line_3_3_v},
+		{.name = "line 0, 0, 3, 3 rot 90",
+		 .tst_fn = line_3_3_rot},
+		{.name = "line_h 0, 0, 3, 4 vs 0, 4, 3, 0",
+		 .tst_fn = line_3_4_h},
+		{.name = "line_v 0, 0, 3, 4 vs 3, 0, 0, 4",
+		 .tst_fn = line_3_4_v},
+		{.name = "line 0, 0, 3, 4 rot 90",
+		 .tst_fn = line_3_4_rot},
+		{.name = "line_h 0, 0, 3, 5 vs 0, 5, 3, 0",
+		 .tst_fn = line_3_5_h},
+		{.name = "line_v 0, 0, 3, 5 vs 3, 0, 0, 5",
+		 .tst_fn = line_3_5_v},
+		{.name = "line 0, 0, 3, 5 rot 90",
+		 .tst_fn = line_3_5_rot},
+		{.name = "line_h 0, 0, 3, 6 vs 0, 6, 3, 0",
+		 .tst_fn = line_3_6_h},
+		{.name = "line_v 0, 0, 3, 6 vs 3, 0, 0, 6",
+		 .tst_fn = line_3_6_v},
+		{.name = "line 0, 0, 3, 6 rot 90",
+		 .tst_fn = line_3_6_rot},
+		{.name = "line_h 0, 0, 3, 7 vs 0, 7, 3, 0",
+		 .tst_fn = line_3_7_h},
+		{.name = "line_v 0, 0, 3, 7 vs 3, 0, 0, 7",
+		 .tst_fn = line_3_7_v},
+		{.name = "line 0, 0, 3, 7 rot 90",
+		 .tst_fn = line_3_7_rot},
+		{.name = "line_h 0, 0, 3, 8 vs 0, 8, 3, 0",
+		 .tst_fn = line_3_8_h},
+		{.name = "line_v 0, 0, 3, 8 vs 3, 0, 0, 8",
+		 .tst_fn = line_3_8_v},
+		{.name = "line 0, 0, 3, 8 rot 90",
+		 .tst_fn = line_3_8_rot},
+		{.name = "line_h 0, 0, 3, 9 vs 0, 9, 3, 0",
+		 .tst_fn = line_3_9_h},
+		{.name = "line_v 0, 0, 3, 9 vs 3, 0, 0, 9",
+		 .tst_fn = line_3_9_v},
+		{.name = "line 0, 0, 3, 9 rot 90",
+		 .tst_fn = line_3_9_rot},
+		{.name = "line_h 0, 0, 3, 10 vs 0, 10, 3, 0",
+		 .tst_fn = line_3_10_h},
+		{.name = "line_v 0, 0, 3, 10 vs 3, 0, 0, 10",
+		 .tst_fn = line_3_10_v},
+		{.name = "line 0, 0, 3, 10 rot 90",
+		 .tst_fn = line_3_10_rot},
+		{.name = "line_h 0, 0, 3, 11 vs 0, 11, 3, 0",
+		 .tst_fn = line_3_11_h},
+		{.name = "line_v 0, 0, 3, 11 vs 3, 0, 0, 11",
+		 .tst_fn = line_3_11_v},
+		{.name = "line 0, 0, 3, 11 rot 90",
+		 .tst_fn = line_3_11_rot},
+		{.name = "line_h 0, 0, 3, 12 vs 0, 12, 3, 0",
+		 .tst_fn = line_3_12_h},
+		{.name = "line_v 0, 0, 3, 12 vs 3, 0, 0, 12",
+		 .tst_fn = line_3_12_v},
+		{.name = "line 0, 0, 3, 12 rot 90",
+		 .tst_fn = line_3_12_rot},
+		{.name = "line_h 0, 0, 3, 13 vs 0, 13, 3, 0",
+		 .tst_fn = line_3_13_h},
+		{.name = "line_v 0, 0, 3, 13 vs 3, 0, 0, 13",
+		 .tst_fn = line_3_13_v},
+		{.name = "line 0, 0, 3, 13 rot 90",
+		 .tst_fn = line_3_13_rot},
+		{.name = "line_h 0, 0, 3, 14 vs 0, 14, 3, 0",
+		 .tst_fn = line_3_14_h},
+		{.name = "line_v 0, 0, 3, 14 vs 3, 0, 0, 14",
+		 .tst_fn = line_3_14_v},
+		{.name = "line 0, 0, 3, 14 rot 90",
+		 .tst_fn = line_3_14_rot},
+		{.name = "line_h 0, 0, 3, 15 vs 0, 15, 3, 0",
+		 .tst_fn = line_3_15_h},
+		{.name = "line_v 0, 0, 3, 15 vs 3, 0, 0, 15",
+		 .tst_fn = line_3_15_v},
+		{.name = "line 0, 0, 3, 15 rot 90",
+		 .tst_fn = line_3_15_rot},
+		{.name = "line_h 0, 0, 3, 16 vs 0, 16, 3, 0",
+		 .tst_fn = line_3_16_h},
+		{.name = "line_v 0, 0, 3, 16 vs 3, 0, 0, 16",
+		 .tst_fn = line_3_16_v},
+		{.name = "line 0, 0, 3, 16 rot 90",
+		 .tst_fn = line_3_16_rot},
+		{.name = "line_h 0, 0, 3, 17 vs 0, 17, 3, 0",
+		 .tst_fn = line_3_17_h},
+		{.name = "line_v 0, 0, 3, 17 vs 3, 0, 0, 17",
+		 .tst_fn = line_3_17_v},
+		{.name = "line 0, 0, 3, 17 rot 90",
+		 .tst_fn = line_3_17_rot},
+		{.name = "line_h 0, 0, 3, 18 vs 0, 18, 3, 0",
+		 .tst_fn = line_3_18_h},
+		{.name = "line_v 0, 0, 3, 18 vs 3, 0, 0, 18",
+		 .tst_fn = line_3_18_v},
+		{.name = "line 0, 0, 3, 18 rot 90",
+		 .tst_fn = line_3_18_rot},
+		{.name = "line_h 0, 0, 3, 19 vs 0, 19, 3, 0",
+		 .tst_fn = line_3_19_h},
+		{.name = "line_v 0, 0, 3, 19 vs 3, 0, 0, 19",
+		 .tst_fn = line_3_19_v},
+		{.name = "line 0, 0, 3, 19 rot 90",
+		 .tst_fn = line_3_19_rot},
+		{.name = "line_h 0, 0, 3, 20 vs 0, 20, 3, 0",
+		 .tst_fn = line_3_20_h},
+		{.name = "line_v 0, 0, 3, 20 vs 3, 0, 0, 20",
+		 .tst_fn = line_3_20_v},
+		{.name = "line 0, 0, 3, 20 rot 90",
+		 .tst_fn = line_3_20_rot},
+		{.name = "line_h 0, 0, 4, 1 vs 0, 1, 4, 0",
+		 .tst_fn = line_4_1_h},
+		{.name = "line_v 0, 0, 4, 1 vs 4, 0, 0, 1",
+		 .tst_fn = line_4_1_v},
+		{.name = "line 0, 0, 4, 1 rot 90",
+		 .tst_fn = line_4_1_rot},
+		{.name = "line_h 0, 0, 4, 2 vs 0, 2, 4, 0",
+		 .tst_fn = line_4_2_h},
+		{.name = "line_v 0, 0, 4, 2 vs 4, 0, 0, 2",
+		 .tst_fn = line_4_2_v},
+		{.name = "line 0, 0, 4, 2 rot 90",
+		 .tst_fn = line_4_2_rot},
+		{.name = "line_h 0, 0, 4, 3 vs 0, 3, 4, 0",
+		 .tst_fn = line_4_3_h},
+		{.name = "line_v 0, 0, 4, 3 vs 4, 0, 0, 3",
+		 .tst_fn = line_4_3_v},
+		{.name = "line 0, 0, 4, 3 rot 90",
+		 .tst_fn = line_4_3_rot},
+		{.name = "line_h 0, 0, 4, 4 vs 0, 4, 4, 0",
+		 .tst_fn = line_4_4_h},
+		{.name = "line_v 0, 0, 4, 4 vs 4, 0, 0, 4",
+		 .tst_fn = line_4_4_v},
+		{.name = "line 0, 0, 4, 4 rot 90",
+		 .tst_fn = line_4_4_rot},
+		{.name = "line_h 0, 0, 4, 5 vs 0, 5, 4, 0",
+		 .tst_fn = line_4_5_h},
+		{.name = "line_v 0, 0, 4, 5 vs 4, 0, 0, 5",
+		 .tst_fn = line_4_5_v},
+		{.name = "line 0, 0, 4, 5 rot 90",
+		 .tst_fn = line_4_5_rot},
+		{.name = "line_h 0, 0, 4, 6 vs 0, 6, 4, 0",
+		 .tst_fn = line_4_6_h},
+		{.name = "line_v 0, 0, 4, 6 vs 4, 0, 0, 6",
+		 .tst_fn = line_4_6_v},
+		{.name = "line 0, 0, 4, 6 rot 90",
+		 .tst_fn = line_4_6_rot},
+		{.name = "line_h 0, 0, 4, 7 vs 0, 7, 4, 0",
+		 .tst_fn = line_4_7_h},
+		{.name = "line_v 0, 0, 4, 7 vs 4, 0, 0, 7",
+		 .tst_fn = line_4_7_v},
+		{.name = "line 0, 0, 4, 7 rot 90",
+		 .tst_fn = line_4_7_rot},
+		{.name = "line_h 0, 0, 4, 8 vs 0, 8, 4, 0",
+		 .tst_fn = line_4_8_h},
+		{.name = "line_v 0, 0, 4, 8 vs 4, 0, 0, 8",
+		 .tst_fn = line_4_8_v},
+		{.name = "line 0, 0, 4, 8 rot 90",
+		 .tst_fn = line_4_8_rot},
+		{.name = "line_h 0, 0, 4, 9 vs 0, 9, 4, 0",
+		 .tst_fn = line_4_9_h},
+		{.name = "line_v 0, 0, 4, 9 vs 4, 0, 0, 9",
+		 .tst_fn = line_4_9_v},
+		{.name = "line 0, 0, 4, 9 rot 90",
+		 .tst_fn = line_4_9_rot},
+		{.name = "line_h 0, 0, 4, 10 vs 0, 10, 4, 0",
+		 .tst_fn = line_4_10_h},
+		{.name = "line_v 0, 0, 4, 10 vs 4, 0, 0, 10",
+		 .tst_fn = line_4_10_v},
+		{.name = "line 0, 0, 4, 10 rot 90",
+		 .tst_fn = line_4_10_rot},
+		{.name = "line_h 0, 0, 4, 11 vs 0, 11, 4, 0",
+		 .tst_fn = line_4_11_h},
+		{.name = "line_v 0, 0, 4, 11 vs 4, 0, 0, 11",
+		 .tst_fn = line_4_11_v},
+		{.name = "line 0, 0, 4, 11 rot 90",
+		 .tst_fn = line_4_11_rot},
+		{.name = "line_h 0, 0, 4, 12 vs 0, 12, 4, 0",
+		 .tst_fn = line_4_12_h},
+		{.name = "line_v 0, 0, 4, 12 vs 4, 0, 0, 12",
+		 .tst_fn = line_4_12_v},
+		{.name = "line 0, 0, 4, 12 rot 90",
+		 .tst_fn = line_4_12_rot},
+		{.name = "line_h 0, 0, 4, 13 vs 0, 13, 4, 0",
+		 .tst_fn = line_4_13_h},
+		{.name = "line_v 0, 0, 4, 13 vs 4, 0, 0, 13",
+		 .tst_fn = line_4_13_v},
+		{.name = "line 0, 0, 4, 13 rot 90",
+		 .tst_fn = line_4_13_rot},
+		{.name = "line_h 0, 0, 4, 14 vs 0, 14, 4, 0",
+		 .tst_fn = line_4_14_h},
+		{.name = "line_v 0, 0, 4, 14 vs 4, 0, 0, 14",
+		 .tst_fn = line_4_14_v},
+		{.name = "line 0, 0, 4, 14 rot 90",
+		 .tst_fn = line_4_14_rot},
+		{.name = "line_h 0, 0, 4, 15 vs 0, 15, 4, 0",
+		 .tst_fn = line_4_15_h},
+		{.name = "line_v 0, 0, 4, 15 vs 4, 0, 0, 15",
+		 .tst_fn = line_4_15_v},
+		{.name = "line 0, 0, 4, 15 rot 90",
+		 .tst_fn = line_4_15_rot},
+		{.name = "line_h 0, 0, 4, 16 vs 0, 16, 4, 0",
+		 .tst_fn = line_4_16_h},
+		{.name = "line_v 0, 0, 4, 16 vs 4, 0, 0, 16",
+		 .tst_fn = line_4_16_v},
+		{.name = "line 0, 0, 4, 16 rot 90",
+		 .tst_fn = line_4_16_rot},
+		{.name = "line_h 0, 0, 4, 17 vs 0, 17, 4, 0",
+		 .tst_fn = line_4_17_h},
+		{.name = "line_v 0, 0, 4, 17 vs 4, 0, 0, 17",
+		 .tst_fn = line_4_17_v},
+		{.name = "line 0, 0, 4, 17 rot 90",
+		 .tst_fn = line_4_17_rot},
+		{.name = "line_h 0, 0, 4, 18 vs 0, 18, 4, 0",
+		 .tst_fn = line_4_18_h},
+		{.name = "line_v 0, 0, 4, 18 vs 4, 0, 0, 18",
+		 .tst_fn = line_4_18_v},
+		{.name = "line 0, 0, 4, 18 rot 90",
+		 .tst_fn = line_4_18_rot},
+		{.name = "line_h 0, 0, 4, 19 vs 0, 19, 4, 0",
+		 .tst_fn = line_4_19_h},
+		{.name = "line_v 0, 0, 4, 19 vs 4, 0, 0, 19",
+		 .tst_fn = line_4_19_v},
+		{.name = "line 0, 0, 4, 19 rot 90",
+		 .tst_fn = line_4_19_rot},
+		{.name = "line_h 0, 0, 4, 20 vs 0, 20, 4, 0",
+		 .tst_fn = line_4_20_h},
+		{.name = "line_v 0, 0, 4, 20 vs 4, 0, 0, 20",
+		 .tst_fn = line_4_20_v},
+		{.name = "line 0, 0, 4, 20 rot 90",
+		 .tst_fn = line_4_20_rot},
+		{.name = "line_h 0, 0, 5, 1 vs 0, 1, 5, 0",
+		 .tst_fn = line_5_1_h},
+		{.name = "line_v 0, 0, 5, 1 vs 5, 0, 0, 1",
+		 .tst_fn = line_5_1_v},
+		{.name = "line 0, 0, 5, 1 rot 90",
+		 .tst_fn = line_5_1_rot},
+		{.name = "line_h 0, 0, 5, 2 vs 0, 2, 5, 0",
+		 .tst_fn = line_5_2_h},
+		{.name = "line_v 0, 0, 5, 2 vs 5, 0, 0, 2",
+		 .tst_fn = line_5_2_v},
+		{.name = "line 0, 0, 5, 2 rot 90",
+		 .tst_fn = line_5_2_rot},
+		{.name = "line_h 0, 0, 5, 3 vs 0, 3, 5, 0",
+		 .tst_fn = line_5_3_h},
+		{.name = "line_v 0, 0, 5, 3 vs 5, 0, 0, 3",
+		 .tst_fn = line_5_3_v},
+		{.name = "line 0, 0, 5, 3 rot 90",
+		 .tst_fn = line_5_3_rot},
+		{.name = "line_h 0, 0, 5, 4 vs 0, 4, 5, 0",
+		 .tst_fn = line_5_4_h},
+		{.name = "line_v 0, 0, 5, 4 vs 5, 0, 0, 4",
+		 .tst_fn = line_5_4_v},
+		{.name = "line 0, 0, 5, 4 rot 90",
+		 .tst_fn = line_5_4_rot},
+		{.name = "line_h 0, 0, 5, 5 vs 0, 5, 5, 0",
+		 .tst_fn = line_5_5_h},
+		{.name = "line_v 0, 0, 5, 5 vs 5, 0, 0, 5",
+		 .tst_fn = line_5_5_v},
+		{.name = "line 0, 0, 5, 5 rot 90",
+		 .tst_fn = line_5_5_rot},
+		{.name = "line_h 0, 0, 5, 6 vs 0, 6, 5, 0",
+		 .tst_fn = line_5_6_h},
+		{.name = "line_v 0, 0, 5, 6 vs 5, 0, 0, 6",
+		 .tst_fn = line_5_6_v},
+		{.name = "line 0, 0, 5, 6 rot 90",
+		 .tst_fn = line_5_6_rot},
+		{.name = "line_h 0, 0, 5, 7 vs 0, 7, 5, 0",
+		 .tst_fn = line_5_7_h},
+		{.name = "line_v 0, 0, 5, 7 vs 5, 0, 0, 7",
+		 .tst_fn = line_5_7_v},
+		{.name = "line 0, 0, 5, 7 rot 90",
+		 .tst_fn = line_5_7_rot},
+		{.name = "line_h 0, 0, 5, 8 vs 0, 8, 5, 0",
+		 .tst_fn = line_5_8_h},
+		{.name = "line_v 0, 0, 5, 8 vs 5, 0, 0, 8",
+		 .tst_fn = line_5_8_v},
+		{.name = "line 0, 0, 5, 8 rot 90",
+		 .tst_fn = line_5_8_rot},
+		{.name = "line_h 0, 0, 5, 9 vs 0, 9, 5, 0",
+		 .tst_fn = line_5_9_h},
+		{.name = "line_v 0, 0, 5, 9 vs 5, 0, 0, 9",
+		 .tst_fn = line_5_9_v},
+		{.name = "line 0, 0, 5, 9 rot 90",
+		 .tst_fn = line_5_9_rot},
+		{.name = "line_h 0, 0, 5, 10 vs 0, 10, 5, 0",
+		 .tst_fn = line_5_10_h},
+		{.name = "line_v 0, 0, 5, 10 vs 5, 0, 0, 10",
+		 .tst_fn = line_5_10_v},
+		{.name = "line 0, 0, 5, 10 rot 90",
+		 .tst_fn = line_5_10_rot},
+		{.name = "line_h 0, 0, 5, 11 vs 0, 11, 5, 0",
+		 .tst_fn = line_5_11_h},
+		{.name = "line_v 0, 0, 5, 11 vs 5, 0, 0, 11",
+		 .tst_fn = line_5_11_v},
+		{.name = "line 0, 0, 5, 11 rot 90",
+		 .tst_fn = line_5_11_rot},
+		{.name = "line_h 0, 0, 5, 12 vs 0, 12, 5, 0",
+		 .tst_fn = line_5_12_h},
+		{.name = "line_v 0, 0, 5, 12 vs 5, 0, 0, 12",
+		 .tst_fn = line_5_12_v},
+		{.name = "line 0, 0, 5, 12 rot 90",
+		 .tst_fn = line_5_12_rot},
+		{.name = "line_h 0, 0, 5, 13 vs 0, 13, 5, 0",
+		 .tst_fn = line_5_13_h},
+		{.name = "line_v 0, 0, 5, 13 vs 5, 0, 0, 13",
+		 .tst_fn = line_5_13_v},
+		{.name = "line 0, 0, 5, 13 rot 90",
+		 .tst_fn = line_5_13_rot},
+		{.name = "line_h 0, 0, 5, 14 vs 0, 14, 5, 0",
+		 .tst_fn = line_5_14_h},
+		{.name = "line_v 0, 0, 5, 14 vs 5, 0, 0, 14",
+		 .tst_fn = line_5_14_v},
+		{.name = "line 0, 0, 5, 14 rot 90",
+		 .tst_fn = line_5_14_rot},
+		{.name = "line_h 0, 0, 5, 15 vs 0, 15, 5, 0",
+		 .tst_fn = line_5_15_h},
+		{.name = "line_v 0, 0, 5, 15 vs 5, 0, 0, 15",
+		 .tst_fn = line_5_15_v},
+		{.name = "line 0, 0, 5, 15 rot 90",
+		 .tst_fn = line_5_15_rot},
+		{.name = "line_h 0, 0, 5, 16 vs 0, 16, 5, 0",
+		 .tst_fn = line_5_16_h},
+		{.name = "line_v 0, 0, 5, 16 vs 5, 0, 0, 16",
+		 .tst_fn = line_5_16_v},
+		{.name = "line 0, 0, 5, 16 rot 90",
+		 .tst_fn = line_5_16_rot},
+		{.name = "line_h 0, 0, 5, 17 vs 0, 17, 5, 0",
+		 .tst_fn = line_5_17_h},
+		{.name = "line_v 0, 0, 5, 17 vs 5, 0, 0, 17",
+		 .tst_fn = line_5_17_v},
+		{.name = "line 0, 0, 5, 17 rot 90",
+		 .tst_fn = line_5_17_rot},
+		{.name = "line_h 0, 0, 5, 18 vs 0, 18, 5, 0",
+		 .tst_fn = line_5_18_h},
+		{.name = "line_v 0, 0, 5, 18 vs 5, 0, 0, 18",
+		 .tst_fn = line_5_18_v},
+		{.name = "line 0, 0, 5, 18 rot 90",
+		 .tst_fn = line_5_18_rot},
+		{.name = "line_h 0, 0, 5, 19 vs 0, 19, 5, 0",
+		 .tst_fn = line_5_19_h},
+		{.name = "line_v 0, 0, 5, 19 vs 5, 0, 0, 19",
+		 .tst_fn = line_5_19_v},
+		{.name = "line 0, 0, 5, 19 rot 90",
+		 .tst_fn = line_5_19_rot},
+		{.name = "line_h 0, 0, 5, 20 vs 0, 20, 5, 0",
+		 .tst_fn = line_5_20_h},
+		{.name = "line_v 0, 0, 5, 20 vs 5, 0, 0, 20",
+		 .tst_fn = line_5_20_v},
+		{.name = "line 0, 0, 5, 20 rot 90",
+		 .tst_fn = line_5_20_rot},
+		{.name = "line_h 0, 0, 6, 1 vs 0, 1, 6, 0",
+		 .tst_fn = line_6_1_h},
+		{.name = "line_v 0, 0, 6, 1 vs 6, 0, 0, 1",
+		 .tst_fn = line_6_1_v},
+		{.name = "line 0, 0, 6, 1 rot 90",
+		 .tst_fn = line_6_1_rot},
+		{.name = "line_h 0, 0, 6, 2 vs 0, 2, 6, 0",
+		 .tst_fn = line_6_2_h},
+		{.name = "line_v 0, 0, 6, 2 vs 6, 0, 0, 2",
+		 .tst_fn = line_6_2_v},
+		{.name = "line 0, 0, 6, 2 rot 90",
+		 .tst_fn = line_6_2_rot},
+		{.name = "line_h 0, 0, 6, 3 vs 0, 3, 6, 0",
+		 .tst_fn = line_6_3_h},
+		{.name = "line_v 0, 0, 6, 3 vs 6, 0, 0, 3",
+		 .tst_fn = line_6_3_v},
+		{.name = "line 0, 0, 6, 3 rot 90",
+		 .tst_fn = line_6_3_rot},
+		{.name = "line_h 0, 0, 6, 4 vs 0, 4, 6, 0",
+		 .tst_fn = line_6_4_h},
+		{.name = "line_v 0, 0, 6, 4 vs 6, 0, 0, 4",
+		 .tst_fn = line_6_4_v},
+		{.name = "line 0, 0, 6, 4 rot 90",
+		 .tst_fn = line_6_4_rot},
+		{.name = "line_h 0, 0, 6, 5 vs 0, 5, 6, 0",
+		 .tst_fn = line_6_5_h},
+		{.name = "line_v 0, 0, 6, 5 vs 6, 0, 0, 5",
+		 .tst_fn = line_6_5_v},
+		{.name = "line 0, 0, 6, 5 rot 90",
+		 .tst_fn = line_6_5_rot},
+		{.name = "line_h 0, 0, 6, 6 vs 0, 6, 6, 0",
+		 .tst_fn = line_6_6_h},
+		{.name = "line_v 0, 0, 6, 6 vs 6, 0, 0, 6",
+		 .tst_fn = line_6_6_v},
+		{.name = "line 0, 0, 6, 6 rot 90",
+		 .tst_fn = line_6_6_rot},
+		{.name = "line_h 0, 0, 6, 7 vs 0, 7, 6, 0",
+		 .tst_fn = line_6_7_h},
+		{.name = "line_v 0, 0, 6, 7 vs 6, 0, 0, 7",
+		 .tst_fn = line_6_7_v},
+		{.name = "line 0, 0, 6, 7 rot 90",
+		 .tst_fn = line_6_7_rot},
+		{.name = "line_h 0, 0, 6, 8 vs 0, 8, 6, 0",
+		 .tst_fn = line_6_8_h},
+		{.name = "line_v 0, 0, 6, 8 vs 6, 0, 0, 8",
+		 .tst_fn = line_6_8_v},
+		{.name = "line 0, 0, 6, 8 rot 90",
+		 .tst_fn = line_6_8_rot},
+		{.name = "line_h 0, 0, 6, 9 vs 0, 9, 6, 0",
+		 .tst_fn = line_6_9_h},
+		{.name = "line_v 0, 0, 6, 9 vs 6, 0, 0, 9",
+		 .tst_fn = line_6_9_v},
+		{.name = "line 0, 0, 6, 9 rot 90",
+		 .tst_fn = line_6_9_rot},
+		{.name = "line_h 0, 0, 6, 10 vs 0, 10, 6, 0",
+		 .tst_fn = line_6_10_h},
+		{.name = "line_v 0, 0, 6, 10 vs 6, 0, 0, 10",
+		 .tst_fn = line_6_10_v},
+		{.name = "line 0, 0, 6, 10 rot 90",
+		 .tst_fn = line_6_10_rot},
+		{.name = "line_h 0, 0, 6, 11 vs 0, 11, 6, 0",
+		 .tst_fn = line_6_11_h},
+		{.name = "line_v 0, 0, 6, 11 vs 6, 0, 0, 11",
+		 .tst_fn = line_6_11_v},
+		{.name = "line 0, 0, 6, 11 rot 90",
+		 .tst_fn = line_6_11_rot},
+		{.name = "line_h 0, 0, 6, 12 vs 0, 12, 6, 0",
+		 .tst_fn = line_6_12_h},
+		{.name = "line_v 0, 0, 6, 12 vs 6, 0, 0, 12",
+		 .tst_fn = line_6_12_v},
+		{.name = "line 0, 0, 6, 12 rot 90",
+		 .tst_fn = line_6_12_rot},
+		{.name = "line_h 0, 0, 6, 13 vs 0, 13, 6, 0",
+		 .tst_fn = line_6_13_h},
+		{.name = "line_v 0, 0, 6, 13 vs 6, 0, 0, 13",
+		 .tst_fn = line_6_13_v},
+		{.name = "line 0, 0, 6, 13 rot 90",
+		 .tst_fn = line_6_13_rot},
+		{.name = "line_h 0, 0, 6, 14 vs 0, 14, 6, 0",
+		 .tst_fn = line_6_14_h},
+		{.name = "line_v 0, 0, 6, 14 vs 6, 0, 0, 14",
+		 .tst_fn = line_6_14_v},
+		{.name = "line 0, 0, 6, 14 rot 90",
+		 .tst_fn = line_6_14_rot},
+		{.name = "line_h 0, 0, 6, 15 vs 0, 15, 6, 0",
+		 .tst_fn = line_6_15_h},
+		{.name = "line_v 0, 0, 6, 15 vs 6, 0, 0, 15",
+		 .tst_fn = line_6_15_v},
+		{.name = "line 0, 0, 6, 15 rot 90",
+		 .tst_fn = line_6_15_rot},
+		{.name = "line_h 0, 0, 6, 16 vs 0, 16, 6, 0",
+		 .tst_fn = line_6_16_h},
+		{.name = "line_v 0, 0, 6, 16 vs 6, 0, 0, 16",
+		 .tst_fn = line_6_16_v},
+		{.name = "line 0, 0, 6, 16 rot 90",
+		 .tst_fn = line_6_16_rot},
+		{.name = "line_h 0, 0, 6, 17 vs 0, 17, 6, 0",
+		 .tst_fn = line_6_17_h},
+		{.name = "line_v 0, 0, 6, 17 vs 6, 0, 0, 17",
+		 .tst_fn = line_6_17_v},
+		{.name = "line 0, 0, 6, 17 rot 90",
+		 .tst_fn = line_6_17_rot},
+		{.name = "line_h 0, 0, 6, 18 vs 0, 18, 6, 0",
+		 .tst_fn = line_6_18_h},
+		{.name = "line_v 0, 0, 6, 18 vs 6, 0, 0, 18",
+		 .tst_fn = line_6_18_v},
+		{.name = "line 0, 0, 6, 18 rot 90",
+		 .tst_fn = line_6_18_rot},
+		{.name = "line_h 0, 0, 6, 19 vs 0, 19, 6, 0",
+		 .tst_fn = line_6_19_h},
+		{.name = "line_v 0, 0, 6, 19 vs 6, 0, 0, 19",
+		 .tst_fn = line_6_19_v},
+		{.name = "line 0, 0, 6, 19 rot 90",
+		 .tst_fn = line_6_19_rot},
+		{.name = "line_h 0, 0, 6, 20 vs 0, 20, 6, 0",
+		 .tst_fn = line_6_20_h},
+		{.name = "line_v 0, 0, 6, 20 vs 6, 0, 0, 20",
+		 .tst_fn = line_6_20_v},
+		{.name = "line 0, 0, 6, 20 rot 90",
+		 .tst_fn = line_6_20_rot},
+		{.name = "line_h 0, 0, 7, 1 vs 0, 1, 7, 0",
+		 .tst_fn = line_7_1_h},
+		{.name = "line_v 0, 0, 7, 1 vs 7, 0, 0, 1",
+		 .tst_fn = line_7_1_v},
+		{.name = "line 0, 0, 7, 1 rot 90",
+		 .tst_fn = line_7_1_rot},
+		{.name = "line_h 0, 0, 7, 2 vs 0, 2, 7, 0",
+		 .tst_fn = line_7_2_h},
+		{.name = "line_v 0, 0, 7, 2 vs 7, 0, 0, 2",
+		 .tst_fn = line_7_2_v},
+		{.name = "line 0, 0, 7, 2 rot 90",
+		 .tst_fn = line_7_2_rot},
+		{.name = "line_h 0, 0, 7, 3 vs 0, 3, 7, 0",
+		 .tst_fn = line_7_3_h},
+		{.name = "line_v 0, 0, 7, 3 vs 7, 0, 0, 3",
+		 .tst_fn = line_7_3_v},
+		{.name = "line 0, 0, 7, 3 rot 90",
+		 .tst_fn = line_7_3_rot},
+		{.name = "line_h 0, 0, 7, 4 vs 0, 4, 7, 0",
+		 .tst_fn = line_7_4_h},
+		{.name = "line_v 0, 0, 7, 4 vs 7, 0, 0, 4",
+		 .tst_fn = line_7_4_v},
+		{.name = "line 0, 0, 7, 4 rot 90",
+		 .tst_fn = line_7_4_rot},
+		{.name = "line_h 0, 0, 7, 5 vs 0, 5, 7, 0",
+		 .tst_fn = line_7_5_h},
+		{.name = "line_v 0, 0, 7, 5 vs 7, 0, 0, 5",
+		 .tst_fn = line_7_5_v},
+		{.name = "line 0, 0, 7, 5 rot 90",
+		 .tst_fn = line_7_5_rot},
+		{.name = "line_h 0, 0, 7, 6 vs 0, 6, 7, 0",
+		 .tst_fn = line_7_6_h},
+		{.name = "line_v 0, 0, 7, 6 vs 7, 0, 0, 6",
+		 .tst_fn = line_7_6_v},
+		{.name = "line 0, 0, 7, 6 rot 90",
+		 .tst_fn = line_7_6_rot},
+		{.name = "line_h 0, 0, 7, 7 vs 0, 7, 7, 0",
+		 .tst_fn = line_7_7_h},
+		{.name = "line_v 0, 0, 7, 7 vs 7, 0, 0, 7",
+		 .tst_fn = line_7_7_v},
+		{.name = "line 0, 0, 7, 7 rot 90",
+		 .tst_fn = line_7_7_rot},
+		{.name = "line_h 0, 0, 7, 8 vs 0, 8, 7, 0",
+		 .tst_fn = line_7_8_h},
+		{.name = "line_v 0, 0, 7, 8 vs 7, 0, 0, 8",
+		 .tst_fn = line_7_8_v},
+		{.name = "line 0, 0, 7, 8 rot 90",
+		 .tst_fn = line_7_8_rot},
+		{.name = "line_h 0, 0, 7, 9 vs 0, 9, 7, 0",
+		 .tst_fn = line_7_9_h},
+		{.name = "line_v 0, 0, 7, 9 vs 7, 0, 0, 9",
+		 .tst_fn = line_7_9_v},
+		{.name = "line 0, 0, 7, 9 rot 90",
+		 .tst_fn = line_7_9_rot},
+		{.name = "line_h 0, 0, 7, 10 vs 0, 10, 7, 0",
+		 .tst_fn = line_7_10_h},
+		{.name = "line_v 0, 0, 7, 10 vs 7, 0, 0, 10",
+		 .tst_fn = line_7_10_v},
+		{.name = "line 0, 0, 7, 10 rot 90",
+		 .tst_fn = line_7_10_rot},
+		{.name = "line_h 0, 0, 7, 11 vs 0, 11, 7, 0",
+		 .tst_fn = line_7_11_h},
+		{.name = "line_v 0, 0, 7, 11 vs 7, 0, 0, 11",
+		 .tst_fn = line_7_11_v},
+		{.name = "line 0, 0, 7, 11 rot 90",
+		 .tst_fn = line_7_11_rot},
+		{.name = "line_h 0, 0, 7, 12 vs 0, 12, 7, 0",
+		 .tst_fn = line_7_12_h},
+		{.name = "line_v 0, 0, 7, 12 vs 7, 0, 0, 12",
+		 .tst_fn = line_7_12_v},
+		{.name = "line 0, 0, 7, 12 rot 90",
+		 .tst_fn = line_7_12_rot},
+		{.name = "line_h 0, 0, 7, 13 vs 0, 13, 7, 0",
+		 .tst_fn = line_7_13_h},
+		{.name = "line_v 0, 0, 7, 13 vs 7, 0, 0, 13",
+		 .tst_fn = line_7_13_v},
+		{.name = "line 0, 0, 7, 13 rot 90",
+		 .tst_fn = line_7_13_rot},
+		{.name = "line_h 0, 0, 7, 14 vs 0, 14, 7, 0",
+		 .tst_fn = line_7_14_h},
+		{.name = "line_v 0, 0, 7, 14 vs 7, 0, 0, 14",
+		 .tst_fn = line_7_14_v},
+		{.name = "line 0, 0, 7, 14 rot 90",
+		 .tst_fn = line_7_14_rot},
+		{.name = "line_h 0, 0, 7, 15 vs 0, 15, 7, 0",
+		 .tst_fn = line_7_15_h},
+		{.name = "line_v 0, 0, 7, 15 vs 7, 0, 0, 15",
+		 .tst_fn = line_7_15_v},
+		{.name = "line 0, 0, 7, 15 rot 90",
+		 .tst_fn = line_7_15_rot},
+		{.name = "line_h 0, 0, 7, 16 vs 0, 16, 7, 0",
+		 .tst_fn = line_7_16_h},
+		{.name = "line_v 0, 0, 7, 16 vs 7, 0, 0, 16",
+		 .tst_fn = line_7_16_v},
+		{.name = "line 0, 0, 7, 16 rot 90",
+		 .tst_fn = line_7_16_rot},
+		{.name = "line_h 0, 0, 7, 17 vs 0, 17, 7, 0",
+		 .tst_fn = line_7_17_h},
+		{.name = "line_v 0, 0, 7, 17 vs 7, 0, 0, 17",
+		 .tst_fn = line_7_17_v},
+		{.name = "line 0, 0, 7, 17 rot 90",
+		 .tst_fn = line_7_17_rot},
+		{.name = "line_h 0, 0, 7, 18 vs 0, 18, 7, 0",
+		 .tst_fn = line_7_18_h},
+		{.name = "line_v 0, 0, 7, 18 vs 7, 0, 0, 18",
+		 .tst_fn = line_7_18_v},
+		{.name = "line 0, 0, 7, 18 rot 90",
+		 .tst_fn = line_7_18_rot},
+		{.name = "line_h 0, 0, 7, 19 vs 0, 19, 7, 0",
+		 .tst_fn = line_7_19_h},
+		{.name = "line_v 0, 0, 7, 19 vs 7, 0, 0, 19",
+		 .tst_fn = line_7_19_v},
+		{.name = "line 0, 0, 7, 19 rot 90",
+		 .tst_fn = line_7_19_rot},
+		{.name = "line_h 0, 0, 7, 20 vs 0, 20, 7, 0",
+		 .tst_fn = line_7_20_h},
+		{.name = "line_v 0, 0, 7, 20 vs 7, 0, 0, 20",
+		 .tst_fn = line_7_20_v},
+		{.name = "line 0, 0, 7, 20 rot 90",
+		 .tst_fn = line_7_20_rot},
+		{.name = "line_h 0, 0, 8, 1 vs 0, 1, 8, 0",
+		 .tst_fn = line_8_1_h},
+		{.name = "line_v 0, 0, 8, 1 vs 8, 0, 0, 1",
+		 .tst_fn = line_8_1_v},
+		{.name = "line 0, 0, 8, 1 rot 90",
+		 .tst_fn = line_8_1_rot},
+		{.name = "line_h 0, 0, 8, 2 vs 0, 2, 8, 0",
+		 .tst_fn = line_8_2_h},
+		{.name = "line_v 0, 0, 8, 2 vs 8, 0, 0, 2",
+		 .tst_fn = line_8_2_v},
+		{.name = "line 0, 0, 8, 2 rot 90",
+		 .tst_fn = line_8_2_rot},
+		{.name = "line_h 0, 0, 8, 3 vs 0, 3, 8, 0",
+		 .tst_fn = line_8_3_h},
+		{.name = "line_v 0, 0, 8, 3 vs 8, 0, 0, 3",
+		 .tst_fn = line_8_3_v},
+		{.name = "line 0, 0, 8, 3 rot 90",
+		 .tst_fn = line_8_3_rot},
+		{.name = "line_h 0, 0, 8, 4 vs 0, 4, 8, 0",
+		 .tst_fn = line_8_4_h},
+		{.name = "line_v 0, 0, 8, 4 vs 8, 0, 0, 4",
+		 .tst_fn = line_8_4_v},
+		{.name = "line 0, 0, 8, 4 rot 90",
+		 .tst_fn = line_8_4_rot},
+		{.name = "line_h 0, 0, 8, 5 vs 0, 5, 8, 0",
+		 .tst_fn = line_8_5_h},
+		{.name = "line_v 0, 0, 8, 5 vs 8, 0, 0, 5",
+		 .tst_fn = line_8_5_v},
+		{.name = "line 0, 0, 8, 5 rot 90",
+		 .tst_fn = line_8_5_rot},
+		{.name = "line_h 0, 0, 8, 6 vs 0, 6, 8, 0",
+		 .tst_fn = line_8_6_h},
+		{.name = "line_v 0, 0, 8, 6 vs 8, 0, 0, 6",
+		 .tst_fn = line_8_6_v},
+		{.name = "line 0, 0, 8, 6 rot 90",
+		 .tst_fn = line_8_6_rot},
+		{.name = "line_h 0, 0, 8, 7 vs 0, 7, 8, 0",
+		 .tst_fn = line_8_7_h},
+		{.name = "line_v 0, 0, 8, 7 vs 8, 0, 0, 7",
+		 .tst_fn = line_8_7_v},
+		{.name = "line 0, 0, 8, 7 rot 90",
+		 .tst_fn = line_8_7_rot},
+		{.name = "line_h 0, 0, 8, 8 vs 0, 8, 8, 0",
+		 .tst_fn = line_8_8_h},
+		{.name = "line_v 0, 0, 8, 8 vs 8, 0, 0, 8",
+		 .tst_fn = line_8_8_v},
+		{.name = "line 0, 0, 8, 8 rot 90",
+		 .tst_fn = line_8_8_rot},
+		{.name = "line_h 0, 0, 8, 9 vs 0, 9, 8, 0",
+		 .tst_fn = line_8_9_h},
+		{.name = "line_v 0, 0, 8, 9 vs 8, 0, 0, 9",
+		 .tst_fn = line_8_9_v},
+		{.name = "line 0, 0, 8, 9 rot 90",
+		 .tst_fn = line_8_9_rot},
+		{.name = "line_h 0, 0, 8, 10 vs 0, 10, 8, 0",
+		 .tst_fn = line_8_10_h},
+		{.name = "line_v 0, 0, 8, 10 vs 8, 0, 0, 10",
+		 .tst_fn = line_8_10_v},
+		{.name = "line 0, 0, 8, 10 rot 90",
+		 .tst_fn = line_8_10_rot},
+		{.name = "line_h 0, 0, 8, 11 vs 0, 11, 8, 0",
+		 .tst_fn = line_8_11_h},
+		{.name = "line_v 0, 0, 8, 11 vs 8, 0, 0, 11",
+		 .tst_fn = line_8_11_v},
+		{.name = "line 0, 0, 8, 11 rot 90",
+		 .tst_fn = line_8_11_rot},
+		{.name = "line_h 0, 0, 8, 12 vs 0, 12, 8, 0",
+		 .tst_fn = line_8_12_h},
+		{.name = "line_v 0, 0, 8, 12 vs 8, 0, 0, 12",
+		 .tst_fn = line_8_12_v},
+		{.name = "line 0, 0, 8, 12 rot 90",
+		 .tst_fn = line_8_12_rot},
+		{.name = "line_h 0, 0, 8, 13 vs 0, 13, 8, 0",
+		 .tst_fn = line_8_13_h},
+		{.name = "line_v 0, 0, 8, 13 vs 8, 0, 0, 13",
+		 .tst_fn = line_8_13_v},
+		{.name = "line 0, 0, 8, 13 rot 90",
+		 .tst_fn = line_8_13_rot},
+		{.name = "line_h 0, 0, 8, 14 vs 0, 14, 8, 0",
+		 .tst_fn = line_8_14_h},
+		{.name = "line_v 0, 0, 8, 14 vs 8, 0, 0, 14",
+		 .tst_fn = line_8_14_v},
+		{.name = "line 0, 0, 8, 14 rot 90",
+		 .tst_fn = line_8_14_rot},
+		{.name = "line_h 0, 0, 8, 15 vs 0, 15, 8, 0",
+		 .tst_fn = line_8_15_h},
+		{.name = "line_v 0, 0, 8, 15 vs 8, 0, 0, 15",
+		 .tst_fn = line_8_15_v},
+		{.name = "line 0, 0, 8, 15 rot 90",
+		 .tst_fn = line_8_15_rot},
+		{.name = "line_h 0, 0, 8, 16 vs 0, 16, 8, 0",
+		 .tst_fn = line_8_16_h},
+		{.name = "line_v 0, 0, 8, 16 vs 8, 0, 0, 16",
+		 .tst_fn = line_8_16_v},
+		{.name = "line 0, 0, 8, 16 rot 90",
+		 .tst_fn = line_8_16_rot},
+		{.name = "line_h 0, 0, 8, 17 vs 0, 17, 8, 0",
+		 .tst_fn = line_8_17_h},
+		{.name = "line_v 0, 0, 8, 17 vs 8, 0, 0, 17",
+		 .tst_fn = line_8_17_v},
+		{.name = "line 0, 0, 8, 17 rot 90",
+		 .tst_fn = line_8_17_rot},
+		{.name = "line_h 0, 0, 8, 18 vs 0, 18, 8, 0",
+		 .tst_fn = line_8_18_h},
+		{.name = "line_v 0, 0, 8, 18 vs 8, 0, 0, 18",
+		 .tst_fn = line_8_18_v},
+		{.name = "line 0, 0, 8, 18 rot 90",
+		 .tst_fn = line_8_18_rot},
+		{.name = "line_h 0, 0, 8, 19 vs 0, 19, 8, 0",
+		 .tst_fn = line_8_19_h},
+		{.name = "line_v 0, 0, 8, 19 vs 8, 0, 0, 19",
+		 .tst_fn = line_8_19_v},
+		{.name = "line 0, 0, 8, 19 rot 90",
+		 .tst_fn = line_8_19_rot},
+		{.name = "line_h 0, 0, 8, 20 vs 0, 20, 8, 0",
+		 .tst_fn = line_8_20_h},
+		{.name = "line_v 0, 0, 8, 20 vs 8, 0, 0, 20",
+		 .tst_fn = line_8_20_v},
+		{.name = "line 0, 0, 8, 20 rot 90",
+		 .tst_fn = line_8_20_rot},
+		{.name = "line_h 0, 0, 9, 1 vs 0, 1, 9, 0",
+		 .tst_fn = line_9_1_h},
+		{.name = "line_v 0, 0, 9, 1 vs 9, 0, 0, 1",
+		 .tst_fn = line_9_1_v},
+		{.name = "line 0, 0, 9, 1 rot 90",
+		 .tst_fn = line_9_1_rot},
+		{.name = "line_h 0, 0, 9, 2 vs 0, 2, 9, 0",
+		 .tst_fn = line_9_2_h},
+		{.name = "line_v 0, 0, 9, 2 vs 9, 0, 0, 2",
+		 .tst_fn = line_9_2_v},
+		{.name = "line 0, 0, 9, 2 rot 90",
+		 .tst_fn = line_9_2_rot},
+		{.name = "line_h 0, 0, 9, 3 vs 0, 3, 9, 0",
+		 .tst_fn = line_9_3_h},
+		{.name = "line_v 0, 0, 9, 3 vs 9, 0, 0, 3",
+		 .tst_fn = line_9_3_v},
+		{.name = "line 0, 0, 9, 3 rot 90",
+		 .tst_fn = line_9_3_rot},
+		{.name = "line_h 0, 0, 9, 4 vs 0, 4, 9, 0",
+		 .tst_fn = line_9_4_h},
+		{.name = "line_v 0, 0, 9, 4 vs 9, 0, 0, 4",
+		 .tst_fn = line_9_4_v},
+		{.name = "line 0, 0, 9, 4 rot 90",
+		 .tst_fn = line_9_4_rot},
+		{.name = "line_h 0, 0, 9, 5 vs 0, 5, 9, 0",
+		 .tst_fn = line_9_5_h},
+		{.name = "line_v 0, 0, 9, 5 vs 9, 0, 0, 5",
+		 .tst_fn = line_9_5_v},
+		{.name = "line 0, 0, 9, 5 rot 90",
+		 .tst_fn = line_9_5_rot},
+		{.name = "line_h 0, 0, 9, 6 vs 0, 6, 9, 0",
+		 .tst_fn = line_9_6_h},
+		{.name = "line_v 0, 0, 9, 6 vs 9, 0, 0, 6",
+		 .tst_fn = line_9_6_v},
+		{.name = "line 0, 0, 9, 6 rot 90",
+		 .tst_fn = line_9_6_rot},
+		{.name = "line_h 0, 0, 9, 7 vs 0, 7, 9, 0",
+		 .tst_fn = line_9_7_h},
+		{.name = "line_v 0, 0, 9, 7 vs 9, 0, 0, 7",
+		 .tst_fn = line_9_7_v},
+		{.name = "line 0, 0, 9, 7 rot 90",
+		 .tst_fn = line_9_7_rot},
+		{.name = "line_h 0, 0, 9, 8 vs 0, 8, 9, 0",
+		 .tst_fn = line_9_8_h},
+		{.name = "line_v 0, 0, 9, 8 vs 9, 0, 0, 8",
+		 .tst_fn = line_9_8_v},
+		{.name = "line 0, 0, 9, 8 rot 90",
+		 .tst_fn = line_9_8_rot},
+		{.name = "line_h 0, 0, 9, 9 vs 0, 9, 9, 0",
+		 .tst_fn = line_9_9_h},
+		{.name = "line_v 0, 0, 9, 9 vs 9, 0, 0, 9",
+		 .tst_fn = line_9_9_v},
+		{.name = "line 0, 0, 9, 9 rot 90",
+		 .tst_fn = line_9_9_rot},
+		{.name = "line_h 0, 0, 9, 10 vs 0, 10, 9, 0",
+		 .tst_fn = line_9_10_h},
+		{.name = "line_v 0, 0, 9, 10 vs 9, 0, 0, 10",
+		 .tst_fn = line_9_10_v},
+		{.name = "line 0, 0, 9, 10 rot 90",
+		 .tst_fn = line_9_10_rot},
+		{.name = "line_h 0, 0, 9, 11 vs 0, 11, 9, 0",
+		 .tst_fn = line_9_11_h},
+		{.name = "line_v 0, 0, 9, 11 vs 9, 0, 0, 11",
+		 .tst_fn = line_9_11_v},
+		{.name = "line 0, 0, 9, 11 rot 90",
+		 .tst_fn = line_9_11_rot},
+		{.name = "line_h 0, 0, 9, 12 vs 0, 12, 9, 0",
+		 .tst_fn = line_9_12_h},
+		{.name = "line_v 0, 0, 9, 12 vs 9, 0, 0, 12",
+		 .tst_fn = line_9_12_v},
+		{.name = "line 0, 0, 9, 12 rot 90",
+		 .tst_fn = line_9_12_rot},
+		{.name = "line_h 0, 0, 9, 13 vs 0, 13, 9, 0",
+		 .tst_fn = line_9_13_h},
+		{.name = "line_v 0, 0, 9, 13 vs 9, 0, 0, 13",
+		 .tst_fn = line_9_13_v},
+		{.name = "line 0, 0, 9, 13 rot 90",
+		 .tst_fn = line_9_13_rot},
+		{.name = "line_h 0, 0, 9, 14 vs 0, 14, 9, 0",
+		 .tst_fn = line_9_14_h},
+		{.name = "line_v 0, 0, 9, 14 vs 9, 0, 0, 14",
+		 .tst_fn = line_9_14_v},
+		{.name = "line 0, 0, 9, 14 rot 90",
+		 .tst_fn = line_9_14_rot},
+		{.name = "line_h 0, 0, 9, 15 vs 0, 15, 9, 0",
+		 .tst_fn = line_9_15_h},
+		{.name = "line_v 0, 0, 9, 15 vs 9, 0, 0, 15",
+		 .tst_fn = line_9_15_v},
+		{.name = "line 0, 0, 9, 15 rot 90",
+		 .tst_fn = line_9_15_rot},
+		{.name = "line_h 0, 0, 9, 16 vs 0, 16, 9, 0",
+		 .tst_fn = line_9_16_h},
+		{.name = "line_v 0, 0, 9, 16 vs 9, 0, 0, 16",
+		 .tst_fn = line_9_16_v},
+		{.name = "line 0, 0, 9, 16 rot 90",
+		 .tst_fn = line_9_16_rot},
+		{.name = "line_h 0, 0, 9, 17 vs 0, 17, 9, 0",
+		 .tst_fn = line_9_17_h},
+		{.name = "line_v 0, 0, 9, 17 vs 9, 0, 0, 17",
+		 .tst_fn = line_9_17_v},
+		{.name = "line 0, 0, 9, 17 rot 90",
+		 .tst_fn = line_9_17_rot},
+		{.name = "line_h 0, 0, 9, 18 vs 0, 18, 9, 0",
+		 .tst_fn = line_9_18_h},
+		{.name = "line_v 0, 0, 9, 18 vs 9, 0, 0, 18",
+		 .tst_fn = line_9_18_v},
+		{.name = "line 0, 0, 9, 18 rot 90",
+		 .tst_fn = line_9_18_rot},
+		{.name = "line_h 0, 0, 9, 19 vs 0, 19, 9, 0",
+		 .tst_fn = line_9_19_h},
+		{.name = "line_v 0, 0, 9, 19 vs 9, 0, 0, 19",
+		 .tst_fn = line_9_19_v},
+		{.name = "line 0, 0, 9, 19 rot 90",
+		 .tst_fn = line_9_19_rot},
+		{.name = "line_h 0, 0, 9, 20 vs 0, 20, 9, 0",
+		 .tst_fn = line_9_20_h},
+		{.name = "line_v 0, 0, 9, 20 vs 9, 0, 0, 20",
+		 .tst_fn = line_9_20_v},
+		{.name = "line 0, 0, 9, 20 rot 90",
+		 .tst_fn = line_9_20_rot},
+		{.name = "line_h 0, 0, 10, 1 vs 0, 1, 10, 0",
+		 .tst_fn = line_10_1_h},
+		{.name = "line_v 0, 0, 10, 1 vs 10, 0, 0, 1",
+		 .tst_fn = line_10_1_v},
+		{.name = "line 0, 0, 10, 1 rot 90",
+		 .tst_fn = line_10_1_rot},
+		{.name = "line_h 0, 0, 10, 2 vs 0, 2, 10, 0",
+		 .tst_fn = line_10_2_h},
+		{.name = "line_v 0, 0, 10, 2 vs 10, 0, 0, 2",
+		 .tst_fn = line_10_2_v},
+		{.name = "line 0, 0, 10, 2 rot 90",
+		 .tst_fn = line_10_2_rot},
+		{.name = "line_h 0, 0, 10, 3 vs 0, 3, 10, 0",
+		 .tst_fn = line_10_3_h},
+		{.name = "line_v 0, 0, 10, 3 vs 10, 0, 0, 3",
+		 .tst_fn = line_10_3_v},
+		{.name = "line 0, 0, 10, 3 rot 90",
+		 .tst_fn = line_10_3_rot},
+		{.name = "line_h 0, 0, 10, 4 vs 0, 4, 10, 0",
+		 .tst_fn = line_10_4_h},
+		{.name = "line_v 0, 0, 10, 4 vs 10, 0, 0, 4",
+		 .tst_fn = line_10_4_v},
+		{.name = "line 0, 0, 10, 4 rot 90",
+		 .tst_fn = line_10_4_rot},
+		{.name = "line_h 0, 0, 10, 5 vs 0, 5, 10, 0",
+		 .tst_fn = line_10_5_h},
+		{.name = "line_v 0, 0, 10, 5 vs 10, 0, 0, 5",
+		 .tst_fn = line_10_5_v},
+		{.name = "line 0, 0, 10, 5 rot 90",
+		 .tst_fn = line_10_5_rot},
+		{.name = "line_h 0, 0, 10, 6 vs 0, 6, 10, 0",
+		 .tst_fn = line_10_6_h},
+		{.name = "line_v 0, 0, 10, 6 vs 10, 0, 0, 6",
+		 .tst_fn = line_10_6_v},
+		{.name = "line 0, 0, 10, 6 rot 90",
+		 .tst_fn = line_10_6_rot},
+		{.name = "line_h 0, 0, 10, 7 vs 0, 7, 10, 0",
+		 .tst_fn = line_10_7_h},
+		{.name = "line_v 0, 0, 10, 7 vs 10, 0, 0, 7",
+		 .tst_fn = line_10_7_v},
+		{.name = "line 0, 0, 10, 7 rot 90",
+		 .tst_fn = line_10_7_rot},
+		{.name = "line_h 0, 0, 10, 8 vs 0, 8, 10, 0",
+		 .tst_fn = line_10_8_h},
+		{.name = "line_v 0, 0, 10, 8 vs 10, 0, 0, 8",
+		 .tst_fn = line_10_8_v},
+		{.name = "line 0, 0, 10, 8 rot 90",
+		 .tst_fn = line_10_8_rot},
+		{.name = "line_h 0, 0, 10, 9 vs 0, 9, 10, 0",
+		 .tst_fn = line_10_9_h},
+		{.name = "line_v 0, 0, 10, 9 vs 10, 0, 0, 9",
+		 .tst_fn = line_10_9_v},
+		{.name = "line 0, 0, 10, 9 rot 90",
+		 .tst_fn = line_10_9_rot},
+		{.name = "line_h 0, 0, 10, 10 vs 0, 10, 10, 0",
+		 .tst_fn = line_10_10_h},
+		{.name = "line_v 0, 0, 10, 10 vs 10, 0, 0, 10",
+		 .tst_fn = line_10_10_v},
+		{.name = "line 0, 0, 10, 10 rot 90",
+		 .tst_fn = line_10_10_rot},
+		{.name = "line_h 0, 0, 10, 11 vs 0, 11, 10, 0",
+		 .tst_fn = line_10_11_h},
+		{.name = "line_v 0, 0, 10, 11 vs 10, 0, 0, 11",
+		 .tst_fn = line_10_11_v},
+		{.name = "line 0, 0, 10, 11 rot 90",
+		 .tst_fn = line_10_11_rot},
+		{.name = "line_h 0, 0, 10, 12 vs 0, 12, 10, 0",
+		 .tst_fn = line_10_12_h},
+		{.name = "line_v 0, 0, 10, 12 vs 10, 0, 0, 12",
+		 .tst_fn = line_10_12_v},
+		{.name = "line 0, 0, 10, 12 rot 90",
+		 .tst_fn = line_10_12_rot},
+		{.name = "line_h 0, 0, 10, 13 vs 0, 13, 10, 0",
+		 .tst_fn = line_10_13_h},
+		{.name = "line_v 0, 0, 10, 13 vs 10, 0, 0, 13",
+		 .tst_fn = line_10_13_v},
+		{.name = "line 0, 0, 10, 13 rot 90",
+		 .tst_fn = line_10_13_rot},
+		{.name = "line_h 0, 0, 10, 14 vs 0, 14, 10, 0",
+		 .tst_fn = line_10_14_h},
+		{.name = "line_v 0, 0, 10, 14 vs 10, 0, 0, 14",
+		 .tst_fn = line_10_14_v},
+		{.name = "line 0, 0, 10, 14 rot 90",
+		 .tst_fn = line_10_14_rot},
+		{.name = "line_h 0, 0, 10, 15 vs 0, 15, 10, 0",
+		 .tst_fn = line_10_15_h},
+		{.name = "line_v 0, 0, 10, 15 vs 10, 0, 0, 15",
+		 .tst_fn = line_10_15_v},
+		{.name = "line 0, 0, 10, 15 rot 90",
+		 .tst_fn = line_10_15_rot},
+		{.name = "line_h 0, 0, 10, 16 vs 0, 16, 10, 0",
+		 .tst_fn = line_10_16_h},
+		{.name = "line_v 0, 0, 10, 16 vs 10, 0, 0, 16",
+		 .tst_fn = line_10_16_v},
+		{.name = "line 0, 0, 10, 16 rot 90",
+		 .tst_fn = line_10_16_rot},
+		{.name = "line_h 0, 0, 10, 17 vs 0, 17, 10, 0",
+		 .tst_fn = line_10_17_h},
+		{.name = "line_v 0, 0, 10, 17 vs 10, 0, 0, 17",
+		 .tst_fn = line_10_17_v},
+		{.name = "line 0, 0, 10, 17 rot 90",
+		 .tst_fn = line_10_17_rot},
+		{.name = "line_h 0, 0, 10, 18 vs 0, 18, 10, 0",
+		 .tst_fn = line_10_18_h},
+		{.name = "line_v 0, 0, 10, 18 vs 10, 0, 0, 18",
+		 .tst_fn = line_10_18_v},
+		{.name = "line 0, 0, 10, 18 rot 90",
+		 .tst_fn = line_10_18_rot},
+		{.name = "line_h 0, 0, 10, 19 vs 0, 19, 10, 0",
+		 .tst_fn = line_10_19_h},
+		{.name = "line_v 0, 0, 10, 19 vs 10, 0, 0, 19",
+		 .tst_fn = line_10_19_v},
+		{.name = "line 0, 0, 10, 19 rot 90",
+		 .tst_fn = line_10_19_rot},
+		{.name = "line_h 0, 0, 10, 20 vs 0, 20, 10, 0",
+		 .tst_fn = line_10_20_h},
+		{.name = "line_v 0, 0, 10, 20 vs 10, 0, 0, 20",
+		 .tst_fn = line_10_20_v},
+		{.name = "line 0, 0, 10, 20 rot 90",
+		 .tst_fn = line_10_20_rot},
+		{.name = "line_h 0, 0, 11, 1 vs 0, 1, 11, 0",
+		 .tst_fn = line_11_1_h},
+		{.name = "line_v 0, 0, 11, 1 vs 11, 0, 0, 1",
+		 .tst_fn = line_11_1_v},
+		{.name = "line 0, 0, 11, 1 rot 90",
+		 .tst_fn = line_11_1_rot},
+		{.name = "line_h 0, 0, 11, 2 vs 0, 2, 11, 0",
+		 .tst_fn = line_11_2_h},
+		{.name = "line_v 0, 0, 11, 2 vs 11, 0, 0, 2",
+		 .tst_fn = line_11_2_v},
+		{.name = "line 0, 0, 11, 2 rot 90",
+		 .tst_fn = line_11_2_rot},
+		{.name = "line_h 0, 0, 11, 3 vs 0, 3, 11, 0",
+		 .tst_fn = line_11_3_h},
+		{.name = "line_v 0, 0, 11, 3 vs 11, 0, 0, 3",
+		 .tst_fn = line_11_3_v},
+		{.name = "line 0, 0, 11, 3 rot 90",
+		 .tst_fn = line_11_3_rot},
+		{.name = "line_h 0, 0, 11, 4 vs 0, 4, 11, 0",
+		 .tst_fn = line_11_4_h},
+		{.name = "line_v 0, 0, 11, 4 vs 11, 0, 0, 4",
+		 .tst_fn = line_11_4_v},
+		{.name = "line 0, 0, 11, 4 rot 90",
+		 .tst_fn = line_11_4_rot},
+		{.name = "line_h 0, 0, 11, 5 vs 0, 5, 11, 0",
+		 .tst_fn = line_11_5_h},
+		{.name = "line_v 0, 0, 11, 5 vs 11, 0, 0, 5",
+		 .tst_fn = line_11_5_v},
+		{.name = "line 0, 0, 11, 5 rot 90",
+		 .tst_fn = line_11_5_rot},
+		{.name = "line_h 0, 0, 11, 6 vs 0, 6, 11, 0",
+		 .tst_fn = line_11_6_h},
+		{.name = "line_v 0, 0, 11, 6 vs 11, 0, 0, 6",
+		 .tst_fn = line_11_6_v},
+		{.name = "line 0, 0, 11, 6 rot 90",
+		 .tst_fn = line_11_6_rot},
+		{.name = "line_h 0, 0, 11, 7 vs 0, 7, 11, 0",
+		 .tst_fn = line_11_7_h},
+		{.name = "line_v 0, 0, 11, 7 vs 11, 0, 0, 7",
+		 .tst_fn = line_11_7_v},
+		{.name = "line 0, 0, 11, 7 rot 90",
+		 .tst_fn = line_11_7_rot},
+		{.name = "line_h 0, 0, 11, 8 vs 0, 8, 11, 0",
+		 .tst_fn = line_11_8_h},
+		{.name = "line_v 0, 0, 11, 8 vs 11, 0, 0, 8",
+		 .tst_fn = line_11_8_v},
+		{.name = "line 0, 0, 11, 8 rot 90",
+		 .tst_fn = line_11_8_rot},
+		{.name = "line_h 0, 0, 11, 9 vs 0, 9, 11, 0",
+		 .tst_fn = line_11_9_h},
+		{.name = "line_v 0, 0, 11, 9 vs 11, 0, 0, 9",
+		 .tst_fn = line_11_9_v},
+		{.name = "line 0, 0, 11, 9 rot 90",
+		 .tst_fn = line_11_9_rot},
+		{.name = "line_h 0, 0, 11, 10 vs 0, 10, 11, 0",
+		 .tst_fn = line_11_10_h},
+		{.name = "line_v 0, 0, 11, 10 vs 11, 0, 0, 10",
+		 .tst_fn = line_11_10_v},
+		{.name = "line 0, 0, 11, 10 rot 90",
+		 .tst_fn = line_11_10_rot},
+		{.name = "line_h 0, 0, 11, 11 vs 0, 11, 11, 0",
+		 .tst_fn = line_11_11_h},
+		{.name = "line_v 0, 0, 11, 11 vs 11, 0, 0, 11",
+		 .tst_fn = line_11_11_v},
+		{.name = "line 0, 0, 11, 11 rot 90",
+		 .tst_fn = line_11_11_rot},
+		{.name = "line_h 0, 0, 11, 12 vs 0, 12, 11, 0",
+		 .tst_fn = line_11_12_h},
+		{.name = "line_v 0, 0, 11, 12 vs 11, 0, 0, 12",
+		 .tst_fn = line_11_12_v},
+		{.name = "line 0, 0, 11, 12 rot 90",
+		 .tst_fn = line_11_12_rot},
+		{.name = "line_h 0, 0, 11, 13 vs 0, 13, 11, 0",
+		 .tst_fn = line_11_13_h},
+		{.name = "line_v 0, 0, 11, 13 vs 11, 0, 0, 13",
+		 .tst_fn = line_11_13_v},
+		{.name = "line 0, 0, 11, 13 rot 90",
+		 .tst_fn = line_11_13_rot},
+		{.name = "line_h 0, 0, 11, 14 vs 0, 14, 11, 0",
+		 .tst_fn = line_11_14_h},
+		{.name = "line_v 0, 0, 11, 14 vs 11, 0, 0, 14",
+		 .tst_fn = line_11_14_v},
+		{.name = "line 0, 0, 11, 14 rot 90",
+		 .tst_fn = line_11_14_rot},
+		{.name = "line_h 0, 0, 11, 15 vs 0, 15, 11, 0",
+		 .tst_fn = line_11_15_h},
+		{.name = "line_v 0, 0, 11, 15 vs 11, 0, 0, 15",
+		 .tst_fn = line_11_15_v},
+		{.name = "line 0, 0, 11, 15 rot 90",
+		 .tst_fn = line_11_15_rot},
+		{.name = "line_h 0, 0, 11, 16 vs 0, 16, 11, 0",
+		 .tst_fn = line_11_16_h},
+		{.name = "line_v 0, 0, 11, 16 vs 11, 0, 0, 16",
+		 .tst_fn = line_11_16_v},
+		{.name = "line 0, 0, 11, 16 rot 90",
+		 .tst_fn = line_11_16_rot},
+		{.name = "line_h 0, 0, 11, 17 vs 0, 17, 11, 0",
+		 .tst_fn = line_11_17_h},
+		{.name = "line_v 0, 0, 11, 17 vs 11, 0, 0, 17",
+		 .tst_fn = line_11_17_v},
+		{.name = "line 0, 0, 11, 17 rot 90",
+		 .tst_fn = line_11_17_rot},
+		{.name = "line_h 0, 0, 11, 18 vs 0, 18, 11, 0",
+		 .tst_fn = line_11_18_h},
+		{.name = "line_v 0, 0, 11, 18 vs 11, 0, 0, 18",
+		 .tst_fn = line_11_18_v},
+		{.name = "line 0, 0, 11, 18 rot 90",
+		 .tst_fn = line_11_18_rot},
+		{.name = "line_h 0, 0, 11, 19 vs 0, 19, 11, 0",
+		 .tst_fn = line_11_19_h},
+		{.name = "line_v 0, 0, 11, 19 vs 11, 0, 0, 19",
+		 .tst_fn = line_11_19_v},
+		{.name = "line 0, 0, 11, 19 rot 90",
+		 .tst_fn = line_11_19_rot},
+		{.name = "line_h 0, 0, 11, 20 vs 0, 20, 11, 0",
+		 .tst_fn = line_11_20_h},
+		{.name = "line_v 0, 0, 11, 20 vs 11, 0, 0, 20",
+		 .tst_fn = line_11_20_v},
+		{.name = "line 0, 0, 11, 20 rot 90",
+		 .tst_fn = line_11_20_rot},
+		{.name = "line_h 0, 0, 12, 1 vs 0, 1, 12, 0",
+		 .tst_fn = line_12_1_h},
+		{.name = "line_v 0, 0, 12, 1 vs 12, 0, 0, 1",
+		 .tst_fn = line_12_1_v},
+		{.name = "line 0, 0, 12, 1 rot 90",
+		 .tst_fn = line_12_1_rot},
+		{.name = "line_h 0, 0, 12, 2 vs 0, 2, 12, 0",
+		 .tst_fn = line_12_2_h},
+		{.name = "line_v 0, 0, 12, 2 vs 12, 0, 0, 2",
+		 .tst_fn = line_12_2_v},
+		{.name = "line 0, 0, 12, 2 rot 90",
+		 .tst_fn = line_12_2_rot},
+		{.name = "line_h 0, 0, 12, 3 vs 0, 3, 12, 0",
+		 .tst_fn = line_12_3_h},
+		{.name = "line_v 0, 0, 12, 3 vs 12, 0, 0, 3",
+		 .tst_fn = line_12_3_v},
+		{.name = "line 0, 0, 12, 3 rot 90",
+		 .tst_fn = line_12_3_rot},
+		{.name = "line_h 0, 0, 12, 4 vs 0, 4, 12, 0",
+		 .tst_fn = line_12_4_h},
+		{.name = "line_v 0, 0, 12, 4 vs 12, 0, 0, 4",
+		 .tst_fn = line_12_4_v},
+		{.name = "line 0, 0, 12, 4 rot 90",
+		 .tst_fn = line_12_4_rot},
+		{.name = "line_h 0, 0, 12, 5 vs 0, 5, 12, 0",
+		 .tst_fn = line_12_5_h},
+		{.name = "line_v 0, 0, 12, 5 vs 12, 0, 0, 5",
+		 .tst_fn = line_12_5_v},
+		{.name = "line 0, 0, 12, 5 rot 90",
+		 .tst_fn = line_12_5_rot},
+		{.name = "line_h 0, 0, 12, 6 vs 0, 6, 12, 0",
+		 .tst_fn = line_12_6_h},
+		{.name = "line_v 0, 0, 12, 6 vs 12, 0, 0, 6",
+		 .tst_fn = line_12_6_v},
+		{.name = "line 0, 0, 12, 6 rot 90",
+		 .tst_fn = line_12_6_rot},
+		{.name = "line_h 0, 0, 12, 7 vs 0, 7, 12, 0",
+		 .tst_fn = line_12_7_h},
+		{.name = "line_v 0, 0, 12, 7 vs 12, 0, 0, 7",
+		 .tst_fn = line_12_7_v},
+		{.name = "line 0, 0, 12, 7 rot 90",
+		 .tst_fn = line_12_7_rot},
+		{.name = "line_h 0, 0, 12, 8 vs 0, 8, 12, 0",
+		 .tst_fn = line_12_8_h},
+		{.name = "line_v 0, 0, 12, 8 vs 12, 0, 0, 8",
+		 .tst_fn = line_12_8_v},
+		{.name = "line 0, 0, 12, 8 rot 90",
+		 .tst_fn = line_12_8_rot},
+		{.name = "line_h 0, 0, 12, 9 vs 0, 9, 12, 0",
+		 .tst_fn = line_12_9_h},
+		{.name = "line_v 0, 0, 12, 9 vs 12, 0, 0, 9",
+		 .tst_fn = line_12_9_v},
+		{.name = "line 0, 0, 12, 9 rot 90",
+		 .tst_fn = line_12_9_rot},
+		{.name = "line_h 0, 0, 12, 10 vs 0, 10, 12, 0",
+		 .tst_fn = line_12_10_h},
+		{.name = "line_v 0, 0, 12, 10 vs 12, 0, 0, 10",
+		 .tst_fn = line_12_10_v},
+		{.name = "line 0, 0, 12, 10 rot 90",
+		 .tst_fn = line_12_10_rot},
+		{.name = "line_h 0, 0, 12, 11 vs 0, 11, 12, 0",
+		 .tst_fn = line_12_11_h},
+		{.name = "line_v 0, 0, 12, 11 vs 12, 0, 0, 11",
+		 .tst_fn = line_12_11_v},
+		{.name = "line 0, 0, 12, 11 rot 90",
+		 .tst_fn = line_12_11_rot},
+		{.name = "line_h 0, 0, 12, 12 vs 0, 12, 12, 0",
+		 .tst_fn = line_12_12_h},
+		{.name = "line_v 0, 0, 12, 12 vs 12, 0, 0, 12",
+		 .tst_fn = line_12_12_v},
+		{.name = "line 0, 0, 12, 12 rot 90",
+		 .tst_fn = line_12_12_rot},
+		{.name = "line_h 0, 0, 12, 13 vs 0, 13, 12, 0",
+		 .tst_fn = line_12_13_h},
+		{.name = "line_v 0, 0, 12, 13 vs 12, 0, 0, 13",
+		 .tst_fn = line_12_13_v},
+		{.name = "line 0, 0, 12, 13 rot 90",
+		 .tst_fn = line_12_13_rot},
+		{.name = "line_h 0, 0, 12, 14 vs 0, 14, 12, 0",
+		 .tst_fn = line_12_14_h},
+		{.name = "line_v 0, 0, 12, 14 vs 12, 0, 0, 14",
+		 .tst_fn = line_12_14_v},
+		{.name = "line 0, 0, 12, 14 rot 90",
+		 .tst_fn = line_12_14_rot},
+		{.name = "line_h 0, 0, 12, 15 vs 0, 15, 12, 0",
+		 .tst_fn = line_12_15_h},
+		{.name = "line_v 0, 0, 12, 15 vs 12, 0, 0, 15",
+		 .tst_fn = line_12_15_v},
+		{.name = "line 0, 0, 12, 15 rot 90",
+		 .tst_fn = line_12_15_rot},
+		{.name = "line_h 0, 0, 12, 16 vs 0, 16, 12, 0",
+		 .tst_fn = line_12_16_h},
+		{.name = "line_v 0, 0, 12, 16 vs 12, 0, 0, 16",
+		 .tst_fn = line_12_16_v},
+		{.name = "line 0, 0, 12, 16 rot 90",
+		 .tst_fn = line_12_16_rot},
+		{.name = "line_h 0, 0, 12, 17 vs 0, 17, 12, 0",
+		 .tst_fn = line_12_17_h},
+		{.name = "line_v 0, 0, 12, 17 vs 12, 0, 0, 17",
+		 .tst_fn = line_12_17_v},
+		{.name = "line 0, 0, 12, 17 rot 90",
+		 .tst_fn = line_12_17_rot},
+		{.name = "line_h 0, 0, 12, 18 vs 0, 18, 12, 0",
+		 .tst_fn = line_12_18_h},
+		{.name = "line_v 0, 0, 12, 18 vs 12, 0, 0, 18",
+		 .tst_fn = line_12_18_v},
+		{.name = "line 0, 0, 12, 18 rot 90",
+		 .tst_fn = line_12_18_rot},
+		{.name = "line_h 0, 0, 12, 19 vs 0, 19, 12, 0",
+		 .tst_fn = line_12_19_h},
+		{.name = "line_v 0, 0, 12, 19 vs 12, 0, 0, 19",
+		 .tst_fn = line_12_19_v},
+		{.name = "line 0, 0, 12, 19 rot 90",
+		 .tst_fn = line_12_19_rot},
+		{.name = "line_h 0, 0, 12, 20 vs 0, 20, 12, 0",
+		 .tst_fn = line_12_20_h},
+		{.name = "line_v 0, 0, 12, 20 vs 12, 0, 0, 20",
+		 .tst_fn = line_12_20_v},
+		{.name = "line 0, 0, 12, 20 rot 90",
+		 .tst_fn = line_12_20_rot},
+		{.name = "line_h 0, 0, 13, 1 vs 0, 1, 13, 0",
+		 .tst_fn = line_13_1_h},
+		{.name = "line_v 0, 0, 13, 1 vs 13, 0, 0, 1",
+		 .tst_fn = line_13_1_v},
+		{.name = "line 0, 0, 13, 1 rot 90",
+		 .tst_fn = line_13_1_rot},
+		{.name = "line_h 0, 0, 13, 2 vs 0, 2, 13, 0",
+		 .tst_fn = line_13_2_h},
+		{.name = "line_v 0, 0, 13, 2 vs 13, 0, 0, 2",
+		 .tst_fn = line_13_2_v},
+		{.name = "line 0, 0, 13, 2 rot 90",
+		 .tst_fn = line_13_2_rot},
+		{.name = "line_h 0, 0, 13, 3 vs 0, 3, 13, 0",
+		 .tst_fn = line_13_3_h},
+		{.name = "line_v 0, 0, 13, 3 vs 13, 0, 0, 3",
+		 .tst_fn = line_13_3_v},
+		{.name = "line 0, 0, 13, 3 rot 90",
+		 .tst_fn = line_13_3_rot},
+		{.name = "line_h 0, 0, 13, 4 vs 0, 4, 13, 0",
+		 .tst_fn = line_13_4_h},
+		{.name = "line_v 0, 0, 13, 4 vs 13, 0, 0, 4",
+		 .tst_fn = line_13_4_v},
+		{.name = "line 0, 0, 13, 4 rot 90",
+		 .tst_fn = line_13_4_rot},
+		{.name = "line_h 0, 0, 13, 5 vs 0, 5, 13, 0",
+		 .tst_fn = line_13_5_h},
+		{.name = "line_v 0, 0, 13, 5 vs 13, 0, 0, 5",
+		 .tst_fn = line_13_5_v},
+		{.name = "line 0, 0, 13, 5 rot 90",
+		 .tst_fn = line_13_5_rot},
+		{.name = "line_h 0, 0, 13, 6 vs 0, 6, 13, 0",
+		 .tst_fn = line_13_6_h},
+		{.name = "line_v 0, 0, 13, 6 vs 13, 0, 0, 6",
+		 .tst_fn = line_13_6_v},
+		{.name = "line 0, 0, 13, 6 rot 90",
+		 .tst_fn = line_13_6_rot},
+		{.name = "line_h 0, 0, 13, 7 vs 0, 7, 13, 0",
+		 .tst_fn = line_13_7_h},
+		{.name = "line_v 0, 0, 13, 7 vs 13, 0, 0, 7",
+		 .tst_fn = line_13_7_v},
+		{.name = "line 0, 0, 13, 7 rot 90",
+		 .tst_fn = line_13_7_rot},
+		{.name = "line_h 0, 0, 13, 8 vs 0, 8, 13, 0",
+		 .tst_fn = line_13_8_h},
+		{.name = "line_v 0, 0, 13, 8 vs 13, 0, 0, 8",
+		 .tst_fn = line_13_8_v},
+		{.name = "line 0, 0, 13, 8 rot 90",
+		 .tst_fn = line_13_8_rot},
+		{.name = "line_h 0, 0, 13, 9 vs 0, 9, 13, 0",
+		 .tst_fn = line_13_9_h},
+		{.name = "line_v 0, 0, 13, 9 vs 13, 0, 0, 9",
+		 .tst_fn = line_13_9_v},
+		{.name = "line 0, 0, 13, 9 rot 90",
+		 .tst_fn = line_13_9_rot},
+		{.name = "line_h 0, 0, 13, 10 vs 0, 10, 13, 0",
+		 .tst_fn = line_13_10_h},
+		{.name = "line_v 0, 0, 13, 10 vs 13, 0, 0, 10",
+		 .tst_fn = line_13_10_v},
+		{.name = "line 0, 0, 13, 10 rot 90",
+		 .tst_fn = line_13_10_rot},
+		{.name = "line_h 0, 0, 13, 11 vs 0, 11, 13, 0",
+		 .tst_fn = line_13_11_h},
+		{.name = "line_v 0, 0, 13, 11 vs 13, 0, 0, 11",
+		 .tst_fn = line_13_11_v},
+		{.name = "line 0, 0, 13, 11 rot 90",
+		 .tst_fn = line_13_11_rot},
+		{.name = "line_h 0, 0, 13, 12 vs 0, 12, 13, 0",
+		 .tst_fn = line_13_12_h},
+		{.name = "line_v 0, 0, 13, 12 vs 13, 0, 0, 12",
+		 .tst_fn = line_13_12_v},
+		{.name = "line 0, 0, 13, 12 rot 90",
+		 .tst_fn = line_13_12_rot},
+		{.name = "line_h 0, 0, 13, 13 vs 0, 13, 13, 0",
+		 .tst_fn = line_13_13_h},
+		{.name = "line_v 0, 0, 13, 13 vs 13, 0, 0, 13",
+		 .tst_fn = line_13_13_v},
+		{.name = "line 0, 0, 13, 13 rot 90",
+		 .tst_fn = line_13_13_rot},
+		{.name = "line_h 0, 0, 13, 14 vs 0, 14, 13, 0",
+		 .tst_fn = line_13_14_h},
+		{.name = "line_v 0, 0, 13, 14 vs 13, 0, 0, 14",
+		 .tst_fn = line_13_14_v},
+		{.name = "line 0, 0, 13, 14 rot 90",
+		 .tst_fn = line_13_14_rot},
+		{.name = "line_h 0, 0, 13, 15 vs 0, 15, 13, 0",
+		 .tst_fn = line_13_15_h},
+		{.name = "line_v 0, 0, 13, 15 vs 13, 0, 0, 15",
+		 .tst_fn = line_13_15_v},
+		{.name = "line 0, 0, 13, 15 rot 90",
+		 .tst_fn = line_13_15_rot},
+		{.name = "line_h 0, 0, 13, 16 vs 0, 16, 13, 0",
+		 .tst_fn = line_13_16_h},
+		{.name = "line_v 0, 0, 13, 16 vs 13, 0, 0, 16",
+		 .tst_fn = line_13_16_v},
+		{.name = "line 0, 0, 13, 16 rot 90",
+		 .tst_fn = line_13_16_rot},
+		{.name = "line_h 0, 0, 13, 17 vs 0, 17, 13, 0",
+		 .tst_fn = line_13_17_h},
+		{.name = "line_v 0, 0, 13, 17 vs 13, 0, 0, 17",
+		 .tst_fn = line_13_17_v},
+		{.name = "line 0, 0, 13, 17 rot 90",
+		 .tst_fn = line_13_17_rot},
+		{.name = "line_h 0, 0, 13, 18 vs 0, 18, 13, 0",
+		 .tst_fn = line_13_18_h},
+		{.name = "line_v 0, 0, 13, 18 vs 13, 0, 0, 18",
+		 .tst_fn = line_13_18_v},
+		{.name = "line 0, 0, 13, 18 rot 90",
+		 .tst_fn = line_13_18_rot},
+		{.name = "line_h 0, 0, 13, 19 vs 0, 19, 13, 0",
+		 .tst_fn = line_13_19_h},
+		{.name = "line_v 0, 0, 13, 19 vs 13, 0, 0, 19",
+		 .tst_fn = line_13_19_v},
+		{.name = "line 0, 0, 13, 19 rot 90",
+		 .tst_fn = line_13_19_rot},
+		{.name = "line_h 0, 0, 13, 20 vs 0, 20, 13, 0",
+		 .tst_fn = line_13_20_h},
+		{.name = "line_v 0, 0, 13, 20 vs 13, 0, 0, 20",
+		 .tst_fn = line_13_20_v},
+		{.name = "line 0, 0, 13, 20 rot 90",
+		 .tst_fn = line_13_20_rot},
+		{.name = "line_h 0, 0, 14, 1 vs 0, 1, 14, 0",
+		 .tst_fn = line_14_1_h},
+		{.name = "line_v 0, 0, 14, 1 vs 14, 0, 0, 1",
+		 .tst_fn = line_14_1_v},
+		{.name = "line 0, 0, 14, 1 rot 90",
+		 .tst_fn = line_14_1_rot},
+		{.name = "line_h 0, 0, 14, 2 vs 0, 2, 14, 0",
+		 .tst_fn = line_14_2_h},
+		{.name = "line_v 0, 0, 14, 2 vs 14, 0, 0, 2",
+		 .tst_fn = line_14_2_v},
+		{.name = "line 0, 0, 14, 2 rot 90",
+		 .tst_fn = line_14_2_rot},
+		{.name = "line_h 0, 0, 14, 3 vs 0, 3, 14, 0",
+		 .tst_fn = line_14_3_h},
+		{.name = "line_v 0, 0, 14, 3 vs 14, 0, 0, 3",
+		 .tst_fn = line_14_3_v},
+		{.name = "line 0, 0, 14, 3 rot 90",
+		 .tst_fn = line_14_3_rot},
+		{.name = "line_h 0, 0, 14, 4 vs 0, 4, 14, 0",
+		 .tst_fn = line_14_4_h},
+		{.name = "line_v 0, 0, 14, 4 vs 14, 0, 0, 4",
+		 .tst_fn = line_14_4_v},
+		{.name = "line 0, 0, 14, 4 rot 90",
+		 .tst_fn = line_14_4_rot},
+		{.name = "line_h 0, 0, 14, 5 vs 0, 5, 14, 0",
+		 .tst_fn = line_14_5_h},
+		{.name = "line_v 0, 0, 14, 5 vs 14, 0, 0, 5",
+		 .tst_fn = line_14_5_v},
+		{.name = "line 0, 0, 14, 5 rot 90",
+		 .tst_fn = line_14_5_rot},
+		{.name = "line_h 0, 0, 14, 6 vs 0, 6, 14, 0",
+		 .tst_fn = line_14_6_h},
+		{.name = "line_v 0, 0, 14, 6 vs 14, 0, 0, 6",
+		 .tst_fn = line_14_6_v},
+		{.name = "line 0, 0, 14, 6 rot 90",
+		 .tst_fn = line_14_6_rot},
+		{.name = "line_h 0, 0, 14, 7 vs 0, 7, 14, 0",
+		 .tst_fn = line_14_7_h},
+		{.name = "line_v 0, 0, 14, 7 vs 14, 0, 0, 7",
+		 .tst_fn = line_14_7_v},
+		{.name = "line 0, 0, 14, 7 rot 90",
+		 .tst_fn = line_14_7_rot},
+		{.name = "line_h 0, 0, 14, 8 vs 0, 8, 14, 0",
+		 .tst_fn = line_14_8_h},
+		{.name = "line_v 0, 0, 14, 8 vs 14, 0, 0, 8",
+		 .tst_fn = line_14_8_v},
+		{.name = "line 0, 0, 14, 8 rot 90",
+		 .tst_fn = line_14_8_rot},
+		{.name = "line_h 0, 0, 14, 9 vs 0, 9, 14, 0",
+		 .tst_fn = line_14_9_h},
+		{.name = "line_v 0, 0, 14, 9 vs 14, 0, 0, 9",
+		 .tst_fn = line_14_9_v},
+		{.name = "line 0, 0, 14, 9 rot 90",
+		 .tst_fn = line_14_9_rot},
+		{.name = "line_h 0, 0, 14, 10 vs 0, 10, 14, 0",
+		 .tst_fn = line_14_10_h},
+		{.name = "line_v 0, 0, 14, 10 vs 14, 0, 0, 10",
+		 .tst_fn = line_14_10_v},
+		{.name = "line 0, 0, 14, 10 rot 90",
+		 .tst_fn = line_14_10_rot},
+		{.name = "line_h 0, 0, 14, 11 vs 0, 11, 14, 0",
+		 .tst_fn = line_14_11_h},
+		{.name = "line_v 0, 0, 14, 11 vs 14, 0, 0, 11",
+		 .tst_fn = line_14_11_v},
+		{.name = "line 0, 0, 14, 11 rot 90",
+		 .tst_fn = line_14_11_rot},
+		{.name = "line_h 0, 0, 14, 12 vs 0, 12, 14, 0",
+		 .tst_fn = line_14_12_h},
+		{.name = "line_v 0, 0, 14, 12 vs 14, 0, 0, 12",
+		 .tst_fn = line_14_12_v},
+		{.name = "line 0, 0, 14, 12 rot 90",
+		 .tst_fn = line_14_12_rot},
+		{.name = "line_h 0, 0, 14, 13 vs 0, 13, 14, 0",
+		 .tst_fn = line_14_13_h},
+		{.name = "line_v 0, 0, 14, 13 vs 14, 0, 0, 13",
+		 .tst_fn = line_14_13_v},
+		{.name = "line 0, 0, 14, 13 rot 90",
+		 .tst_fn = line_14_13_rot},
+		{.name = "line_h 0, 0, 14, 14 vs 0, 14, 14, 0",
+		 .tst_fn = line_14_14_h},
+		{.name = "line_v 0, 0, 14, 14 vs 14, 0, 0, 14",
+		 .tst_fn = line_14_14_v},
+		{.name = "line 0, 0, 14, 14 rot 90",
+		 .tst_fn = line_14_14_rot},
+		{.name = "line_h 0, 0, 14, 15 vs 0, 15, 14, 0",
+		 .tst_fn = line_14_15_h},
+		{.name = "line_v 0, 0, 14, 15 vs 14, 0, 0, 15",
+		 .tst_fn = line_14_15_v},
+		{.name = "line 0, 0, 14, 15 rot 90",
+		 .tst_fn = line_14_15_rot},
+		{.name = "line_h 0, 0, 14, 16 vs 0, 16, 14, 0",
+		 .tst_fn = line_14_16_h},
+		{.name = "line_v 0, 0, 14, 16 vs 14, 0, 0, 16",
+		 .tst_fn = line_14_16_v},
+		{.name = "line 0, 0, 14, 16 rot 90",
+		 .tst_fn = line_14_16_rot},
+		{.name = "line_h 0, 0, 14, 17 vs 0, 17, 14, 0",
+		 .tst_fn = line_14_17_h},
+		{.name = "line_v 0, 0, 14, 17 vs 14, 0, 0, 17",
+		 .tst_fn = line_14_17_v},
+		{.name = "line 0, 0, 14, 17 rot 90",
+		 .tst_fn = line_14_17_rot},
+		{.name = "line_h 0, 0, 14, 18 vs 0, 18, 14, 0",
+		 .tst_fn = line_14_18_h},
+		{.name = "line_v 0, 0, 14, 18 vs 14, 0, 0, 18",
+		 .tst_fn = line_14_18_v},
+		{.name = "line 0, 0, 14, 18 rot 90",
+		 .tst_fn = line_14_18_rot},
+		{.name = "line_h 0, 0, 14, 19 vs 0, 19, 14, 0",
+		 .tst_fn = line_14_19_h},
+		{.name = "line_v 0, 0, 14, 19 vs 14, 0, 0, 19",
+		 .tst_fn = line_14_19_v},
+		{.name = "line 0, 0, 14, 19 rot 90",
+		 .tst_fn = line_14_19_rot},
+		{.name = "line_h 0, 0, 14, 20 vs 0, 20, 14, 0",
+		 .tst_fn = line_14_20_h},
+		{.name = "line_v 0, 0, 14, 20 vs 14, 0, 0, 20",
+		 .tst_fn = line_14_20_v},
+		{.name = "line 0, 0, 14, 20 rot 90",
+		 .tst_fn = line_14_20_rot},
+		{.name = "line_h 0, 0, 15, 1 vs 0, 1, 15, 0",
+		 .tst_fn = line_15_1_h},
+		{.name = "line_v 0, 0, 15, 1 vs 15, 0, 0, 1",
+		 .tst_fn = line_15_1_v},
+		{.name = "line 0, 0, 15, 1 rot 90",
+		 .tst_fn = line_15_1_rot},
+		{.name = "line_h 0, 0, 15, 2 vs 0, 2, 15, 0",
+		 .tst_fn = line_15_2_h},
+		{.name = "line_v 0, 0, 15, 2 vs 15, 0, 0, 2",
+		 .tst_fn = line_15_2_v},
+		{.name = "line 0, 0, 15, 2 rot 90",
+		 .tst_fn = line_15_2_rot},
+		{.name = "line_h 0, 0, 15, 3 vs 0, 3, 15, 0",
+		 .tst_fn = line_15_3_h},
+		{.name = "line_v 0, 0, 15, 3 vs 15, 0, 0, 3",
+		 .tst_fn = line_15_3_v},
+		{.name = "line 0, 0, 15, 3 rot 90",
+		 .tst_fn = line_15_3_rot},
+		{.name = "line_h 0, 0, 15, 4 vs 0, 4, 15, 0",
+		 .tst_fn = line_15_4_h},
+		{.name = "line_v 0, 0, 15, 4 vs 15, 0, 0, 4",
+		 .tst_fn = line_15_4_v},
+		{.name = "line 0, 0, 15, 4 rot 90",
+		 .tst_fn = line_15_4_rot},
+		{.name = "line_h 0, 0, 15, 5 vs 0, 5, 15, 0",
+		 .tst_fn = line_15_5_h},
+		{.name = "line_v 0, 0, 15, 5 vs 15, 0, 0, 5",
+		 .tst_fn = line_15_5_v},
+		{.name = "line 0, 0, 15, 5 rot 90",
+		 .tst_fn = line_15_5_rot},
+		{.name = "line_h 0, 0, 15, 6 vs 0, 6, 15, 0",
+		 .tst_fn = line_15_6_h},
+		{.name = "line_v 0, 0, 15, 6 vs 15, 0, 0, 6",
+		 .tst_fn = line_15_6_v},
+		{.name = "line 0, 0, 15, 6 rot 90",
+		 .tst_fn = line_15_6_rot},
+		{.name = "line_h 0, 0, 15, 7 vs 0, 7, 15, 0",
+		 .tst_fn = line_15_7_h},
+		{.name = "line_v 0, 0, 15, 7 vs 15, 0, 0, 7",
+		 .tst_fn = line_15_7_v},
+		{.name = "line 0, 0, 15, 7 rot 90",
+		 .tst_fn = line_15_7_rot},
+		{.name = "line_h 0, 0, 15, 8 vs 0, 8, 15, 0",
+		 .tst_fn = line_15_8_h},
+		{.name = "line_v 0, 0, 15, 8 vs 15, 0, 0, 8",
+		 .tst_fn = line_15_8_v},
+		{.name = "line 0, 0, 15, 8 rot 90",
+		 .tst_fn = line_15_8_rot},
+		{.name = "line_h 0, 0, 15, 9 vs 0, 9, 15, 0",
+		 .tst_fn = line_15_9_h},
+		{.name = "line_v 0, 0, 15, 9 vs 15, 0, 0, 9",
+		 .tst_fn = line_15_9_v},
+		{.name = "line 0, 0, 15, 9 rot 90",
+		 .tst_fn = line_15_9_rot},
+		{.name = "line_h 0, 0, 15, 10 vs 0, 10, 15, 0",
+		 .tst_fn = line_15_10_h},
+		{.name = "line_v 0, 0, 15, 10 vs 15, 0, 0, 10",
+		 .tst_fn = line_15_10_v},
+		{.name = "line 0, 0, 15, 10 rot 90",
+		 .tst_fn = line_15_10_rot},
+		{.name = "line_h 0, 0, 15, 11 vs 0, 11, 15, 0",
+		 .tst_fn = line_15_11_h},
+		{.name = "line_v 0, 0, 15, 11 vs 15, 0, 0, 11",
+		 .tst_fn = line_15_11_v},
+		{.name = "line 0, 0, 15, 11 rot 90",
+		 .tst_fn = line_15_11_rot},
+		{.name = "line_h 0, 0, 15, 12 vs 0, 12, 15, 0",
+		 .tst_fn = line_15_12_h},
+		{.name = "line_v 0, 0, 15, 12 vs 15, 0, 0, 12",
+		 .tst_fn = line_15_12_v},
+		{.name = "line 0, 0, 15, 12 rot 90",
+		 .tst_fn = line_15_12_rot},
+		{.name = "line_h 0, 0, 15, 13 vs 0, 13, 15, 0",
+		 .tst_fn = line_15_13_h},
+		{.name = "line_v 0, 0, 15, 13 vs 15, 0, 0, 13",
+		 .tst_fn = line_15_13_v},
+		{.name = "line 0, 0, 15, 13 rot 90",
+		 .tst_fn = line_15_13_rot},
+		{.name = "line_h 0, 0, 15, 14 vs 0, 14, 15, 0",
+		 .tst_fn = line_15_14_h},
+		{.name = "line_v 0, 0, 15, 14 vs 15, 0, 0, 14",
+		 .tst_fn = line_15_14_v},
+		{.name = "line 0, 0, 15, 14 rot 90",
+		 .tst_fn = line_15_14_rot},
+		{.name = "line_h 0, 0, 15, 15 vs 0, 15, 15, 0",
+		 .tst_fn = line_15_15_h},
+		{.name = "line_v 0, 0, 15, 15 vs 15, 0, 0, 15",
+		 .tst_fn = line_15_15_v},
+		{.name = "line 0, 0, 15, 15 rot 90",
+		 .tst_fn = line_15_15_rot},
+		{.name = "line_h 0, 0, 15, 16 vs 0, 16, 15, 0",
+		 .tst_fn = line_15_16_h},
+		{.name = "line_v 0, 0, 15, 16 vs 15, 0, 0, 16",
+		 .tst_fn = line_15_16_v},
+		{.name = "line 0, 0, 15, 16 rot 90",
+		 .tst_fn = line_15_16_rot},
+		{.name = "line_h 0, 0, 15, 17 vs 0, 17, 15, 0",
+		 .tst_fn = line_15_17_h},
+		{.name = "line_v 0, 0, 15, 17 vs 15, 0, 0, 17",
+		 .tst_fn = line_15_17_v},
+		{.name = "line 0, 0, 15, 17 rot 90",
+		 .tst_fn = line_15_17_rot},
+		{.name = "line_h 0, 0, 15, 18 vs 0, 18, 15, 0",
+		 .tst_fn = line_15_18_h},
+		{.name = "line_v 0, 0, 15, 18 vs 15, 0, 0, 18",
+		 .tst_fn = line_15_18_v},
+		{.name = "line 0, 0, 15, 18 rot 90",
+		 .tst_fn = line_15_18_rot},
+		{.name = "line_h 0, 0, 15, 19 vs 0, 19, 15, 0",
+		 .tst_fn = line_15_19_h},
+		{.name = "line_v 0, 0, 15, 19 vs 15, 0, 0, 19",
+		 .tst_fn = line_15_19_v},
+		{.name = "line 0, 0, 15, 19 rot 90",
+		 .tst_fn = line_15_19_rot},
+		{.name = "line_h 0, 0, 15, 20 vs 0, 20, 15, 0",
+		 .tst_fn = line_15_20_h},
+		{.name = "line_v 0, 0, 15, 20 vs 15, 0, 0, 20",
+		 .tst_fn = line_15_20_v},
+		{.name = "line 0, 0, 15, 20 rot 90",
+		 .tst_fn = line_15_20_rot},
+		{.name = "line_h 0, 0, 16, 1 vs 0, 1, 16, 0",
+		 .tst_fn = line_16_1_h},
+		{.name = "line_v 0, 0, 16, 1 vs 16, 0, 0, 1",
+		 .tst_fn = line_16_1_v},
+		{.name = "line 0, 0, 16, 1 rot 90",
+		 .tst_fn = line_16_1_rot},
+		{.name = "line_h 0, 0, 16, 2 vs 0, 2, 16, 0",
+		 .tst_fn = line_16_2_h},
+		{.name = "line_v 0, 0, 16, 2 vs 16, 0, 0, 2",
+		 .tst_fn = line_16_2_v},
+		{.name = "line 0, 0, 16, 2 rot 90",
+		 .tst_fn = line_16_2_rot},
+		{.name = "line_h 0, 0, 16, 3 vs 0, 3, 16, 0",
+		 .tst_fn = line_16_3_h},
+		{.name = "line_v 0, 0, 16, 3 vs 16, 0, 0, 3",
+		 .tst_fn = line_16_3_v},
+		{.name = "line 0, 0, 16, 3 rot 90",
+		 .tst_fn = line_16_3_rot},
+		{.name = "line_h 0, 0, 16, 4 vs 0, 4, 16, 0",
+		 .tst_fn = line_16_4_h},
+		{.name = "line_v 0, 0, 16, 4 vs 16, 0, 0, 4",
+		 .tst_fn = line_16_4_v},
+		{.name = "line 0, 0, 16, 4 rot 90",
+		 .tst_fn = line_16_4_rot},
+		{.name = "line_h 0, 0, 16, 5 vs 0, 5, 16, 0",
+		 .tst_fn = line_16_5_h},
+		{.name = "line_v 0, 0, 16, 5 vs 16, 0, 0, 5",
+		 .tst_fn = line_16_5_v},
+		{.name = "line 0, 0, 16, 5 rot 90",
+		 .tst_fn = line_16_5_rot},
+		{.name = "line_h 0, 0, 16, 6 vs 0, 6, 16, 0",
+		 .tst_fn = line_16_6_h},
+		{.name = "line_v 0, 0, 16, 6 vs 16, 0, 0, 6",
+		 .tst_fn = line_16_6_v},
+		{.name = "line 0, 0, 16, 6 rot 90",
+		 .tst_fn = line_16_6_rot},
+		{.name = "line_h 0, 0, 16, 7 vs 0, 7, 16, 0",
+		 .tst_fn = line_16_7_h},
+		{.name = "line_v 0, 0, 16, 7 vs 16, 0, 0, 7",
+		 .tst_fn = line_16_7_v},
+		{.name = "line 0, 0, 16, 7 rot 90",
+		 .tst_fn = line_16_7_rot},
+		{.name = "line_h 0, 0, 16, 8 vs 0, 8, 16, 0",
+		 .tst_fn = line_16_8_h},
+		{.name = "line_v 0, 0, 16, 8 vs 16, 0, 0, 8",
+		 .tst_fn = line_16_8_v},
+		{.name = "line 0, 0, 16, 8 rot 90",
+		 .tst_fn = line_16_8_rot},
+		{.name = "line_h 0, 0, 16, 9 vs 0, 9, 16, 0",
+		 .tst_fn = line_16_9_h},
+		{.name = "line_v 0, 0, 16, 9 vs 16, 0, 0, 9",
+		 .tst_fn = line_16_9_v},
+		{.name = "line 0, 0, 16, 9 rot 90",
+		 .tst_fn = line_16_9_rot},
+		{.name = "line_h 0, 0, 16, 10 vs 0, 10, 16, 0",
+		 .tst_fn = line_16_10_h},
+		{.name = "line_v 0, 0, 16, 10 vs 16, 0, 0, 10",
+		 .tst_fn = line_16_10_v},
+		{.name = "line 0, 0, 16, 10 rot 90",
+		 .tst_fn = line_16_10_rot},
+		{.name = "line_h 0, 0, 16, 11 vs 0, 11, 16, 0",
+		 .tst_fn = line_16_11_h},
+		{.name = "line_v 0, 0, 16, 11 vs 16, 0, 0, 11",
+		 .tst_fn = line_16_11_v},
+		{.name = "line 0, 0, 16, 11 rot 90",
+		 .tst_fn = line_16_11_rot},
+		{.name = "line_h 0, 0, 16, 12 vs 0, 12, 16, 0",
+		 .tst_fn = line_16_12_h},
+		{.name = "line_v 0, 0, 16, 12 vs 16, 0, 0, 12",
+		 .tst_fn = line_16_12_v},
+		{.name = "line 0, 0, 16, 12 rot 90",
+		 .tst_fn = line_16_12_rot},
+		{.name = "line_h 0, 0, 16, 13 vs 0, 13, 16, 0",
+		 .tst_fn = line_16_13_h},
+		{.name = "line_v 0, 0, 16, 13 vs 16, 0, 0, 13",
+		 .tst_fn = line_16_13_v},
+		{.name = "line 0, 0, 16, 13 rot 90",
+		 .tst_fn = line_16_13_rot},
+		{.name = "line_h 0, 0, 16, 14 vs 0, 14, 16, 0",
+		 .tst_fn = line_16_14_h},
+		{.name = "line_v 0, 0, 16, 14 vs 16, 0, 0, 14",
+		 .tst_fn = line_16_14_v},
+		{.name = "line 0, 0, 16, 14 rot 90",
+		 .tst_fn = line_16_14_rot},
+		{.name = "line_h 0, 0, 16, 15 vs 0, 15, 16, 0",
+		 .tst_fn = line_16_15_h},
+		{.name = "line_v 0, 0, 16, 15 vs 16, 0, 0, 15",
+		 .tst_fn = line_16_15_v},
+		{.name = "line 0, 0, 16, 15 rot 90",
+		 .tst_fn = line_16_15_rot},
+		{.name = "line_h 0, 0, 16, 16 vs 0, 16, 16, 0",
+		 .tst_fn = line_16_16_h},
+		{.name = "line_v 0, 0, 16, 16 vs 16, 0, 0, 16",
+		 .tst_fn = line_16_16_v},
+		{.name = "line 0, 0, 16, 16 rot 90",
+		 .tst_fn = line_16_16_rot},
+		{.name = "line_h 0, 0, 16, 17 vs 0, 17, 16, 0",
+		 .tst_fn = line_16_17_h},
+		{.name = "line_v 0, 0, 16, 17 vs 16, 0, 0, 17",
+		 .tst_fn = line_16_17_v},
+		{.name = "line 0, 0, 16, 17 rot 90",
+		 .tst_fn = line_16_17_rot},
+		{.name = "line_h 0, 0, 16, 18 vs 0, 18, 16, 0",
+		 .tst_fn = line_16_18_h},
+		{.name = "line_v 0, 0, 16, 18 vs 16, 0, 0, 18",
+		 .tst_fn = line_16_18_v},
+		{.name = "line 0, 0, 16, 18 rot 90",
+		 .tst_fn = line_16_18_rot},
+		{.name = "line_h 0, 0, 16, 19 vs 0, 19, 16, 0",
+		 .tst_fn = line_16_19_h},
+		{.name = "line_v 0, 0, 16, 19 vs 16, 0, 0, 19",
+		 .tst_fn = line_16_19_v},
+		{.name = "line 0, 0, 16, 19 rot 90",
+		 .tst_fn = line_16_19_rot},
+		{.name = "line_h 0, 0, 16, 20 vs 0, 20, 16, 0",
+		 .tst_fn = line_16_20_h},
+		{.name = "line_v 0, 0, 16, 20 vs 16, 0, 0, 20",
+		 .tst_fn = line_16_20_v},
+		{.name = "line 0, 0, 16, 20 rot 90",
+		 .tst_fn = line_16_20_rot},
+		{.name = "line_h 0, 0, 17, 1 vs 0, 1, 17, 0",
+		 .tst_fn = line_17_1_h},
+		{.name = "line_v 0, 0, 17, 1 vs 17, 0, 0, 1",
+		 .tst_fn = line_17_1_v},
+		{.name = "line 0, 0, 17, 1 rot 90",
+		 .tst_fn = line_17_1_rot},
+		{.name = "line_h 0, 0, 17, 2 vs 0, 2, 17, 0",
+		 .tst_fn = line_17_2_h},
+		{.name = "line_v 0, 0, 17, 2 vs 17, 0, 0, 2",
+		 .tst_fn = line_17_2_v},
+		{.name = "line 0, 0, 17, 2 rot 90",
+		 .tst_fn = line_17_2_rot},
+		{.name = "line_h 0, 0, 17, 3 vs 0, 3, 17, 0",
+		 .tst_fn = line_17_3_h},
+		{.name = "line_v 0, 0, 17, 3 vs 17, 0, 0, 3",
+		 .tst_fn = line_17_3_v},
+		{.name = "line 0, 0, 17, 3 rot 90",
+		 .tst_fn = line_17_3_rot},
+		{.name = "line_h 0, 0, 17, 4 vs 0, 4, 17, 0",
+		 .tst_fn = line_17_4_h},
+		{.name = "line_v 0, 0, 17, 4 vs 17, 0, 0, 4",
+		 .tst_fn = line_17_4_v},
+		{.name = "line 0, 0, 17, 4 rot 90",
+		 .tst_fn = line_17_4_rot},
+		{.name = "line_h 0, 0, 17, 5 vs 0, 5, 17, 0",
+		 .tst_fn = line_17_5_h},
+		{.name = "line_v 0, 0, 17, 5 vs 17, 0, 0, 5",
+		 .tst_fn = line_17_5_v},
+		{.name = "line 0, 0, 17, 5 rot 90",
+		 .tst_fn = line_17_5_rot},
+		{.name = "line_h 0, 0, 17, 6 vs 0, 6, 17, 0",
+		 .tst_fn = line_17_6_h},
+		{.name = "line_v 0, 0, 17, 6 vs 17, 0, 0, 6",
+		 .tst_fn = line_17_6_v},
+		{.name = "line 0, 0, 17, 6 rot 90",
+		 .tst_fn = line_17_6_rot},
+		{.name = "line_h 0, 0, 17, 7 vs 0, 7, 17, 0",
+		 .tst_fn = line_17_7_h},
+		{.name = "line_v 0, 0, 17, 7 vs 17, 0, 0, 7",
+		 .tst_fn = line_17_7_v},
+		{.name = "line 0, 0, 17, 7 rot 90",
+		 .tst_fn = line_17_7_rot},
+		{.name = "line_h 0, 0, 17, 8 vs 0, 8, 17, 0",
+		 .tst_fn = line_17_8_h},
+		{.name = "line_v 0, 0, 17, 8 vs 17, 0, 0, 8",
+		 .tst_fn = line_17_8_v},
+		{.name = "line 0, 0, 17, 8 rot 90",
+		 .tst_fn = line_17_8_rot},
+		{.name = "line_h 0, 0, 17, 9 vs 0, 9, 17, 0",
+		 .tst_fn = line_17_9_h},
+		{.name = "line_v 0, 0, 17, 9 vs 17, 0, 0, 9",
+		 .tst_fn = line_17_9_v},
+		{.name = "line 0, 0, 17, 9 rot 90",
+		 .tst_fn = line_17_9_rot},
+		{.name = "line_h 0, 0, 17, 10 vs 0, 10, 17, 0",
+		 .tst_fn = line_17_10_h},
+		{.name = "line_v 0, 0, 17, 10 vs 17, 0, 0, 10",
+		 .tst_fn = line_17_10_v},
+		{.name = "line 0, 0, 17, 10 rot 90",
+		 .tst_fn = line_17_10_rot},
+		{.name = "line_h 0, 0, 17, 11 vs 0, 11, 17, 0",
+		 .tst_fn = line_17_11_h},
+		{.name = "line_v 0, 0, 17, 11 vs 17, 0, 0, 11",
+		 .tst_fn = line_17_11_v},
+		{.name = "line 0, 0, 17, 11 rot 90",
+		 .tst_fn = line_17_11_rot},
+		{.name = "line_h 0, 0, 17, 12 vs 0, 12, 17, 0",
+		 .tst_fn = line_17_12_h},
+		{.name = "line_v 0, 0, 17, 12 vs 17, 0, 0, 12",
+		 .tst_fn = line_17_12_v},
+		{.name = "line 0, 0, 17, 12 rot 90",
+		 .tst_fn = line_17_12_rot},
+		{.name = "line_h 0, 0, 17, 13 vs 0, 13, 17, 0",
+		 .tst_fn = line_17_13_h},
+		{.name = "line_v 0, 0, 17, 13 vs 17, 0, 0, 13",
+		 .tst_fn = line_17_13_v},
+		{.name = "line 0, 0, 17, 13 rot 90",
+		 .tst_fn = line_17_13_rot},
+		{.name = "line_h 0, 0, 17, 14 vs 0, 14, 17, 0",
+		 .tst_fn = line_17_14_h},
+		{.name = "line_v 0, 0, 17, 14 vs 17, 0, 0, 14",
+		 .tst_fn = line_17_14_v},
+		{.name = "line 0, 0, 17, 14 rot 90",
+		 .tst_fn = line_17_14_rot},
+		{.name = "line_h 0, 0, 17, 15 vs 0, 15, 17, 0",
+		 .tst_fn = line_17_15_h},
+		{.name = "line_v 0, 0, 17, 15 vs 17, 0, 0, 15",
+		 .tst_fn = line_17_15_v},
+		{.name = "line 0, 0, 17, 15 rot 90",
+		 .tst_fn = line_17_15_rot},
+		{.name = "line_h 0, 0, 17, 16 vs 0, 16, 17, 0",
+		 .tst_fn = line_17_16_h},
+		{.name = "line_v 0, 0, 17, 16 vs 17, 0, 0, 16",
+		 .tst_fn = line_17_16_v},
+		{.name = "line 0, 0, 17, 16 rot 90",
+		 .tst_fn = line_17_16_rot},
+		{.name = "line_h 0, 0, 17, 17 vs 0, 17, 17, 0",
+		 .tst_fn = line_17_17_h},
+		{.name = "line_v 0, 0, 17, 17 vs 17, 0, 0, 17",
+		 .tst_fn = line_17_17_v},
+		{.name = "line 0, 0, 17, 17 rot 90",
+		 .tst_fn = line_17_17_rot},
+		{.name = "line_h 0, 0, 17, 18 vs 0, 18, 17, 0",
+		 .tst_fn = line_17_18_h},
+		{.name = "line_v 0, 0, 17, 18 vs 17, 0, 0, 18",
+		 .tst_fn = line_17_18_v},
+		{.name = "line 0, 0, 17, 18 rot 90",
+		 .tst_fn = line_17_18_rot},
+		{.name = "line_h 0, 0, 17, 19 vs 0, 19, 17, 0",
+		 .tst_fn = line_17_19_h},
+		{.name = "line_v 0, 0, 17, 19 vs 17, 0, 0, 19",
+		 .tst_fn = line_17_19_v},
+		{.name = "line 0, 0, 17, 19 rot 90",
+		 .tst_fn = line_17_19_rot},
+		{.name = "line_h 0, 0, 17, 20 vs 0, 20, 17, 0",
+		 .tst_fn = line_17_20_h},
+		{.name = "line_v 0, 0, 17, 20 vs 17, 0, 0, 20",
+		 .tst_fn = line_17_20_v},
+		{.name = "line 0, 0, 17, 20 rot 90",
+		 .tst_fn = line_17_20_rot},
+		{.name = "line_h 0, 0, 18, 1 vs 0, 1, 18, 0",
+		 .tst_fn = line_18_1_h},
+		{.name = "line_v 0, 0, 18, 1 vs 18, 0, 0, 1",
+		 .tst_fn = line_18_1_v},
+		{.name = "line 0, 0, 18, 1 rot 90",
+		 .tst_fn = line_18_1_rot},
+		{.name = "line_h 0, 0, 18, 2 vs 0, 2, 18, 0",
+		 .tst_fn = line_18_2_h},
+		{.name = "line_v 0, 0, 18, 2 vs 18, 0, 0, 2",
+		 .tst_fn = line_18_2_v},
+		{.name = "line 0, 0, 18, 2 rot 90",
+		 .tst_fn = line_18_2_rot},
+		{.name = "line_h 0, 0, 18, 3 vs 0, 3, 18, 0",
+		 .tst_fn = line_18_3_h},
+		{.name = "line_v 0, 0, 18, 3 vs 18, 0, 0, 3",
+		 .tst_fn = line_18_3_v},
+		{.name = "line 0, 0, 18, 3 rot 90",
+		 .tst_fn = line_18_3_rot},
+		{.name = "line_h 0, 0, 18, 4 vs 0, 4, 18, 0",
+		 .tst_fn = line_18_4_h},
+		{.name = "line_v 0, 0, 18, 4 vs 18, 0, 0, 4",
+		 .tst_fn = line_18_4_v},
+		{.name = "line 0, 0, 18, 4 rot 90",
+		 .tst_fn = line_18_4_rot},
+		{.name = "line_h 0, 0, 18, 5 vs 0, 5, 18, 0",
+		 .tst_fn = line_18_5_h},
+		{.name = "line_v 0, 0, 18, 5 vs 18, 0, 0, 5",
+		 .tst_fn = line_18_5_v},
+		{.name = "line 0, 0, 18, 5 rot 90",
+		 .tst_fn = line_18_5_rot},
+		{.name = "line_h 0, 0, 18, 6 vs 0, 6, 18, 0",
+		 .tst_fn = line_18_6_h},
+		{.name = "line_v 0, 0, 18, 6 vs 18, 0, 0, 6",
+		 .tst_fn = line_18_6_v},
+		{.name = "line 0, 0, 18, 6 rot 90",
+		 .tst_fn = line_18_6_rot},
+		{.name = "line_h 0, 0, 18, 7 vs 0, 7, 18, 0",
+		 .tst_fn = line_18_7_h},
+		{.name = "line_v 0, 0, 18, 7 vs 18, 0, 0, 7",
+		 .tst_fn = line_18_7_v},
+		{.name = "line 0, 0, 18, 7 rot 90",
+		 .tst_fn = line_18_7_rot},
+		{.name = "line_h 0, 0, 18, 8 vs 0, 8, 18, 0",
+		 .tst_fn = line_18_8_h},
+		{.name = "line_v 0, 0, 18, 8 vs 18, 0, 0, 8",
+		 .tst_fn = line_18_8_v},
+		{.name = "line 0, 0, 18, 8 rot 90",
+		 .tst_fn = line_18_8_rot},
+		{.name = "line_h 0, 0, 18, 9 vs 0, 9, 18, 0",
+		 .tst_fn = line_18_9_h},
+		{.name = "line_v 0, 0, 18, 9 vs 18, 0, 0, 9",
+		 .tst_fn = line_18_9_v},
+		{.name = "line 0, 0, 18, 9 rot 90",
+		 .tst_fn = line_18_9_rot},
+		{.name = "line_h 0, 0, 18, 10 vs 0, 10, 18, 0",
+		 .tst_fn = line_18_10_h},
+		{.name = "line_v 0, 0, 18, 10 vs 18, 0, 0, 10",
+		 .tst_fn = line_18_10_v},
+		{.name = "line 0, 0, 18, 10 rot 90",
+		 .tst_fn = line_18_10_rot},
+		{.name = "line_h 0, 0, 18, 11 vs 0, 11, 18, 0",
+		 .tst_fn = line_18_11_h},
+		{.name = "line_v 0, 0, 18, 11 vs 18, 0, 0, 11",
+		 .tst_fn = line_18_11_v},
+		{.name = "line 0, 0, 18, 11 rot 90",
+		 .tst_fn = line_18_11_rot},
+		{.name = "line_h 0, 0, 18, 12 vs 0, 12, 18, 0",
+		 .tst_fn = line_18_12_h},
+		{.name = "line_v 0, 0, 18, 12 vs 18, 0, 0, 12",
+		 .tst_fn = line_18_12_v},
+		{.name = "line 0, 0, 18, 12 rot 90",
+		 .tst_fn = line_18_12_rot},
+		{.name = "line_h 0, 0, 18, 13 vs 0, 13, 18, 0",
+		 .tst_fn = line_18_13_h},
+		{.name = "line_v 0, 0, 18, 13 vs 18, 0, 0, 13",
+		 .tst_fn = line_18_13_v},
+		{.name = "line 0, 0, 18, 13 rot 90",
+		 .tst_fn = line_18_13_rot},
+		{.name = "line_h 0, 0, 18, 14 vs 0, 14, 18, 0",
+		 .tst_fn = line_18_14_h},
+		{.name = "line_v 0, 0, 18, 14 vs 18, 0, 0, 14",
+		 .tst_fn = line_18_14_v},
+		{.name = "line 0, 0, 18, 14 rot 90",
+		 .tst_fn = line_18_14_rot},
+		{.name = "line_h 0, 0, 18, 15 vs 0, 15, 18, 0",
+		 .tst_fn = line_18_15_h},
+		{.name = "line_v 0, 0, 18, 15 vs 18, 0, 0, 15",
+		 .tst_fn = line_18_15_v},
+		{.name = "line 0, 0, 18, 15 rot 90",
+		 .tst_fn = line_18_15_rot},
+		{.name = "line_h 0, 0, 18, 16 vs 0, 16, 18, 0",
+		 .tst_fn = line_18_16_h},
+		{.name = "line_v 0, 0, 18, 16 vs 18, 0, 0, 16",
+		 .tst_fn = line_18_16_v},
+		{.name = "line 0, 0, 18, 16 rot 90",
+		 .tst_fn = line_18_16_rot},
+		{.name = "line_h 0, 0, 18, 17 vs 0, 17, 18, 0",
+		 .tst_fn = line_18_17_h},
+		{.name = "line_v 0, 0, 18, 17 vs 18, 0, 0, 17",
+		 .tst_fn = line_18_17_v},
+		{.name = "line 0, 0, 18, 17 rot 90",
+		 .tst_fn = line_18_17_rot},
+		{.name = "line_h 0, 0, 18, 18 vs 0, 18, 18, 0",
+		 .tst_fn = line_18_18_h},
+		{.name = "line_v 0, 0, 18, 18 vs 18, 0, 0, 18",
+		 .tst_fn = line_18_18_v},
+		{.name = "line 0, 0, 18, 18 rot 90",
+		 .tst_fn = line_18_18_rot},
+		{.name = "line_h 0, 0, 18, 19 vs 0, 19, 18, 0",
+		 .tst_fn = line_18_19_h},
+		{.name = "line_v 0, 0, 18, 19 vs 18, 0, 0, 19",
+		 .tst_fn = line_18_19_v},
+		{.name = "line 0, 0, 18, 19 rot 90",
+		 .tst_fn = line_18_19_rot},
+		{.name = "line_h 0, 0, 18, 20 vs 0, 20, 18, 0",
+		 .tst_fn = line_18_20_h},
+		{.name = "line_v 0, 0, 18, 20 vs 18, 0, 0, 20",
+		 .tst_fn = line_18_20_v},
+		{.name = "line 0, 0, 18, 20 rot 90",
+		 .tst_fn = line_18_20_rot},
+		{.name = "line_h 0, 0, 19, 1 vs 0, 1, 19, 0",
+		 .tst_fn = line_19_1_h},
+		{.name = "line_v 0, 0, 19, 1 vs 19, 0, 0, 1",
+		 .tst_fn = line_19_1_v},
+		{.name = "line 0, 0, 19, 1 rot 90",
+		 .tst_fn = line_19_1_rot},
+		{.name = "line_h 0, 0, 19, 2 vs 0, 2, 19, 0",
+		 .tst_fn = line_19_2_h},
+		{.name = "line_v 0, 0, 19, 2 vs 19, 0, 0, 2",
+		 .tst_fn = line_19_2_v},
+		{.name = "line 0, 0, 19, 2 rot 90",
+		 .tst_fn = line_19_2_rot},
+		{.name = "line_h 0, 0, 19, 3 vs 0, 3, 19, 0",
+		 .tst_fn = line_19_3_h},
+		{.name = "line_v 0, 0, 19, 3 vs 19, 0, 0, 3",
+		 .tst_fn = line_19_3_v},
+		{.name = "line 0, 0, 19, 3 rot 90",
+		 .tst_fn = line_19_3_rot},
+		{.name = "line_h 0, 0, 19, 4 vs 0, 4, 19, 0",
+		 .tst_fn = line_19_4_h},
+		{.name = "line_v 0, 0, 19, 4 vs 19, 0, 0, 4",
+		 .tst_fn = line_19_4_v},
+		{.name = "line 0, 0, 19, 4 rot 90",
+		 .tst_fn = line_19_4_rot},
+		{.name = "line_h 0, 0, 19, 5 vs 0, 5, 19, 0",
+		 .tst_fn = line_19_5_h},
+		{.name = "line_v 0, 0, 19, 5 vs 19, 0, 0, 5",
+		 .tst_fn = line_19_5_v},
+		{.name = "line 0, 0, 19, 5 rot 90",
+		 .tst_fn = line_19_5_rot},
+		{.name = "line_h 0, 0, 19, 6 vs 0, 6, 19, 0",
+		 .tst_fn = line_19_6_h},
+		{.name = "line_v 0, 0, 19, 6 vs 19, 0, 0, 6",
+		 .tst_fn = line_19_6_v},
+		{.name = "line 0, 0, 19, 6 rot 90",
+		 .tst_fn = line_19_6_rot},
+		{.name = "line_h 0, 0, 19, 7 vs 0, 7, 19, 0",
+		 .tst_fn = line_19_7_h},
+		{.name = "line_v 0, 0, 19, 7 vs 19, 0, 0, 7",
+		 .tst_fn = line_19_7_v},
+		{.name = "line 0, 0, 19, 7 rot 90",
+		 .tst_fn = line_19_7_rot},
+		{.name = "line_h 0, 0, 19, 8 vs 0, 8, 19, 0",
+		 .tst_fn = line_19_8_h},
+		{.name = "line_v 0, 0, 19, 8 vs 19, 0, 0, 8",
+		 .tst_fn = line_19_8_v},
+		{.name = "line 0, 0, 19, 8 rot 90",
+		 .tst_fn = line_19_8_rot},
+		{.name = "line_h 0, 0, 19, 9 vs 0, 9, 19, 0",
+		 .tst_fn = line_19_9_h},
+		{.name = "line_v 0, 0, 19, 9 vs 19, 0, 0, 9",
+		 .tst_fn = line_19_9_v},
+		{.name = "line 0, 0, 19, 9 rot 90",
+		 .tst_fn = line_19_9_rot},
+		{.name = "line_h 0, 0, 19, 10 vs 0, 10, 19, 0",
+		 .tst_fn = line_19_10_h},
+		{.name = "line_v 0, 0, 19, 10 vs 19, 0, 0, 10",
+		 .tst_fn = line_19_10_v},
+		{.name = "line 0, 0, 19, 10 rot 90",
+		 .tst_fn = line_19_10_rot},
+		{.name = "line_h 0, 0, 19, 11 vs 0, 11, 19, 0",
+		 .tst_fn = line_19_11_h},
+		{.name = "line_v 0, 0, 19, 11 vs 19, 0, 0, 11",
+		 .tst_fn = line_19_11_v},
+		{.name = "line 0, 0, 19, 11 rot 90",
+		 .tst_fn = line_19_11_rot},
+		{.name = "line_h 0, 0, 19, 12 vs 0, 12, 19, 0",
+		 .tst_fn = line_19_12_h},
+		{.name = "line_v 0, 0, 19, 12 vs 19, 0, 0, 12",
+		 .tst_fn = line_19_12_v},
+		{.name = "line 0, 0, 19, 12 rot 90",
+		 .tst_fn = line_19_12_rot},
+		{.name = "line_h 0, 0, 19, 13 vs 0, 13, 19, 0",
+		 .tst_fn = line_19_13_h},
+		{.name = "line_v 0, 0, 19, 13 vs 19, 0, 0, 13",
+		 .tst_fn = line_19_13_v},
+		{.name = "line 0, 0, 19, 13 rot 90",
+		 .tst_fn = line_19_13_rot},
+		{.name = "line_h 0, 0, 19, 14 vs 0, 14, 19, 0",
+		 .tst_fn = line_19_14_h},
+		{.name = "line_v 0, 0, 19, 14 vs 19, 0, 0, 14",
+		 .tst_fn = line_19_14_v},
+		{.name = "line 0, 0, 19, 14 rot 90",
+		 .tst_fn = line_19_14_rot},
+		{.name = "line_h 0, 0, 19, 15 vs 0, 15, 19, 0",
+		 .tst_fn = line_19_15_h},
+		{.name = "line_v 0, 0, 19, 15 vs 19, 0, 0, 15",
+		 .tst_fn = line_19_15_v},
+		{.name = "line 0, 0, 19, 15 rot 90",
+		 .tst_fn = line_19_15_rot},
+		{.name = "line_h 0, 0, 19, 16 vs 0, 16, 19, 0",
+		 .tst_fn = line_19_16_h},
+		{.name = "line_v 0, 0, 19, 16 vs 19, 0, 0, 16",
+		 .tst_fn = line_19_16_v},
+		{.name = "line 0, 0, 19, 16 rot 90",
+		 .tst_fn = line_19_16_rot},
+		{.name = "line_h 0, 0, 19, 17 vs 0, 17, 19, 0",
+		 .tst_fn = line_19_17_h},
+		{.name = "line_v 0, 0, 19, 17 vs 19, 0, 0, 17",
+		 .tst_fn = line_19_17_v},
+		{.name = "line 0, 0, 19, 17 rot 90",
+		 .tst_fn = line_19_17_rot},
+		{.name = "line_h 0, 0, 19, 18 vs 0, 18, 19, 0",
+		 .tst_fn = line_19_18_h},
+		{.name = "line_v 0, 0, 19, 18 vs 19, 0, 0, 18",
+		 .tst_fn = line_19_18_v},
+		{.name = "line 0, 0, 19, 18 rot 90",
+		 .tst_fn = line_19_18_rot},
+		{.name = "line_h 0, 0, 19, 19 vs 0, 19, 19, 0",
+		 .tst_fn = line_19_19_h},
+		{.name = "line_v 0, 0, 19, 19 vs 19, 0, 0, 19",
+		 .tst_fn = line_19_19_v},
+		{.name = "line 0, 0, 19, 19 rot 90",
+		 .tst_fn = line_19_19_rot},
+		{.name = "line_h 0, 0, 19, 20 vs 0, 20, 19, 0",
+		 .tst_fn = line_19_20_h},
+		{.name = "line_v 0, 0, 19, 20 vs 19, 0, 0, 20",
+		 .tst_fn = line_19_20_v},
+		{.name = "line 0, 0, 19, 20 rot 90",
+		 .tst_fn = line_19_20_rot},
+		{.name = "line_h 0, 0, 20, 1 vs 0, 1, 20, 0",
+		 .tst_fn = line_20_1_h},
+		{.name = "line_v 0, 0, 20, 1 vs 20, 0, 0, 1",
+		 .tst_fn = line_20_1_v},
+		{.name = "line 0, 0, 20, 1 rot 90",
+		 .tst_fn = line_20_1_rot},
+		{.name = "line_h 0, 0, 20, 2 vs 0, 2, 20, 0",
+		 .tst_fn = line_20_2_h},
+		{.name = "line_v 0, 0, 20, 2 vs 20, 0, 0, 2",
+		 .tst_fn = line_20_2_v},
+		{.name = "line 0, 0, 20, 2 rot 90",
+		 .tst_fn = line_20_2_rot},
+		{.name = "line_h 0, 0, 20, 3 vs 0, 3, 20, 0",
+		 .tst_fn = line_20_3_h},
+		{.name = "line_v 0, 0, 20, 3 vs 20, 0, 0, 3",
+		 .tst_fn = line_20_3_v},
+		{.name = "line 0, 0, 20, 3 rot 90",
+		 .tst_fn = line_20_3_rot},
+		{.name = "line_h 0, 0, 20, 4 vs 0, 4, 20, 0",
+		 .tst_fn = line_20_4_h},
+		{.name = "line_v 0, 0, 20, 4 vs 20, 0, 0, 4",
+		 .tst_fn = line_20_4_v},
+		{.name = "line 0, 0, 20, 4 rot 90",
+		 .tst_fn = line_20_4_rot},
+		{.name = "line_h 0, 0, 20, 5 vs 0, 5, 20, 0",
+		 .tst_fn = line_20_5_h},
+		{.name = "line_v 0, 0, 20, 5 vs 20, 0, 0, 5",
+		 .tst_fn = line_20_5_v},
+		{.name = "line 0, 0, 20, 5 rot 90",
+		 .tst_fn = line_20_5_rot},
+		{.name = "line_h 0, 0, 20, 6 vs 0, 6, 20, 0",
+		 .tst_fn = line_20_6_h},
+		{.name = "line_v 0, 0, 20, 6 vs 20, 0, 0, 6",
+		 .tst_fn = line_20_6_v},
+		{.name = "line 0, 0, 20, 6 rot 90",
+		 .tst_fn = line_20_6_rot},
+		{.name = "line_h 0, 0, 20, 7 vs 0, 7, 20, 0",
+		 .tst_fn = line_20_7_h},
+		{.name = "line_v 0, 0, 20, 7 vs 20, 0, 0, 7",
+		 .tst_fn = line_20_7_v},
+		{.name = "line 0, 0, 20, 7 rot 90",
+		 .tst_fn = line_20_7_rot},
+		{.name = "line_h 0, 0, 20, 8 vs 0, 8, 20, 0",
+		 .tst_fn = line_20_8_h},
+		{.name = "line_v 0, 0, 20, 8 vs 20, 0, 0, 8",
+		 .tst_fn = line_20_8_v},
+		{.name = "line 0, 0, 20, 8 rot 90",
+		 .tst_fn = line_20_8_rot},
+		{.name = "line_h 0, 0, 20, 9 vs 0, 9, 20, 0",
+		 .tst_fn = line_20_9_h},
+		{.name = "line_v 0, 0, 20, 9 vs 20, 0, 0, 9",
+		 .tst_fn = line_20_9_v},
+		{.name = "line 0, 0, 20, 9 rot 90",
+		 .tst_fn = line_20_9_rot},
+		{.name = "line_h 0, 0, 20, 10 vs 0, 10, 20, 0",
+		 .tst_fn = line_20_10_h},
+		{.name = "line_v 0, 0, 20, 10 vs 20, 0, 0, 10",
+		 .tst_fn = line_20_10_v},
+		{.name = "line 0, 0, 20, 10 rot 90",
+		 .tst_fn = line_20_10_rot},
+		{.name = "line_h 0, 0, 20, 11 vs 0, 11, 20, 0",
+		 .tst_fn = line_20_11_h},
+		{.name = "line_v 0, 0, 20, 11 vs 20, 0, 0, 11",
+		 .tst_fn = line_20_11_v},
+		{.name = "line 0, 0, 20, 11 rot 90",
+		 .tst_fn = line_20_11_rot},
+		{.name = "line_h 0, 0, 20, 12 vs 0, 12, 20, 0",
+		 .tst_fn = line_20_12_h},
+		{.name = "line_v 0, 0, 20, 12 vs 20, 0, 0, 12",
+		 .tst_fn = line_20_12_v},
+		{.name = "line 0, 0, 20, 12 rot 90",
+		 .tst_fn = line_20_12_rot},
+		{.name = "line_h 0, 0, 20, 13 vs 0, 13, 20, 0",
+		 .tst_fn = line_20_13_h},
+		{.name = "line_v 0, 0, 20, 13 vs 20, 0, 0, 13",
+		 .tst_fn = line_20_13_v},
+		{.name = "line 0, 0, 20, 13 rot 90",
+		 .tst_fn = line_20_13_rot},
+		{.name = "line_h 0, 0, 20, 14 vs 0, 14, 20, 0",
+		 .tst_fn = line_20_14_h},
+		{.name = "line_v 0, 0, 20, 14 vs 20, 0, 0, 14",
+		 .tst_fn = line_20_14_v},
+		{.name = "line 0, 0, 20, 14 rot 90",
+		 .tst_fn = line_20_14_rot},
+		{.name = "line_h 0, 0, 20, 15 vs 0, 15, 20, 0",
+		 .tst_fn = line_20_15_h},
+		{.name = "line_v 0, 0, 20, 15 vs 20, 0, 0, 15",
+		 .tst_fn = line_20_15_v},
+		{.name = "line 0, 0, 20, 15 rot 90",
+		 .tst_fn = line_20_15_rot},
+		{.name = "line_h 0, 0, 20, 16 vs 0, 16, 20, 0",
+		 .tst_fn = line_20_16_h},
+		{.name = "line_v 0, 0, 20, 16 vs 20, 0, 0, 16",
+		 .tst_fn = line_20_16_v},
+		{.name = "line 0, 0, 20, 16 rot 90",
+		 .tst_fn = line_20_16_rot},
+		{.name = "line_h 0, 0, 20, 17 vs 0, 17, 20, 0",
+		 .tst_fn = line_20_17_h},
+		{.name = "line_v 0, 0, 20, 17 vs 20, 0, 0, 17",
+		 .tst_fn = line_20_17_v},
+		{.name = "line 0, 0, 20, 17 rot 90",
+		 .tst_fn = line_20_17_rot},
+		{.name = "line_h 0, 0, 20, 18 vs 0, 18, 20, 0",
+		 .tst_fn = line_20_18_h},
+		{.name = "line_v 0, 0, 20, 18 vs 20, 0, 0, 18",
+		 .tst_fn = line_20_18_v},
+		{.name = "line 0, 0, 20, 18 rot 90",
+		 .tst_fn = line_20_18_rot},
+		{.name = "line_h 0, 0, 20, 19 vs 0, 19, 20, 0",
+		 .tst_fn = line_20_19_h},
+		{.name = "line_v 0, 0, 20, 19 vs 20, 0, 0, 19",
+		 .tst_fn = line_20_19_v},
+		{.name = "line 0, 0, 20, 19 rot 90",
+		 .tst_fn = line_20_19_rot},
+		{.name = "line_h 0, 0, 20, 20 vs 0, 20, 20, 0",
+		 .tst_fn = line_20_20_h},
+		{.name = "line_v 0, 0, 20, 20 vs 20, 0, 0, 20",
+		 .tst_fn = line_20_20_v},
+		{.name = "line 0, 0, 20, 20 rot 90",
+		 .tst_fn = line_20_20_rot},
+		{.name = NULL}
+	}
+};
@@ -3,6 +3,7 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <string.h>
 #include <errno.h>
 #include <sys/stat.h>
@@ -82,22 +83,22 @@ static int xRGB_to_BGR_jpg(void)
 		gp_pixel in_b = colors[x/MUL].b;
 
 		if (SYM_DIFF(in_r, out_r) > THRESHOLD) {
-			tst_msg("Pixel red channel is wrong %02x expected %02x", out_r, in_r);
+			tst_msg("Pixel red channel is wrong %02"PRIx64" expected %02"PRIx64, out_r, in_r);
 			fail = 1;
 		}
 
 		if (SYM_DIFF(in_g, out_g) > THRESHOLD) {
-			tst_msg("Pixel green channel is wrong %02x expected %02x", out_g, in_g);
+			tst_msg("Pixel green channel is wrong %02"PRIx64" expected %02"PRIx64, out_g, in_g);
 			fail = 1;
 		}
 
 		if (SYM_DIFF(in_b, out_b) > THRESHOLD) {
-			tst_msg("Pixel blue channel is wrong %02x expected %02x", out_b, in_b);
+			tst_msg("Pixel blue channel is wrong %02"PRIx64" expected %02"PRIx64, out_b, in_b);
 			fail = 1;
 		}
 
 		if (fail) {
-			tst_msg("Wrong pixel at %i %06x expected %02x%02x%02x", x, p, in_b, in_g, in_r);
+			tst_msg("Wrong pixel at %i %06"PRIx64" expected %02"PRIx64"%02"PRIx64"%02"PRIx64, x, p, in_b, in_g, in_r);
 			ret = TST_FAILED;
 		}
 	}
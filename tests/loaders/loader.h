@@ -6,6 +6,7 @@
 #ifndef TESTS_LOADER_H
 #define TESTS_LOADER_H
 
+#include <inttypes.h>
 #include <loaders/gp_io.h>
 
 struct testcase {
@@ -33,7 +34,7 @@ static int test_check(struct testcase *test, gp_pixmap *img)
 
 			if (pix != test->pix) {
 				if (err < 5)
-					tst_msg("%08x instead of %08x (%ux%u)",
+					tst_msg("%08"PRIx64" instead of %08"PRIx64" (%ux%u)",
 					        pix, test->pix, x, y);
 				err++;
 			}
@@ -221,7 +222,7 @@ static int test_save_load(struct testcase_save_load *test)
 	}
 
 	if (gp_getpixel(img2, 0, 0) != 0) {
-		tst_msg("Pixel value is wrong %x", gp_getpixel(img2, 0, 0));
+		tst_msg("Pixel value is wrong %"PRIx64, gp_getpixel(img2, 0, 0));
 		gp_pixmap_free(img);
 		gp_pixmap_free(img2);
 		return TST_FAILED;
@@ -3,6 +3,7 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <string.h>
 #include <errno.h>
 #include <sys/stat.h>
@@ -62,7 +63,7 @@ static int test_load_pcx(struct testcase *test)
 
 			if (p != test->pixel) {
 				if (!fail)
-					tst_msg("First failed at %u,%u %x %x",
+					tst_msg("First failed at %u,%u %"PRIx64" %"PRIx64,
 					        x, y, p, test->pixel);
 				fail = 1;
 			}
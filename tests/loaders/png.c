@@ -3,12 +3,14 @@
  * Copyright (C) 2009-2013 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <string.h>
 #include <errno.h>
 #include <sys/stat.h>
 
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
 #include <loaders/gp_loaders.h>
 
 #include "tst_test.h"
@@ -73,7 +75,7 @@ static int test_load_PNG_check_color(struct check_color_test *test)
 
 			if (p != test->pixel) {
 				if (!fail)
-					tst_msg("First failed at %u,%u %x %x",
+					tst_msg("First failed at %u,%u %"PRIx64" %"PRIx64,
 					        x, y, p, test->pixel);
 				fail = 1;
 			}
@@ -106,6 +108,54 @@ static struct check_color_test red = {
 	.pixel = 0xff0000,
 };
 
+static int test_load_PNG_premultiply(const char *path)
+{
+	gp_pixmap *img, *img_pm;
+	unsigned int x, y;
+	int ret = TST_SUCCESS;
+
+	img = gp_load_png(path, NULL);
+
+	gp_loader_premultiply_set(1);
+	img_pm = gp_load_png(path, NULL);
+	gp_loader_premultiply_set(0);
+
+	if (!img || !img_pm) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (img_pm->pixel_type != GP_PIXEL_RGBA8888_PM) {
+		tst_msg("Loaded png with wrong pixel type %s",
+		        gp_pixel_type_name(img_pm->pixel_type));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	for (y = 0; y < img->h; y++) {
+		for (x = 0; x < img->w; x++) {
+			gp_pixel p = gp_getpixel(img, x, y);
+			gp_pixel p_pm = gp_getpixel(img_pm, x, y);
+			gp_pixel exp = gp_convert_pixel(p, img->pixel_type,
+			                                GP_PIXEL_RGBA8888_PM);
+
+			if (p_pm != exp) {
+				tst_msg("Pixel %ux%u %08"PRIx64" expected %08"PRIx64,
+				        x, y, p_pm, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+	tst_msg("Pixmap pixels are correct");
+exit:
+	gp_pixmap_free(img);
+	gp_pixmap_free(img_pm);
+	return ret;
+}
+
 static int test_save_PNG(gp_pixel_type pixel_type)
 {
 	gp_pixmap *pixmap;
@@ -156,6 +206,18 @@ const struct tst_suite tst_suite = {
 		 .data = "100x100-red-alpha.png",
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
 
+		{.name = "PNG Load 100x100 RGB 50\% alpha premultiplied",
+		 .tst_fn = test_load_PNG_premultiply,
+		 .res_path = "data/png/valid/100x100-red-alpha.png",
+		 .data = "100x100-red-alpha.png",
+		 .flags = TST_TMPDIR},
+
+		{.name = "PNG Load 100x100 Palette + alpha premultiplied",
+		 .tst_fn = test_load_PNG_premultiply,
+		 .res_path = "data/png/valid/100x100-palette-alpha.png",
+		 .data = "100x100-palette-alpha.png",
+		 .flags = TST_TMPDIR},
+
 		{.name = "PNG Load 100x100 8 bit Grayscale",
 		 .tst_fn = test_load_PNG_check_color,
 		 .res_path = "data/png/valid/100x100-black-grayscale.png",
@@ -6,6 +6,7 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <inttypes.h>
 #include <string.h>
 #include <errno.h>
 #include <stdlib.h>
@@ -71,7 +72,7 @@ static int test(Save Saver, Load Loader, gp_pixel_type pixel_type)
 	}
 
 	if (gp_getpixel(res, 0, 0) != 0) {
-		tst_msg("Pixel value is wrong %x", gp_getpixel(res, 0, 0));
+		tst_msg("Pixel value is wrong %"PRIx64, gp_getpixel(res, 0, 0));
 		ret = TST_FAILED;
 	}
 